@@ -0,0 +1,233 @@
+/// @ref core
+/// @file glm/detail/_color_batch.hpp
+
+#pragma once
+
+#include "_parallel.hpp"
+#include "type_int.hpp"
+#include "type_vec3.hpp"
+
+namespace glm{
+namespace detail
+{
+	// Storage of the channels of a color space in 8-bit buffers: a channel c is stored as
+	// round((Value + Offset[c]) * 255 / Scale[c]), clamped to [0, 255].
+	struct color_encoding
+	{
+		float Scale[3];
+		float Offset[3];
+	};
+
+	GLM_FUNC_QUALIFIER color_encoding color_encoding_rgb()
+	{
+		color_encoding const Encoding = {{1.0f, 1.0f, 1.0f}, {0.0f, 0.0f, 0.0f}};
+		return Encoding;
+	}
+
+	// Hue in degrees
+	GLM_FUNC_QUALIFIER color_encoding color_encoding_hsv()
+	{
+		color_encoding const Encoding = {{360.0f, 1.0f, 1.0f}, {0.0f, 0.0f, 0.0f}};
+		return Encoding;
+	}
+
+	// Chrominances in [-0.5, 0.5]
+	GLM_FUNC_QUALIFIER color_encoding color_encoding_YCoCg()
+	{
+		color_encoding const Encoding = {{1.0f, 1.0f, 1.0f}, {0.0f, 0.5f, 0.5f}};
+		return Encoding;
+	}
+
+	// Floating point channels are converted as is, 8-bit channels are converted in single precision.
+	template <typename T>
+	struct color_channel
+	{
+		typedef T value_type;
+
+		GLM_FUNC_QUALIFIER static T load(T Value, color_encoding const &, std::size_t)
+		{
+			return Value;
+		}
+
+		GLM_FUNC_QUALIFIER static T store(T Value, color_encoding const &, std::size_t)
+		{
+			return Value;
+		}
+	};
+
+	template <>
+	struct color_channel<uint8>
+	{
+		typedef float value_type;
+
+		GLM_FUNC_QUALIFIER static float load(uint8 Value, color_encoding const & Encoding, std::size_t Channel)
+		{
+			return static_cast<float>(Value) * (Encoding.Scale[Channel] / 255.0f) - Encoding.Offset[Channel];
+		}
+
+		GLM_FUNC_QUALIFIER static uint8 store(float Value, color_encoding const & Encoding, std::size_t Channel)
+		{
+			float const Code = (Value + Encoding.Offset[Channel]) * (255.0f / Encoding.Scale[Channel]);
+			return static_cast<uint8>(Code > 0.0f ? (Code < 255.0f ? Code + 0.5f : 255.0f) : 0.0f);
+		}
+	};
+
+	// Loads and stores of four pixels as structures of arrays of value_type
+	template <typename T, precision P>
+	struct color_interleaved_soa4
+	{
+		typedef typename color_channel<T>::value_type value_type;
+
+		GLM_FUNC_QUALIFIER static void load(tvec3<T, P> const * In, color_encoding const & Encoding, value_type * x, value_type * y, value_type * z)
+		{
+			for(std::size_t k = 0; k < 4; ++k)
+			{
+				x[k] = color_channel<T>::load(In[k].x, Encoding, 0);
+				y[k] = color_channel<T>::load(In[k].y, Encoding, 1);
+				z[k] = color_channel<T>::load(In[k].z, Encoding, 2);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void store(value_type const * x, value_type const * y, value_type const * z, color_encoding const & Encoding, tvec3<T, P> * Out)
+		{
+			for(std::size_t k = 0; k < 4; ++k)
+				Out[k] = tvec3<T, P>(
+					color_channel<T>::store(x[k], Encoding, 0),
+					color_channel<T>::store(y[k], Encoding, 1),
+					color_channel<T>::store(z[k], Encoding, 2));
+		}
+	};
+
+	template <typename T>
+	struct color_planar_soa4
+	{
+		typedef typename color_channel<T>::value_type value_type;
+
+		GLM_FUNC_QUALIFIER static void load(T const * In, color_encoding const & Encoding, std::size_t Channel, value_type * x)
+		{
+			for(std::size_t k = 0; k < 4; ++k)
+				x[k] = color_channel<T>::load(In[k], Encoding, Channel);
+		}
+
+		GLM_FUNC_QUALIFIER static void store(value_type const * x, color_encoding const & Encoding, std::size_t Channel, T * Out)
+		{
+			for(std::size_t k = 0; k < 4; ++k)
+				Out[k] = color_channel<T>::store(x[k], Encoding, Channel);
+		}
+	};
+
+	// Minimum number of pixels converted by each thread
+	static std::size_t const color_batch_grain = 16384;
+
+	// Converts the pixels of [Begin, End) four at a time with kernel<value_type>::call(x, y, z, a, b, c),
+	// the last lanes of an incomplete group repeating its last pixel. Buffers may alias.
+	template <template <typename> class kernel, typename T, precision P>
+	struct color_convert_interleaved
+	{
+		typedef typename color_channel<T>::value_type value_type;
+
+		tvec3<T, P> const * In;
+		tvec3<T, P> * Out;
+		color_encoding InEncoding;
+		color_encoding OutEncoding;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			value_type x[4], y[4], z[4], a[4], b[4], c[4];
+			std::size_t i = Begin;
+			for(; i + 4 <= End; i += 4)
+			{
+				color_interleaved_soa4<T, P>::load(In + i, InEncoding, x, y, z);
+				kernel<value_type>::call(x, y, z, a, b, c);
+				color_interleaved_soa4<T, P>::store(a, b, c, OutEncoding, Out + i);
+			}
+
+			if(i == End)
+				return;
+
+			tvec3<T, P> Group[4];
+			for(std::size_t k = 0; k < 4; ++k)
+				Group[k] = In[i + k < End ? i + k : End - 1];
+			color_interleaved_soa4<T, P>::load(Group, InEncoding, x, y, z);
+			kernel<value_type>::call(x, y, z, a, b, c);
+			color_interleaved_soa4<T, P>::store(a, b, c, OutEncoding, Group);
+			for(std::size_t k = 0; i + k < End; ++k)
+				Out[i + k] = Group[k];
+		}
+	};
+
+	template <template <typename> class kernel, typename T>
+	struct color_convert_planar
+	{
+		typedef typename color_channel<T>::value_type value_type;
+
+		T const * InX;
+		T const * InY;
+		T const * InZ;
+		T * OutX;
+		T * OutY;
+		T * OutZ;
+		color_encoding InEncoding;
+		color_encoding OutEncoding;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			value_type x[4], y[4], z[4], a[4], b[4], c[4];
+			std::size_t i = Begin;
+			for(; i + 4 <= End; i += 4)
+			{
+				color_planar_soa4<T>::load(InX + i, InEncoding, 0, x);
+				color_planar_soa4<T>::load(InY + i, InEncoding, 1, y);
+				color_planar_soa4<T>::load(InZ + i, InEncoding, 2, z);
+				kernel<value_type>::call(x, y, z, a, b, c);
+				color_planar_soa4<T>::store(a, OutEncoding, 0, OutX + i);
+				color_planar_soa4<T>::store(b, OutEncoding, 1, OutY + i);
+				color_planar_soa4<T>::store(c, OutEncoding, 2, OutZ + i);
+			}
+
+			if(i == End)
+				return;
+
+			T Group[3][4];
+			for(std::size_t k = 0; k < 4; ++k)
+			{
+				std::size_t const Index = i + k < End ? i + k : End - 1;
+				Group[0][k] = InX[Index];
+				Group[1][k] = InY[Index];
+				Group[2][k] = InZ[Index];
+			}
+			color_planar_soa4<T>::load(Group[0], InEncoding, 0, x);
+			color_planar_soa4<T>::load(Group[1], InEncoding, 1, y);
+			color_planar_soa4<T>::load(Group[2], InEncoding, 2, z);
+			kernel<value_type>::call(x, y, z, a, b, c);
+			color_planar_soa4<T>::store(a, OutEncoding, 0, Group[0]);
+			color_planar_soa4<T>::store(b, OutEncoding, 1, Group[1]);
+			color_planar_soa4<T>::store(c, OutEncoding, 2, Group[2]);
+			for(std::size_t k = 0; i + k < End; ++k)
+			{
+				OutX[i + k] = Group[0][k];
+				OutY[i + k] = Group[1][k];
+				OutZ[i + k] = Group[2][k];
+			}
+		}
+	};
+
+	template <template <typename> class kernel, typename T, precision P>
+	GLM_FUNC_QUALIFIER void color_convert(tvec3<T, P> const * In, tvec3<T, P> * Out, std::size_t Count, color_encoding const & InEncoding, color_encoding const & OutEncoding)
+	{
+		color_convert_interleaved<kernel, T, P> Convert = {In, Out, InEncoding, OutEncoding};
+		parallel_for(Count, color_batch_grain, Convert);
+	}
+
+	template <template <typename> class kernel, typename T>
+	GLM_FUNC_QUALIFIER void color_convert(T const * InX, T const * InY, T const * InZ, T * OutX, T * OutY, T * OutZ, std::size_t Count, color_encoding const & InEncoding, color_encoding const & OutEncoding)
+	{
+		color_convert_planar<kernel, T> Convert = {InX, InY, InZ, OutX, OutY, OutZ, InEncoding, OutEncoding};
+		parallel_for(Count, color_batch_grain, Convert);
+	}
+}//namespace detail
+}//namespace glm
+
+#if GLM_ARCH != GLM_ARCH_PURE
+#	include "_color_batch_simd.inl"
+#endif
@@ -0,0 +1,129 @@
+/// @ref core
+/// @file glm/detail/_color_batch_simd.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include <cstring>
+
+namespace glm{
+namespace detail
+{
+	// Same operations as color_channel<uint8> so that results are identical
+	GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_color_decode(glm_ivec4 Code, color_encoding const & Encoding, std::size_t Channel)
+	{
+		return _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(Code), _mm_set1_ps(Encoding.Scale[Channel] / 255.0f)), _mm_set1_ps(Encoding.Offset[Channel]));
+	}
+
+	GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_color_encode(glm_vec4 Value, color_encoding const & Encoding, std::size_t Channel)
+	{
+		glm_vec4 const Code = _mm_mul_ps(_mm_add_ps(Value, _mm_set1_ps(Encoding.Offset[Channel])), _mm_set1_ps(255.0f / Encoding.Scale[Channel]));
+		glm_vec4 const Clamped = _mm_min_ps(_mm_max_ps(Code, _mm_setzero_ps()), _mm_set1_ps(255.0f));
+		return _mm_cvttps_epi32(_mm_add_ps(Clamped, _mm_set1_ps(0.5f)));
+	}
+
+	// Transposes of four packed tvec3, aligned tvec3 being loaded one by one
+	template <precision P>
+	struct color_interleaved_soa4<float, P>
+	{
+		GLM_FUNC_QUALIFIER static void load(tvec3<float, P> const * In, color_encoding const &, float * x, float * y, float * z)
+		{
+			if(sizeof(tvec3<float, P>) != sizeof(float) * 3)
+			{
+				for(std::size_t k = 0; k < 4; ++k)
+				{
+					x[k] = In[k].x;
+					y[k] = In[k].y;
+					z[k] = In[k].z;
+				}
+				return;
+			}
+
+			float const * Data = &In[0].x;
+			glm_vec4 const a = _mm_loadu_ps(Data);
+			glm_vec4 const b = _mm_loadu_ps(Data + 4);
+			glm_vec4 const c = _mm_loadu_ps(Data + 8);
+
+			_mm_storeu_ps(x, _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0)));
+			_mm_storeu_ps(y, _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+			_mm_storeu_ps(z, _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), c, _MM_SHUFFLE(3, 0, 2, 0)));
+		}
+
+		GLM_FUNC_QUALIFIER static void store(float const * x, float const * y, float const * z, color_encoding const &, tvec3<float, P> * Out)
+		{
+			if(sizeof(tvec3<float, P>) != sizeof(float) * 3)
+			{
+				for(std::size_t k = 0; k < 4; ++k)
+					Out[k] = tvec3<float, P>(x[k], y[k], z[k]);
+				return;
+			}
+
+			glm_vec4 const vx = _mm_loadu_ps(x);
+			glm_vec4 const vy = _mm_loadu_ps(y);
+			glm_vec4 const vz = _mm_loadu_ps(z);
+
+			float * Data = &Out[0].x;
+			_mm_storeu_ps(Data, _mm_shuffle_ps(_mm_shuffle_ps(vx, vy, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(vz, vx, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+			_mm_storeu_ps(Data + 4, _mm_shuffle_ps(_mm_shuffle_ps(vy, vz, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(vx, vy, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+			_mm_storeu_ps(Data + 8, _mm_shuffle_ps(_mm_shuffle_ps(vz, vx, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(vy, vz, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+		}
+	};
+
+	template <precision P>
+	struct color_interleaved_soa4<uint8, P>
+	{
+		GLM_FUNC_QUALIFIER static void load(tvec3<uint8, P> const * In, color_encoding const & Encoding, float * x, float * y, float * z)
+		{
+			_mm_storeu_ps(x, glm_vec4_color_decode(_mm_setr_epi32(In[0].x, In[1].x, In[2].x, In[3].x), Encoding, 0));
+			_mm_storeu_ps(y, glm_vec4_color_decode(_mm_setr_epi32(In[0].y, In[1].y, In[2].y, In[3].y), Encoding, 1));
+			_mm_storeu_ps(z, glm_vec4_color_decode(_mm_setr_epi32(In[0].z, In[1].z, In[2].z, In[3].z), Encoding, 2));
+		}
+
+		GLM_FUNC_QUALIFIER static void store(float const * x, float const * y, float const * z, color_encoding const & Encoding, tvec3<uint8, P> * Out)
+		{
+			int Codes[3][4];
+			_mm_storeu_si128(reinterpret_cast<glm_ivec4*>(Codes[0]), glm_vec4_color_encode(_mm_loadu_ps(x), Encoding, 0));
+			_mm_storeu_si128(reinterpret_cast<glm_ivec4*>(Codes[1]), glm_vec4_color_encode(_mm_loadu_ps(y), Encoding, 1));
+			_mm_storeu_si128(reinterpret_cast<glm_ivec4*>(Codes[2]), glm_vec4_color_encode(_mm_loadu_ps(z), Encoding, 2));
+			for(std::size_t k = 0; k < 4; ++k)
+				Out[k] = tvec3<uint8, P>(static_cast<uint8>(Codes[0][k]), static_cast<uint8>(Codes[1][k]), static_cast<uint8>(Codes[2][k]));
+		}
+	};
+
+	template <>
+	struct color_planar_soa4<float>
+	{
+		GLM_FUNC_QUALIFIER static void load(float const * In, color_encoding const &, std::size_t, float * x)
+		{
+			_mm_storeu_ps(x, _mm_loadu_ps(In));
+		}
+
+		GLM_FUNC_QUALIFIER static void store(float const * x, color_encoding const &, std::size_t, float * Out)
+		{
+			_mm_storeu_ps(Out, _mm_loadu_ps(x));
+		}
+	};
+
+	template <>
+	struct color_planar_soa4<uint8>
+	{
+		GLM_FUNC_QUALIFIER static void load(uint8 const * In, color_encoding const & Encoding, std::size_t Channel, float * x)
+		{
+			int Bytes = 0;
+			std::memcpy(&Bytes, In, 4);
+			glm_ivec4 const Zero = _mm_setzero_si128();
+			glm_ivec4 const Code = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(Bytes), Zero), Zero);
+			_mm_storeu_ps(x, glm_vec4_color_decode(Code, Encoding, Channel));
+		}
+
+		GLM_FUNC_QUALIFIER static void store(float const * x, color_encoding const & Encoding, std::size_t Channel, uint8 * Out)
+		{
+			glm_ivec4 const Code = glm_vec4_color_encode(_mm_loadu_ps(x), Encoding, Channel);
+			glm_ivec4 const Words = _mm_packs_epi32(Code, Code);
+			int const Bytes = _mm_cvtsi128_si32(_mm_packus_epi16(Words, Words));
+			std::memcpy(Out, &Bytes, 4);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,578 @@
+/// @ref core
+/// @file glm/detail/_from_chars.hpp
+
+#pragma once
+
+#include "setup.hpp"
+#include "type_int.hpp"
+#include "_to_chars.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	// Decimal Mantissa * 10^Exponent read from the text [Digits, DigitsLast), Truncated when it has more than 19 significant digits
+	struct chars_number
+	{
+		uint64 Mantissa;
+		int Exponent;
+		bool Negative;
+		bool Truncated;
+		char const * Digits;
+		char const * DigitsLast;
+	};
+
+	// Parameters of the Eisel-Lemire algorithm and of the exact fast path of Clinger for each binary format
+	template <typename T>
+	struct chars_binary
+	{};
+
+	template <>
+	struct chars_binary<float>
+	{
+		typedef uint32 bits;
+		static int const MantissaBits = 23;
+		static int const MinExponent = -127;
+		static int const InfinitePower = 0xFF;
+		static int const MinRoundToEven = -17;
+		static int const MaxRoundToEven = 10;
+		static int const MaxFastExponent = 10;
+		static uint64 const MaxFastMantissa = 16777216;
+
+		// Whether the powers of five cover the exponents of every finite nonzero result
+		static bool const Complete = true;
+	};
+
+	template <>
+	struct chars_binary<double>
+	{
+		typedef uint64 bits;
+		static int const MantissaBits = 52;
+		static int const MinExponent = -1023;
+		static int const InfinitePower = 0x7FF;
+		static int const MinRoundToEven = -4;
+		static int const MaxRoundToEven = 23;
+		static int const MaxFastExponent = 22;
+		static uint64 const MaxFastMantissa = 9007199254740992ull;
+		static bool const Complete = false;
+	};
+
+	// Decimal exponents of the table of powers of five
+	static int const chars_min_pow5 = -65;
+	static int const chars_max_pow5 = 38;
+
+	// 5^q normalized to 128 bits, rounded up for negative q and truncated for positive q, as high and low words
+	GLM_FUNC_QUALIFIER uint64 const * chars_pow5_128(int q)
+	{
+		static uint64 const Table[208] =
+		{
+			0x86ccbb52ea94baeaull, 0x98e947129fc2b4e9ull, 0xa87fea27a539e9a5ull, 0x3f2398d747b36224ull,
+			0xd29fe4b18e88640eull, 0x8eec7f0d19a03aadull, 0x83a3eeeef9153e89ull, 0x1953cf68300424acull,
+			0xa48ceaaab75a8e2bull, 0x5fa8c3423c052dd7ull, 0xcdb02555653131b6ull, 0x3792f412cb06794dull,
+			0x808e17555f3ebf11ull, 0xe2bbd88bbee40bd0ull, 0xa0b19d2ab70e6ed6ull, 0x5b6aceaeae9d0ec4ull,
+			0xc8de047564d20a8bull, 0xf245825a5a445275ull, 0xfb158592be068d2eull, 0xeed6e2f0f0d56712ull,
+			0x9ced737bb6c4183dull, 0x55464dd69685606bull, 0xc428d05aa4751e4cull, 0xaa97e14c3c26b886ull,
+			0xf53304714d9265dfull, 0xd53dd99f4b3066a8ull, 0x993fe2c6d07b7fabull, 0xe546a8038efe4029ull,
+			0xbf8fdb78849a5f96ull, 0xde98520472bdd033ull, 0xef73d256a5c0f77cull, 0x963e66858f6d4440ull,
+			0x95a8637627989aadull, 0xdde7001379a44aa8ull, 0xbb127c53b17ec159ull, 0x5560c018580d5d52ull,
+			0xe9d71b689dde71afull, 0xaab8f01e6e10b4a6ull, 0x9226712162ab070dull, 0xcab3961304ca70e8ull,
+			0xb6b00d69bb55c8d1ull, 0x3d607b97c5fd0d22ull, 0xe45c10c42a2b3b05ull, 0x8cb89a7db77c506aull,
+			0x8eb98a7a9a5b04e3ull, 0x77f3608e92adb242ull, 0xb267ed1940f1c61cull, 0x55f038b237591ed3ull,
+			0xdf01e85f912e37a3ull, 0x6b6c46dec52f6688ull, 0x8b61313bbabce2c6ull, 0x2323ac4b3b3da015ull,
+			0xae397d8aa96c1b77ull, 0xabec975e0a0d081aull, 0xd9c7dced53c72255ull, 0x96e7bd358c904a21ull,
+			0x881cea14545c7575ull, 0x7e50d64177da2e54ull, 0xaa242499697392d2ull, 0xdde50bd1d5d0b9e9ull,
+			0xd4ad2dbfc3d07787ull, 0x955e4ec64b44e864ull, 0x84ec3c97da624ab4ull, 0xbd5af13bef0b113eull,
+			0xa6274bbdd0fadd61ull, 0xecb1ad8aeacdd58eull, 0xcfb11ead453994baull, 0x67de18eda5814af2ull,
+			0x81ceb32c4b43fcf4ull, 0x80eacf948770ced7ull, 0xa2425ff75e14fc31ull, 0xa1258379a94d028dull,
+			0xcad2f7f5359a3b3eull, 0x096ee45813a04330ull, 0xfd87b5f28300ca0dull, 0x8bca9d6e188853fcull,
+			0x9e74d1b791e07e48ull, 0x775ea264cf55347eull, 0xc612062576589ddaull, 0x95364afe032a819eull,
+			0xf79687aed3eec551ull, 0x3a83ddbd83f52205ull, 0x9abe14cd44753b52ull, 0xc4926a9672793543ull,
+			0xc16d9a0095928a27ull, 0x75b7053c0f178294ull, 0xf1c90080baf72cb1ull, 0x5324c68b12dd6339ull,
+			0x971da05074da7beeull, 0xd3f6fc16ebca5e04ull, 0xbce5086492111aeaull, 0x88f4bb1ca6bcf585ull,
+			0xec1e4a7db69561a5ull, 0x2b31e9e3d06c32e6ull, 0x9392ee8e921d5d07ull, 0x3aff322e62439fd0ull,
+			0xb877aa3236a4b449ull, 0x09befeb9fad487c3ull, 0xe69594bec44de15bull, 0x4c2ebe687989a9b4ull,
+			0x901d7cf73ab0acd9ull, 0x0f9d37014bf60a11ull, 0xb424dc35095cd80full, 0x538484c19ef38c95ull,
+			0xe12e13424bb40e13ull, 0x2865a5f206b06fbaull, 0x8cbccc096f5088cbull, 0xf93f87b7442e45d4ull,
+			0xafebff0bcb24aafeull, 0xf78f69a51539d749ull, 0xdbe6fecebdedd5beull, 0xb573440e5a884d1cull,
+			0x89705f4136b4a597ull, 0x31680a88f8953031ull, 0xabcc77118461cefcull, 0xfdc20d2b36ba7c3eull,
+			0xd6bf94d5e57a42bcull, 0x3d32907604691b4dull, 0x8637bd05af6c69b5ull, 0xa63f9a49c2c1b110ull,
+			0xa7c5ac471b478423ull, 0x0fcf80dc33721d54ull, 0xd1b71758e219652bull, 0xd3c36113404ea4a9ull,
+			0x83126e978d4fdf3bull, 0x645a1cac083126eaull, 0xa3d70a3d70a3d70aull, 0x3d70a3d70a3d70a4ull,
+			0xccccccccccccccccull, 0xcccccccccccccccdull, 0x8000000000000000ull, 0x0000000000000000ull,
+			0xa000000000000000ull, 0x0000000000000000ull, 0xc800000000000000ull, 0x0000000000000000ull,
+			0xfa00000000000000ull, 0x0000000000000000ull, 0x9c40000000000000ull, 0x0000000000000000ull,
+			0xc350000000000000ull, 0x0000000000000000ull, 0xf424000000000000ull, 0x0000000000000000ull,
+			0x9896800000000000ull, 0x0000000000000000ull, 0xbebc200000000000ull, 0x0000000000000000ull,
+			0xee6b280000000000ull, 0x0000000000000000ull, 0x9502f90000000000ull, 0x0000000000000000ull,
+			0xba43b74000000000ull, 0x0000000000000000ull, 0xe8d4a51000000000ull, 0x0000000000000000ull,
+			0x9184e72a00000000ull, 0x0000000000000000ull, 0xb5e620f480000000ull, 0x0000000000000000ull,
+			0xe35fa931a0000000ull, 0x0000000000000000ull, 0x8e1bc9bf04000000ull, 0x0000000000000000ull,
+			0xb1a2bc2ec5000000ull, 0x0000000000000000ull, 0xde0b6b3a76400000ull, 0x0000000000000000ull,
+			0x8ac7230489e80000ull, 0x0000000000000000ull, 0xad78ebc5ac620000ull, 0x0000000000000000ull,
+			0xd8d726b7177a8000ull, 0x0000000000000000ull, 0x878678326eac9000ull, 0x0000000000000000ull,
+			0xa968163f0a57b400ull, 0x0000000000000000ull, 0xd3c21bcecceda100ull, 0x0000000000000000ull,
+			0x84595161401484a0ull, 0x0000000000000000ull, 0xa56fa5b99019a5c8ull, 0x0000000000000000ull,
+			0xcecb8f27f4200f3aull, 0x0000000000000000ull, 0x813f3978f8940984ull, 0x4000000000000000ull,
+			0xa18f07d736b90be5ull, 0x5000000000000000ull, 0xc9f2c9cd04674edeull, 0xa400000000000000ull,
+			0xfc6f7c4045812296ull, 0x4d00000000000000ull, 0x9dc5ada82b70b59dull, 0xf020000000000000ull,
+			0xc5371912364ce305ull, 0x6c28000000000000ull, 0xf684df56c3e01bc6ull, 0xc732000000000000ull,
+			0x9a130b963a6c115cull, 0x3c7f400000000000ull, 0xc097ce7bc90715b3ull, 0x4b9f100000000000ull,
+			0xf0bdc21abb48db20ull, 0x1e86d40000000000ull, 0x96769950b50d88f4ull, 0x1314448000000000ull
+		};
+		return Table + 2 * (q - chars_min_pow5);
+	}
+
+	// Exact powers of ten of the fast path
+	GLM_FUNC_QUALIFIER double chars_pow10(int e)
+	{
+		static double const Table[23] =
+		{
+			1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+			1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+		};
+		return Table[e];
+	}
+
+	GLM_FUNC_QUALIFIER int chars_leading_zeros(uint64 x)
+	{
+		int Count = 0;
+		for(int Shift = 32; Shift > 0; Shift >>= 1)
+		{
+			if((x >> (64 - Shift)) == 0)
+			{
+				x <<= Shift;
+				Count += Shift;
+			}
+		}
+		return Count;
+	}
+
+	GLM_FUNC_QUALIFIER int chars_trailing_zeros(uint32 x)
+	{
+		int Count = 0;
+		for(int Shift = 16; Shift > 0; Shift >>= 1)
+		{
+			if((x & ((1u << Shift) - 1u)) == 0)
+			{
+				x >>= Shift;
+				Count += Shift;
+			}
+		}
+		return Count;
+	}
+
+	// Full product of two 64 bit integers
+	GLM_FUNC_QUALIFIER void chars_mul128(uint64 a, uint64 b, uint64 & High, uint64 & Low)
+	{
+		uint64 const LowLow = (a & 0xFFFFFFFFull) * (b & 0xFFFFFFFFull);
+		uint64 const LowHigh = (a & 0xFFFFFFFFull) * (b >> 32);
+		uint64 const HighLow = (a >> 32) * (b & 0xFFFFFFFFull);
+		uint64 const HighHigh = (a >> 32) * (b >> 32);
+		uint64 const Cross = (LowLow >> 32) + (LowHigh & 0xFFFFFFFFull) + HighLow;
+		High = HighHigh + (LowHigh >> 32) + (Cross >> 32);
+		Low = (Cross << 32) | (LowLow & 0xFFFFFFFFull);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER T chars_make_float(uint64 Mantissa, int Power2, bool Negative)
+	{
+		typedef typename chars_binary<T>::bits bits;
+		int const SignShift = static_cast<int>(sizeof(T)) * 8 - 1;
+		bits const Bits = static_cast<bits>(Mantissa | (static_cast<uint64>(Power2) << chars_binary<T>::MantissaBits) | (static_cast<uint64>(Negative ? 1 : 0) << SignShift));
+		T Result;
+		std::memcpy(&Result, &Bits, sizeof(Result));
+		return Result;
+	}
+
+	// Correctly rounded w * 10^q for w of at most 19 digits and q in the table, with the algorithm of Michael Eisel and Daniel Lemire
+	template <typename T>
+	GLM_FUNC_QUALIFIER T chars_eisel_lemire(uint64 w, int q, bool Negative)
+	{
+		typedef chars_binary<T> binary;
+
+		int const LeadingZeros = chars_leading_zeros(w);
+		w <<= LeadingZeros;
+
+		uint64 const * Power = chars_pow5_128(q);
+		uint64 High = 0;
+		uint64 Low = 0;
+		chars_mul128(w, Power[0], High, Low);
+
+		// The low word of the power only matters when the bits below the rounded mantissa are all ones
+		uint64 const PrecisionMask = 0xFFFFFFFFFFFFFFFFull >> (binary::MantissaBits + 3);
+		if((High & PrecisionMask) == PrecisionMask)
+		{
+			uint64 SecondHigh = 0;
+			uint64 SecondLow = 0;
+			chars_mul128(w, Power[1], SecondHigh, SecondLow);
+			Low += SecondHigh;
+			if(SecondHigh > Low)
+				++High;
+		}
+
+		int const UpperBit = static_cast<int>(High >> 63);
+		int const Shift = UpperBit + 64 - binary::MantissaBits - 3;
+		uint64 Mantissa = High >> Shift;
+		int Power2 = (((152170 + 65536) * q) >> 16) + 63 + UpperBit - LeadingZeros - binary::MinExponent;
+
+		// Denormals and zero
+		if(Power2 <= 0)
+		{
+			if(-Power2 + 1 >= 64)
+				return chars_make_float<T>(0, 0, Negative);
+			Mantissa >>= -Power2 + 1;
+			Mantissa += Mantissa & 1;
+			Mantissa >>= 1;
+			return chars_make_float<T>(Mantissa, Mantissa < (static_cast<uint64>(1) << binary::MantissaBits) ? 0 : 1, Negative);
+		}
+
+		// Exact halfway cases round to even, they only happen for small powers of ten
+		if(Low <= 1 && q >= binary::MinRoundToEven && q <= binary::MaxRoundToEven && (Mantissa & 3) == 1 && (Mantissa << Shift) == High)
+			Mantissa &= ~static_cast<uint64>(1);
+
+		Mantissa += Mantissa & 1;
+		Mantissa >>= 1;
+		if(Mantissa >= (static_cast<uint64>(2) << binary::MantissaBits))
+		{
+			Mantissa = static_cast<uint64>(1) << binary::MantissaBits;
+			++Power2;
+		}
+		Mantissa &= ~(static_cast<uint64>(1) << binary::MantissaBits);
+
+		if(Power2 >= binary::InfinitePower)
+			return chars_make_float<T>(0, binary::InfinitePower, Negative);
+		return chars_make_float<T>(Mantissa, Power2, Negative);
+	}
+
+	GLM_FUNC_QUALIFIER bool chars_is_digit(char c)
+	{
+		return static_cast<unsigned>(c - '0') < 10u;
+	}
+
+	GLM_FUNC_QUALIFIER bool chars_is_letter(char c)
+	{
+		return static_cast<unsigned>((c | 0x20) - 'a') < 26u;
+	}
+
+	// White spaces and commas
+	GLM_FUNC_QUALIFIER bool chars_is_separator(char c)
+	{
+		return c == ' ' || c == ',' || (c >= '\t' && c <= '\r');
+	}
+
+	GLM_FUNC_QUALIFIER char const * chars_skip_spaces(char const * First, char const * Last)
+	{
+		for(; First != Last && *First != ',' && chars_is_separator(*First); ++First){}
+		return First;
+	}
+
+	// Skips white spaces and commas, sixteen characters at a time with SSE2
+	GLM_FUNC_QUALIFIER char const * chars_skip_separators(char const * First, char const * Last)
+	{
+		if(First != Last && !chars_is_separator(*First))
+			return First;
+
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; Last - First >= 16; First += 16)
+			{
+				__m128i const Text = _mm_loadu_si128(reinterpret_cast<__m128i const *>(First));
+				__m128i const Space = _mm_or_si128(_mm_cmpeq_epi8(Text, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(Text, _mm_set1_epi8(',')));
+				__m128i const Control = _mm_and_si128(_mm_cmpgt_epi8(Text, _mm_set1_epi8('\t' - 1)), _mm_cmplt_epi8(Text, _mm_set1_epi8('\r' + 1)));
+				int const Others = _mm_movemask_epi8(_mm_or_si128(Space, Control)) ^ 0xFFFF;
+				if(Others != 0)
+					return First + chars_trailing_zeros(static_cast<uint32>(Others));
+			}
+#		endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+		for(; First != Last && chars_is_separator(*First); ++First){}
+		return First;
+	}
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		// Eight digits of a little endian text at once, SIMD within a register
+		GLM_FUNC_QUALIFIER bool chars_is_eight_digits(uint64 Text)
+		{
+			return ((Text & 0xF0F0F0F0F0F0F0F0ull) | (((Text + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) == 0x3333333333333333ull;
+		}
+
+		GLM_FUNC_QUALIFIER uint64 chars_read_eight_digits(uint64 Text)
+		{
+			Text -= 0x3030303030303030ull;
+			Text = Text * 10 + (Text >> 8);
+			return (((Text & 0x000000FF000000FFull) * 0x000F424000000064ull) + (((Text >> 16) & 0x000000FF000000FFull) * 0x0000271000000001ull)) >> 32;
+		}
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+	// Accumulates the digits of [First, Last) in Value, wrapping around past 19 digits
+	GLM_FUNC_QUALIFIER char const * chars_read_digits(char const * First, char const * Last, uint64 & Value)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(uint64 Text = 0; Last - First >= 8; First += 8)
+			{
+				std::memcpy(&Text, First, sizeof(Text));
+				if(!chars_is_eight_digits(Text))
+					break;
+				Value = Value * 100000000 + chars_read_eight_digits(Text);
+			}
+#		endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+		for(; First != Last && chars_is_digit(*First); ++First)
+			Value = Value * 10 + static_cast<uint64>(*First - '0');
+		return First;
+	}
+
+	// Reads [+-]digits[.digits][(e|E)[+-]digits], at least one digit before the exponent, returns a null pointer otherwise
+	GLM_FUNC_QUALIFIER char const * chars_read_number(char const * First, char const * Last, chars_number & Number)
+	{
+		Number.Negative = First != Last && *First == '-';
+		if(First != Last && (*First == '-' || *First == '+'))
+			++First;
+
+		Number.Digits = First;
+		uint64 Mantissa = 0;
+		First = chars_read_digits(First, Last, Mantissa);
+		std::ptrdiff_t DigitCount = First - Number.Digits;
+		std::ptrdiff_t Exponent = 0;
+		if(First != Last && *First == '.')
+		{
+			char const * Fraction = First + 1;
+			First = chars_read_digits(Fraction, Last, Mantissa);
+			Exponent = -(First - Fraction);
+			DigitCount += First - Fraction;
+		}
+		if(DigitCount == 0)
+			return 0;
+		Number.DigitsLast = First;
+
+		// The exponent is a part of the number only if it has digits
+		if(First != Last && (*First == 'e' || *First == 'E'))
+		{
+			char const * Text = First + 1;
+			bool const NegativeExponent = Text != Last && *Text == '-';
+			if(Text != Last && (*Text == '-' || *Text == '+'))
+				++Text;
+			if(Text != Last && chars_is_digit(*Text))
+			{
+				std::ptrdiff_t Explicit = 0;
+				for(; Text != Last && chars_is_digit(*Text); ++Text)
+				{
+					if(Explicit < 100000)
+						Explicit = Explicit * 10 + (*Text - '0');
+				}
+				Exponent += NegativeExponent ? -Explicit : Explicit;
+				First = Text;
+			}
+		}
+
+		// Leading zeros are not significant
+		if(DigitCount > 19)
+		{
+			for(char const * Digit = Number.Digits; Digit != Number.DigitsLast && (*Digit == '0' || *Digit == '.'); ++Digit)
+				DigitCount -= *Digit == '0' ? 1 : 0;
+		}
+
+		Number.Mantissa = Mantissa;
+		Number.Exponent = static_cast<int>(Exponent < -1000000 ? -1000000 : (Exponent > 1000000 ? 1000000 : Exponent));
+		Number.Truncated = DigitCount > 19;
+		return First;
+	}
+
+	// Without strtof, the rare floats of more than 19 significant digits within half a double ULP of a halfway case may round twice
+	GLM_FUNC_QUALIFIER float chars_strtod(char const * Text, float)
+	{
+#		if GLM_HAS_CXX11_STL
+			return std::strtof(Text, 0);
+#		else
+			return static_cast<float>(std::strtod(Text, 0));
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER double chars_strtod(char const * Text, double)
+	{
+		return std::strtod(Text, 0);
+	}
+
+	// Reads Number with the C library, from its digits and exponent without decimal separator to be independent of the locale.
+	// Digits after the first 100 significant ones are replaced by a nonzero digit when one of them is not zero.
+	template <typename T>
+	GLM_FUNC_QUALIFIER T chars_read_strtod(chars_number const & Number)
+	{
+		char Text[128];
+		std::size_t Length = 0;
+		int Exponent = Number.Exponent;
+		bool Sticky = false;
+		for(char const * Digit = Number.Digits; Digit != Number.DigitsLast; ++Digit)
+		{
+			if(*Digit == '.' || (*Digit == '0' && Length == 0))
+				continue;
+			if(Length < 100)
+				Text[Length++] = *Digit;
+			else
+			{
+				++Exponent;
+				Sticky = Sticky || *Digit != '0';
+			}
+		}
+		if(Sticky)
+		{
+			Text[Length++] = '1';
+			--Exponent;
+		}
+		if(Length == 0)
+			Text[Length++] = '0';
+
+		char * End = chars_write_text(Text + Length, Text + sizeof(Text), "e");
+		End = chars_write_integer(End, Text + sizeof(Text) - 1, Exponent < 0, static_cast<uint64>(Exponent < 0 ? -Exponent : Exponent));
+		*End = 0;
+
+		T const Magnitude = chars_strtod(Text, T());
+		return Number.Negative ? -Magnitude : Magnitude;
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER T chars_to_float(chars_number const & Number)
+	{
+		typedef chars_binary<T> binary;
+
+		if(Number.Truncated)
+			return chars_read_strtod<T>(Number);
+		if(Number.Mantissa == 0)
+			return Number.Negative ? -static_cast<T>(0) : static_cast<T>(0);
+
+		// Both operands are exact, the operation rounds once
+		if(Number.Mantissa <= binary::MaxFastMantissa && Number.Exponent >= -binary::MaxFastExponent && Number.Exponent <= binary::MaxFastExponent)
+		{
+			T const Mantissa = static_cast<T>(Number.Mantissa);
+			T const Magnitude = Number.Exponent < 0 ? Mantissa / static_cast<T>(chars_pow10(-Number.Exponent)) : Mantissa * static_cast<T>(chars_pow10(Number.Exponent));
+			return Number.Negative ? -Magnitude : Magnitude;
+		}
+
+		if(Number.Exponent >= chars_min_pow5 && Number.Exponent <= chars_max_pow5)
+			return chars_eisel_lemire<T>(Number.Mantissa, Number.Exponent, Number.Negative);
+		if(binary::Complete)
+			return chars_make_float<T>(0, Number.Exponent < 0 ? 0 : binary::InfinitePower, Number.Negative);
+		return chars_read_strtod<T>(Number);
+	}
+
+	// Matches Text ignoring the case of [First, Last)
+	GLM_FUNC_QUALIFIER char const * chars_match(char const * First, char const * Last, char const * Text)
+	{
+		for(; *Text; ++First, ++Text)
+		{
+			if(First == Last || (*First | 0x20) != *Text)
+				return 0;
+		}
+		return First;
+	}
+
+	// Reads inf, infinity and nan with an optional sign
+	template <typename T>
+	GLM_FUNC_QUALIFIER char const * chars_read_special(char const * First, char const * Last, T & Value)
+	{
+		bool const Negative = First != Last && *First == '-';
+		if(First != Last && (*First == '-' || *First == '+'))
+			++First;
+
+		if(char const * End = chars_match(First, Last, "inf"))
+		{
+			char const * Infinity = chars_match(End, Last, "inity");
+			Value = Negative ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+			return Infinity ? Infinity : End;
+		}
+		if(char const * End = chars_match(First, Last, "nan"))
+		{
+			Value = Negative ? -std::numeric_limits<T>::quiet_NaN() : std::numeric_limits<T>::quiet_NaN();
+			return End;
+		}
+		return 0;
+	}
+
+	template <typename T, bool isFloat = std::numeric_limits<T>::is_iec559, bool isSigned = std::numeric_limits<T>::is_signed>
+	struct compute_from_chars_scalar
+	{
+		GLM_FUNC_QUALIFIER static char const * call(char const * First, char const * Last, T & Value)
+		{
+			uint64 const Max = static_cast<uint64>(std::numeric_limits<T>::max());
+			uint64 Magnitude = 0;
+			char const * const Digits = First;
+			for(; First != Last && chars_is_digit(*First); ++First)
+			{
+				uint64 const Digit = static_cast<uint64>(*First - '0');
+				if(Magnitude > (Max - Digit) / 10)
+					return 0;
+				Magnitude = Magnitude * 10 + Digit;
+			}
+			if(First == Digits)
+				return 0;
+			Value = static_cast<T>(Magnitude);
+			return First;
+		}
+	};
+
+	template <typename T>
+	struct compute_from_chars_scalar<T, false, true>
+	{
+		GLM_FUNC_QUALIFIER static char const * call(char const * First, char const * Last, T & Value)
+		{
+			bool const Negative = First != Last && *First == '-';
+			uint64 const Max = static_cast<uint64>(std::numeric_limits<T>::max()) + (Negative ? 1 : 0);
+			uint64 Magnitude = 0;
+			char const * const Digits = Negative ? ++First : First;
+			for(; First != Last && chars_is_digit(*First); ++First)
+			{
+				uint64 const Digit = static_cast<uint64>(*First - '0');
+				if(Magnitude > (Max - Digit) / 10)
+					return 0;
+				Magnitude = Magnitude * 10 + Digit;
+			}
+			if(First == Digits)
+				return 0;
+
+			// Negated in unsigned arithmetic to support the smallest value
+			Value = static_cast<T>(Negative ? static_cast<uint64>(0) - Magnitude : Magnitude);
+			return First;
+		}
+	};
+
+	template <typename T, bool isSigned>
+	struct compute_from_chars_scalar<T, true, isSigned>
+	{
+		GLM_FUNC_QUALIFIER static char const * call(char const * First, char const * Last, T & Value)
+		{
+			chars_number Number;
+			char const * const End = chars_read_number(First, Last, Number);
+			if(!End)
+				return chars_read_special(First, Last, Value);
+			Value = chars_to_float<T>(Number);
+			return End;
+		}
+	};
+
+	template <>
+	struct compute_from_chars_scalar<bool, false, false>
+	{
+		GLM_FUNC_QUALIFIER static char const * call(char const * First, char const * Last, bool & Value)
+		{
+			if(char const * End = chars_match(First, Last, "true"))
+			{
+				Value = true;
+				return End;
+			}
+			if(char const * End = chars_match(First, Last, "false"))
+			{
+				Value = false;
+				return End;
+			}
+			if(First != Last && (*First == '0' || *First == '1'))
+			{
+				Value = *First == '1';
+				return First + 1;
+			}
+			return 0;
+		}
+	};
+}//namespace detail
+}//namespace glm
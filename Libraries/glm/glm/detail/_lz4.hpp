@@ -0,0 +1,156 @@
+/// @ref core
+/// @file glm/detail/_lz4.hpp
+
+#pragma once
+
+#include "setup.hpp"
+#include "type_int.hpp"
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+namespace glm{
+namespace detail
+{
+	// LZ4 block format: sequences of a token, literals and a match of at least 4 bytes 1 to 65535 bytes back.
+	// The last 5 bytes are literals and the last match starts at least 12 bytes before the end.
+	static std::size_t const lz4_min_match = 4;
+	static std::size_t const lz4_last_literals = 5;
+	static std::size_t const lz4_match_limit = 12;
+	static std::size_t const lz4_max_offset = 65535;
+	static int const lz4_hash_log = 14;
+
+	GLM_FUNC_QUALIFIER uint32 lz4_read32(unsigned char const * Data)
+	{
+		uint32 Value = 0;
+		std::memcpy(&Value, Data, sizeof(Value));
+		return Value;
+	}
+
+	GLM_FUNC_QUALIFIER void lz4_write_length(std::vector<unsigned char> & Output, std::size_t Length)
+	{
+		for(; Length >= 255; Length -= 255)
+			Output.push_back(255);
+		Output.push_back(static_cast<unsigned char>(Length));
+	}
+
+	GLM_FUNC_QUALIFIER void lz4_write_sequence(std::vector<unsigned char> & Output, unsigned char const * Literals, std::size_t LiteralCount, std::size_t Offset, std::size_t MatchLength)
+	{
+		std::size_t const MatchCode = MatchLength > 0 ? MatchLength - lz4_min_match : 0;
+		Output.push_back(static_cast<unsigned char>((LiteralCount < 15 ? LiteralCount : 15) << 4 | (MatchCode < 15 ? MatchCode : 15)));
+		if(LiteralCount >= 15)
+			lz4_write_length(Output, LiteralCount - 15);
+		Output.insert(Output.end(), Literals, Literals + LiteralCount);
+		if(MatchLength == 0)
+			return;
+		Output.push_back(static_cast<unsigned char>(Offset & 0xFF));
+		Output.push_back(static_cast<unsigned char>(Offset >> 8));
+		if(MatchCode >= 15)
+			lz4_write_length(Output, MatchCode - 15);
+	}
+
+	// Appends the LZ4 block of [Input, Input + Size) to Output, with a greedy search of the last position of each 4 byte hash
+	GLM_FUNC_QUALIFIER void lz4_compress(unsigned char const * Input, std::size_t Size, std::vector<unsigned char> & Output)
+	{
+		std::size_t Anchor = 0;
+		if(Size > lz4_match_limit)
+		{
+			std::vector<uint32> Table(static_cast<std::size_t>(1) << lz4_hash_log, 0);
+			std::size_t const Limit = Size - lz4_match_limit;
+			std::size_t const End = Size - lz4_last_literals;
+
+			// Positions without a match are skipped faster and faster
+			std::size_t Step = 1 << 6;
+			for(std::size_t Position = 0; Position < Limit;)
+			{
+				uint32 const Sequence = lz4_read32(Input + Position);
+				uint32 const Hash = (Sequence * 2654435761u) >> (32 - lz4_hash_log);
+				std::size_t const Candidate = Table[Hash];
+				Table[Hash] = static_cast<uint32>(Position);
+
+				if(Candidate >= Position || Position - Candidate > lz4_max_offset || lz4_read32(Input + Candidate) != Sequence)
+				{
+					Position += Step++ >> 6;
+					continue;
+				}
+
+				std::size_t Match = Position;
+				std::size_t Source = Candidate;
+				for(; Match > Anchor && Source > 0 && Input[Match - 1] == Input[Source - 1]; --Match, --Source){}
+
+				std::size_t Length = Position + lz4_min_match - Match;
+				for(; Match + Length < End && Input[Match + Length] == Input[Source + Length]; ++Length){}
+
+				lz4_write_sequence(Output, Input + Anchor, Match - Anchor, Match - Source, Length);
+				Anchor = Position = Match + Length;
+				Step = 1 << 6;
+			}
+		}
+		lz4_write_sequence(Output, Input + Anchor, Size - Anchor, 0, 0);
+	}
+
+	GLM_FUNC_QUALIFIER bool lz4_read_length(unsigned char const * & First, unsigned char const * Last, std::size_t & Length)
+	{
+		for(unsigned char Byte = 255; Byte == 255; Length += Byte)
+		{
+			if(First == Last)
+				return false;
+			Byte = *First++;
+		}
+		return true;
+	}
+
+	// Decompresses the LZ4 block [First, Last) to exactly Size bytes of Output, return false if the block is invalid
+	GLM_FUNC_QUALIFIER bool lz4_decompress(unsigned char const * First, unsigned char const * Last, unsigned char * Output, std::size_t Size)
+	{
+		std::size_t Position = 0;
+		while(First != Last)
+		{
+			unsigned char const Token = *First++;
+			std::size_t LiteralCount = Token >> 4;
+			if(LiteralCount == 15 && !lz4_read_length(First, Last, LiteralCount))
+				return false;
+			if(LiteralCount > static_cast<std::size_t>(Last - First) || LiteralCount > Size - Position)
+				return false;
+
+			// Short copies are done 16 bytes at once when both buffers have room for them
+			if(LiteralCount <= 16 && Last - First >= 16 && Size - Position >= 16)
+				std::memcpy(Output + Position, First, 16);
+			else
+				std::memcpy(Output + Position, First, LiteralCount);
+			First += LiteralCount;
+			Position += LiteralCount;
+			if(First == Last)
+				break;
+
+			if(Last - First < 2)
+				return false;
+			std::size_t const Offset = static_cast<std::size_t>(First[0]) | static_cast<std::size_t>(First[1]) << 8;
+			First += 2;
+			std::size_t Length = Token & 15;
+			if(Length == 15 && !lz4_read_length(First, Last, Length))
+				return false;
+			Length += lz4_min_match;
+			if(Offset == 0 || Offset > Position || Length > Size - Position)
+				return false;
+
+			// Matches overlapping their output repeat their first Offset bytes, copied in doubling blocks
+			unsigned char * const Destination = Output + Position;
+			if(Offset >= 8 && Size - Position >= Length + 8)
+			{
+				// Blocks of 8 bytes don't overlap their source, the last one may write past the match
+				for(std::size_t i = 0; i < Length; i += 8)
+					std::memcpy(Destination + i, Destination + i - Offset, 8);
+				Position += Length;
+				continue;
+			}
+			std::size_t Copied = Offset < Length ? Offset : Length;
+			std::memcpy(Destination, Destination - Offset, Copied);
+			for(; Copied < Length; Copied += Copied)
+				std::memcpy(Destination + Copied, Destination, Copied < Length - Copied ? Copied : Length - Copied);
+			Position += Length;
+		}
+		return Position == Size;
+	}
+}//namespace detail
+}//namespace glm
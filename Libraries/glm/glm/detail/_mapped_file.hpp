@@ -0,0 +1,138 @@
+/// @ref core
+/// @file glm/detail/_mapped_file.hpp
+
+#pragma once
+
+#include "setup.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+
+#if GLM_PLATFORM & GLM_PLATFORM_WINDOWS
+#	ifndef NOMINMAX
+#		define GLM_MAPPED_FILE_NOMINMAX
+#		define NOMINMAX
+#	endif
+#	ifndef WIN32_LEAN_AND_MEAN
+#		define GLM_MAPPED_FILE_LEAN_AND_MEAN
+#		define WIN32_LEAN_AND_MEAN
+#	endif
+#	include <windows.h>
+#	ifdef GLM_MAPPED_FILE_NOMINMAX
+#		undef NOMINMAX
+#		undef GLM_MAPPED_FILE_NOMINMAX
+#	endif
+#	ifdef GLM_MAPPED_FILE_LEAN_AND_MEAN
+#		undef WIN32_LEAN_AND_MEAN
+#		undef GLM_MAPPED_FILE_LEAN_AND_MEAN
+#	endif
+#elif GLM_PLATFORM & (GLM_PLATFORM_LINUX | GLM_PLATFORM_APPLE | GLM_PLATFORM_UNIX | GLM_PLATFORM_ANDROID | GLM_PLATFORM_CYGWIN | GLM_PLATFORM_QNXNTO)
+#	define GLM_MAPPED_FILE_POSIX
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+namespace glm{
+namespace detail
+{
+	// Read only view of a whole file, memory mapped when the platform supports it, read in memory otherwise
+	class mapped_file
+	{
+	public:
+		GLM_FUNC_QUALIFIER explicit mapped_file(char const * Path) :
+			Data(0),
+			Size(0),
+			Mapped(false)
+		{
+#			if GLM_PLATFORM & GLM_PLATFORM_WINDOWS
+				File = CreateFileA(Path, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, 0);
+				Mapping = 0;
+				LARGE_INTEGER FileSize;
+				if(File != INVALID_HANDLE_VALUE && GetFileSizeEx(File, &FileSize) && FileSize.QuadPart > 0)
+				{
+					Mapping = CreateFileMappingA(File, 0, PAGE_READONLY, 0, 0, 0);
+					void const * View = Mapping ? MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0) : 0;
+					if(View)
+					{
+						Data = static_cast<char const *>(View);
+						Size = static_cast<std::size_t>(FileSize.QuadPart);
+						Mapped = true;
+						return;
+					}
+				}
+#			elif defined(GLM_MAPPED_FILE_POSIX)
+				int const File = open(Path, O_RDONLY);
+				struct stat Status;
+				if(File >= 0 && fstat(File, &Status) == 0 && Status.st_size > 0)
+				{
+					void * const View = mmap(0, static_cast<std::size_t>(Status.st_size), PROT_READ, MAP_PRIVATE, File, 0);
+					if(View != MAP_FAILED)
+					{
+						madvise(View, static_cast<std::size_t>(Status.st_size), MADV_SEQUENTIAL);
+						Data = static_cast<char const *>(View);
+						Size = static_cast<std::size_t>(Status.st_size);
+						Mapped = true;
+						close(File);
+						return;
+					}
+				}
+				if(File >= 0)
+					close(File);
+#			endif
+
+			// Empty files, or files that can't be mapped, are read in memory
+			std::FILE * const Stream = std::fopen(Path, "rb");
+			if(!Stream)
+				return;
+			char Block[65536];
+			for(std::size_t Read = 0; (Read = std::fread(Block, 1, sizeof(Block), Stream)) > 0;)
+				Buffer.insert(Buffer.end(), Block, Block + Read);
+			std::fclose(Stream);
+			Buffer.push_back(0);
+			Data = &Buffer[0];
+			Size = Buffer.size() - 1;
+		}
+
+		GLM_FUNC_QUALIFIER ~mapped_file()
+		{
+#			if GLM_PLATFORM & GLM_PLATFORM_WINDOWS
+				if(Mapped)
+					UnmapViewOfFile(Data);
+				if(Mapping)
+					CloseHandle(Mapping);
+				if(File != INVALID_HANDLE_VALUE)
+					CloseHandle(File);
+#			elif defined(GLM_MAPPED_FILE_POSIX)
+				if(Mapped)
+					munmap(const_cast<char *>(Data), Size);
+#			endif
+		}
+
+		// Null if the file can't be read
+		GLM_FUNC_QUALIFIER char const * data() const
+		{
+			return Data;
+		}
+
+		GLM_FUNC_QUALIFIER std::size_t size() const
+		{
+			return Size;
+		}
+
+	private:
+		mapped_file(mapped_file const &);
+		mapped_file & operator=(mapped_file const &);
+
+		char const * Data;
+		std::size_t Size;
+		bool Mapped;
+		std::vector<char> Buffer;
+#		if GLM_PLATFORM & GLM_PLATFORM_WINDOWS
+			HANDLE File;
+			HANDLE Mapping;
+#		endif
+	};
+}//namespace detail
+}//namespace glm
@@ -0,0 +1,97 @@
+/// @ref core
+/// @file glm/detail/_parallel.hpp
+
+#pragma once
+
+#include "setup.hpp"
+#include <cstddef>
+#if GLM_HAS_CXX11_STL
+#	include <atomic>
+#	include <thread>
+#	include <vector>
+#endif
+
+namespace glm{
+namespace detail
+{
+	// Number of worker threads used by the batch functions of the extensions.
+	// Defining GLM_FORCE_SINGLE_THREAD, or building without the C++11 STL, runs every job on the calling thread.
+	GLM_FUNC_QUALIFIER std::size_t parallel_concurrency()
+	{
+#		if GLM_HAS_CXX11_STL && !defined(GLM_FORCE_SINGLE_THREAD)
+			unsigned int const Concurrency = std::thread::hardware_concurrency();
+			return Concurrency > 0 ? static_cast<std::size_t>(Concurrency) : 1;
+#		else
+			return 1;
+#		endif
+	}
+
+	// Splits [0, Count) into at most parallel_concurrency() contiguous ranges of at least Grain elements
+	// and calls Func(Begin, End, Job) for each of them. Job indexes are dense, starting at 0, so that
+	// callers can keep per job state in an array of parallel_jobs(Count, Grain) elements.
+	GLM_FUNC_QUALIFIER std::size_t parallel_jobs(std::size_t Count, std::size_t Grain)
+	{
+		std::size_t const Concurrency = parallel_concurrency();
+		std::size_t const MaxJobs = Grain > 0 ? (Count + Grain - 1) / Grain : Count;
+		std::size_t const Jobs = MaxJobs < Concurrency ? MaxJobs : Concurrency;
+		return Jobs > 0 ? Jobs : 1;
+	}
+
+	template <typename functor>
+	GLM_FUNC_QUALIFIER void parallel_for(std::size_t Count, std::size_t Grain, functor & Func)
+	{
+#		if GLM_HAS_CXX11_STL && !defined(GLM_FORCE_SINGLE_THREAD)
+			std::size_t const Jobs = parallel_jobs(Count, Grain);
+			if(Jobs > 1)
+			{
+				std::vector<std::thread> Threads;
+				Threads.reserve(Jobs - 1);
+				for(std::size_t Job = 1; Job < Jobs; ++Job)
+				{
+					std::size_t const Begin = Count * Job / Jobs;
+					std::size_t const End = Count * (Job + 1) / Jobs;
+					Threads.push_back(std::thread([&Func, Begin, End, Job](){ Func(Begin, End, Job); }));
+				}
+				Func(0, Count / Jobs, 0);
+				for(std::size_t i = 0; i < Threads.size(); ++i)
+					Threads[i].join();
+				return;
+			}
+#		else
+			static_cast<void>(Grain);
+#		endif
+
+		Func(0, Count, 0);
+	}
+
+	// Calls Func(Index, Job) for each Index of [0, Count), each job taking the next index as soon as it is done
+	// with the previous one, to balance items of uneven cost between threads.
+	template <typename functor>
+	GLM_FUNC_QUALIFIER void parallel_dynamic(std::size_t Count, functor & Func)
+	{
+#		if GLM_HAS_CXX11_STL && !defined(GLM_FORCE_SINGLE_THREAD)
+			std::size_t const Jobs = parallel_jobs(Count, 1);
+			if(Jobs > 1)
+			{
+				std::atomic<std::size_t> Next(0);
+				std::vector<std::thread> Threads;
+				Threads.reserve(Jobs - 1);
+				for(std::size_t Job = 1; Job < Jobs; ++Job)
+					Threads.push_back(std::thread([&Func, &Next, Count, Job]()
+					{
+						for(std::size_t Index = Next++; Index < Count; Index = Next++)
+							Func(Index, Job);
+					}));
+				for(std::size_t Index = Next++; Index < Count; Index = Next++)
+					Func(Index, 0);
+				for(std::size_t i = 0; i < Threads.size(); ++i)
+					Threads[i].join();
+				return;
+			}
+#		endif
+
+		for(std::size_t Index = 0; Index < Count; ++Index)
+			Func(Index, 0);
+	}
+}//namespace detail
+}//namespace glm
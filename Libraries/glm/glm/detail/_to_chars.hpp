@@ -0,0 +1,456 @@
+/// @ref core
+/// @file glm/detail/_to_chars.hpp
+
+#pragma once
+
+#include "setup.hpp"
+#include "type_int.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	// Decimal value Mantissa * 10^Exponent
+	struct chars_decimal
+	{
+		uint64 Mantissa;
+		int Exponent;
+	};
+
+	// Tables of the Ryu algorithm: 2^(pow5bits(i) - 1 + 59) / 5^i rounded up and 5^i / 2^(pow5bits(i) - 61) rounded down
+	GLM_FUNC_QUALIFIER uint64 chars_float_pow5_inv_split(int i)
+	{
+		static uint64 const Table[31] =
+		{
+			0x0800000000000001ull, 0x0666666666666667ull, 0x051eb851eb851eb9ull, 0x04189374bc6a7efaull,
+			0x068db8bac710cb2aull, 0x053e2d6238da3c22ull, 0x0431bde82d7b634eull, 0x06b5fca6af2bd216ull,
+			0x055e63b88c230e78ull, 0x044b82fa09b5a52dull, 0x06df37f675ef6eaeull, 0x057f5ff85e592558ull,
+			0x0465e6604b7a8447ull, 0x0709709a125da071ull, 0x05a126e1a84ae6c1ull, 0x0480ebe7b9d58567ull,
+			0x0734aca5f6226f0bull, 0x05c3bd5191b525a3ull, 0x049c97747490eae9ull, 0x0760f253edb4ab0eull,
+			0x05e72843249088d8ull, 0x04b8ed0283a6d3e0ull, 0x078e480405d7b966ull, 0x060b6cd004ac9452ull,
+			0x04d5f0a66a23a9dbull, 0x07bcb43d769f762bull, 0x063090312bb2c4efull, 0x04f3a68dbc8f03f3ull,
+			0x07ec3daf94180651ull, 0x065697bfa9acd1daull, 0x051212ffbaf0a7e2ull
+		};
+		return Table[i];
+	}
+
+	GLM_FUNC_QUALIFIER uint64 chars_float_pow5_split(int i)
+	{
+		static uint64 const Table[47] =
+		{
+			0x1000000000000000ull, 0x1400000000000000ull, 0x1900000000000000ull, 0x1f40000000000000ull,
+			0x1388000000000000ull, 0x186a000000000000ull, 0x1e84800000000000ull, 0x1312d00000000000ull,
+			0x17d7840000000000ull, 0x1dcd650000000000ull, 0x12a05f2000000000ull, 0x174876e800000000ull,
+			0x1d1a94a200000000ull, 0x12309ce540000000ull, 0x16bcc41e90000000ull, 0x1c6bf52634000000ull,
+			0x11c37937e0800000ull, 0x16345785d8a00000ull, 0x1bc16d674ec80000ull, 0x1158e460913d0000ull,
+			0x15af1d78b58c4000ull, 0x1b1ae4d6e2ef5000ull, 0x10f0cf064dd59200ull, 0x152d02c7e14af680ull,
+			0x1a784379d99db420ull, 0x108b2a2c28029094ull, 0x14adf4b7320334b9ull, 0x19d971e4fe8401e7ull,
+			0x1027e72f1f128130ull, 0x1431e0fae6d7217cull, 0x193e5939a08ce9dbull, 0x1f8def8808b02452ull,
+			0x13b8b5b5056e16b3ull, 0x18a6e32246c99c60ull, 0x1ed09bead87c0378ull, 0x13426172c74d822bull,
+			0x1812f9cf7920e2b6ull, 0x1e17b84357691b64ull, 0x12ced32a16a1b11eull, 0x178287f49c4a1d66ull,
+			0x1d6329f1c35ca4bfull, 0x125dfa371a19e6f7ull, 0x16f578c4e0a060b5ull, 0x1cb2d6f618c878e3ull,
+			0x11efc659cf7d4b8dull, 0x166bb7f0435c9e71ull, 0x1c06a5ec5433c60dull
+		};
+		return Table[i];
+	}
+
+	// Number of bits of 5^e, floor(log10(2^e)) and floor(log10(5^e))
+	GLM_FUNC_QUALIFIER int chars_pow5_bits(int e)
+	{
+		return static_cast<int>((static_cast<uint32>(e) * 1217359u) >> 19) + 1;
+	}
+
+	GLM_FUNC_QUALIFIER int chars_log10_pow2(int e)
+	{
+		return static_cast<int>((static_cast<uint32>(e) * 78913u) >> 18);
+	}
+
+	GLM_FUNC_QUALIFIER int chars_log10_pow5(int e)
+	{
+		return static_cast<int>((static_cast<uint32>(e) * 732923u) >> 20);
+	}
+
+	GLM_FUNC_QUALIFIER bool chars_multiple_of_pow5(uint32 Value, int p)
+	{
+		int Count = 0;
+		for(; Value % 5 == 0 && Value != 0; Value /= 5)
+			++Count;
+		return Count >= p;
+	}
+
+	GLM_FUNC_QUALIFIER uint32 chars_mul_shift(uint32 m, uint64 Factor, int Shift)
+	{
+		uint64 const Low = static_cast<uint64>(m) * (Factor & 0xFFFFFFFFull);
+		uint64 const High = static_cast<uint64>(m) * (Factor >> 32);
+		return static_cast<uint32>(((Low >> 32) + High) >> (Shift - 32));
+	}
+
+	// Shortest decimal that reads back as a finite float, the closest one if several have the same length, with the Ryu algorithm of Ulf Adams
+	GLM_FUNC_QUALIFIER chars_decimal chars_shortest(float Value)
+	{
+		uint32 Bits = 0;
+		std::memcpy(&Bits, &Value, sizeof(Bits));
+		uint32 const IeeeMantissa = Bits & 0x7FFFFFu;
+		int const IeeeExponent = static_cast<int>((Bits >> 23) & 0xFFu);
+
+		int e2 = 0;
+		uint32 m2 = 0;
+		if(IeeeExponent == 0)
+		{
+			e2 = 1 - 127 - 23 - 2;
+			m2 = IeeeMantissa;
+		}
+		else
+		{
+			e2 = IeeeExponent - 127 - 23 - 2;
+			m2 = (1u << 23) | IeeeMantissa;
+		}
+		bool const AcceptBounds = (m2 & 1u) == 0;
+
+		// Interval of the decimals rounding to the float, scaled by 4
+		uint32 const mv = 4 * m2;
+		uint32 const mp = 4 * m2 + 2;
+		uint32 const mmShift = IeeeMantissa != 0 || IeeeExponent <= 1 ? 1u : 0u;
+		uint32 const mm = 4 * m2 - 1 - mmShift;
+
+		uint32 vr = 0, vp = 0, vm = 0;
+		int e10 = 0;
+		bool vmIsTrailingZeros = false;
+		bool vrIsTrailingZeros = false;
+		uint32 LastRemovedDigit = 0;
+		if(e2 >= 0)
+		{
+			int const q = chars_log10_pow2(e2);
+			e10 = q;
+			int const k = 59 + chars_pow5_bits(q) - 1;
+			int const i = -e2 + q + k;
+			vr = chars_mul_shift(mv, chars_float_pow5_inv_split(q), i);
+			vp = chars_mul_shift(mp, chars_float_pow5_inv_split(q), i);
+			vm = chars_mul_shift(mm, chars_float_pow5_inv_split(q), i);
+			if(q != 0 && (vp - 1) / 10 <= vm / 10)
+			{
+				int const l = 59 + chars_pow5_bits(q - 1) - 1;
+				LastRemovedDigit = chars_mul_shift(mv, chars_float_pow5_inv_split(q - 1), -e2 + q - 1 + l) % 10;
+			}
+			if(q <= 9)
+			{
+				if(mv % 5 == 0)
+					vrIsTrailingZeros = chars_multiple_of_pow5(mv, q);
+				else if(AcceptBounds)
+					vmIsTrailingZeros = chars_multiple_of_pow5(mm, q);
+				else
+					vp -= chars_multiple_of_pow5(mp, q) ? 1 : 0;
+			}
+		}
+		else
+		{
+			int const q = chars_log10_pow5(-e2);
+			e10 = q + e2;
+			int const i = -e2 - q;
+			int const k = chars_pow5_bits(i) - 61;
+			int j = q - k;
+			vr = chars_mul_shift(mv, chars_float_pow5_split(i), j);
+			vp = chars_mul_shift(mp, chars_float_pow5_split(i), j);
+			vm = chars_mul_shift(mm, chars_float_pow5_split(i), j);
+			if(q != 0 && (vp - 1) / 10 <= vm / 10)
+			{
+				j = q - 1 - (chars_pow5_bits(i + 1) - 61);
+				LastRemovedDigit = chars_mul_shift(mv, chars_float_pow5_split(i + 1), j) % 10;
+			}
+			if(q <= 1)
+			{
+				vrIsTrailingZeros = true;
+				if(AcceptBounds)
+					vmIsTrailingZeros = mmShift == 1;
+				else
+					--vp;
+			}
+			else if(q < 31)
+				vrIsTrailingZeros = (mv & ((1u << (q - 1)) - 1)) == 0;
+		}
+
+		// Removes the digits shared by the bounds of the interval
+		int Removed = 0;
+		uint32 Output = 0;
+		if(vmIsTrailingZeros || vrIsTrailingZeros)
+		{
+			for(; vp / 10 > vm / 10; ++Removed)
+			{
+				vmIsTrailingZeros &= vm % 10 == 0;
+				vrIsTrailingZeros &= LastRemovedDigit == 0;
+				LastRemovedDigit = vr % 10;
+				vr /= 10;
+				vp /= 10;
+				vm /= 10;
+			}
+			if(vmIsTrailingZeros)
+			{
+				for(; vm % 10 == 0; ++Removed)
+				{
+					vrIsTrailingZeros &= LastRemovedDigit == 0;
+					LastRemovedDigit = vr % 10;
+					vr /= 10;
+					vp /= 10;
+					vm /= 10;
+				}
+			}
+			// Round to even
+			if(vrIsTrailingZeros && LastRemovedDigit == 5 && vr % 2 == 0)
+				LastRemovedDigit = 4;
+			Output = vr + (((vr == vm && (!AcceptBounds || !vmIsTrailingZeros)) || LastRemovedDigit >= 5) ? 1u : 0u);
+		}
+		else
+		{
+			for(; vp / 10 > vm / 10; ++Removed)
+			{
+				LastRemovedDigit = vr % 10;
+				vr /= 10;
+				vp /= 10;
+				vm /= 10;
+			}
+			Output = vr + ((vr == vm || LastRemovedDigit >= 5) ? 1u : 0u);
+		}
+
+		chars_decimal const Result = {Output, e10 + Removed};
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER char const * chars_digit_pairs()
+	{
+		return "00010203040506070809101112131415161718192021222324252627282930313233343536373839404142434445464748495051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+	}
+
+	GLM_FUNC_QUALIFIER int chars_digit_count(uint64 Value)
+	{
+		int Count = 1;
+		for(; Value >= 10; Value /= 10)
+			++Count;
+		return Count;
+	}
+
+	// Writes the Count digits of Value ending at Last, two at a time
+	GLM_FUNC_QUALIFIER void chars_write_digits(char * Last, uint64 Value, int Count)
+	{
+		char const * Pairs = chars_digit_pairs();
+		for(; Count >= 2; Count -= 2)
+		{
+			std::size_t const Pair = static_cast<std::size_t>(Value % 100) * 2;
+			Value /= 100;
+			*--Last = Pairs[Pair + 1];
+			*--Last = Pairs[Pair];
+		}
+		if(Count == 1)
+			*--Last = static_cast<char>('0' + Value);
+	}
+
+	// Text, or null if First is null or [First, Last) is too small
+	GLM_FUNC_QUALIFIER char * chars_write_text(char * First, char * Last, char const * Text)
+	{
+		if(First == 0)
+			return 0;
+		std::size_t const Length = std::strlen(Text);
+		if(static_cast<std::size_t>(Last - First) < Length)
+			return 0;
+		std::memcpy(First, Text, Length);
+		return First + Length;
+	}
+
+	GLM_FUNC_QUALIFIER char * chars_write_integer(char * First, char * Last, bool Negative, uint64 Value)
+	{
+		if(First == 0)
+			return 0;
+		int const Count = chars_digit_count(Value);
+		if(Last - First < Count + (Negative ? 1 : 0))
+			return 0;
+		if(Negative)
+			*First++ = '-';
+		chars_write_digits(First + Count, Value, Count);
+		return First + Count;
+	}
+
+	// Exact digits of an integer valued float, writing Count digits
+	GLM_FUNC_QUALIFIER void chars_write_exact(char * First, int Count, float Magnitude)
+	{
+		chars_write_digits(First + Count, static_cast<uint64>(Magnitude), Count);
+	}
+
+	GLM_FUNC_QUALIFIER void chars_write_exact(char * First, int Count, double Magnitude)
+	{
+		if(Magnitude < 18446744073709551616.0)
+		{
+			chars_write_digits(First + Count, static_cast<uint64>(Magnitude), Count);
+			return;
+		}
+
+		char Text[32];
+		std::sprintf(Text, "%.0f", Magnitude);
+		std::memcpy(First, Text, static_cast<std::size_t>(Count));
+	}
+
+	// Fixed or scientific notation, whichever is shorter, fixed for ties, as std::to_chars.
+	// Fixed notation of integers prints their exact value, of the same length as the shortest decimal.
+	template <typename T>
+	GLM_FUNC_QUALIFIER char * chars_write_decimal(char * First, char * Last, bool Negative, chars_decimal const & Decimal, T Magnitude)
+	{
+		if(First == 0)
+			return 0;
+
+		int const Count = chars_digit_count(Decimal.Mantissa);
+		int const Scientific = Decimal.Exponent + Count - 1;
+		int const AbsScientific = Scientific < 0 ? -Scientific : Scientific;
+		int const ScientificLength = Count + (Count > 1 ? 1 : 0) + 2 + (AbsScientific >= 100 ? 3 : 2);
+		int const FixedLength = Decimal.Exponent >= 0 ? Count + Decimal.Exponent : (Scientific >= 0 ? Count + 1 : Count + 1 - Scientific);
+
+		int const Length = (FixedLength <= ScientificLength ? FixedLength : ScientificLength) + (Negative ? 1 : 0);
+		if(Last - First < Length)
+			return 0;
+		if(Negative)
+			*First++ = '-';
+
+		if(FixedLength <= ScientificLength)
+		{
+			if(Decimal.Exponent >= 0)
+				chars_write_exact(First, FixedLength, Magnitude);
+			else if(Scientific >= 0)
+			{
+				// Integer digits shifted before the decimal point
+				int const Integer = Scientific + 1;
+				chars_write_digits(First + Count + 1, Decimal.Mantissa, Count);
+				std::memmove(First, First + 1, static_cast<std::size_t>(Integer));
+				First[Integer] = '.';
+			}
+			else
+			{
+				First[0] = '0';
+				First[1] = '.';
+				std::memset(First + 2, '0', static_cast<std::size_t>(-Scientific - 1));
+				chars_write_digits(First + FixedLength, Decimal.Mantissa, Count);
+			}
+			return First + FixedLength;
+		}
+
+		chars_write_digits(First + Count + (Count > 1 ? 1 : 0), Decimal.Mantissa, Count);
+		if(Count > 1)
+		{
+			First[0] = First[1];
+			First[1] = '.';
+		}
+		char * Exponent = First + Count + (Count > 1 ? 1 : 0);
+		Exponent[0] = 'e';
+		Exponent[1] = Scientific < 0 ? '-' : '+';
+		chars_write_digits(First + ScientificLength, static_cast<uint64>(AbsScientific), AbsScientific >= 100 ? 3 : 2);
+		return First + ScientificLength;
+	}
+
+	// Reads the digits and the exponent of a number printed with %e, whatever the decimal separator of the locale
+	GLM_FUNC_QUALIFIER chars_decimal chars_read_scientific(char const * Text)
+	{
+		chars_decimal Result = {0, 0};
+		int Digits = 0;
+		for(; *Text != 'e'; ++Text)
+		{
+			if(*Text < '0' || *Text > '9')
+				continue;
+			Result.Mantissa = Result.Mantissa * 10 + static_cast<uint64>(*Text - '0');
+			++Digits;
+		}
+		Result.Exponent = std::atoi(Text + 1) - (Digits - 1);
+		return Result;
+	}
+
+	// Reads a decimal back as a double, printed without decimal separator to be independent of the locale
+	GLM_FUNC_QUALIFIER double chars_read_decimal(chars_decimal const & Decimal)
+	{
+		char Text[32];
+		char * End = chars_write_integer(Text, Text + sizeof(Text), false, Decimal.Mantissa);
+		End = chars_write_text(End, Text + sizeof(Text), "e");
+		End = chars_write_integer(End, Text + sizeof(Text) - 1, Decimal.Exponent < 0, static_cast<uint64>(Decimal.Exponent < 0 ? -Decimal.Exponent : Decimal.Exponent));
+		*End = 0;
+		return std::strtod(Text, 0);
+	}
+
+	// Shortest decimal of 15, 16 or 17 significant digits that reads back as a finite double, the closest one
+	// when several have the same length. Decimals of up to 15 digits are at most one per double so that the
+	// rounding to 15 digits finds the shortest ones. At a power of two the doubles reading back to it extend
+	// twice further above than below, so that the rounding to 16 digits may fall below them while the next
+	// decimal above reads back: both are tried. Denormals have less significant digits and are searched from one digit.
+	GLM_FUNC_QUALIFIER chars_decimal chars_shortest(double Value)
+	{
+		char Text[32];
+		chars_decimal Result = {0, 0};
+		double const Magnitude = Value < 0.0 ? -Value : Value;
+		for(int Precision = Magnitude < std::numeric_limits<double>::min() ? 0 : 14; Precision <= 16; ++Precision)
+		{
+			std::sprintf(Text, "%.*e", Precision, Magnitude);
+			Result = chars_read_scientific(Text);
+			if(Precision == 16)
+				break;
+
+			double const Read = chars_read_decimal(Result);
+			if(Read == Magnitude)
+				break;
+
+			// The neighbour on the other side of the value
+			chars_decimal const Neighbour = {Read < Magnitude ? Result.Mantissa + 1 : Result.Mantissa - 1, Result.Exponent};
+			if(chars_read_decimal(Neighbour) == Magnitude)
+			{
+				Result = Neighbour;
+				break;
+			}
+		}
+
+		for(; Result.Mantissa != 0 && Result.Mantissa % 10 == 0; Result.Mantissa /= 10)
+			++Result.Exponent;
+		return Result;
+	}
+
+	template <typename T, bool isFloat = std::numeric_limits<T>::is_iec559, bool isSigned = std::numeric_limits<T>::is_signed>
+	struct compute_to_chars_scalar
+	{
+		GLM_FUNC_QUALIFIER static char * call(char * First, char * Last, T Value)
+		{
+			return chars_write_integer(First, Last, false, static_cast<uint64>(Value));
+		}
+	};
+
+	template <typename T>
+	struct compute_to_chars_scalar<T, false, true>
+	{
+		GLM_FUNC_QUALIFIER static char * call(char * First, char * Last, T Value)
+		{
+			// Negated in unsigned arithmetic to support the smallest value
+			uint64 const Magnitude = Value < 0 ? static_cast<uint64>(0) - static_cast<uint64>(Value) : static_cast<uint64>(Value);
+			return chars_write_integer(First, Last, Value < 0, Magnitude);
+		}
+	};
+
+	template <typename T, bool isSigned>
+	struct compute_to_chars_scalar<T, true, isSigned>
+	{
+		GLM_FUNC_QUALIFIER static char * call(char * First, char * Last, T Value)
+		{
+			if(Value != Value)
+				return chars_write_text(First, Last, "nan");
+			bool const Negative = Value < static_cast<T>(0) || (Value == static_cast<T>(0) && static_cast<T>(1) / Value < static_cast<T>(0));
+			if(Value == std::numeric_limits<T>::infinity() || Value == -std::numeric_limits<T>::infinity())
+				return chars_write_text(First, Last, Negative ? "-inf" : "inf");
+			if(Value == static_cast<T>(0))
+				return chars_write_text(First, Last, Negative ? "-0" : "0");
+			return chars_write_decimal(First, Last, Negative, chars_shortest(Value), Negative ? -Value : Value);
+		}
+	};
+
+	template <>
+	struct compute_to_chars_scalar<bool, false, false>
+	{
+		GLM_FUNC_QUALIFIER static char * call(char * First, char * Last, bool Value)
+		{
+			return chars_write_text(First, Last, Value ? "true" : "false");
+		}
+	};
+}//namespace detail
+}//namespace glm
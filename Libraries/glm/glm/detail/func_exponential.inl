@@ -12,15 +12,49 @@ namespace detail
 {
 #	if GLM_HAS_CXX11_STL
 		using std::log2;
+		using std::exp2;
 #	else
 		template <typename genType>
 		genType log2(genType Value)
 		{
 			return std::log(Value) * static_cast<genType>(1.4426950408889634073599246810019);
 		}
+
+		template <typename genType>
+		genType exp2(genType Value)
+		{
+			return std::exp(Value * static_cast<genType>(0.69314718055994530941723212145818));
+		}
 #	endif
 
-	template <typename T, precision P, template <class, precision> class vecType, bool isFloat, bool Aligned>
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned, precision Tier>
+	struct compute_exp
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(std::exp, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned, precision Tier>
+	struct compute_log
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(std::log, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned, precision Tier>
+	struct compute_exp2
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(exp2, x);
+		}
+	};
+
+	template <typename T, precision P, template <class, precision> class vecType, bool isFloat, bool Aligned, precision Tier>
 	struct compute_log2
 	{
 		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & vec)
@@ -29,7 +63,7 @@ namespace detail
 		}
 	};
 
-	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned, precision Tier>
 	struct compute_sqrt
 	{
 		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
@@ -38,7 +72,7 @@ namespace detail
 		}
 	};
 
-	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned, precision Tier>
 	struct compute_inversesqrt
 	{
 		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
@@ -46,20 +80,25 @@ namespace detail
 			return static_cast<T>(1) / sqrt(x);
 		}
 	};
-		
-	template <template <class, precision> class vecType, bool Aligned>
-	struct compute_inversesqrt<vecType, float, lowp, Aligned>
+
+	// Reciprocal square root estimate, within 5e-4 relative error. Zero and infinity give infinity and zero.
+	// Without SSE2 the exact result is returned: a bit trick estimate refined to this accuracy by two
+	// Newton-Raphson steps measured slower than the division by the hardware square root.
+	GLM_FUNC_QUALIFIER float inversesqrt_lowp(float x)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+#		else
+			return 1.0f / std::sqrt(x);
+#		endif
+	}
+
+	template <template <class, precision> class vecType, precision P, bool Aligned>
+	struct compute_inversesqrt<vecType, float, P, Aligned, lowp>
 	{
-		GLM_FUNC_QUALIFIER static vecType<float, lowp> call(vecType<float, lowp> const & x)
+		GLM_FUNC_QUALIFIER static vecType<float, P> call(vecType<float, P> const & x)
 		{
-			vecType<float, lowp> tmp(x);
-			vecType<float, lowp> xhalf(tmp * 0.5f);
-			vecType<uint, lowp>* p = reinterpret_cast<vecType<uint, lowp>*>(const_cast<vecType<float, lowp>*>(&x));
-			vecType<uint, lowp> i = vecType<uint, lowp>(0x5f375a86) - (*p >> vecType<uint, lowp>(1));
-			vecType<float, lowp>* ptmp = reinterpret_cast<vecType<float, lowp>*>(&i);
-			tmp = *ptmp;
-			tmp = tmp * (1.5f - xhalf * tmp * tmp);
-			return tmp;
+			return detail::functor1<float, float, P, vecType>::call(inversesqrt_lowp, x);
 		}
 	};
 }//namespace detail
@@ -77,7 +116,7 @@ namespace detail
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> exp(vecType<T, P> const & x)
 	{
-		return detail::functor1<T, T, P, vecType>::call(exp, x);
+		return detail::compute_exp<vecType, T, P, detail::is_aligned<P>::value, detail::precision_tier<T, P>::value>::call(x);
 	}
 
 	// log
@@ -85,7 +124,7 @@ namespace detail
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> log(vecType<T, P> const & x)
 	{
-		return detail::functor1<T, T, P, vecType>::call(log, x);
+		return detail::compute_log<vecType, T, P, detail::is_aligned<P>::value, detail::precision_tier<T, P>::value>::call(x);
 	}
 
 	//exp2, ln2 = 0.69314718055994530941723212145818f
@@ -100,7 +139,7 @@ namespace detail
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> exp2(vecType<T, P> const & x)
 	{
-		return detail::functor1<T, T, P, vecType>::call(exp2, x);
+		return detail::compute_exp2<vecType, T, P, detail::is_aligned<P>::value, detail::precision_tier<T, P>::value>::call(x);
 	}
 
 	// log2, ln2 = 0.69314718055994530941723212145818f
@@ -113,7 +152,7 @@ namespace detail
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> log2(vecType<T, P> const & x)
 	{
-		return detail::compute_log2<T, P, vecType, std::numeric_limits<T>::is_iec559, detail::is_aligned<P>::value>::call(x);
+		return detail::compute_log2<T, P, vecType, std::numeric_limits<T>::is_iec559, detail::is_aligned<P>::value, detail::precision_tier<T, P>::value>::call(x);
 	}
 
 	// sqrt
@@ -122,7 +161,7 @@ namespace detail
 	GLM_FUNC_QUALIFIER vecType<T, P> sqrt(vecType<T, P> const & x)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'sqrt' only accept floating-point inputs");
-		return detail::compute_sqrt<vecType, T, P, detail::is_aligned<P>::value>::call(x);
+		return detail::compute_sqrt<vecType, T, P, detail::is_aligned<P>::value, detail::precision_tier<T, P>::value>::call(x);
 	}
 
 	// inversesqrt
@@ -136,7 +175,7 @@ namespace detail
 	GLM_FUNC_QUALIFIER vecType<T, P> inversesqrt(vecType<T, P> const & x)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'inversesqrt' only accept floating-point inputs");
-		return detail::compute_inversesqrt<vecType, T, P, detail::is_aligned<P>::value>::call(x);
+		return detail::compute_inversesqrt<vecType, T, P, detail::is_aligned<P>::value, detail::precision_tier<T, P>::value>::call(x);
 	}
 }//namespace glm
 
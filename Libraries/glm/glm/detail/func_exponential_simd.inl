@@ -8,8 +8,8 @@
 namespace glm{
 namespace detail
 {
-	template <precision P>
-	struct compute_sqrt<tvec4, float, P, true>
+	template <precision P, precision Tier>
+	struct compute_sqrt<tvec4, float, P, true, Tier>
 	{
 		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
 		{
@@ -19,16 +19,140 @@ namespace detail
 		}
 	};
 
-	template <>
-	struct compute_sqrt<tvec4, float, aligned_lowp, true>
+	template <precision P>
+	struct compute_sqrt<tvec4, float, P, true, lowp>
 	{
-		GLM_FUNC_QUALIFIER static tvec4<float, aligned_lowp> call(tvec4<float, aligned_lowp> const & v)
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
 		{
-			tvec4<float, aligned_lowp> result(uninitialize);
+			tvec4<float, P> result(uninitialize);
 			result.data = glm_vec4_sqrt_lowp(v.data);
 			return result;
 		}
 	};
+
+	template <precision P>
+	struct compute_inversesqrt<tvec4, float, P, true, mediump>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
+		{
+			tvec4<float, P> result(uninitialize);
+			result.data = glm_vec4_inversesqrt_mediump(v.data);
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_inversesqrt<tvec4, float, P, true, lowp>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
+		{
+			tvec4<float, P> result(uninitialize);
+			result.data = glm_vec4_inversesqrt_lowp(v.data);
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_exp2<tvec4, float, P, true, mediump>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_exp2_mediump(x.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_exp<tvec4, float, P, true, mediump>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_exp2_mediump(_mm_mul_ps(x.data, _mm_set1_ps(1.44269504089f)));
+			return Result;
+		}
+	};
+
+	// Zero, negative, infinite and NaN inputs use the C library
+	template <precision P>
+	struct compute_log2<float, P, tvec4, true, true, mediump>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x)
+		{
+			glm_vec4 Special;
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_log2_mediump(x.data, &Special);
+			if(_mm_movemask_ps(Special) != 0)
+				return detail::functor1<float, float, P, tvec4>::call(log2, x);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_log<tvec4, float, P, true, mediump>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x)
+		{
+			glm_vec4 Special;
+			tvec4<float, P> Result(uninitialize);
+			Result.data = _mm_mul_ps(glm_vec4_log2_mediump(x.data, &Special), _mm_set1_ps(0.69314718056f));
+			if(_mm_movemask_ps(Special) != 0)
+				return detail::functor1<float, float, P, tvec4>::call(std::log, x);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_exp2<tvec4, float, P, true, lowp>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_exp2_lowp(x.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_exp<tvec4, float, P, true, lowp>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_exp2_lowp(_mm_mul_ps(x.data, _mm_set1_ps(1.44269504089f)));
+			return Result;
+		}
+	};
+
+	// Zero, negative, infinite and NaN inputs use the C library
+	template <precision P>
+	struct compute_log2<float, P, tvec4, true, true, lowp>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x)
+		{
+			glm_vec4 Special;
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_log2_lowp(x.data, &Special);
+			if(_mm_movemask_ps(Special) != 0)
+				return detail::functor1<float, float, P, tvec4>::call(log2, x);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_log<tvec4, float, P, true, lowp>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x)
+		{
+			glm_vec4 Special;
+			tvec4<float, P> Result(uninitialize);
+			Result.data = _mm_mul_ps(glm_vec4_log2_lowp(x.data, &Special), _mm_set1_ps(0.69314718056f));
+			if(_mm_movemask_ps(Special) != 0)
+				return detail::functor1<float, float, P, tvec4>::call(std::log, x);
+			return Result;
+		}
+	};
 }//namespace detail
 }//namespace glm
 
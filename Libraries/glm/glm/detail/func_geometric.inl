@@ -84,7 +84,7 @@ namespace detail
 		}
 	};
 
-	template <typename T, precision P, template <typename, precision> class vecType, bool Aligned>
+	template <typename T, precision P, template <typename, precision> class vecType, bool Aligned, precision Tier>
 	struct compute_normalize
 	{
 		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & v)
@@ -195,7 +195,7 @@ namespace detail
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'normalize' accepts only floating-point inputs");
 
-		return detail::compute_normalize<T, P, vecType, detail::is_aligned<P>::value>::call(x);
+		return detail::compute_normalize<T, P, vecType, detail::is_aligned<P>::value, detail::precision_tier<T, P>::value>::call(x);
 	}
 
 	// faceforward
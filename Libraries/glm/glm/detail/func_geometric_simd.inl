@@ -50,8 +50,8 @@ namespace detail
 		}
 	};
 
-	template <precision P>
-	struct compute_normalize<float, P, tvec4, true>
+	template <precision P, precision Tier>
+	struct compute_normalize<float, P, tvec4, true, Tier>
 	{
 		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
 		{
@@ -61,6 +61,17 @@ namespace detail
 		}
 	};
 
+	template <precision P>
+	struct compute_normalize<float, P, tvec4, true, lowp>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
+		{
+			tvec4<float, P> result(uninitialize);
+			result.data = glm_vec4_normalize_lowp(v.data);
+			return result;
+		}
+	};
+
 	template <precision P>
 	struct compute_faceforward<float, P, tvec4, true>
 	{
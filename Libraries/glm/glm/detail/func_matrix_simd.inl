@@ -58,6 +58,17 @@ namespace detail
 			return Result;
 		}
 	};
+
+	template <>
+	struct compute_inverse<tmat4x4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<float, aligned_lowp> call(tmat4x4<float, aligned_lowp> const& m)
+		{
+			tmat4x4<float, aligned_lowp> Result(uninitialize);
+			glm_mat4_inverse_lowp(*reinterpret_cast<__m128 const(*)[4]>(&m[0].data), *reinterpret_cast<__m128(*)[4]>(&Result[0].data));
+			return Result;
+		}
+	};
 }//namespace detail
 
 	template<>
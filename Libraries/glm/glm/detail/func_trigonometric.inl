@@ -5,8 +5,28 @@
 #include <cmath>
 #include <limits>
 
-namespace glm
+namespace glm{
+namespace detail
 {
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned, precision Tier>
+	struct compute_sin
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(std::sin, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned, precision Tier>
+	struct compute_cos
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(std::cos, x);
+		}
+	};
+}//namespace detail
+
 	// radians
 	template <typename genType>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR genType radians(genType degrees)
@@ -43,7 +63,7 @@ namespace glm
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> sin(vecType<T, P> const & v)
 	{
-		return detail::functor1<T, T, P, vecType>::call(sin, v);
+		return detail::compute_sin<vecType, T, P, detail::is_aligned<P>::value, detail::precision_tier<T, P>::value>::call(v);
 	}
 
 	// cos
@@ -52,7 +72,7 @@ namespace glm
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> cos(vecType<T, P> const & v)
 	{
-		return detail::functor1<T, T, P, vecType>::call(cos, v);
+		return detail::compute_cos<vecType, T, P, detail::is_aligned<P>::value, detail::precision_tier<T, P>::value>::call(v);
 	}
 
 	// tan
@@ -192,6 +212,23 @@ namespace glm
 	{
 		return detail::functor1<T, T, P, vecType>::call(atanh, v);
 	}
+
+namespace detail
+{
+	// Sine and cosine of four angles at once, used to fuse the trigonometric evaluations of multi-angle builders.
+	template <typename T>
+	struct compute_sincos4
+	{
+		GLM_FUNC_QUALIFIER static void call(T const * x, T * s, T * c)
+		{
+			for(length_t i = 0; i < 4; ++i)
+			{
+				s[i] = std::sin(x[i]);
+				c[i] = std::cos(x[i]);
+			}
+		}
+	};
+}//namespace detail
 }//namespace glm
 
 #if GLM_ARCH != GLM_ARCH_PURE && GLM_HAS_UNRESTRICTED_UNIONS
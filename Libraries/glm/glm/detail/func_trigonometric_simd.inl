@@ -0,0 +1,107 @@
+/// @ref core
+/// @file glm/detail/func_trigonometric_simd.inl
+
+#include "../simd/trigonometric.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	template <>
+	struct compute_sincos4<float>
+	{
+		GLM_FUNC_QUALIFIER static void call(float const * x, float * s, float * c)
+		{
+			glm_vec4 const v = _mm_setr_ps(x[0], x[1], x[2], x[3]);
+			glm_vec4 const a = _mm_andnot_ps(_mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000))), v);
+
+			// Fallback to the C library when the range reduction would lose precision, or for NaN inputs
+			if(_mm_movemask_ps(_mm_cmple_ps(a, _mm_set1_ps(GLM_VEC4_SINCOS_MAX_ARG))) != 0xF)
+			{
+				for(length_t i = 0; i < 4; ++i)
+				{
+					s[i] = std::sin(x[i]);
+					c[i] = std::cos(x[i]);
+				}
+				return;
+			}
+
+			glm_vec4 sin0, cos0;
+			glm_vec4_sincos(v, &sin0, &cos0);
+			_mm_storeu_ps(s, sin0);
+			_mm_storeu_ps(c, cos0);
+		}
+	};
+
+	template <precision P>
+	struct compute_sin<tvec4, float, P, true, mediump>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x)
+		{
+			glm_ivec4 n;
+			glm_vec4 r, s, c;
+			if(_mm_movemask_ps(glm_vec4_sincos_reduce(x.data, &n, &r)) != 0)
+				return detail::functor1<float, float, P, tvec4>::call(std::sin, x);
+
+			glm_vec4_sincos_poly_mediump(r, &s, &c);
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_sincos_select(n, s, c);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_sin<tvec4, float, P, true, lowp>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x)
+		{
+			glm_ivec4 n;
+			glm_vec4 r, s, c;
+			if(_mm_movemask_ps(glm_vec4_sincos_reduce(x.data, &n, &r)) != 0)
+				return detail::functor1<float, float, P, tvec4>::call(std::sin, x);
+
+			glm_vec4_sincos_poly_lowp(r, &s, &c);
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_sincos_select(n, s, c);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_cos<tvec4, float, P, true, mediump>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x)
+		{
+			glm_ivec4 n;
+			glm_vec4 r, s, c;
+			if(_mm_movemask_ps(glm_vec4_sincos_reduce(x.data, &n, &r)) != 0)
+				return detail::functor1<float, float, P, tvec4>::call(std::cos, x);
+
+			glm_vec4_sincos_poly_mediump(r, &s, &c);
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_sincos_select(_mm_add_epi32(n, _mm_set1_epi32(1)), s, c);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_cos<tvec4, float, P, true, lowp>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & x)
+		{
+			glm_ivec4 n;
+			glm_vec4 r, s, c;
+			if(_mm_movemask_ps(glm_vec4_sincos_reduce(x.data, &n, &r)) != 0)
+				return detail::functor1<float, float, P, tvec4>::call(std::cos, x);
+
+			glm_vec4_sincos_poly_lowp(r, &s, &c);
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_sincos_select(_mm_add_epi32(n, _mm_set1_epi32(1)), s, c);
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -59,5 +59,45 @@ namespace detail
 			static const bool value = true;
 		};
 #	endif
+
+	// Accuracy tier of the functions of single precision vectors, other types are always computed at highp accuracy.
+	// The SIMD implementations of aligned_lowp and aligned_mediump tvec4 use approximations, with maximum errors
+	// relative, or absolute for log, log2, sin and cos:
+	// - lowp: 5e-4 for sqrt, inversesqrt, divide, normalize and inverse, 1e-3 for exp, exp2, sin and cos, 5e-5 for log and log2
+	// - mediump: 5e-7 for inversesqrt, 1e-5 for exp and exp2, 5e-7 for log and log2, 5e-6 for sin and cos
+	// sin and cos are approximated for |x| below 8192, larger angles and special values use the C library.
+	// With SSE2, inversesqrt of the other lowp vectors uses a reciprocal square root estimate per component.
+	// Other functions and qualifiers are computed exactly as the hardware is as fast as any approximation.
+	template <typename T, glm::precision P>
+	struct precision_tier
+	{
+		static const glm::precision value = glm::highp;
+	};
+
+	template <>
+	struct precision_tier<float, glm::packed_mediump>
+	{
+		static const glm::precision value = glm::mediump;
+	};
+
+	template <>
+	struct precision_tier<float, glm::packed_lowp>
+	{
+		static const glm::precision value = glm::lowp;
+	};
+
+#	if GLM_HAS_ALIGNED_TYPE
+		template <>
+		struct precision_tier<float, glm::aligned_mediump>
+		{
+			static const glm::precision value = glm::mediump;
+		};
+
+		template <>
+		struct precision_tier<float, glm::aligned_lowp>
+		{
+			static const glm::precision value = glm::lowp;
+		};
+#	endif
 }//namespace detail
 }//namespace glm
@@ -59,13 +59,17 @@
 #	include "./gtc/type_aligned.hpp"
 #endif
 
+#include "./gtx/animation_clip.hpp"
 #include "./gtx/associated_min_max.hpp"
+#include "./gtx/binary_archive.hpp"
 #include "./gtx/bit.hpp"
 #include "./gtx/closest_point.hpp"
+#include "./gtx/clustered_lights.hpp"
 #include "./gtx/color_space.hpp"
 #include "./gtx/color_space_YCoCg.hpp"
 #include "./gtx/compatibility.hpp"
 #include "./gtx/component_wise.hpp"
+#include "./gtx/distance_field.hpp"
 #include "./gtx/dual_quaternion.hpp"
 #include "./gtx/euler_angles.hpp"
 #include "./gtx/extend.hpp"
@@ -74,28 +78,38 @@
 #include "./gtx/fast_square_root.hpp"
 #include "./gtx/fast_trigonometry.hpp"
 #include "./gtx/gradient_paint.hpp"
+#include "./gtx/half_float.hpp"
 #include "./gtx/handed_coordinate_space.hpp"
 #include "./gtx/integer.hpp"
 #include "./gtx/intersect.hpp"
+#include "./gtx/isosurface.hpp"
+#include "./gtx/large_world.hpp"
 #include "./gtx/log_base.hpp"
 #include "./gtx/matrix_cross_product.hpp"
 #include "./gtx/matrix_interpolation.hpp"
 #include "./gtx/matrix_major_storage.hpp"
 #include "./gtx/matrix_operation.hpp"
 #include "./gtx/matrix_query.hpp"
+#include "./gtx/mesh_import.hpp"
+#include "./gtx/mesh_normal.hpp"
+#include "./gtx/mesh_simplify.hpp"
 #include "./gtx/mixed_product.hpp"
 #include "./gtx/norm.hpp"
 #include "./gtx/normal.hpp"
 #include "./gtx/normalize_dot.hpp"
 #include "./gtx/number_precision.hpp"
+#include "./gtx/occlusion_culling.hpp"
 #include "./gtx/optimum_pow.hpp"
 #include "./gtx/orthonormalize.hpp"
+#include "./gtx/path_tracer.hpp"
 #include "./gtx/perpendicular.hpp"
 #include "./gtx/polar_coordinates.hpp"
 #include "./gtx/projection.hpp"
 #include "./gtx/quaternion.hpp"
 #include "./gtx/raw_data.hpp"
 #include "./gtx/rotate_vector.hpp"
+#include "./gtx/shadow_cascades.hpp"
+#include "./gtx/sincos.hpp"
 
 #include "./gtx/spline.hpp"
 #include "./gtx/std_based_type.hpp"
@@ -106,6 +120,7 @@
 
 #include "./gtx/transform.hpp"
 #include "./gtx/transform2.hpp"
+#include "./gtx/ulp_sweep.hpp"
 #include "./gtx/vector_angle.hpp"
 #include "./gtx/vector_query.hpp"
 #include "./gtx/wrap.hpp"
@@ -117,3 +132,12 @@
 #if GLM_HAS_RANGE_FOR
 #	include "./gtx/range.hpp"
 #endif
+
+#if GLM_HAS_UNRESTRICTED_UNIONS && GLM_HAS_DEFAULTED_FUNCTIONS && GLM_HAS_EXPLICIT_CONVERSION_OPERATORS
+#	include "./gtx/fixed_point.hpp"
+#endif
+
+#if GLM_HAS_ALIGNED_TYPE && GLM_HAS_ALIGNOF && GLM_HAS_CXX11_STL && !((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_COMPILER < GLM_COMPILER_VC14))
+#	include "./gtx/allocator.hpp"
+#	include "./gtx/particles.hpp"
+#endif
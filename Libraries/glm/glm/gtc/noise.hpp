@@ -21,10 +21,13 @@
 #include "../detail/_noise.hpp"
 #include "../geometric.hpp"
 #include "../common.hpp"
+#include "../exponential.hpp"
 #include "../vector_relational.hpp"
 #include "../vec2.hpp"
 #include "../vec3.hpp"
 #include "../vec4.hpp"
+#include <cstddef>
+#include <limits>
 
 #if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_noise extension included")
@@ -35,6 +38,14 @@ namespace glm
 	/// @addtogroup gtc_noise
 	/// @{
 
+	/// Distance metric of cellular noise.
+	enum cellular_distance
+	{
+		euclidean_distance,	///< Length of the offset to the feature point
+		manhattan_distance,	///< Sum of the absolute offsets along each axis
+		chebyshev_distance	///< Largest absolute offset along an axis
+	};
+
 	/// Classic perlin noise.
 	/// @see gtc_noise
 	template <typename T, precision P, template<typename, precision> class vecType>
@@ -48,12 +59,95 @@ namespace glm
 		vecType<T, P> const & p,
 		vecType<T, P> const & rep);
 
+	/// Classic perlin noise of Count positions, evaluated four at a time with SIMD instructions when available.
+	/// @see gtc_noise
+	template <typename T, precision P>
+	GLM_FUNC_DECL void perlin(
+		tvec3<T, P> const * Positions,
+		T * Values,
+		std::size_t Count);
+
 	/// Simplex noise.
 	/// @see gtc_noise
 	template <typename T, precision P, template<typename, precision> class vecType>
 	GLM_FUNC_DECL T simplex(
 		vecType<T, P> const & p);
 
+	/// Simplex noise of Count positions, evaluated four at a time with SIMD instructions when available.
+	/// @see gtc_noise
+	template <typename T, precision P>
+	GLM_FUNC_DECL void simplex(
+		tvec3<T, P> const * Positions,
+		T * Values,
+		std::size_t Count);
+
+	/// Cellular (Worley) noise: distances (F1, F2) to the closest and second closest feature points,
+	/// one feature point being placed in each unit cell. F2 - F1 gives the cell borders.
+	/// Cells are searched by rings of increasing distance, so that F1 and F2 are exact.
+	/// Return NaN for a position with a NaN or infinite component.
+	/// @see gtc_noise
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_DECL tvec2<T, P> cellular(
+		vecType<T, P> const & p,
+		cellular_distance Distance);
+
+	/// Cellular noise with the euclidean distance.
+	/// @see gtc_noise
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_DECL tvec2<T, P> cellular(
+		vecType<T, P> const & p);
+
+	/// Cellular noise of Count positions, evaluated four at a time with SIMD instructions when available.
+	/// @see gtc_noise
+	template <typename T, precision P>
+	GLM_FUNC_DECL void cellular(
+		tvec3<T, P> const * Positions,
+		tvec2<T, P> * Results,
+		std::size_t Count,
+		cellular_distance Distance);
+
+	/// Simplex noise and its analytic gradient, returned as (dN/dx, dN/dy, dN/dz, N).
+	/// @see gtc_noise
+	template <typename T, precision P>
+	GLM_FUNC_DECL tvec4<T, P> simplexDerivative(
+		tvec3<T, P> const & p);
+
+	/// Simplex noise and gradients of Count positions, evaluated four at a time with SIMD instructions when available.
+	/// @see gtc_noise
+	template <typename T, precision P>
+	GLM_FUNC_DECL void simplexDerivative(
+		tvec3<T, P> const * Positions,
+		tvec4<T, P> * Results,
+		std::size_t Count);
+
+	/// Classic perlin noise and its analytic gradient, returned as (dN/dx, dN/dy, dN/dz, N).
+	/// @see gtc_noise
+	template <typename T, precision P>
+	GLM_FUNC_DECL tvec4<T, P> perlinDerivative(
+		tvec3<T, P> const & p);
+
+	/// Classic perlin noise and gradients of Count positions, evaluated four at a time with SIMD instructions when available.
+	/// @see gtc_noise
+	template <typename T, precision P>
+	GLM_FUNC_DECL void perlinDerivative(
+		tvec3<T, P> const * Positions,
+		tvec4<T, P> * Results,
+		std::size_t Count);
+
+	/// Divergence free noise: the curl of a vector potential made of three simplex noises.
+	/// @see gtc_noise
+	template <typename T, precision P>
+	GLM_FUNC_DECL tvec3<T, P> curlNoise(
+		tvec3<T, P> const & p);
+
+	/// Curl noise of Count positions, evaluated four at a time with SIMD instructions when available.
+	/// @see gtc_noise
+	template <typename T, precision P>
+	GLM_FUNC_DECL void curlNoise(
+		tvec3<T, P> const * Positions,
+		tvec3<T, P> * Results,
+		std::size_t Count);
+
 	/// @}
 }//namespace glm
 
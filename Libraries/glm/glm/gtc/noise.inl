@@ -805,4 +805,464 @@ namespace gtc
 			(dot(m0 * m0, tvec3<T, P>(dot(p0, x0), dot(p1, x1), dot(p2, x2))) + 
 			dot(m1 * m1, tvec2<T, P>(dot(p3, x3), dot(p4, x4))));
 	}
+
+	// Simplex noise with its gradient: value = 42 * sum(m^4 * dot(g, x)) with m = max(0.6 - dot(x, x), 0),
+	// so gradient = 42 * sum(m^4 * g - 8 * m^3 * dot(g, x) * x)
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tvec4<T, P> simplexDerivative(tvec3<T, P> const & v)
+	{
+		tvec2<T, P> const C(1.0 / 6.0, 1.0 / 3.0);
+		tvec4<T, P> const D(0.0, 0.5, 1.0, 2.0);
+
+		// First corner
+		tvec3<T, P> i(floor(v + dot(v, tvec3<T, P>(C.y))));
+		tvec3<T, P> x0(v - i + dot(i, tvec3<T, P>(C.x)));
+
+		// Other corners
+		tvec3<T, P> g(step(tvec3<T, P>(x0.y, x0.z, x0.x), x0));
+		tvec3<T, P> l(T(1) - g);
+		tvec3<T, P> i1(min(g, tvec3<T, P>(l.z, l.x, l.y)));
+		tvec3<T, P> i2(max(g, tvec3<T, P>(l.z, l.x, l.y)));
+
+		tvec3<T, P> x1(x0 - i1 + C.x);
+		tvec3<T, P> x2(x0 - i2 + C.y);
+		tvec3<T, P> x3(x0 - D.y);
+
+		// Permutations
+		i = detail::mod289(i);
+		tvec4<T, P> p(detail::permute(detail::permute(detail::permute(
+			i.z + tvec4<T, P>(T(0), i1.z, i2.z, T(1))) +
+			i.y + tvec4<T, P>(T(0), i1.y, i2.y, T(1))) +
+			i.x + tvec4<T, P>(T(0), i1.x, i2.x, T(1))));
+
+		// Gradients: 7x7 points over a square, mapped onto an octahedron.
+		T n_ = static_cast<T>(0.142857142857); // 1.0/7.0
+		tvec3<T, P> ns(n_ * tvec3<T, P>(D.w, D.y, D.z) - tvec3<T, P>(D.x, D.z, D.x));
+
+		tvec4<T, P> j(p - T(49) * floor(p * ns.z * ns.z));  //  mod(p,7*7)
+
+		tvec4<T, P> x_(floor(j * ns.z));
+		tvec4<T, P> y_(floor(j - T(7) * x_));    // mod(j,N)
+
+		tvec4<T, P> x(x_ * ns.x + ns.y);
+		tvec4<T, P> y(y_ * ns.x + ns.y);
+		tvec4<T, P> h(T(1) - abs(x) - abs(y));
+
+		tvec4<T, P> b0(x.x, x.y, y.x, y.y);
+		tvec4<T, P> b1(x.z, x.w, y.z, y.w);
+
+		tvec4<T, P> s0(floor(b0) * T(2) + T(1));
+		tvec4<T, P> s1(floor(b1) * T(2) + T(1));
+		tvec4<T, P> sh(-step(h, tvec4<T, P>(0.0)));
+
+		tvec4<T, P> a0 = tvec4<T, P>(b0.x, b0.z, b0.y, b0.w) + tvec4<T, P>(s0.x, s0.z, s0.y, s0.w) * tvec4<T, P>(sh.x, sh.x, sh.y, sh.y);
+		tvec4<T, P> a1 = tvec4<T, P>(b1.x, b1.z, b1.y, b1.w) + tvec4<T, P>(s1.x, s1.z, s1.y, s1.w) * tvec4<T, P>(sh.z, sh.z, sh.w, sh.w);
+
+		tvec3<T, P> p0(a0.x, a0.y, h.x);
+		tvec3<T, P> p1(a0.z, a0.w, h.y);
+		tvec3<T, P> p2(a1.x, a1.y, h.z);
+		tvec3<T, P> p3(a1.z, a1.w, h.w);
+
+		// Normalise gradients
+		tvec4<T, P> norm = detail::taylorInvSqrt(tvec4<T, P>(dot(p0, p0), dot(p1, p1), dot(p2, p2), dot(p3, p3)));
+		p0 *= norm.x;
+		p1 *= norm.y;
+		p2 *= norm.z;
+		p3 *= norm.w;
+
+		// Mix final noise value and its derivatives
+		tvec4<T, P> const m = max(T(0.6) - tvec4<T, P>(dot(x0, x0), dot(x1, x1), dot(x2, x2), dot(x3, x3)), tvec4<T, P>(0));
+		tvec4<T, P> const m2 = m * m;
+		tvec4<T, P> const m4 = m2 * m2;
+		tvec4<T, P> const pdotx(dot(p0, x0), dot(p1, x1), dot(p2, x2), dot(p3, x3));
+
+		tvec4<T, P> const t = m2 * m * pdotx;
+		tvec3<T, P> Gradient = T(-8) * (t.x * x0 + t.y * x1 + t.z * x2 + t.w * x3);
+		Gradient += m4.x * p0 + m4.y * p1 + m4.z * p2 + m4.w * p3;
+
+		return T(42) * tvec4<T, P>(Gradient, dot(m4, pdotx));
+	}
+
+	// Classic Perlin noise with its gradient: the trilinear interpolation of the gradients of the corners,
+	// plus the derivative of the fade curve 30 * t^2 * (t - 1)^2 times the slopes of the interpolation
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tvec4<T, P> perlinDerivative(tvec3<T, P> const & Position)
+	{
+		tvec3<T, P> Pi0 = floor(Position); // Integer part for indexing
+		tvec3<T, P> Pi1 = Pi0 + T(1); // Integer part + 1
+		Pi0 = detail::mod289(Pi0);
+		Pi1 = detail::mod289(Pi1);
+		tvec3<T, P> Pf0 = fract(Position); // Fractional part for interpolation
+		tvec3<T, P> Pf1 = Pf0 - T(1); // Fractional part - 1.0
+		tvec4<T, P> ix(Pi0.x, Pi1.x, Pi0.x, Pi1.x);
+		tvec4<T, P> iy = tvec4<T, P>(tvec2<T, P>(Pi0.y), tvec2<T, P>(Pi1.y));
+		tvec4<T, P> iz0(Pi0.z);
+		tvec4<T, P> iz1(Pi1.z);
+
+		tvec4<T, P> ixy = detail::permute(detail::permute(ix) + iy);
+		tvec4<T, P> ixy0 = detail::permute(ixy + iz0);
+		tvec4<T, P> ixy1 = detail::permute(ixy + iz1);
+
+		tvec4<T, P> gx0 = ixy0 * T(1.0 / 7.0);
+		tvec4<T, P> gy0 = fract(floor(gx0) * T(1.0 / 7.0)) - T(0.5);
+		gx0 = fract(gx0);
+		tvec4<T, P> gz0 = tvec4<T, P>(0.5) - abs(gx0) - abs(gy0);
+		tvec4<T, P> sz0 = step(gz0, tvec4<T, P>(0.0));
+		gx0 -= sz0 * (step(T(0), gx0) - T(0.5));
+		gy0 -= sz0 * (step(T(0), gy0) - T(0.5));
+
+		tvec4<T, P> gx1 = ixy1 * T(1.0 / 7.0);
+		tvec4<T, P> gy1 = fract(floor(gx1) * T(1.0 / 7.0)) - T(0.5);
+		gx1 = fract(gx1);
+		tvec4<T, P> gz1 = tvec4<T, P>(0.5) - abs(gx1) - abs(gy1);
+		tvec4<T, P> sz1 = step(gz1, tvec4<T, P>(0.0));
+		gx1 -= sz1 * (step(T(0), gx1) - T(0.5));
+		gy1 -= sz1 * (step(T(0), gy1) - T(0.5));
+
+		tvec3<T, P> g000(gx0.x, gy0.x, gz0.x);
+		tvec3<T, P> g100(gx0.y, gy0.y, gz0.y);
+		tvec3<T, P> g010(gx0.z, gy0.z, gz0.z);
+		tvec3<T, P> g110(gx0.w, gy0.w, gz0.w);
+		tvec3<T, P> g001(gx1.x, gy1.x, gz1.x);
+		tvec3<T, P> g101(gx1.y, gy1.y, gz1.y);
+		tvec3<T, P> g011(gx1.z, gy1.z, gz1.z);
+		tvec3<T, P> g111(gx1.w, gy1.w, gz1.w);
+
+		tvec4<T, P> norm0 = detail::taylorInvSqrt(tvec4<T, P>(dot(g000, g000), dot(g010, g010), dot(g100, g100), dot(g110, g110)));
+		g000 *= norm0.x;
+		g010 *= norm0.y;
+		g100 *= norm0.z;
+		g110 *= norm0.w;
+		tvec4<T, P> norm1 = detail::taylorInvSqrt(tvec4<T, P>(dot(g001, g001), dot(g011, g011), dot(g101, g101), dot(g111, g111)));
+		g001 *= norm1.x;
+		g011 *= norm1.y;
+		g101 *= norm1.z;
+		g111 *= norm1.w;
+
+		T n000 = dot(g000, Pf0);
+		T n100 = dot(g100, tvec3<T, P>(Pf1.x, Pf0.y, Pf0.z));
+		T n010 = dot(g010, tvec3<T, P>(Pf0.x, Pf1.y, Pf0.z));
+		T n110 = dot(g110, tvec3<T, P>(Pf1.x, Pf1.y, Pf0.z));
+		T n001 = dot(g001, tvec3<T, P>(Pf0.x, Pf0.y, Pf1.z));
+		T n101 = dot(g101, tvec3<T, P>(Pf1.x, Pf0.y, Pf1.z));
+		T n011 = dot(g011, tvec3<T, P>(Pf0.x, Pf1.y, Pf1.z));
+		T n111 = dot(g111, Pf1);
+
+		tvec3<T, P> const u = detail::fade(Pf0);
+		tvec3<T, P> const du = T(30) * Pf0 * Pf0 * (Pf0 * (Pf0 - T(2)) + T(1));
+
+		tvec4<T, P> n_z = mix(tvec4<T, P>(n000, n100, n010, n110), tvec4<T, P>(n001, n101, n011, n111), u.z);
+		tvec2<T, P> n_yz = mix(tvec2<T, P>(n_z.x, n_z.y), tvec2<T, P>(n_z.z, n_z.w), u.y);
+		T n_xyz = mix(n_yz.x, n_yz.y, u.x);
+
+		tvec3<T, P> const g_yz0 = mix(mix(g000, g001, u.z), mix(g010, g011, u.z), u.y);
+		tvec3<T, P> const g_yz1 = mix(mix(g100, g101, u.z), mix(g110, g111, u.z), u.y);
+		tvec3<T, P> Gradient = mix(g_yz0, g_yz1, u.x);
+
+		// n_xyz = n000 + k1 * u.x + k2 * u.y + k3 * u.z + k4 * u.x * u.y + k5 * u.y * u.z + k6 * u.z * u.x + k7 * u.x * u.y * u.z
+		T const k1 = n100 - n000;
+		T const k2 = n010 - n000;
+		T const k3 = n001 - n000;
+		T const k4 = n000 - n100 - n010 + n110;
+		T const k5 = n000 - n010 - n001 + n011;
+		T const k6 = n000 - n100 - n001 + n101;
+		T const k7 = -n000 + n100 + n010 - n110 + n001 - n101 - n011 + n111;
+		Gradient += du * tvec3<T, P>(
+			k1 + k4 * u.y + k6 * u.z + k7 * u.y * u.z,
+			k2 + k5 * u.z + k4 * u.x + k7 * u.z * u.x,
+			k3 + k6 * u.x + k5 * u.y + k7 * u.x * u.y);
+
+		return T(2.2) * tvec4<T, P>(Gradient, n_xyz);
+	}
+
+	// Curl of the vector potential made of three simplex noises at offset positions, a divergence free field
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tvec3<T, P> curlNoise(tvec3<T, P> const & Position)
+	{
+		tvec4<T, P> const n0 = simplexDerivative(Position);
+		tvec4<T, P> const n1 = simplexDerivative(Position + tvec3<T, P>(T(31.416), T(-47.853), T(12.793)));
+		tvec4<T, P> const n2 = simplexDerivative(Position + tvec3<T, P>(T(-233.145), T(-113.408), T(-185.31)));
+		return tvec3<T, P>(n2.y - n1.z, n0.z - n2.x, n1.x - n0.y);
+	}
+
+namespace detail
+{
+	// Feature point of a cell, in [0, 1) relative to the cell, from its coordinates modulo 289
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<T, P> cellular_feature(vecType<T, P> const & Cell)
+	{
+		T Hash = permute(Cell[0]);
+		for(length_t i = 1; i < vecType<T, P>::length(); ++i)
+			Hash = permute(Hash + Cell[i]);
+
+		vecType<T, P> Feature;
+		for(length_t i = 0; i < vecType<T, P>::length(); ++i)
+			Feature[i] = (permute(Hash + Cell[i]) + static_cast<T>(0.5)) * static_cast<T>(1.0 / 289.0);
+		return Feature;
+	}
+
+	// Distance with the metric, squared for the euclidean distance
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER T cellular_metric(vecType<T, P> const & Offset, cellular_distance Distance)
+	{
+		vecType<T, P> const Abs = abs(Offset);
+		T Result = static_cast<T>(0);
+		for(length_t i = 0; i < vecType<T, P>::length(); ++i)
+			Result = Distance == euclidean_distance ? Result + Abs[i] * Abs[i] : Distance == manhattan_distance ? Result + Abs[i] : max(Result, Abs[i]);
+		return Result;
+	}
+}//namespace detail
+
+	// Cells at a Chebyshev distance Ring of the cell of the position are visited by increasing rings until
+	// the ring can't contain a feature point closer than F2. Each cell is skipped when its distance to the
+	// position is larger than F2. The first ring is visited from the center to the corners so that F2
+	// shrinks early. A non finite position has no cell and would never end the search.
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER tvec2<T, P> cellular(vecType<T, P> const & Position, cellular_distance Distance)
+	{
+		length_t const Length = vecType<T, P>::length();
+		for(length_t i = 0; i < Length; ++i)
+			if(!(abs(Position[i]) <= std::numeric_limits<T>::max()))
+				return tvec2<T, P>(std::numeric_limits<T>::quiet_NaN());
+
+		vecType<T, P> const Cell = floor(Position);
+		vecType<T, P> const Fraction = Position - Cell;
+		vecType<T, P> const Base = detail::mod289(Cell);
+
+		T F1 = std::numeric_limits<T>::max();
+		T F2 = std::numeric_limits<T>::max();
+		for(int Ring = 1; ; ++Ring)
+		{
+			T const RingGap = static_cast<T>(Ring - 1);
+			if(Ring > 1 && F2 <= (Distance == euclidean_distance ? RingGap * RingGap : RingGap))
+				break;
+
+			int const Side = Ring * 2 + 1;
+			int Cells = 1;
+			for(length_t i = 0; i < Length; ++i)
+				Cells *= Side;
+
+			for(length_t Pass = 0; Pass <= (Ring == 1 ? Length : 0); ++Pass)
+			for(int c = 0; c < Cells; ++c)
+			{
+				vecType<T, P> Offset;
+				int Largest = 0;
+				length_t NonZero = 0;
+				int Code = c;
+				for(length_t i = 0; i < Length; ++i, Code /= Side)
+				{
+					int const o = Code % Side - Ring;
+					Offset[i] = static_cast<T>(o);
+					Largest = max(Largest, abs(o));
+					NonZero += o != 0 ? 1 : 0;
+				}
+				if(Largest != Ring && Ring > 1)
+					continue;
+				if(Ring == 1 && NonZero != Pass)
+					continue;
+
+				// Gap between the position and the cell along each axis
+				vecType<T, P> Gap;
+				for(length_t i = 0; i < Length; ++i)
+					Gap[i] = Offset[i] > static_cast<T>(0) ? Offset[i] - Fraction[i] : Offset[i] < static_cast<T>(0) ? Fraction[i] - Offset[i] - static_cast<T>(1) : static_cast<T>(0);
+				if(detail::cellular_metric(Gap, Distance) >= F2)
+					continue;
+
+				vecType<T, P> const Feature = detail::cellular_feature(detail::mod289(Base + Offset));
+				T const d = detail::cellular_metric(Offset + Feature - Fraction, Distance);
+				F2 = min(F2, max(F1, d));
+				F1 = min(F1, d);
+			}
+		}
+
+		return Distance == euclidean_distance ? sqrt(tvec2<T, P>(F1, F2)) : tvec2<T, P>(F1, F2);
+	}
+
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER tvec2<T, P> cellular(vecType<T, P> const & Position)
+	{
+		return cellular(Position, euclidean_distance);
+	}
+
+namespace detail
+{
+	template <typename T>
+	struct compute_simplex3_soa4
+	{
+		GLM_FUNC_QUALIFIER static void call(T const * x, T const * y, T const * z, T * r)
+		{
+			for(length_t i = 0; i < 4; ++i)
+				r[i] = simplex(tvec3<T, defaultp>(x[i], y[i], z[i]));
+		}
+	};
+
+	template <typename T>
+	struct compute_perlin3_soa4
+	{
+		GLM_FUNC_QUALIFIER static void call(T const * x, T const * y, T const * z, T * r)
+		{
+			for(length_t i = 0; i < 4; ++i)
+				r[i] = perlin(tvec3<T, defaultp>(x[i], y[i], z[i]));
+		}
+	};
+
+	// Gradients in (rx, ry, rz), values in rw
+	template <typename T>
+	struct compute_simplex3_derivative_soa4
+	{
+		GLM_FUNC_QUALIFIER static void call(T const * x, T const * y, T const * z, T * rx, T * ry, T * rz, T * rw)
+		{
+			for(length_t i = 0; i < 4; ++i)
+			{
+				tvec4<T, defaultp> const r = simplexDerivative(tvec3<T, defaultp>(x[i], y[i], z[i]));
+				rx[i] = r.x;
+				ry[i] = r.y;
+				rz[i] = r.z;
+				rw[i] = r.w;
+			}
+		}
+	};
+
+	template <typename T>
+	struct compute_perlin3_derivative_soa4
+	{
+		GLM_FUNC_QUALIFIER static void call(T const * x, T const * y, T const * z, T * rx, T * ry, T * rz, T * rw)
+		{
+			for(length_t i = 0; i < 4; ++i)
+			{
+				tvec4<T, defaultp> const r = perlinDerivative(tvec3<T, defaultp>(x[i], y[i], z[i]));
+				rx[i] = r.x;
+				ry[i] = r.y;
+				rz[i] = r.z;
+				rw[i] = r.w;
+			}
+		}
+	};
+
+	template <typename T>
+	struct compute_curl3_soa4
+	{
+		GLM_FUNC_QUALIFIER static void call(T const * x, T const * y, T const * z, T * rx, T * ry, T * rz)
+		{
+			for(length_t i = 0; i < 4; ++i)
+			{
+				tvec3<T, defaultp> const r = curlNoise(tvec3<T, defaultp>(x[i], y[i], z[i]));
+				rx[i] = r.x;
+				ry[i] = r.y;
+				rz[i] = r.z;
+			}
+		}
+	};
+
+	template <typename T>
+	struct compute_cellular3_soa4
+	{
+		GLM_FUNC_QUALIFIER static void call(T const * x, T const * y, T const * z, cellular_distance Distance, T * F1, T * F2)
+		{
+			for(length_t i = 0; i < 4; ++i)
+			{
+				tvec2<T, defaultp> const r = cellular(tvec3<T, defaultp>(x[i], y[i], z[i]), Distance);
+				F1[i] = r.x;
+				F2[i] = r.y;
+			}
+		}
+	};
+
+	// Loads the positions [First, First + 4) as a structure of arrays, repeating the last position past Count
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER std::size_t noise_load_soa4(tvec3<T, P> const * Positions, std::size_t First, std::size_t Count, T * x, T * y, T * z)
+	{
+		std::size_t const n = Count - First < 4 ? Count - First : 4;
+		for(std::size_t k = 0; k < 4; ++k)
+		{
+			tvec3<T, P> const & v = Positions[First + (k < n ? k : n - 1)];
+			x[k] = v.x;
+			y[k] = v.y;
+			z[k] = v.z;
+		}
+		return n;
+	}
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void simplex(tvec3<T, P> const * Positions, T * Values, std::size_t Count)
+	{
+		T x[4], y[4], z[4], r[4];
+		for(std::size_t i = 0; i < Count; i += 4)
+		{
+			std::size_t const n = detail::noise_load_soa4(Positions, i, Count, x, y, z);
+			detail::compute_simplex3_soa4<T>::call(x, y, z, r);
+			for(std::size_t k = 0; k < n; ++k)
+				Values[i + k] = r[k];
+		}
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void perlin(tvec3<T, P> const * Positions, T * Values, std::size_t Count)
+	{
+		T x[4], y[4], z[4], r[4];
+		for(std::size_t i = 0; i < Count; i += 4)
+		{
+			std::size_t const n = detail::noise_load_soa4(Positions, i, Count, x, y, z);
+			detail::compute_perlin3_soa4<T>::call(x, y, z, r);
+			for(std::size_t k = 0; k < n; ++k)
+				Values[i + k] = r[k];
+		}
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void cellular(tvec3<T, P> const * Positions, tvec2<T, P> * Results, std::size_t Count, cellular_distance Distance)
+	{
+		T x[4], y[4], z[4], F1[4], F2[4];
+		for(std::size_t i = 0; i < Count; i += 4)
+		{
+			std::size_t const n = detail::noise_load_soa4(Positions, i, Count, x, y, z);
+			detail::compute_cellular3_soa4<T>::call(x, y, z, Distance, F1, F2);
+			for(std::size_t k = 0; k < n; ++k)
+				Results[i + k] = tvec2<T, P>(F1[k], F2[k]);
+		}
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void simplexDerivative(tvec3<T, P> const * Positions, tvec4<T, P> * Results, std::size_t Count)
+	{
+		T x[4], y[4], z[4], rx[4], ry[4], rz[4], rw[4];
+		for(std::size_t i = 0; i < Count; i += 4)
+		{
+			std::size_t const n = detail::noise_load_soa4(Positions, i, Count, x, y, z);
+			detail::compute_simplex3_derivative_soa4<T>::call(x, y, z, rx, ry, rz, rw);
+			for(std::size_t k = 0; k < n; ++k)
+				Results[i + k] = tvec4<T, P>(rx[k], ry[k], rz[k], rw[k]);
+		}
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void perlinDerivative(tvec3<T, P> const * Positions, tvec4<T, P> * Results, std::size_t Count)
+	{
+		T x[4], y[4], z[4], rx[4], ry[4], rz[4], rw[4];
+		for(std::size_t i = 0; i < Count; i += 4)
+		{
+			std::size_t const n = detail::noise_load_soa4(Positions, i, Count, x, y, z);
+			detail::compute_perlin3_derivative_soa4<T>::call(x, y, z, rx, ry, rz, rw);
+			for(std::size_t k = 0; k < n; ++k)
+				Results[i + k] = tvec4<T, P>(rx[k], ry[k], rz[k], rw[k]);
+		}
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void curlNoise(tvec3<T, P> const * Positions, tvec3<T, P> * Results, std::size_t Count)
+	{
+		T x[4], y[4], z[4], rx[4], ry[4], rz[4];
+		for(std::size_t i = 0; i < Count; i += 4)
+		{
+			std::size_t const n = detail::noise_load_soa4(Positions, i, Count, x, y, z);
+			detail::compute_curl3_soa4<T>::call(x, y, z, rx, ry, rz);
+			for(std::size_t k = 0; k < n; ++k)
+				Results[i + k] = tvec3<T, P>(rx[k], ry[k], rz[k]);
+		}
+	}
 }//namespace glm
+
+#if GLM_ARCH != GLM_ARCH_PURE
+#	include "noise_simd.inl"
+#endif
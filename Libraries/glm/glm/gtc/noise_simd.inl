@@ -0,0 +1,115 @@
+/// @ref gtc_noise
+/// @file glm/gtc/noise_simd.inl
+
+#include "../simd/noise.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	template <>
+	struct compute_simplex3_soa4<float>
+	{
+		GLM_FUNC_QUALIFIER static void call(float const * x, float const * y, float const * z, float * r)
+		{
+			glm_vec4 const Noise = glm_vec4_simplex3(
+				_mm_setr_ps(x[0], x[1], x[2], x[3]),
+				_mm_setr_ps(y[0], y[1], y[2], y[3]),
+				_mm_setr_ps(z[0], z[1], z[2], z[3]));
+			_mm_storeu_ps(r, Noise);
+		}
+	};
+
+	template <>
+	struct compute_perlin3_soa4<float>
+	{
+		GLM_FUNC_QUALIFIER static void call(float const * x, float const * y, float const * z, float * r)
+		{
+			glm_vec4 const Noise = glm_vec4_perlin3(
+				_mm_setr_ps(x[0], x[1], x[2], x[3]),
+				_mm_setr_ps(y[0], y[1], y[2], y[3]),
+				_mm_setr_ps(z[0], z[1], z[2], z[3]));
+			_mm_storeu_ps(r, Noise);
+		}
+	};
+
+	template <>
+	struct compute_cellular3_soa4<float>
+	{
+		GLM_FUNC_QUALIFIER static void call(float const * x, float const * y, float const * z, cellular_distance Distance, float * F1, float * F2)
+		{
+			glm_vec4 r1, r2;
+			glm_vec4_cellular3(
+				_mm_setr_ps(x[0], x[1], x[2], x[3]),
+				_mm_setr_ps(y[0], y[1], y[2], y[3]),
+				_mm_setr_ps(z[0], z[1], z[2], z[3]), static_cast<int>(Distance), r1, r2);
+			_mm_storeu_ps(F1, r1);
+			_mm_storeu_ps(F2, r2);
+		}
+	};
+
+	template <>
+	struct compute_simplex3_derivative_soa4<float>
+	{
+		GLM_FUNC_QUALIFIER static void call(float const * x, float const * y, float const * z, float * rx, float * ry, float * rz, float * rw)
+		{
+			glm_vec4 r[4];
+			glm_vec4_simplex3_derivative(
+				_mm_setr_ps(x[0], x[1], x[2], x[3]),
+				_mm_setr_ps(y[0], y[1], y[2], y[3]),
+				_mm_setr_ps(z[0], z[1], z[2], z[3]), r);
+			_mm_storeu_ps(rx, r[0]);
+			_mm_storeu_ps(ry, r[1]);
+			_mm_storeu_ps(rz, r[2]);
+			_mm_storeu_ps(rw, r[3]);
+		}
+	};
+
+	template <>
+	struct compute_perlin3_derivative_soa4<float>
+	{
+		GLM_FUNC_QUALIFIER static void call(float const * x, float const * y, float const * z, float * rx, float * ry, float * rz, float * rw)
+		{
+			glm_vec4 r[4];
+			glm_vec4_perlin3_derivative(
+				_mm_setr_ps(x[0], x[1], x[2], x[3]),
+				_mm_setr_ps(y[0], y[1], y[2], y[3]),
+				_mm_setr_ps(z[0], z[1], z[2], z[3]), r);
+			_mm_storeu_ps(rx, r[0]);
+			_mm_storeu_ps(ry, r[1]);
+			_mm_storeu_ps(rz, r[2]);
+			_mm_storeu_ps(rw, r[3]);
+		}
+	};
+
+	template <>
+	struct compute_curl3_soa4<float>
+	{
+		// Same potential offsets as curlNoise
+		GLM_FUNC_QUALIFIER static void call(float const * x, float const * y, float const * z, float * rx, float * ry, float * rz)
+		{
+			glm_vec4 const px = _mm_setr_ps(x[0], x[1], x[2], x[3]);
+			glm_vec4 const py = _mm_setr_ps(y[0], y[1], y[2], y[3]);
+			glm_vec4 const pz = _mm_setr_ps(z[0], z[1], z[2], z[3]);
+
+			glm_vec4 n0[4], n1[4], n2[4];
+			glm_vec4_simplex3_derivative(px, py, pz, n0);
+			glm_vec4_simplex3_derivative(
+				glm_vec4_add(px, _mm_set1_ps(31.416f)),
+				glm_vec4_add(py, _mm_set1_ps(-47.853f)),
+				glm_vec4_add(pz, _mm_set1_ps(12.793f)), n1);
+			glm_vec4_simplex3_derivative(
+				glm_vec4_add(px, _mm_set1_ps(-233.145f)),
+				glm_vec4_add(py, _mm_set1_ps(-113.408f)),
+				glm_vec4_add(pz, _mm_set1_ps(-185.31f)), n2);
+
+			_mm_storeu_ps(rx, glm_vec4_sub(n2[1], n1[2]));
+			_mm_storeu_ps(ry, glm_vec4_sub(n0[2], n2[0]));
+			_mm_storeu_ps(rz, glm_vec4_sub(n1[0], n0[1]));
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -9,12 +9,20 @@
 /// @brief This extension provides a set of function to convert vertors to packed
 /// formats.
 ///
+/// Rotations are packed with the smallest three encoding: the index of the largest component of the
+/// normalized quaternion, and the three others which magnitude is at most sqrt(1/2), quantized to an odd
+/// number of levels so that null components, and the identity, are exact.
+/// Unit vectors are packed with the octahedral encoding: the direction projected on an octahedron
+/// unfolded onto a square, quantized to the grid point which decoded direction is the closest.
+///
 /// <glm/gtc/packing.hpp> need to be included to use these features.
 
 #pragma once
 
 // Dependency:
 #include "type_precision.hpp"
+#include "quaternion.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_packing extension included")
@@ -573,6 +581,200 @@ namespace glm
 	/// @see gtc_packing
 	/// @see uint8 packUnorm2x3_1x2(vec3 const & v)
 	GLM_FUNC_DECL vec3 unpackUnorm2x3_1x2(uint8 p);
+
+	/// Packs a rotation into a 32-bit unsigned integer with the smallest three encoding:
+	/// 2 bits for the index of the largest component and 10 bits for each of the three others.
+	/// q is normalized first, a null quaternion, or one with a NaN or infinite component, being packed as the identity.
+	/// The components of the unpacked quaternion are within 0.0021 of the normalized q or -q,
+	/// the angle between the two rotations is at most 0.27 degree.
+	///
+	/// @see gtc_packing
+	/// @see quat unpackQuatSmallestThree32(uint32 p)
+	GLM_FUNC_DECL uint32 packQuatSmallestThree32(quat const & q);
+
+	/// Unpacks a normalized quaternion packed by packQuatSmallestThree32.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packQuatSmallestThree32(quat const & q)
+	GLM_FUNC_DECL quat unpackQuatSmallestThree32(uint32 p);
+
+	/// Packs a rotation into 48 bits with the smallest three encoding:
+	/// 2 bits for the index of the largest component and 15 bits for each of the three others.
+	/// The components of the unpacked quaternion are within 0.000065 of the normalized q or -q,
+	/// the angle between the two rotations is at most 0.0085 degree.
+	///
+	/// @see gtc_packing
+	/// @see quat unpackQuatSmallestThree48(u16vec3 const & p)
+	GLM_FUNC_DECL u16vec3 packQuatSmallestThree48(quat const & q);
+
+	/// Unpacks a normalized quaternion packed by packQuatSmallestThree48.
+	///
+	/// @see gtc_packing
+	/// @see u16vec3 packQuatSmallestThree48(quat const & q)
+	GLM_FUNC_DECL quat unpackQuatSmallestThree48(u16vec3 const & p);
+
+	/// Packs a rotation into a 64-bit unsigned integer with the smallest three encoding:
+	/// 2 bits for the index of the largest component and 20 bits for each of the three others.
+	/// The components of the unpacked quaternion are within 0.000003 of the normalized q or -q,
+	/// the angle between the two rotations is at most 0.0003 degree.
+	///
+	/// @see gtc_packing
+	/// @see quat unpackQuatSmallestThree64(uint64 p)
+	GLM_FUNC_DECL uint64 packQuatSmallestThree64(quat const & q);
+
+	/// Unpacks a normalized quaternion packed by packQuatSmallestThree64.
+	///
+	/// @see gtc_packing
+	/// @see uint64 packQuatSmallestThree64(quat const & q)
+	GLM_FUNC_DECL quat unpackQuatSmallestThree64(uint64 p);
+
+	/// Packs Count rotations with packQuatSmallestThree32, four at a time with SIMD instructions.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packQuatSmallestThree32(quat const & q)
+	GLM_FUNC_DECL void packQuatSmallestThree32(
+		quat const * Quats,
+		uint32 * Packed,
+		std::size_t Count);
+
+	/// Unpacks Count rotations packed with packQuatSmallestThree32, four at a time with SIMD instructions.
+	///
+	/// @see gtc_packing
+	/// @see quat unpackQuatSmallestThree32(uint32 p)
+	GLM_FUNC_DECL void unpackQuatSmallestThree32(
+		uint32 const * Packed,
+		quat * Quats,
+		std::size_t Count);
+
+	/// Packs Count rotations with packQuatSmallestThree48, four at a time with SIMD instructions.
+	///
+	/// @see gtc_packing
+	/// @see u16vec3 packQuatSmallestThree48(quat const & q)
+	GLM_FUNC_DECL void packQuatSmallestThree48(
+		quat const * Quats,
+		u16vec3 * Packed,
+		std::size_t Count);
+
+	/// Unpacks Count rotations packed with packQuatSmallestThree48, four at a time with SIMD instructions.
+	///
+	/// @see gtc_packing
+	/// @see quat unpackQuatSmallestThree48(u16vec3 const & p)
+	GLM_FUNC_DECL void unpackQuatSmallestThree48(
+		u16vec3 const * Packed,
+		quat * Quats,
+		std::size_t Count);
+
+	/// Packs Count rotations with packQuatSmallestThree64, four at a time with SIMD instructions.
+	///
+	/// @see gtc_packing
+	/// @see uint64 packQuatSmallestThree64(quat const & q)
+	GLM_FUNC_DECL void packQuatSmallestThree64(
+		quat const * Quats,
+		uint64 * Packed,
+		std::size_t Count);
+
+	/// Unpacks Count rotations packed with packQuatSmallestThree64, four at a time with SIMD instructions.
+	///
+	/// @see gtc_packing
+	/// @see quat unpackQuatSmallestThree64(uint64 p)
+	GLM_FUNC_DECL void unpackQuatSmallestThree64(
+		uint64 const * Packed,
+		quat * Quats,
+		std::size_t Count);
+
+	/// Packs a unit vector into a 16-bit unsigned integer with the octahedral encoding, 8 bits per coordinate.
+	/// v is normalized first, a null vector, or one with a NaN or infinite component, being packed as (0, 0, 1).
+	/// The angle between v and the unpacked vector is at most 0.65 degree, 0.32 degree on average.
+	///
+	/// @see gtc_packing
+	/// @see vec3 unpackOctahedral2x8(uint16 p)
+	GLM_FUNC_DECL uint16 packOctahedral2x8(vec3 const & v);
+
+	/// Unpacks a unit vector packed by packOctahedral2x8.
+	///
+	/// @see gtc_packing
+	/// @see uint16 packOctahedral2x8(vec3 const & v)
+	GLM_FUNC_DECL vec3 unpackOctahedral2x8(uint16 p);
+
+	/// Packs a unit vector into the 24 least significant bits of a 32-bit unsigned integer with the octahedral encoding,
+	/// 12 bits per coordinate. The angle between v and the unpacked vector is at most 0.053 degree, 0.020 degree on average.
+	///
+	/// @see gtc_packing
+	/// @see vec3 unpackOctahedral2x12(uint32 p)
+	GLM_FUNC_DECL uint32 packOctahedral2x12(vec3 const & v);
+
+	/// Unpacks a unit vector packed by packOctahedral2x12.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packOctahedral2x12(vec3 const & v)
+	GLM_FUNC_DECL vec3 unpackOctahedral2x12(uint32 p);
+
+	/// Packs a unit vector into a 32-bit unsigned integer with the octahedral encoding, 16 bits per coordinate.
+	/// The angle between v and the unpacked vector is at most 0.008 degree, 0.0026 degree on average.
+	///
+	/// @see gtc_packing
+	/// @see vec3 unpackOctahedral2x16(uint32 p)
+	GLM_FUNC_DECL uint32 packOctahedral2x16(vec3 const & v);
+
+	/// Unpacks a unit vector packed by packOctahedral2x16.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packOctahedral2x16(vec3 const & v)
+	GLM_FUNC_DECL vec3 unpackOctahedral2x16(uint32 p);
+
+	/// Packs Count unit vectors with packOctahedral2x8, four at a time with SIMD instructions.
+	///
+	/// @see gtc_packing
+	/// @see uint16 packOctahedral2x8(vec3 const & v)
+	GLM_FUNC_DECL void packOctahedral2x8(
+		vec3 const * Directions,
+		uint16 * Packed,
+		std::size_t Count);
+
+	/// Unpacks Count unit vectors packed with packOctahedral2x8, four at a time with SIMD instructions.
+	///
+	/// @see gtc_packing
+	/// @see vec3 unpackOctahedral2x8(uint16 p)
+	GLM_FUNC_DECL void unpackOctahedral2x8(
+		uint16 const * Packed,
+		vec3 * Directions,
+		std::size_t Count);
+
+	/// Packs Count unit vectors with packOctahedral2x12, four at a time with SIMD instructions.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packOctahedral2x12(vec3 const & v)
+	GLM_FUNC_DECL void packOctahedral2x12(
+		vec3 const * Directions,
+		uint32 * Packed,
+		std::size_t Count);
+
+	/// Unpacks Count unit vectors packed with packOctahedral2x12, four at a time with SIMD instructions.
+	///
+	/// @see gtc_packing
+	/// @see vec3 unpackOctahedral2x12(uint32 p)
+	GLM_FUNC_DECL void unpackOctahedral2x12(
+		uint32 const * Packed,
+		vec3 * Directions,
+		std::size_t Count);
+
+	/// Packs Count unit vectors with packOctahedral2x16, four at a time with SIMD instructions.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packOctahedral2x16(vec3 const & v)
+	GLM_FUNC_DECL void packOctahedral2x16(
+		vec3 const * Directions,
+		uint32 * Packed,
+		std::size_t Count);
+
+	/// Unpacks Count unit vectors packed with packOctahedral2x16, four at a time with SIMD instructions.
+	///
+	/// @see gtc_packing
+	/// @see vec3 unpackOctahedral2x16(uint32 p)
+	GLM_FUNC_DECL void unpackOctahedral2x16(
+		uint32 const * Packed,
+		vec3 * Directions,
+		std::size_t Count);
 	/// @}
 }// namespace glm
 
@@ -2,6 +2,7 @@
 /// @file glm/gtc/packing.inl
 
 #include "../common.hpp"
+#include "../exponential.hpp"
 #include "../vec2.hpp"
 #include "../vec3.hpp"
 #include "../vec4.hpp"
@@ -777,5 +778,539 @@ namespace detail
 		Unpack.pack = v;
 		return vec3(Unpack.data.x, Unpack.data.y, Unpack.data.z) * ScaleFactor;
 	}
+
+namespace detail
+{
+	// Smallest three encoding of a quaternion: returns the index of the largest component of the normalized q,
+	// the three other components being quantized to Max + 1 levels in c, Max being even so that 0 is exact. q is negated when its largest
+	// component is negative, q and -q being the same rotation.
+	GLM_FUNC_QUALIFIER uint32 packQuatSmallestThree(quat const & q, float Max, uint32 c[3])
+	{
+		// Null quaternions, and those with a NaN or infinite component, are packed as the identity
+		float v[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+		float const Length = sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+		if(Length > 0.0f && Length <= std::numeric_limits<float>::max())
+		{
+			v[0] = q.x / Length;
+			v[1] = q.y / Length;
+			v[2] = q.z / Length;
+			v[3] = q.w / Length;
+		}
+
+		uint32 Index = 0;
+		for(uint32 i = 1; i < 4; ++i)
+			if(abs(v[i]) > abs(v[Index]))
+				Index = i;
+
+		// Maps [-sqrt(1/2), sqrt(1/2)] to [0, 1]
+		float const Scale = v[Index] < 0.0f ? -0.707106781186547524f : 0.707106781186547524f;
+		for(uint32 i = 0, j = 0; i < 4; ++i)
+		{
+			if(i == Index)
+				continue;
+			float const t = clamp(v[i] * Scale + 0.5f, 0.0f, 1.0f);
+			c[j++] = static_cast<uint32>(t * Max + 0.5f);
+		}
+		return Index;
+	}
+
+	GLM_FUNC_QUALIFIER quat unpackQuatSmallestThree(uint32 Index, uint32 const c[3], float Max)
+	{
+		float const Scale = 1.41421356237309505f / Max;
+		float const Half = Max * 0.5f;
+		float const Smallest[3] = {
+			(static_cast<float>(c[0]) - Half) * Scale,
+			(static_cast<float>(c[1]) - Half) * Scale,
+			(static_cast<float>(c[2]) - Half) * Scale};
+		float const Largest = sqrt(max(1.0f - Smallest[0] * Smallest[0] - Smallest[1] * Smallest[1] - Smallest[2] * Smallest[2], 0.0f));
+
+		float v[4];
+		for(uint32 i = 0, j = 0; i < 4; ++i)
+			v[i] = i == Index ? Largest : Smallest[j++];
+		return quat(v[3], v[0], v[1], v[2]);
+	}
+
+	// Bit layouts of the smallest three encodings: the index in the most significant bits, then the three components
+	struct quat_smallest_three32
+	{
+		typedef uint32 type;
+
+		GLM_FUNC_QUALIFIER static float max()
+		{
+			return 1022.0f;
+		}
+
+		GLM_FUNC_QUALIFIER static type pack(uint32 Index, uint32 const c[3])
+		{
+			return (Index << 30) | (c[0] << 20) | (c[1] << 10) | c[2];
+		}
+
+		GLM_FUNC_QUALIFIER static uint32 unpack(type p, uint32 c[3])
+		{
+			c[0] = (p >> 20) & 0x3ff;
+			c[1] = (p >> 10) & 0x3ff;
+			c[2] = p & 0x3ff;
+			return p >> 30;
+		}
+	};
+
+	struct quat_smallest_three48
+	{
+		typedef u16vec3 type;
+
+		GLM_FUNC_QUALIFIER static float max()
+		{
+			return 32766.0f;
+		}
+
+		GLM_FUNC_QUALIFIER static type pack(uint32 Index, uint32 const c[3])
+		{
+			uint64 const p = (static_cast<uint64>(Index) << 45) | (static_cast<uint64>(c[0]) << 30) | (static_cast<uint64>(c[1]) << 15) | static_cast<uint64>(c[2]);
+			return type(static_cast<uint16>(p), static_cast<uint16>(p >> 16), static_cast<uint16>(p >> 32));
+		}
+
+		GLM_FUNC_QUALIFIER static uint32 unpack(type const & v, uint32 c[3])
+		{
+			uint64 const p = static_cast<uint64>(v.x) | (static_cast<uint64>(v.y) << 16) | (static_cast<uint64>(v.z) << 32);
+			c[0] = static_cast<uint32>(p >> 30) & 0x7fff;
+			c[1] = static_cast<uint32>(p >> 15) & 0x7fff;
+			c[2] = static_cast<uint32>(p) & 0x7fff;
+			return static_cast<uint32>(p >> 45) & 0x3;
+		}
+	};
+
+	struct quat_smallest_three64
+	{
+		typedef uint64 type;
+
+		GLM_FUNC_QUALIFIER static float max()
+		{
+			return 1048574.0f;
+		}
+
+		GLM_FUNC_QUALIFIER static type pack(uint32 Index, uint32 const c[3])
+		{
+			return (static_cast<uint64>(Index) << 60) | (static_cast<uint64>(c[0]) << 40) | (static_cast<uint64>(c[1]) << 20) | static_cast<uint64>(c[2]);
+		}
+
+		GLM_FUNC_QUALIFIER static uint32 unpack(type p, uint32 c[3])
+		{
+			c[0] = static_cast<uint32>(p >> 40) & 0xfffff;
+			c[1] = static_cast<uint32>(p >> 20) & 0xfffff;
+			c[2] = static_cast<uint32>(p) & 0xfffff;
+			return static_cast<uint32>(p >> 60) & 0x3;
+		}
+	};
+
+	// Unit vector decoded from octahedral coordinates in [-1, 1]^2, the corners of the square folding onto the -z hemisphere
+	GLM_FUNC_QUALIFIER vec3 octahedralDecode(float x, float y)
+	{
+		float const z = 1.0f - abs(x) - abs(y);
+		if(z < 0.0f)
+		{
+			float const Fold = x;
+			x = (1.0f - abs(y)) * (Fold >= 0.0f ? 1.0f : -1.0f);
+			y = (1.0f - abs(Fold)) * (y >= 0.0f ? 1.0f : -1.0f);
+		}
+		float const Length = sqrt(x * x + y * y + z * z);
+		return vec3(x / Length, y / Length, z / Length);
+	}
+
+	// Octahedral encoding of a direction: the coordinates in [-Max, Max], among the four grid points around
+	// the projection of v, which decoded direction has the largest dot product with v.
+	// Null vectors, and those with a NaN or infinite component, are packed as (0, 0, 1).
+	GLM_FUNC_QUALIFIER void packOctahedral(vec3 const & v, float Max, int & x, int & y)
+	{
+		float px = 0.0f;
+		float py = 0.0f;
+		float const Sum = abs(v.x) + abs(v.y) + abs(v.z);
+		bool const Valid = Sum > 0.0f && Sum <= std::numeric_limits<float>::max();
+		vec3 const u = Valid ? v : vec3(0.0f, 0.0f, 1.0f);
+		if(Valid)
+		{
+			px = v.x / Sum;
+			py = v.y / Sum;
+			if(v.z < 0.0f)
+			{
+				float const Fold = px;
+				px = (1.0f - abs(py)) * (Fold >= 0.0f ? 1.0f : -1.0f);
+				py = (1.0f - abs(Fold)) * (py >= 0.0f ? 1.0f : -1.0f);
+			}
+		}
+
+		float const InvMax = 1.0f / Max;
+		float const x0 = floor(px * Max);
+		float const y0 = floor(py * Max);
+		float Best = -std::numeric_limits<float>::max();
+		for(int i = 0; i < 4; ++i)
+		{
+			float const cx = min(x0 + static_cast<float>(i & 1), Max);
+			float const cy = min(y0 + static_cast<float>(i >> 1), Max);
+			vec3 const n = octahedralDecode(cx * InvMax, cy * InvMax);
+			float const Dot = n.x * u.x + n.y * u.y + n.z * u.z;
+			if(i == 0 || Dot > Best)
+			{
+				Best = Dot;
+				x = static_cast<int>(cx);
+				y = static_cast<int>(cy);
+			}
+		}
+	}
+
+	// Bit layouts of the octahedral encodings: x + Max in the least significant bits, then y + Max
+	struct octahedral2x8
+	{
+		typedef uint16 type;
+
+		GLM_FUNC_QUALIFIER static float max()
+		{
+			return 127.0f;
+		}
+
+		GLM_FUNC_QUALIFIER static type pack(int x, int y)
+		{
+			return static_cast<type>((x + 127) | ((y + 127) << 8));
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(type p, int & x, int & y)
+		{
+			x = static_cast<int>(p & 0xff) - 127;
+			y = static_cast<int>(p >> 8) - 127;
+		}
+	};
+
+	struct octahedral2x12
+	{
+		typedef uint32 type;
+
+		GLM_FUNC_QUALIFIER static float max()
+		{
+			return 2047.0f;
+		}
+
+		GLM_FUNC_QUALIFIER static type pack(int x, int y)
+		{
+			return static_cast<type>(x + 2047) | (static_cast<type>(y + 2047) << 12);
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(type p, int & x, int & y)
+		{
+			x = static_cast<int>(p & 0xfff) - 2047;
+			y = static_cast<int>((p >> 12) & 0xfff) - 2047;
+		}
+	};
+
+	struct octahedral2x16
+	{
+		typedef uint32 type;
+
+		GLM_FUNC_QUALIFIER static float max()
+		{
+			return 32767.0f;
+		}
+
+		GLM_FUNC_QUALIFIER static type pack(int x, int y)
+		{
+			return static_cast<type>(x + 32767) | (static_cast<type>(y + 32767) << 16);
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(type p, int & x, int & y)
+		{
+			x = static_cast<int>(p & 0xffff) - 32767;
+			y = static_cast<int>(p >> 16) - 32767;
+		}
+	};
+
+	template <typename T>
+	struct compute_quat_smallest_three_soa4
+	{
+		GLM_FUNC_QUALIFIER static void pack(T const * x, T const * y, T const * z, T const * w, T Max, uint32 * Index, uint32 * c0, uint32 * c1, uint32 * c2)
+		{
+			for(length_t i = 0; i < 4; ++i)
+			{
+				uint32 c[3];
+				Index[i] = packQuatSmallestThree(quat(w[i], x[i], y[i], z[i]), Max, c);
+				c0[i] = c[0];
+				c1[i] = c[1];
+				c2[i] = c[2];
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(uint32 const * Index, uint32 const * c0, uint32 const * c1, uint32 const * c2, T Max, T * x, T * y, T * z, T * w)
+		{
+			for(length_t i = 0; i < 4; ++i)
+			{
+				uint32 const c[3] = {c0[i], c1[i], c2[i]};
+				quat const q = unpackQuatSmallestThree(Index[i], c, Max);
+				x[i] = q.x;
+				y[i] = q.y;
+				z[i] = q.z;
+				w[i] = q.w;
+			}
+		}
+	};
+
+	template <typename T>
+	struct compute_octahedral_soa4
+	{
+		GLM_FUNC_QUALIFIER static void pack(T const * x, T const * y, T const * z, T Max, int * ox, int * oy)
+		{
+			for(length_t i = 0; i < 4; ++i)
+				packOctahedral(vec3(x[i], y[i], z[i]), Max, ox[i], oy[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(int const * ox, int const * oy, T Max, T * x, T * y, T * z)
+		{
+			T const InvMax = static_cast<T>(1) / Max;
+			for(length_t i = 0; i < 4; ++i)
+			{
+				vec3 const v = octahedralDecode(static_cast<T>(ox[i]) * InvMax, static_cast<T>(oy[i]) * InvMax);
+				x[i] = v.x;
+				y[i] = v.y;
+				z[i] = v.z;
+			}
+		}
+	};
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER uint32 packQuatSmallestThree32(quat const & q)
+	{
+		uint32 c[3];
+		uint32 const Index = detail::packQuatSmallestThree(q, detail::quat_smallest_three32::max(), c);
+		return detail::quat_smallest_three32::pack(Index, c);
+	}
+
+	GLM_FUNC_QUALIFIER quat unpackQuatSmallestThree32(uint32 p)
+	{
+		uint32 c[3];
+		uint32 const Index = detail::quat_smallest_three32::unpack(p, c);
+		return detail::unpackQuatSmallestThree(Index, c, detail::quat_smallest_three32::max());
+	}
+
+	GLM_FUNC_QUALIFIER u16vec3 packQuatSmallestThree48(quat const & q)
+	{
+		uint32 c[3];
+		uint32 const Index = detail::packQuatSmallestThree(q, detail::quat_smallest_three48::max(), c);
+		return detail::quat_smallest_three48::pack(Index, c);
+	}
+
+	GLM_FUNC_QUALIFIER quat unpackQuatSmallestThree48(u16vec3 const & p)
+	{
+		uint32 c[3];
+		uint32 const Index = detail::quat_smallest_three48::unpack(p, c);
+		return detail::unpackQuatSmallestThree(Index, c, detail::quat_smallest_three48::max());
+	}
+
+	GLM_FUNC_QUALIFIER uint64 packQuatSmallestThree64(quat const & q)
+	{
+		uint32 c[3];
+		uint32 const Index = detail::packQuatSmallestThree(q, detail::quat_smallest_three64::max(), c);
+		return detail::quat_smallest_three64::pack(Index, c);
+	}
+
+	GLM_FUNC_QUALIFIER quat unpackQuatSmallestThree64(uint64 p)
+	{
+		uint32 c[3];
+		uint32 const Index = detail::quat_smallest_three64::unpack(p, c);
+		return detail::unpackQuatSmallestThree(Index, c, detail::quat_smallest_three64::max());
+	}
+
+	GLM_FUNC_QUALIFIER uint16 packOctahedral2x8(vec3 const & v)
+	{
+		int x, y;
+		detail::packOctahedral(v, detail::octahedral2x8::max(), x, y);
+		return detail::octahedral2x8::pack(x, y);
+	}
+
+	GLM_FUNC_QUALIFIER vec3 unpackOctahedral2x8(uint16 p)
+	{
+		int x, y;
+		detail::octahedral2x8::unpack(p, x, y);
+		float const InvMax = 1.0f / detail::octahedral2x8::max();
+		return detail::octahedralDecode(static_cast<float>(x) * InvMax, static_cast<float>(y) * InvMax);
+	}
+
+	GLM_FUNC_QUALIFIER uint32 packOctahedral2x12(vec3 const & v)
+	{
+		int x, y;
+		detail::packOctahedral(v, detail::octahedral2x12::max(), x, y);
+		return detail::octahedral2x12::pack(x, y);
+	}
+
+	GLM_FUNC_QUALIFIER vec3 unpackOctahedral2x12(uint32 p)
+	{
+		int x, y;
+		detail::octahedral2x12::unpack(p, x, y);
+		float const InvMax = 1.0f / detail::octahedral2x12::max();
+		return detail::octahedralDecode(static_cast<float>(x) * InvMax, static_cast<float>(y) * InvMax);
+	}
+
+	GLM_FUNC_QUALIFIER uint32 packOctahedral2x16(vec3 const & v)
+	{
+		int x, y;
+		detail::packOctahedral(v, detail::octahedral2x16::max(), x, y);
+		return detail::octahedral2x16::pack(x, y);
+	}
+
+	GLM_FUNC_QUALIFIER vec3 unpackOctahedral2x16(uint32 p)
+	{
+		int x, y;
+		detail::octahedral2x16::unpack(p, x, y);
+		float const InvMax = 1.0f / detail::octahedral2x16::max();
+		return detail::octahedralDecode(static_cast<float>(x) * InvMax, static_cast<float>(y) * InvMax);
+	}
 }//namespace glm
 
+#if GLM_ARCH != GLM_ARCH_PURE
+#	include "packing_simd.inl"
+#endif
+
+// The batches use compute_*_soa4<float> which SIMD specializations are declared by packing_simd.inl
+namespace glm{
+namespace detail
+{
+	// Batches are processed four elements at a time, the last element being repeated past Count
+	template <typename format>
+	GLM_FUNC_QUALIFIER void packQuatsSmallestThree(quat const * Quats, typename format::type * Packed, std::size_t Count)
+	{
+		float x[4], y[4], z[4], w[4];
+		uint32 Index[4], c[3][4];
+		for(std::size_t i = 0; i < Count; i += 4)
+		{
+			std::size_t const n = Count - i < 4 ? Count - i : 4;
+			for(std::size_t k = 0; k < 4; ++k)
+			{
+				quat const & q = Quats[i + (k < n ? k : n - 1)];
+				x[k] = q.x;
+				y[k] = q.y;
+				z[k] = q.z;
+				w[k] = q.w;
+			}
+			compute_quat_smallest_three_soa4<float>::pack(x, y, z, w, format::max(), Index, c[0], c[1], c[2]);
+			for(std::size_t k = 0; k < n; ++k)
+			{
+				uint32 const Components[3] = {c[0][k], c[1][k], c[2][k]};
+				Packed[i + k] = format::pack(Index[k], Components);
+			}
+		}
+	}
+
+	template <typename format>
+	GLM_FUNC_QUALIFIER void unpackQuatsSmallestThree(typename format::type const * Packed, quat * Quats, std::size_t Count)
+	{
+		float x[4], y[4], z[4], w[4];
+		uint32 Index[4], c[3][4];
+		for(std::size_t i = 0; i < Count; i += 4)
+		{
+			std::size_t const n = Count - i < 4 ? Count - i : 4;
+			for(std::size_t k = 0; k < 4; ++k)
+			{
+				uint32 Components[3];
+				Index[k] = format::unpack(Packed[i + (k < n ? k : n - 1)], Components);
+				c[0][k] = Components[0];
+				c[1][k] = Components[1];
+				c[2][k] = Components[2];
+			}
+			compute_quat_smallest_three_soa4<float>::unpack(Index, c[0], c[1], c[2], format::max(), x, y, z, w);
+			for(std::size_t k = 0; k < n; ++k)
+				Quats[i + k] = quat(w[k], x[k], y[k], z[k]);
+		}
+	}
+
+	template <typename format>
+	GLM_FUNC_QUALIFIER void packOctahedrals(vec3 const * Directions, typename format::type * Packed, std::size_t Count)
+	{
+		float x[4], y[4], z[4];
+		int ox[4], oy[4];
+		for(std::size_t i = 0; i < Count; i += 4)
+		{
+			std::size_t const n = Count - i < 4 ? Count - i : 4;
+			for(std::size_t k = 0; k < 4; ++k)
+			{
+				vec3 const & v = Directions[i + (k < n ? k : n - 1)];
+				x[k] = v.x;
+				y[k] = v.y;
+				z[k] = v.z;
+			}
+			compute_octahedral_soa4<float>::pack(x, y, z, format::max(), ox, oy);
+			for(std::size_t k = 0; k < n; ++k)
+				Packed[i + k] = format::pack(ox[k], oy[k]);
+		}
+	}
+
+	template <typename format>
+	GLM_FUNC_QUALIFIER void unpackOctahedrals(typename format::type const * Packed, vec3 * Directions, std::size_t Count)
+	{
+		float x[4], y[4], z[4];
+		int ox[4], oy[4];
+		for(std::size_t i = 0; i < Count; i += 4)
+		{
+			std::size_t const n = Count - i < 4 ? Count - i : 4;
+			for(std::size_t k = 0; k < 4; ++k)
+				format::unpack(Packed[i + (k < n ? k : n - 1)], ox[k], oy[k]);
+			compute_octahedral_soa4<float>::unpack(ox, oy, format::max(), x, y, z);
+			for(std::size_t k = 0; k < n; ++k)
+				Directions[i + k] = vec3(x[k], y[k], z[k]);
+		}
+	}
+}//namespace detail
+	GLM_FUNC_QUALIFIER void packQuatSmallestThree32(quat const * Quats, uint32 * Packed, std::size_t Count)
+	{
+		detail::packQuatsSmallestThree<detail::quat_smallest_three32>(Quats, Packed, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackQuatSmallestThree32(uint32 const * Packed, quat * Quats, std::size_t Count)
+	{
+		detail::unpackQuatsSmallestThree<detail::quat_smallest_three32>(Packed, Quats, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packQuatSmallestThree48(quat const * Quats, u16vec3 * Packed, std::size_t Count)
+	{
+		detail::packQuatsSmallestThree<detail::quat_smallest_three48>(Quats, Packed, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackQuatSmallestThree48(u16vec3 const * Packed, quat * Quats, std::size_t Count)
+	{
+		detail::unpackQuatsSmallestThree<detail::quat_smallest_three48>(Packed, Quats, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packQuatSmallestThree64(quat const * Quats, uint64 * Packed, std::size_t Count)
+	{
+		detail::packQuatsSmallestThree<detail::quat_smallest_three64>(Quats, Packed, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackQuatSmallestThree64(uint64 const * Packed, quat * Quats, std::size_t Count)
+	{
+		detail::unpackQuatsSmallestThree<detail::quat_smallest_three64>(Packed, Quats, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packOctahedral2x8(vec3 const * Directions, uint16 * Packed, std::size_t Count)
+	{
+		detail::packOctahedrals<detail::octahedral2x8>(Directions, Packed, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackOctahedral2x8(uint16 const * Packed, vec3 * Directions, std::size_t Count)
+	{
+		detail::unpackOctahedrals<detail::octahedral2x8>(Packed, Directions, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packOctahedral2x12(vec3 const * Directions, uint32 * Packed, std::size_t Count)
+	{
+		detail::packOctahedrals<detail::octahedral2x12>(Directions, Packed, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackOctahedral2x12(uint32 const * Packed, vec3 * Directions, std::size_t Count)
+	{
+		detail::unpackOctahedrals<detail::octahedral2x12>(Packed, Directions, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packOctahedral2x16(vec3 const * Directions, uint32 * Packed, std::size_t Count)
+	{
+		detail::packOctahedrals<detail::octahedral2x16>(Directions, Packed, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackOctahedral2x16(uint32 const * Packed, vec3 * Directions, std::size_t Count)
+	{
+		detail::unpackOctahedrals<detail::octahedral2x16>(Packed, Directions, Count);
+	}
+}//namespace glm
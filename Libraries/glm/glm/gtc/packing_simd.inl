@@ -0,0 +1,65 @@
+/// @ref gtc_packing
+/// @file glm/gtc/packing_simd.inl
+
+#include "../simd/packing.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	template <>
+	struct compute_quat_smallest_three_soa4<float>
+	{
+		GLM_FUNC_QUALIFIER static void pack(float const * x, float const * y, float const * z, float const * w, float Max, uint32 * Index, uint32 * c0, uint32 * c1, uint32 * c2)
+		{
+			glm_uvec4 i, c[3];
+			glm_vec4_quat_smallest_three(_mm_loadu_ps(x), _mm_loadu_ps(y), _mm_loadu_ps(z), _mm_loadu_ps(w), Max, i, c);
+			_mm_storeu_si128(reinterpret_cast<glm_uvec4*>(Index), i);
+			_mm_storeu_si128(reinterpret_cast<glm_uvec4*>(c0), c[0]);
+			_mm_storeu_si128(reinterpret_cast<glm_uvec4*>(c1), c[1]);
+			_mm_storeu_si128(reinterpret_cast<glm_uvec4*>(c2), c[2]);
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(uint32 const * Index, uint32 const * c0, uint32 const * c1, uint32 const * c2, float Max, float * x, float * y, float * z, float * w)
+		{
+			glm_uvec4 const c[3] = {
+				_mm_loadu_si128(reinterpret_cast<glm_uvec4 const*>(c0)),
+				_mm_loadu_si128(reinterpret_cast<glm_uvec4 const*>(c1)),
+				_mm_loadu_si128(reinterpret_cast<glm_uvec4 const*>(c2))};
+			glm_vec4 q[4];
+			glm_vec4_quat_from_smallest_three(_mm_loadu_si128(reinterpret_cast<glm_uvec4 const*>(Index)), c, Max, q);
+			_mm_storeu_ps(x, q[0]);
+			_mm_storeu_ps(y, q[1]);
+			_mm_storeu_ps(z, q[2]);
+			_mm_storeu_ps(w, q[3]);
+		}
+	};
+
+	template <>
+	struct compute_octahedral_soa4<float>
+	{
+		GLM_FUNC_QUALIFIER static void pack(float const * x, float const * y, float const * z, float Max, int * ox, int * oy)
+		{
+			glm_ivec4 rx, ry;
+			glm_vec4_octahedral(_mm_loadu_ps(x), _mm_loadu_ps(y), _mm_loadu_ps(z), Max, rx, ry);
+			_mm_storeu_si128(reinterpret_cast<glm_ivec4*>(ox), rx);
+			_mm_storeu_si128(reinterpret_cast<glm_ivec4*>(oy), ry);
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(int const * ox, int const * oy, float Max, float * x, float * y, float * z)
+		{
+			glm_vec4 const InvMax = _mm_set1_ps(1.0f / Max);
+			glm_vec4 n[3];
+			glm_vec4_octahedral_decode(
+				glm_vec4_mul(_mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<glm_ivec4 const*>(ox))), InvMax),
+				glm_vec4_mul(_mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<glm_ivec4 const*>(oy))), InvMax), n);
+			_mm_storeu_ps(x, n[0]);
+			_mm_storeu_ps(y, n[1]);
+			_mm_storeu_ps(z, n[2]);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -163,13 +163,14 @@ namespace detail
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tquat<T, P>::tquat(tvec3<T, P> const & eulerAngle)
 	{
-		tvec3<T, P> c = glm::cos(eulerAngle * T(0.5));
-		tvec3<T, P> s = glm::sin(eulerAngle * T(0.5));
-		
-		this->w = c.x * c.y * c.z + s.x * s.y * s.z;
-		this->x = s.x * c.y * c.z - c.x * s.y * s.z;
-		this->y = c.x * s.y * c.z + s.x * c.y * s.z;
-		this->z = c.x * c.y * s.z - s.x * s.y * c.z;
+		T const a[4] = {eulerAngle.x * T(0.5), eulerAngle.y * T(0.5), eulerAngle.z * T(0.5), T(0)};
+		T s[4], c[4];
+		detail::compute_sincos4<T>::call(a, s, c);
+
+		this->w = c[0] * c[1] * c[2] + s[0] * s[1] * s[2];
+		this->x = s[0] * c[1] * c[2] - c[0] * s[1] * s[2];
+		this->y = c[0] * s[1] * c[2] + s[0] * c[1] * s[2];
+		this->z = c[0] * c[1] * s[2] - s[0] * s[1] * c[2];
 	}
 
 	template <typename T, precision P>
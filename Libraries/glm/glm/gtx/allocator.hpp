@@ -0,0 +1,199 @@
+/// @ref gtx_allocator
+/// @file glm/gtx/allocator.hpp
+///
+/// @see core (dependence)
+/// @see gtc_type_aligned (dependence)
+///
+/// @defgroup gtx_allocator GLM_GTX_allocator
+/// @ingroup gtx
+///
+/// @brief Standard allocators honouring the alignment of glm types, frame arenas and thread local scratch memory.
+///
+/// Before C++17, std::allocator ignores alignments above the one of malloc, so containers of aligned types or
+/// of arrays processed with 32 bytes AVX loads need aligned_allocator. Temporary arrays rebuilt every frame can
+/// instead be allocated from a frame_arena through arena_allocator: allocation is a pointer increment, nothing
+/// is freed until the arena is reset, and reset merges the chunks of a frame into one so that the following
+/// frames don't touch the heap. Each thread also owns a scratch arena, rewound by scratch_scope.
+///
+/// <glm/gtx/allocator.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/type_aligned.hpp"
+#include <cstddef>
+#include <vector>
+
+#if !GLM_HAS_ALIGNOF || !GLM_HAS_CXX11_STL || ((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_COMPILER < GLM_COMPILER_VC14))
+#	error "GLM_GTX_allocator requires C++11 support of alignof and thread_local"
+#endif
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_allocator extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_allocator
+	/// @{
+
+	/// Allocates Size bytes aligned on Alignment, a power of two, return a null pointer on failure.
+	/// @see gtx_allocator
+	GLM_FUNC_DECL void * alignedMalloc(std::size_t Size, std::size_t Alignment);
+
+	/// Frees memory of alignedMalloc, does nothing for a null pointer.
+	/// @see gtx_allocator
+	GLM_FUNC_DECL void alignedFree(void * Pointer);
+
+	/// Standard allocator aligning elements on the largest of Alignment and alignof(T).
+	/// @see gtx_allocator
+	template <typename T, std::size_t Alignment = 0>
+	class aligned_allocator
+	{
+	public:
+		typedef T value_type;
+
+		static std::size_t const alignment = Alignment > alignof(T) ? Alignment : alignof(T);
+
+		template <typename U>
+		struct rebind
+		{
+			typedef aligned_allocator<U, Alignment> other;
+		};
+
+		GLM_FUNC_DECL aligned_allocator();
+		template <typename U>
+		GLM_FUNC_DECL aligned_allocator(aligned_allocator<U, Alignment> const & Allocator);
+
+		/// Throws std::bad_alloc on failure
+		GLM_FUNC_DECL T * allocate(std::size_t Count);
+		GLM_FUNC_DECL void deallocate(T * Pointer, std::size_t Count);
+	};
+
+	template <typename T, typename U, std::size_t Alignment>
+	GLM_FUNC_DECL bool operator==(aligned_allocator<T, Alignment> const & a, aligned_allocator<U, Alignment> const & b);
+	template <typename T, typename U, std::size_t Alignment>
+	GLM_FUNC_DECL bool operator!=(aligned_allocator<T, Alignment> const & a, aligned_allocator<U, Alignment> const & b);
+
+	/// Position in a frame_arena, see frame_arena::mark.
+	/// @see gtx_allocator
+	struct arena_mark
+	{
+		std::size_t Chunk;
+		std::size_t Offset;
+		std::size_t Used;
+	};
+
+	/// Monotonic allocator over a list of chunks: memory is only reclaimed all at once by reset or rewind.
+	/// @see gtx_allocator
+	class frame_arena
+	{
+	public:
+		/// Chunks are at least ChunkSize bytes, the first one is allocated by the first allocation.
+		GLM_FUNC_DECL explicit frame_arena(std::size_t ChunkSize = 65536);
+		GLM_FUNC_DECL ~frame_arena();
+
+		/// Size bytes aligned on Alignment, a power of two. Adds a chunk when the current one is full.
+		/// Throws std::bad_alloc on failure.
+		GLM_FUNC_DECL void * allocate(std::size_t Size, std::size_t Alignment);
+
+		/// Current position, to free later allocations with rewind.
+		GLM_FUNC_DECL arena_mark mark() const;
+
+		/// Frees the allocations made since Mark was taken, keeping the chunks.
+		GLM_FUNC_DECL void rewind(arena_mark const & Mark);
+
+		/// Frees all allocations. When the frame used several chunks, they are replaced by a single chunk of
+		/// their total size, so that the same frame fits in one chunk next time.
+		GLM_FUNC_DECL void reset();
+
+		/// Bytes allocated since the last reset, including alignment padding
+		GLM_FUNC_DECL std::size_t used() const;
+
+		/// Bytes of all chunks
+		GLM_FUNC_DECL std::size_t capacity() const;
+
+		GLM_FUNC_DECL std::size_t chunks() const;
+
+	private:
+		frame_arena(frame_arena const &);
+		frame_arena & operator=(frame_arena const &);
+
+		struct chunk
+		{
+			char * Data;
+			std::size_t Size;
+		};
+
+		std::vector<chunk> Chunks;
+		std::size_t MinChunkSize;
+		std::size_t Current;
+		std::size_t Offset;
+		std::size_t Used;
+	};
+
+	/// Standard allocator allocating from a frame_arena, aligning elements on the largest of Alignment and alignof(T).
+	/// Deallocation does nothing: memory is reclaimed by frame_arena::reset or frame_arena::rewind,
+	/// which must not happen while a container still uses it.
+	/// @see gtx_allocator
+	template <typename T, std::size_t Alignment = 0>
+	class arena_allocator
+	{
+	public:
+		typedef T value_type;
+
+		static std::size_t const alignment = Alignment > alignof(T) ? Alignment : alignof(T);
+
+		template <typename U>
+		struct rebind
+		{
+			typedef arena_allocator<U, Alignment> other;
+		};
+
+		GLM_FUNC_DECL explicit arena_allocator(frame_arena & FrameArena);
+		template <typename U>
+		GLM_FUNC_DECL arena_allocator(arena_allocator<U, Alignment> const & Allocator);
+
+		/// Throws std::bad_alloc on failure
+		GLM_FUNC_DECL T * allocate(std::size_t Count);
+		GLM_FUNC_DECL void deallocate(T * Pointer, std::size_t Count);
+
+		GLM_FUNC_DECL frame_arena & arena() const;
+
+	private:
+		frame_arena * Arena;
+	};
+
+	template <typename T, typename U, std::size_t Alignment>
+	GLM_FUNC_DECL bool operator==(arena_allocator<T, Alignment> const & a, arena_allocator<U, Alignment> const & b);
+	template <typename T, typename U, std::size_t Alignment>
+	GLM_FUNC_DECL bool operator!=(arena_allocator<T, Alignment> const & a, arena_allocator<U, Alignment> const & b);
+
+	/// Scratch arena of the calling thread, created by the first call on each thread.
+	/// @see gtx_allocator
+	GLM_FUNC_DECL frame_arena & scratchArena();
+
+	/// Rewinds the scratch arena of the calling thread to its position at construction when destroyed.
+	/// Scopes nest, and containers using the scratch arena must not outlive their scope.
+	/// @see gtx_allocator
+	class scratch_scope
+	{
+	public:
+		GLM_FUNC_DECL scratch_scope();
+		GLM_FUNC_DECL ~scratch_scope();
+
+		GLM_FUNC_DECL frame_arena & arena() const;
+
+	private:
+		scratch_scope(scratch_scope const &);
+		scratch_scope & operator=(scratch_scope const &);
+
+		frame_arena * Arena;
+		arena_mark Mark;
+	};
+
+	/// @}
+}//namespace glm
+
+#include "allocator.inl"
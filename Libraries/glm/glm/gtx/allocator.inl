@@ -0,0 +1,270 @@
+/// @ref gtx_allocator
+/// @file glm/gtx/allocator.inl
+
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <new>
+
+namespace glm{
+namespace detail
+{
+	GLM_FUNC_QUALIFIER std::uintptr_t align_address(std::uintptr_t Address, std::size_t Alignment)
+	{
+		return (Address + (Alignment - 1)) & ~static_cast<std::uintptr_t>(Alignment - 1);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER std::size_t allocation_size(std::size_t Count)
+	{
+		if(Count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+			throw std::bad_alloc();
+		return Count * sizeof(T);
+	}
+}//namespace detail
+
+	// The pointer returned by malloc is stored right before the aligned block
+	GLM_FUNC_QUALIFIER void * alignedMalloc(std::size_t Size, std::size_t Alignment)
+	{
+		assert(Alignment > 0 && (Alignment & (Alignment - 1)) == 0);
+
+		std::size_t const Padding = (Alignment > sizeof(void *) ? Alignment : sizeof(void *)) - 1 + sizeof(void *);
+		if(Size > std::numeric_limits<std::size_t>::max() - Padding)
+			return 0;
+
+		void * const Block = std::malloc(Size + Padding);
+		if(!Block)
+			return 0;
+
+		std::uintptr_t const Address = detail::align_address(reinterpret_cast<std::uintptr_t>(Block) + sizeof(void *), Alignment);
+		void ** const Result = reinterpret_cast<void **>(Address);
+		Result[-1] = Block;
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER void alignedFree(void * Pointer)
+	{
+		if(Pointer)
+			std::free(static_cast<void **>(Pointer)[-1]);
+	}
+
+	// -- aligned_allocator --
+
+	template <typename T, std::size_t Alignment>
+	std::size_t const aligned_allocator<T, Alignment>::alignment;
+
+	template <typename T, std::size_t Alignment>
+	GLM_FUNC_QUALIFIER aligned_allocator<T, Alignment>::aligned_allocator()
+	{}
+
+	template <typename T, std::size_t Alignment>
+	template <typename U>
+	GLM_FUNC_QUALIFIER aligned_allocator<T, Alignment>::aligned_allocator(aligned_allocator<U, Alignment> const &)
+	{}
+
+	template <typename T, std::size_t Alignment>
+	GLM_FUNC_QUALIFIER T * aligned_allocator<T, Alignment>::allocate(std::size_t Count)
+	{
+		void * const Pointer = alignedMalloc(detail::allocation_size<T>(Count), alignment);
+		if(!Pointer)
+			throw std::bad_alloc();
+		return static_cast<T *>(Pointer);
+	}
+
+	template <typename T, std::size_t Alignment>
+	GLM_FUNC_QUALIFIER void aligned_allocator<T, Alignment>::deallocate(T * Pointer, std::size_t)
+	{
+		alignedFree(Pointer);
+	}
+
+	template <typename T, typename U, std::size_t Alignment>
+	GLM_FUNC_QUALIFIER bool operator==(aligned_allocator<T, Alignment> const &, aligned_allocator<U, Alignment> const &)
+	{
+		return true;
+	}
+
+	template <typename T, typename U, std::size_t Alignment>
+	GLM_FUNC_QUALIFIER bool operator!=(aligned_allocator<T, Alignment> const &, aligned_allocator<U, Alignment> const &)
+	{
+		return false;
+	}
+
+	// -- frame_arena --
+
+	GLM_FUNC_QUALIFIER frame_arena::frame_arena(std::size_t ChunkSize) :
+		MinChunkSize(ChunkSize > 0 ? ChunkSize : 1),
+		Current(0),
+		Offset(0),
+		Used(0)
+	{}
+
+	GLM_FUNC_QUALIFIER frame_arena::~frame_arena()
+	{
+		for(std::size_t i = 0; i < Chunks.size(); ++i)
+			alignedFree(Chunks[i].Data);
+	}
+
+	GLM_FUNC_QUALIFIER void * frame_arena::allocate(std::size_t Size, std::size_t Alignment)
+	{
+		assert(Alignment > 0 && (Alignment & (Alignment - 1)) == 0);
+
+		// In the current chunk, or the next one if it was kept by rewind and is large enough, or a new one
+		for(std::size_t Index = Current; Index < Chunks.size() && Index <= Current + 1; ++Index)
+		{
+			chunk const & Chunk = Chunks[Index];
+			std::size_t const Start = Index == Current ? Offset : 0;
+			std::uintptr_t const Base = reinterpret_cast<std::uintptr_t>(Chunk.Data);
+			std::size_t const Begin = static_cast<std::size_t>(detail::align_address(Base + Start, Alignment) - Base);
+			if(Begin <= Chunk.Size && Size <= Chunk.Size - Begin)
+			{
+				Current = Index;
+				Used += Begin - Start + Size;
+				Offset = Begin + Size;
+				return Chunk.Data + Begin;
+			}
+		}
+
+		if(Size > std::numeric_limits<std::size_t>::max() - Alignment)
+			throw std::bad_alloc();
+
+		// Chunks are aligned on a cache line
+		std::size_t const ChunkAlignment = Alignment > 64 ? Alignment : 64;
+		chunk Chunk;
+		Chunk.Size = Size > MinChunkSize ? Size : MinChunkSize;
+		Chunk.Data = static_cast<char *>(alignedMalloc(Chunk.Size, ChunkAlignment));
+		if(!Chunk.Data)
+			throw std::bad_alloc();
+
+		std::size_t const Index = Chunks.empty() ? 0 : Current + 1;
+		Chunks.insert(Chunks.begin() + static_cast<std::ptrdiff_t>(Index), Chunk);
+		Current = Index;
+		Used += Size;
+		Offset = Size;
+		return Chunk.Data;
+	}
+
+	GLM_FUNC_QUALIFIER arena_mark frame_arena::mark() const
+	{
+		arena_mark Mark;
+		Mark.Chunk = Current;
+		Mark.Offset = Offset;
+		Mark.Used = Used;
+		return Mark;
+	}
+
+	GLM_FUNC_QUALIFIER void frame_arena::rewind(arena_mark const & Mark)
+	{
+		assert(Mark.Chunk <= Current && Mark.Used <= Used);
+
+		Current = Mark.Chunk;
+		Offset = Mark.Offset;
+		Used = Mark.Used;
+	}
+
+	GLM_FUNC_QUALIFIER void frame_arena::reset()
+	{
+		if(Chunks.size() > 1)
+		{
+			std::size_t const Capacity = capacity();
+			for(std::size_t i = 0; i < Chunks.size(); ++i)
+				alignedFree(Chunks[i].Data);
+			Chunks.clear();
+
+			chunk Chunk;
+			Chunk.Size = Capacity;
+			Chunk.Data = static_cast<char *>(alignedMalloc(Capacity, 64));
+			if(Chunk.Data)
+				Chunks.push_back(Chunk);
+		}
+
+		Current = 0;
+		Offset = 0;
+		Used = 0;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t frame_arena::used() const
+	{
+		return Used;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t frame_arena::capacity() const
+	{
+		std::size_t Capacity = 0;
+		for(std::size_t i = 0; i < Chunks.size(); ++i)
+			Capacity += Chunks[i].Size;
+		return Capacity;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t frame_arena::chunks() const
+	{
+		return Chunks.size();
+	}
+
+	// -- arena_allocator --
+
+	template <typename T, std::size_t Alignment>
+	std::size_t const arena_allocator<T, Alignment>::alignment;
+
+	template <typename T, std::size_t Alignment>
+	GLM_FUNC_QUALIFIER arena_allocator<T, Alignment>::arena_allocator(frame_arena & FrameArena) :
+		Arena(&FrameArena)
+	{}
+
+	template <typename T, std::size_t Alignment>
+	template <typename U>
+	GLM_FUNC_QUALIFIER arena_allocator<T, Alignment>::arena_allocator(arena_allocator<U, Alignment> const & Allocator) :
+		Arena(&Allocator.arena())
+	{}
+
+	template <typename T, std::size_t Alignment>
+	GLM_FUNC_QUALIFIER T * arena_allocator<T, Alignment>::allocate(std::size_t Count)
+	{
+		return static_cast<T *>(Arena->allocate(detail::allocation_size<T>(Count), alignment));
+	}
+
+	template <typename T, std::size_t Alignment>
+	GLM_FUNC_QUALIFIER void arena_allocator<T, Alignment>::deallocate(T *, std::size_t)
+	{}
+
+	template <typename T, std::size_t Alignment>
+	GLM_FUNC_QUALIFIER frame_arena & arena_allocator<T, Alignment>::arena() const
+	{
+		return *Arena;
+	}
+
+	template <typename T, typename U, std::size_t Alignment>
+	GLM_FUNC_QUALIFIER bool operator==(arena_allocator<T, Alignment> const & a, arena_allocator<U, Alignment> const & b)
+	{
+		return &a.arena() == &b.arena();
+	}
+
+	template <typename T, typename U, std::size_t Alignment>
+	GLM_FUNC_QUALIFIER bool operator!=(arena_allocator<T, Alignment> const & a, arena_allocator<U, Alignment> const & b)
+	{
+		return &a.arena() != &b.arena();
+	}
+
+	// -- Scratch arenas --
+
+	GLM_FUNC_QUALIFIER frame_arena & scratchArena()
+	{
+		static thread_local frame_arena Arena;
+		return Arena;
+	}
+
+	GLM_FUNC_QUALIFIER scratch_scope::scratch_scope() :
+		Arena(&scratchArena()),
+		Mark(Arena->mark())
+	{}
+
+	GLM_FUNC_QUALIFIER scratch_scope::~scratch_scope()
+	{
+		Arena->rewind(Mark);
+	}
+
+	GLM_FUNC_QUALIFIER frame_arena & scratch_scope::arena() const
+	{
+		return *Arena;
+	}
+}//namespace glm
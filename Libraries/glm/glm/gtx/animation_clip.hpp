@@ -0,0 +1,134 @@
+/// @ref gtx_animation_clip
+/// @file glm/gtx/animation_clip.hpp
+///
+/// @see core (dependence)
+/// @see gtc_quaternion (dependence)
+///
+/// @defgroup gtx_animation_clip GLM_GTX_animation_clip
+/// @ingroup gtx
+///
+/// @brief Compressed animation clips of rotation and translation tracks with random access sampling.
+///
+/// Frames are split in segments of 16 intervals and tracks in groups of four. Each segment of a group is a
+/// contiguous block of 64 bytes cache lines, aligned in memory: a line holding the key mask and the ranges of
+/// the 7 components of the 4 tracks over the segment, quantized to 8 bits within their ranges over the clip,
+/// then a line per kept key, quantized to 16 bits within the segment ranges and interleaved per component so
+/// that four tracks are decoded at once with SIMD instructions. A key of the four tracks takes 56 bytes, so
+/// the two keys around a time can't share a line with each other nor with the ranges: a sample reads three
+/// whole lines per group, the header and the two keys, which never straddle a line boundary. Keys are removed
+/// while the linear interpolation of the remaining ones, normalized for rotations, stays within the
+/// tolerances of the original frames for the four tracks of the group.
+///
+/// <glm/gtx/animation_clip.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/quaternion.hpp"
+#include <cstddef>
+#include <vector>
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_animation_clip extension included")
+#endif
+
+namespace glm{
+namespace detail
+{
+	// Standard allocator aligning arrays on a 64 bytes cache line, including before C++11
+	template <typename T>
+	class clip_allocator
+	{
+	public:
+		typedef T value_type;
+		typedef T * pointer;
+		typedef T const * const_pointer;
+		typedef T & reference;
+		typedef T const & const_reference;
+		typedef std::size_t size_type;
+		typedef std::ptrdiff_t difference_type;
+
+		template <typename U>
+		struct rebind
+		{
+			typedef clip_allocator<U> other;
+		};
+
+		GLM_FUNC_DECL clip_allocator();
+		template <typename U>
+		GLM_FUNC_DECL clip_allocator(clip_allocator<U> const & Allocator);
+
+		GLM_FUNC_DECL pointer address(reference Value) const;
+		GLM_FUNC_DECL const_pointer address(const_reference Value) const;
+		GLM_FUNC_DECL size_type max_size() const;
+
+		/// Throws std::bad_alloc on failure
+		GLM_FUNC_DECL pointer allocate(size_type Count, void const * Hint = 0);
+		GLM_FUNC_DECL void deallocate(pointer Pointer, size_type Count);
+
+		GLM_FUNC_DECL void construct(pointer Pointer, const_reference Value);
+		GLM_FUNC_DECL void destroy(pointer Pointer);
+	};
+
+	template <typename T, typename U>
+	GLM_FUNC_DECL bool operator==(clip_allocator<T> const & a, clip_allocator<U> const & b);
+	template <typename T, typename U>
+	GLM_FUNC_DECL bool operator!=(clip_allocator<T> const & a, clip_allocator<U> const & b);
+}//namespace detail
+
+	/// @addtogroup gtx_animation_clip
+	/// @{
+
+	/// Compressed animation clip built by compressClip.
+	/// @see gtx_animation_clip
+	template <typename T>
+	struct tcompressed_clip
+	{
+		std::size_t TrackCount;
+		std::size_t FrameCount;
+		T SampleRate;
+
+		/// Minimums then extents of the components of the tracks of each group over the clip, as T[2][7][4] per group
+		std::vector<T> Ranges;
+
+		/// Offset in Data of the block of each segment and group of four tracks, the groups of a segment being contiguous
+		std::vector<std::size_t> Blocks;
+
+		/// Blocks, aligned on 64 bytes cache lines
+		std::vector<uint8, detail::clip_allocator<uint8> > Data;
+	};
+
+	typedef tcompressed_clip<float> compressed_clip;
+
+	/// Compresses TrackCount tracks of FrameCount frames sampled at SampleRate frames per second.
+	/// The rotation and translation of track t at frame f are Rotations[f * TrackCount + t] and Translations[f * TrackCount + t].
+	/// At the frames, sampled translations are within PositionTolerance of the original ones and sampled rotations
+	/// within RotationTolerance radians, up to the 16-bit quantization of the component ranges of each segment.
+	/// Rotations don't need to be normalized.
+	/// @see gtx_animation_clip
+	template <typename T, precision P>
+	GLM_FUNC_DECL void compressClip(
+		tquat<T, P> const * Rotations,
+		tvec3<T, P> const * Translations,
+		std::size_t TrackCount,
+		std::size_t FrameCount,
+		T SampleRate,
+		T PositionTolerance,
+		T RotationTolerance,
+		tcompressed_clip<T> & Clip);
+
+	/// Samples the TrackCount tracks of a compressed clip at Time seconds, clamped to the duration of the clip.
+	/// Keys are interpolated linearly, rotations are normalized.
+	/// @see gtx_animation_clip
+	template <typename T, precision P>
+	GLM_FUNC_DECL void sampleClip(
+		tcompressed_clip<T> const & Clip,
+		T Time,
+		tquat<T, P> * Rotations,
+		tvec3<T, P> * Translations);
+
+	/// @}
+}//namespace glm
+
+#include "animation_clip.inl"
@@ -0,0 +1,459 @@
+/// @ref gtx_animation_clip
+/// @file glm/gtx/animation_clip.inl
+
+#include "../detail/_parallel.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <new>
+
+namespace glm{
+namespace detail
+{
+	// -- clip_allocator --
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER clip_allocator<T>::clip_allocator()
+	{}
+
+	template <typename T>
+	template <typename U>
+	GLM_FUNC_QUALIFIER clip_allocator<T>::clip_allocator(clip_allocator<U> const &)
+	{}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER typename clip_allocator<T>::pointer clip_allocator<T>::address(reference Value) const
+	{
+		return &Value;
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER typename clip_allocator<T>::const_pointer clip_allocator<T>::address(const_reference Value) const
+	{
+		return &Value;
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER typename clip_allocator<T>::size_type clip_allocator<T>::max_size() const
+	{
+		return (std::numeric_limits<size_type>::max() - 64 - sizeof(void *)) / sizeof(T);
+	}
+
+	// The pointer returned by malloc is stored right before the aligned array
+	template <typename T>
+	GLM_FUNC_QUALIFIER typename clip_allocator<T>::pointer clip_allocator<T>::allocate(size_type Count, void const *)
+	{
+		if(Count > max_size())
+			throw std::bad_alloc();
+
+		void * const Block = std::malloc(Count * sizeof(T) + 64 + sizeof(void *));
+		if(!Block)
+			throw std::bad_alloc();
+
+		std::size_t const Address = (reinterpret_cast<std::size_t>(Block) + sizeof(void *) + 63) & ~static_cast<std::size_t>(63);
+		void ** const Result = reinterpret_cast<void **>(Address);
+		Result[-1] = Block;
+		return reinterpret_cast<pointer>(Result);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void clip_allocator<T>::deallocate(pointer Pointer, size_type)
+	{
+		if(Pointer)
+			std::free(reinterpret_cast<void **>(Pointer)[-1]);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void clip_allocator<T>::construct(pointer Pointer, const_reference Value)
+	{
+		new(Pointer) T(Value);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void clip_allocator<T>::destroy(pointer Pointer)
+	{
+		Pointer->~T();
+	}
+
+	template <typename T, typename U>
+	GLM_FUNC_QUALIFIER bool operator==(clip_allocator<T> const &, clip_allocator<U> const &)
+	{
+		return true;
+	}
+
+	template <typename T, typename U>
+	GLM_FUNC_QUALIFIER bool operator!=(clip_allocator<T> const &, clip_allocator<U> const &)
+	{
+		return false;
+	}
+
+	// -- Compression --
+
+	// Frame intervals per segment, the last frame of a segment being the first frame of the next one
+	GLM_FUNC_QUALIFIER int clip_segment_intervals()
+	{
+		return 16;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t clip_segment_count(std::size_t FrameCount)
+	{
+		std::size_t const Intervals = FrameCount > 1 ? FrameCount - 1 : 0;
+		std::size_t const Count = (Intervals + 15) / 16;
+		return Count > 0 ? Count : 1;
+	}
+
+	// Block layout: key mask and key count as uint32, the ranges of the components of the 4 tracks over the
+	// segment as uint8[7][4] minimums then extents, relative to the ranges over the clip, filling a 64 bytes
+	// cache line. Then the keys as uint16[7][4], relative to the ranges over the segment, each one padded to
+	// its own cache line. Components are the rotation x, y, z, w then the translation x, y, z.
+	GLM_FUNC_QUALIFIER std::size_t clip_block_size(std::size_t KeyCount)
+	{
+		return 64 + 64 * KeyCount;
+	}
+
+	// Range of a component over a segment, from its range over the clip
+	template <typename T>
+	GLM_FUNC_QUALIFIER void clip_segment_range(T ClipMin, T ClipExtent, uint8 SegmentMin, uint8 SegmentExtent, T & Min, T & Extent)
+	{
+		T const Step = static_cast<T>(1) / static_cast<T>(255);
+		Min = ClipMin + ClipExtent * (static_cast<T>(SegmentMin) * Step);
+		Extent = ClipExtent * (static_cast<T>(SegmentExtent) * Step);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER T clip_key_step()
+	{
+		return static_cast<T>(1) / static_cast<T>(65535);
+	}
+
+	// Builds the block of the segment [First, First + Intervals] for the tracks [Group * 4, Group * 4 + 4).
+	// Rotations are normalized and continuous: consecutive rotations of a track have a non-negative dot product.
+	template <typename T, precision P>
+	struct compute_clip_block
+	{
+		tquat<T, P> const * Rotations;
+		tvec3<T, P> const * Translations;
+		T const * Ranges;
+		std::size_t TrackCount;
+		std::size_t First;
+		int Intervals;
+		std::size_t Group;
+		T PositionTolerance;
+		T RotationChord;
+
+		// Component c of track Lane at local frame f
+		T Values[7][4][17];
+		uint16 Keys[7][4][17];
+		uint8 SegmentMin[7][4];
+		uint8 SegmentExtent[7][4];
+		T Min[7][4];
+		T Extent[7][4];
+
+		GLM_FUNC_QUALIFIER T decode(int c, int Lane, T Key) const
+		{
+			return Min[c][Lane] + Extent[c][Lane] * (Key * clip_key_step<T>());
+		}
+
+		// Whether interpolating the keys a and b is within the tolerances at the frames between them
+		GLM_FUNC_QUALIFIER bool valid(int a, int b) const
+		{
+			for(int f = a + 1; f < b; ++f)
+			{
+				T const Alpha = static_cast<T>(f - a) / static_cast<T>(b - a);
+				for(int Lane = 0; Lane < 4; ++Lane)
+				{
+					T v[7];
+					for(int c = 0; c < 7; ++c)
+					{
+						T const k0 = static_cast<T>(Keys[c][Lane][a]);
+						T const k1 = static_cast<T>(Keys[c][Lane][b]);
+						v[c] = decode(c, Lane, k0 + (k1 - k0) * Alpha);
+					}
+
+					tvec4<T, P> const q = normalize(tvec4<T, P>(v[0], v[1], v[2], v[3]));
+					tvec4<T, P> const r(Values[0][Lane][f], Values[1][Lane][f], Values[2][Lane][f], Values[3][Lane][f]);
+					if(min(length(q - r), length(q + r)) > RotationChord)
+						return false;
+
+					tvec3<T, P> const t(Values[4][Lane][f], Values[5][Lane][f], Values[6][Lane][f]);
+					if(distance(tvec3<T, P>(v[4], v[5], v[6]), t) > PositionTolerance)
+						return false;
+				}
+			}
+			return true;
+		}
+
+		GLM_FUNC_QUALIFIER void operator()(std::vector<uint8> & Block)
+		{
+			for(int Lane = 0; Lane < 4; ++Lane)
+			{
+				std::size_t const Track = min(Group * 4 + static_cast<std::size_t>(Lane), TrackCount - 1);
+				for(int f = 0; f <= Intervals; ++f)
+				{
+					std::size_t const Index = (First + static_cast<std::size_t>(f)) * TrackCount + Track;
+					tquat<T, P> const & q = Rotations[Index];
+					tvec3<T, P> const & t = Translations[Index];
+					T const v[7] = {q.x, q.y, q.z, q.w, t.x, t.y, t.z};
+					for(int c = 0; c < 7; ++c)
+						Values[c][Lane][f] = v[c];
+				}
+
+				for(int c = 0; c < 7; ++c)
+				{
+					T Low = Values[c][Lane][0];
+					T High = Values[c][Lane][0];
+					for(int f = 1; f <= Intervals; ++f)
+					{
+						Low = min(Low, Values[c][Lane][f]);
+						High = max(High, Values[c][Lane][f]);
+					}
+
+					// Segment range quantized to 8 bits within the clip range, rounded outwards
+					T const ClipMin = Ranges[c * 4 + Lane];
+					T const ClipExtent = Ranges[28 + c * 4 + Lane];
+					T const ClipScale = ClipExtent > static_cast<T>(0) ? static_cast<T>(255) / ClipExtent : static_cast<T>(0);
+					SegmentMin[c][Lane] = static_cast<uint8>(clamp(floor((Low - ClipMin) * ClipScale), static_cast<T>(0), static_cast<T>(255)));
+					clip_segment_range(ClipMin, ClipExtent, SegmentMin[c][Lane], static_cast<uint8>(0), Min[c][Lane], Extent[c][Lane]);
+					SegmentExtent[c][Lane] = static_cast<uint8>(clamp(ceil((High - Min[c][Lane]) * ClipScale), static_cast<T>(0), static_cast<T>(255)));
+					clip_segment_range(ClipMin, ClipExtent, SegmentMin[c][Lane], SegmentExtent[c][Lane], Min[c][Lane], Extent[c][Lane]);
+
+					// Keys quantized to 16 bits within the segment range
+					T const Scale = Extent[c][Lane] > static_cast<T>(0) ? static_cast<T>(65535) / Extent[c][Lane] : static_cast<T>(0);
+					for(int f = 0; f <= Intervals; ++f)
+						Keys[c][Lane][f] = static_cast<uint16>(clamp((Values[c][Lane][f] - Min[c][Lane]) * Scale, static_cast<T>(0), static_cast<T>(65535)) + static_cast<T>(0.5));
+				}
+			}
+
+			// Greedy key reduction: each key is followed by the furthest key keeping the frames in between within the tolerances
+			uint32 Mask = 1;
+			for(int a = 0; a < Intervals;)
+			{
+				int b = a + 1;
+				while(b < Intervals && valid(a, b + 1))
+					++b;
+				Mask |= 1u << b;
+				a = b;
+			}
+
+			std::size_t const KeyCount = static_cast<std::size_t>(bitCount(Mask));
+			Block.resize(clip_block_size(KeyCount));
+			uint32 const Header[2] = {Mask, static_cast<uint32>(KeyCount)};
+			std::memcpy(&Block[0], Header, sizeof(Header));
+			std::memcpy(&Block[8], SegmentMin, sizeof(SegmentMin));
+			std::memcpy(&Block[8 + sizeof(SegmentMin)], SegmentExtent, sizeof(SegmentExtent));
+
+			std::size_t Offset = 64;
+			for(int f = 0; f <= Intervals; ++f)
+			{
+				if(!(Mask & (1u << f)))
+					continue;
+				uint16 Key[7][4];
+				for(int c = 0; c < 7; ++c)
+				for(int Lane = 0; Lane < 4; ++Lane)
+					Key[c][Lane] = Keys[c][Lane][f];
+				std::memcpy(&Block[Offset], Key, sizeof(Key));
+				Offset += 64;
+			}
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_clip_blocks
+	{
+		tquat<T, P> const * Rotations;
+		tvec3<T, P> const * Translations;
+		T const * Ranges;
+		std::size_t TrackCount;
+		std::size_t FrameCount;
+		std::size_t GroupCount;
+		T PositionTolerance;
+		T RotationChord;
+		std::vector<std::vector<uint8> > * Blocks;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			compute_clip_block<T, P> Compute;
+			Compute.Rotations = Rotations;
+			Compute.Translations = Translations;
+			Compute.TrackCount = TrackCount;
+			Compute.PositionTolerance = PositionTolerance;
+			Compute.RotationChord = RotationChord;
+			for(std::size_t i = Begin; i < End; ++i)
+			{
+				std::size_t const Segment = i / GroupCount;
+				Compute.Group = i % GroupCount;
+				Compute.Ranges = Ranges + Compute.Group * 7 * 4 * 2;
+				Compute.First = Segment * static_cast<std::size_t>(clip_segment_intervals());
+				Compute.Intervals = static_cast<int>(min(FrameCount - 1 - Compute.First, static_cast<std::size_t>(clip_segment_intervals())));
+				Compute((*Blocks)[i]);
+			}
+		}
+	};
+
+	// Interpolates the keys k0 and k1 of a block for its four tracks, writing the components as T[7][4].
+	// Ranges are the clip ranges of the group, as T[2][7][4] minimums then extents.
+	template <typename T>
+	struct compute_clip_sample_soa4
+	{
+		GLM_FUNC_QUALIFIER static void call(T const * Ranges, uint8 const * Block, std::size_t k0, std::size_t k1, T Alpha, T * Values)
+		{
+			uint16 Key0[7 * 4];
+			uint16 Key1[7 * 4];
+			std::memcpy(Key0, Block + clip_block_size(k0), sizeof(Key0));
+			std::memcpy(Key1, Block + clip_block_size(k1), sizeof(Key1));
+
+			for(std::size_t i = 0; i < 7 * 4; ++i)
+			{
+				T Min, Extent;
+				clip_segment_range(Ranges[i], Ranges[28 + i], Block[8 + i], Block[36 + i], Min, Extent);
+				T const u0 = static_cast<T>(Key0[i]);
+				T const u1 = static_cast<T>(Key1[i]);
+				Values[i] = Min + Extent * ((u0 + (u1 - u0) * Alpha) * clip_key_step<T>());
+			}
+
+			for(std::size_t Lane = 0; Lane < 4; ++Lane)
+			{
+				T const Length = sqrt(Values[Lane] * Values[Lane] + Values[4 + Lane] * Values[4 + Lane] + Values[8 + Lane] * Values[8 + Lane] + Values[12 + Lane] * Values[12 + Lane]);
+				for(std::size_t c = 0; c < 4; ++c)
+					Values[c * 4 + Lane] /= Length;
+			}
+		}
+	};
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void compressClip
+	(
+		tquat<T, P> const * Rotations,
+		tvec3<T, P> const * Translations,
+		std::size_t TrackCount,
+		std::size_t FrameCount,
+		T SampleRate,
+		T PositionTolerance,
+		T RotationTolerance,
+		tcompressed_clip<T> & Clip
+	)
+	{
+		Clip.TrackCount = TrackCount;
+		Clip.FrameCount = FrameCount;
+		Clip.SampleRate = SampleRate;
+		Clip.Ranges.clear();
+		Clip.Blocks.clear();
+		Clip.Data.clear();
+		if(TrackCount == 0 || FrameCount == 0)
+			return;
+
+		// Consecutive rotations are made continuous so that interpolating their components follows the shortest arc
+		std::vector<tquat<T, P> > Continuous(TrackCount * FrameCount);
+		for(std::size_t f = 0; f < FrameCount; ++f)
+		for(std::size_t t = 0; t < TrackCount; ++t)
+		{
+			tquat<T, P> & q = Continuous[f * TrackCount + t];
+			q = normalize(Rotations[f * TrackCount + t]);
+			if(f > 0 && dot(q, Continuous[(f - 1) * TrackCount + t]) < static_cast<T>(0))
+				q = -q;
+		}
+
+		// Ranges of the components of each track over the clip, the last group repeating the last track
+		std::size_t const GroupCount = (TrackCount + 3) / 4;
+		Clip.Ranges.resize(GroupCount * 7 * 4 * 2);
+		for(std::size_t Group = 0; Group < GroupCount; ++Group)
+		for(std::size_t Lane = 0; Lane < 4; ++Lane)
+		{
+			std::size_t const Track = min(Group * 4 + Lane, TrackCount - 1);
+			T Low[7], High[7];
+			for(std::size_t f = 0; f < FrameCount; ++f)
+			{
+				tquat<T, P> const & q = Continuous[f * TrackCount + Track];
+				tvec3<T, P> const & t = Translations[f * TrackCount + Track];
+				T const v[7] = {q.x, q.y, q.z, q.w, t.x, t.y, t.z};
+				for(std::size_t c = 0; c < 7; ++c)
+				{
+					Low[c] = f > 0 ? min(Low[c], v[c]) : v[c];
+					High[c] = f > 0 ? max(High[c], v[c]) : v[c];
+				}
+			}
+			for(std::size_t c = 0; c < 7; ++c)
+			{
+				Clip.Ranges[(Group * 2 * 7 + c) * 4 + Lane] = Low[c];
+				Clip.Ranges[((Group * 2 + 1) * 7 + c) * 4 + Lane] = High[c] - Low[c];
+			}
+		}
+
+		std::size_t const BlockCount = detail::clip_segment_count(FrameCount) * GroupCount;
+		std::vector<std::vector<uint8> > Blocks(BlockCount);
+
+		// Rotations within RotationTolerance radians are quaternions within this chord
+		detail::compute_clip_blocks<T, P> Compute = {
+			&Continuous[0], Translations, &Clip.Ranges[0], TrackCount, FrameCount, GroupCount,
+			PositionTolerance, static_cast<T>(2) * sin(RotationTolerance * static_cast<T>(0.25)), &Blocks};
+		detail::parallel_for(BlockCount, 16, Compute);
+
+		Clip.Blocks.resize(BlockCount);
+		std::size_t Size = 0;
+		for(std::size_t i = 0; i < BlockCount; ++i)
+		{
+			Clip.Blocks[i] = Size;
+			Size += Blocks[i].size();
+		}
+		Clip.Data.resize(Size);
+		for(std::size_t i = 0; i < BlockCount; ++i)
+			std::memcpy(&Clip.Data[Clip.Blocks[i]], &Blocks[i][0], Blocks[i].size());
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void sampleClip
+	(
+		tcompressed_clip<T> const & Clip,
+		T Time,
+		tquat<T, P> * Rotations,
+		tvec3<T, P> * Translations
+	)
+	{
+		if(Clip.TrackCount == 0 || Clip.FrameCount == 0)
+			return;
+
+		int const Intervals = detail::clip_segment_intervals();
+		std::size_t const SegmentCount = detail::clip_segment_count(Clip.FrameCount);
+		T const Frame = clamp(Time * Clip.SampleRate, static_cast<T>(0), static_cast<T>(Clip.FrameCount - 1));
+		std::size_t const Segment = min(static_cast<std::size_t>(Frame) / static_cast<std::size_t>(Intervals), SegmentCount - 1);
+		T const Local = Frame - static_cast<T>(Segment * static_cast<std::size_t>(Intervals));
+		int const SegmentIntervals = static_cast<int>(min(Clip.FrameCount - 1 - Segment * static_cast<std::size_t>(Intervals), static_cast<std::size_t>(Intervals)));
+
+		// Keys a and b around the sample: the last key up to Interval and the first one after it
+		std::size_t const GroupCount = (Clip.TrackCount + 3) / 4;
+		int const Interval = min(static_cast<int>(Local), max(SegmentIntervals - 1, 0));
+		uint32 const Before = (2u << Interval) - 1u;
+		T Values[7 * 4];
+		for(std::size_t Group = 0; Group < GroupCount; ++Group)
+		{
+			uint8 const * Block = &Clip.Data[Clip.Blocks[Segment * GroupCount + Group]];
+			uint32 Mask;
+			std::memcpy(&Mask, Block, sizeof(Mask));
+
+			std::size_t k0 = 0;
+			std::size_t k1 = 0;
+			T Alpha = static_cast<T>(0);
+			if(SegmentIntervals > 0)
+			{
+				int const a = findMSB(Mask & Before);
+				int const b = findLSB(Mask & ~Before);
+				k0 = static_cast<std::size_t>(bitCount(Mask & ((1u << a) - 1u)));
+				k1 = k0 + 1;
+				Alpha = (Local - static_cast<T>(a)) / static_cast<T>(b - a);
+			}
+			detail::compute_clip_sample_soa4<T>::call(&Clip.Ranges[Group * 7 * 4 * 2], Block, k0, k1, Alpha, Values);
+
+			std::size_t const Count = min(Clip.TrackCount - Group * 4, static_cast<std::size_t>(4));
+			for(std::size_t Lane = 0; Lane < Count; ++Lane)
+			{
+				Rotations[Group * 4 + Lane] = tquat<T, P>(Values[12 + Lane], Values[Lane], Values[4 + Lane], Values[8 + Lane]);
+				Translations[Group * 4 + Lane] = tvec3<T, P>(Values[16 + Lane], Values[20 + Lane], Values[24 + Lane]);
+			}
+		}
+	}
+}//namespace glm
+
+#if GLM_ARCH != GLM_ARCH_PURE
+#	include "animation_clip_simd.inl"
+#endif
@@ -0,0 +1,61 @@
+/// @ref gtx_animation_clip
+/// @file glm/gtx/animation_clip_simd.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	// Four bytes converted to floats
+	GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_load_u8(uint8 const * p)
+	{
+		int Bytes;
+		std::memcpy(&Bytes, p, sizeof(Bytes));
+		glm_ivec4 const zero = _mm_setzero_si128();
+		return _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(Bytes), zero), zero));
+	}
+
+	// Four 16-bit unsigned integers converted to floats
+	GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_load_u16(uint8 const * p)
+	{
+		return _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<glm_ivec4 const*>(p)), _mm_setzero_si128()));
+	}
+
+	template <>
+	struct compute_clip_sample_soa4<float>
+	{
+		GLM_FUNC_QUALIFIER static void call(float const * Ranges, uint8 const * Block, std::size_t k0, std::size_t k1, float Alpha, float * Values)
+		{
+			uint8 const * Key0 = Block + clip_block_size(k0);
+			uint8 const * Key1 = Block + clip_block_size(k1);
+
+			glm_vec4 const a = _mm_set1_ps(Alpha);
+			glm_vec4 const SegmentStep = _mm_set1_ps(1.0f / 255.0f);
+			glm_vec4 const KeyStep = _mm_set1_ps(clip_key_step<float>());
+			glm_vec4 v[7];
+			for(int c = 0; c < 7; ++c)
+			{
+				glm_vec4 const ClipMin = _mm_loadu_ps(Ranges + c * 4);
+				glm_vec4 const ClipExtent = _mm_loadu_ps(Ranges + 28 + c * 4);
+				glm_vec4 const Min = _mm_add_ps(ClipMin, _mm_mul_ps(ClipExtent, _mm_mul_ps(glm_vec4_load_u8(Block + 8 + c * 4), SegmentStep)));
+				glm_vec4 const Extent = _mm_mul_ps(ClipExtent, _mm_mul_ps(glm_vec4_load_u8(Block + 36 + c * 4), SegmentStep));
+
+				glm_vec4 const u0 = glm_vec4_load_u16(Key0 + c * 8);
+				glm_vec4 const u1 = glm_vec4_load_u16(Key1 + c * 8);
+				glm_vec4 const u = _mm_add_ps(u0, _mm_mul_ps(_mm_sub_ps(u1, u0), a));
+				v[c] = _mm_add_ps(Min, _mm_mul_ps(Extent, _mm_mul_ps(u, KeyStep)));
+			}
+
+			glm_vec4 const dot0 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(v[0], v[0]), _mm_mul_ps(v[1], v[1])), _mm_add_ps(_mm_mul_ps(v[2], v[2]), _mm_mul_ps(v[3], v[3])));
+			glm_vec4 const Length = _mm_sqrt_ps(dot0);
+			for(int c = 0; c < 4; ++c)
+				v[c] = _mm_div_ps(v[c], Length);
+
+			for(int c = 0; c < 7; ++c)
+				_mm_storeu_ps(Values + c * 4, v[c]);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
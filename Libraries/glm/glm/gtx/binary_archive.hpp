@@ -0,0 +1,164 @@
+/// @ref gtx_binary_archive
+/// @file glm/gtx/binary_archive.hpp
+///
+/// @see core (dependence)
+/// @see gtc_quaternion (dependence)
+/// @see gtx_mesh_import (dependence)
+///
+/// @defgroup gtx_binary_archive GLM_GTX_binary_archive
+/// @ingroup gtx
+///
+/// @brief Versioned binary container of arrays of glm types, loaded by memory mapping.
+///
+/// An archive is a 64 bytes header, sections aligned on 64 bytes and a table of contents at the end of the file.
+/// The header records the byte order and the layout of the glm types of the writer, and each section its element
+/// type and size. Opening an archive maps the file and resolves the table of contents into pointers: sections
+/// stored uncompressed in the byte order of the reader are used in place, LZ4 compressed sections are decompressed
+/// in parallel, and sections of the other byte order are swapped, both into buffers owned by the archive.
+///
+/// <glm/gtx/binary_archive.hpp> need to be included to use these functionalities.
+/// This extension is not supported with CUDA
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/quaternion.hpp"
+#include "../gtx/mesh_import.hpp"
+#include "../detail/_mapped_file.hpp"
+#include <cstddef>
+#include <vector>
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_binary_archive extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_binary_archive
+	/// @{
+
+	/// Storage of a section.
+	/// @see gtx_binary_archive
+	enum archive_compression
+	{
+		archive_raw,
+		archive_lz4
+	};
+
+	/// Table of contents entry of a section.
+	/// @see gtx_binary_archive
+	struct archive_section
+	{
+		/// Null terminated
+		char Name[24];
+
+		/// Element type, see archive_type
+		uint32 Type;
+		uint32 Compression;
+		uint32 ElementSize;
+		uint32 ComponentSize;
+		uint64 Count;
+
+		/// From the beginning of the file, a multiple of 64
+		uint64 Offset;
+
+		/// Stored bytes, compressed or not
+		uint64 Size;
+	};
+
+	/// Sections to write, in order, built by addSection and written by writeArchive.
+	/// @see gtx_binary_archive
+	struct archive_writer
+	{
+		std::vector<archive_section> Sections;
+		std::vector<std::vector<uint8> > Payloads;
+	};
+
+	/// Count elements of type T starting at Data.
+	/// @see gtx_binary_archive
+	template <typename T>
+	struct tarchive_span
+	{
+		T const * Data;
+		std::size_t Count;
+	};
+
+	/// Element type tags of the sections: uint8, uint16, uint32, int32, float, float vec2, vec3, vec4, mat3, mat4 and quat.
+	/// Other types don't have a value and can't be stored.
+	/// @see gtx_binary_archive
+	template <typename T>
+	struct archive_type{};
+
+	/// Archive file opened by memory mapping.
+	/// @see gtx_binary_archive
+	class binary_archive
+	{
+	public:
+		/// Maps the archive Path and resolves its sections, valid() is false if the file can't be read or is invalid.
+		GLM_FUNC_DECL explicit binary_archive(char const * Path);
+
+		GLM_FUNC_DECL bool valid() const;
+
+		/// Table of contents, in the byte order of the reader
+		GLM_FUNC_DECL std::vector<archive_section> const & sections() const;
+
+		/// Elements of the section Name, without copy for sections used in place.
+		/// Return an empty span if there is no section Name of element type T.
+		template <typename T>
+		GLM_FUNC_DECL tarchive_span<T> span(char const * Name) const;
+
+	private:
+		binary_archive(binary_archive const &);
+		binary_archive & operator=(binary_archive const &);
+
+		detail::mapped_file File;
+		bool Valid;
+		std::vector<archive_section> Sections;
+		std::vector<void const *> Pointers;
+		std::vector<std::vector<uint64> > Buffers;
+	};
+
+	/// Appends the section Name, of at most 23 characters, holding a copy of Count elements of type T.
+	/// An LZ4 compressed section which wouldn't be smaller is stored uncompressed.
+	/// @see gtx_binary_archive
+	template <typename T>
+	GLM_FUNC_DECL void addSection(
+		archive_writer & Writer,
+		char const * Name,
+		T const * Data,
+		std::size_t Count,
+		archive_compression Compression);
+
+	/// Appends the sections "positions", "normals", "texcoords" and "indices" of a mesh, skipping empty ones.
+	/// @see gtx_binary_archive
+	template <precision P>
+	GLM_FUNC_DECL void addMesh(
+		archive_writer & Writer,
+		tmesh_soa<float, P> const & Mesh,
+		archive_compression Compression);
+
+	/// Builds the archive of the sections of Writer in Bytes.
+	/// @see gtx_binary_archive
+	GLM_FUNC_DECL void writeArchive(
+		archive_writer const & Writer,
+		std::vector<uint8> & Bytes);
+
+	/// Writes the archive of the sections of Writer to the file Path, return false if the file can't be written.
+	/// @see gtx_binary_archive
+	GLM_FUNC_DECL bool writeArchive(
+		archive_writer const & Writer,
+		char const * Path);
+
+	/// Imports Source, a PLY file if its extension is .ply and an OBJ file otherwise, and writes its mesh to the archive Destination.
+	/// Return false if Source can't be imported or Destination can't be written.
+	/// @see gtx_binary_archive
+	GLM_FUNC_DECL bool convertMesh(
+		char const * Source,
+		char const * Destination,
+		archive_compression Compression);
+
+	/// @}
+}//namespace glm
+
+#include "binary_archive.inl"
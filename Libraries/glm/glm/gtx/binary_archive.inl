@@ -0,0 +1,367 @@
+/// @ref gtx_binary_archive
+/// @file glm/gtx/binary_archive.inl
+
+#include "../detail/_lz4.hpp"
+#include "../detail/_parallel.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+namespace glm
+{
+	template <> struct archive_type<uint8> { enum { value = 1, component = 1 }; };
+	template <> struct archive_type<uint16> { enum { value = 2, component = 2 }; };
+	template <> struct archive_type<uint32> { enum { value = 3, component = 4 }; };
+	template <> struct archive_type<int32> { enum { value = 4, component = 4 }; };
+	template <> struct archive_type<float> { enum { value = 5, component = 4 }; };
+	template <precision P> struct archive_type<tvec2<float, P> > { enum { value = 6, component = 4 }; };
+	template <precision P> struct archive_type<tvec3<float, P> > { enum { value = 7, component = 4 }; };
+	template <precision P> struct archive_type<tvec4<float, P> > { enum { value = 8, component = 4 }; };
+	template <precision P> struct archive_type<tmat3x3<float, P> > { enum { value = 9, component = 4 }; };
+	template <precision P> struct archive_type<tmat4x4<float, P> > { enum { value = 10, component = 4 }; };
+	template <precision P> struct archive_type<tquat<float, P> > { enum { value = 11, component = 4 }; };
+
+namespace detail
+{
+	static char const archive_magic[8] = {'G', 'L', 'M', 'A', 'R', 'C', 'H', '\0'};
+	static uint32 const archive_version = 1;
+	static uint32 const archive_byte_order = 0x01020304u;
+	static uint32 const archive_swapped_byte_order = 0x04030201u;
+	static std::size_t const archive_alignment = 64;
+	static std::size_t const archive_name_size = 24;
+
+	struct archive_header
+	{
+		char Magic[8];
+		uint32 Version;
+
+		// archive_byte_order in the byte order of the writer
+		uint32 ByteOrder;
+
+		// Layout of the glm types of the writer, see archive_abi
+		uint32 Abi;
+		uint32 SectionCount;
+		uint64 TableOffset;
+		uint64 FileSize;
+		uint8 Reserved[24];
+	};
+
+	// IEEE 754 floats, quaternions stored as x, y, z, w and column major matrices
+	GLM_FUNC_QUALIFIER uint32 archive_abi()
+	{
+		tquat<float, defaultp> const Quat(4.0f, 1.0f, 2.0f, 3.0f);
+		float Components[4];
+		std::memcpy(Components, &Quat, sizeof(Components));
+		bool const QuatXYZW = Components[0] == 1.0f && Components[3] == 4.0f;
+		return (std::numeric_limits<float>::is_iec559 ? 1u : 0u) | (QuatXYZW ? 2u : 0u) | 4u;
+	}
+
+	GLM_FUNC_QUALIFIER void archive_swap(void * Data, std::size_t Size)
+	{
+		unsigned char * const Bytes = static_cast<unsigned char *>(Data);
+		for(std::size_t i = 0; i < Size / 2; ++i)
+			std::swap(Bytes[i], Bytes[Size - 1 - i]);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t archive_align(std::size_t Offset)
+	{
+		return (Offset + archive_alignment - 1) & ~(archive_alignment - 1);
+	}
+
+	// Places the sections of Writer after the header and the table of contents after them
+	GLM_FUNC_QUALIFIER void archive_layout(archive_writer const & Writer, archive_header & Header, std::vector<archive_section> & Sections)
+	{
+		Sections = Writer.Sections;
+		std::size_t Offset = sizeof(archive_header);
+		for(std::size_t i = 0; i < Sections.size(); ++i)
+		{
+			Sections[i].Offset = archive_align(Offset);
+			Offset = static_cast<std::size_t>(Sections[i].Offset + Sections[i].Size);
+		}
+
+		std::memset(&Header, 0, sizeof(Header));
+		std::memcpy(Header.Magic, archive_magic, sizeof(Header.Magic));
+		Header.Version = archive_version;
+		Header.ByteOrder = archive_byte_order;
+		Header.Abi = archive_abi();
+		Header.SectionCount = static_cast<uint32>(Sections.size());
+		Header.TableOffset = archive_align(Offset);
+		Header.FileSize = Header.TableOffset + Sections.size() * sizeof(archive_section);
+	}
+
+	GLM_FUNC_QUALIFIER bool archive_has_extension(char const * Path, char const * Extension)
+	{
+		std::size_t const PathLength = std::strlen(Path);
+		std::size_t const Length = std::strlen(Extension);
+		if(PathLength <= Length || Path[PathLength - Length - 1] != '.')
+			return false;
+		for(std::size_t i = 0; i < Length; ++i)
+		{
+			if(std::tolower(static_cast<unsigned char>(Path[PathLength - Length + i])) != Extension[i])
+				return false;
+		}
+		return true;
+	}
+
+	// Decompresses or swaps the sections which aren't used in place into their buffers
+	struct compute_archive_load
+	{
+		char const * Data;
+		archive_section const * Sections;
+		std::vector<uint64> * Buffers;
+		void const ** Pointers;
+		bool Swap;
+		char * Valid;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			for(std::size_t i = Begin; i < End; ++i)
+			{
+				archive_section const & Section = Sections[i];
+				if(Buffers[i].empty())
+					continue;
+
+				unsigned char * const Output = reinterpret_cast<unsigned char *>(&Buffers[i][0]);
+				unsigned char const * const Input = reinterpret_cast<unsigned char const *>(Data + Section.Offset);
+				std::size_t const Size = static_cast<std::size_t>(Section.Count * Section.ElementSize);
+				if(Section.Compression == archive_lz4)
+					Valid[i] = lz4_decompress(Input, Input + static_cast<std::size_t>(Section.Size), Output, Size) ? 1 : 0;
+				else
+					std::memcpy(Output, Input, Size);
+
+				for(std::size_t j = 0; Swap && j < Size; j += Section.ComponentSize)
+					archive_swap(Output + j, Section.ComponentSize);
+				Pointers[i] = Output;
+			}
+		}
+	};
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER binary_archive::binary_archive(char const * Path) :
+		File(Path),
+		Valid(false)
+	{
+		char const * const Data = File.data();
+		std::size_t const Size = File.size();
+		if(!Data || Size < sizeof(detail::archive_header))
+			return;
+
+		detail::archive_header Header;
+		std::memcpy(&Header, Data, sizeof(Header));
+		bool const Swap = Header.ByteOrder == detail::archive_swapped_byte_order;
+		if(std::memcmp(Header.Magic, detail::archive_magic, sizeof(Header.Magic)) != 0 || (!Swap && Header.ByteOrder != detail::archive_byte_order))
+			return;
+		if(Swap)
+		{
+			detail::archive_swap(&Header.Version, sizeof(Header.Version));
+			detail::archive_swap(&Header.Abi, sizeof(Header.Abi));
+			detail::archive_swap(&Header.SectionCount, sizeof(Header.SectionCount));
+			detail::archive_swap(&Header.TableOffset, sizeof(Header.TableOffset));
+			detail::archive_swap(&Header.FileSize, sizeof(Header.FileSize));
+		}
+		if(Header.Version == 0 || Header.Version > detail::archive_version || Header.Abi != detail::archive_abi() || Header.FileSize != Size)
+			return;
+		if(Header.TableOffset > Size || Header.SectionCount > (Size - Header.TableOffset) / sizeof(archive_section))
+			return;
+
+		std::vector<archive_section> Table(Header.SectionCount);
+		if(!Table.empty())
+			std::memcpy(&Table[0], Data + Header.TableOffset, Table.size() * sizeof(archive_section));
+		Pointers.assign(Table.size(), static_cast<void const *>(0));
+		Buffers.resize(Table.size());
+
+		for(std::size_t i = 0; i < Table.size(); ++i)
+		{
+			archive_section & Section = Table[i];
+			if(Swap)
+			{
+				detail::archive_swap(&Section.Type, sizeof(Section.Type));
+				detail::archive_swap(&Section.Compression, sizeof(Section.Compression));
+				detail::archive_swap(&Section.ElementSize, sizeof(Section.ElementSize));
+				detail::archive_swap(&Section.ComponentSize, sizeof(Section.ComponentSize));
+				detail::archive_swap(&Section.Count, sizeof(Section.Count));
+				detail::archive_swap(&Section.Offset, sizeof(Section.Offset));
+				detail::archive_swap(&Section.Size, sizeof(Section.Size));
+			}
+
+			bool const ValidComponent = Section.ComponentSize == 1 || Section.ComponentSize == 2 || Section.ComponentSize == 4 || Section.ComponentSize == 8;
+			if(Section.Name[detail::archive_name_size - 1] != '\0' || !ValidComponent || Section.ElementSize == 0 || Section.ElementSize % Section.ComponentSize != 0)
+				return;
+			if(Section.Offset % detail::archive_alignment != 0 || Section.Offset > Size || Section.Size > Size - Section.Offset)
+				return;
+			if(Section.Count > std::numeric_limits<std::size_t>::max() / Section.ElementSize)
+				return;
+
+			uint64 const RawSize = Section.Count * Section.ElementSize;
+			if(Section.Compression == archive_raw)
+			{
+				if(Section.Size != RawSize)
+					return;
+				if(!Swap || RawSize == 0)
+				{
+					Pointers[i] = Data + Section.Offset;
+					continue;
+				}
+			}
+			else if(Section.Compression != archive_lz4)
+				return;
+
+			// LZ4 expands at most 255 times, larger counts in the table are rejected before allocating
+			if(RawSize > Section.Size * 255 + 16)
+				return;
+			Buffers[i].resize(static_cast<std::size_t>((RawSize + 7) / 8));
+		}
+
+		std::vector<char> Loaded(Table.size(), 1);
+		if(!Table.empty())
+		{
+			detail::compute_archive_load Load = {Data, &Table[0], &Buffers[0], &Pointers[0], Swap, &Loaded[0]};
+			detail::parallel_for(Table.size(), 1, Load);
+		}
+		for(std::size_t i = 0; i < Loaded.size(); ++i)
+		{
+			if(!Loaded[i])
+				return;
+		}
+
+		Sections.swap(Table);
+		Valid = true;
+	}
+
+	GLM_FUNC_QUALIFIER bool binary_archive::valid() const
+	{
+		return Valid;
+	}
+
+	GLM_FUNC_QUALIFIER std::vector<archive_section> const & binary_archive::sections() const
+	{
+		return Sections;
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER tarchive_span<T> binary_archive::span(char const * Name) const
+	{
+		tarchive_span<T> Span = {0, 0};
+		for(std::size_t i = 0; i < Sections.size(); ++i)
+		{
+			archive_section const & Section = Sections[i];
+			if(std::strcmp(Section.Name, Name) != 0 || Section.Type != static_cast<uint32>(archive_type<T>::value) || Section.ElementSize != sizeof(T))
+				continue;
+			Span.Data = static_cast<T const *>(Pointers[i]);
+			Span.Count = static_cast<std::size_t>(Section.Count);
+			break;
+		}
+		return Span;
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void addSection(archive_writer & Writer, char const * Name, T const * Data, std::size_t Count, archive_compression Compression)
+	{
+		assert(std::strlen(Name) < detail::archive_name_size);
+
+		archive_section Section;
+		std::memset(&Section, 0, sizeof(Section));
+		std::strncpy(Section.Name, Name, detail::archive_name_size - 1);
+		Section.Type = static_cast<uint32>(archive_type<T>::value);
+		Section.Compression = archive_raw;
+		Section.ElementSize = static_cast<uint32>(sizeof(T));
+		Section.ComponentSize = static_cast<uint32>(archive_type<T>::component);
+		Section.Count = Count;
+
+		uint8 const * const Bytes = reinterpret_cast<uint8 const *>(Data);
+		std::size_t const Size = Count * sizeof(T);
+		Writer.Payloads.push_back(std::vector<uint8>());
+		std::vector<uint8> & Payload = Writer.Payloads.back();
+		if(Compression == archive_lz4 && Size > 0)
+		{
+			detail::lz4_compress(Bytes, Size, Payload);
+			Section.Compression = archive_lz4;
+			if(Payload.size() >= Size)
+			{
+				Payload.clear();
+				Section.Compression = archive_raw;
+			}
+		}
+		if(Section.Compression == archive_raw)
+			Payload.assign(Bytes, Bytes + Size);
+
+		Section.Size = Payload.size();
+		Writer.Sections.push_back(Section);
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER void addMesh(archive_writer & Writer, tmesh_soa<float, P> const & Mesh, archive_compression Compression)
+	{
+		if(!Mesh.Positions.empty())
+			addSection(Writer, "positions", &Mesh.Positions[0], Mesh.Positions.size(), Compression);
+		if(!Mesh.Normals.empty())
+			addSection(Writer, "normals", &Mesh.Normals[0], Mesh.Normals.size(), Compression);
+		if(!Mesh.TexCoords.empty())
+			addSection(Writer, "texcoords", &Mesh.TexCoords[0], Mesh.TexCoords.size(), Compression);
+		if(!Mesh.Indices.empty())
+			addSection(Writer, "indices", &Mesh.Indices[0], Mesh.Indices.size(), Compression);
+	}
+
+	GLM_FUNC_QUALIFIER void writeArchive(archive_writer const & Writer, std::vector<uint8> & Bytes)
+	{
+		detail::archive_header Header;
+		std::vector<archive_section> Sections;
+		detail::archive_layout(Writer, Header, Sections);
+
+		Bytes.assign(static_cast<std::size_t>(Header.FileSize), 0);
+		std::memcpy(&Bytes[0], &Header, sizeof(Header));
+		for(std::size_t i = 0; i < Sections.size(); ++i)
+		{
+			if(!Writer.Payloads[i].empty())
+				std::memcpy(&Bytes[static_cast<std::size_t>(Sections[i].Offset)], &Writer.Payloads[i][0], Writer.Payloads[i].size());
+		}
+		if(!Sections.empty())
+			std::memcpy(&Bytes[static_cast<std::size_t>(Header.TableOffset)], &Sections[0], Sections.size() * sizeof(archive_section));
+	}
+
+	GLM_FUNC_QUALIFIER bool writeArchive(archive_writer const & Writer, char const * Path)
+	{
+		detail::archive_header Header;
+		std::vector<archive_section> Sections;
+		detail::archive_layout(Writer, Header, Sections);
+
+		std::FILE * const File = std::fopen(Path, "wb");
+		if(!File)
+			return false;
+
+		// Sections are written in place, followed by the padding to the next offset
+		char const Padding[detail::archive_alignment] = {0};
+		bool Written = std::fwrite(&Header, sizeof(Header), 1, File) == 1;
+		uint64 Offset = sizeof(Header);
+		for(std::size_t i = 0; Written && i <= Sections.size(); ++i)
+		{
+			uint64 const Next = i < Sections.size() ? Sections[i].Offset : Header.TableOffset;
+			std::size_t const Gap = static_cast<std::size_t>(Next - Offset);
+			Written = Gap == 0 || std::fwrite(Padding, 1, Gap, File) == Gap;
+			if(i == Sections.size() || !Written)
+				break;
+
+			std::vector<uint8> const & Payload = Writer.Payloads[i];
+			Written = Payload.empty() || std::fwrite(&Payload[0], 1, Payload.size(), File) == Payload.size();
+			Offset = Next + Payload.size();
+		}
+		if(Written && !Sections.empty())
+			Written = std::fwrite(&Sections[0], sizeof(archive_section), Sections.size(), File) == Sections.size();
+
+		return std::fclose(File) == 0 && Written;
+	}
+
+	GLM_FUNC_QUALIFIER bool convertMesh(char const * Source, char const * Destination, archive_compression Compression)
+	{
+		mesh_soa Mesh;
+		bool const Imported = detail::archive_has_extension(Source, "ply") ? importPLY(Source, Mesh) : importOBJ(Source, Mesh);
+		if(!Imported)
+			return false;
+
+		archive_writer Writer;
+		addMesh(Writer, Mesh, Compression);
+		return writeArchive(Writer, Destination);
+	}
+}//namespace glm
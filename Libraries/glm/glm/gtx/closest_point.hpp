@@ -39,6 +39,15 @@ namespace glm
 		tvec2<T, P> const & a, 
 		tvec2<T, P> const & b);	
 
+	/// Find the point of the triangle (a, b, c) which is the closest of a point.
+	/// @see gtx_closest_point
+	template <typename T, precision P>
+	GLM_FUNC_DECL tvec3<T, P> closestPointOnTriangle(
+		tvec3<T, P> const & point,
+		tvec3<T, P> const & a,
+		tvec3<T, P> const & b,
+		tvec3<T, P> const & c);
+
 	/// @}
 }// namespace glm
 
@@ -42,5 +42,61 @@ namespace glm
 		if(Distance >= LineLength) return b;
 		return a + LineDirection * Distance;
 	}
-	
+
+	// Voronoi regions of the vertices, edges and face, from Real-Time Collision Detection, C. Ericson
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER tvec3<T, P> closestPointOnTriangle
+	(
+		tvec3<T, P> const & point,
+		tvec3<T, P> const & a,
+		tvec3<T, P> const & b,
+		tvec3<T, P> const & c
+	)
+	{
+		tvec3<T, P> const ab = b - a;
+		tvec3<T, P> const ac = c - a;
+
+		tvec3<T, P> const ap = point - a;
+		T const d1 = dot(ab, ap);
+		T const d2 = dot(ac, ap);
+		if(d1 <= T(0) && d2 <= T(0))
+			return a;
+
+		tvec3<T, P> const bp = point - b;
+		T const d3 = dot(ab, bp);
+		T const d4 = dot(ac, bp);
+		if(d3 >= T(0) && d4 <= d3)
+			return b;
+
+		T const vc = d1 * d4 - d3 * d2;
+		if(vc <= T(0) && d1 >= T(0) && d3 <= T(0))
+			return a + ab * (d1 / (d1 - d3));
+
+		tvec3<T, P> const cp = point - c;
+		T const d5 = dot(ab, cp);
+		T const d6 = dot(ac, cp);
+		if(d6 >= T(0) && d5 <= d6)
+			return c;
+
+		T const vb = d5 * d2 - d1 * d6;
+		if(vb <= T(0) && d2 >= T(0) && d6 <= T(0))
+			return a + ac * (d2 / (d2 - d6));
+
+		T const va = d3 * d6 - d5 * d4;
+		if(va <= T(0) && d4 - d3 >= T(0) && d5 - d6 >= T(0))
+			return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+
+		// Degenerate triangles have no interior
+		T const Sum = va + vb + vc;
+		if(Sum <= T(0))
+		{
+			tvec3<T, P> const p0 = closestPointOnLine(point, a, b);
+			tvec3<T, P> const p1 = closestPointOnLine(point, b, c);
+			tvec3<T, P> const d0 = p0 - point;
+			tvec3<T, P> const d1 = p1 - point;
+			return dot(d0, d0) <= dot(d1, d1) ? p0 : p1;
+		}
+
+		return a + ab * (vb / Sum) + ac * (vc / Sum);
+	}
 }//namespace glm
@@ -0,0 +1,131 @@
+/// @ref gtx_clustered_lights
+/// @file glm/gtx/clustered_lights.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_clustered_lights GLM_GTX_clustered_lights
+/// @ingroup gtx
+///
+/// @brief Assignment of point and spot lights to the clusters of a view frustum for forward+ rendering.
+///
+/// The frustum of a perspective projection is divided into tiles in x and y and into depth slices whose depths
+/// grow exponentially from the near to the far plane, so that clusters keep a similar shape at every distance.
+/// Lights are bounded by spheres, spot lights also by their cone, and tested against the view space bounding
+/// boxes of a slice, then of its rows of tiles, then of its clusters, 8 lights at once with AVX or 4 with SSE2.
+/// Slices are assigned on several threads, and the compact index lists are written in a single pass to a buffer
+/// provided by the caller, typically a mapped GPU buffer.
+///
+/// <glm/gtx/clustered_lights.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+#include <vector>
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_clustered_lights extension included")
+#endif
+
+namespace glm{
+namespace detail
+{
+	enum cluster_field
+	{
+		// Bounding sphere
+		cluster_x, cluster_y, cluster_z, cluster_radius,
+		// Cone apex, axis, cosine and sine of the half angle, and range
+		cluster_apex_x, cluster_apex_y, cluster_apex_z,
+		cluster_axis_x, cluster_axis_y, cluster_axis_z,
+		cluster_cos, cluster_sin, cluster_range,
+		cluster_fields
+	};
+
+	// View space lights as a structure of arrays, padded to a multiple of 8 lights
+	struct cluster_lights
+	{
+		std::vector<float> Fields[cluster_fields];
+		std::vector<uint> Index;
+	};
+}//namespace detail
+
+	/// @addtogroup gtx_clustered_lights
+	/// @{
+
+	/// Point light, or spot light when Angle is below pi.
+	/// @see gtx_clustered_lights
+	struct cluster_light
+	{
+		vec3 Position;
+		/// Distance beyond which the light has no effect
+		float Range;
+		/// Normalized axis of a spot light
+		vec3 Direction;
+		/// Half angle of a spot light cone in radians
+		float Angle;
+	};
+
+	/// @see gtx_clustered_lights
+	GLM_FUNC_DECL cluster_light pointLight(vec3 const & Position, float Range);
+
+	/// @see gtx_clustered_lights
+	GLM_FUNC_DECL cluster_light spotLight(vec3 const & Position, vec3 const & Direction, float Range, float Angle);
+
+	/// Clusters of the frustum of perspective(Fovy, Aspect, Near, Far) and the work buffers of assignLights.
+	/// Cluster (x, y, z) is at index (z * CountY + y) * CountX + x, x and y growing like normalized device coordinates.
+	/// @see gtx_clustered_lights
+	struct cluster_grid
+	{
+		GLM_FUNC_DECL cluster_grid(uint CountX, uint CountY, uint CountZ, float Fovy, float Aspect, float Near, float Far);
+
+		uint CountX, CountY, CountZ;
+		float Near, Far;
+
+		/// Half width and half height of the frustum at a depth of 1
+		vec2 Extent;
+
+		/// Depths of the CountZ + 1 slice boundaries, from Near to Far
+		std::vector<float> Depths;
+
+		/// View space lights, per job candidate lights of a slice and of a row, and per slice results of the last assignLights call
+		detail::cluster_lights Lights;
+		std::vector<detail::cluster_lights> Candidates;
+		std::vector<std::vector<uint> > SliceIndices;
+		std::vector<std::size_t> SliceOffsets;
+		std::vector<uint> Counts;
+	};
+
+	/// @see gtx_clustered_lights
+	GLM_FUNC_DECL std::size_t clusterCount(cluster_grid const & Grid);
+
+	/// Scale and bias such that the slice of a view space depth is floor(log(Depth) * Scale + Bias), for shaders.
+	/// @see gtx_clustered_lights
+	GLM_FUNC_DECL vec2 clusterDepthScaleBias(cluster_grid const & Grid);
+
+	/// Index of the cluster containing a view space position, or clusterCount(Grid) outside of the frustum.
+	/// @see gtx_clustered_lights
+	GLM_FUNC_DECL std::size_t clusterIndex(cluster_grid const & Grid, vec3 const & Position);
+
+	/// View space bounding box of the cluster (x, y, z).
+	/// @see gtx_clustered_lights
+	GLM_FUNC_DECL void clusterBounds(cluster_grid const & Grid, uint x, uint y, uint z, vec3 & Min, vec3 & Max);
+
+	/// Lists the lights possibly affecting each cluster, lights transformed by the rigid View matrix.
+	/// Clusters[i] receives the offset and count of the indices of cluster i in Indices, written in order of cluster.
+	/// Only the first Capacity indices are written, the counts of the lists beyond are reduced accordingly.
+	/// Return the number of indices of all clusters, which can exceed Capacity.
+	/// @see gtx_clustered_lights
+	GLM_FUNC_DECL std::size_t assignLights(
+		cluster_grid & Grid,
+		mat4 const & View,
+		cluster_light const * Lights,
+		std::size_t LightCount,
+		uvec2 * Clusters,
+		uint * Indices,
+		std::size_t Capacity);
+
+	/// @}
+}//namespace glm
+
+#include "clustered_lights.inl"
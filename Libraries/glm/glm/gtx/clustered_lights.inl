@@ -0,0 +1,444 @@
+/// @ref gtx_clustered_lights
+/// @file glm/gtx/clustered_lights.inl
+
+#include "../gtc/constants.hpp"
+#include "../detail/_parallel.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace glm{
+namespace detail
+{
+	static std::size_t const cluster_batch = 8;
+
+	GLM_FUNC_QUALIFIER void cluster_clear(cluster_lights & Lights)
+	{
+		for(int f = 0; f < cluster_fields; ++f)
+			Lights.Fields[f].clear();
+		Lights.Index.clear();
+	}
+
+	GLM_FUNC_QUALIFIER void cluster_resize(cluster_lights & Lights, std::size_t Count)
+	{
+		for(int f = 0; f < cluster_fields; ++f)
+			Lights.Fields[f].resize(Count);
+		Lights.Index.resize(Count);
+	}
+
+	// Lights far away that never pass the tests, to complete the last batch
+	GLM_FUNC_QUALIFIER void cluster_pad(cluster_lights & Lights)
+	{
+		std::size_t const Count = Lights.Index.size();
+		std::size_t const Padded = (Count + cluster_batch - 1) / cluster_batch * cluster_batch;
+		cluster_resize(Lights, Padded);
+		for(std::size_t i = Count; i < Padded; ++i)
+		{
+			for(int f = 0; f < cluster_fields; ++f)
+				Lights.Fields[f][i] = 0.0f;
+			Lights.Fields[cluster_x][i] = Lights.Fields[cluster_y][i] = Lights.Fields[cluster_z][i] = 1e30f;
+			Lights.Fields[cluster_cos][i] = -1.0f;
+			Lights.Index[i] = ~static_cast<uint>(0);
+		}
+	}
+
+	// Bounding sphere of the light and its cone, the cone test disabled for point lights and cones of half angle above pi / 2
+	GLM_FUNC_QUALIFIER void cluster_set(cluster_lights & Lights, std::size_t i, vec3 const & Position, vec3 const & Direction, float Range, float Angle, uint Index)
+	{
+		vec3 Center = Position;
+		float Radius = Range;
+		vec3 Axis(0.0f);
+		float Cos = -1.0f;
+		float Sin = 0.0f;
+		if(Angle < half_pi<float>())
+		{
+			Axis = Direction;
+			Cos = std::cos(Angle);
+			Sin = std::sin(Angle);
+			Radius = Angle > quarter_pi<float>() ? Range * Sin : Range / (2.0f * Cos);
+			Center = Position + Direction * (Angle > quarter_pi<float>() ? Range * Cos : Radius);
+		}
+
+		Lights.Fields[cluster_x][i] = Center.x;
+		Lights.Fields[cluster_y][i] = Center.y;
+		Lights.Fields[cluster_z][i] = Center.z;
+		Lights.Fields[cluster_radius][i] = Radius;
+		Lights.Fields[cluster_apex_x][i] = Position.x;
+		Lights.Fields[cluster_apex_y][i] = Position.y;
+		Lights.Fields[cluster_apex_z][i] = Position.z;
+		Lights.Fields[cluster_axis_x][i] = Axis.x;
+		Lights.Fields[cluster_axis_y][i] = Axis.y;
+		Lights.Fields[cluster_axis_z][i] = Axis.z;
+		Lights.Fields[cluster_cos][i] = Cos;
+		Lights.Fields[cluster_sin][i] = Sin;
+		Lights.Fields[cluster_range][i] = Range;
+		Lights.Index[i] = Index;
+	}
+
+	// View space bounds of the tiles [X0, X1) x [Y0, Y1) of slice Z
+	GLM_FUNC_QUALIFIER void cluster_bounds(cluster_grid const & Grid, uint X0, uint X1, uint Y0, uint Y1, uint Z, vec3 & Min, vec3 & Max)
+	{
+		float const Near = Grid.Depths[Z];
+		float const Far = Grid.Depths[Z + 1];
+		vec2 const Lower(
+			-1.0f + 2.0f * static_cast<float>(X0) / static_cast<float>(Grid.CountX),
+			-1.0f + 2.0f * static_cast<float>(Y0) / static_cast<float>(Grid.CountY));
+		vec2 const Upper(
+			-1.0f + 2.0f * static_cast<float>(X1) / static_cast<float>(Grid.CountX),
+			-1.0f + 2.0f * static_cast<float>(Y1) / static_cast<float>(Grid.CountY));
+		vec2 const Min2 = min(Lower * Near, Lower * Far) * Grid.Extent;
+		vec2 const Max2 = max(Upper * Near, Upper * Far) * Grid.Extent;
+		Min = vec3(Min2, -Far);
+		Max = vec3(Max2, -Near);
+	}
+
+	// Calls Visit with the position of each light of Lights which may intersect the box [Min, Max]: its bounding sphere
+	// intersects the box, and its cone intersects the bounding sphere of the box.
+	template <typename visitor>
+	GLM_FUNC_QUALIFIER void cluster_cull(cluster_lights const & Lights, vec3 const & Min, vec3 const & Max, visitor const & Visit)
+	{
+		std::size_t const Count = Lights.Index.size();
+		vec3 const Center = (Min + Max) * 0.5f;
+		float const Radius = length(Max - Min) * 0.5f;
+
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			__m256 const MinX = _mm256_set1_ps(Min.x), MinY = _mm256_set1_ps(Min.y), MinZ = _mm256_set1_ps(Min.z);
+			__m256 const MaxX = _mm256_set1_ps(Max.x), MaxY = _mm256_set1_ps(Max.y), MaxZ = _mm256_set1_ps(Max.z);
+			__m256 const CenterX = _mm256_set1_ps(Center.x), CenterY = _mm256_set1_ps(Center.y), CenterZ = _mm256_set1_ps(Center.z);
+			__m256 const BoxRadius = _mm256_set1_ps(Radius);
+			__m256 const NegBoxRadius = _mm256_set1_ps(-Radius);
+			__m256 const Zero = _mm256_setzero_ps();
+			for(std::size_t i = 0; i < Count; i += 8)
+			{
+				__m256 const x = _mm256_loadu_ps(&Lights.Fields[cluster_x][i]);
+				__m256 const y = _mm256_loadu_ps(&Lights.Fields[cluster_y][i]);
+				__m256 const z = _mm256_loadu_ps(&Lights.Fields[cluster_z][i]);
+				__m256 const dx = _mm256_max_ps(_mm256_max_ps(_mm256_sub_ps(MinX, x), _mm256_sub_ps(x, MaxX)), Zero);
+				__m256 const dy = _mm256_max_ps(_mm256_max_ps(_mm256_sub_ps(MinY, y), _mm256_sub_ps(y, MaxY)), Zero);
+				__m256 const dz = _mm256_max_ps(_mm256_max_ps(_mm256_sub_ps(MinZ, z), _mm256_sub_ps(z, MaxZ)), Zero);
+				__m256 const Distance2 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)), _mm256_mul_ps(dz, dz));
+				__m256 const LightRadius = _mm256_loadu_ps(&Lights.Fields[cluster_radius][i]);
+				__m256 const Sphere = _mm256_cmp_ps(Distance2, _mm256_mul_ps(LightRadius, LightRadius), _CMP_LE_OQ);
+				if(_mm256_movemask_ps(Sphere) == 0)
+					continue;
+
+				__m256 const vx = _mm256_sub_ps(CenterX, _mm256_loadu_ps(&Lights.Fields[cluster_apex_x][i]));
+				__m256 const vy = _mm256_sub_ps(CenterY, _mm256_loadu_ps(&Lights.Fields[cluster_apex_y][i]));
+				__m256 const vz = _mm256_sub_ps(CenterZ, _mm256_loadu_ps(&Lights.Fields[cluster_apex_z][i]));
+				__m256 const Along = _mm256_add_ps(_mm256_add_ps(
+					_mm256_mul_ps(vx, _mm256_loadu_ps(&Lights.Fields[cluster_axis_x][i])),
+					_mm256_mul_ps(vy, _mm256_loadu_ps(&Lights.Fields[cluster_axis_y][i]))),
+					_mm256_mul_ps(vz, _mm256_loadu_ps(&Lights.Fields[cluster_axis_z][i])));
+				__m256 const Length2 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy)), _mm256_mul_ps(vz, vz));
+				__m256 const Across = _mm256_sqrt_ps(_mm256_max_ps(_mm256_sub_ps(Length2, _mm256_mul_ps(Along, Along)), Zero));
+				__m256 const Closest = _mm256_sub_ps(
+					_mm256_mul_ps(_mm256_loadu_ps(&Lights.Fields[cluster_cos][i]), Across),
+					_mm256_mul_ps(_mm256_loadu_ps(&Lights.Fields[cluster_sin][i]), Along));
+				__m256 const Cone = _mm256_and_ps(_mm256_and_ps(
+					_mm256_cmp_ps(Closest, BoxRadius, _CMP_LE_OQ),
+					_mm256_cmp_ps(Along, _mm256_add_ps(BoxRadius, _mm256_loadu_ps(&Lights.Fields[cluster_range][i])), _CMP_LE_OQ)),
+					_mm256_cmp_ps(Along, NegBoxRadius, _CMP_GE_OQ));
+
+				int const Mask = _mm256_movemask_ps(_mm256_and_ps(Sphere, Cone));
+				for(std::size_t b = 0; b < 8; ++b)
+					if(Mask & (1 << b))
+						Visit(i + b);
+			}
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			__m128 const MinX = _mm_set1_ps(Min.x), MinY = _mm_set1_ps(Min.y), MinZ = _mm_set1_ps(Min.z);
+			__m128 const MaxX = _mm_set1_ps(Max.x), MaxY = _mm_set1_ps(Max.y), MaxZ = _mm_set1_ps(Max.z);
+			__m128 const CenterX = _mm_set1_ps(Center.x), CenterY = _mm_set1_ps(Center.y), CenterZ = _mm_set1_ps(Center.z);
+			__m128 const BoxRadius = _mm_set1_ps(Radius);
+			__m128 const NegBoxRadius = _mm_set1_ps(-Radius);
+			__m128 const Zero = _mm_setzero_ps();
+			for(std::size_t i = 0; i < Count; i += 4)
+			{
+				__m128 const x = _mm_loadu_ps(&Lights.Fields[cluster_x][i]);
+				__m128 const y = _mm_loadu_ps(&Lights.Fields[cluster_y][i]);
+				__m128 const z = _mm_loadu_ps(&Lights.Fields[cluster_z][i]);
+				__m128 const dx = _mm_max_ps(_mm_max_ps(_mm_sub_ps(MinX, x), _mm_sub_ps(x, MaxX)), Zero);
+				__m128 const dy = _mm_max_ps(_mm_max_ps(_mm_sub_ps(MinY, y), _mm_sub_ps(y, MaxY)), Zero);
+				__m128 const dz = _mm_max_ps(_mm_max_ps(_mm_sub_ps(MinZ, z), _mm_sub_ps(z, MaxZ)), Zero);
+				__m128 const Distance2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+				__m128 const LightRadius = _mm_loadu_ps(&Lights.Fields[cluster_radius][i]);
+				__m128 const Sphere = _mm_cmple_ps(Distance2, _mm_mul_ps(LightRadius, LightRadius));
+				if(_mm_movemask_ps(Sphere) == 0)
+					continue;
+
+				__m128 const vx = _mm_sub_ps(CenterX, _mm_loadu_ps(&Lights.Fields[cluster_apex_x][i]));
+				__m128 const vy = _mm_sub_ps(CenterY, _mm_loadu_ps(&Lights.Fields[cluster_apex_y][i]));
+				__m128 const vz = _mm_sub_ps(CenterZ, _mm_loadu_ps(&Lights.Fields[cluster_apex_z][i]));
+				__m128 const Along = _mm_add_ps(_mm_add_ps(
+					_mm_mul_ps(vx, _mm_loadu_ps(&Lights.Fields[cluster_axis_x][i])),
+					_mm_mul_ps(vy, _mm_loadu_ps(&Lights.Fields[cluster_axis_y][i]))),
+					_mm_mul_ps(vz, _mm_loadu_ps(&Lights.Fields[cluster_axis_z][i])));
+				__m128 const Length2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz));
+				__m128 const Across = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(Length2, _mm_mul_ps(Along, Along)), Zero));
+				__m128 const Closest = _mm_sub_ps(
+					_mm_mul_ps(_mm_loadu_ps(&Lights.Fields[cluster_cos][i]), Across),
+					_mm_mul_ps(_mm_loadu_ps(&Lights.Fields[cluster_sin][i]), Along));
+				__m128 const Cone = _mm_and_ps(_mm_and_ps(
+					_mm_cmple_ps(Closest, BoxRadius),
+					_mm_cmple_ps(Along, _mm_add_ps(BoxRadius, _mm_loadu_ps(&Lights.Fields[cluster_range][i])))),
+					_mm_cmpge_ps(Along, NegBoxRadius));
+
+				int const Mask = _mm_movemask_ps(_mm_and_ps(Sphere, Cone));
+				for(std::size_t b = 0; b < 4; ++b)
+					if(Mask & (1 << b))
+						Visit(i + b);
+			}
+#		else
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				vec3 const Light(Lights.Fields[cluster_x][i], Lights.Fields[cluster_y][i], Lights.Fields[cluster_z][i]);
+				vec3 const d = max(max(Min - Light, Light - Max), vec3(0.0f));
+				float const LightRadius = Lights.Fields[cluster_radius][i];
+				if(!(d.x * d.x + d.y * d.y + d.z * d.z <= LightRadius * LightRadius))
+					continue;
+
+				vec3 const v = Center - vec3(Lights.Fields[cluster_apex_x][i], Lights.Fields[cluster_apex_y][i], Lights.Fields[cluster_apex_z][i]);
+				float const Along = v.x * Lights.Fields[cluster_axis_x][i] + v.y * Lights.Fields[cluster_axis_y][i] + v.z * Lights.Fields[cluster_axis_z][i];
+				float const Across = std::sqrt(max(v.x * v.x + v.y * v.y + v.z * v.z - Along * Along, 0.0f));
+				float const Closest = Lights.Fields[cluster_cos][i] * Across - Lights.Fields[cluster_sin][i] * Along;
+				if(Closest <= Radius && Along <= Radius + Lights.Fields[cluster_range][i] && Along >= -Radius)
+					Visit(i);
+			}
+#		endif
+	}
+
+	struct cluster_gather
+	{
+		cluster_lights const * From;
+		cluster_lights * To;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t i) const
+		{
+			for(int f = 0; f < cluster_fields; ++f)
+				To->Fields[f].push_back(From->Fields[f][i]);
+			To->Index.push_back(From->Index[i]);
+		}
+	};
+
+	struct cluster_append
+	{
+		uint const * Index;
+		std::vector<uint> * List;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t i) const
+		{
+			List->push_back(Index[i]);
+		}
+	};
+
+	struct compute_cluster_transform
+	{
+		mat4 const * View;
+		cluster_light const * Lights;
+		cluster_lights * Results;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			mat4 const & m = *View;
+			for(std::size_t i = Begin; i < End; ++i)
+			{
+				cluster_light const & Light = Lights[i];
+				vec3 const Position(m[0] * Light.Position.x + m[1] * Light.Position.y + m[2] * Light.Position.z + m[3]);
+				vec3 const Direction(m[0] * Light.Direction.x + m[1] * Light.Direction.y + m[2] * Light.Direction.z);
+				cluster_set(*Results, i, Position, Direction, Light.Range, Light.Angle, static_cast<uint>(i));
+			}
+		}
+	};
+
+	// Culls the lights against each slice, then each row of tiles of the slice, then each cluster of the row
+	struct compute_cluster_slices
+	{
+		cluster_grid * Grid;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t Begin, std::size_t End, std::size_t Job) const
+		{
+			uint const CountX = Grid->CountX;
+			uint const CountY = Grid->CountY;
+			cluster_lights & Slice = Grid->Candidates[Job * 2 + 0];
+			cluster_lights & Row = Grid->Candidates[Job * 2 + 1];
+
+			for(std::size_t z = Begin; z < End; ++z)
+			{
+				uint const Z = static_cast<uint>(z);
+				std::vector<uint> & List = Grid->SliceIndices[z];
+				uint * Counts = &Grid->Counts[z * CountX * CountY];
+				List.clear();
+				std::fill(Counts, Counts + CountX * CountY, 0u);
+
+				vec3 Min, Max;
+				cluster_bounds(*Grid, 0, CountX, 0, CountY, Z, Min, Max);
+				cluster_clear(Slice);
+				cluster_gather const GatherSlice = {&Grid->Lights, &Slice};
+				cluster_cull(Grid->Lights, Min, Max, GatherSlice);
+				if(Slice.Index.empty())
+					continue;
+				cluster_pad(Slice);
+
+				for(uint y = 0; y < CountY; ++y)
+				{
+					cluster_bounds(*Grid, 0, CountX, y, y + 1, Z, Min, Max);
+					cluster_clear(Row);
+					cluster_gather const GatherRow = {&Slice, &Row};
+					cluster_cull(Slice, Min, Max, GatherRow);
+					if(Row.Index.empty())
+						continue;
+					cluster_pad(Row);
+
+					cluster_append const Append = {&Row.Index[0], &List};
+					for(uint x = 0; x < CountX; ++x)
+					{
+						std::size_t const First = List.size();
+						cluster_bounds(*Grid, x, x + 1, y, y + 1, Z, Min, Max);
+						cluster_cull(Row, Min, Max, Append);
+						Counts[y * CountX + x] = static_cast<uint>(List.size() - First);
+					}
+				}
+			}
+		}
+	};
+
+	// Writes the lists of each slice at its offset, each byte once and in order
+	struct compute_cluster_write
+	{
+		cluster_grid const * Grid;
+		uvec2 * Clusters;
+		uint * Indices;
+		std::size_t Capacity;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			std::size_t const SliceSize = static_cast<std::size_t>(Grid->CountX) * Grid->CountY;
+			for(std::size_t z = Begin; z < End; ++z)
+			{
+				std::vector<uint> const & List = Grid->SliceIndices[z];
+				std::size_t Offset = Grid->SliceOffsets[z];
+				std::size_t Read = 0;
+				for(std::size_t c = z * SliceSize; c < (z + 1) * SliceSize; ++c)
+				{
+					std::size_t const Count = Grid->Counts[c];
+					std::size_t const Written = Offset < Capacity ? std::min(Count, Capacity - Offset) : 0;
+					Clusters[c] = uvec2(static_cast<uint>(Offset), static_cast<uint>(Written));
+					if(Written > 0)
+						std::copy(List.begin() + static_cast<std::ptrdiff_t>(Read), List.begin() + static_cast<std::ptrdiff_t>(Read + Written), Indices + Offset);
+					Read += Count;
+					Offset += Count;
+				}
+			}
+		}
+	};
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER cluster_light pointLight(vec3 const & Position, float Range)
+	{
+		cluster_light const Light = {Position, Range, vec3(0.0f, 0.0f, -1.0f), pi<float>()};
+		return Light;
+	}
+
+	GLM_FUNC_QUALIFIER cluster_light spotLight(vec3 const & Position, vec3 const & Direction, float Range, float Angle)
+	{
+		cluster_light const Light = {Position, Range, Direction, Angle};
+		return Light;
+	}
+
+	GLM_FUNC_QUALIFIER cluster_grid::cluster_grid(uint CountX, uint CountY, uint CountZ, float Fovy, float Aspect, float Near, float Far) :
+		CountX(CountX),
+		CountY(CountY),
+		CountZ(CountZ),
+		Near(Near),
+		Far(Far),
+		Extent(std::tan(Fovy * 0.5f) * Aspect, std::tan(Fovy * 0.5f)),
+		Depths(CountZ + 1)
+	{
+		assert(CountX > 0 && CountY > 0 && CountZ > 0 && Near > 0.0f && Far > Near);
+
+		// Exponential slicing, each slice Far / Near ^ (1 / CountZ) times deeper than the previous one
+		for(uint z = 0; z <= CountZ; ++z)
+			Depths[z] = static_cast<float>(static_cast<double>(Near) * std::pow(static_cast<double>(Far) / static_cast<double>(Near), static_cast<double>(z) / static_cast<double>(CountZ)));
+		Depths[0] = Near;
+		Depths[CountZ] = Far;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t clusterCount(cluster_grid const & Grid)
+	{
+		return static_cast<std::size_t>(Grid.CountX) * Grid.CountY * Grid.CountZ;
+	}
+
+	GLM_FUNC_QUALIFIER vec2 clusterDepthScaleBias(cluster_grid const & Grid)
+	{
+		float const Scale = static_cast<float>(Grid.CountZ) / std::log(Grid.Far / Grid.Near);
+		return vec2(Scale, -std::log(Grid.Near) * Scale);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t clusterIndex(cluster_grid const & Grid, vec3 const & Position)
+	{
+		std::size_t const Outside = clusterCount(Grid);
+		float const Depth = -Position.z;
+		if(!(Depth >= Grid.Near && Depth < Grid.Far))
+			return Outside;
+
+		// Slice from the logarithm of the depth, corrected by the boundaries
+		float const Slice = std::log(Depth / Grid.Near) / std::log(Grid.Far / Grid.Near) * static_cast<float>(Grid.CountZ);
+		uint z = std::min(static_cast<uint>(max(Slice, 0.0f)), Grid.CountZ - 1);
+		while(z > 0 && Depth < Grid.Depths[z])
+			--z;
+		while(z + 1 < Grid.CountZ && Depth >= Grid.Depths[z + 1])
+			++z;
+
+		vec2 const Tile = (vec2(Position) / (Depth * Grid.Extent) * 0.5f + 0.5f) * vec2(static_cast<float>(Grid.CountX), static_cast<float>(Grid.CountY));
+		if(!(Tile.x >= 0.0f && Tile.x < static_cast<float>(Grid.CountX) && Tile.y >= 0.0f && Tile.y < static_cast<float>(Grid.CountY)))
+			return Outside;
+		uint const x = std::min(static_cast<uint>(Tile.x), Grid.CountX - 1);
+		uint const y = std::min(static_cast<uint>(Tile.y), Grid.CountY - 1);
+		return (static_cast<std::size_t>(z) * Grid.CountY + y) * Grid.CountX + x;
+	}
+
+	GLM_FUNC_QUALIFIER void clusterBounds(cluster_grid const & Grid, uint x, uint y, uint z, vec3 & Min, vec3 & Max)
+	{
+		detail::cluster_bounds(Grid, x, x + 1, y, y + 1, z, Min, Max);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t assignLights
+	(
+		cluster_grid & Grid,
+		mat4 const & View,
+		cluster_light const * Lights,
+		std::size_t LightCount,
+		uvec2 * Clusters,
+		uint * Indices,
+		std::size_t Capacity
+	)
+	{
+		detail::cluster_resize(Grid.Lights, LightCount);
+		if(LightCount > 0)
+		{
+			detail::compute_cluster_transform Transform = {&View, Lights, &Grid.Lights};
+			detail::parallel_for(LightCount, 4096, Transform);
+		}
+		detail::cluster_pad(Grid.Lights);
+
+		std::size_t const Jobs = detail::parallel_jobs(Grid.CountZ, 1);
+		if(Grid.Candidates.size() < Jobs * 2)
+			Grid.Candidates.resize(Jobs * 2);
+		Grid.SliceIndices.resize(Grid.CountZ);
+		Grid.SliceOffsets.resize(Grid.CountZ);
+		Grid.Counts.resize(clusterCount(Grid));
+
+		detail::compute_cluster_slices Slices = {&Grid};
+		detail::parallel_for(Grid.CountZ, 1, Slices);
+
+		std::size_t Total = 0;
+		for(std::size_t z = 0; z < Grid.CountZ; ++z)
+		{
+			Grid.SliceOffsets[z] = Total;
+			Total += Grid.SliceIndices[z].size();
+		}
+
+		detail::compute_cluster_write Write = {&Grid, Clusters, Indices, Capacity};
+		detail::parallel_for(Grid.CountZ, 1, Write);
+
+		return Total;
+	}
+}//namespace glm
@@ -8,12 +8,17 @@
 ///
 /// @brief Related to RGB to HSV conversions and operations.
 ///
+/// The batch conversions process interleaved or planar buffers of floating point or 8-bit channels, four pixels
+/// at a time with SSE2 instructions for single precision and 8-bit buffers, and split large buffers in strips
+/// converted by several threads. 8-bit hues are stored in 255/360 units, other 8-bit channels are normalized.
+///
 /// <glm/gtx/color_space.hpp> need to be included to use these functionalities.
 
 #pragma once
 
 // Dependency:
 #include "../glm.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTX_color_space extension included")
@@ -35,6 +40,50 @@ namespace glm
 	template <typename T, precision P>
 	GLM_FUNC_DECL tvec3<T, P> hsvColor(
 		tvec3<T, P> const & rgbValue);
+
+	/// Converts Count colors from HSV color space to RGB color space, matching rgbColor.
+	/// T is a floating point type or uint8. hsvValues and rgbValues may be the same buffer.
+	/// @see gtx_color_space
+	template <typename T, precision P>
+	GLM_FUNC_DECL void rgbColor(
+		tvec3<T, P> const * hsvValues,
+		tvec3<T, P> * rgbValues,
+		std::size_t Count);
+
+	/// Converts Count colors from HSV color space to RGB color space, matching rgbColor, with planar buffers.
+	/// T is a floating point type or uint8. Input and output buffers may be the same.
+	/// @see gtx_color_space
+	template <typename T>
+	GLM_FUNC_DECL void rgbColor(
+		T const * h,
+		T const * s,
+		T const * v,
+		T * r,
+		T * g,
+		T * b,
+		std::size_t Count);
+
+	/// Converts Count colors from RGB color space to HSV color space, matching hsvColor.
+	/// T is a floating point type or uint8. rgbValues and hsvValues may be the same buffer.
+	/// @see gtx_color_space
+	template <typename T, precision P>
+	GLM_FUNC_DECL void hsvColor(
+		tvec3<T, P> const * rgbValues,
+		tvec3<T, P> * hsvValues,
+		std::size_t Count);
+
+	/// Converts Count colors from RGB color space to HSV color space, matching hsvColor, with planar buffers.
+	/// T is a floating point type or uint8. Input and output buffers may be the same.
+	/// @see gtx_color_space
+	template <typename T>
+	GLM_FUNC_DECL void hsvColor(
+		T const * r,
+		T const * g,
+		T const * b,
+		T * h,
+		T * s,
+		T * v,
+		std::size_t Count);
 		
 	/// Build a saturation matrix.
 	/// @see gtx_color_space
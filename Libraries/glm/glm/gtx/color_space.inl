@@ -1,6 +1,8 @@
 /// @ref gtx_color_space
 /// @file glm/gtx/color_space.inl
 
+#include "../detail/_color_batch.hpp"
+
 namespace glm
 {
 	template <typename T, precision P>
@@ -75,7 +77,10 @@ namespace glm
 			hsv.y = Delta / hsv.z;    
 			T h = static_cast<T>(0);
 
-			if(rgbColor.r == Max)
+			if(Delta == static_cast<T>(0))
+				// grey, h is undefined
+				h = static_cast<T>(0);
+			else if(rgbColor.r == Max)
 				// between yellow & magenta
 				h = static_cast<T>(0) + T(60) * (rgbColor.g - rgbColor.b) / Delta;
 			else if(rgbColor.g == Max)
@@ -139,3 +144,94 @@ namespace glm
 		return dot(color, tmp);
 	}
 }//namespace glm
+
+namespace glm{
+namespace detail
+{
+	template <typename T>
+	struct compute_rgb_color_soa4
+	{
+		GLM_FUNC_QUALIFIER static void call(T const * h, T const * s, T const * v, T * r, T * g, T * b)
+		{
+			for(std::size_t i = 0; i < 4; ++i)
+			{
+				tvec3<T, defaultp> const Color = rgbColor(tvec3<T, defaultp>(h[i], s[i], v[i]));
+				r[i] = Color.r;
+				g[i] = Color.g;
+				b[i] = Color.b;
+			}
+		}
+	};
+
+	template <typename T>
+	struct compute_hsv_color_soa4
+	{
+		GLM_FUNC_QUALIFIER static void call(T const * r, T const * g, T const * b, T * h, T * s, T * v)
+		{
+			for(std::size_t i = 0; i < 4; ++i)
+			{
+				tvec3<T, defaultp> const Color = hsvColor(tvec3<T, defaultp>(r[i], g[i], b[i]));
+				h[i] = Color.x;
+				s[i] = Color.y;
+				v[i] = Color.z;
+			}
+		}
+	};
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void rgbColor
+	(
+		tvec3<T, P> const * hsvValues,
+		tvec3<T, P> * rgbValues,
+		std::size_t Count
+	)
+	{
+		detail::color_convert<detail::compute_rgb_color_soa4>(hsvValues, rgbValues, Count, detail::color_encoding_hsv(), detail::color_encoding_rgb());
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void rgbColor
+	(
+		T const * h,
+		T const * s,
+		T const * v,
+		T * r,
+		T * g,
+		T * b,
+		std::size_t Count
+	)
+	{
+		detail::color_convert<detail::compute_rgb_color_soa4>(h, s, v, r, g, b, Count, detail::color_encoding_hsv(), detail::color_encoding_rgb());
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void hsvColor
+	(
+		tvec3<T, P> const * rgbValues,
+		tvec3<T, P> * hsvValues,
+		std::size_t Count
+	)
+	{
+		detail::color_convert<detail::compute_hsv_color_soa4>(rgbValues, hsvValues, Count, detail::color_encoding_rgb(), detail::color_encoding_hsv());
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void hsvColor
+	(
+		T const * r,
+		T const * g,
+		T const * b,
+		T * h,
+		T * s,
+		T * v,
+		std::size_t Count
+	)
+	{
+		detail::color_convert<detail::compute_hsv_color_soa4>(r, g, b, h, s, v, Count, detail::color_encoding_rgb(), detail::color_encoding_hsv());
+	}
+}//namespace glm
+
+#if GLM_ARCH != GLM_ARCH_PURE
+#	include "color_space_simd.inl"
+#endif
@@ -8,12 +8,17 @@
 ///
 /// @brief RGB to YCoCg conversions and operations
 ///
+/// The batch conversions process interleaved or planar buffers of floating point or 8-bit channels, four pixels
+/// at a time with SSE2 instructions for single precision and 8-bit buffers, and split large buffers in strips
+/// converted by several threads. 8-bit chrominances are offset by 128.
+///
 /// <glm/gtx/color_space_YCoCg.hpp> need to be included to use these functionalities.
 
 #pragma once
 
 // Dependency:
 #include "../glm.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTX_color_space_YCoCg extension included")
@@ -36,6 +41,50 @@ namespace glm
 	GLM_FUNC_DECL tvec3<T, P> YCoCg2rgb(
 		tvec3<T, P> const & YCoCgColor);
 
+	/// Converts Count colors from RGB color space to YCoCg color space, matching rgb2YCoCg.
+	/// T is a floating point type or uint8. rgbColors and YCoCgColors may be the same buffer.
+	/// @see gtx_color_space_YCoCg
+	template <typename T, precision P>
+	GLM_FUNC_DECL void rgb2YCoCg(
+		tvec3<T, P> const * rgbColors,
+		tvec3<T, P> * YCoCgColors,
+		std::size_t Count);
+
+	/// Converts Count colors from RGB color space to YCoCg color space, matching rgb2YCoCg, with planar buffers.
+	/// T is a floating point type or uint8. Input and output buffers may be the same.
+	/// @see gtx_color_space_YCoCg
+	template <typename T>
+	GLM_FUNC_DECL void rgb2YCoCg(
+		T const * r,
+		T const * g,
+		T const * b,
+		T * Y,
+		T * Co,
+		T * Cg,
+		std::size_t Count);
+
+	/// Converts Count colors from YCoCg color space to RGB color space, matching YCoCg2rgb.
+	/// T is a floating point type or uint8. YCoCgColors and rgbColors may be the same buffer.
+	/// @see gtx_color_space_YCoCg
+	template <typename T, precision P>
+	GLM_FUNC_DECL void YCoCg2rgb(
+		tvec3<T, P> const * YCoCgColors,
+		tvec3<T, P> * rgbColors,
+		std::size_t Count);
+
+	/// Converts Count colors from YCoCg color space to RGB color space, matching YCoCg2rgb, with planar buffers.
+	/// T is a floating point type or uint8. Input and output buffers may be the same.
+	/// @see gtx_color_space_YCoCg
+	template <typename T>
+	GLM_FUNC_DECL void YCoCg2rgb(
+		T const * Y,
+		T const * Co,
+		T const * Cg,
+		T * r,
+		T * g,
+		T * b,
+		std::size_t Count);
+
 	/// Convert a color from RGB color space to YCoCgR color space.
 	/// @see "YCoCg-R: A Color Space with RGB Reversibility and Low Dynamic Range"
 	/// @see gtx_color_space_YCoCg
@@ -1,6 +1,8 @@
 /// @ref gtx_color_space_YCoCg
 /// @file glm/gtx/color_space_YCoCg.inl
 
+#include "../detail/_color_batch.hpp"
+
 namespace glm
 {
 	template <typename T, precision P>
@@ -106,3 +108,94 @@ namespace glm
 		return compute_YCoCgR<T, P, std::numeric_limits<T>::is_integer>::YCoCgR2rgb(YCoCgRColor);
 	}
 }//namespace glm
+
+namespace glm{
+namespace detail
+{
+	template <typename T>
+	struct compute_rgb2YCoCg_soa4
+	{
+		GLM_FUNC_QUALIFIER static void call(T const * r, T const * g, T const * b, T * Y, T * Co, T * Cg)
+		{
+			for(std::size_t i = 0; i < 4; ++i)
+			{
+				tvec3<T, defaultp> const Color = rgb2YCoCg(tvec3<T, defaultp>(r[i], g[i], b[i]));
+				Y[i] = Color.x;
+				Co[i] = Color.y;
+				Cg[i] = Color.z;
+			}
+		}
+	};
+
+	template <typename T>
+	struct compute_YCoCg2rgb_soa4
+	{
+		GLM_FUNC_QUALIFIER static void call(T const * Y, T const * Co, T const * Cg, T * r, T * g, T * b)
+		{
+			for(std::size_t i = 0; i < 4; ++i)
+			{
+				tvec3<T, defaultp> const Color = YCoCg2rgb(tvec3<T, defaultp>(Y[i], Co[i], Cg[i]));
+				r[i] = Color.r;
+				g[i] = Color.g;
+				b[i] = Color.b;
+			}
+		}
+	};
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void rgb2YCoCg
+	(
+		tvec3<T, P> const * rgbColors,
+		tvec3<T, P> * YCoCgColors,
+		std::size_t Count
+	)
+	{
+		detail::color_convert<detail::compute_rgb2YCoCg_soa4>(rgbColors, YCoCgColors, Count, detail::color_encoding_rgb(), detail::color_encoding_YCoCg());
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void rgb2YCoCg
+	(
+		T const * r,
+		T const * g,
+		T const * b,
+		T * Y,
+		T * Co,
+		T * Cg,
+		std::size_t Count
+	)
+	{
+		detail::color_convert<detail::compute_rgb2YCoCg_soa4>(r, g, b, Y, Co, Cg, Count, detail::color_encoding_rgb(), detail::color_encoding_YCoCg());
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void YCoCg2rgb
+	(
+		tvec3<T, P> const * YCoCgColors,
+		tvec3<T, P> * rgbColors,
+		std::size_t Count
+	)
+	{
+		detail::color_convert<detail::compute_YCoCg2rgb_soa4>(YCoCgColors, rgbColors, Count, detail::color_encoding_YCoCg(), detail::color_encoding_rgb());
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void YCoCg2rgb
+	(
+		T const * Y,
+		T const * Co,
+		T const * Cg,
+		T * r,
+		T * g,
+		T * b,
+		std::size_t Count
+	)
+	{
+		detail::color_convert<detail::compute_YCoCg2rgb_soa4>(Y, Co, Cg, r, g, b, Count, detail::color_encoding_YCoCg(), detail::color_encoding_rgb());
+	}
+}//namespace glm
+
+#if GLM_ARCH != GLM_ARCH_PURE
+#	include "color_space_YCoCg_simd.inl"
+#endif
@@ -0,0 +1,49 @@
+/// @ref gtx_color_space_YCoCg
+/// @file glm/gtx/color_space_YCoCg_simd.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	// Same operations in the same order as rgb2YCoCg and YCoCg2rgb so that results are identical
+	template <>
+	struct compute_rgb2YCoCg_soa4<float>
+	{
+		GLM_FUNC_QUALIFIER static void call(float const * r, float const * g, float const * b, float * Y, float * Co, float * Cg)
+		{
+			glm_vec4 const vr = _mm_loadu_ps(r);
+			glm_vec4 const vg = _mm_loadu_ps(g);
+			glm_vec4 const vb = _mm_loadu_ps(b);
+			glm_vec4 const Half = _mm_set1_ps(0.5f);
+			glm_vec4 const Quarter = _mm_set1_ps(0.25f);
+
+			glm_vec4 const r4 = _mm_mul_ps(vr, Quarter);
+			glm_vec4 const g2 = _mm_mul_ps(vg, Half);
+			glm_vec4 const b4 = _mm_mul_ps(vb, Quarter);
+			glm_vec4 const Sign = _mm_set1_ps(-0.0f);
+
+			_mm_storeu_ps(Y, _mm_add_ps(_mm_add_ps(r4, g2), b4));
+			_mm_storeu_ps(Co, _mm_sub_ps(_mm_add_ps(_mm_mul_ps(vr, Half), _mm_mul_ps(vg, _mm_setzero_ps())), _mm_mul_ps(vb, Half)));
+			_mm_storeu_ps(Cg, _mm_sub_ps(_mm_add_ps(_mm_xor_ps(r4, Sign), g2), b4));
+		}
+	};
+
+	template <>
+	struct compute_YCoCg2rgb_soa4<float>
+	{
+		GLM_FUNC_QUALIFIER static void call(float const * Y, float const * Co, float const * Cg, float * r, float * g, float * b)
+		{
+			glm_vec4 const vY = _mm_loadu_ps(Y);
+			glm_vec4 const vCo = _mm_loadu_ps(Co);
+			glm_vec4 const vCg = _mm_loadu_ps(Cg);
+
+			_mm_storeu_ps(r, _mm_sub_ps(_mm_add_ps(vY, vCo), vCg));
+			_mm_storeu_ps(g, _mm_add_ps(vY, vCg));
+			_mm_storeu_ps(b, _mm_sub_ps(_mm_sub_ps(vY, vCo), vCg));
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
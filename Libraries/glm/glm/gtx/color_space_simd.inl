@@ -0,0 +1,92 @@
+/// @ref gtx_color_space
+/// @file glm/gtx/color_space_simd.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/common.h"
+
+namespace glm{
+namespace detail
+{
+	GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_color_select(glm_vec4 Mask, glm_vec4 a, glm_vec4 b)
+	{
+		return _mm_or_ps(_mm_and_ps(Mask, a), _mm_andnot_ps(Mask, b));
+	}
+
+	// The switch on the hue sector of rgbColor becomes a selection per channel, sectors out of [0, 5] behaving as sector 0
+	template <>
+	struct compute_rgb_color_soa4<float>
+	{
+		GLM_FUNC_QUALIFIER static void call(float const * h, float const * s, float const * v, float * r, float * g, float * b)
+		{
+			glm_vec4 const vh = _mm_loadu_ps(h);
+			glm_vec4 const vs = _mm_loadu_ps(s);
+			glm_vec4 const vv = _mm_loadu_ps(v);
+			glm_vec4 const One = _mm_set1_ps(1.0f);
+
+			glm_vec4 const Sixth = _mm_div_ps(vh, _mm_set1_ps(60.0f));
+			glm_vec4 const Sector = glm_vec4_floor(Sixth);
+			glm_vec4 const Frac = _mm_sub_ps(Sixth, Sector);
+			glm_vec4 const o = _mm_mul_ps(vv, _mm_sub_ps(One, vs));
+			glm_vec4 const p = _mm_mul_ps(vv, _mm_sub_ps(One, _mm_mul_ps(vs, Frac)));
+			glm_vec4 const q = _mm_mul_ps(vv, _mm_sub_ps(One, _mm_mul_ps(vs, _mm_sub_ps(One, Frac))));
+
+			glm_vec4 const Sector1 = _mm_cmpeq_ps(Sector, One);
+			glm_vec4 const Sector2 = _mm_cmpeq_ps(Sector, _mm_set1_ps(2.0f));
+			glm_vec4 const Sector3 = _mm_cmpeq_ps(Sector, _mm_set1_ps(3.0f));
+			glm_vec4 const Sector4 = _mm_cmpeq_ps(Sector, _mm_set1_ps(4.0f));
+			glm_vec4 const Sector5 = _mm_cmpeq_ps(Sector, _mm_set1_ps(5.0f));
+
+			glm_vec4 vr = glm_vec4_color_select(Sector1, p, vv);
+			vr = glm_vec4_color_select(_mm_or_ps(Sector2, Sector3), o, vr);
+			vr = glm_vec4_color_select(Sector4, q, vr);
+
+			glm_vec4 vg = glm_vec4_color_select(_mm_or_ps(Sector1, Sector2), vv, q);
+			vg = glm_vec4_color_select(Sector3, p, vg);
+			vg = glm_vec4_color_select(_mm_or_ps(Sector4, Sector5), o, vg);
+
+			glm_vec4 vb = glm_vec4_color_select(Sector2, q, o);
+			vb = glm_vec4_color_select(_mm_or_ps(Sector3, Sector4), vv, vb);
+			vb = glm_vec4_color_select(Sector5, p, vb);
+
+			// Achromatic
+			glm_vec4 const Grey = _mm_cmpeq_ps(vs, _mm_setzero_ps());
+			_mm_storeu_ps(r, glm_vec4_color_select(Grey, vv, vr));
+			_mm_storeu_ps(g, glm_vec4_color_select(Grey, vv, vg));
+			_mm_storeu_ps(b, glm_vec4_color_select(Grey, vv, vb));
+		}
+	};
+
+	// The three hues of hsvColor are computed and the one of the first maximum channel is selected
+	template <>
+	struct compute_hsv_color_soa4<float>
+	{
+		GLM_FUNC_QUALIFIER static void call(float const * r, float const * g, float const * b, float * h, float * s, float * v)
+		{
+			glm_vec4 const vr = _mm_loadu_ps(r);
+			glm_vec4 const vg = _mm_loadu_ps(g);
+			glm_vec4 const vb = _mm_loadu_ps(b);
+			glm_vec4 const Zero = _mm_setzero_ps();
+			glm_vec4 const Sixty = _mm_set1_ps(60.0f);
+
+			glm_vec4 const Max = _mm_max_ps(_mm_max_ps(vr, vg), vb);
+			glm_vec4 const Min = _mm_min_ps(_mm_min_ps(vr, vg), vb);
+			glm_vec4 const Delta = _mm_sub_ps(Max, Min);
+
+			glm_vec4 const HueR = _mm_div_ps(_mm_mul_ps(Sixty, _mm_sub_ps(vg, vb)), Delta);
+			glm_vec4 const HueG = _mm_add_ps(_mm_set1_ps(120.0f), _mm_div_ps(_mm_mul_ps(Sixty, _mm_sub_ps(vb, vr)), Delta));
+			glm_vec4 const HueB = _mm_add_ps(_mm_set1_ps(240.0f), _mm_div_ps(_mm_mul_ps(Sixty, _mm_sub_ps(vr, vg)), Delta));
+			glm_vec4 Hue = glm_vec4_color_select(_mm_cmpeq_ps(vr, Max), HueR, glm_vec4_color_select(_mm_cmpeq_ps(vg, Max), HueG, HueB));
+			Hue = _mm_add_ps(Hue, _mm_and_ps(_mm_cmplt_ps(Hue, Zero), _mm_set1_ps(360.0f)));
+
+			// Black and greys have no hue
+			glm_vec4 const NotBlack = _mm_cmpneq_ps(Max, Zero);
+			_mm_storeu_ps(h, _mm_and_ps(_mm_and_ps(NotBlack, _mm_cmpneq_ps(Delta, Zero)), Hue));
+			_mm_storeu_ps(s, _mm_and_ps(NotBlack, _mm_div_ps(Delta, Max)));
+			_mm_storeu_ps(v, Max);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,56 @@
+/// @ref gtx_distance_field
+/// @file glm/gtx/distance_field.hpp
+///
+/// @see core (dependence)
+/// @see gtx_closest_point (dependence)
+///
+/// @defgroup gtx_distance_field GLM_GTX_distance_field
+/// @ingroup gtx
+///
+/// @brief Signed distance fields of triangle meshes sampled on regular grids.
+///
+/// Distances are exact in a narrow band around the triangles, computed per brick of 8^3 grid vertices.
+/// Beyond the band, the closest triangle of each grid vertex is propagated by sweeps along the grid axes,
+/// giving upper bounds of the distances that are within a fraction of the grid spacing for smooth meshes.
+/// The sign comes from the winding number of rays along +x, using exact orientation tests with symbolic
+/// perturbation so that rays going through edges and vertices are counted once.
+///
+/// <glm/gtx/distance_field.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtx/closest_point.hpp"
+#include <cstddef>
+#include <vector>
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_distance_field extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_distance_field
+	/// @{
+
+	/// Computes the signed distance to a closed triangle mesh at the vertices of a grid:
+	/// Distances[x + Size.x * (y + Size.y * z)] is the distance of Origin + Spacing * (x, y, z) to the mesh,
+	/// negative inside. Distances are exact within Band grid spacings of the triangles bounding boxes.
+	/// Without triangles, all the distances are the largest value of T.
+	/// @see gtx_distance_field
+	template <typename T, precision P>
+	GLM_FUNC_DECL void distanceField(
+		tvec3<T, P> const * Positions,
+		uint const * Indices,
+		std::size_t TriangleCount,
+		tvec3<T, P> const & Origin,
+		T Spacing,
+		tvec3<int, P> const & Size,
+		int Band,
+		T * Distances);
+
+	/// @}
+}//namespace glm
+
+#include "distance_field.inl"
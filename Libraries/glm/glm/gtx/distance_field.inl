@@ -0,0 +1,411 @@
+/// @ref gtx_distance_field
+/// @file glm/gtx/distance_field.inl
+
+#include "../detail/_parallel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	// Orientation of the origin relative to the 2D segment (x0, y0) (x1, y1), ties broken by symbolic perturbation
+	// so that exactly one of the triangles sharing an edge or a vertex contains a point lying on it.
+	GLM_FUNC_QUALIFIER int distance_field_orientation(double x0, double y0, double x1, double y1, double & TwiceSignedArea)
+	{
+		TwiceSignedArea = y0 * x1 - x0 * y1;
+		if(TwiceSignedArea > 0.0) return 1;
+		if(TwiceSignedArea < 0.0) return -1;
+		if(y1 > y0) return 1;
+		if(y1 < y0) return -1;
+		if(x0 > x1) return 1;
+		if(x0 < x1) return -1;
+		return 0;
+	}
+
+	// Whether the 2D point (x, y) is inside the triangle of the 2D points p, returning the facing of the triangle
+	// and the barycentric coordinates of the point.
+	GLM_FUNC_QUALIFIER int distance_field_crossing(double x, double y, double const p[3][2], double Barycentric[3])
+	{
+		double const x0 = p[0][0] - x, y0 = p[0][1] - y;
+		double const x1 = p[1][0] - x, y1 = p[1][1] - y;
+		double const x2 = p[2][0] - x, y2 = p[2][1] - y;
+
+		int const Sign0 = distance_field_orientation(x1, y1, x2, y2, Barycentric[0]);
+		if(Sign0 == 0)
+			return 0;
+		if(distance_field_orientation(x2, y2, x0, y0, Barycentric[1]) != Sign0)
+			return 0;
+		if(distance_field_orientation(x0, y0, x1, y1, Barycentric[2]) != Sign0)
+			return 0;
+
+		double const Sum = Barycentric[0] + Barycentric[1] + Barycentric[2];
+		if(Sum == 0.0)
+			return 0;
+		Barycentric[0] /= Sum;
+		Barycentric[1] /= Sum;
+		Barycentric[2] /= Sum;
+		return Sign0;
+	}
+
+	template <typename T, precision P>
+	struct distance_field_mesh
+	{
+		tvec3<T, P> const * Positions;
+		uint const * Indices;
+		tvec3<T, P> Origin;
+		T Spacing;
+		std::size_t SizeX;
+		std::size_t SizeY;
+		std::size_t SizeZ;
+
+		tvec3<T, P> position(std::size_t x, std::size_t y, std::size_t z) const
+		{
+			return Origin + tvec3<T, P>(static_cast<T>(x), static_cast<T>(y), static_cast<T>(z)) * Spacing;
+		}
+
+		T distance(tvec3<T, P> const & Point, std::size_t Triangle) const
+		{
+			tvec3<T, P> const & a = Positions[Indices[Triangle * 3 + 0]];
+			tvec3<T, P> const & b = Positions[Indices[Triangle * 3 + 1]];
+			tvec3<T, P> const & c = Positions[Indices[Triangle * 3 + 2]];
+			return length(Point - closestPointOnTriangle(Point, a, b, c));
+		}
+
+		// Range of grid vertices within Band spacings of the bounding box of a triangle, false if it's empty
+		bool bounds(std::size_t Triangle, int Band, std::size_t Min[3], std::size_t Max[3]) const
+		{
+			tvec3<T, P> const & a = Positions[Indices[Triangle * 3 + 0]];
+			tvec3<T, P> const & b = Positions[Indices[Triangle * 3 + 1]];
+			tvec3<T, P> const & c = Positions[Indices[Triangle * 3 + 2]];
+			tvec3<T, P> const Lower = (min(min(a, b), c) - Origin) / Spacing;
+			tvec3<T, P> const Upper = (max(max(a, b), c) - Origin) / Spacing;
+			std::size_t const Size[3] = {SizeX, SizeY, SizeZ};
+			for(int Axis = 0; Axis < 3; ++Axis)
+			{
+				T const First = floor(Lower[Axis]) - static_cast<T>(Band);
+				T const Last = ceil(Upper[Axis]) + static_cast<T>(Band);
+				if(Last < T(0) || First > static_cast<T>(Size[Axis] - 1))
+					return false;
+				Min[Axis] = First > T(0) ? static_cast<std::size_t>(First) : 0;
+				Max[Axis] = Last < static_cast<T>(Size[Axis] - 1) ? static_cast<std::size_t>(Last) : Size[Axis] - 1;
+			}
+			return true;
+		}
+	};
+
+	// Exact distances in the band around the triangles overlapping each brick of 8^3 grid vertices
+	template <typename T, precision P>
+	struct compute_distance_band
+	{
+		distance_field_mesh<T, P> Mesh;
+		int Band;
+		std::size_t BricksX;
+		std::size_t BricksY;
+		std::size_t const * BrickBase;
+		uint const * BrickTriangles;
+		T * Distances;
+		uint * Closest;
+
+		void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			for(std::size_t Brick = Begin; Brick < End; ++Brick)
+			{
+				std::size_t const First[3] = {(Brick % BricksX) * 8, (Brick / BricksX % BricksY) * 8, (Brick / (BricksX * BricksY)) * 8};
+				std::size_t const Size[3] = {Mesh.SizeX, Mesh.SizeY, Mesh.SizeZ};
+				std::size_t Last[3];
+				for(int Axis = 0; Axis < 3; ++Axis)
+					Last[Axis] = (First[Axis] + 8 < Size[Axis] ? First[Axis] + 8 : Size[Axis]) - 1;
+
+				for(std::size_t z = First[2]; z <= Last[2]; ++z)
+				for(std::size_t y = First[1]; y <= Last[1]; ++y)
+				for(std::size_t x = First[0]; x <= Last[0]; ++x)
+				{
+					std::size_t const i = (z * Mesh.SizeY + y) * Mesh.SizeX + x;
+					Distances[i] = std::numeric_limits<T>::max();
+					Closest[i] = ~uint(0);
+				}
+
+				for(std::size_t t = BrickBase[Brick]; t < BrickBase[Brick + 1]; ++t)
+				{
+					std::size_t Min[3], Max[3];
+					Mesh.bounds(BrickTriangles[t], Band, Min, Max);
+					for(int Axis = 0; Axis < 3; ++Axis)
+					{
+						Min[Axis] = Min[Axis] > First[Axis] ? Min[Axis] : First[Axis];
+						Max[Axis] = Max[Axis] < Last[Axis] ? Max[Axis] : Last[Axis];
+					}
+
+					for(std::size_t z = Min[2]; z <= Max[2]; ++z)
+					for(std::size_t y = Min[1]; y <= Max[1]; ++y)
+					for(std::size_t x = Min[0]; x <= Max[0]; ++x)
+					{
+						std::size_t const i = (z * Mesh.SizeY + y) * Mesh.SizeX + x;
+						T const Distance = Mesh.distance(Mesh.position(x, y, z), BrickTriangles[t]);
+						if(Distance < Distances[i])
+						{
+							Distances[i] = Distance;
+							Closest[i] = BrickTriangles[t];
+						}
+					}
+				}
+			}
+		}
+	};
+
+	// Propagates the closest triangles along one axis, forward then backward. Lines along x are swept one
+	// grid vertex at a time, lines along y and z one row along x at a time, z layers and y rows being independent.
+	template <typename T, precision P>
+	struct compute_distance_sweep
+	{
+		distance_field_mesh<T, P> Mesh;
+		int Axis;
+		T * Distances;
+		uint * Closest;
+
+		void propagate(std::size_t From, std::size_t To, std::size_t x, std::size_t y, std::size_t z) const
+		{
+			uint const Triangle = Closest[From];
+			if(Triangle == ~uint(0) || Triangle == Closest[To])
+				return;
+			T const Distance = Mesh.distance(Mesh.position(x, y, z), Triangle);
+			if(Distance < Distances[To])
+			{
+				Distances[To] = Distance;
+				Closest[To] = Triangle;
+			}
+		}
+
+		// Rows also take the closest triangles of the diagonal neighbors along x
+		void propagateRow(std::size_t PreviousRow, std::size_t Row, std::size_t x, std::size_t y, std::size_t z) const
+		{
+			if(x > 0)
+				propagate(PreviousRow + x - 1, Row + x, x, y, z);
+			propagate(PreviousRow + x, Row + x, x, y, z);
+			if(x + 1 < Mesh.SizeX)
+				propagate(PreviousRow + x + 1, Row + x, x, y, z);
+		}
+
+		void step(std::size_t Line, std::size_t Step, std::size_t Previous) const
+		{
+			std::size_t const Layer = Mesh.SizeX * Mesh.SizeY;
+			if(Axis == 0)
+			{
+				std::size_t const Row = Line * Mesh.SizeX;
+				propagate(Row + Previous, Row + Step, Step, Line % Mesh.SizeY, Line / Mesh.SizeY);
+			}
+			else if(Axis == 1)
+			{
+				std::size_t const Row = Line * Layer + Step * Mesh.SizeX;
+				std::size_t const PreviousRow = Line * Layer + Previous * Mesh.SizeX;
+				for(std::size_t x = 0; x < Mesh.SizeX; ++x)
+					propagateRow(PreviousRow, Row, x, Step, Line);
+			}
+			else
+			{
+				std::size_t const Row = Step * Layer + Line * Mesh.SizeX;
+				std::size_t const PreviousRow = Previous * Layer + Line * Mesh.SizeX;
+				for(std::size_t x = 0; x < Mesh.SizeX; ++x)
+					propagateRow(PreviousRow, Row, x, Line, Step);
+			}
+		}
+
+		void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			std::size_t const Steps = Axis == 0 ? Mesh.SizeX : Axis == 1 ? Mesh.SizeY : Mesh.SizeZ;
+			for(std::size_t Line = Begin; Line < End; ++Line)
+			{
+				for(std::size_t s = 1; s < Steps; ++s)
+					step(Line, s, s - 1);
+				for(std::size_t s = Steps - 1; s > 0; --s)
+					step(Line, s - 1, s);
+			}
+		}
+	};
+
+	// Negates the distances of the grid vertices with a non zero winding number, one z layer at a time.
+	// Crossings of the +x rays with the triangles are accumulated at the first grid vertex after them.
+	template <typename T, precision P>
+	struct compute_distance_sign
+	{
+		distance_field_mesh<T, P> Mesh;
+		std::size_t const * LayerBase;
+		uint const * LayerTriangles;
+		T * Distances;
+
+		void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			std::vector<int> Winding(Mesh.SizeX * Mesh.SizeY);
+			for(std::size_t z = Begin; z < End; ++z)
+			{
+				std::fill(Winding.begin(), Winding.end(), 0);
+
+				for(std::size_t t = LayerBase[z]; t < LayerBase[z + 1]; ++t)
+				{
+					std::size_t const Triangle = LayerTriangles[t];
+					double Grid[3][3];
+					double Projected[3][2];
+					for(int k = 0; k < 3; ++k)
+					{
+						tvec3<T, P> const p = (Mesh.Positions[Mesh.Indices[Triangle * 3 + k]] - Mesh.Origin) / Mesh.Spacing;
+						Grid[k][0] = static_cast<double>(p.x);
+						Grid[k][1] = static_cast<double>(p.y);
+						Grid[k][2] = static_cast<double>(p.z);
+						Projected[k][0] = Grid[k][1];
+						Projected[k][1] = Grid[k][2];
+					}
+
+					double const MinY = std::min(std::min(Grid[0][1], Grid[1][1]), Grid[2][1]);
+					double const MaxY = std::max(std::max(Grid[0][1], Grid[1][1]), Grid[2][1]);
+					double const SizeY = static_cast<double>(Mesh.SizeY - 1);
+					if(MaxY < 0.0 || MinY > SizeY)
+						continue;
+					std::size_t const FirstY = MinY > 0.0 ? static_cast<std::size_t>(std::ceil(MinY)) : 0;
+					std::size_t const LastY = MaxY < SizeY ? static_cast<std::size_t>(std::floor(MaxY)) : Mesh.SizeY - 1;
+
+					for(std::size_t y = FirstY; y <= LastY; ++y)
+					{
+						double Barycentric[3];
+						int const Sign = distance_field_crossing(static_cast<double>(y), static_cast<double>(z), Projected, Barycentric);
+						if(Sign == 0)
+							continue;
+
+						double const x = Barycentric[0] * Grid[0][0] + Barycentric[1] * Grid[1][0] + Barycentric[2] * Grid[2][0];
+						if(x > static_cast<double>(Mesh.SizeX - 1))
+							continue;
+						std::size_t const First = x > 0.0 ? static_cast<std::size_t>(std::ceil(x)) : 0;
+						Winding[y * Mesh.SizeX + First] += Sign;
+					}
+				}
+
+				for(std::size_t y = 0; y < Mesh.SizeY; ++y)
+				{
+					int Sum = 0;
+					for(std::size_t x = 0; x < Mesh.SizeX; ++x)
+					{
+						Sum += Winding[y * Mesh.SizeX + x];
+						if(Sum != 0)
+						{
+							T & Distance = Distances[(z * Mesh.SizeY + y) * Mesh.SizeX + x];
+							Distance = -Distance;
+						}
+					}
+				}
+			}
+		}
+	};
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void distanceField
+	(
+		tvec3<T, P> const * Positions,
+		uint const * Indices,
+		std::size_t TriangleCount,
+		tvec3<T, P> const & Origin,
+		T Spacing,
+		tvec3<int, P> const & Size,
+		int Band,
+		T * Distances
+	)
+	{
+		if(Size.x < 1 || Size.y < 1 || Size.z < 1)
+			return;
+
+		detail::distance_field_mesh<T, P> const Mesh = {
+			Positions, Indices, Origin, Spacing,
+			static_cast<std::size_t>(Size.x), static_cast<std::size_t>(Size.y), static_cast<std::size_t>(Size.z)};
+		std::size_t const VoxelCount = Mesh.SizeX * Mesh.SizeY * Mesh.SizeZ;
+
+		if(TriangleCount == 0)
+		{
+			std::fill(Distances, Distances + VoxelCount, std::numeric_limits<T>::max());
+			return;
+		}
+		Band = Band > 1 ? Band : 1;
+
+		// Bins the triangles into the bricks overlapped by their band, in triangle order
+		std::size_t const BricksX = (Mesh.SizeX + 7) / 8;
+		std::size_t const BricksY = (Mesh.SizeY + 7) / 8;
+		std::size_t const BricksZ = (Mesh.SizeZ + 7) / 8;
+		std::size_t const BrickCount = BricksX * BricksY * BricksZ;
+		std::vector<std::size_t> BrickBase(BrickCount + 1, 0);
+		std::vector<uint> BrickTriangles;
+		for(int Pass = 0; Pass < 2; ++Pass)
+		{
+			std::vector<std::size_t> Offsets(BrickBase.begin(), BrickBase.end() - 1);
+			for(std::size_t t = 0; t < TriangleCount; ++t)
+			{
+				std::size_t Min[3], Max[3];
+				if(!Mesh.bounds(t, Band, Min, Max))
+					continue;
+				for(std::size_t z = Min[2] / 8; z <= Max[2] / 8; ++z)
+				for(std::size_t y = Min[1] / 8; y <= Max[1] / 8; ++y)
+				for(std::size_t x = Min[0] / 8; x <= Max[0] / 8; ++x)
+				{
+					std::size_t const Brick = (z * BricksY + y) * BricksX + x;
+					if(Pass == 0)
+						++BrickBase[Brick + 1];
+					else
+						BrickTriangles[Offsets[Brick]++] = static_cast<uint>(t);
+				}
+			}
+			if(Pass == 0)
+			{
+				for(std::size_t i = 1; i < BrickBase.size(); ++i)
+					BrickBase[i] += BrickBase[i - 1];
+				BrickTriangles.resize(BrickBase.back());
+			}
+		}
+
+		std::vector<uint> Closest(VoxelCount);
+		detail::compute_distance_band<T, P> Narrow = {
+			Mesh, Band, BricksX, BricksY, &BrickBase[0], BrickTriangles.empty() ? 0 : &BrickTriangles[0], Distances, &Closest[0]};
+		detail::parallel_for(BrickCount, 1, Narrow);
+
+		// Two rounds of sweeps reach the grid vertices whose closest triangle is around a corner of the band
+		std::size_t const Lines[3] = {Mesh.SizeY * Mesh.SizeZ, Mesh.SizeZ, Mesh.SizeY};
+		for(int Round = 0; Round < 2; ++Round)
+		for(int Axis = 0; Axis < 3; ++Axis)
+		{
+			detail::compute_distance_sweep<T, P> Sweep = {Mesh, Axis, Distances, &Closest[0]};
+			detail::parallel_for(Lines[Axis], Axis == 0 ? 64 : 1, Sweep);
+		}
+
+		// Bins the triangles into the z layers of grid vertices their projection on x = 0 may contain
+		std::vector<std::size_t> LayerBase(Mesh.SizeZ + 1, 0);
+		std::vector<uint> LayerTriangles;
+		for(int Pass = 0; Pass < 2; ++Pass)
+		{
+			std::vector<std::size_t> Offsets(LayerBase.begin(), LayerBase.end() - 1);
+			for(std::size_t t = 0; t < TriangleCount; ++t)
+			{
+				T const z0 = (Positions[Indices[t * 3 + 0]].z - Origin.z) / Spacing;
+				T const z1 = (Positions[Indices[t * 3 + 1]].z - Origin.z) / Spacing;
+				T const z2 = (Positions[Indices[t * 3 + 2]].z - Origin.z) / Spacing;
+				T const MinZ = ceil(min(min(z0, z1), z2));
+				T const MaxZ = floor(max(max(z0, z1), z2));
+				if(MaxZ < T(0) || MinZ > static_cast<T>(Mesh.SizeZ - 1))
+					continue;
+				std::size_t const First = MinZ > T(0) ? static_cast<std::size_t>(MinZ) : 0;
+				std::size_t const Last = MaxZ < static_cast<T>(Mesh.SizeZ - 1) ? static_cast<std::size_t>(MaxZ) : Mesh.SizeZ - 1;
+				for(std::size_t z = First; z <= Last; ++z)
+				{
+					if(Pass == 0)
+						++LayerBase[z + 1];
+					else
+						LayerTriangles[Offsets[z]++] = static_cast<uint>(t);
+				}
+			}
+			if(Pass == 0)
+			{
+				for(std::size_t i = 1; i < LayerBase.size(); ++i)
+					LayerBase[i] += LayerBase[i - 1];
+				LayerTriangles.resize(LayerBase.back());
+			}
+		}
+
+		detail::compute_distance_sign<T, P> Sign = {Mesh, &LayerBase[0], LayerTriangles.empty() ? 0 : &LayerTriangles[0], Distances};
+		detail::parallel_for(Mesh.SizeZ, 1, Sign);
+	}
+}//namespace glm
@@ -3,18 +3,22 @@
 ///
 /// @see core (dependence)
 /// @see gtc_half_float (dependence)
+/// @see gtx_sincos (dependence)
 ///
 /// @defgroup gtx_euler_angles GLM_GTX_euler_angles
 /// @ingroup gtx
 ///
 /// @brief Build matrices from Euler angles.
 ///
+/// Multi-angle constructors are evaluated in closed form with a single fused sine and cosine evaluation.
+///
 /// <glm/gtx/euler_angles.hpp> need to be included to use these functionalities.
 
 #pragma once
 
 // Dependency:
 #include "../glm.hpp"
+#include "../gtx/sincos.hpp"
 
 #if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTX_euler_angles extension included")
@@ -136,7 +140,106 @@ namespace glm
                                             T & t1,
                                             T & t2,
                                             T & t3);
-    
+
+	/// Creates Count 3D 4 * 4 homogeneous rotation matrices from euler angles (X * Y).
+	/// Sines and cosines are evaluated four elements at a time.
+	/// @see gtx_euler_angles
+	template <typename T, precision P>
+	GLM_FUNC_DECL void eulerAngleXY(
+		tvec2<T, P> const * Angles,
+		tmat4x4<T, defaultp> * Result,
+		std::size_t Count);
+
+	/// Creates Count 3D 4 * 4 homogeneous rotation matrices from euler angles (Y * X).
+	/// Sines and cosines are evaluated four elements at a time.
+	/// @see gtx_euler_angles
+	template <typename T, precision P>
+	GLM_FUNC_DECL void eulerAngleYX(
+		tvec2<T, P> const * Angles,
+		tmat4x4<T, defaultp> * Result,
+		std::size_t Count);
+
+	/// Creates Count 3D 4 * 4 homogeneous rotation matrices from euler angles (X * Z).
+	/// Sines and cosines are evaluated four elements at a time.
+	/// @see gtx_euler_angles
+	template <typename T, precision P>
+	GLM_FUNC_DECL void eulerAngleXZ(
+		tvec2<T, P> const * Angles,
+		tmat4x4<T, defaultp> * Result,
+		std::size_t Count);
+
+	/// Creates Count 3D 4 * 4 homogeneous rotation matrices from euler angles (Z * X).
+	/// Sines and cosines are evaluated four elements at a time.
+	/// @see gtx_euler_angles
+	template <typename T, precision P>
+	GLM_FUNC_DECL void eulerAngleZX(
+		tvec2<T, P> const * Angles,
+		tmat4x4<T, defaultp> * Result,
+		std::size_t Count);
+
+	/// Creates Count 3D 4 * 4 homogeneous rotation matrices from euler angles (Y * Z).
+	/// Sines and cosines are evaluated four elements at a time.
+	/// @see gtx_euler_angles
+	template <typename T, precision P>
+	GLM_FUNC_DECL void eulerAngleYZ(
+		tvec2<T, P> const * Angles,
+		tmat4x4<T, defaultp> * Result,
+		std::size_t Count);
+
+	/// Creates Count 3D 4 * 4 homogeneous rotation matrices from euler angles (Z * Y).
+	/// Sines and cosines are evaluated four elements at a time.
+	/// @see gtx_euler_angles
+	template <typename T, precision P>
+	GLM_FUNC_DECL void eulerAngleZY(
+		tvec2<T, P> const * Angles,
+		tmat4x4<T, defaultp> * Result,
+		std::size_t Count);
+
+	/// Creates Count 3D 4 * 4 homogeneous rotation matrices from euler angles (X * Y * Z).
+	/// Sines and cosines are evaluated four elements at a time.
+	/// @see gtx_euler_angles
+	template <typename T, precision P>
+	GLM_FUNC_DECL void eulerAngleXYZ(
+		tvec3<T, P> const * Angles,
+		tmat4x4<T, defaultp> * Result,
+		std::size_t Count);
+
+	/// Creates Count 3D 4 * 4 homogeneous rotation matrices from euler angles (Y * X * Z).
+	/// Sines and cosines are evaluated four elements at a time.
+	/// @see gtx_euler_angles
+	template <typename T, precision P>
+	GLM_FUNC_DECL void eulerAngleYXZ(
+		tvec3<T, P> const * Angles,
+		tmat4x4<T, defaultp> * Result,
+		std::size_t Count);
+
+	/// Creates Count 3D 4 * 4 homogeneous rotation matrices from euler angles (Y * X * Z).
+	/// Sines and cosines are evaluated four elements at a time.
+	/// @see gtx_euler_angles
+	template <typename T, precision P>
+	GLM_FUNC_DECL void yawPitchRoll(
+		tvec3<T, P> const * Angles,
+		tmat4x4<T, defaultp> * Result,
+		std::size_t Count);
+
+	/// Creates Count 3D 3 * 3 rotation matrices from euler angles (Y * X * Z).
+	/// Sines and cosines are evaluated four elements at a time.
+	/// @see gtx_euler_angles
+	template <typename T, precision P>
+	GLM_FUNC_DECL void orientate3(
+		tvec3<T, P> const * Angles,
+		tmat3x3<T, P> * Result,
+		std::size_t Count);
+
+	/// Creates Count 3D 4 * 4 homogeneous rotation matrices from euler angles (Y * X * Z).
+	/// Sines and cosines are evaluated four elements at a time.
+	/// @see gtx_euler_angles
+	template <typename T, precision P>
+	GLM_FUNC_DECL void orientate4(
+		tvec3<T, P> const * Angles,
+		tmat4x4<T, P> * Result,
+		std::size_t Count);
+
 	/// @}
 }//namespace glm
 
@@ -53,6 +53,201 @@ namespace glm
 			T(0),	T(0),	T(0), T(1));
 	}
 
+namespace detail
+{
+	// Closed-form builders from precomputed cosines and sines, shared by the scalar and the batch constructors.
+
+	template <typename T>
+	struct compute_eulerAngleXY
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<T, defaultp> call(T const * c, T const * s)
+		{
+			return tmat4x4<T, defaultp>(
+				c[1],	s[0] * s[1],	-c[0] * s[1],	T(0),
+				T(0),	c[0],			s[0],			T(0),
+				s[1],	-s[0] * c[1],	c[0] * c[1],	T(0),
+				T(0),	T(0),			T(0),			T(1));
+		}
+	};
+
+	template <typename T>
+	struct compute_eulerAngleYX
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<T, defaultp> call(T const * c, T const * s)
+		{
+			return tmat4x4<T, defaultp>(
+				c[0],			T(0),	-s[0],			T(0),
+				s[0] * s[1],	c[1],	c[0] * s[1],	T(0),
+				s[0] * c[1],	-s[1],	c[0] * c[1],	T(0),
+				T(0),			T(0),	T(0),			T(1));
+		}
+	};
+
+	template <typename T>
+	struct compute_eulerAngleXZ
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<T, defaultp> call(T const * c, T const * s)
+		{
+			return tmat4x4<T, defaultp>(
+				c[1],	c[0] * s[1],	s[0] * s[1],	T(0),
+				-s[1],	c[0] * c[1],	s[0] * c[1],	T(0),
+				T(0),	-s[0],			c[0],			T(0),
+				T(0),	T(0),			T(0),			T(1));
+		}
+	};
+
+	template <typename T>
+	struct compute_eulerAngleZX
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<T, defaultp> call(T const * c, T const * s)
+		{
+			return tmat4x4<T, defaultp>(
+				c[0],			s[0],			T(0),	T(0),
+				-s[0] * c[1],	c[0] * c[1],	s[1],	T(0),
+				s[0] * s[1],	-c[0] * s[1],	c[1],	T(0),
+				T(0),			T(0),			T(0),	T(1));
+		}
+	};
+
+	template <typename T>
+	struct compute_eulerAngleYZ
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<T, defaultp> call(T const * c, T const * s)
+		{
+			return tmat4x4<T, defaultp>(
+				c[0] * c[1],	s[1],	-s[0] * c[1],	T(0),
+				-c[0] * s[1],	c[1],	s[0] * s[1],	T(0),
+				s[0],			T(0),	c[0],			T(0),
+				T(0),			T(0),	T(0),			T(1));
+		}
+	};
+
+	template <typename T>
+	struct compute_eulerAngleZY
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<T, defaultp> call(T const * c, T const * s)
+		{
+			return tmat4x4<T, defaultp>(
+				c[0] * c[1],	s[0] * c[1],	-s[1],	T(0),
+				-s[0],			c[0],			T(0),	T(0),
+				c[0] * s[1],	s[0] * s[1],	c[1],	T(0),
+				T(0),			T(0),			T(0),	T(1));
+		}
+	};
+
+	template <typename T>
+	struct compute_eulerAngleXYZ
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<T, defaultp> call(T const * c, T const * s)
+		{
+			// The rotation is built from the negated angles: cos(-t) = cos(t) and sin(-t) = -sin(t)
+			T const c1 = c[0], c2 = c[1], c3 = c[2];
+			T const s1 = -s[0], s2 = -s[1], s3 = -s[2];
+
+			tmat4x4<T, defaultp> Result;
+			Result[0][0] = c2 * c3;
+			Result[0][1] =-c1 * s3 + s1 * s2 * c3;
+			Result[0][2] = s1 * s3 + c1 * s2 * c3;
+			Result[0][3] = static_cast<T>(0);
+			Result[1][0] = c2 * s3;
+			Result[1][1] = c1 * c3 + s1 * s2 * s3;
+			Result[1][2] =-s1 * c3 + c1 * s2 * s3;
+			Result[1][3] = static_cast<T>(0);
+			Result[2][0] =-s2;
+			Result[2][1] = s1 * c2;
+			Result[2][2] = c1 * c2;
+			Result[2][3] = static_cast<T>(0);
+			Result[3][0] = static_cast<T>(0);
+			Result[3][1] = static_cast<T>(0);
+			Result[3][2] = static_cast<T>(0);
+			Result[3][3] = static_cast<T>(1);
+			return Result;
+		}
+	};
+
+	template <typename T>
+	struct compute_eulerAngleYXZ
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<T, defaultp> call(T const * c, T const * s)
+		{
+			T const tmp_ch = c[0], tmp_sh = s[0];
+			T const tmp_cp = c[1], tmp_sp = s[1];
+			T const tmp_cb = c[2], tmp_sb = s[2];
+
+			tmat4x4<T, defaultp> Result;
+			Result[0][0] = tmp_ch * tmp_cb + tmp_sh * tmp_sp * tmp_sb;
+			Result[0][1] = tmp_sb * tmp_cp;
+			Result[0][2] = -tmp_sh * tmp_cb + tmp_ch * tmp_sp * tmp_sb;
+			Result[0][3] = static_cast<T>(0);
+			Result[1][0] = -tmp_ch * tmp_sb + tmp_sh * tmp_sp * tmp_cb;
+			Result[1][1] = tmp_cb * tmp_cp;
+			Result[1][2] = tmp_sb * tmp_sh + tmp_ch * tmp_sp * tmp_cb;
+			Result[1][3] = static_cast<T>(0);
+			Result[2][0] = tmp_sh * tmp_cp;
+			Result[2][1] = -tmp_sp;
+			Result[2][2] = tmp_ch * tmp_cp;
+			Result[2][3] = static_cast<T>(0);
+			Result[3][0] = static_cast<T>(0);
+			Result[3][1] = static_cast<T>(0);
+			Result[3][2] = static_cast<T>(0);
+			Result[3][3] = static_cast<T>(1);
+			return Result;
+		}
+	};
+
+	// orientate3 and orientate4 take (pitch, roll, yaw) angles and forward them as yawPitchRoll(yaw, pitch, roll)
+	template <typename T>
+	struct compute_orientate
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<T, defaultp> call(T const * c, T const * s)
+		{
+			T const c0[3] = {c[2], c[0], c[1]};
+			T const s0[3] = {s[2], s[0], s[1]};
+			return compute_eulerAngleYXZ<T>::call(c0, s0);
+		}
+	};
+
+	template <template <typename> class builder, typename T>
+	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> compute_euler(T const & a0, T const & a1, T const & a2)
+	{
+		T const a[4] = {a0, a1, a2, T(0)};
+		T s[4], c[4];
+		compute_sincos4<T>::call(a, s, c);
+		return builder<T>::call(c, s);
+	}
+
+	// Evaluates the sines and cosines of four elements at a time from a structure of arrays layout.
+	template <template <typename> class builder, typename T, precision P, template <typename, precision> class vecType, typename matType>
+	GLM_FUNC_QUALIFIER void compute_euler_batch(vecType<T, P> const * Angles, matType * Result, std::size_t Count)
+	{
+		length_t const L = vecType<T, P>::length();
+
+		T a[4 * 3], s[4 * 3], c[4 * 3];
+		for(std::size_t i = 0; i < Count; i += 4)
+		{
+			std::size_t const n = Count - i < 4 ? Count - i : 4;
+
+			for(length_t l = 0; l < L; ++l)
+			for(std::size_t k = 0; k < 4; ++k)
+				a[l * 4 + k] = k < n ? Angles[i + k][l] : T(0);
+
+			for(length_t l = 0; l < L; ++l)
+				compute_sincos4<T>::call(a + l * 4, s + l * 4, c + l * 4);
+
+			for(std::size_t k = 0; k < n; ++k)
+			{
+				T ck[3], sk[3];
+				for(length_t l = 0; l < L; ++l)
+				{
+					ck[l] = c[l * 4 + k];
+					sk[l] = s[l * 4 + k];
+				}
+				Result[i + k] = matType(builder<T>::call(ck, sk));
+			}
+		}
+	}
+}//namespace detail
+
 	template <typename T>
 	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> eulerAngleXY
 	(
@@ -60,16 +255,7 @@ namespace glm
 		T const & angleY
 	)
 	{
-		T cosX = glm::cos(angleX);
-		T sinX = glm::sin(angleX);
-		T cosY = glm::cos(angleY);
-		T sinY = glm::sin(angleY);
-
-		return tmat4x4<T, defaultp>(
-			cosY,   -sinX * -sinY,  cosX * -sinY,   T(0),
-			T(0),   cosX,           sinX,           T(0),
-			sinY,   -sinX * cosY,   cosX * cosY,    T(0),
-			T(0),   T(0),           T(0),           T(1));
+		return detail::compute_euler<detail::compute_eulerAngleXY>(angleX, angleY, T(0));
 	}
 
 	template <typename T>
@@ -79,16 +265,7 @@ namespace glm
 		T const & angleX
 	)
 	{
-		T cosX = glm::cos(angleX);
-		T sinX = glm::sin(angleX);
-		T cosY = glm::cos(angleY);
-		T sinY = glm::sin(angleY);
-
-		return tmat4x4<T, defaultp>(
-			cosY,          0,      -sinY,    T(0),
-			sinY * sinX,  cosX, cosY * sinX, T(0),
-			sinY * cosX, -sinX, cosY * cosX, T(0),
-			T(0),         T(0),     T(0),    T(1));
+		return detail::compute_euler<detail::compute_eulerAngleYX>(angleY, angleX, T(0));
 	}
 
 	template <typename T>
@@ -98,7 +275,7 @@ namespace glm
 		T const & angleZ
 	)
 	{
-		return eulerAngleX(angleX) * eulerAngleZ(angleZ);
+		return detail::compute_euler<detail::compute_eulerAngleXZ>(angleX, angleZ, T(0));
 	}
 
 	template <typename T>
@@ -108,7 +285,7 @@ namespace glm
 		T const & angleX
 	)
 	{
-		return eulerAngleZ(angleZ) * eulerAngleX(angleX);
+		return detail::compute_euler<detail::compute_eulerAngleZX>(angleZ, angleX, T(0));
 	}
 
 	template <typename T>
@@ -118,7 +295,7 @@ namespace glm
 		T const & angleZ
 	)
 	{
-		return eulerAngleY(angleY) * eulerAngleZ(angleZ);
+		return detail::compute_euler<detail::compute_eulerAngleYZ>(angleY, angleZ, T(0));
 	}
 
 	template <typename T>
@@ -128,44 +305,20 @@ namespace glm
 		T const & angleY
 	)
 	{
-		return eulerAngleZ(angleZ) * eulerAngleY(angleY);
+		return detail::compute_euler<detail::compute_eulerAngleZY>(angleZ, angleY, T(0));
 	}
-    
-    template <typename T>
-    GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> eulerAngleXYZ
-    (
-     T const & t1,
-     T const & t2,
-     T const & t3
-     )
-    {
-        T c1 = glm::cos(-t1);
-        T c2 = glm::cos(-t2);
-        T c3 = glm::cos(-t3);
-        T s1 = glm::sin(-t1);
-        T s2 = glm::sin(-t2);
-        T s3 = glm::sin(-t3);
-        
-        tmat4x4<T, defaultp> Result;
-        Result[0][0] = c2 * c3;
-        Result[0][1] =-c1 * s3 + s1 * s2 * c3;
-        Result[0][2] = s1 * s3 + c1 * s2 * c3;
-        Result[0][3] = static_cast<T>(0);
-        Result[1][0] = c2 * s3;
-        Result[1][1] = c1 * c3 + s1 * s2 * s3;
-        Result[1][2] =-s1 * c3 + c1 * s2 * s3;
-        Result[1][3] = static_cast<T>(0);
-        Result[2][0] =-s2;
-        Result[2][1] = s1 * c2;
-        Result[2][2] = c1 * c2;
-        Result[2][3] = static_cast<T>(0);
-        Result[3][0] = static_cast<T>(0);
-        Result[3][1] = static_cast<T>(0);
-        Result[3][2] = static_cast<T>(0);
-        Result[3][3] = static_cast<T>(1);
-        return Result;
-    }
-    
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> eulerAngleXYZ
+	(
+		T const & t1,
+		T const & t2,
+		T const & t3
+	)
+	{
+		return detail::compute_euler<detail::compute_eulerAngleXYZ>(t1, t2, t3);
+	}
+
 	template <typename T>
 	GLM_FUNC_QUALIFIER tmat4x4<T, defaultp> eulerAngleYXZ
 	(
@@ -174,31 +327,7 @@ namespace glm
 		T const & roll
 	)
 	{
-		T tmp_ch = glm::cos(yaw);
-		T tmp_sh = glm::sin(yaw);
-		T tmp_cp = glm::cos(pitch);
-		T tmp_sp = glm::sin(pitch);
-		T tmp_cb = glm::cos(roll);
-		T tmp_sb = glm::sin(roll);
-
-		tmat4x4<T, defaultp> Result;
-		Result[0][0] = tmp_ch * tmp_cb + tmp_sh * tmp_sp * tmp_sb;
-		Result[0][1] = tmp_sb * tmp_cp;
-		Result[0][2] = -tmp_sh * tmp_cb + tmp_ch * tmp_sp * tmp_sb;
-		Result[0][3] = static_cast<T>(0);
-		Result[1][0] = -tmp_ch * tmp_sb + tmp_sh * tmp_sp * tmp_cb;
-		Result[1][1] = tmp_cb * tmp_cp;
-		Result[1][2] = tmp_sb * tmp_sh + tmp_ch * tmp_sp * tmp_cb;
-		Result[1][3] = static_cast<T>(0);
-		Result[2][0] = tmp_sh * tmp_cp;
-		Result[2][1] = -tmp_sp;
-		Result[2][2] = tmp_ch * tmp_cp;
-		Result[2][3] = static_cast<T>(0);
-		Result[3][0] = static_cast<T>(0);
-		Result[3][1] = static_cast<T>(0);
-		Result[3][2] = static_cast<T>(0);
-		Result[3][3] = static_cast<T>(1);
-		return Result;
+		return detail::compute_euler<detail::compute_eulerAngleYXZ>(yaw, pitch, roll);
 	}
 
 	template <typename T>
@@ -209,31 +338,7 @@ namespace glm
 		T const & roll
 	)
 	{
-		T tmp_ch = glm::cos(yaw);
-		T tmp_sh = glm::sin(yaw);
-		T tmp_cp = glm::cos(pitch);
-		T tmp_sp = glm::sin(pitch);
-		T tmp_cb = glm::cos(roll);
-		T tmp_sb = glm::sin(roll);
-
-		tmat4x4<T, defaultp> Result;
-		Result[0][0] = tmp_ch * tmp_cb + tmp_sh * tmp_sp * tmp_sb;
-		Result[0][1] = tmp_sb * tmp_cp;
-		Result[0][2] = -tmp_sh * tmp_cb + tmp_ch * tmp_sp * tmp_sb;
-		Result[0][3] = static_cast<T>(0);
-		Result[1][0] = -tmp_ch * tmp_sb + tmp_sh * tmp_sp * tmp_cb;
-		Result[1][1] = tmp_cb * tmp_cp;
-		Result[1][2] = tmp_sb * tmp_sh + tmp_ch * tmp_sp * tmp_cb;
-		Result[1][3] = static_cast<T>(0);
-		Result[2][0] = tmp_sh * tmp_cp;
-		Result[2][1] = -tmp_sp;
-		Result[2][2] = tmp_ch * tmp_cp;
-		Result[2][3] = static_cast<T>(0);
-		Result[3][0] = static_cast<T>(0);
-		Result[3][1] = static_cast<T>(0);
-		Result[3][2] = static_cast<T>(0);
-		Result[3][3] = static_cast<T>(1);
-		return Result;
+		return detail::compute_euler<detail::compute_eulerAngleYXZ>(yaw, pitch, roll);
 	}
 
 	template <typename T>
@@ -309,4 +414,125 @@ namespace glm
         t2 = -T2;
         t3 = -T3;
     }
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void eulerAngleXY
+	(
+		tvec2<T, P> const * Angles,
+		tmat4x4<T, defaultp> * Result,
+		std::size_t Count
+	)
+	{
+		detail::compute_euler_batch<detail::compute_eulerAngleXY>(Angles, Result, Count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void eulerAngleYX
+	(
+		tvec2<T, P> const * Angles,
+		tmat4x4<T, defaultp> * Result,
+		std::size_t Count
+	)
+	{
+		detail::compute_euler_batch<detail::compute_eulerAngleYX>(Angles, Result, Count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void eulerAngleXZ
+	(
+		tvec2<T, P> const * Angles,
+		tmat4x4<T, defaultp> * Result,
+		std::size_t Count
+	)
+	{
+		detail::compute_euler_batch<detail::compute_eulerAngleXZ>(Angles, Result, Count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void eulerAngleZX
+	(
+		tvec2<T, P> const * Angles,
+		tmat4x4<T, defaultp> * Result,
+		std::size_t Count
+	)
+	{
+		detail::compute_euler_batch<detail::compute_eulerAngleZX>(Angles, Result, Count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void eulerAngleYZ
+	(
+		tvec2<T, P> const * Angles,
+		tmat4x4<T, defaultp> * Result,
+		std::size_t Count
+	)
+	{
+		detail::compute_euler_batch<detail::compute_eulerAngleYZ>(Angles, Result, Count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void eulerAngleZY
+	(
+		tvec2<T, P> const * Angles,
+		tmat4x4<T, defaultp> * Result,
+		std::size_t Count
+	)
+	{
+		detail::compute_euler_batch<detail::compute_eulerAngleZY>(Angles, Result, Count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void eulerAngleXYZ
+	(
+		tvec3<T, P> const * Angles,
+		tmat4x4<T, defaultp> * Result,
+		std::size_t Count
+	)
+	{
+		detail::compute_euler_batch<detail::compute_eulerAngleXYZ>(Angles, Result, Count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void eulerAngleYXZ
+	(
+		tvec3<T, P> const * Angles,
+		tmat4x4<T, defaultp> * Result,
+		std::size_t Count
+	)
+	{
+		detail::compute_euler_batch<detail::compute_eulerAngleYXZ>(Angles, Result, Count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void yawPitchRoll
+	(
+		tvec3<T, P> const * Angles,
+		tmat4x4<T, defaultp> * Result,
+		std::size_t Count
+	)
+	{
+		detail::compute_euler_batch<detail::compute_eulerAngleYXZ>(Angles, Result, Count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void orientate3
+	(
+		tvec3<T, P> const * Angles,
+		tmat3x3<T, P> * Result,
+		std::size_t Count
+	)
+	{
+		detail::compute_euler_batch<detail::compute_orientate>(Angles, Result, Count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void orientate4
+	(
+		tvec3<T, P> const * Angles,
+		tmat4x4<T, P> * Result,
+		std::size_t Count
+	)
+	{
+		detail::compute_euler_batch<detail::compute_orientate>(Angles, Result, Count);
+	}
 }//namespace glm
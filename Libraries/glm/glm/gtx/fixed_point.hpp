@@ -0,0 +1,195 @@
+/// @ref gtx_fixed_point
+/// @file glm/gtx/fixed_point.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_fixed_point GLM_GTX_fixed_point
+/// @ingroup gtx
+///
+/// @brief Q format fixed point numbers usable as components of GLM vectors and matrices, for bit exact math.
+///
+/// fixed<IntegerBits, FractionBits> stores a number in a 32-bit signed integer scaled by 2^FractionBits.
+/// Every operation is integer arithmetic, so results are identical on all compilers and processors:
+/// additions wrap like unsigned integers, products and dot products keep 64-bit intermediates and round
+/// half up once, normalize uses an integer reciprocal square root and sin and cos interpolate a table.
+/// Batch functions on arrays use SSE2 and SSE4.1 integer instructions and return the same bits.
+///
+/// <glm/gtx/fixed_point.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <limits>
+#include <cstddef>
+
+#if !GLM_HAS_UNRESTRICTED_UNIONS || !GLM_HAS_DEFAULTED_FUNCTIONS || !GLM_HAS_EXPLICIT_CONVERSION_OPERATORS
+#	error "GLM_GTX_fixed_point requires C++11 support of unrestricted unions, defaulted functions and explicit conversion operators"
+#endif
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_fixed_point extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_fixed_point
+	/// @{
+
+	/// Signed fixed point number of IntegerBits bits, sign included, and FractionBits bits of fraction, 32 bits in total.
+	/// @see gtx_fixed_point
+	template <int IntegerBits, int FractionBits>
+	struct fixed
+	{
+		GLM_STATIC_ASSERT(IntegerBits >= 2 && FractionBits >= 1 && IntegerBits + FractionBits == 32,
+			"GLM_GTX_fixed_point: fixed requires 32 bits with 1 to 30 fraction bits");
+
+		static int const fraction_bits = FractionBits;
+
+		fixed() = default;
+
+		/// Conversions round to nearest, and saturate out of range values
+		GLM_FUNC_DECL explicit fixed(int Value);
+		GLM_FUNC_DECL explicit fixed(float Value);
+		GLM_FUNC_DECL explicit fixed(double Value);
+
+		GLM_FUNC_DECL explicit operator float() const;
+		GLM_FUNC_DECL explicit operator double() const;
+		/// Rounds toward negative infinity
+		GLM_FUNC_DECL explicit operator int() const;
+
+		/// The fixed point number of scaled integer Bits
+		GLM_FUNC_DECL static fixed raw(int32 Bits);
+
+		GLM_FUNC_DECL fixed & operator+=(fixed Value);
+		GLM_FUNC_DECL fixed & operator-=(fixed Value);
+		GLM_FUNC_DECL fixed & operator*=(fixed Value);
+		GLM_FUNC_DECL fixed & operator/=(fixed Value);
+		GLM_FUNC_DECL fixed & operator++();
+		GLM_FUNC_DECL fixed & operator--();
+		GLM_FUNC_DECL fixed operator++(int);
+		GLM_FUNC_DECL fixed operator--(int);
+
+		/// Value scaled by 2^FractionBits
+		int32 Raw;
+	};
+
+	/// Q16.16 vectors and matrices.
+	/// @see gtx_fixed_point
+	typedef tvec2<fixed<16, 16>, defaultp> fxvec2;
+	typedef tvec3<fixed<16, 16>, defaultp> fxvec3;
+	typedef tvec4<fixed<16, 16>, defaultp> fxvec4;
+	typedef tmat3x3<fixed<16, 16>, defaultp> fxmat3;
+	typedef tmat4x4<fixed<16, 16>, defaultp> fxmat4;
+
+	template <int I, int F>
+	GLM_FUNC_DECL fixed<I, F> operator+(fixed<I, F> Value);
+	template <int I, int F>
+	GLM_FUNC_DECL fixed<I, F> operator-(fixed<I, F> Value);
+	template <int I, int F>
+	GLM_FUNC_DECL fixed<I, F> operator+(fixed<I, F> a, fixed<I, F> b);
+	template <int I, int F>
+	GLM_FUNC_DECL fixed<I, F> operator-(fixed<I, F> a, fixed<I, F> b);
+	/// Rounds half up
+	template <int I, int F>
+	GLM_FUNC_DECL fixed<I, F> operator*(fixed<I, F> a, fixed<I, F> b);
+	/// Rounds toward zero, b must not be zero
+	template <int I, int F>
+	GLM_FUNC_DECL fixed<I, F> operator/(fixed<I, F> a, fixed<I, F> b);
+
+	template <int I, int F>
+	GLM_FUNC_DECL bool operator==(fixed<I, F> a, fixed<I, F> b);
+	template <int I, int F>
+	GLM_FUNC_DECL bool operator!=(fixed<I, F> a, fixed<I, F> b);
+	template <int I, int F>
+	GLM_FUNC_DECL bool operator<(fixed<I, F> a, fixed<I, F> b);
+	template <int I, int F>
+	GLM_FUNC_DECL bool operator<=(fixed<I, F> a, fixed<I, F> b);
+	template <int I, int F>
+	GLM_FUNC_DECL bool operator>(fixed<I, F> a, fixed<I, F> b);
+	template <int I, int F>
+	GLM_FUNC_DECL bool operator>=(fixed<I, F> a, fixed<I, F> b);
+
+	/// Sum of the exact products, rounded once.
+	/// @see gtx_fixed_point
+	template <int I, int F, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL fixed<I, F> dot(vecType<fixed<I, F>, P> const & x, vecType<fixed<I, F>, P> const & y);
+
+	/// Each component is the difference of exact products, rounded once.
+	/// @see gtx_fixed_point
+	template <int I, int F, precision P>
+	GLM_FUNC_DECL tvec3<fixed<I, F>, P> cross(tvec3<fixed<I, F>, P> const & x, tvec3<fixed<I, F>, P> const & y);
+
+	/// Scales by an integer reciprocal square root of the exact squared length; the zero vector stays zero.
+	/// @see gtx_fixed_point
+	template <int I, int F, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<fixed<I, F>, P> normalize(vecType<fixed<I, F>, P> const & x);
+
+	/// Linear interpolation of a quarter wave table of 256 intervals, absolute error below 2^-17 plus rounding.
+	/// @see gtx_fixed_point
+	template <int I, int F>
+	GLM_FUNC_DECL fixed<I, F> sin(fixed<I, F> angle);
+	template <int I, int F>
+	GLM_FUNC_DECL fixed<I, F> cos(fixed<I, F> angle);
+	template <int I, int F, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<fixed<I, F>, P> sin(vecType<fixed<I, F>, P> const & angle);
+	template <int I, int F, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL vecType<fixed<I, F>, P> cos(vecType<fixed<I, F>, P> const & angle);
+
+	/// Sums or multiplies Count numbers, or the components of Count vectors, with SSE2 and SSE4.1 instructions.
+	/// Results are the same bits as the operators.
+	/// @see gtx_fixed_point
+	template <int I, int F>
+	GLM_FUNC_DECL void add(fixed<I, F> const * a, fixed<I, F> const * b, fixed<I, F> * Results, std::size_t Count);
+	template <int I, int F>
+	GLM_FUNC_DECL void mul(fixed<I, F> const * a, fixed<I, F> const * b, fixed<I, F> * Results, std::size_t Count);
+	template <int I, int F, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL void add(vecType<fixed<I, F>, P> const * a, vecType<fixed<I, F>, P> const * b, vecType<fixed<I, F>, P> * Results, std::size_t Count);
+	template <int I, int F, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL void mul(vecType<fixed<I, F>, P> const * a, vecType<fixed<I, F>, P> const * b, vecType<fixed<I, F>, P> * Results, std::size_t Count);
+
+	/// Dot and cross products of Count vectors, four at once with SSE4.1 instructions, and normalization.
+	/// Results are the same bits as the functions on single vectors.
+	/// @see gtx_fixed_point
+	template <int I, int F, precision P>
+	GLM_FUNC_DECL void dot(tvec3<fixed<I, F>, P> const * x, tvec3<fixed<I, F>, P> const * y, fixed<I, F> * Results, std::size_t Count);
+	template <int I, int F, precision P>
+	GLM_FUNC_DECL void cross(tvec3<fixed<I, F>, P> const * x, tvec3<fixed<I, F>, P> const * y, tvec3<fixed<I, F>, P> * Results, std::size_t Count);
+	template <int I, int F, precision P>
+	GLM_FUNC_DECL void normalize(tvec3<fixed<I, F>, P> const * x, tvec3<fixed<I, F>, P> * Results, std::size_t Count);
+
+	/// Sines and cosines of Count angles.
+	/// @see gtx_fixed_point
+	template <int I, int F>
+	GLM_FUNC_DECL void sin(fixed<I, F> const * Angles, fixed<I, F> * Results, std::size_t Count);
+	template <int I, int F>
+	GLM_FUNC_DECL void cos(fixed<I, F> const * Angles, fixed<I, F> * Results, std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+namespace std
+{
+	template <int I, int F>
+	class numeric_limits<glm::fixed<I, F> >
+	{
+	public:
+		static bool const is_specialized = true;
+		static bool const is_signed = true;
+		static bool const is_integer = false;
+		static bool const is_exact = true;
+		static bool const is_iec559 = false;
+		static bool const is_bounded = true;
+		static bool const is_modulo = true;
+		static int const radix = 2;
+		static int const digits = 31;
+
+		static glm::fixed<I, F> min(){return glm::fixed<I, F>::raw(1);}
+		static glm::fixed<I, F> max(){return glm::fixed<I, F>::raw(0x7fffffff);}
+		static glm::fixed<I, F> lowest(){return glm::fixed<I, F>::raw(-0x7fffffff - 1);}
+		static glm::fixed<I, F> epsilon(){return glm::fixed<I, F>::raw(1);}
+		static glm::fixed<I, F> round_error(){return glm::fixed<I, F>::raw(1 << (F - 1));}
+	};
+}//namespace std
+
+#include "fixed_point.inl"
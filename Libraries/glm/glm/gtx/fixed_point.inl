@@ -0,0 +1,626 @@
+/// @ref gtx_fixed_point
+/// @file glm/gtx/fixed_point.inl
+
+#include <cmath>
+
+namespace glm{
+namespace detail
+{
+	GLM_FUNC_QUALIFIER int32 fixed_wrap(uint64 Value)
+	{
+		return static_cast<int32>(static_cast<uint32>(Value));
+	}
+
+	GLM_FUNC_QUALIFIER uint64 fixed_product(int32 a, int32 b)
+	{
+		return static_cast<uint64>(static_cast<int64>(a) * static_cast<int64>(b));
+	}
+
+	// Rounds a two's complement sum of products, of 2F fraction bits, half up to F fraction bits.
+	// The bits kept are below bit F + 32, so a logical shift gives the same result as an arithmetic one.
+	template <int F>
+	GLM_FUNC_QUALIFIER int32 fixed_round(uint64 Value)
+	{
+		return fixed_wrap((Value + (static_cast<uint64>(1) << (F - 1))) >> F);
+	}
+
+	template <int F>
+	GLM_FUNC_QUALIFIER int32 fixed_from_double(double Value)
+	{
+		if(Value != Value)
+			return 0;
+		double const Scaled = std::floor(Value * static_cast<double>(1 << F) + 0.5);
+		if(Scaled >= 2147483647.0)
+			return 0x7fffffff;
+		if(Scaled <= -2147483648.0)
+			return -0x7fffffff - 1;
+		return static_cast<int32>(Scaled);
+	}
+
+	GLM_FUNC_QUALIFIER int fixed_msb(uint64 Value)
+	{
+#		if GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_CLANG)
+			return 63 - __builtin_clzll(Value);
+#		else
+			int Msb = 0;
+			for(int Step = 32; Step > 0; Step >>= 1)
+				if(Value >> Step)
+				{
+					Value >>= Step;
+					Msb += Step;
+				}
+			return Msb;
+#		endif
+	}
+
+	// 2^31 / sqrt(m) at the middle of the intervals [i / 64, (i + 1) / 64) of [1, 4)
+	GLM_FUNC_QUALIFIER uint32 const * fixed_rsqrt_table()
+	{
+		static uint32 const Table[192] =
+		{
+			2139143874u, 2122751726u, 2106730729u, 2091067086u, 2075747707u, 2060760163u, 2046092644u, 2031733922u,
+			2017673311u, 2003900636u, 1990406202u, 1977180765u, 1964215505u, 1951502003u, 1939032214u, 1926798450u,
+			1914793358u, 1903009903u, 1891441346u, 1880081235u, 1868923385u, 1857961863u, 1847190978u, 1836605270u,
+			1826199490u, 1815968600u, 1805907755u, 1796012296u, 1786277740u, 1776699774u, 1767274245u, 1757997150u,
+			1748864636u, 1739872984u, 1731018611u, 1722298059u, 1713707990u, 1705245183u, 1696906526u, 1688689013u,
+			1680589738u, 1672605894u, 1664734763u, 1656973720u, 1649320221u, 1641771805u, 1634326089u, 1626980766u,
+			1619733600u, 1612582423u, 1605525136u, 1598559701u, 1591684144u, 1584896547u, 1578195052u, 1571577853u,
+			1565043197u, 1558589383u, 1552214758u, 1545917715u, 1539696693u, 1533550174u, 1527476684u, 1521474788u,
+			1515543090u, 1509680232u, 1503884893u, 1498155787u, 1492491662u, 1486891298u, 1481353508u, 1475877137u,
+			1470461055u, 1465104167u, 1459805400u, 1454563712u, 1449378085u, 1444247527u, 1439171070u, 1434147770u,
+			1429176706u, 1424256978u, 1419387709u, 1414568043u, 1409797142u, 1405074190u, 1400398389u, 1395768961u,
+			1391185142u, 1386646190u, 1382151377u, 1377699992u, 1373291341u, 1368924744u, 1364599536u, 1360315069u,
+			1356070705u, 1351865825u, 1347699819u, 1343572091u, 1339482060u, 1335429155u, 1331412818u, 1327432501u,
+			1323487671u, 1319577802u, 1315702382u, 1311860907u, 1308052885u, 1304277832u, 1300535277u, 1296824755u,
+			1293145812u, 1289498003u, 1285880891u, 1282294047u, 1278737053u, 1275209495u, 1271710972u, 1268241085u,
+			1264799448u, 1261385678u, 1257999402u, 1254640252u, 1251307868u, 1248001897u, 1244721991u, 1241467811u,
+			1238239020u, 1235035292u, 1231856302u, 1228701736u, 1225571280u, 1222464631u, 1219381487u, 1216321553u,
+			1213284541u, 1210270165u, 1207278145u, 1204308207u, 1201360079u, 1198433497u, 1195528200u, 1192643930u,
+			1189780435u, 1186937467u, 1184114781u, 1181312139u, 1178529303u, 1175766042u, 1173022127u, 1170297333u,
+			1167591440u, 1164904229u, 1162235487u, 1159585004u, 1156952571u, 1154337986u, 1151741047u, 1149161556u,
+			1146599320u, 1144054146u, 1141525847u, 1139014236u, 1136519130u, 1134040351u, 1131577719u, 1129131062u,
+			1126700207u, 1124284984u, 1121885226u, 1119500771u, 1117131454u, 1114777118u, 1112437604u, 1110112758u,
+			1107802427u, 1105506461u, 1103224711u, 1100957032u, 1098703280u, 1096463311u, 1094236988u, 1092024170u,
+			1089824724u, 1087638513u, 1085465407u, 1083305275u, 1081157988u, 1079023419u, 1076901444u, 1074791939u
+		};
+		return Table;
+	}
+
+	// Reciprocal square root of the non zero sum of squares Value, of 2F fraction bits, such that
+	// normalized components are (Component * Reciprocal) >> Shift, rounded.
+	template <int F>
+	GLM_FUNC_QUALIFIER void fixed_rsqrt(uint64 Value, uint32 & Reciprocal, int & Shift)
+	{
+		// Value = m 2^(60 + 2k) with m in [1, 4), in Q30
+		int const Msb = fixed_msb(Value);
+		int const Exponent = Msb >= 60 ? (Msb - 60) / 2 : -((61 - Msb) / 2);
+		uint64 const Mantissa = Exponent >= 0 ? Value >> (2 * Exponent) : Value << (-2 * Exponent);
+		uint64 const m = Mantissa >> 30;
+
+		// Two Newton iterations y = y (3 - m y^2) / 2 from the table, in Q31
+		uint64 y = fixed_rsqrt_table()[(m >> 24) - 64];
+		for(int i = 0; i < 2; ++i)
+		{
+			uint64 const y2 = (y * y) >> 31;
+			uint64 const my2 = (m * y2) >> 30;
+			y = (y * ((static_cast<uint64>(3) << 31) - my2)) >> 32;
+		}
+
+		Reciprocal = static_cast<uint32>(y);
+		Shift = 61 + Exponent - F;
+	}
+
+	GLM_FUNC_QUALIFIER int32 fixed_scale(int32 Component, uint32 Reciprocal, int Shift)
+	{
+		int64 const Product = static_cast<int64>(Component) * static_cast<int64>(Reciprocal);
+		return static_cast<int32>((Product + (static_cast<int64>(1) << (Shift - 1))) >> Shift);
+	}
+
+	// sin over the first quarter turn at 256 intervals and one more, in Q30
+	GLM_FUNC_QUALIFIER int32 const * fixed_sin_table()
+	{
+		static int32 const Table[258] =
+		{
+			0, 6588356, 13176464, 19764076, 26350943, 32936819,
+			39521455, 46104602, 52686014, 59265442, 65842639, 72417357,
+			78989349, 85558366, 92124163, 98686491, 105245103, 111799753,
+			118350194, 124896179, 131437462, 137973796, 144504935, 151030634,
+			157550647, 164064728, 170572633, 177074115, 183568930, 190056834,
+			196537583, 203010932, 209476638, 215934457, 222384147, 228825464,
+			235258165, 241682010, 248096755, 254502159, 260897982, 267283981,
+			273659918, 280025552, 286380643, 292724951, 299058239, 305380268,
+			311690799, 317989595, 324276419, 330551034, 336813204, 343062693,
+			349299266, 355522689, 361732726, 367929144, 374111709, 380280190,
+			386434353, 392573967, 398698801, 404808624, 410903207, 416982319,
+			423045732, 429093217, 435124548, 441139496, 447137835, 453119340,
+			459083786, 465030947, 470960600, 476872522, 482766489, 488642281,
+			494499676, 500338453, 506158392, 511959275, 517740883, 523502998,
+			529245404, 534967884, 540670223, 546352205, 552013618, 557654248,
+			563273883, 568872310, 574449320, 580004702, 585538248, 591049748,
+			596538995, 602005783, 607449906, 612871159, 618269338, 623644239,
+			628995660, 634323400, 639627258, 644907034, 650162530, 655393548,
+			660599890, 665781362, 670937767, 676068911, 681174602, 686254647,
+			691308855, 696337036, 701339000, 706314559, 711263525, 716185713,
+			721080937, 725949013, 730789757, 735602987, 740388522, 745146182,
+			749875788, 754577161, 759250125, 763894504, 768510122, 773096806,
+			777654384, 782182683, 786681534, 791150767, 795590213, 799999706,
+			804379079, 808728167, 813046808, 817334838, 821592095, 825818421,
+			830013654, 834177638, 838310216, 842411232, 846480531, 850517961,
+			854523370, 858496606, 862437520, 866345964, 870221790, 874064853,
+			877875009, 881652112, 885396022, 889106597, 892783698, 896427186,
+			900036924, 903612776, 907154608, 910662286, 914135678, 917574653,
+			920979082, 924348837, 927683790, 930983817, 934248793, 937478595,
+			940673101, 943832191, 946955747, 950043650, 953095785, 956112036,
+			959092290, 962036435, 964944360, 967815955, 970651112, 973449725,
+			976211688, 978936898, 981625251, 984276646, 986890984, 989468165,
+			992008094, 994510675, 996975812, 999403415, 1001793390, 1004145648,
+			1006460100, 1008736660, 1010975242, 1013175761, 1015338134, 1017462281,
+			1019548121, 1021595575, 1023604567, 1025575020, 1027506862, 1029400018,
+			1031254418, 1033069992, 1034846671, 1036584389, 1038283080, 1039942680,
+			1041563127, 1043144360, 1044686319, 1046188946, 1047652185, 1049075980,
+			1050460278, 1051805027, 1053110176, 1054375676, 1055601479, 1056787540,
+			1057933813, 1059040255, 1060106826, 1061133483, 1062120190, 1063066909,
+			1063973603, 1064840240, 1065666786, 1066453210, 1067199483, 1067905576,
+			1068571464, 1069197120, 1069782521, 1070327646, 1070832474, 1071296985,
+			1071721163, 1072104991, 1072448455, 1072751542, 1073014240, 1073236540,
+			1073418433, 1073559913, 1073660973, 1073721611, 1073741824, 1073721611
+		};
+		return Table;
+	}
+
+	// Sine of Angle in radians plus Offset in 2^-32 turns, of F fraction bits
+	template <int F>
+	GLM_FUNC_QUALIFIER int32 fixed_sin(int32 Angle, uint32 Offset)
+	{
+		// 2^34 / (2 pi) converts radians of F fraction bits to turns of 32 fraction bits, wrapped to one turn
+		uint64 const Turns = static_cast<uint64>(static_cast<int64>(Angle) * static_cast<int64>(2734261102u));
+		uint32 const Phase = static_cast<uint32>(Turns >> (F + 2)) + Offset;
+
+		uint32 const Quadrant = Phase >> 30;
+		uint32 Position = Phase & 0x3fffffffu;
+		if(Quadrant & 1u)
+			Position = 0x40000000u - Position;
+
+		int32 const * const Table = fixed_sin_table();
+		uint32 const Index = Position >> 22;
+		int64 const Fraction = static_cast<int64>(Position & 0x3fffffu);
+		int64 const Sine = Table[Index] + (((static_cast<int64>(Table[Index + 1]) - Table[Index]) * Fraction) >> 22);
+
+		int const Shift = 30 - F;
+		int32 const Result = static_cast<int32>((Sine + ((static_cast<int64>(1) << Shift) >> 1)) >> Shift);
+		return Quadrant & 2u ? -Result : Result;
+	}
+
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		// Signed 64-bit products of the 32-bit lanes 0 and 2. SSE2 only multiplies unsigned lanes, and
+		// correcting the sign costs more than scalar 64-bit multiplications.
+		GLM_FUNC_QUALIFIER __m128i fixed_mul_epi32(__m128i a, __m128i b)
+		{
+			return _mm_mul_epi32(a, b);
+		}
+
+		template <int F>
+		GLM_FUNC_QUALIFIER __m128i fixed_round_epi64(__m128i Value)
+		{
+			__m128i const Half = _mm_set_epi32(0, 1 << (F - 1), 0, 1 << (F - 1));
+			return _mm_srli_epi64(_mm_add_epi64(Value, Half), F);
+		}
+
+		// Lanes 0, 2 from the low 32 bits of the 64-bit lanes of Even, lanes 1, 3 from Odd
+		GLM_FUNC_QUALIFIER __m128i fixed_interleave(__m128i Even, __m128i Odd)
+		{
+			return _mm_or_si128(_mm_and_si128(Even, _mm_set_epi32(0, -1, 0, -1)), _mm_slli_epi64(Odd, 32));
+		}
+
+		GLM_FUNC_QUALIFIER __m128i fixed_odd(__m128i Value)
+		{
+			return _mm_srli_epi64(Value, 32);
+		}
+
+		template <int F>
+		GLM_FUNC_QUALIFIER __m128i fixed_mul_sse2(__m128i a, __m128i b)
+		{
+			__m128i const Even = fixed_mul_epi32(a, b);
+			__m128i const Odd = fixed_mul_epi32(fixed_odd(a), fixed_odd(b));
+			return fixed_interleave(fixed_round_epi64<F>(Even), fixed_round_epi64<F>(Odd));
+		}
+
+		// Exact x * x + y * y + z * z of four vectors as 64-bit lanes, vectors 0, 2 in Even and 1, 3 in Odd
+		GLM_FUNC_QUALIFIER void fixed_dot_epi64(__m128i ax, __m128i ay, __m128i az, __m128i bx, __m128i by, __m128i bz, __m128i & Even, __m128i & Odd)
+		{
+			Even = _mm_add_epi64(_mm_add_epi64(fixed_mul_epi32(ax, bx), fixed_mul_epi32(ay, by)), fixed_mul_epi32(az, bz));
+			Odd = _mm_add_epi64(_mm_add_epi64(
+				fixed_mul_epi32(fixed_odd(ax), fixed_odd(bx)),
+				fixed_mul_epi32(fixed_odd(ay), fixed_odd(by))),
+				fixed_mul_epi32(fixed_odd(az), fixed_odd(bz)));
+		}
+
+		// a * b - c * d rounded once
+		template <int F>
+		GLM_FUNC_QUALIFIER __m128i fixed_cross_sse2(__m128i a, __m128i b, __m128i c, __m128i d)
+		{
+			__m128i const Even = _mm_sub_epi64(fixed_mul_epi32(a, b), fixed_mul_epi32(c, d));
+			__m128i const Odd = _mm_sub_epi64(fixed_mul_epi32(fixed_odd(a), fixed_odd(b)), fixed_mul_epi32(fixed_odd(c), fixed_odd(d)));
+			return fixed_interleave(fixed_round_epi64<F>(Even), fixed_round_epi64<F>(Odd));
+		}
+
+		// Four packed three component vectors to one register per component, and back
+		GLM_FUNC_QUALIFIER void fixed_load_soa(int32 const * Data, __m128i & x, __m128i & y, __m128i & z)
+		{
+			__m128 const a = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<__m128i const *>(Data)));
+			__m128 const b = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<__m128i const *>(Data + 4)));
+			__m128 const c = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<__m128i const *>(Data + 8)));
+			__m128 const xy23 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2));
+			__m128 const yz01 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1));
+			x = _mm_castps_si128(_mm_shuffle_ps(a, xy23, _MM_SHUFFLE(2, 0, 3, 0)));
+			y = _mm_castps_si128(_mm_shuffle_ps(yz01, xy23, _MM_SHUFFLE(3, 1, 2, 0)));
+			z = _mm_castps_si128(_mm_shuffle_ps(yz01, c, _MM_SHUFFLE(3, 0, 3, 1)));
+		}
+
+		GLM_FUNC_QUALIFIER void fixed_store_aos(int32 * Data, __m128i x, __m128i y, __m128i z)
+		{
+			__m128 const fx = _mm_castsi128_ps(x);
+			__m128 const fy = _mm_castsi128_ps(y);
+			__m128 const fz = _mm_castsi128_ps(z);
+			__m128 const a = _mm_shuffle_ps(_mm_shuffle_ps(fx, fy, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(fz, fx, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+			__m128 const b = _mm_shuffle_ps(_mm_shuffle_ps(fy, fz, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(fx, fy, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+			__m128 const c = _mm_shuffle_ps(_mm_shuffle_ps(fz, fx, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(fy, fz, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(Data), _mm_castps_si128(a));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(Data + 4), _mm_castps_si128(b));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(Data + 8), _mm_castps_si128(c));
+		}
+#	endif//GLM_ARCH & GLM_ARCH_SSE41_BIT
+}//namespace detail
+
+	// fixed
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER fixed<I, F>::fixed(int Value) :
+		Raw(detail::fixed_from_double<F>(static_cast<double>(Value)))
+	{}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER fixed<I, F>::fixed(float Value) :
+		Raw(detail::fixed_from_double<F>(static_cast<double>(Value)))
+	{}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER fixed<I, F>::fixed(double Value) :
+		Raw(detail::fixed_from_double<F>(Value))
+	{}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER fixed<I, F>::operator float() const
+	{
+		return static_cast<float>(static_cast<double>(this->Raw) / static_cast<double>(1 << F));
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER fixed<I, F>::operator double() const
+	{
+		return static_cast<double>(this->Raw) / static_cast<double>(1 << F);
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER fixed<I, F>::operator int() const
+	{
+		return this->Raw >> F;
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER fixed<I, F> fixed<I, F>::raw(int32 Bits)
+	{
+		fixed Result;
+		Result.Raw = Bits;
+		return Result;
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER fixed<I, F> & fixed<I, F>::operator+=(fixed Value)
+	{
+		return *this = *this + Value;
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER fixed<I, F> & fixed<I, F>::operator-=(fixed Value)
+	{
+		return *this = *this - Value;
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER fixed<I, F> & fixed<I, F>::operator*=(fixed Value)
+	{
+		return *this = *this * Value;
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER fixed<I, F> & fixed<I, F>::operator/=(fixed Value)
+	{
+		return *this = *this / Value;
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER fixed<I, F> & fixed<I, F>::operator++()
+	{
+		return *this += raw(1 << F);
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER fixed<I, F> & fixed<I, F>::operator--()
+	{
+		return *this -= raw(1 << F);
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER fixed<I, F> fixed<I, F>::operator++(int)
+	{
+		fixed const Result(*this);
+		++*this;
+		return Result;
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER fixed<I, F> fixed<I, F>::operator--(int)
+	{
+		fixed const Result(*this);
+		--*this;
+		return Result;
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER fixed<I, F> operator+(fixed<I, F> Value)
+	{
+		return Value;
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER fixed<I, F> operator-(fixed<I, F> Value)
+	{
+		return fixed<I, F>::raw(detail::fixed_wrap(0u - static_cast<uint64>(static_cast<uint32>(Value.Raw))));
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER fixed<I, F> operator+(fixed<I, F> a, fixed<I, F> b)
+	{
+		return fixed<I, F>::raw(detail::fixed_wrap(static_cast<uint64>(static_cast<uint32>(a.Raw)) + static_cast<uint32>(b.Raw)));
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER fixed<I, F> operator-(fixed<I, F> a, fixed<I, F> b)
+	{
+		return fixed<I, F>::raw(detail::fixed_wrap(static_cast<uint64>(static_cast<uint32>(a.Raw)) - static_cast<uint32>(b.Raw)));
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER fixed<I, F> operator*(fixed<I, F> a, fixed<I, F> b)
+	{
+		return fixed<I, F>::raw(detail::fixed_round<F>(detail::fixed_product(a.Raw, b.Raw)));
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER fixed<I, F> operator/(fixed<I, F> a, fixed<I, F> b)
+	{
+		assert(b.Raw != 0);
+		int64 const Quotient = static_cast<int64>(a.Raw) * (static_cast<int64>(1) << F) / static_cast<int64>(b.Raw);
+		return fixed<I, F>::raw(detail::fixed_wrap(static_cast<uint64>(Quotient)));
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER bool operator==(fixed<I, F> a, fixed<I, F> b)
+	{
+		return a.Raw == b.Raw;
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER bool operator!=(fixed<I, F> a, fixed<I, F> b)
+	{
+		return a.Raw != b.Raw;
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER bool operator<(fixed<I, F> a, fixed<I, F> b)
+	{
+		return a.Raw < b.Raw;
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER bool operator<=(fixed<I, F> a, fixed<I, F> b)
+	{
+		return a.Raw <= b.Raw;
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER bool operator>(fixed<I, F> a, fixed<I, F> b)
+	{
+		return a.Raw > b.Raw;
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER bool operator>=(fixed<I, F> a, fixed<I, F> b)
+	{
+		return a.Raw >= b.Raw;
+	}
+
+	// Geometric and trigonometric functions
+
+	template <int I, int F, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER fixed<I, F> dot(vecType<fixed<I, F>, P> const & x, vecType<fixed<I, F>, P> const & y)
+	{
+		uint64 Sum = 0;
+		for(length_t i = 0; i < x.length(); ++i)
+			Sum += detail::fixed_product(x[i].Raw, y[i].Raw);
+		return fixed<I, F>::raw(detail::fixed_round<F>(Sum));
+	}
+
+	template <int I, int F, precision P>
+	GLM_FUNC_QUALIFIER tvec3<fixed<I, F>, P> cross(tvec3<fixed<I, F>, P> const & x, tvec3<fixed<I, F>, P> const & y)
+	{
+		return tvec3<fixed<I, F>, P>(
+			fixed<I, F>::raw(detail::fixed_round<F>(detail::fixed_product(x.y.Raw, y.z.Raw) - detail::fixed_product(y.y.Raw, x.z.Raw))),
+			fixed<I, F>::raw(detail::fixed_round<F>(detail::fixed_product(x.z.Raw, y.x.Raw) - detail::fixed_product(y.z.Raw, x.x.Raw))),
+			fixed<I, F>::raw(detail::fixed_round<F>(detail::fixed_product(x.x.Raw, y.y.Raw) - detail::fixed_product(y.x.Raw, x.y.Raw))));
+	}
+
+	template <int I, int F, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<fixed<I, F>, P> normalize(vecType<fixed<I, F>, P> const & x)
+	{
+		uint64 SquaredLength = 0;
+		for(length_t i = 0; i < x.length(); ++i)
+			SquaredLength += detail::fixed_product(x[i].Raw, x[i].Raw);
+		if(SquaredLength == 0)
+			return x;
+
+		uint32 Reciprocal = 0;
+		int Shift = 0;
+		detail::fixed_rsqrt<F>(SquaredLength, Reciprocal, Shift);
+
+		vecType<fixed<I, F>, P> Result(x);
+		for(length_t i = 0; i < x.length(); ++i)
+			Result[i].Raw = detail::fixed_scale(x[i].Raw, Reciprocal, Shift);
+		return Result;
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER fixed<I, F> sin(fixed<I, F> angle)
+	{
+		return fixed<I, F>::raw(detail::fixed_sin<F>(angle.Raw, 0));
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER fixed<I, F> cos(fixed<I, F> angle)
+	{
+		return fixed<I, F>::raw(detail::fixed_sin<F>(angle.Raw, 0x40000000u));
+	}
+
+	template <int I, int F, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<fixed<I, F>, P> sin(vecType<fixed<I, F>, P> const & angle)
+	{
+		vecType<fixed<I, F>, P> Result(angle);
+		for(length_t i = 0; i < angle.length(); ++i)
+			Result[i] = sin(angle[i]);
+		return Result;
+	}
+
+	template <int I, int F, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<fixed<I, F>, P> cos(vecType<fixed<I, F>, P> const & angle)
+	{
+		vecType<fixed<I, F>, P> Result(angle);
+		for(length_t i = 0; i < angle.length(); ++i)
+			Result[i] = cos(angle[i]);
+		return Result;
+	}
+
+	// Arrays
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER void add(fixed<I, F> const * a, fixed<I, F> const * b, fixed<I, F> * Results, std::size_t Count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i + 4 <= Count; i += 4)
+			{
+				__m128i const A = _mm_loadu_si128(reinterpret_cast<__m128i const *>(a + i));
+				__m128i const B = _mm_loadu_si128(reinterpret_cast<__m128i const *>(b + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(Results + i), _mm_add_epi32(A, B));
+			}
+#		endif
+		for(; i < Count; ++i)
+			Results[i] = a[i] + b[i];
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER void mul(fixed<I, F> const * a, fixed<I, F> const * b, fixed<I, F> * Results, std::size_t Count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE41_BIT
+			for(; i + 4 <= Count; i += 4)
+			{
+				__m128i const A = _mm_loadu_si128(reinterpret_cast<__m128i const *>(a + i));
+				__m128i const B = _mm_loadu_si128(reinterpret_cast<__m128i const *>(b + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(Results + i), detail::fixed_mul_sse2<F>(A, B));
+			}
+#		endif
+		for(; i < Count; ++i)
+			Results[i] = a[i] * b[i];
+	}
+
+	template <int I, int F, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER void add(vecType<fixed<I, F>, P> const * a, vecType<fixed<I, F>, P> const * b, vecType<fixed<I, F>, P> * Results, std::size_t Count)
+	{
+		std::size_t const Length = static_cast<std::size_t>(vecType<fixed<I, F>, P>::length());
+		if(sizeof(vecType<fixed<I, F>, P>) == sizeof(fixed<I, F>) * Length)
+			add(reinterpret_cast<fixed<I, F> const *>(a), reinterpret_cast<fixed<I, F> const *>(b), reinterpret_cast<fixed<I, F> *>(Results), Count * Length);
+		else for(std::size_t i = 0; i < Count; ++i)
+			Results[i] = a[i] + b[i];
+	}
+
+	template <int I, int F, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER void mul(vecType<fixed<I, F>, P> const * a, vecType<fixed<I, F>, P> const * b, vecType<fixed<I, F>, P> * Results, std::size_t Count)
+	{
+		std::size_t const Length = static_cast<std::size_t>(vecType<fixed<I, F>, P>::length());
+		if(sizeof(vecType<fixed<I, F>, P>) == sizeof(fixed<I, F>) * Length)
+			mul(reinterpret_cast<fixed<I, F> const *>(a), reinterpret_cast<fixed<I, F> const *>(b), reinterpret_cast<fixed<I, F> *>(Results), Count * Length);
+		else for(std::size_t i = 0; i < Count; ++i)
+			Results[i] = a[i] * b[i];
+	}
+
+	template <int I, int F, precision P>
+	GLM_FUNC_QUALIFIER void dot(tvec3<fixed<I, F>, P> const * x, tvec3<fixed<I, F>, P> const * y, fixed<I, F> * Results, std::size_t Count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE41_BIT
+			for(; sizeof(tvec3<fixed<I, F>, P>) == sizeof(int32) * 3 && i + 4 <= Count; i += 4)
+			{
+				__m128i ax, ay, az, bx, by, bz, Even, Odd;
+				detail::fixed_load_soa(&x[i].x.Raw, ax, ay, az);
+				detail::fixed_load_soa(&y[i].x.Raw, bx, by, bz);
+				detail::fixed_dot_epi64(ax, ay, az, bx, by, bz, Even, Odd);
+				__m128i const Dot = detail::fixed_interleave(detail::fixed_round_epi64<F>(Even), detail::fixed_round_epi64<F>(Odd));
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(Results + i), Dot);
+			}
+#		endif
+		for(; i < Count; ++i)
+			Results[i] = dot(x[i], y[i]);
+	}
+
+	template <int I, int F, precision P>
+	GLM_FUNC_QUALIFIER void cross(tvec3<fixed<I, F>, P> const * x, tvec3<fixed<I, F>, P> const * y, tvec3<fixed<I, F>, P> * Results, std::size_t Count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_SSE41_BIT
+			for(; sizeof(tvec3<fixed<I, F>, P>) == sizeof(int32) * 3 && i + 4 <= Count; i += 4)
+			{
+				__m128i ax, ay, az, bx, by, bz;
+				detail::fixed_load_soa(&x[i].x.Raw, ax, ay, az);
+				detail::fixed_load_soa(&y[i].x.Raw, bx, by, bz);
+				detail::fixed_store_aos(&Results[i].x.Raw,
+					detail::fixed_cross_sse2<F>(ay, bz, by, az),
+					detail::fixed_cross_sse2<F>(az, bx, bz, ax),
+					detail::fixed_cross_sse2<F>(ax, by, bx, ay));
+			}
+#		endif
+		for(; i < Count; ++i)
+			Results[i] = cross(x[i], y[i]);
+	}
+
+	template <int I, int F, precision P>
+	GLM_FUNC_QUALIFIER void normalize(tvec3<fixed<I, F>, P> const * x, tvec3<fixed<I, F>, P> * Results, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Results[i] = normalize(x[i]);
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER void sin(fixed<I, F> const * Angles, fixed<I, F> * Results, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Results[i].Raw = detail::fixed_sin<F>(Angles[i].Raw, 0);
+	}
+
+	template <int I, int F>
+	GLM_FUNC_QUALIFIER void cos(fixed<I, F> const * Angles, fixed<I, F> * Results, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Results[i].Raw = detail::fixed_sin<F>(Angles[i].Raw, 0x40000000u);
+	}
+}//namespace glm
@@ -0,0 +1,210 @@
+/// @ref gtx_half_float
+/// @file glm/gtx/half_float.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_half_float GLM_GTX_half_float
+/// @ingroup gtx
+///
+/// @brief 16-bit floating point storage types: half, hvec2, hvec3, hvec4 and hmat4.
+///
+/// These types hold IEEE 754 binary16 values and take half the memory of their float counterparts. They are
+/// storage types: arithmetic widens them to float and vectors of float, and conversions to half round to nearest
+/// even. Conversions use the F16C instructions when the compiler targets them (with AVX2, or -mf16c), SSE2
+/// integer and float operations otherwise, and scalar code and detail::toFloat32 without SIMD. Unlike
+/// detail::toFloat16, every path rounds ties to even so that all builds produce the same halves.
+///
+/// <glm/gtx/half_float.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../detail/type_half.hpp"
+#include <cstddef>
+#include <cstring>
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_half_float extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_half_float
+	/// @{
+
+	/// 16-bit floating point number, converted implicitly from and to float.
+	/// @see gtx_half_float
+	struct half
+	{
+		GLM_FUNC_DECL half();
+
+		/// Rounds to the nearest half, ties to even
+		GLM_FUNC_DECL half(float Value);
+		GLM_FUNC_DECL operator float() const;
+
+		/// IEEE 754 binary16 bits
+		uint16 Bits;
+	};
+
+	/// Vector of two 16-bit floating point numbers.
+	/// @see gtx_half_float
+	struct hvec2
+	{
+		GLM_FUNC_DECL hvec2();
+		GLM_FUNC_DECL explicit hvec2(half Scalar);
+		GLM_FUNC_DECL hvec2(half x, half y);
+		template <precision P>
+		GLM_FUNC_DECL explicit hvec2(tvec2<float, P> const & v);
+		template <precision P>
+		GLM_FUNC_DECL operator tvec2<float, P>() const;
+
+		GLM_FUNC_DECL static length_t length(){return 2;}
+		GLM_FUNC_DECL half & operator[](length_t i);
+		GLM_FUNC_DECL half const & operator[](length_t i) const;
+
+		half x, y;
+	};
+
+	/// Vector of three 16-bit floating point numbers.
+	/// @see gtx_half_float
+	struct hvec3
+	{
+		GLM_FUNC_DECL hvec3();
+		GLM_FUNC_DECL explicit hvec3(half Scalar);
+		GLM_FUNC_DECL hvec3(half x, half y, half z);
+		template <precision P>
+		GLM_FUNC_DECL explicit hvec3(tvec3<float, P> const & v);
+		template <precision P>
+		GLM_FUNC_DECL operator tvec3<float, P>() const;
+
+		GLM_FUNC_DECL static length_t length(){return 3;}
+		GLM_FUNC_DECL half & operator[](length_t i);
+		GLM_FUNC_DECL half const & operator[](length_t i) const;
+
+		half x, y, z;
+	};
+
+	/// Vector of four 16-bit floating point numbers, converted four components at once.
+	/// @see gtx_half_float
+	struct hvec4
+	{
+		GLM_FUNC_DECL hvec4();
+		GLM_FUNC_DECL explicit hvec4(half Scalar);
+		GLM_FUNC_DECL hvec4(half x, half y, half z, half w);
+		template <precision P>
+		GLM_FUNC_DECL explicit hvec4(tvec4<float, P> const & v);
+		template <precision P>
+		GLM_FUNC_DECL operator tvec4<float, P>() const;
+
+		GLM_FUNC_DECL static length_t length(){return 4;}
+		GLM_FUNC_DECL half & operator[](length_t i);
+		GLM_FUNC_DECL half const & operator[](length_t i) const;
+
+		half x, y, z, w;
+	};
+
+	/// 4 * 4 matrix of 16-bit floating point numbers, column major like mat4.
+	/// @see gtx_half_float
+	struct hmat4
+	{
+		/// Identity, or uninitialized with GLM_FORCE_NO_CTOR_INIT
+		GLM_FUNC_DECL hmat4();
+		template <precision P>
+		GLM_FUNC_DECL explicit hmat4(tmat4x4<float, P> const & m);
+		template <precision P>
+		GLM_FUNC_DECL operator tmat4x4<float, P>() const;
+
+		GLM_FUNC_DECL static length_t length(){return 4;}
+		GLM_FUNC_DECL hvec4 & operator[](length_t i);
+		GLM_FUNC_DECL hvec4 const & operator[](length_t i) const;
+
+	private:
+		hvec4 value[4];
+	};
+
+	// Arithmetic, widened to float
+
+	GLM_FUNC_DECL vec2 operator-(hvec2 const & v);
+	GLM_FUNC_DECL vec2 operator+(hvec2 const & v1, hvec2 const & v2);
+	GLM_FUNC_DECL vec2 operator+(hvec2 const & v, float s);
+	GLM_FUNC_DECL vec2 operator+(float s, hvec2 const & v);
+	GLM_FUNC_DECL vec2 operator-(hvec2 const & v1, hvec2 const & v2);
+	GLM_FUNC_DECL vec2 operator-(hvec2 const & v, float s);
+	GLM_FUNC_DECL vec2 operator-(float s, hvec2 const & v);
+	GLM_FUNC_DECL vec2 operator*(hvec2 const & v1, hvec2 const & v2);
+	GLM_FUNC_DECL vec2 operator*(hvec2 const & v, float s);
+	GLM_FUNC_DECL vec2 operator*(float s, hvec2 const & v);
+	GLM_FUNC_DECL vec2 operator/(hvec2 const & v1, hvec2 const & v2);
+	GLM_FUNC_DECL vec2 operator/(hvec2 const & v, float s);
+	GLM_FUNC_DECL vec2 operator/(float s, hvec2 const & v);
+
+	GLM_FUNC_DECL vec3 operator-(hvec3 const & v);
+	GLM_FUNC_DECL vec3 operator+(hvec3 const & v1, hvec3 const & v2);
+	GLM_FUNC_DECL vec3 operator+(hvec3 const & v, float s);
+	GLM_FUNC_DECL vec3 operator+(float s, hvec3 const & v);
+	GLM_FUNC_DECL vec3 operator-(hvec3 const & v1, hvec3 const & v2);
+	GLM_FUNC_DECL vec3 operator-(hvec3 const & v, float s);
+	GLM_FUNC_DECL vec3 operator-(float s, hvec3 const & v);
+	GLM_FUNC_DECL vec3 operator*(hvec3 const & v1, hvec3 const & v2);
+	GLM_FUNC_DECL vec3 operator*(hvec3 const & v, float s);
+	GLM_FUNC_DECL vec3 operator*(float s, hvec3 const & v);
+	GLM_FUNC_DECL vec3 operator/(hvec3 const & v1, hvec3 const & v2);
+	GLM_FUNC_DECL vec3 operator/(hvec3 const & v, float s);
+	GLM_FUNC_DECL vec3 operator/(float s, hvec3 const & v);
+
+	GLM_FUNC_DECL vec4 operator-(hvec4 const & v);
+	GLM_FUNC_DECL vec4 operator+(hvec4 const & v1, hvec4 const & v2);
+	GLM_FUNC_DECL vec4 operator+(hvec4 const & v, float s);
+	GLM_FUNC_DECL vec4 operator+(float s, hvec4 const & v);
+	GLM_FUNC_DECL vec4 operator-(hvec4 const & v1, hvec4 const & v2);
+	GLM_FUNC_DECL vec4 operator-(hvec4 const & v, float s);
+	GLM_FUNC_DECL vec4 operator-(float s, hvec4 const & v);
+	GLM_FUNC_DECL vec4 operator*(hvec4 const & v1, hvec4 const & v2);
+	GLM_FUNC_DECL vec4 operator*(hvec4 const & v, float s);
+	GLM_FUNC_DECL vec4 operator*(float s, hvec4 const & v);
+	GLM_FUNC_DECL vec4 operator/(hvec4 const & v1, hvec4 const & v2);
+	GLM_FUNC_DECL vec4 operator/(hvec4 const & v, float s);
+	GLM_FUNC_DECL vec4 operator/(float s, hvec4 const & v);
+
+	GLM_FUNC_DECL vec4 operator*(hmat4 const & m, vec4 const & v);
+	GLM_FUNC_DECL vec4 operator*(hmat4 const & m, hvec4 const & v);
+
+	GLM_FUNC_DECL bool operator==(hvec2 const & v1, hvec2 const & v2);
+	GLM_FUNC_DECL bool operator!=(hvec2 const & v1, hvec2 const & v2);
+	GLM_FUNC_DECL bool operator==(hvec3 const & v1, hvec3 const & v2);
+	GLM_FUNC_DECL bool operator!=(hvec3 const & v1, hvec3 const & v2);
+	GLM_FUNC_DECL bool operator==(hvec4 const & v1, hvec4 const & v2);
+	GLM_FUNC_DECL bool operator!=(hvec4 const & v1, hvec4 const & v2);
+
+	/// Converts Count floats to halves, eight at once with SIMD instructions.
+	/// @see gtx_half_float
+	GLM_FUNC_DECL void packHalf(float const * Source, half * Destination, std::size_t Count);
+
+	/// Converts Count halves to floats, eight at once with SIMD instructions.
+	/// @see gtx_half_float
+	GLM_FUNC_DECL void unpackHalf(half const * Source, float * Destination, std::size_t Count);
+
+	/// Converts arrays of Count vectors or matrices, as arrays of floats when their components are contiguous.
+	/// @see gtx_half_float
+	template <precision P>
+	GLM_FUNC_DECL void packHalf(tvec2<float, P> const * Source, hvec2 * Destination, std::size_t Count);
+	template <precision P>
+	GLM_FUNC_DECL void packHalf(tvec3<float, P> const * Source, hvec3 * Destination, std::size_t Count);
+	template <precision P>
+	GLM_FUNC_DECL void packHalf(tvec4<float, P> const * Source, hvec4 * Destination, std::size_t Count);
+	template <precision P>
+	GLM_FUNC_DECL void packHalf(tmat4x4<float, P> const * Source, hmat4 * Destination, std::size_t Count);
+	template <precision P>
+	GLM_FUNC_DECL void unpackHalf(hvec2 const * Source, tvec2<float, P> * Destination, std::size_t Count);
+	template <precision P>
+	GLM_FUNC_DECL void unpackHalf(hvec3 const * Source, tvec3<float, P> * Destination, std::size_t Count);
+	template <precision P>
+	GLM_FUNC_DECL void unpackHalf(hvec4 const * Source, tvec4<float, P> * Destination, std::size_t Count);
+	template <precision P>
+	GLM_FUNC_DECL void unpackHalf(hmat4 const * Source, tmat4x4<float, P> * Destination, std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "half_float.inl"
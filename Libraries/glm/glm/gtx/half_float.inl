@@ -0,0 +1,489 @@
+/// @ref gtx_half_float
+/// @file glm/gtx/half_float.inl
+
+#if (GLM_ARCH & GLM_ARCH_AVX2_BIT) || ((GLM_ARCH & GLM_ARCH_AVX_BIT) && defined(__F16C__))
+#	define GLM_HALF_FLOAT_F16C
+#endif
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		// Four floats to halves rounded to nearest even, each in a 32-bit lane sign extended for _mm_packs_epi32
+		GLM_FUNC_QUALIFIER __m128i half_pack_sse2(__m128 f)
+		{
+			__m128i const Sign = _mm_set1_epi32(static_cast<int>(0x80000000u));
+			__m128i const Max = _mm_set1_epi32((127 + 16) << 23);
+			__m128i const MinNormal = _mm_set1_epi32((127 - 14) << 23);
+			__m128i const SubnormalMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+			__m128i const NormalBias = _mm_set1_epi32(0xfff - ((127 - 15) << 23));
+
+			__m128 const JustSign = _mm_and_ps(_mm_castsi128_ps(Sign), f);
+			__m128 const Abs = _mm_xor_ps(f, JustSign);
+			__m128i const AbsBits = _mm_castps_si128(Abs);
+
+			// Infinities, NaNs made quiet, and the floats rounding to them
+			__m128i const IsRegular = _mm_cmpgt_epi32(Max, AbsBits);
+			__m128i const NaNBit = _mm_and_si128(_mm_castps_si128(_mm_cmpunord_ps(Abs, Abs)), _mm_set1_epi32(0x200));
+			__m128i const Special = _mm_or_si128(NaNBit, _mm_set1_epi32(0x7c00));
+
+			// Subnormal halves are rounded by the float addition of a magic number
+			__m128i const IsSubnormal = _mm_cmpgt_epi32(MinNormal, AbsBits);
+			__m128i const Subnormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(Abs, _mm_castsi128_ps(SubnormalMagic))), SubnormalMagic);
+
+			// Normal halves rebias the exponent and round the mantissa, ties to even
+			__m128i const Odd = _mm_srai_epi32(_mm_slli_epi32(AbsBits, 31 - 13), 31);
+			__m128i const Normal = _mm_srli_epi32(_mm_sub_epi32(_mm_add_epi32(AbsBits, NormalBias), Odd), 13);
+
+			__m128i const Finite = _mm_or_si128(_mm_and_si128(IsSubnormal, Subnormal), _mm_andnot_si128(IsSubnormal, Normal));
+			__m128i const Result = _mm_or_si128(_mm_and_si128(IsRegular, Finite), _mm_andnot_si128(IsRegular, Special));
+			return _mm_or_si128(Result, _mm_srai_epi32(_mm_castps_si128(JustSign), 16));
+		}
+
+		// Four halves, zero extended in 32-bit lanes, to floats
+		GLM_FUNC_QUALIFIER __m128 half_unpack_sse2(__m128i h)
+		{
+			__m128i const ExpMant = _mm_and_si128(h, _mm_set1_epi32(0x7fff));
+			__m128i const JustSign = _mm_xor_si128(h, ExpMant);
+
+			// Scaling by 2^112 rebiases the exponent, and normalizes subnormals
+			__m128 const Scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(ExpMant, 13)), _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23)));
+			__m128i const WasInfNaN = _mm_cmpgt_epi32(ExpMant, _mm_set1_epi32(0x7bff));
+			__m128 const InfNaNExp = _mm_and_ps(_mm_castsi128_ps(WasInfNaN), _mm_castsi128_ps(_mm_set1_epi32(255 << 23)));
+			return _mm_or_ps(Scaled, _mm_or_ps(_mm_castsi128_ps(_mm_slli_epi32(JustSign, 16)), InfNaNExp));
+		}
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+	GLM_FUNC_QUALIFIER uint16 half_from_float(float f)
+	{
+#		if defined(GLM_HALF_FLOAT_F16C)
+			return static_cast<uint16>(_cvtss_sh(f, _MM_FROUND_TO_NEAREST_INT));
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			return static_cast<uint16>(_mm_cvtsi128_si32(half_pack_sse2(_mm_set_ss(f))));
+#		else
+			// detail::toFloat16 rounds ties away from zero, this scalar version of the SSE2 code rounds them to even
+			uint32 Bits = 0;
+			std::memcpy(&Bits, &f, sizeof(Bits));
+			uint32 const Sign = Bits & 0x80000000u;
+			Bits ^= Sign;
+
+			uint32 Result = 0;
+			if(Bits >= static_cast<uint32>(127 + 16) << 23)
+				Result = Bits > 0x7f800000u ? 0x7e00u : 0x7c00u;
+			else if(Bits < static_cast<uint32>(127 - 14) << 23)
+			{
+				uint32 const SubnormalMagic = static_cast<uint32>((127 - 15) + (23 - 10) + 1) << 23;
+				float Magic = 0.0f;
+				std::memcpy(&Magic, &SubnormalMagic, sizeof(Magic));
+				float Abs = 0.0f;
+				std::memcpy(&Abs, &Bits, sizeof(Abs));
+				float const Rounded = Abs + Magic;
+				std::memcpy(&Result, &Rounded, sizeof(Result));
+				Result -= SubnormalMagic;
+			}
+			else
+				Result = (Bits + 0xfffu - (static_cast<uint32>(127 - 15) << 23) + ((Bits >> 13) & 1u)) >> 13;
+			return static_cast<uint16>(Result | (Sign >> 16));
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER float half_to_float(uint16 h)
+	{
+#		if defined(GLM_HALF_FLOAT_F16C)
+			return _cvtsh_ss(h);
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			return _mm_cvtss_f32(half_unpack_sse2(_mm_cvtsi32_si128(h)));
+#		else
+			return toFloat32(static_cast<hdata>(h));
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void half_pack4(float const * In, uint16 * Out)
+	{
+#		if defined(GLM_HALF_FLOAT_F16C)
+			_mm_storel_epi64(reinterpret_cast<__m128i *>(Out), _mm_cvtps_ph(_mm_loadu_ps(In), _MM_FROUND_TO_NEAREST_INT));
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			__m128i const Packed = half_pack_sse2(_mm_loadu_ps(In));
+			_mm_storel_epi64(reinterpret_cast<__m128i *>(Out), _mm_packs_epi32(Packed, Packed));
+#		else
+			for(length_t i = 0; i < 4; ++i)
+				Out[i] = half_from_float(In[i]);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void half_unpack4(uint16 const * In, float * Out)
+	{
+#		if defined(GLM_HALF_FLOAT_F16C)
+			_mm_storeu_ps(Out, _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<__m128i const *>(In))));
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			_mm_storeu_ps(Out, half_unpack_sse2(_mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<__m128i const *>(In)), _mm_setzero_si128())));
+#		else
+			for(length_t i = 0; i < 4; ++i)
+				Out[i] = half_to_float(In[i]);
+#		endif
+	}
+
+	// Arrays of vectors or matrices of Components contiguous components are converted as arrays of scalars
+	template <typename floatType, typename halfType>
+	GLM_FUNC_QUALIFIER void half_pack_array(floatType const * Source, halfType * Destination, std::size_t Count, std::size_t Components)
+	{
+		if(sizeof(floatType) == sizeof(float) * Components && sizeof(halfType) == sizeof(half) * Components)
+			packHalf(reinterpret_cast<float const *>(Source), reinterpret_cast<half *>(Destination), Count * Components);
+		else for(std::size_t i = 0; i < Count; ++i)
+			Destination[i] = halfType(Source[i]);
+	}
+
+	template <typename halfType, typename floatType>
+	GLM_FUNC_QUALIFIER void half_unpack_array(halfType const * Source, floatType * Destination, std::size_t Count, std::size_t Components)
+	{
+		if(sizeof(floatType) == sizeof(float) * Components && sizeof(halfType) == sizeof(half) * Components)
+			unpackHalf(reinterpret_cast<half const *>(Source), reinterpret_cast<float *>(Destination), Count * Components);
+		else for(std::size_t i = 0; i < Count; ++i)
+			Destination[i] = static_cast<floatType>(Source[i]);
+	}
+}//namespace detail
+
+	// half
+
+	GLM_FUNC_QUALIFIER half::half()
+#		ifndef GLM_FORCE_NO_CTOR_INIT
+			: Bits(0)
+#		endif
+	{}
+
+	GLM_FUNC_QUALIFIER half::half(float Value) :
+		Bits(detail::half_from_float(Value))
+	{}
+
+	GLM_FUNC_QUALIFIER half::operator float() const
+	{
+		return detail::half_to_float(Bits);
+	}
+
+	// hvec2
+
+	GLM_FUNC_QUALIFIER hvec2::hvec2()
+	{}
+
+	GLM_FUNC_QUALIFIER hvec2::hvec2(half Scalar) :
+		x(Scalar), y(Scalar)
+	{}
+
+	GLM_FUNC_QUALIFIER hvec2::hvec2(half x_, half y_) :
+		x(x_), y(y_)
+	{}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER hvec2::hvec2(tvec2<float, P> const & v)
+	{
+		float const In[4] = {v.x, v.y, 0.0f, 0.0f};
+		uint16 Out[4];
+		detail::half_pack4(In, Out);
+		x.Bits = Out[0];
+		y.Bits = Out[1];
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER hvec2::operator tvec2<float, P>() const
+	{
+		uint16 const In[4] = {x.Bits, y.Bits, 0, 0};
+		float Out[4];
+		detail::half_unpack4(In, Out);
+		return tvec2<float, P>(Out[0], Out[1]);
+	}
+
+	GLM_FUNC_QUALIFIER half & hvec2::operator[](length_t i)
+	{
+		assert(i >= 0 && i < this->length());
+		return (&x)[i];
+	}
+
+	GLM_FUNC_QUALIFIER half const & hvec2::operator[](length_t i) const
+	{
+		assert(i >= 0 && i < this->length());
+		return (&x)[i];
+	}
+
+	// hvec3
+
+	GLM_FUNC_QUALIFIER hvec3::hvec3()
+	{}
+
+	GLM_FUNC_QUALIFIER hvec3::hvec3(half Scalar) :
+		x(Scalar), y(Scalar), z(Scalar)
+	{}
+
+	GLM_FUNC_QUALIFIER hvec3::hvec3(half x_, half y_, half z_) :
+		x(x_), y(y_), z(z_)
+	{}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER hvec3::hvec3(tvec3<float, P> const & v)
+	{
+		float const In[4] = {v.x, v.y, v.z, 0.0f};
+		uint16 Out[4];
+		detail::half_pack4(In, Out);
+		x.Bits = Out[0];
+		y.Bits = Out[1];
+		z.Bits = Out[2];
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER hvec3::operator tvec3<float, P>() const
+	{
+		uint16 const In[4] = {x.Bits, y.Bits, z.Bits, 0};
+		float Out[4];
+		detail::half_unpack4(In, Out);
+		return tvec3<float, P>(Out[0], Out[1], Out[2]);
+	}
+
+	GLM_FUNC_QUALIFIER half & hvec3::operator[](length_t i)
+	{
+		assert(i >= 0 && i < this->length());
+		return (&x)[i];
+	}
+
+	GLM_FUNC_QUALIFIER half const & hvec3::operator[](length_t i) const
+	{
+		assert(i >= 0 && i < this->length());
+		return (&x)[i];
+	}
+
+	// hvec4
+
+	GLM_FUNC_QUALIFIER hvec4::hvec4()
+	{}
+
+	GLM_FUNC_QUALIFIER hvec4::hvec4(half Scalar) :
+		x(Scalar), y(Scalar), z(Scalar), w(Scalar)
+	{}
+
+	GLM_FUNC_QUALIFIER hvec4::hvec4(half x_, half y_, half z_, half w_) :
+		x(x_), y(y_), z(z_), w(w_)
+	{}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER hvec4::hvec4(tvec4<float, P> const & v)
+	{
+		float const In[4] = {v.x, v.y, v.z, v.w};
+		uint16 Out[4];
+		detail::half_pack4(In, Out);
+		x.Bits = Out[0];
+		y.Bits = Out[1];
+		z.Bits = Out[2];
+		w.Bits = Out[3];
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER hvec4::operator tvec4<float, P>() const
+	{
+		uint16 const In[4] = {x.Bits, y.Bits, z.Bits, w.Bits};
+		float Out[4];
+		detail::half_unpack4(In, Out);
+		return tvec4<float, P>(Out[0], Out[1], Out[2], Out[3]);
+	}
+
+	GLM_FUNC_QUALIFIER half & hvec4::operator[](length_t i)
+	{
+		assert(i >= 0 && i < this->length());
+		return (&x)[i];
+	}
+
+	GLM_FUNC_QUALIFIER half const & hvec4::operator[](length_t i) const
+	{
+		assert(i >= 0 && i < this->length());
+		return (&x)[i];
+	}
+
+	// hmat4
+
+	GLM_FUNC_QUALIFIER hmat4::hmat4()
+	{
+#		ifndef GLM_FORCE_NO_CTOR_INIT
+			half const One(1.0f);
+			half const Zero(0.0f);
+			this->value[0] = hvec4(One, Zero, Zero, Zero);
+			this->value[1] = hvec4(Zero, One, Zero, Zero);
+			this->value[2] = hvec4(Zero, Zero, One, Zero);
+			this->value[3] = hvec4(Zero, Zero, Zero, One);
+#		endif
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER hmat4::hmat4(tmat4x4<float, P> const & m)
+	{
+		for(length_t i = 0; i < 4; ++i)
+			this->value[i] = hvec4(m[i]);
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER hmat4::operator tmat4x4<float, P>() const
+	{
+		return tmat4x4<float, P>(
+			static_cast<tvec4<float, P> >(this->value[0]),
+			static_cast<tvec4<float, P> >(this->value[1]),
+			static_cast<tvec4<float, P> >(this->value[2]),
+			static_cast<tvec4<float, P> >(this->value[3]));
+	}
+
+	GLM_FUNC_QUALIFIER hvec4 & hmat4::operator[](length_t i)
+	{
+		assert(i >= 0 && i < this->length());
+		return this->value[i];
+	}
+
+	GLM_FUNC_QUALIFIER hvec4 const & hmat4::operator[](length_t i) const
+	{
+		assert(i >= 0 && i < this->length());
+		return this->value[i];
+	}
+
+	// Arithmetic
+
+	GLM_FUNC_QUALIFIER vec2 operator-(hvec2 const & v){return -vec2(v);}
+	GLM_FUNC_QUALIFIER vec2 operator+(hvec2 const & v1, hvec2 const & v2){return vec2(v1) + vec2(v2);}
+	GLM_FUNC_QUALIFIER vec2 operator+(hvec2 const & v, float s){return vec2(v) + s;}
+	GLM_FUNC_QUALIFIER vec2 operator+(float s, hvec2 const & v){return s + vec2(v);}
+	GLM_FUNC_QUALIFIER vec2 operator-(hvec2 const & v1, hvec2 const & v2){return vec2(v1) - vec2(v2);}
+	GLM_FUNC_QUALIFIER vec2 operator-(hvec2 const & v, float s){return vec2(v) - s;}
+	GLM_FUNC_QUALIFIER vec2 operator-(float s, hvec2 const & v){return s - vec2(v);}
+	GLM_FUNC_QUALIFIER vec2 operator*(hvec2 const & v1, hvec2 const & v2){return vec2(v1) * vec2(v2);}
+	GLM_FUNC_QUALIFIER vec2 operator*(hvec2 const & v, float s){return vec2(v) * s;}
+	GLM_FUNC_QUALIFIER vec2 operator*(float s, hvec2 const & v){return s * vec2(v);}
+	GLM_FUNC_QUALIFIER vec2 operator/(hvec2 const & v1, hvec2 const & v2){return vec2(v1) / vec2(v2);}
+	GLM_FUNC_QUALIFIER vec2 operator/(hvec2 const & v, float s){return vec2(v) / s;}
+	GLM_FUNC_QUALIFIER vec2 operator/(float s, hvec2 const & v){return s / vec2(v);}
+
+	GLM_FUNC_QUALIFIER vec3 operator-(hvec3 const & v){return -vec3(v);}
+	GLM_FUNC_QUALIFIER vec3 operator+(hvec3 const & v1, hvec3 const & v2){return vec3(v1) + vec3(v2);}
+	GLM_FUNC_QUALIFIER vec3 operator+(hvec3 const & v, float s){return vec3(v) + s;}
+	GLM_FUNC_QUALIFIER vec3 operator+(float s, hvec3 const & v){return s + vec3(v);}
+	GLM_FUNC_QUALIFIER vec3 operator-(hvec3 const & v1, hvec3 const & v2){return vec3(v1) - vec3(v2);}
+	GLM_FUNC_QUALIFIER vec3 operator-(hvec3 const & v, float s){return vec3(v) - s;}
+	GLM_FUNC_QUALIFIER vec3 operator-(float s, hvec3 const & v){return s - vec3(v);}
+	GLM_FUNC_QUALIFIER vec3 operator*(hvec3 const & v1, hvec3 const & v2){return vec3(v1) * vec3(v2);}
+	GLM_FUNC_QUALIFIER vec3 operator*(hvec3 const & v, float s){return vec3(v) * s;}
+	GLM_FUNC_QUALIFIER vec3 operator*(float s, hvec3 const & v){return s * vec3(v);}
+	GLM_FUNC_QUALIFIER vec3 operator/(hvec3 const & v1, hvec3 const & v2){return vec3(v1) / vec3(v2);}
+	GLM_FUNC_QUALIFIER vec3 operator/(hvec3 const & v, float s){return vec3(v) / s;}
+	GLM_FUNC_QUALIFIER vec3 operator/(float s, hvec3 const & v){return s / vec3(v);}
+
+	GLM_FUNC_QUALIFIER vec4 operator-(hvec4 const & v){return -vec4(v);}
+	GLM_FUNC_QUALIFIER vec4 operator+(hvec4 const & v1, hvec4 const & v2){return vec4(v1) + vec4(v2);}
+	GLM_FUNC_QUALIFIER vec4 operator+(hvec4 const & v, float s){return vec4(v) + s;}
+	GLM_FUNC_QUALIFIER vec4 operator+(float s, hvec4 const & v){return s + vec4(v);}
+	GLM_FUNC_QUALIFIER vec4 operator-(hvec4 const & v1, hvec4 const & v2){return vec4(v1) - vec4(v2);}
+	GLM_FUNC_QUALIFIER vec4 operator-(hvec4 const & v, float s){return vec4(v) - s;}
+	GLM_FUNC_QUALIFIER vec4 operator-(float s, hvec4 const & v){return s - vec4(v);}
+	GLM_FUNC_QUALIFIER vec4 operator*(hvec4 const & v1, hvec4 const & v2){return vec4(v1) * vec4(v2);}
+	GLM_FUNC_QUALIFIER vec4 operator*(hvec4 const & v, float s){return vec4(v) * s;}
+	GLM_FUNC_QUALIFIER vec4 operator*(float s, hvec4 const & v){return s * vec4(v);}
+	GLM_FUNC_QUALIFIER vec4 operator/(hvec4 const & v1, hvec4 const & v2){return vec4(v1) / vec4(v2);}
+	GLM_FUNC_QUALIFIER vec4 operator/(hvec4 const & v, float s){return vec4(v) / s;}
+	GLM_FUNC_QUALIFIER vec4 operator/(float s, hvec4 const & v){return s / vec4(v);}
+
+	GLM_FUNC_QUALIFIER vec4 operator*(hmat4 const & m, vec4 const & v)
+	{
+		return vec4(m[0]) * v.x + vec4(m[1]) * v.y + vec4(m[2]) * v.z + vec4(m[3]) * v.w;
+	}
+
+	GLM_FUNC_QUALIFIER vec4 operator*(hmat4 const & m, hvec4 const & v)
+	{
+		return m * vec4(v);
+	}
+
+	GLM_FUNC_QUALIFIER bool operator==(hvec2 const & v1, hvec2 const & v2){return vec2(v1) == vec2(v2);}
+	GLM_FUNC_QUALIFIER bool operator!=(hvec2 const & v1, hvec2 const & v2){return !(v1 == v2);}
+	GLM_FUNC_QUALIFIER bool operator==(hvec3 const & v1, hvec3 const & v2){return vec3(v1) == vec3(v2);}
+	GLM_FUNC_QUALIFIER bool operator!=(hvec3 const & v1, hvec3 const & v2){return !(v1 == v2);}
+	GLM_FUNC_QUALIFIER bool operator==(hvec4 const & v1, hvec4 const & v2){return vec4(v1) == vec4(v2);}
+	GLM_FUNC_QUALIFIER bool operator!=(hvec4 const & v1, hvec4 const & v2){return !(v1 == v2);}
+
+	// Arrays
+
+	GLM_FUNC_QUALIFIER void packHalf(float const * Source, half * Destination, std::size_t Count)
+	{
+		uint16 * const Output = reinterpret_cast<uint16 *>(Destination);
+		std::size_t i = 0;
+#		if defined(GLM_HALF_FLOAT_F16C)
+			for(; i + 8 <= Count; i += 8)
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(Output + i), _mm256_cvtps_ph(_mm256_loadu_ps(Source + i), _MM_FROUND_TO_NEAREST_INT));
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i + 8 <= Count; i += 8)
+			{
+				__m128i const Low = detail::half_pack_sse2(_mm_loadu_ps(Source + i));
+				__m128i const High = detail::half_pack_sse2(_mm_loadu_ps(Source + i + 4));
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(Output + i), _mm_packs_epi32(Low, High));
+			}
+#		endif
+		for(; i < Count; ++i)
+			Output[i] = detail::half_from_float(Source[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackHalf(half const * Source, float * Destination, std::size_t Count)
+	{
+		uint16 const * const Input = reinterpret_cast<uint16 const *>(Source);
+		std::size_t i = 0;
+#		if defined(GLM_HALF_FLOAT_F16C)
+			for(; i + 8 <= Count; i += 8)
+				_mm256_storeu_ps(Destination + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<__m128i const *>(Input + i))));
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i + 8 <= Count; i += 8)
+			{
+				__m128i const Halves = _mm_loadu_si128(reinterpret_cast<__m128i const *>(Input + i));
+				_mm_storeu_ps(Destination + i, detail::half_unpack_sse2(_mm_unpacklo_epi16(Halves, _mm_setzero_si128())));
+				_mm_storeu_ps(Destination + i + 4, detail::half_unpack_sse2(_mm_unpackhi_epi16(Halves, _mm_setzero_si128())));
+			}
+#		endif
+		for(; i < Count; ++i)
+			Destination[i] = detail::half_to_float(Input[i]);
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER void packHalf(tvec2<float, P> const * Source, hvec2 * Destination, std::size_t Count)
+	{
+		detail::half_pack_array(Source, Destination, Count, 2);
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER void packHalf(tvec3<float, P> const * Source, hvec3 * Destination, std::size_t Count)
+	{
+		detail::half_pack_array(Source, Destination, Count, 3);
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER void packHalf(tvec4<float, P> const * Source, hvec4 * Destination, std::size_t Count)
+	{
+		detail::half_pack_array(Source, Destination, Count, 4);
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER void packHalf(tmat4x4<float, P> const * Source, hmat4 * Destination, std::size_t Count)
+	{
+		detail::half_pack_array(Source, Destination, Count, 16);
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER void unpackHalf(hvec2 const * Source, tvec2<float, P> * Destination, std::size_t Count)
+	{
+		detail::half_unpack_array(Source, Destination, Count, 2);
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER void unpackHalf(hvec3 const * Source, tvec3<float, P> * Destination, std::size_t Count)
+	{
+		detail::half_unpack_array(Source, Destination, Count, 3);
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER void unpackHalf(hvec4 const * Source, tvec4<float, P> * Destination, std::size_t Count)
+	{
+		detail::half_unpack_array(Source, Destination, Count, 4);
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER void unpackHalf(hmat4 const * Source, tmat4x4<float, P> * Destination, std::size_t Count)
+	{
+		detail::half_unpack_array(Source, Destination, Count, 16);
+	}
+}//namespace glm
@@ -0,0 +1,89 @@
+/// @ref gtx_isosurface
+/// @file glm/gtx/isosurface.hpp
+///
+/// @see core (dependence)
+/// @see gtc_noise (dependence)
+///
+/// @defgroup gtx_isosurface GLM_GTX_isosurface
+/// @ingroup gtx
+///
+/// @brief Triangle meshes of isosurfaces of scalar fields sampled on regular grids.
+///
+/// The field is sampled once per grid vertex. Mesh vertices are numbered from per row counts so that
+/// cells sharing an edge, or a cell for surface nets, reference the same vertex. Slabs of cells are
+/// processed in parallel and the output doesn't depend on the number of threads.
+///
+/// <glm/gtx/isosurface.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/noise.hpp"
+#include <cstddef>
+#include <vector>
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_isosurface extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_isosurface
+	/// @{
+
+	/// Meshing algorithm of an isosurface.
+	enum isosurface_mode
+	{
+		marching_cubes,	///< One vertex per grid edge crossing the surface, triangles within each cell
+		surface_nets	///< One vertex per cell crossing the surface, a quad per grid edge crossing the surface
+	};
+
+	/// Samples simplex noise at the vertices of a grid:
+	/// Values[x + Size.x * (y + Size.y * z)] = simplex(Origin + Spacing * (x, y, z)).
+	/// @see gtx_isosurface
+	template <typename T, precision P>
+	GLM_FUNC_DECL void simplexGrid(
+		tvec3<T, P> const & Origin,
+		T Spacing,
+		tvec3<int, P> const & Size,
+		T * Values);
+
+	/// Samples classic perlin noise at the vertices of a grid, with the layout of simplexGrid.
+	/// @see gtx_isosurface
+	template <typename T, precision P>
+	GLM_FUNC_DECL void perlinGrid(
+		tvec3<T, P> const & Origin,
+		T Spacing,
+		tvec3<int, P> const & Size,
+		T * Values);
+
+	/// Samples euclidean cellular noise at the vertices of a grid, with the layout of simplexGrid:
+	/// Values[x + Size.x * (y + Size.y * z)] = cellular(Origin + Spacing * (x, y, z)), F1 and F2.
+	/// @see gtx_isosurface
+	template <typename T, precision P>
+	GLM_FUNC_DECL void cellularGrid(
+		tvec3<T, P> const & Origin,
+		T Spacing,
+		tvec3<int, P> const & Size,
+		tvec2<T, P> * Values);
+
+	/// Extracts the isosurface Value == IsoValue of a field sampled with the layout of simplexGrid.
+	/// Samples lower than IsoValue are inside, triangles are front facing when seen from the outside.
+	/// Positions and Indices are replaced by the mesh, positions being Origin + Spacing * grid coordinates.
+	/// @see gtx_isosurface
+	template <typename T, precision P>
+	GLM_FUNC_DECL void isosurface(
+		T const * Values,
+		tvec3<int, P> const & Size,
+		T IsoValue,
+		tvec3<T, P> const & Origin,
+		T Spacing,
+		isosurface_mode Mode,
+		std::vector<tvec3<T, P> > & Positions,
+		std::vector<uint> & Indices);
+
+	/// @}
+}//namespace glm
+
+#include "isosurface.inl"
@@ -0,0 +1,556 @@
+/// @ref gtx_isosurface
+/// @file glm/gtx/isosurface.inl
+
+#include "../detail/_parallel.hpp"
+
+namespace glm{
+namespace detail
+{
+	// Cube corner c is at (c & 1, (c >> 1) & 1, (c >> 2) & 1). Edges 0-3 are along x, 4-7 along y and 8-11 along z,
+	// edge e going from corner isosurface_edge_corner(e) to corner isosurface_edge_corner(e) | (1 << e / 4).
+	GLM_FUNC_QUALIFIER int isosurface_edge_corner(int Edge)
+	{
+		static int const Corners[12] = {0, 2, 4, 6, 0, 1, 4, 5, 0, 1, 2, 3};
+		return Corners[Edge];
+	}
+
+	GLM_FUNC_QUALIFIER int isosurface_edge(int a, int b)
+	{
+		int const Axis = (a ^ b) == 1 ? 0 : (a ^ b) == 2 ? 1 : 2;
+		int const Corner = a < b ? a : b;
+		for(int e = Axis * 4; e < Axis * 4 + 4; ++e)
+			if(isosurface_edge_corner(e) == Corner)
+				return e;
+		return -1;
+	}
+
+	// Whether two cube edges lie on a common face
+	GLM_FUNC_QUALIFIER bool isosurface_coplanar(int e0, int e1)
+	{
+		int const a0 = isosurface_edge_corner(e0);
+		int const a1 = a0 | (1 << e0 / 4);
+		int const b0 = isosurface_edge_corner(e1);
+		int const b1 = b0 | (1 << e1 / 4);
+		for(int Bit = 1; Bit < 8; Bit <<= 1)
+			if((a0 & Bit) == (a1 & Bit) && (a0 & Bit) == (b0 & Bit) && (a0 & Bit) == (b1 & Bit))
+				return true;
+		return false;
+	}
+
+	// Marching cubes triangulation of the 256 cases, built from the intersection of the surface with the cube faces:
+	// on each face, arcs of inside corners are cut off by a segment, the inside corners of ambiguous faces being
+	// separated. Segments chain into polygons which are triangulated as fans, the apex being chosen so that no
+	// diagonal lies on a cube face where it would be shared with the neighbor cell.
+	struct marching_cubes_table
+	{
+		signed char Edges[256][16];
+
+		marching_cubes_table()
+		{
+			int Faces[6][4] = {{0, 2, 6, 4}, {1, 3, 7, 5}, {0, 1, 5, 4}, {2, 3, 7, 6}, {0, 1, 3, 2}, {4, 5, 7, 6}};
+
+			// Counterclockwise corners around the outward face normal
+			for(int f = 0; f < 6; ++f)
+			{
+				int const Axis = f / 2;
+				int const Sign = f % 2 ? 1 : -1;
+				int p[3][3];
+				for(int k = 0; k < 3; ++k)
+				for(int i = 0; i < 3; ++i)
+					p[k][i] = (Faces[f][k] >> i) & 1;
+				int const u[3] = {p[1][0] - p[0][0], p[1][1] - p[0][1], p[1][2] - p[0][2]};
+				int const v[3] = {p[2][0] - p[1][0], p[2][1] - p[1][1], p[2][2] - p[1][2]};
+				int const n[3] = {u[1] * v[2] - u[2] * v[1], u[2] * v[0] - u[0] * v[2], u[0] * v[1] - u[1] * v[0]};
+				if(n[Axis] * Sign < 0)
+				{
+					int const Tmp = Faces[f][1];
+					Faces[f][1] = Faces[f][3];
+					Faces[f][3] = Tmp;
+				}
+			}
+
+			for(int Case = 0; Case < 256; ++Case)
+			{
+				int Next[12];
+				for(int e = 0; e < 12; ++e)
+					Next[e] = -1;
+
+				for(int f = 0; f < 6; ++f)
+				for(int k = 0; k < 4; ++k)
+				{
+					int const * q = Faces[f];
+					if(!((Case >> q[k]) & 1) || ((Case >> q[(k + 3) % 4]) & 1))
+						continue;
+
+					int t = k;
+					while((Case >> q[(t + 1) % 4]) & 1)
+						t = (t + 1) % 4;
+					Next[isosurface_edge(q[t], q[(t + 1) % 4])] = isosurface_edge(q[(k + 3) % 4], q[k]);
+				}
+
+				int Count = 0;
+				bool Visited[12] = {false, false, false, false, false, false, false, false, false, false, false, false};
+				for(int e = 0; e < 12; ++e)
+				{
+					if(Next[e] < 0 || Visited[e])
+						continue;
+
+					int Polygon[12];
+					int Size = 0;
+					for(int i = e; !Visited[i]; i = Next[i])
+					{
+						Visited[i] = true;
+						Polygon[Size++] = i;
+					}
+
+					int Apex = 0;
+					for(int a = 0; a < Size; ++a)
+					{
+						bool Valid = true;
+						for(int i = 2; i + 1 < Size; ++i)
+							Valid = Valid && !isosurface_coplanar(Polygon[a], Polygon[(a + i) % Size]);
+						if(Valid)
+						{
+							Apex = a;
+							break;
+						}
+					}
+
+					for(int i = 1; i + 1 < Size; ++i)
+					{
+						Edges[Case][Count++] = static_cast<signed char>(Polygon[Apex]);
+						Edges[Case][Count++] = static_cast<signed char>(Polygon[(Apex + i) % Size]);
+						Edges[Case][Count++] = static_cast<signed char>(Polygon[(Apex + i + 1) % Size]);
+					}
+				}
+				Edges[Case][Count] = -1;
+			}
+
+			// Triangles of the corner 0 must face away from it, (1, 1, 1)
+			int const Triangle[3] = {Edges[1][0], Edges[1][1], Edges[1][2]};
+			int p[3][3];
+			for(int k = 0; k < 3; ++k)
+			for(int i = 0; i < 3; ++i)
+				p[k][i] = ((isosurface_edge_corner(Triangle[k]) >> i) & 1) * 2 + (Triangle[k] / 4 == i ? 1 : 0);
+			int const u[3] = {p[1][0] - p[0][0], p[1][1] - p[0][1], p[1][2] - p[0][2]};
+			int const v[3] = {p[2][0] - p[0][0], p[2][1] - p[0][1], p[2][2] - p[0][2]};
+			int const Dot = (u[1] * v[2] - u[2] * v[1]) + (u[2] * v[0] - u[0] * v[2]) + (u[0] * v[1] - u[1] * v[0]);
+
+			if(Dot < 0)
+				for(int Case = 0; Case < 256; ++Case)
+				for(int i = 0; Edges[Case][i] >= 0; i += 3)
+				{
+					signed char const Tmp = Edges[Case][i + 1];
+					Edges[Case][i + 1] = Edges[Case][i + 2];
+					Edges[Case][i + 2] = Tmp;
+				}
+		}
+	};
+
+	template <typename T, precision P>
+	struct isosurface_grid
+	{
+		T const * Values;
+		std::size_t SizeX;
+		std::size_t SizeY;
+		std::size_t SizeZ;
+		T IsoValue;
+		tvec3<T, P> Origin;
+		T Spacing;
+
+		bool inside(std::size_t x, std::size_t y, std::size_t z) const
+		{
+			return Values[(z * SizeY + y) * SizeX + x] < IsoValue;
+		}
+
+		// Whether the grid edge from (x, y, z) along Axis exists and crosses the surface
+		bool crossing(std::size_t x, std::size_t y, std::size_t z, int Axis) const
+		{
+			std::size_t const Size[3] = {SizeX, SizeY, SizeZ};
+			std::size_t const Coord[3] = {x, y, z};
+			if(Coord[Axis] + 1 >= Size[Axis])
+				return false;
+			std::size_t const Stride[3] = {1, SizeX, SizeX * SizeY};
+			std::size_t const i = (z * SizeY + y) * SizeX + x;
+			return (Values[i] < IsoValue) != (Values[i + Stride[Axis]] < IsoValue);
+		}
+
+		// Offset of the surface along the grid edge from (x, y, z) along Axis, in [0, 1]
+		T offset(std::size_t x, std::size_t y, std::size_t z, int Axis) const
+		{
+			std::size_t const Stride[3] = {1, SizeX, SizeX * SizeY};
+			std::size_t const i = (z * SizeY + y) * SizeX + x;
+			T const a = Values[i];
+			T const b = Values[i + Stride[Axis]];
+			return clamp((IsoValue - a) / (b - a), T(0), T(1));
+		}
+
+		int cell_case(std::size_t x, std::size_t y, std::size_t z) const
+		{
+			int Case = 0;
+			for(int c = 0; c < 8; ++c)
+				Case |= inside(x + (c & 1), y + ((c >> 1) & 1), z + ((c >> 2) & 1)) ? 1 << c : 0;
+			return Case;
+		}
+
+		tvec3<T, P> position(tvec3<T, P> const & GridPosition) const
+		{
+			return Origin + GridPosition * Spacing;
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_noise_grid
+	{
+		tvec3<T, P> Origin;
+		T Spacing;
+		std::size_t SizeX;
+		std::size_t SizeY;
+		bool Simplex;
+		T * Values;
+
+		// Samples the rows [Begin, End) of all the z layers, a row being evaluated as one batch
+		void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			std::vector<tvec3<T, P> > Positions(SizeX);
+			for(std::size_t Row = Begin; Row < End; ++Row)
+			{
+				T const y = static_cast<T>(Row % SizeY);
+				T const z = static_cast<T>(Row / SizeY);
+				for(std::size_t x = 0; x < SizeX; ++x)
+					Positions[x] = Origin + tvec3<T, P>(static_cast<T>(x), y, z) * Spacing;
+
+				T * RowValues = Values + Row * SizeX;
+				if(Simplex)
+					simplex(&Positions[0], RowValues, SizeX);
+				else
+					perlin(&Positions[0], RowValues, SizeX);
+			}
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_cellular_grid
+	{
+		tvec3<T, P> Origin;
+		T Spacing;
+		std::size_t SizeX;
+		std::size_t SizeY;
+		tvec2<T, P> * Values;
+
+		void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			std::vector<tvec3<T, P> > Positions(SizeX);
+			for(std::size_t Row = Begin; Row < End; ++Row)
+			{
+				T const y = static_cast<T>(Row % SizeY);
+				T const z = static_cast<T>(Row / SizeY);
+				for(std::size_t x = 0; x < SizeX; ++x)
+					Positions[x] = Origin + tvec3<T, P>(static_cast<T>(x), y, z) * Spacing;
+				cellular(&Positions[0], Values + Row * SizeX, SizeX, euclidean_distance);
+			}
+		}
+	};
+
+	// Counts the vertices of each row of grid vertices (marching cubes) or of cells (surface nets)
+	template <typename T, precision P>
+	struct compute_isosurface_count
+	{
+		isosurface_grid<T, P> Grid;
+		isosurface_mode Mode;
+		uint * RowCounts;
+
+		void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			for(std::size_t z = Begin; z < End; ++z)
+			{
+				if(Mode == marching_cubes)
+				{
+					for(std::size_t y = 0; y < Grid.SizeY; ++y)
+					{
+						uint Count = 0;
+						for(std::size_t x = 0; x < Grid.SizeX; ++x)
+						for(int Axis = 0; Axis < 3; ++Axis)
+							Count += Grid.crossing(x, y, z, Axis) ? 1 : 0;
+						RowCounts[z * Grid.SizeY + y] = Count;
+					}
+				}
+				else
+				{
+					for(std::size_t y = 0; y + 1 < Grid.SizeY; ++y)
+					{
+						uint Count = 0;
+						for(std::size_t x = 0; x + 1 < Grid.SizeX; ++x)
+						{
+							int const Case = Grid.cell_case(x, y, z);
+							Count += Case != 0 && Case != 255 ? 1 : 0;
+						}
+						RowCounts[z * (Grid.SizeY - 1) + y] = Count;
+					}
+				}
+			}
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_isosurface_vertices
+	{
+		isosurface_grid<T, P> Grid;
+		isosurface_mode Mode;
+		uint const * RowBase;
+		tvec3<T, P> * Positions;
+
+		void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			for(std::size_t z = Begin; z < End; ++z)
+			{
+				if(Mode == marching_cubes)
+				{
+					for(std::size_t y = 0; y < Grid.SizeY; ++y)
+					{
+						uint Index = RowBase[z * Grid.SizeY + y];
+						for(std::size_t x = 0; x < Grid.SizeX; ++x)
+						for(int Axis = 0; Axis < 3; ++Axis)
+						{
+							if(!Grid.crossing(x, y, z, Axis))
+								continue;
+							tvec3<T, P> GridPosition(static_cast<T>(x), static_cast<T>(y), static_cast<T>(z));
+							GridPosition[Axis] += Grid.offset(x, y, z, Axis);
+							Positions[Index++] = Grid.position(GridPosition);
+						}
+					}
+				}
+				else
+				{
+					// Average of the crossings of the cell edges
+					for(std::size_t y = 0; y + 1 < Grid.SizeY; ++y)
+					{
+						uint Index = RowBase[z * (Grid.SizeY - 1) + y];
+						for(std::size_t x = 0; x + 1 < Grid.SizeX; ++x)
+						{
+							int const Case = Grid.cell_case(x, y, z);
+							if(Case == 0 || Case == 255)
+								continue;
+
+							tvec3<T, P> Sum(T(0));
+							T Count(0);
+							for(int e = 0; e < 12; ++e)
+							{
+								int const c = isosurface_edge_corner(e);
+								int const Axis = e / 4;
+								if(((Case >> c) & 1) == ((Case >> (c | (1 << Axis))) & 1))
+									continue;
+								std::size_t const cx = x + (c & 1);
+								std::size_t const cy = y + ((c >> 1) & 1);
+								std::size_t const cz = z + ((c >> 2) & 1);
+								tvec3<T, P> Crossing(static_cast<T>(cx), static_cast<T>(cy), static_cast<T>(cz));
+								Crossing[Axis] += Grid.offset(cx, cy, cz, Axis);
+								Sum += Crossing;
+								Count += T(1);
+							}
+							Positions[Index++] = Grid.position(Sum / Count);
+						}
+					}
+				}
+			}
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_isosurface_triangles
+	{
+		isosurface_grid<T, P> Grid;
+		isosurface_mode Mode;
+		uint const * RowBase;
+		marching_cubes_table const * Table;
+		std::vector<uint> * Results;
+
+		// Vertex indices of the crossing grid edges of a z layer of grid vertices, 3 per vertex
+		void edge_layer(std::size_t z, std::vector<uint> & Layer) const
+		{
+			for(std::size_t y = 0; y < Grid.SizeY; ++y)
+			{
+				uint Index = RowBase[z * Grid.SizeY + y];
+				for(std::size_t x = 0; x < Grid.SizeX; ++x)
+				for(int Axis = 0; Axis < 3; ++Axis)
+					if(Grid.crossing(x, y, z, Axis))
+						Layer[(y * Grid.SizeX + x) * 3 + Axis] = Index++;
+			}
+		}
+
+		// Vertex indices of the cells crossing the surface of a z layer of cells
+		void cell_layer(std::size_t z, std::vector<uint> & Layer) const
+		{
+			for(std::size_t y = 0; y + 1 < Grid.SizeY; ++y)
+			{
+				uint Index = RowBase[z * (Grid.SizeY - 1) + y];
+				for(std::size_t x = 0; x + 1 < Grid.SizeX; ++x)
+				{
+					int const Case = Grid.cell_case(x, y, z);
+					if(Case != 0 && Case != 255)
+						Layer[y * (Grid.SizeX - 1) + x] = Index++;
+				}
+			}
+		}
+
+		// Emits the quad of four cells counterclockwise around the crossing edge Axis, flipped if its origin is outside
+		static void quad(bool Inside, uint a, uint b, uint c, uint d, std::vector<uint> & Result)
+		{
+			uint const Quad[6] = {a, b, c, a, c, d};
+			uint const Flipped[6] = {a, c, b, a, d, c};
+			Result.insert(Result.end(), Inside ? Quad : Flipped, (Inside ? Quad : Flipped) + 6);
+		}
+
+		void operator()(std::size_t Begin, std::size_t End, std::size_t Job) const
+		{
+			std::vector<uint> & Result = Results[Job];
+
+			if(Mode == marching_cubes)
+			{
+				std::vector<uint> Layer0(Grid.SizeX * Grid.SizeY * 3), Layer1(Layer0.size());
+				edge_layer(Begin, Layer0);
+				for(std::size_t z = Begin; z < End; ++z)
+				{
+					if(z > Begin)
+						Layer0.swap(Layer1);
+					edge_layer(z + 1, Layer1);
+
+					for(std::size_t y = 0; y + 1 < Grid.SizeY; ++y)
+					for(std::size_t x = 0; x + 1 < Grid.SizeX; ++x)
+					{
+						signed char const * Edges = Table->Edges[Grid.cell_case(x, y, z)];
+						for(int i = 0; Edges[i] >= 0; ++i)
+						{
+							int const c = isosurface_edge_corner(Edges[i]);
+							std::vector<uint> const & Layer = (c >> 2) & 1 ? Layer1 : Layer0;
+							Result.push_back(Layer[((y + ((c >> 1) & 1)) * Grid.SizeX + x + (c & 1)) * 3 + Edges[i] / 4]);
+						}
+					}
+				}
+				return;
+			}
+
+			std::size_t const SizeX = Grid.SizeX - 1;
+			std::vector<uint> Layer0(SizeX * (Grid.SizeY - 1)), Layer1(Layer0.size());
+			if(Begin > 0)
+				cell_layer(Begin - 1, Layer0);
+			for(std::size_t z = Begin; z < End; ++z)
+			{
+				if(z > Begin)
+					Layer0.swap(Layer1);
+				cell_layer(z, Layer1);
+
+				for(std::size_t y = 0; y < Grid.SizeY; ++y)
+				for(std::size_t x = 0; x < Grid.SizeX; ++x)
+				{
+					bool const Inside = Grid.inside(x, y, z);
+
+					if(z > 0 && y > 0 && y + 1 < Grid.SizeY && Grid.crossing(x, y, z, 0))
+						quad(Inside,
+							Layer0[(y - 1) * SizeX + x], Layer0[y * SizeX + x],
+							Layer1[y * SizeX + x], Layer1[(y - 1) * SizeX + x], Result);
+
+					if(z > 0 && x > 0 && x + 1 < Grid.SizeX && Grid.crossing(x, y, z, 1))
+						quad(Inside,
+							Layer0[y * SizeX + x - 1], Layer1[y * SizeX + x - 1],
+							Layer1[y * SizeX + x], Layer0[y * SizeX + x], Result);
+
+					if(x > 0 && y > 0 && x + 1 < Grid.SizeX && y + 1 < Grid.SizeY && Grid.crossing(x, y, z, 2))
+						quad(Inside,
+							Layer1[(y - 1) * SizeX + x - 1], Layer1[(y - 1) * SizeX + x],
+							Layer1[y * SizeX + x], Layer1[y * SizeX + x - 1], Result);
+				}
+			}
+		}
+	};
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void simplexGrid
+	(
+		tvec3<T, P> const & Origin,
+		T Spacing,
+		tvec3<int, P> const & Size,
+		T * Values
+	)
+	{
+		detail::compute_noise_grid<T, P> Func = {Origin, Spacing, static_cast<std::size_t>(Size.x), static_cast<std::size_t>(Size.y), true, Values};
+		detail::parallel_for(static_cast<std::size_t>(Size.y) * static_cast<std::size_t>(Size.z), 64, Func);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void perlinGrid
+	(
+		tvec3<T, P> const & Origin,
+		T Spacing,
+		tvec3<int, P> const & Size,
+		T * Values
+	)
+	{
+		detail::compute_noise_grid<T, P> Func = {Origin, Spacing, static_cast<std::size_t>(Size.x), static_cast<std::size_t>(Size.y), false, Values};
+		detail::parallel_for(static_cast<std::size_t>(Size.y) * static_cast<std::size_t>(Size.z), 64, Func);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void cellularGrid
+	(
+		tvec3<T, P> const & Origin,
+		T Spacing,
+		tvec3<int, P> const & Size,
+		tvec2<T, P> * Values
+	)
+	{
+		detail::compute_cellular_grid<T, P> Func = {Origin, Spacing, static_cast<std::size_t>(Size.x), static_cast<std::size_t>(Size.y), Values};
+		detail::parallel_for(static_cast<std::size_t>(Size.y) * static_cast<std::size_t>(Size.z), 64, Func);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void isosurface
+	(
+		T const * Values,
+		tvec3<int, P> const & Size,
+		T IsoValue,
+		tvec3<T, P> const & Origin,
+		T Spacing,
+		isosurface_mode Mode,
+		std::vector<tvec3<T, P> > & Positions,
+		std::vector<uint> & Indices
+	)
+	{
+		Positions.clear();
+		Indices.clear();
+		if(Size.x < 2 || Size.y < 2 || Size.z < 2)
+			return;
+
+		detail::isosurface_grid<T, P> const Grid = {
+			Values, static_cast<std::size_t>(Size.x), static_cast<std::size_t>(Size.y), static_cast<std::size_t>(Size.z),
+			IsoValue, Origin, Spacing};
+
+		// Marching cubes vertices are numbered by rows of grid vertices, surface nets vertices by rows of cells
+		std::size_t const Layers = Mode == marching_cubes ? Grid.SizeZ : Grid.SizeZ - 1;
+		std::size_t const RowsPerLayer = Mode == marching_cubes ? Grid.SizeY : Grid.SizeY - 1;
+		std::vector<uint> RowBase(Layers * RowsPerLayer + 1, 0);
+
+		detail::compute_isosurface_count<T, P> Count = {Grid, Mode, &RowBase[1]};
+		detail::parallel_for(Layers, 1, Count);
+		for(std::size_t i = 1; i < RowBase.size(); ++i)
+			RowBase[i] += RowBase[i - 1];
+
+		Positions.resize(RowBase.back());
+		if(Positions.empty())
+			return;
+
+		detail::compute_isosurface_vertices<T, P> Vertices = {Grid, Mode, &RowBase[0], &Positions[0]};
+		detail::parallel_for(Layers, 1, Vertices);
+
+		// Slabs of cells are independent, their triangles are concatenated in z order
+		detail::marching_cubes_table const Table;
+		std::size_t const Cells = Grid.SizeZ - 1;
+		std::vector<std::vector<uint> > Results(detail::parallel_jobs(Cells, 1));
+		detail::compute_isosurface_triangles<T, P> Triangles = {Grid, Mode, &RowBase[0], &Table, &Results[0]};
+		detail::parallel_for(Cells, 1, Triangles);
+
+		for(std::size_t i = 0; i < Results.size(); ++i)
+			Indices.insert(Indices.end(), Results[i].begin(), Results[i].end());
+	}
+}//namespace glm
@@ -0,0 +1,75 @@
+/// @ref gtx_large_world
+/// @file glm/gtx/large_world.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_large_world GLM_GTX_large_world
+/// @ingroup gtx
+///
+/// @brief Objects at double precision origins with float local transforms, rebased on the camera in float.
+///
+/// Each origin is split into two floats, High + Low, which keep about 48 bits of the double. Camera relative
+/// positions are differences of these pairs, computed in float with the rounding error of the high difference
+/// recovered exactly, so they are as accurate as rounding the double difference to float, without any double
+/// arithmetic per object. Batches use SSE2 four objects at once and run on several threads.
+///
+/// <glm/gtx/large_world.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+#include <vector>
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_large_world extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_large_world
+	/// @{
+
+	/// Objects stored as a structure of arrays: origins split into high and low floats, and local transforms.
+	/// @see gtx_large_world
+	struct large_world
+	{
+		/// Floats nearest to the origins
+		std::vector<float> HighX, HighY, HighZ;
+
+		/// Floats nearest to the origins less their high floats
+		std::vector<float> LowX, LowY, LowZ;
+
+		/// Transforms of the objects relative to their origin
+		std::vector<mat4> Locals;
+	};
+
+	/// Splits Value into High, the nearest float, and Low, the float nearest to Value - High.
+	/// @see gtx_large_world
+	GLM_FUNC_DECL void splitDouble(double Value, float & High, float & Low);
+
+	/// Appends an object and returns its index.
+	/// @see gtx_large_world
+	GLM_FUNC_DECL std::size_t addObject(large_world & World, dvec3 const & Origin, mat4 const & Local);
+
+	/// @see gtx_large_world
+	GLM_FUNC_DECL void setOrigin(large_world & World, std::size_t Index, dvec3 const & Origin);
+
+	/// The origin of an object, within 2^-47 of its magnitude.
+	/// @see gtx_large_world
+	GLM_FUNC_DECL dvec3 getOrigin(large_world const & World, std::size_t Index);
+
+	/// Origins of all objects relative to Eye, rounded to float.
+	/// @see gtx_large_world
+	GLM_FUNC_DECL void relativeOrigins(large_world const & World, dvec3 const & Eye, vec3 * Results);
+
+	/// Camera relative model view matrices View * translate(Origin - Eye) * Local of all objects, where View is the
+	/// view matrix of the camera moved to the origin: its rotation, without the translation of Eye.
+	/// @see gtx_large_world
+	GLM_FUNC_DECL void cameraRelative(large_world const & World, dvec3 const & Eye, mat4 const & View, mat4 * Results);
+
+	/// @}
+}//namespace glm
+
+#include "large_world.inl"
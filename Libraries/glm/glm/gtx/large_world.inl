@@ -0,0 +1,200 @@
+/// @ref gtx_large_world
+/// @file glm/gtx/large_world.inl
+
+#include "../detail/_parallel.hpp"
+
+namespace glm{
+namespace detail
+{
+	// (aHigh + aLow) - (bHigh + bLow) rounded to float: the rounding error of the high difference is recovered
+	// by the two sum algorithm, and added to the difference of the low parts before the final rounding.
+	GLM_FUNC_QUALIFIER float large_world_difference(float aHigh, float aLow, float bHigh, float bLow)
+	{
+		float const Sum = aHigh - bHigh;
+		float const Virtual = Sum - aHigh;
+		float const Error = (aHigh - (Sum - Virtual)) + (-bHigh - Virtual);
+		return Sum + (Error + (aLow - bLow));
+	}
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		GLM_FUNC_QUALIFIER __m128 large_world_difference(__m128 aHigh, __m128 aLow, __m128 bHigh, __m128 bLow)
+		{
+			__m128 const Sum = _mm_sub_ps(aHigh, bHigh);
+			__m128 const Virtual = _mm_sub_ps(Sum, aHigh);
+			__m128 const Error = _mm_add_ps(_mm_sub_ps(aHigh, _mm_sub_ps(Sum, Virtual)), _mm_sub_ps(_mm_setzero_ps(), _mm_add_ps(bHigh, Virtual)));
+			return _mm_add_ps(Sum, _mm_add_ps(Error, _mm_sub_ps(aLow, bLow)));
+		}
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+	// Eye split like the origins
+	struct large_world_eye
+	{
+		float High[3];
+		float Low[3];
+
+		GLM_FUNC_QUALIFIER explicit large_world_eye(dvec3 const & Eye)
+		{
+			splitDouble(Eye.x, High[0], Low[0]);
+			splitDouble(Eye.y, High[1], Low[1]);
+			splitDouble(Eye.z, High[2], Low[2]);
+		}
+	};
+
+	// Calls Func(Index, x, y, z) with the relative origin of each object of [Begin, End), four at once with SSE2
+	template <typename functor>
+	GLM_FUNC_QUALIFIER void large_world_relative(large_world const & World, large_world_eye const & Eye, std::size_t Begin, std::size_t End, functor const & Func)
+	{
+		std::size_t i = Begin;
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			__m128 const EyeHighX = _mm_set1_ps(Eye.High[0]);
+			__m128 const EyeHighY = _mm_set1_ps(Eye.High[1]);
+			__m128 const EyeHighZ = _mm_set1_ps(Eye.High[2]);
+			__m128 const EyeLowX = _mm_set1_ps(Eye.Low[0]);
+			__m128 const EyeLowY = _mm_set1_ps(Eye.Low[1]);
+			__m128 const EyeLowZ = _mm_set1_ps(Eye.Low[2]);
+			for(; i + 4 <= End; i += 4)
+			{
+				GLM_ALIGN(16) float x[4];
+				GLM_ALIGN(16) float y[4];
+				GLM_ALIGN(16) float z[4];
+				_mm_store_ps(x, large_world_difference(_mm_loadu_ps(&World.HighX[i]), _mm_loadu_ps(&World.LowX[i]), EyeHighX, EyeLowX));
+				_mm_store_ps(y, large_world_difference(_mm_loadu_ps(&World.HighY[i]), _mm_loadu_ps(&World.LowY[i]), EyeHighY, EyeLowY));
+				_mm_store_ps(z, large_world_difference(_mm_loadu_ps(&World.HighZ[i]), _mm_loadu_ps(&World.LowZ[i]), EyeHighZ, EyeLowZ));
+				for(std::size_t j = 0; j < 4; ++j)
+					Func(i + j, x[j], y[j], z[j]);
+			}
+#		endif
+		for(; i < End; ++i)
+			Func(i,
+				large_world_difference(World.HighX[i], World.LowX[i], Eye.High[0], Eye.Low[0]),
+				large_world_difference(World.HighY[i], World.LowY[i], Eye.High[1], Eye.Low[1]),
+				large_world_difference(World.HighZ[i], World.LowZ[i], Eye.High[2], Eye.Low[2]));
+	}
+
+	struct compute_relative_origin
+	{
+		vec3 * Results;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t Index, float x, float y, float z) const
+		{
+			Results[Index] = vec3(x, y, z);
+		}
+	};
+
+	// View * translate(t) * Local = View * Local + (View * vec4(t, 0)) * Local[3] component wise by column
+	struct compute_camera_relative_matrix
+	{
+		mat4 const * Locals;
+		mat4 const * View;
+		mat4 * Results;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t Index, float x, float y, float z) const
+		{
+			mat4 const & Local = Locals[Index];
+			mat4 & Result = Results[Index];
+#			if GLM_ARCH & GLM_ARCH_SSE2_BIT
+				__m128 const View0 = _mm_loadu_ps(&(*View)[0][0]);
+				__m128 const View1 = _mm_loadu_ps(&(*View)[1][0]);
+				__m128 const View2 = _mm_loadu_ps(&(*View)[2][0]);
+				__m128 const View3 = _mm_loadu_ps(&(*View)[3][0]);
+				__m128 const Translation = _mm_add_ps(_mm_add_ps(
+					_mm_mul_ps(View0, _mm_set1_ps(x)),
+					_mm_mul_ps(View1, _mm_set1_ps(y))),
+					_mm_mul_ps(View2, _mm_set1_ps(z)));
+				for(length_t i = 0; i < 4; ++i)
+				{
+					__m128 const Column = _mm_loadu_ps(&Local[i][0]);
+					__m128 const e0 = _mm_shuffle_ps(Column, Column, _MM_SHUFFLE(0, 0, 0, 0));
+					__m128 const e1 = _mm_shuffle_ps(Column, Column, _MM_SHUFFLE(1, 1, 1, 1));
+					__m128 const e2 = _mm_shuffle_ps(Column, Column, _MM_SHUFFLE(2, 2, 2, 2));
+					__m128 const e3 = _mm_shuffle_ps(Column, Column, _MM_SHUFFLE(3, 3, 3, 3));
+					__m128 const Rotated = _mm_add_ps(
+						_mm_add_ps(_mm_mul_ps(View0, e0), _mm_mul_ps(View1, e1)),
+						_mm_add_ps(_mm_mul_ps(View2, e2), _mm_mul_ps(_mm_add_ps(View3, Translation), e3)));
+					_mm_storeu_ps(&Result[i][0], Rotated);
+				}
+#			else
+				vec4 const Translation = (*View)[0] * x + (*View)[1] * y + (*View)[2] * z;
+				Result = *View * Local;
+				for(length_t i = 0; i < 4; ++i)
+					Result[i] += Translation * Local[i].w;
+#			endif
+		}
+	};
+
+	template <typename functor>
+	struct compute_large_world
+	{
+		large_world const * World;
+		large_world_eye const * Eye;
+		functor Func;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			large_world_relative(*World, *Eye, Begin, End, Func);
+		}
+	};
+
+	// Objects per job, small worlds are computed on the calling thread
+	static std::size_t const large_world_grain = 8192;
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void splitDouble(double Value, float & High, float & Low)
+	{
+		// Read back through a volatile: GCC 12 vectorizes neighbouring splits and drops the round trip through float
+		float const volatile Rounded = static_cast<float>(Value);
+		High = Rounded;
+		Low = static_cast<float>(Value - static_cast<double>(Rounded));
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t addObject(large_world & World, dvec3 const & Origin, mat4 const & Local)
+	{
+		std::size_t const Index = World.Locals.size();
+		World.HighX.push_back(0.0f);
+		World.HighY.push_back(0.0f);
+		World.HighZ.push_back(0.0f);
+		World.LowX.push_back(0.0f);
+		World.LowY.push_back(0.0f);
+		World.LowZ.push_back(0.0f);
+		World.Locals.push_back(Local);
+		setOrigin(World, Index, Origin);
+		return Index;
+	}
+
+	GLM_FUNC_QUALIFIER void setOrigin(large_world & World, std::size_t Index, dvec3 const & Origin)
+	{
+		splitDouble(Origin.x, World.HighX[Index], World.LowX[Index]);
+		splitDouble(Origin.y, World.HighY[Index], World.LowY[Index]);
+		splitDouble(Origin.z, World.HighZ[Index], World.LowZ[Index]);
+	}
+
+	GLM_FUNC_QUALIFIER dvec3 getOrigin(large_world const & World, std::size_t Index)
+	{
+		return dvec3(
+			static_cast<double>(World.HighX[Index]) + static_cast<double>(World.LowX[Index]),
+			static_cast<double>(World.HighY[Index]) + static_cast<double>(World.LowY[Index]),
+			static_cast<double>(World.HighZ[Index]) + static_cast<double>(World.LowZ[Index]));
+	}
+
+	GLM_FUNC_QUALIFIER void relativeOrigins(large_world const & World, dvec3 const & Eye, vec3 * Results)
+	{
+		detail::large_world_eye const SplitEye(Eye);
+		detail::compute_large_world<detail::compute_relative_origin> Func;
+		Func.World = &World;
+		Func.Eye = &SplitEye;
+		Func.Func.Results = Results;
+		detail::parallel_for(World.Locals.size(), detail::large_world_grain, Func);
+	}
+
+	GLM_FUNC_QUALIFIER void cameraRelative(large_world const & World, dvec3 const & Eye, mat4 const & View, mat4 * Results)
+	{
+		detail::large_world_eye const SplitEye(Eye);
+		detail::compute_large_world<detail::compute_camera_relative_matrix> Func;
+		Func.World = &World;
+		Func.Eye = &SplitEye;
+		Func.Func.Locals = World.Locals.empty() ? 0 : &World.Locals[0];
+		Func.Func.View = &View;
+		Func.Func.Results = Results;
+		detail::parallel_for(World.Locals.size(), detail::large_world_grain, Func);
+	}
+}//namespace glm
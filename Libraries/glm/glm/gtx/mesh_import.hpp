@@ -0,0 +1,99 @@
+/// @ref gtx_mesh_import
+/// @file glm/gtx/mesh_import.hpp
+///
+/// @see core (dependence)
+/// @see gtx_string_cast (dependence)
+///
+/// @defgroup gtx_mesh_import GLM_GTX_mesh_import
+/// @ingroup gtx
+///
+/// @brief Parallel import of Wavefront OBJ and PLY triangle meshes into one array per vertex attribute.
+///
+/// Files are memory mapped. Text is split at line boundaries into chunks of about a megabyte parsed by
+/// worker threads, then the chunks are merged in file order so that the result doesn't depend on the number
+/// of threads. The position, texture coordinate and normal indices of OBJ face corners are welded into
+/// vertices with a hash table partitioned between the threads. Binary PLY vertices are read straight
+/// from the mapped file into the arrays.
+///
+/// <glm/gtx/mesh_import.hpp> need to be included to use these functionalities.
+/// This extension is not supported with CUDA
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtx/string_cast.hpp"
+#include <cstddef>
+#include <vector>
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_mesh_import extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_mesh_import
+	/// @{
+
+	/// Triangle mesh with one array per vertex attribute.
+	/// @see gtx_mesh_import
+	template <typename T, precision P>
+	struct tmesh_soa
+	{
+		std::vector<tvec3<T, P> > Positions;
+
+		/// Empty when the file has no normals
+		std::vector<tvec3<T, P> > Normals;
+
+		/// Empty when the file has no texture coordinates
+		std::vector<tvec2<T, P> > TexCoords;
+
+		/// Three vertex indices per triangle, polygons being triangulated as fans
+		std::vector<uint> Indices;
+	};
+
+	typedef tmesh_soa<float, defaultp> mesh_soa;
+
+	/// Reads the v, vt, vn and f lines of the Wavefront OBJ text [First, Last), other lines are ignored.
+	/// Each distinct combination of position, texture coordinate and normal indices of the face corners becomes
+	/// a vertex, in order of first use. A text without faces keeps all its positions as a point cloud.
+	/// Corners without texture coordinate or normal get zeros when other corners have them.
+	/// Return false, with an unspecified mesh, if a face refers to a missing element.
+	/// @see gtx_mesh_import
+	template <typename T, precision P>
+	GLM_FUNC_DECL bool parseOBJ(
+		char const * First,
+		char const * Last,
+		tmesh_soa<T, P> & Mesh);
+
+	/// Reads the vertices and faces of an ascii, binary little endian or binary big endian PLY file in [First, Last).
+	/// Vertex properties x, y and z, nx, ny and nz, and u and v (or s and t, texture_u and texture_v) are read,
+	/// faces are read from their vertex_indices (or vertex_index) list. Other properties and elements are skipped.
+	/// Return false, with an unspecified mesh, if the file is truncated, invalid or if a face refers to a missing vertex.
+	/// @see gtx_mesh_import
+	template <typename T, precision P>
+	GLM_FUNC_DECL bool parsePLY(
+		char const * First,
+		char const * Last,
+		tmesh_soa<T, P> & Mesh);
+
+	/// Memory maps the OBJ file Path and reads it with parseOBJ.
+	/// Return false if the file can't be read.
+	/// @see gtx_mesh_import
+	template <typename T, precision P>
+	GLM_FUNC_DECL bool importOBJ(
+		char const * Path,
+		tmesh_soa<T, P> & Mesh);
+
+	/// Memory maps the PLY file Path and reads it with parsePLY.
+	/// Return false if the file can't be read.
+	/// @see gtx_mesh_import
+	template <typename T, precision P>
+	GLM_FUNC_DECL bool importPLY(
+		char const * Path,
+		tmesh_soa<T, P> & Mesh);
+
+	/// @}
+}//namespace glm
+
+#include "mesh_import.inl"
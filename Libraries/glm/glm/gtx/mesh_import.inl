@@ -0,0 +1,887 @@
+/// @ref gtx_mesh_import
+/// @file glm/gtx/mesh_import.inl
+
+#include "../detail/_from_chars.hpp"
+#include "../detail/_mapped_file.hpp"
+#include "../detail/_parallel.hpp"
+#include <algorithm>
+#include <limits>
+#include <cstring>
+
+namespace glm{
+namespace detail
+{
+	// Characters of text parsed by each chunk of the importers
+	static std::size_t const import_chunk_size = 1 << 20;
+
+	// Beginnings of chunks of about import_chunk_size characters of [First, Last) starting at lines, then Last
+	GLM_FUNC_QUALIFIER void import_split_lines(char const * First, char const * Last, std::vector<char const *> & Bounds)
+	{
+		Bounds.assign(1, First);
+		while(static_cast<std::size_t>(Last - First) > import_chunk_size)
+		{
+			char const * const Line = static_cast<char const *>(std::memchr(First + import_chunk_size, '\n', static_cast<std::size_t>(Last - First) - import_chunk_size));
+			if(!Line || Line + 1 == Last)
+				break;
+			First = Line + 1;
+			Bounds.push_back(First);
+		}
+		Bounds.push_back(Last);
+	}
+
+	GLM_FUNC_QUALIFIER char const * import_line_end(char const * First, char const * Last)
+	{
+		char const * const End = static_cast<char const *>(std::memchr(First, '\n', static_cast<std::size_t>(Last - First)));
+		return End ? End : Last;
+	}
+
+	// Next word of a line separated by white spaces, empty at the end of the line
+	GLM_FUNC_QUALIFIER char const * import_next_word(char const * & First, char const * Last)
+	{
+		char const * const Word = chars_skip_spaces(First, Last);
+		for(First = Word; First != Last && !chars_is_separator(*First); ++First){}
+		return Word;
+	}
+
+	GLM_FUNC_QUALIFIER bool import_is_word(char const * First, char const * Last, char const * Word)
+	{
+		std::size_t const Length = std::strlen(Word);
+		return static_cast<std::size_t>(Last - First) == Length && std::memcmp(First, Word, Length) == 0;
+	}
+
+	// Reads up to Count numbers separated by white spaces, the missing ones keeping their values
+	template <typename T>
+	GLM_FUNC_QUALIFIER void import_read_numbers(char const * First, char const * Last, T * Values, length_t Count)
+	{
+		for(length_t i = 0; i < Count && First; ++i)
+			First = compute_from_chars_scalar<T>::call(chars_skip_spaces(First, Last), Last, Values[i]);
+	}
+
+	// Corner of an OBJ face with its position, texture coordinate and normal indices, -1 when absent.
+	// Negative OBJ indices are relative to the elements read before the face: they count from the
+	// beginning of the chunk of the face, possibly negatively, and have their bit set in Relative.
+	struct import_obj_corner
+	{
+		int Index[3];
+		int Relative;
+	};
+
+	template <typename T, precision P>
+	struct import_obj_chunk
+	{
+		std::vector<tvec3<T, P> > Positions;
+		std::vector<tvec2<T, P> > TexCoords;
+		std::vector<tvec3<T, P> > Normals;
+
+		/// Three corners per triangle
+		std::vector<import_obj_corner> Corners;
+		bool Valid;
+	};
+
+	// Reads a corner "p", "p/t", "p//n" or "p/t/n", Counts being the numbers of elements read in the chunk
+	GLM_FUNC_QUALIFIER char const * import_obj_read_corner(char const * First, char const * Last, std::size_t const * Counts, import_obj_corner & Corner)
+	{
+		Corner.Index[0] = Corner.Index[1] = Corner.Index[2] = -1;
+		Corner.Relative = 0;
+		for(int k = 0; k < 3; ++k)
+		{
+			if(k > 0)
+			{
+				if(First == Last || *First != '/')
+					break;
+				if(++First != Last && *First == '/' && k == 1)
+					continue;
+			}
+
+			int Index = 0;
+			First = compute_from_chars_scalar<int>::call(First, Last, Index);
+			if(!First || Index == 0)
+				return 0;
+			Corner.Index[k] = Index > 0 ? Index - 1 : static_cast<int>(Counts[k]) + Index;
+			Corner.Relative |= Index < 0 ? 1 << k : 0;
+		}
+		return First == Last || chars_is_separator(*First) ? First : 0;
+	}
+
+	template <typename T, precision P>
+	struct compute_import_obj
+	{
+		std::vector<char const *> const * Bounds;
+		import_obj_chunk<T, P> * Chunks;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			for(std::size_t i = Begin; i < End; ++i)
+				parse((*Bounds)[i], (*Bounds)[i + 1], Chunks[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void parse(char const * First, char const * Last, import_obj_chunk<T, P> & Chunk)
+		{
+			Chunk.Valid = true;
+			while(First != Last)
+			{
+				char const * const End = import_line_end(First, Last);
+				char const * Text = First;
+				char const * const Key = import_next_word(Text, End);
+				std::ptrdiff_t const Length = Text - Key;
+				First = End == Last ? Last : End + 1;
+
+				if(Length == 1 && Key[0] == 'v')
+				{
+					T Values[3] = {static_cast<T>(0), static_cast<T>(0), static_cast<T>(0)};
+					import_read_numbers(Text, End, Values, 3);
+					Chunk.Positions.push_back(tvec3<T, P>(Values[0], Values[1], Values[2]));
+				}
+				else if(Length == 2 && Key[0] == 'v' && Key[1] == 't')
+				{
+					T Values[2] = {static_cast<T>(0), static_cast<T>(0)};
+					import_read_numbers(Text, End, Values, 2);
+					Chunk.TexCoords.push_back(tvec2<T, P>(Values[0], Values[1]));
+				}
+				else if(Length == 2 && Key[0] == 'v' && Key[1] == 'n')
+				{
+					T Values[3] = {static_cast<T>(0), static_cast<T>(0), static_cast<T>(0)};
+					import_read_numbers(Text, End, Values, 3);
+					Chunk.Normals.push_back(tvec3<T, P>(Values[0], Values[1], Values[2]));
+				}
+				else if(Length == 1 && Key[0] == 'f')
+				{
+					std::size_t const Counts[3] = {Chunk.Positions.size(), Chunk.TexCoords.size(), Chunk.Normals.size()};
+					import_obj_corner Corner;
+					import_obj_corner FirstCorner;
+					import_obj_corner PreviousCorner;
+					std::size_t CornerCount = 0;
+					for(Text = chars_skip_spaces(Text, End); Text != End; Text = chars_skip_spaces(Text, End), ++CornerCount)
+					{
+						Text = import_obj_read_corner(Text, End, Counts, Corner);
+						if(!Text)
+						{
+							Chunk.Valid = false;
+							return;
+						}
+
+						// Polygons are triangulated as fans
+						if(CornerCount == 0)
+							FirstCorner = Corner;
+						else if(CornerCount >= 2)
+						{
+							Chunk.Corners.push_back(FirstCorner);
+							Chunk.Corners.push_back(PreviousCorner);
+							Chunk.Corners.push_back(Corner);
+						}
+						PreviousCorner = Corner;
+					}
+				}
+			}
+		}
+	};
+
+	// Concatenates the elements of the chunks and makes the corner indices absolute
+	template <typename T, precision P>
+	struct compute_import_obj_merge
+	{
+		import_obj_chunk<T, P> * Chunks;
+		std::size_t const * Offsets;
+		std::size_t const * Totals;
+		tvec3<T, P> * Positions;
+		tvec2<T, P> * TexCoords;
+		tvec3<T, P> * Normals;
+		import_obj_corner * Corners;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			for(std::size_t i = Begin; i < End; ++i)
+			{
+				import_obj_chunk<T, P> & Chunk = Chunks[i];
+				std::size_t const * Offset = Offsets + i * 4;
+				std::copy(Chunk.Positions.begin(), Chunk.Positions.end(), Positions + Offset[0]);
+				std::copy(Chunk.TexCoords.begin(), Chunk.TexCoords.end(), TexCoords + Offset[1]);
+				std::copy(Chunk.Normals.begin(), Chunk.Normals.end(), Normals + Offset[2]);
+
+				for(std::size_t j = 0; j < Chunk.Corners.size(); ++j)
+				{
+					import_obj_corner Corner = Chunk.Corners[j];
+					for(int k = 0; k < 3; ++k)
+					{
+						if(Corner.Relative & (1 << k))
+							Corner.Index[k] += static_cast<int>(Offset[k]);
+						else if(Corner.Index[k] < 0 && k > 0)
+							continue;
+						if(Corner.Index[k] < 0 || static_cast<std::size_t>(Corner.Index[k]) >= Totals[k])
+							Chunk.Valid = false;
+					}
+					Corner.Relative = 0;
+					Corners[Offset[3] + j] = Corner;
+				}
+
+				std::vector<tvec3<T, P> >().swap(Chunk.Positions);
+				std::vector<tvec2<T, P> >().swap(Chunk.TexCoords);
+				std::vector<tvec3<T, P> >().swap(Chunk.Normals);
+				std::vector<import_obj_corner>().swap(Chunk.Corners);
+			}
+		}
+	};
+
+	GLM_FUNC_QUALIFIER uint32 import_corner_hash(import_obj_corner const & Corner)
+	{
+		uint32 x = static_cast<uint32>(Corner.Index[0]) * 0x9E3779B1u ^ static_cast<uint32>(Corner.Index[1]) * 0x85EBCA77u ^ static_cast<uint32>(Corner.Index[2]) * 0xC2B2AE3Du;
+		x ^= x >> 16;
+		x *= 0x7feb352du;
+		x ^= x >> 15;
+		x *= 0x846ca68bu;
+		x ^= x >> 16;
+		return x;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t import_corner_partition(uint32 Hash, std::size_t Partitions)
+	{
+		return static_cast<std::size_t>((static_cast<uint64>(Hash) * Partitions) >> 32);
+	}
+
+	// Finds the first corner with the same indices as each corner. Each job owns the corners of a partition of
+	// the hash values: it scans all the corners and only inserts its own ones in an open addressing table.
+	struct compute_import_weld
+	{
+		import_obj_corner const * Corners;
+		std::size_t Count;
+		std::size_t Partitions;
+		uint * Firsts;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			for(std::size_t Partition = Begin; Partition < End; ++Partition)
+			{
+				std::size_t Owned = 0;
+				for(std::size_t i = 0; i < Count; ++i)
+					Owned += import_corner_partition(import_corner_hash(Corners[i]), Partitions) == Partition ? 1 : 0;
+
+				std::size_t Capacity = 16;
+				while(Capacity < Owned * 2)
+					Capacity <<= 1;
+				std::size_t const Mask = Capacity - 1;
+				std::vector<uint> Table(Capacity, ~static_cast<uint>(0));
+
+				for(std::size_t i = 0; i < Count; ++i)
+				{
+					import_obj_corner const & Corner = Corners[i];
+					uint32 const Hash = import_corner_hash(Corner);
+					if(import_corner_partition(Hash, Partitions) != Partition)
+						continue;
+
+					std::size_t Slot = Hash & Mask;
+					for(; Table[Slot] != ~static_cast<uint>(0); Slot = (Slot + 1) & Mask)
+					{
+						import_obj_corner const & Other = Corners[Table[Slot]];
+						if(Other.Index[0] == Corner.Index[0] && Other.Index[1] == Corner.Index[1] && Other.Index[2] == Corner.Index[2])
+							break;
+					}
+					if(Table[Slot] == ~static_cast<uint>(0))
+						Table[Slot] = static_cast<uint>(i);
+					Firsts[i] = Table[Slot];
+				}
+			}
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_import_obj_gather
+	{
+		import_obj_corner const * Corners;
+		uint const * Sources;
+		tvec3<T, P> const * Positions;
+		tvec2<T, P> const * TexCoords;
+		tvec3<T, P> const * Normals;
+		tmesh_soa<T, P> * Mesh;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			for(std::size_t i = Begin; i < End; ++i)
+			{
+				import_obj_corner const & Corner = Corners[Sources[i]];
+				Mesh->Positions[i] = Positions[Corner.Index[0]];
+				if(!Mesh->TexCoords.empty())
+					Mesh->TexCoords[i] = Corner.Index[1] >= 0 ? TexCoords[Corner.Index[1]] : tvec2<T, P>(static_cast<T>(0));
+				if(!Mesh->Normals.empty())
+					Mesh->Normals[i] = Corner.Index[2] >= 0 ? Normals[Corner.Index[2]] : tvec3<T, P>(static_cast<T>(0));
+			}
+		}
+	};
+
+	enum import_ply_format
+	{
+		ply_ascii,
+		ply_binary_little_endian,
+		ply_binary_big_endian
+	};
+
+	// Property of a PLY element
+	struct import_ply_property
+	{
+		// Index in int8, uint8, int16, uint16, int32, uint32, float32 and float64
+		int Type;
+
+		// Type of the count of a list, -1 for a scalar property
+		int CountType;
+
+		// 0 to 7 for the vertex properties x, y, z, nx, ny, nz, u and v, 8 for the vertex indices of a face, -1 for the other properties
+		int Attribute;
+	};
+
+	struct import_ply_element
+	{
+		std::size_t Count;
+		bool Vertex;
+		bool Face;
+		std::vector<import_ply_property> Properties;
+	};
+
+	GLM_FUNC_QUALIFIER int import_ply_type(char const * First, char const * Last)
+	{
+		static char const * const Names[] =
+		{
+			"char", "uchar", "short", "ushort", "int", "uint", "float", "double",
+			"int8", "uint8", "int16", "uint16", "int32", "uint32", "float32", "float64"
+		};
+		for(int i = 0; i < 16; ++i)
+		{
+			if(import_is_word(First, Last, Names[i]))
+				return i % 8;
+		}
+		return -1;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t import_ply_size(int Type)
+	{
+		static std::size_t const Sizes[] = {1, 1, 2, 2, 4, 4, 4, 8};
+		return Sizes[Type];
+	}
+
+	// Whether Size bytes of data may hold the elements declared by the header, checked before allocating from their counts.
+	// An ascii property takes at least a digit and a separator, the last separator of the file being optional, a binary
+	// property its size and a binary list its count. Every element takes at least a byte.
+	GLM_FUNC_QUALIFIER bool import_ply_fits(std::vector<import_ply_element> const & Elements, bool Ascii, std::size_t Size)
+	{
+		std::size_t Remaining = Ascii && Size < std::numeric_limits<std::size_t>::max() ? Size + 1 : Size;
+		for(std::size_t i = 0; i < Elements.size(); ++i)
+		{
+			std::size_t Minimum = 0;
+			for(std::size_t j = 0; j < Elements[i].Properties.size(); ++j)
+			{
+				import_ply_property const & Property = Elements[i].Properties[j];
+				Minimum += Ascii ? 2 : import_ply_size(Property.CountType >= 0 ? Property.CountType : Property.Type);
+			}
+			Minimum = Minimum > 0 ? Minimum : 1;
+			if(Elements[i].Count > Remaining / Minimum)
+				return false;
+			Remaining -= Elements[i].Count * Minimum;
+		}
+		return true;
+	}
+
+	GLM_FUNC_QUALIFIER int import_ply_attribute(char const * First, char const * Last, bool Vertex, bool Face)
+	{
+		static char const * const Names[] =
+		{
+			"x", "y", "z", "nx", "ny", "nz", "u", "v",
+			"s", "t", "texture_u", "texture_v", "texture_s", "texture_t"
+		};
+		static int const Attributes[] = {0, 1, 2, 3, 4, 5, 6, 7, 6, 7, 6, 7, 6, 7};
+		if(Face)
+			return import_is_word(First, Last, "vertex_indices") || import_is_word(First, Last, "vertex_index") ? 8 : -1;
+		for(int i = 0; Vertex && i < 14; ++i)
+		{
+			if(import_is_word(First, Last, Names[i]))
+				return Attributes[i];
+		}
+		return -1;
+	}
+
+	// Reads the header of a PLY file, return the beginning of the data or null if the header is invalid
+	GLM_FUNC_QUALIFIER char const * import_ply_header(char const * First, char const * Last, import_ply_format & Format, std::vector<import_ply_element> & Elements)
+	{
+		bool HasFormat = false;
+		for(std::size_t LineIndex = 0; First != Last; ++LineIndex)
+		{
+			char const * const End = import_line_end(First, Last);
+			char const * Text = First;
+			First = End == Last ? Last : End + 1;
+
+			char const * Word = import_next_word(Text, End);
+			char const * WordEnd = Text;
+			if(LineIndex == 0)
+			{
+				if(!import_is_word(Word, WordEnd, "ply"))
+					return 0;
+			}
+			else if(import_is_word(Word, WordEnd, "format"))
+			{
+				Word = import_next_word(Text, End);
+				if(import_is_word(Word, Text, "ascii"))
+					Format = ply_ascii;
+				else if(import_is_word(Word, Text, "binary_little_endian"))
+					Format = ply_binary_little_endian;
+				else if(import_is_word(Word, Text, "binary_big_endian"))
+					Format = ply_binary_big_endian;
+				else
+					return 0;
+				HasFormat = true;
+			}
+			else if(import_is_word(Word, WordEnd, "element"))
+			{
+				import_ply_element Element;
+				char const * const Name = import_next_word(Text, End);
+				Element.Vertex = import_is_word(Name, Text, "vertex");
+				Element.Face = import_is_word(Name, Text, "face");
+				Word = import_next_word(Text, End);
+				if(compute_from_chars_scalar<std::size_t>::call(Word, Text, Element.Count) != Text)
+					return 0;
+				Elements.push_back(Element);
+			}
+			else if(import_is_word(Word, WordEnd, "property"))
+			{
+				if(Elements.empty())
+					return 0;
+				import_ply_element & Element = Elements.back();
+				import_ply_property Property = {-1, -1, -1};
+
+				Word = import_next_word(Text, End);
+				if(import_is_word(Word, Text, "list"))
+				{
+					Word = import_next_word(Text, End);
+					Property.CountType = import_ply_type(Word, Text);
+					if(Property.CountType < 0 || Property.CountType >= 6)
+						return 0;
+					Word = import_next_word(Text, End);
+				}
+				Property.Type = import_ply_type(Word, Text);
+				if(Property.Type < 0)
+					return 0;
+
+				Word = import_next_word(Text, End);
+				Property.Attribute = import_ply_attribute(Word, Text, Element.Vertex && Property.CountType < 0, Element.Face && Property.CountType >= 0);
+				if(Property.Attribute == 8 && Property.Type >= 6)
+					return 0;
+				Element.Properties.push_back(Property);
+			}
+			else if(import_is_word(Word, WordEnd, "end_header"))
+				return HasFormat ? First : 0;
+		}
+		return 0;
+	}
+
+	// Value of type Type of a binary file, its bytes reversed when Swap is true
+	template <typename T>
+	GLM_FUNC_QUALIFIER T import_ply_binary(char const * Data, int Type, bool Swap)
+	{
+		char Bytes[8];
+		std::size_t const Size = import_ply_size(Type);
+		for(std::size_t i = 0; i < Size; ++i)
+			Bytes[i] = Data[Swap ? Size - 1 - i : i];
+
+		switch(Type)
+		{
+		case 0: { int8 Value; std::memcpy(&Value, Bytes, sizeof(Value)); return static_cast<T>(Value); }
+		case 1: { uint8 Value; std::memcpy(&Value, Bytes, sizeof(Value)); return static_cast<T>(Value); }
+		case 2: { int16 Value; std::memcpy(&Value, Bytes, sizeof(Value)); return static_cast<T>(Value); }
+		case 3: { uint16 Value; std::memcpy(&Value, Bytes, sizeof(Value)); return static_cast<T>(Value); }
+		case 4: { int32 Value; std::memcpy(&Value, Bytes, sizeof(Value)); return static_cast<T>(Value); }
+		case 5: { uint32 Value; std::memcpy(&Value, Bytes, sizeof(Value)); return static_cast<T>(Value); }
+		case 6: { float Value; std::memcpy(&Value, Bytes, sizeof(Value)); return static_cast<T>(Value); }
+		default: { double Value; std::memcpy(&Value, Bytes, sizeof(Value)); return static_cast<T>(Value); }
+		}
+	}
+
+	GLM_FUNC_QUALIFIER bool import_big_endian()
+	{
+		uint16 const Value = 1;
+		unsigned char Bytes[2];
+		std::memcpy(Bytes, &Value, sizeof(Bytes));
+		return Bytes[0] == 0;
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void import_ply_store(tmesh_soa<T, P> & Mesh, std::size_t Vertex, T const * Values)
+	{
+		Mesh.Positions[Vertex] = tvec3<T, P>(Values[0], Values[1], Values[2]);
+		if(!Mesh.Normals.empty())
+			Mesh.Normals[Vertex] = tvec3<T, P>(Values[3], Values[4], Values[5]);
+		if(!Mesh.TexCoords.empty())
+			Mesh.TexCoords[Vertex] = tvec2<T, P>(Values[6], Values[7]);
+	}
+
+	// Appends the fan triangulation of a polygon, return false if it refers to a missing vertex
+	GLM_FUNC_QUALIFIER bool import_ply_polygon(std::vector<uint> & Indices, uint const * Polygon, std::size_t Count, std::size_t VertexCount)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			if(Polygon[i] >= VertexCount)
+				return false;
+		}
+		for(std::size_t i = 2; i < Count; ++i)
+		{
+			Indices.push_back(Polygon[0]);
+			Indices.push_back(Polygon[i - 1]);
+			Indices.push_back(Polygon[i]);
+		}
+		return true;
+	}
+
+	// Vertices of fixed size of a binary file, read straight from the file into the mesh
+	template <typename T, precision P>
+	struct compute_import_ply_vertices
+	{
+		char const * Data;
+		std::size_t Stride;
+		import_ply_element const * Element;
+		std::size_t const * Offsets;
+		bool Swap;
+		tmesh_soa<T, P> * Mesh;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			std::vector<import_ply_property> const & Properties = Element->Properties;
+			for(std::size_t i = Begin; i < End; ++i)
+			{
+				char const * const Vertex = Data + i * Stride;
+				T Values[8] = {static_cast<T>(0)};
+				for(std::size_t j = 0; j < Properties.size(); ++j)
+				{
+					if(Properties[j].Attribute >= 0)
+						Values[Properties[j].Attribute] = import_ply_binary<T>(Vertex + Offsets[j], Properties[j].Type, Swap);
+				}
+				import_ply_store(*Mesh, i, Values);
+			}
+		}
+	};
+
+	// Reads an element of a binary file sequentially, return the end of the element or null if it is truncated or invalid
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER char const * import_ply_binary_element(char const * First, char const * Last, import_ply_element const & Element, bool Swap, std::size_t VertexCount, tmesh_soa<T, P> & Mesh)
+	{
+		std::vector<uint> Polygon;
+		for(std::size_t i = 0; i < Element.Count; ++i)
+		{
+			T Values[8] = {static_cast<T>(0)};
+			for(std::size_t j = 0; j < Element.Properties.size(); ++j)
+			{
+				import_ply_property const & Property = Element.Properties[j];
+				std::size_t const Size = import_ply_size(Property.Type);
+				if(Property.CountType < 0)
+				{
+					if(static_cast<std::size_t>(Last - First) < Size)
+						return 0;
+					if(Element.Vertex && Property.Attribute >= 0)
+						Values[Property.Attribute] = import_ply_binary<T>(First, Property.Type, Swap);
+					First += Size;
+					continue;
+				}
+
+				std::size_t const CountSize = import_ply_size(Property.CountType);
+				if(static_cast<std::size_t>(Last - First) < CountSize)
+					return 0;
+				uint64 const Count = import_ply_binary<uint64>(First, Property.CountType, Swap);
+				First += CountSize;
+				if(Count > static_cast<uint64>(Last - First) / Size)
+					return 0;
+
+				if(Property.Attribute == 8)
+				{
+					Polygon.resize(static_cast<std::size_t>(Count));
+					for(std::size_t k = 0; k < Polygon.size(); ++k)
+					{
+						int64 const Index = import_ply_binary<int64>(First + k * Size, Property.Type, Swap);
+						Polygon[k] = Index >= 0 && static_cast<uint64>(Index) < VertexCount ? static_cast<uint>(Index) : static_cast<uint>(VertexCount);
+					}
+					if(!import_ply_polygon(Mesh.Indices, Polygon.empty() ? 0 : &Polygon[0], Polygon.size(), VertexCount))
+						return 0;
+				}
+				First += static_cast<std::size_t>(Count) * Size;
+			}
+			if(Element.Vertex)
+				import_ply_store(Mesh, i, Values);
+		}
+		return First;
+	}
+
+	// Counts the lines of each chunk of an ascii file
+	struct compute_import_count_lines
+	{
+		std::vector<char const *> const * Bounds;
+		std::size_t * Counts;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			for(std::size_t i = Begin; i < End; ++i)
+				Counts[i] = static_cast<std::size_t>(std::count((*Bounds)[i], (*Bounds)[i + 1], '\n'));
+		}
+	};
+
+	// Reads the lines of each chunk of an ascii file, one line per vertex, face or other element
+	template <typename T, precision P>
+	struct compute_import_ply_ascii
+	{
+		std::vector<char const *> const * Bounds;
+		std::size_t const * FirstLines;
+		std::vector<import_ply_element> const * Elements;
+		std::size_t const * ElementLines;
+		std::size_t VertexCount;
+		tmesh_soa<T, P> * Mesh;
+		std::vector<uint> * Indices;
+		char * Valid;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			for(std::size_t i = Begin; i < End; ++i)
+				Valid[i] = parse((*Bounds)[i], (*Bounds)[i + 1], FirstLines[i], Indices[i]);
+		}
+
+		GLM_FUNC_QUALIFIER bool parse(char const * First, char const * Last, std::size_t Line, std::vector<uint> & ChunkIndices) const
+		{
+			std::vector<uint> Polygon;
+			std::size_t Element = 0;
+			for(; First != Last; ++Line)
+			{
+				char const * const End = import_line_end(First, Last);
+				char const * Text = First;
+				First = End == Last ? Last : End + 1;
+
+				for(; Element < Elements->size() && Line >= ElementLines[Element + 1]; ++Element){}
+				if(Element == Elements->size())
+					break;
+
+				import_ply_element const & Current = (*Elements)[Element];
+				T Values[8] = {static_cast<T>(0)};
+				for(std::size_t j = 0; j < Current.Properties.size(); ++j)
+				{
+					import_ply_property const & Property = Current.Properties[j];
+					if(Property.CountType < 0)
+					{
+						T Value = static_cast<T>(0);
+						Text = compute_from_chars_scalar<T>::call(chars_skip_spaces(Text, End), End, Value);
+						if(!Text)
+							return false;
+						if(Current.Vertex && Property.Attribute >= 0)
+							Values[Property.Attribute] = Value;
+						continue;
+					}
+
+					std::size_t Count = 0;
+					Text = compute_from_chars_scalar<std::size_t>::call(chars_skip_spaces(Text, End), End, Count);
+					if(!Text || Count > static_cast<std::size_t>(End - Text))
+						return false;
+					Polygon.resize(Count);
+					for(std::size_t k = 0; k < Count; ++k)
+					{
+						T Value = static_cast<T>(0);
+						Text = Property.Attribute == 8 ?
+							compute_from_chars_scalar<uint>::call(chars_skip_spaces(Text, End), End, Polygon[k]) :
+							compute_from_chars_scalar<T>::call(chars_skip_spaces(Text, End), End, Value);
+						if(!Text)
+							return false;
+					}
+					if(Property.Attribute == 8 && !import_ply_polygon(ChunkIndices, Polygon.empty() ? 0 : &Polygon[0], Count, VertexCount))
+						return false;
+				}
+				if(Current.Vertex)
+					import_ply_store(*Mesh, Line - ElementLines[Element], Values);
+			}
+			return true;
+		}
+	};
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER bool parseOBJ(char const * First, char const * Last, tmesh_soa<T, P> & Mesh)
+	{
+		std::vector<char const *> Bounds;
+		detail::import_split_lines(First, Last, Bounds);
+		std::size_t const ChunkCount = Bounds.size() - 1;
+
+		std::vector<detail::import_obj_chunk<T, P> > Chunks(ChunkCount);
+		detail::compute_import_obj<T, P> Parse = {&Bounds, &Chunks[0]};
+		detail::parallel_for(ChunkCount, 1, Parse);
+
+		// Offsets of the positions, texture coordinates, normals and corners of each chunk
+		std::vector<std::size_t> Offsets(ChunkCount * 4 + 4, 0);
+		for(std::size_t i = 0; i < ChunkCount; ++i)
+		{
+			if(!Chunks[i].Valid)
+				return false;
+			Offsets[i * 4 + 4] = Offsets[i * 4 + 0] + Chunks[i].Positions.size();
+			Offsets[i * 4 + 5] = Offsets[i * 4 + 1] + Chunks[i].TexCoords.size();
+			Offsets[i * 4 + 6] = Offsets[i * 4 + 2] + Chunks[i].Normals.size();
+			Offsets[i * 4 + 7] = Offsets[i * 4 + 3] + Chunks[i].Corners.size();
+		}
+		std::size_t const * Totals = &Offsets[ChunkCount * 4];
+
+		std::vector<tvec3<T, P> > Positions(Totals[0]);
+		std::vector<tvec2<T, P> > TexCoords(Totals[1]);
+		std::vector<tvec3<T, P> > Normals(Totals[2]);
+		std::vector<detail::import_obj_corner> Corners(Totals[3]);
+		detail::compute_import_obj_merge<T, P> Merge = {
+			&Chunks[0], &Offsets[0], Totals,
+			Positions.empty() ? 0 : &Positions[0], TexCoords.empty() ? 0 : &TexCoords[0], Normals.empty() ? 0 : &Normals[0],
+			Corners.empty() ? 0 : &Corners[0]};
+		detail::parallel_for(ChunkCount, 1, Merge);
+		for(std::size_t i = 0; i < ChunkCount; ++i)
+		{
+			if(!Chunks[i].Valid)
+				return false;
+		}
+
+		// Point clouds
+		Mesh.Indices.clear();
+		if(Corners.empty())
+		{
+			Mesh.Positions.swap(Positions);
+			Mesh.TexCoords.clear();
+			Mesh.Normals.clear();
+			return true;
+		}
+
+		std::vector<uint> Firsts(Corners.size());
+		std::size_t const Partitions = detail::parallel_jobs(Corners.size(), 1 << 16);
+		detail::compute_import_weld Weld = {&Corners[0], Corners.size(), Partitions, &Firsts[0]};
+		detail::parallel_for(Partitions, 1, Weld);
+
+		// Vertices in order of first use
+		std::vector<uint> Sources;
+		Mesh.Indices.resize(Corners.size());
+		for(std::size_t i = 0; i < Corners.size(); ++i)
+		{
+			if(Firsts[i] == i)
+			{
+				Mesh.Indices[i] = static_cast<uint>(Sources.size());
+				Sources.push_back(static_cast<uint>(i));
+			}
+			else
+				Mesh.Indices[i] = Mesh.Indices[Firsts[i]];
+		}
+
+		Mesh.Positions.resize(Sources.size());
+		Mesh.TexCoords.resize(TexCoords.empty() ? 0 : Sources.size());
+		Mesh.Normals.resize(Normals.empty() ? 0 : Sources.size());
+		detail::compute_import_obj_gather<T, P> Gather = {
+			&Corners[0], &Sources[0], &Positions[0], TexCoords.empty() ? 0 : &TexCoords[0], Normals.empty() ? 0 : &Normals[0], &Mesh};
+		detail::parallel_for(Sources.size(), 1 << 14, Gather);
+
+		return true;
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER bool parsePLY(char const * First, char const * Last, tmesh_soa<T, P> & Mesh)
+	{
+		detail::import_ply_format Format = detail::ply_ascii;
+		std::vector<detail::import_ply_element> Elements;
+		First = detail::import_ply_header(First, Last, Format, Elements);
+		if(!First)
+			return false;
+
+		// Attributes of the vertex element
+		std::size_t VertexCount = 0;
+		int Attributes = 0;
+		for(std::size_t i = 0; i < Elements.size(); ++i)
+		{
+			if(!Elements[i].Vertex)
+				continue;
+			VertexCount = Elements[i].Count;
+			for(std::size_t j = 0; j < Elements[i].Properties.size(); ++j)
+				Attributes |= Elements[i].Properties[j].Attribute >= 0 ? 1 << Elements[i].Properties[j].Attribute : 0;
+		}
+		if(VertexCount >= static_cast<std::size_t>(~static_cast<uint>(0)))
+			return false;
+		if(!detail::import_ply_fits(Elements, Format == detail::ply_ascii, static_cast<std::size_t>(Last - First)))
+			return false;
+
+		Mesh.Positions.assign(VertexCount, tvec3<T, P>(static_cast<T>(0)));
+		Mesh.Normals.assign((Attributes & 0x38) == 0x38 ? VertexCount : 0, tvec3<T, P>(static_cast<T>(0)));
+		Mesh.TexCoords.assign((Attributes & 0xC0) == 0xC0 ? VertexCount : 0, tvec2<T, P>(static_cast<T>(0)));
+		Mesh.Indices.clear();
+
+		if(Format == detail::ply_ascii)
+		{
+			std::vector<std::size_t> ElementLines(Elements.size() + 1, 0);
+			for(std::size_t i = 0; i < Elements.size(); ++i)
+				ElementLines[i + 1] = ElementLines[i] + Elements[i].Count;
+
+			std::vector<char const *> Bounds;
+			detail::import_split_lines(First, Last, Bounds);
+			std::size_t const ChunkCount = Bounds.size() - 1;
+
+			std::vector<std::size_t> FirstLines(ChunkCount + 1, 0);
+			detail::compute_import_count_lines Count = {&Bounds, &FirstLines[1]};
+			detail::parallel_for(ChunkCount, 1, Count);
+			for(std::size_t i = 0; i < ChunkCount; ++i)
+				FirstLines[i + 1] += FirstLines[i];
+
+			// The data must hold a line per element
+			std::size_t const Lines = FirstLines[ChunkCount] + (First != Last && Last[-1] != '\n' ? 1 : 0);
+			if(Lines < ElementLines[Elements.size()])
+				return false;
+
+			std::vector<std::vector<uint> > Indices(ChunkCount);
+			std::vector<char> Valid(ChunkCount, 0);
+			detail::compute_import_ply_ascii<T, P> Parse = {
+				&Bounds, &FirstLines[0], &Elements, &ElementLines[0], VertexCount, &Mesh, &Indices[0], &Valid[0]};
+			detail::parallel_for(ChunkCount, 1, Parse);
+
+			for(std::size_t i = 0; i < ChunkCount; ++i)
+			{
+				if(!Valid[i])
+					return false;
+				Mesh.Indices.insert(Mesh.Indices.end(), Indices[i].begin(), Indices[i].end());
+			}
+			return true;
+		}
+
+		bool const Swap = (Format == detail::ply_binary_big_endian) != detail::import_big_endian();
+		for(std::size_t i = 0; i < Elements.size(); ++i)
+		{
+			detail::import_ply_element const & Element = Elements[i];
+
+			// Elements of fixed size are read in parallel, or skipped
+			std::vector<std::size_t> Offsets(Element.Properties.size(), 0);
+			std::size_t Stride = 0;
+			bool Fixed = true;
+			for(std::size_t j = 0; j < Element.Properties.size(); ++j)
+			{
+				Offsets[j] = Stride;
+				Stride += detail::import_ply_size(Element.Properties[j].Type);
+				Fixed = Fixed && Element.Properties[j].CountType < 0;
+			}
+
+			if(Fixed)
+			{
+				if(Stride > 0 && Element.Count > static_cast<std::size_t>(Last - First) / Stride)
+					return false;
+				if(Element.Vertex && Stride > 0)
+				{
+					detail::compute_import_ply_vertices<T, P> Read = {First, Stride, &Element, &Offsets[0], Swap, &Mesh};
+					detail::parallel_for(Element.Count, 1 << 14, Read);
+				}
+				First += Element.Count * Stride;
+			}
+			else
+			{
+				First = detail::import_ply_binary_element(First, Last, Element, Swap, VertexCount, Mesh);
+				if(!First)
+					return false;
+			}
+		}
+		return true;
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER bool importOBJ(char const * Path, tmesh_soa<T, P> & Mesh)
+	{
+		detail::mapped_file const File(Path);
+		return File.data() && parseOBJ(File.data(), File.data() + File.size(), Mesh);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER bool importPLY(char const * Path, tmesh_soa<T, P> & Mesh)
+	{
+		detail::mapped_file const File(Path);
+		return File.data() && parsePLY(File.data(), File.data() + File.size(), Mesh);
+	}
+}//namespace glm
@@ -0,0 +1,86 @@
+/// @ref gtx_mesh_normal
+/// @file glm/gtx/mesh_normal.hpp
+///
+/// @see core (dependence)
+/// @see gtx_normal (dependence)
+///
+/// @defgroup gtx_mesh_normal GLM_GTX_mesh_normal
+/// @ingroup gtx
+///
+/// @brief Smooth per vertex normals and tangent frames of indexed triangle meshes.
+///
+/// Vertices are partitioned between worker threads: each thread scans the index buffer and only
+/// accumulates the corners of the vertices it owns, so no atomic operation is required and the
+/// result doesn't depend on the number of threads.
+///
+/// <glm/gtx/mesh_normal.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtx/normal.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_mesh_normal extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_mesh_normal
+	/// @{
+
+	/// Weighting of the triangle normals accumulated at each vertex.
+	enum normal_weight
+	{
+		area_weight,	///< Weight by the triangle area
+		angle_weight	///< Weight by the triangle angle at the vertex
+	};
+
+	/// Builds a remapping of each vertex to the first vertex with an identical position.
+	/// Vertices split along UV seams can be remapped to share their normals and tangents.
+	/// @see gtx_mesh_normal
+	template <typename T, precision P>
+	GLM_FUNC_DECL void weldPositions(
+		tvec3<T, P> const * Positions,
+		std::size_t VertexCount,
+		uint * Remap);
+
+	/// Computes smooth per vertex normals of a triangle list.
+	/// Remap may be null, otherwise vertices with the same remapped index get the same normal,
+	/// the remapped index being the index of one of these vertices (Remap[Remap[i]] == Remap[i]).
+	/// Vertices not referenced by any triangle get a null normal.
+	/// @see gtx_mesh_normal
+	template <typename T, precision P>
+	GLM_FUNC_DECL void vertexNormals(
+		tvec3<T, P> const * Positions,
+		std::size_t VertexCount,
+		uint const * Indices,
+		std::size_t TriangleCount,
+		uint const * Remap,
+		normal_weight Weight,
+		tvec3<T, P> * Normals);
+
+	/// Computes per vertex tangent frames following the MikkTSpace conventions: triangle tangents
+	/// are projected on the tangent plane of the vertex normal and weighted by the corner angle.
+	/// xyz is the tangent Gram-Schmidt orthonormalized against the normal, w the bitangent sign:
+	/// bitangent = w * cross(normal, tangent).
+	/// Contributions of mirrored triangles are accumulated apart and the vertex keeps the handedness
+	/// with the largest contribution. Vertices without a valid UV mapping get an arbitrary tangent.
+	/// Normals are expected to be normalized.
+	/// @see gtx_mesh_normal
+	template <typename T, precision P>
+	GLM_FUNC_DECL void vertexTangents(
+		tvec3<T, P> const * Positions,
+		tvec3<T, P> const * Normals,
+		tvec2<T, P> const * TexCoords,
+		std::size_t VertexCount,
+		uint const * Indices,
+		std::size_t TriangleCount,
+		tvec4<T, P> * Tangents);
+
+	/// @}
+}//namespace glm
+
+#include "mesh_normal.inl"
@@ -0,0 +1,359 @@
+/// @ref gtx_mesh_normal
+/// @file glm/gtx/mesh_normal.inl
+
+#include "../detail/_parallel.hpp"
+#include <cstring>
+#include <vector>
+
+namespace glm{
+namespace detail
+{
+	// Normalizes four vectors stored as a structure of arrays, null vectors are left null.
+	template <typename T>
+	struct compute_normalize_soa4
+	{
+		GLM_FUNC_QUALIFIER static void call(T * x, T * y, T * z)
+		{
+			for(length_t i = 0; i < 4; ++i)
+			{
+				T const Length = sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+				T const Scale = Length > T(0) ? T(1) / Length : T(0);
+				x[i] *= Scale;
+				y[i] *= Scale;
+				z[i] *= Scale;
+			}
+		}
+	};
+
+	// Gram-Schmidt orthonormalization of four vectors t against four unit vectors n, stored as structures of arrays.
+	template <typename T>
+	struct compute_gram_schmidt_soa4
+	{
+		GLM_FUNC_QUALIFIER static void call(T const * nx, T const * ny, T const * nz, T * x, T * y, T * z)
+		{
+			for(length_t i = 0; i < 4; ++i)
+			{
+				T const Dot = nx[i] * x[i] + ny[i] * y[i] + nz[i] * z[i];
+				x[i] -= nx[i] * Dot;
+				y[i] -= ny[i] * Dot;
+				z[i] -= nz[i] * Dot;
+			}
+			compute_normalize_soa4<T>::call(x, y, z);
+		}
+	};
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER T corner_angle(tvec3<T, P> const & e1, tvec3<T, P> const & e2, T CrossLength)
+	{
+		return atan(CrossLength, dot(e1, e2));
+	}
+
+	template <typename T, precision P>
+	struct compute_vertex_normals
+	{
+		tvec3<T, P> const * Positions;
+		uint const * Indices;
+		std::size_t TriangleCount;
+		uint const * Remap;
+		normal_weight Weight;
+		tvec3<T, P> * Normals;
+
+		// Accumulates the corners of the vertices owned by the job, [Begin, End)
+		void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			for(std::size_t i = Begin; i < End; ++i)
+				Normals[i] = tvec3<T, P>(T(0));
+
+			for(std::size_t t = 0; t < TriangleCount; ++t)
+			{
+				uint const * Triangle = Indices + t * 3;
+
+				for(length_t k = 0; k < 3; ++k)
+				{
+					std::size_t const Key = Remap ? Remap[Triangle[k]] : Triangle[k];
+					if(Key < Begin || Key >= End)
+						continue;
+
+					tvec3<T, P> const & p0 = Positions[Triangle[k]];
+					tvec3<T, P> const e1 = Positions[Triangle[(k + 1) % 3]] - p0;
+					tvec3<T, P> const e2 = Positions[Triangle[(k + 2) % 3]] - p0;
+					tvec3<T, P> const n = cross(e1, e2);
+
+					if(Weight == area_weight)
+						Normals[Key] += n;
+					else
+					{
+						T const Length = length(n);
+						if(Length > T(0))
+							Normals[Key] += n * (corner_angle(e1, e2, Length) / Length);
+					}
+				}
+			}
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_vertex_normals_finalize
+	{
+		uint const * Remap;
+		tvec3<T, P> * Normals;
+
+		void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			T x[4], y[4], z[4];
+			for(std::size_t i = Begin; i < End; i += 4)
+			{
+				std::size_t const n = End - i < 4 ? End - i : 4;
+				for(std::size_t k = 0; k < 4; ++k)
+				{
+					tvec3<T, P> const v = k < n ? Normals[i + k] : tvec3<T, P>(T(0));
+					x[k] = v.x;
+					y[k] = v.y;
+					z[k] = v.z;
+				}
+
+				compute_normalize_soa4<T>::call(x, y, z);
+
+				for(std::size_t k = 0; k < n; ++k)
+					if(!Remap || Remap[i + k] == i + k)
+						Normals[i + k] = tvec3<T, P>(x[k], y[k], z[k]);
+			}
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_vertex_normals_remap
+	{
+		uint const * Remap;
+		tvec3<T, P> * Normals;
+
+		void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			for(std::size_t i = Begin; i < End; ++i)
+				if(Remap[i] != i)
+					Normals[i] = Normals[Remap[i]];
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_vertex_tangents
+	{
+		tvec3<T, P> const * Positions;
+		tvec3<T, P> const * Normals;
+		tvec2<T, P> const * TexCoords;
+		uint const * Indices;
+		std::size_t TriangleCount;
+		tvec4<T, P> * Tangents;
+		tvec3<T, P> * Mirrored;
+
+		void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			for(std::size_t i = Begin; i < End; ++i)
+			{
+				Tangents[i] = tvec4<T, P>(T(0));
+				Mirrored[i] = tvec3<T, P>(T(0));
+			}
+
+			for(std::size_t t = 0; t < TriangleCount; ++t)
+			{
+				uint const * Triangle = Indices + t * 3;
+
+				for(length_t k = 0; k < 3; ++k)
+				{
+					uint const v = Triangle[k];
+					if(v < Begin || v >= End)
+						continue;
+
+					uint const v1 = Triangle[(k + 1) % 3];
+					uint const v2 = Triangle[(k + 2) % 3];
+
+					tvec3<T, P> const e1 = Positions[v1] - Positions[v];
+					tvec3<T, P> const e2 = Positions[v2] - Positions[v];
+					tvec2<T, P> const d1 = TexCoords[v1] - TexCoords[v];
+					tvec2<T, P> const d2 = TexCoords[v2] - TexCoords[v];
+
+					T const Det = d1.x * d2.y - d2.x * d1.y;
+					if(Det == T(0))
+						continue;
+
+					tvec3<T, P> const Sdir = (e1 * d2.y - e2 * d1.y) / Det;
+					tvec3<T, P> const Tdir = (e2 * d1.x - e1 * d2.x) / Det;
+
+					// Project on the tangent plane of the vertex before weighting, like MikkTSpace
+					tvec3<T, P> const & n = Normals[v];
+					tvec3<T, P> const Projected = Sdir - n * dot(n, Sdir);
+					T const ProjectedLength = length(Projected);
+					T const CrossLength = length(cross(e1, e2));
+					if(ProjectedLength <= T(0) || CrossLength <= T(0))
+						continue;
+
+					tvec3<T, P> const Contribution = Projected * (corner_angle(e1, e2, CrossLength) / ProjectedLength);
+					if(dot(cross(n, Sdir), Tdir) < T(0))
+						Mirrored[v] += Contribution;
+					else
+						Tangents[v] += tvec4<T, P>(Contribution, T(0));
+				}
+			}
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_vertex_tangents_finalize
+	{
+		tvec3<T, P> const * Normals;
+		tvec4<T, P> * Tangents;
+		tvec3<T, P> const * Mirrored;
+
+		void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			T nx[4], ny[4], nz[4], x[4], y[4], z[4], w[4];
+			for(std::size_t i = Begin; i < End; i += 4)
+			{
+				std::size_t const n = End - i < 4 ? End - i : 4;
+				for(std::size_t k = 0; k < 4; ++k)
+				{
+					tvec3<T, P> const Normal = k < n ? Normals[i + k] : tvec3<T, P>(T(0), T(0), T(1));
+					tvec3<T, P> Tangent = k < n ? tvec3<T, P>(Tangents[i + k]) : tvec3<T, P>(T(0));
+					w[k] = T(1);
+					if(k < n && dot(Mirrored[i + k], Mirrored[i + k]) > dot(Tangent, Tangent))
+					{
+						Tangent = Mirrored[i + k];
+						w[k] = T(-1);
+					}
+
+					nx[k] = Normal.x; ny[k] = Normal.y; nz[k] = Normal.z;
+					x[k] = Tangent.x; y[k] = Tangent.y; z[k] = Tangent.z;
+				}
+
+				compute_gram_schmidt_soa4<T>::call(nx, ny, nz, x, y, z);
+
+				for(std::size_t k = 0; k < n; ++k)
+				{
+					tvec3<T, P> Tangent(x[k], y[k], z[k]);
+
+					// No valid UV mapping: pick any direction orthogonal to the normal
+					if(Tangent == tvec3<T, P>(T(0)))
+					{
+						tvec3<T, P> const Normal(nx[k], ny[k], nz[k]);
+						tvec3<T, P> const Axis = abs(Normal.x) < T(0.9) ? tvec3<T, P>(T(1), T(0), T(0)) : tvec3<T, P>(T(0), T(1), T(0));
+						Tangent = Axis - Normal * dot(Normal, Axis);
+						T const Length = length(Tangent);
+						Tangent = Length > T(0) ? Tangent / Length : Axis;
+					}
+
+					Tangents[i + k] = tvec4<T, P>(Tangent, w[k]);
+				}
+			}
+		}
+	};
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER uint hash_position(T const * Components)
+	{
+		// FNV-1a over the bits of the components, -0 and +0 hashing the same
+		uint Hash = 2166136261u;
+		for(length_t i = 0; i < 3; ++i)
+		{
+			T const Value = Components[i] == T(0) ? T(0) : Components[i];
+			unsigned char Bytes[sizeof(T)];
+			std::memcpy(Bytes, &Value, sizeof(T));
+			for(std::size_t j = 0; j < sizeof(T); ++j)
+				Hash = (Hash ^ Bytes[j]) * 16777619u;
+		}
+		return Hash;
+	}
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void weldPositions
+	(
+		tvec3<T, P> const * Positions,
+		std::size_t VertexCount,
+		uint * Remap
+	)
+	{
+		std::size_t Capacity = 16;
+		while(Capacity < VertexCount * 2)
+			Capacity *= 2;
+
+		// Open addressing table of vertex indexes, ~0 marks an empty slot
+		std::vector<uint> Table(Capacity, ~uint(0));
+		for(std::size_t i = 0; i < VertexCount; ++i)
+		{
+			T const Components[3] = {Positions[i].x, Positions[i].y, Positions[i].z};
+			std::size_t Slot = detail::hash_position(Components) & (Capacity - 1);
+			for(;;)
+			{
+				uint const Index = Table[Slot];
+				if(Index == ~uint(0))
+				{
+					Table[Slot] = static_cast<uint>(i);
+					Remap[i] = static_cast<uint>(i);
+					break;
+				}
+				if(Positions[Index] == Positions[i])
+				{
+					Remap[i] = Index;
+					break;
+				}
+				Slot = (Slot + 1) & (Capacity - 1);
+			}
+		}
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void vertexNormals
+	(
+		tvec3<T, P> const * Positions,
+		std::size_t VertexCount,
+		uint const * Indices,
+		std::size_t TriangleCount,
+		uint const * Remap,
+		normal_weight Weight,
+		tvec3<T, P> * Normals
+	)
+	{
+		std::size_t const Grain = 4096;
+
+		detail::compute_vertex_normals<T, P> Accumulate = {Positions, Indices, TriangleCount, Remap, Weight, Normals};
+		detail::parallel_for(VertexCount, Grain, Accumulate);
+
+		detail::compute_vertex_normals_finalize<T, P> Finalize = {Remap, Normals};
+		detail::parallel_for(VertexCount, Grain, Finalize);
+
+		if(Remap)
+		{
+			detail::compute_vertex_normals_remap<T, P> Copy = {Remap, Normals};
+			detail::parallel_for(VertexCount, Grain, Copy);
+		}
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void vertexTangents
+	(
+		tvec3<T, P> const * Positions,
+		tvec3<T, P> const * Normals,
+		tvec2<T, P> const * TexCoords,
+		std::size_t VertexCount,
+		uint const * Indices,
+		std::size_t TriangleCount,
+		tvec4<T, P> * Tangents
+	)
+	{
+		if(VertexCount == 0)
+			return;
+
+		std::size_t const Grain = 4096;
+		std::vector<tvec3<T, P> > Mirrored(VertexCount);
+
+		detail::compute_vertex_tangents<T, P> Accumulate = {Positions, Normals, TexCoords, Indices, TriangleCount, Tangents, &Mirrored[0]};
+		detail::parallel_for(VertexCount, Grain, Accumulate);
+
+		detail::compute_vertex_tangents_finalize<T, P> Finalize = {Normals, Tangents, &Mirrored[0]};
+		detail::parallel_for(VertexCount, Grain, Finalize);
+	}
+}//namespace glm
+
+#if GLM_ARCH != GLM_ARCH_PURE
+#	include "mesh_normal_simd.inl"
+#endif
@@ -0,0 +1,60 @@
+/// @ref gtx_mesh_normal
+/// @file glm/gtx/mesh_normal_simd.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	GLM_FUNC_QUALIFIER void glm_soa4_normalize(glm_vec4 & x, glm_vec4 & y, glm_vec4 & z)
+	{
+		glm_vec4 const dot0 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+		glm_vec4 const mask = _mm_cmpgt_ps(dot0, _mm_setzero_ps());
+		glm_vec4 const rcp0 = _mm_and_ps(mask, _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(dot0)));
+		x = _mm_mul_ps(x, rcp0);
+		y = _mm_mul_ps(y, rcp0);
+		z = _mm_mul_ps(z, rcp0);
+	}
+
+	template <>
+	struct compute_normalize_soa4<float>
+	{
+		GLM_FUNC_QUALIFIER static void call(float * x, float * y, float * z)
+		{
+			glm_vec4 vx = _mm_loadu_ps(x);
+			glm_vec4 vy = _mm_loadu_ps(y);
+			glm_vec4 vz = _mm_loadu_ps(z);
+			glm_soa4_normalize(vx, vy, vz);
+			_mm_storeu_ps(x, vx);
+			_mm_storeu_ps(y, vy);
+			_mm_storeu_ps(z, vz);
+		}
+	};
+
+	template <>
+	struct compute_gram_schmidt_soa4<float>
+	{
+		GLM_FUNC_QUALIFIER static void call(float const * nx, float const * ny, float const * nz, float * x, float * y, float * z)
+		{
+			glm_vec4 const vnx = _mm_loadu_ps(nx);
+			glm_vec4 const vny = _mm_loadu_ps(ny);
+			glm_vec4 const vnz = _mm_loadu_ps(nz);
+			glm_vec4 vx = _mm_loadu_ps(x);
+			glm_vec4 vy = _mm_loadu_ps(y);
+			glm_vec4 vz = _mm_loadu_ps(z);
+
+			glm_vec4 const dot0 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vnx, vx), _mm_mul_ps(vny, vy)), _mm_mul_ps(vnz, vz));
+			vx = _mm_sub_ps(vx, _mm_mul_ps(vnx, dot0));
+			vy = _mm_sub_ps(vy, _mm_mul_ps(vny, dot0));
+			vz = _mm_sub_ps(vz, _mm_mul_ps(vnz, dot0));
+			glm_soa4_normalize(vx, vy, vz);
+
+			_mm_storeu_ps(x, vx);
+			_mm_storeu_ps(y, vy);
+			_mm_storeu_ps(z, vz);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,69 @@
+/// @ref gtx_mesh_simplify
+/// @file glm/gtx/mesh_simplify.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_mesh_simplify GLM_GTX_mesh_simplify
+/// @ingroup gtx
+///
+/// @brief Quadric error metric edge collapse simplification of indexed triangle meshes.
+///
+/// Quadrics are stored as 10 values per vertex in a structure of arrays, edge collapses are
+/// ordered by a 4-ary heap whose stale entries are discarded when popped (lazy invalidation).
+/// Boundary edges are preserved by weighted planes orthogonal to their triangle.
+///
+/// <glm/gtx/mesh_simplify.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_mesh_simplify extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_mesh_simplify
+	/// @{
+
+	/// Simplifies a triangle list in place until TargetTriangleCount triangles remain or until the next
+	/// collapse would exceed MaxError, a distance to the original surface.
+	/// Collapsed vertices are moved to the position minimizing the quadric error and the remaining
+	/// triangles are written at the beginning of Indices. The vertex arrays are not compacted.
+	/// Attributes may be null, otherwise AttributeWeight scales the squared distance between the
+	/// attributes of the collapsed vertices in the collapse cost, and attributes are interpolated.
+	/// Returns the number of remaining triangles.
+	/// @see gtx_mesh_simplify
+	template <typename T, precision P>
+	GLM_FUNC_DECL std::size_t simplify(
+		tvec3<T, P> * Positions,
+		tvec4<T, P> * Attributes,
+		T AttributeWeight,
+		std::size_t VertexCount,
+		uint * Indices,
+		std::size_t TriangleCount,
+		std::size_t TargetTriangleCount,
+		T MaxError);
+
+	/// Parallel variant of simplify: triangles are partitioned in spatial clusters which are simplified
+	/// concurrently, vertices shared by several clusters being locked. The partition doesn't depend on
+	/// the number of threads so the result is deterministic.
+	/// @see gtx_mesh_simplify
+	template <typename T, precision P>
+	GLM_FUNC_DECL std::size_t simplifyClusters(
+		tvec3<T, P> * Positions,
+		tvec4<T, P> * Attributes,
+		T AttributeWeight,
+		std::size_t VertexCount,
+		uint * Indices,
+		std::size_t TriangleCount,
+		std::size_t TargetTriangleCount,
+		T MaxError);
+
+	/// @}
+}//namespace glm
+
+#include "mesh_simplify.inl"
@@ -0,0 +1,704 @@
+/// @ref gtx_mesh_simplify
+/// @file glm/gtx/mesh_simplify.inl
+
+#include "../detail/_parallel.hpp"
+#include <algorithm>
+#include <vector>
+
+namespace glm{
+namespace detail
+{
+	// Error of the position (x, y, z) for a quadric stored as its 10 upper coefficients
+	// a², ab, ac, ad, b², bc, bd, c², cd, d² of the plane ax + by + cz + d = 0.
+	template <typename T>
+	GLM_FUNC_QUALIFIER T quadric_error(T const * Q, T x, T y, T z)
+	{
+		return
+			x * (Q[0] * x + T(2) * (Q[1] * y + Q[2] * z + Q[3])) +
+			y * (Q[4] * y + T(2) * (Q[5] * z + Q[6])) +
+			z * (Q[7] * z + T(2) * Q[8]) + Q[9];
+	}
+
+	template <typename T>
+	struct collapse_entry
+	{
+		T Cost;
+		uint A;
+		uint B;
+		uint VersionA;
+		uint VersionB;
+	};
+
+	// 4-ary min heap of edge collapses: half the depth of a binary heap, the four children of a node being
+	// adjacent in memory (entries are not padded or aligned, so a group of children may straddle cache lines).
+	template <typename T>
+	class collapse_heap
+	{
+	public:
+		bool empty() const
+		{
+			return Entries.empty();
+		}
+
+		void push(collapse_entry<T> const & Entry)
+		{
+			std::size_t i = Entries.size();
+			Entries.push_back(Entry);
+			while(i > 0)
+			{
+				std::size_t const Parent = (i - 1) / 4;
+				if(!(Entry.Cost < Entries[Parent].Cost))
+					break;
+				Entries[i] = Entries[Parent];
+				i = Parent;
+			}
+			Entries[i] = Entry;
+		}
+
+		collapse_entry<T> pop()
+		{
+			collapse_entry<T> const Top = Entries[0];
+			collapse_entry<T> const Last = Entries.back();
+			Entries.pop_back();
+
+			std::size_t const Size = Entries.size();
+			if(Size == 0)
+				return Top;
+
+			std::size_t i = 0;
+			for(;;)
+			{
+				std::size_t const First = i * 4 + 1;
+				if(First >= Size)
+					break;
+				std::size_t const End = First + 4 < Size ? First + 4 : Size;
+				std::size_t Child = First;
+				for(std::size_t c = First + 1; c < End; ++c)
+					if(Entries[c].Cost < Entries[Child].Cost)
+						Child = c;
+				if(!(Entries[Child].Cost < Last.Cost))
+					break;
+				Entries[i] = Entries[Child];
+				i = Child;
+			}
+			Entries[i] = Last;
+
+			return Top;
+		}
+
+	private:
+		std::vector<collapse_entry<T> > Entries;
+	};
+
+	struct edge_key
+	{
+		uint64 Key;
+		uint Triangle;
+
+		bool operator<(edge_key const & Other) const
+		{
+			return Key < Other.Key || (Key == Other.Key && Triangle < Other.Triangle);
+		}
+	};
+
+	// Edge collapse simplifier. Vertices collapsed together form a ring (Next) whose adjacency lists are
+	// concatenated, the adjacency is rebuilt from the live triangles each time their count halves.
+	template <typename T, precision P>
+	class mesh_simplifier
+	{
+	public:
+		mesh_simplifier(
+			tvec3<T, P> * Positions,
+			tvec4<T, P> * Attributes,
+			T AttributeWeight,
+			std::size_t VertexCount,
+			uint * Indices,
+			std::size_t TriangleCount,
+			unsigned char const * Locked
+		)
+			: Positions(Positions)
+			, Attributes(Attributes)
+			, AttributeWeight(AttributeWeight)
+			, VertexCount(VertexCount)
+			, Indices(Indices)
+			, TriangleCount(TriangleCount)
+			, Locked(Locked)
+			, LiveCount(0)
+			, Quadrics(VertexCount * 10, T(0))
+			, Next(VertexCount)
+			, Version(VertexCount, 0)
+			, Mark(VertexCount, 0)
+			, Stamp(0)
+			, Removed(VertexCount, 0)
+			, TriangleRemoved(TriangleCount, 0)
+			, Normals(TriangleCount)
+		{
+			std::vector<edge_key> Edges;
+			Edges.reserve(TriangleCount * 3);
+
+			for(std::size_t t = 0; t < TriangleCount; ++t)
+			{
+				uint const * Triangle = Indices + t * 3;
+				if(Triangle[0] == Triangle[1] || Triangle[1] == Triangle[2] || Triangle[2] == Triangle[0])
+				{
+					TriangleRemoved[t] = 1;
+					continue;
+				}
+				++LiveCount;
+
+				tvec3<T, P> const n = triangle_normal(Triangle);
+				Normals[t] = n;
+				for(length_t k = 0; k < 3; ++k)
+				{
+					add_plane(Triangle[k], n, -dot(n, Positions[Triangle[k]]), T(1));
+
+					uint const a = Triangle[k];
+					uint const b = Triangle[(k + 1) % 3];
+					edge_key Edge;
+					Edge.Key = a < b ? (static_cast<uint64>(a) << 32) | b : (static_cast<uint64>(b) << 32) | a;
+					Edge.Triangle = static_cast<uint>(t);
+					Edges.push_back(Edge);
+				}
+			}
+
+			std::sort(Edges.begin(), Edges.end());
+
+			// Boundary edges get a plane orthogonal to their triangle so that they can only slide along the boundary
+			for(std::size_t i = 0; i < Edges.size();)
+			{
+				std::size_t j = i + 1;
+				while(j < Edges.size() && Edges[j].Key == Edges[i].Key)
+					++j;
+
+				uint const a = static_cast<uint>(Edges[i].Key >> 32);
+				uint const b = static_cast<uint>(Edges[i].Key & 0xffffffff);
+				if(j - i == 1)
+				{
+					tvec3<T, P> const Edge = Positions[b] - Positions[a];
+					tvec3<T, P> const m = cross(Edge, triangle_normal(Indices + Edges[i].Triangle * 3));
+					T const Length = length(m);
+					if(Length > T(0))
+					{
+						tvec3<T, P> const n = m / Length;
+						T const d = -dot(n, Positions[a]);
+						add_plane(a, n, d, BoundaryWeight());
+						add_plane(b, n, d, BoundaryWeight());
+					}
+				}
+
+				i = j;
+			}
+
+			rebuild();
+
+			for(std::size_t i = 0; i < Edges.size(); ++i)
+				if(i == 0 || Edges[i].Key != Edges[i - 1].Key)
+					push(static_cast<uint>(Edges[i].Key >> 32), static_cast<uint>(Edges[i].Key & 0xffffffff));
+		}
+
+		std::size_t run(std::size_t TargetTriangleCount, T MaxError)
+		{
+			T const MaxCost = MaxError * MaxError;
+
+			while(LiveCount > TargetTriangleCount && !Heap.empty())
+			{
+				collapse_entry<T> const Entry = Heap.pop();
+
+				// Lazy invalidation: the entry is stale if either vertex changed since it was pushed
+				if(Removed[Entry.A] || Removed[Entry.B] || Version[Entry.A] != Entry.VersionA || Version[Entry.B] != Entry.VersionB)
+					continue;
+				if(Entry.Cost > MaxCost)
+					break;
+
+				T Cost(0), Mix(0);
+				tvec3<T, P> Position;
+				if(!evaluate(Entry.A, Entry.B, Cost, Position, Mix))
+					continue;
+
+				gather(Entry.A, true);
+				std::size_t const Split = Scratch.size();
+				gather(Entry.B, false);
+				if(!valid(Entry.A, Entry.B, Split, Position))
+					continue;
+
+				collapse(Entry.A, Entry.B, Position, Mix);
+
+				if(LiveCount * 2 < RebuildCount)
+					rebuild();
+			}
+
+			std::size_t Count = 0;
+			for(std::size_t t = 0; t < TriangleCount; ++t)
+			{
+				if(TriangleRemoved[t])
+					continue;
+				for(std::size_t k = 0; k < 3; ++k)
+					Indices[Count * 3 + k] = Indices[t * 3 + k];
+				++Count;
+			}
+			return Count;
+		}
+
+	private:
+		static T BoundaryWeight()
+		{
+			return T(16);
+		}
+
+		T * quadric(length_t k)
+		{
+			return &Quadrics[static_cast<std::size_t>(k) * VertexCount];
+		}
+
+		tvec3<T, P> triangle_normal(uint const * Triangle) const
+		{
+			tvec3<T, P> const n = cross(Positions[Triangle[1]] - Positions[Triangle[0]], Positions[Triangle[2]] - Positions[Triangle[0]]);
+			T const Length = length(n);
+			return Length > T(0) ? n / Length : tvec3<T, P>(T(0));
+		}
+
+		void add_plane(uint v, tvec3<T, P> const & n, T d, T w)
+		{
+			T const Plane[4] = {n.x, n.y, n.z, d};
+			length_t q = 0;
+			for(length_t i = 0; i < 4; ++i)
+			for(length_t j = i; j < 4; ++j)
+				quadric(q++)[v] += w * Plane[i] * Plane[j];
+		}
+
+		bool locked(uint v) const
+		{
+			return Locked && Locked[v];
+		}
+
+		// Computes the position and the cost of the collapse of the edge (a, b)
+		bool evaluate(uint a, uint b, T & Cost, tvec3<T, P> & Position, T & Mix)
+		{
+			if(locked(a) && locked(b))
+				return false;
+
+			T Q[10];
+			for(length_t k = 0; k < 10; ++k)
+				Q[k] = quadric(k)[a] + quadric(k)[b];
+
+			tvec3<T, P> const & pa = Positions[a];
+			tvec3<T, P> const & pb = Positions[b];
+			tvec3<T, P> const Edge = pb - pa;
+			T const Length2 = dot(Edge, Edge);
+
+			if(locked(a))
+				Position = pa;
+			else if(locked(b))
+				Position = pb;
+			else
+			{
+				// Minimum of the quadric where its gradient is null, unless the system is ill conditioned
+				tmat3x3<T, P> const A(Q[0], Q[1], Q[2], Q[1], Q[4], Q[5], Q[2], Q[5], Q[7]);
+				T const Trace = (Q[0] + Q[4] + Q[7]) / T(3);
+				T const Det = determinant(A);
+
+				bool Solved = false;
+				if(abs(Det) > T(1e-3) * Trace * Trace * Trace)
+				{
+					Position = -(inverse(A) * tvec3<T, P>(Q[3], Q[6], Q[8]));
+					tvec3<T, P> const Offset = Position - (pa + pb) * T(0.5);
+					Solved = dot(Offset, Offset) <= T(4) * Length2;
+				}
+
+				if(!Solved)
+				{
+					tvec3<T, P> const Candidates[3] = {pa, pb, (pa + pb) * T(0.5)};
+					T Best(0);
+					for(length_t i = 0; i < 3; ++i)
+					{
+						T const Error = quadric_error(Q, Candidates[i].x, Candidates[i].y, Candidates[i].z);
+						if(i == 0 || Error < Best)
+						{
+							Best = Error;
+							Position = Candidates[i];
+						}
+					}
+				}
+			}
+
+			Mix = Length2 > T(0) ? clamp(dot(Position - pa, Edge) / Length2, T(0), T(1)) : T(0.5);
+			Cost = max(quadric_error(Q, Position.x, Position.y, Position.z), T(0));
+			if(Attributes)
+			{
+				tvec4<T, P> const Delta = Attributes[b] - Attributes[a];
+				Cost += AttributeWeight * dot(Delta, Delta);
+			}
+
+			return true;
+		}
+
+		void push(uint a, uint b)
+		{
+			collapse_entry<T> Entry;
+			tvec3<T, P> Position;
+			T Mix(0);
+			if(!evaluate(a, b, Entry.Cost, Position, Mix))
+				return;
+			Entry.A = a;
+			Entry.B = b;
+			Entry.VersionA = Version[a];
+			Entry.VersionB = Version[b];
+			Heap.push(Entry);
+		}
+
+		// Appends the live triangles of the vertices collapsed into v to Scratch
+		void gather(uint v, bool Clear)
+		{
+			if(Clear)
+				Scratch.clear();
+
+			uint g = v;
+			do
+			{
+				for(uint i = Offsets[g]; i < Offsets[g + 1]; ++i)
+					if(!TriangleRemoved[Adjacency[i]])
+						Scratch.push_back(Adjacency[i]);
+				g = Next[g];
+			}
+			while(g != v);
+		}
+
+		bool contains(uint t, uint v) const
+		{
+			return Indices[t * 3 + 0] == v || Indices[t * 3 + 1] == v || Indices[t * 3 + 2] == v;
+		}
+
+		// Rejects collapses flipping a triangle or breaking the link condition, which would create a non manifold edge
+		bool valid(uint a, uint b, std::size_t Split, tvec3<T, P> const & Position)
+		{
+			Stamp += 2;
+
+			std::size_t Shared = 0;
+			for(std::size_t i = 0; i < Split; ++i)
+			{
+				uint const t = Scratch[i];
+				Shared += contains(t, b) ? 1 : 0;
+				for(std::size_t k = 0; k < 3; ++k)
+					Mark[Indices[t * 3 + k]] = Stamp;
+			}
+
+			std::size_t Common = 0;
+			for(std::size_t i = Split; i < Scratch.size(); ++i)
+			{
+				uint const * Triangle = Indices + Scratch[i] * 3;
+				for(std::size_t k = 0; k < 3; ++k)
+				{
+					uint const u = Triangle[k];
+					if(u != a && u != b && Mark[u] == Stamp)
+					{
+						Mark[u] = Stamp + 1;
+						++Common;
+					}
+				}
+			}
+			if(Common != Shared)
+				return false;
+
+			for(std::size_t i = 0; i < Scratch.size(); ++i)
+			{
+				uint const * Triangle = Indices + Scratch[i] * 3;
+				bool const HasA = Triangle[0] == a || Triangle[1] == a || Triangle[2] == a;
+				bool const HasB = Triangle[0] == b || Triangle[1] == b || Triangle[2] == b;
+				if(HasA && HasB)
+					continue;
+
+				tvec3<T, P> p[3], q[3];
+				for(length_t k = 0; k < 3; ++k)
+				{
+					p[k] = Positions[Triangle[k]];
+					q[k] = Triangle[k] == a || Triangle[k] == b ? Position : p[k];
+				}
+
+				tvec3<T, P> const n0 = cross(p[1] - p[0], p[2] - p[0]);
+				tvec3<T, P> const n1 = cross(q[1] - q[0], q[2] - q[0]);
+
+				// Also rejects normals rotated by more than about 75 degrees from the current or the original
+				// triangle, small rotations accumulated by successive collapses would fold slivers otherwise
+				T const Dot = dot(n0, n1);
+				T const Length2 = dot(n1, n1);
+				if(Dot <= T(0) || Dot * Dot < T(0.0625) * dot(n0, n0) * Length2)
+					return false;
+				T const Original = dot(Normals[Scratch[i]], n1);
+				if(Original <= T(0) || Original * Original < T(0.0625) * Length2)
+					return false;
+			}
+
+			return true;
+		}
+
+		void collapse(uint a, uint b, tvec3<T, P> const & Position, T Mix)
+		{
+			uint const s = locked(a) ? a : b;
+			uint const r = s == a ? b : a;
+
+			if(Attributes)
+				Attributes[s] = mix(Attributes[a], Attributes[b], Mix);
+			Positions[s] = Position;
+			for(length_t k = 0; k < 10; ++k)
+				quadric(k)[s] += quadric(k)[r];
+			Removed[r] = 1;
+
+			for(std::size_t i = 0; i < Scratch.size(); ++i)
+			{
+				uint const t = Scratch[i];
+				if(TriangleRemoved[t])
+					continue;
+
+				uint * Triangle = Indices + t * 3;
+				for(length_t k = 0; k < 3; ++k)
+					if(Triangle[k] == r)
+						Triangle[k] = s;
+
+				if(Triangle[0] == Triangle[1] || Triangle[1] == Triangle[2] || Triangle[2] == Triangle[0])
+				{
+					TriangleRemoved[t] = 1;
+					--LiveCount;
+				}
+			}
+
+			std::swap(Next[s], Next[r]);
+			++Version[s];
+
+			// Pushes the edges of the survivor with its new cost
+			gather(s, true);
+			Stamp += 2;
+			Mark[s] = Stamp;
+			for(std::size_t i = 0; i < Scratch.size(); ++i)
+			for(std::size_t k = 0; k < 3; ++k)
+			{
+				uint const u = Indices[Scratch[i] * 3 + k];
+				if(Mark[u] == Stamp)
+					continue;
+				Mark[u] = Stamp;
+				push(s, u);
+			}
+		}
+
+		// Rebuilds the vertex to triangle adjacency from the live triangles
+		void rebuild()
+		{
+			Offsets.assign(VertexCount + 1, 0);
+			for(std::size_t t = 0; t < TriangleCount; ++t)
+				if(!TriangleRemoved[t])
+					for(std::size_t k = 0; k < 3; ++k)
+						++Offsets[Indices[t * 3 + k] + 1];
+			for(std::size_t v = 0; v < VertexCount; ++v)
+				Offsets[v + 1] += Offsets[v];
+
+			Adjacency.resize(Offsets[VertexCount]);
+			std::vector<uint> Fill(Offsets.begin(), Offsets.end() - 1);
+			for(std::size_t t = 0; t < TriangleCount; ++t)
+				if(!TriangleRemoved[t])
+					for(std::size_t k = 0; k < 3; ++k)
+						Adjacency[Fill[Indices[t * 3 + k]]++] = static_cast<uint>(t);
+
+			for(std::size_t v = 0; v < VertexCount; ++v)
+				Next[v] = static_cast<uint>(v);
+
+			RebuildCount = LiveCount;
+		}
+
+		tvec3<T, P> * Positions;
+		tvec4<T, P> * Attributes;
+		T AttributeWeight;
+		std::size_t VertexCount;
+		uint * Indices;
+		std::size_t TriangleCount;
+		unsigned char const * Locked;
+		std::size_t LiveCount;
+		std::size_t RebuildCount;
+
+		std::vector<T> Quadrics;
+		std::vector<uint> Offsets;
+		std::vector<uint> Adjacency;
+		std::vector<uint> Next;
+		std::vector<uint> Version;
+		std::vector<uint> Mark;
+		uint Stamp;
+		std::vector<unsigned char> Removed;
+		std::vector<unsigned char> TriangleRemoved;
+		std::vector<tvec3<T, P> > Normals;
+		std::vector<uint> Scratch;
+		collapse_heap<T> Heap;
+	};
+
+	template <typename T, precision P>
+	struct compute_simplify_clusters
+	{
+		tvec3<T, P> * Positions;
+		tvec4<T, P> * Attributes;
+		T AttributeWeight;
+		uint const * Indices;
+		std::size_t TriangleCount;
+		uint const * ClusterOffsets;
+		uint const * ClusterTriangles;
+		unsigned char const * Locked;
+		std::size_t TargetTriangleCount;
+		T MaxError;
+		std::vector<uint> * Results;
+
+		// Simplifies the clusters [Begin, End) as independent meshes, vertices of several clusters being locked
+		void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			for(std::size_t c = Begin; c < End; ++c)
+			{
+				std::size_t const Count = ClusterOffsets[c + 1] - ClusterOffsets[c];
+				if(Count == 0)
+					continue;
+				uint const * Triangles = ClusterTriangles + ClusterOffsets[c];
+
+				std::vector<uint> Vertices;
+				Vertices.reserve(Count * 3);
+				for(std::size_t t = 0; t < Count; ++t)
+					Vertices.insert(Vertices.end(), Indices + Triangles[t] * 3, Indices + Triangles[t] * 3 + 3);
+				std::sort(Vertices.begin(), Vertices.end());
+				Vertices.erase(std::unique(Vertices.begin(), Vertices.end()), Vertices.end());
+
+				std::vector<tvec3<T, P> > LocalPositions(Vertices.size());
+				std::vector<tvec4<T, P> > LocalAttributes(Attributes ? Vertices.size() : 0);
+				std::vector<unsigned char> LocalLocked(Vertices.size());
+				for(std::size_t v = 0; v < Vertices.size(); ++v)
+				{
+					LocalPositions[v] = Positions[Vertices[v]];
+					if(Attributes)
+						LocalAttributes[v] = Attributes[Vertices[v]];
+					LocalLocked[v] = Locked[Vertices[v]];
+				}
+
+				std::vector<uint> LocalIndices(Count * 3);
+				for(std::size_t t = 0; t < Count; ++t)
+				for(std::size_t k = 0; k < 3; ++k)
+					LocalIndices[t * 3 + k] = static_cast<uint>(std::lower_bound(Vertices.begin(), Vertices.end(), Indices[Triangles[t] * 3 + k]) - Vertices.begin());
+
+				std::size_t const Target = static_cast<std::size_t>(static_cast<double>(TargetTriangleCount) * static_cast<double>(Count) / static_cast<double>(TriangleCount) + 0.5);
+
+				mesh_simplifier<T, P> Simplifier(
+					&LocalPositions[0], Attributes ? &LocalAttributes[0] : static_cast<tvec4<T, P> *>(0), AttributeWeight,
+					Vertices.size(), &LocalIndices[0], Count, &LocalLocked[0]);
+				std::size_t const Remaining = Simplifier.run(Target, MaxError);
+
+				// Unlocked vertices are only referenced by this cluster
+				for(std::size_t v = 0; v < Vertices.size(); ++v)
+				{
+					if(LocalLocked[v])
+						continue;
+					Positions[Vertices[v]] = LocalPositions[v];
+					if(Attributes)
+						Attributes[Vertices[v]] = LocalAttributes[v];
+				}
+
+				Results[c].resize(Remaining * 3);
+				for(std::size_t i = 0; i < Remaining * 3; ++i)
+					Results[c][i] = Vertices[LocalIndices[i]];
+			}
+		}
+	};
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER std::size_t simplify
+	(
+		tvec3<T, P> * Positions,
+		tvec4<T, P> * Attributes,
+		T AttributeWeight,
+		std::size_t VertexCount,
+		uint * Indices,
+		std::size_t TriangleCount,
+		std::size_t TargetTriangleCount,
+		T MaxError
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'simplify' only accept floating-point inputs");
+
+		if(TriangleCount == 0)
+			return 0;
+
+		detail::mesh_simplifier<T, P> Simplifier(Positions, Attributes, AttributeWeight, VertexCount, Indices, TriangleCount, static_cast<unsigned char const *>(0));
+		return Simplifier.run(TargetTriangleCount, MaxError);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER std::size_t simplifyClusters
+	(
+		tvec3<T, P> * Positions,
+		tvec4<T, P> * Attributes,
+		T AttributeWeight,
+		std::size_t VertexCount,
+		uint * Indices,
+		std::size_t TriangleCount,
+		std::size_t TargetTriangleCount,
+		T MaxError
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'simplifyClusters' only accept floating-point inputs");
+
+		if(TriangleCount == 0)
+			return 0;
+
+		// Regular grid of about 32768 triangles per cluster, independent of the number of threads
+		std::size_t const TrianglesPerCluster = 32768;
+		std::size_t Cells = 1;
+		while(Cells * Cells * Cells * TrianglesPerCluster < TriangleCount)
+			++Cells;
+
+		tvec3<T, P> Min(Positions[Indices[0]]), Max(Min);
+		for(std::size_t i = 0; i < TriangleCount * 3; ++i)
+		{
+			Min = min(Min, Positions[Indices[i]]);
+			Max = max(Max, Positions[Indices[i]]);
+		}
+		tvec3<T, P> const Extent = max(Max - Min, tvec3<T, P>(std::numeric_limits<T>::min()));
+		T const Scale = static_cast<T>(Cells);
+
+		std::size_t const ClusterCount = Cells * Cells * Cells;
+		std::vector<uint> Cluster(TriangleCount);
+		std::vector<uint> ClusterOffsets(ClusterCount + 1, 0);
+		for(std::size_t t = 0; t < TriangleCount; ++t)
+		{
+			tvec3<T, P> const Centroid = (Positions[Indices[t * 3 + 0]] + Positions[Indices[t * 3 + 1]] + Positions[Indices[t * 3 + 2]]) / T(3);
+			tvec3<T, P> const Cell = clamp((Centroid - Min) / Extent * Scale, tvec3<T, P>(T(0)), tvec3<T, P>(Scale - T(1)));
+			Cluster[t] = static_cast<uint>((static_cast<std::size_t>(Cell.z) * Cells + static_cast<std::size_t>(Cell.y)) * Cells + static_cast<std::size_t>(Cell.x));
+			++ClusterOffsets[Cluster[t] + 1];
+		}
+		for(std::size_t c = 0; c < ClusterCount; ++c)
+			ClusterOffsets[c + 1] += ClusterOffsets[c];
+
+		std::vector<uint> ClusterTriangles(TriangleCount);
+		std::vector<uint> Fill(ClusterOffsets.begin(), ClusterOffsets.end() - 1);
+		for(std::size_t t = 0; t < TriangleCount; ++t)
+			ClusterTriangles[Fill[Cluster[t]]++] = static_cast<uint>(t);
+
+		uint const Unowned = ~static_cast<uint>(0);
+		std::vector<uint> Owner(VertexCount, Unowned);
+		std::vector<unsigned char> Locked(VertexCount, 0);
+		for(std::size_t t = 0; t < TriangleCount; ++t)
+		for(std::size_t k = 0; k < 3; ++k)
+		{
+			uint const v = Indices[t * 3 + k];
+			if(Owner[v] == Unowned)
+				Owner[v] = Cluster[t];
+			else if(Owner[v] != Cluster[t])
+				Locked[v] = 1;
+		}
+
+		std::vector<std::vector<uint> > Results(ClusterCount);
+		detail::compute_simplify_clusters<T, P> Func = {
+			Positions, Attributes, AttributeWeight, Indices, TriangleCount,
+			&ClusterOffsets[0], &ClusterTriangles[0], &Locked[0],
+			TargetTriangleCount, MaxError, &Results[0]};
+		detail::parallel_for(ClusterCount, 1, Func);
+
+		std::size_t Count = 0;
+		for(std::size_t c = 0; c < ClusterCount; ++c)
+		{
+			std::copy(Results[c].begin(), Results[c].end(), Indices + Count * 3);
+			Count += Results[c].size() / 3;
+		}
+		return Count;
+	}
+}//namespace glm
@@ -0,0 +1,112 @@
+/// @ref gtx_occlusion_culling
+/// @file glm/gtx/occlusion_culling.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_occlusion_culling GLM_GTX_occlusion_culling
+/// @ingroup gtx
+///
+/// @brief Software rasterization of occluders into a low resolution depth buffer, and occlusion queries of boxes.
+///
+/// Occluder vertices are transformed to clip space, triangles are set up and binned into tiles of 64x16 pixels,
+/// then tiles are rasterized in parallel with 8 pixels wide edge functions (AVX, or 4 wide with SSE2) and masked
+/// depth writes. The buffer stores 1/w of the nearest occluder, so that it doesn't depend on the depth range of
+/// the projection, and keeps the farthest depth of each 8x8 pixels block as a hierarchical depth buffer.
+/// Queries project the corners of a box and compare its nearest depth with the blocks, then the pixels it covers.
+///
+/// Occluders crossing the near plane are skipped and boxes crossing it are visible, so queries are conservative
+/// up to the sampling of occluders at pixel centers.
+///
+/// <glm/gtx/occlusion_culling.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+#include <vector>
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_occlusion_culling extension included")
+#endif
+
+namespace glm{
+namespace detail
+{
+	// Occluder triangle in window coordinates
+	struct occlusion_setup
+	{
+		// Edge functions A * x + B * y + C, positive inside
+		float Edges[3][3];
+
+		// 1/w = Plane[0] * x + Plane[1] * y + Plane[2], and its largest value at the vertices
+		float Plane[3];
+		float Nearest;
+
+		// Inclusive pixel bounds, empty when MinX > MaxX
+		int MinX, MinY, MaxX, MaxY;
+	};
+}//namespace detail
+
+	/// @addtogroup gtx_occlusion_culling
+	/// @{
+
+	/// Depth buffer of occluders and hierarchical depth buffer, with the work buffers of rasterizeOccluders.
+	/// Pixel (x, y) covers [x, x + 1] x [y, y + 1] in window coordinates, y growing upward as normalized device y.
+	/// @see gtx_occlusion_culling
+	struct occlusion_buffer
+	{
+		/// Width and Height are rounded up to multiples of 8, the buffer is cleared.
+		GLM_FUNC_DECL occlusion_buffer(std::size_t Width, std::size_t Height);
+
+		std::size_t Width;
+		std::size_t Height;
+
+		/// Row major, 1/w of the nearest occluder at each pixel center, 0 where there is none
+		std::vector<float> Depth;
+
+		/// Row major, smallest Depth of each block of 8x8 pixels
+		std::vector<float> HiZ;
+
+		/// Clip space vertices, triangle setups and per job tile bins of the last rasterizeOccluders call
+		std::vector<vec4> Clip;
+		std::vector<detail::occlusion_setup> Setups;
+		std::vector<std::vector<uint> > Bins;
+	};
+
+	/// Removes all occluders.
+	/// @see gtx_occlusion_culling
+	GLM_FUNC_DECL void clearOcclusion(occlusion_buffer & Buffer);
+
+	/// Rasterizes the triangle list Indices of Positions transformed by ModelViewProjection, both faces of each triangle.
+	/// @see gtx_occlusion_culling
+	GLM_FUNC_DECL void rasterizeOccluders(
+		occlusion_buffer & Buffer,
+		mat4 const & ModelViewProjection,
+		vec3 const * Positions,
+		std::size_t VertexCount,
+		uint const * Indices,
+		std::size_t TriangleCount);
+
+	/// Return false if the box [Min, Max] transformed by ModelViewProjection is behind occluders, or outside the viewport.
+	/// @see gtx_occlusion_culling
+	GLM_FUNC_DECL bool isVisible(
+		occlusion_buffer const & Buffer,
+		mat4 const & ModelViewProjection,
+		vec3 const & Min,
+		vec3 const & Max);
+
+	/// Tests Count boxes in parallel.
+	/// @see gtx_occlusion_culling
+	GLM_FUNC_DECL void isVisible(
+		occlusion_buffer const & Buffer,
+		mat4 const & ModelViewProjection,
+		vec3 const * Mins,
+		vec3 const * Maxs,
+		std::size_t Count,
+		bool * Visible);
+
+	/// @}
+}//namespace glm
+
+#include "occlusion_culling.inl"
@@ -0,0 +1,428 @@
+/// @ref gtx_occlusion_culling
+/// @file glm/gtx/occlusion_culling.inl
+
+#include "../detail/_parallel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	static int const occlusion_tile_width = 64;
+	static int const occlusion_tile_height = 16;
+	static int const occlusion_block_size = 8;
+
+	// Vertices closer to the plane w = 0 are considered crossing the near plane
+	static float const occlusion_near_w = 1e-5f;
+
+	GLM_FUNC_QUALIFIER std::size_t occlusion_tiles_x(occlusion_buffer const & Buffer)
+	{
+		return (Buffer.Width + occlusion_tile_width - 1) / occlusion_tile_width;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t occlusion_tiles_y(occlusion_buffer const & Buffer)
+	{
+		return (Buffer.Height + occlusion_tile_height - 1) / occlusion_tile_height;
+	}
+
+	GLM_FUNC_QUALIFIER int occlusion_clamp(double Value, int Min, int Max)
+	{
+		return Value < static_cast<double>(Min) ? Min : (Value > static_cast<double>(Max) ? Max : static_cast<int>(Value));
+	}
+
+	// Edge functions and depth plane of a triangle in window coordinates, computed in double so that vertices far
+	// outside the viewport don't lose the precision of the pixels inside. Return false if no pixel center can be covered.
+	GLM_FUNC_QUALIFIER bool occlusion_setup_triangle(vec4 const * Vertices[3], int Width, int Height, occlusion_setup & Setup)
+	{
+		double x[3], y[3], z[3];
+		for(int i = 0; i < 3; ++i)
+		{
+			vec4 const & v = *Vertices[i];
+			if(!(v.w >= occlusion_near_w))
+				return false;
+			double const w = static_cast<double>(v.w);
+			x[i] = (static_cast<double>(v.x) / w * 0.5 + 0.5) * static_cast<double>(Width);
+			y[i] = (static_cast<double>(v.y) / w * 0.5 + 0.5) * static_cast<double>(Height);
+			z[i] = 1.0 / w;
+		}
+
+		double const dx1 = x[1] - x[0], dy1 = y[1] - y[0], dz1 = z[1] - z[0];
+		double const dx2 = x[2] - x[0], dy2 = y[2] - y[0], dz2 = z[2] - z[0];
+		double const Area = dx1 * dy2 - dx2 * dy1;
+		if(!(Area != 0.0))
+			return false;
+
+		// Pixels whose centers are within the bounds of the triangle
+		Setup.MinX = occlusion_clamp(std::ceil(std::min(x[0], std::min(x[1], x[2])) - 0.5), 0, Width);
+		Setup.MaxX = occlusion_clamp(std::floor(std::max(x[0], std::max(x[1], x[2])) - 0.5), -1, Width - 1);
+		Setup.MinY = occlusion_clamp(std::ceil(std::min(y[0], std::min(y[1], y[2])) - 0.5), 0, Height);
+		Setup.MaxY = occlusion_clamp(std::floor(std::max(y[0], std::max(y[1], y[2])) - 0.5), -1, Height - 1);
+		if(Setup.MinX > Setup.MaxX || Setup.MinY > Setup.MaxY)
+			return false;
+
+		// Positive on the inner side of each edge for both windings
+		double const Sign = Area > 0.0 ? 1.0 : -1.0;
+		for(int i = 0; i < 3; ++i)
+		{
+			int const j = (i + 1) % 3;
+			double const A = (y[i] - y[j]) * Sign;
+			double const B = (x[j] - x[i]) * Sign;
+			Setup.Edges[i][0] = static_cast<float>(A);
+			Setup.Edges[i][1] = static_cast<float>(B);
+			Setup.Edges[i][2] = static_cast<float>(-(A * x[i] + B * y[i]));
+		}
+
+		double const Za = (dz1 * dy2 - dz2 * dy1) / Area;
+		double const Zb = (dx1 * dz2 - dx2 * dz1) / Area;
+		Setup.Plane[0] = static_cast<float>(Za);
+		Setup.Plane[1] = static_cast<float>(Zb);
+		Setup.Plane[2] = static_cast<float>(z[0] - Za * x[0] - Zb * y[0]);
+		Setup.Nearest = static_cast<float>(std::max(z[0], std::max(z[1], z[2])));
+		return true;
+	}
+
+	// Writes the depth of the pixels [X0, X1) of the row Y covered by the triangle, X0 and X1 multiples of 8
+	GLM_FUNC_QUALIFIER void occlusion_rasterize_row(occlusion_setup const & Setup, float * Row, int X0, int X1, int Y)
+	{
+		float const py = static_cast<float>(Y) + 0.5f;
+		float const Row0 = Setup.Edges[0][1] * py + Setup.Edges[0][2];
+		float const Row1 = Setup.Edges[1][1] * py + Setup.Edges[1][2];
+		float const Row2 = Setup.Edges[2][1] * py + Setup.Edges[2][2];
+		float const RowZ = Setup.Plane[1] * py + Setup.Plane[2];
+
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			__m256 const Lane = _mm256_setr_ps(0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f);
+			__m256 const A0 = _mm256_set1_ps(Setup.Edges[0][0]);
+			__m256 const A1 = _mm256_set1_ps(Setup.Edges[1][0]);
+			__m256 const A2 = _mm256_set1_ps(Setup.Edges[2][0]);
+			__m256 const Za = _mm256_set1_ps(Setup.Plane[0]);
+			__m256 const C0 = _mm256_set1_ps(Row0);
+			__m256 const C1 = _mm256_set1_ps(Row1);
+			__m256 const C2 = _mm256_set1_ps(Row2);
+			__m256 const Zc = _mm256_set1_ps(RowZ);
+			__m256 const Nearest = _mm256_set1_ps(Setup.Nearest);
+			__m256 const Zero = _mm256_setzero_ps();
+			for(int x = X0; x < X1; x += 8)
+			{
+				__m256 const px = _mm256_add_ps(_mm256_set1_ps(static_cast<float>(x)), Lane);
+				__m256 const e0 = _mm256_add_ps(_mm256_mul_ps(A0, px), C0);
+				__m256 const e1 = _mm256_add_ps(_mm256_mul_ps(A1, px), C1);
+				__m256 const e2 = _mm256_add_ps(_mm256_mul_ps(A2, px), C2);
+				__m256 const Mask = _mm256_and_ps(_mm256_and_ps(
+					_mm256_cmp_ps(e0, Zero, _CMP_GE_OQ),
+					_mm256_cmp_ps(e1, Zero, _CMP_GE_OQ)),
+					_mm256_cmp_ps(e2, Zero, _CMP_GE_OQ));
+				if(_mm256_movemask_ps(Mask) == 0)
+					continue;
+				__m256 const z = _mm256_min_ps(_mm256_add_ps(_mm256_mul_ps(Za, px), Zc), Nearest);
+				__m256 const Depth = _mm256_loadu_ps(Row + x);
+				_mm256_storeu_ps(Row + x, _mm256_blendv_ps(Depth, _mm256_max_ps(Depth, z), Mask));
+			}
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			__m128 const Lane = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+			__m128 const A0 = _mm_set1_ps(Setup.Edges[0][0]);
+			__m128 const A1 = _mm_set1_ps(Setup.Edges[1][0]);
+			__m128 const A2 = _mm_set1_ps(Setup.Edges[2][0]);
+			__m128 const Za = _mm_set1_ps(Setup.Plane[0]);
+			__m128 const C0 = _mm_set1_ps(Row0);
+			__m128 const C1 = _mm_set1_ps(Row1);
+			__m128 const C2 = _mm_set1_ps(Row2);
+			__m128 const Zc = _mm_set1_ps(RowZ);
+			__m128 const Nearest = _mm_set1_ps(Setup.Nearest);
+			__m128 const Zero = _mm_setzero_ps();
+			for(int x = X0; x < X1; x += 4)
+			{
+				__m128 const px = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), Lane);
+				__m128 const e0 = _mm_add_ps(_mm_mul_ps(A0, px), C0);
+				__m128 const e1 = _mm_add_ps(_mm_mul_ps(A1, px), C1);
+				__m128 const e2 = _mm_add_ps(_mm_mul_ps(A2, px), C2);
+				__m128 const Mask = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(e0, Zero), _mm_cmpge_ps(e1, Zero)), _mm_cmpge_ps(e2, Zero));
+				if(_mm_movemask_ps(Mask) == 0)
+					continue;
+				__m128 const z = _mm_min_ps(_mm_add_ps(_mm_mul_ps(Za, px), Zc), Nearest);
+				__m128 const Depth = _mm_loadu_ps(Row + x);
+				_mm_storeu_ps(Row + x, _mm_or_ps(_mm_and_ps(Mask, _mm_max_ps(Depth, z)), _mm_andnot_ps(Mask, Depth)));
+			}
+#		else
+			for(int x = X0; x < X1; ++x)
+			{
+				float const px = static_cast<float>(x) + 0.5f;
+				if(Setup.Edges[0][0] * px + Row0 >= 0.0f && Setup.Edges[1][0] * px + Row1 >= 0.0f && Setup.Edges[2][0] * px + Row2 >= 0.0f)
+				{
+					float const z = min(Setup.Plane[0] * px + RowZ, Setup.Nearest);
+					Row[x] = max(Row[x], z);
+				}
+			}
+#		endif
+	}
+
+	// Return true if a pixel of [X0, X1] of Row is not nearer than Nearest
+	GLM_FUNC_QUALIFIER bool occlusion_row_visible(float const * Row, int X0, int X1, float Nearest)
+	{
+		int x = X0;
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			__m256 const Reference = _mm256_set1_ps(Nearest);
+			for(; x + 8 <= X1 + 1; x += 8)
+				if(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(Row + x), Reference, _CMP_LE_OQ)) != 0)
+					return true;
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			__m128 const Reference = _mm_set1_ps(Nearest);
+			for(; x + 4 <= X1 + 1; x += 4)
+				if(_mm_movemask_ps(_mm_cmple_ps(_mm_loadu_ps(Row + x), Reference)) != 0)
+					return true;
+#		endif
+		for(; x <= X1; ++x)
+			if(Row[x] <= Nearest)
+				return true;
+		return false;
+	}
+
+	struct compute_occlusion_transform
+	{
+		mat4 const * Matrix;
+		vec3 const * Positions;
+		vec4 * Clip;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+#			if GLM_ARCH & GLM_ARCH_SSE2_BIT
+				__m128 const Column0 = _mm_loadu_ps(&(*Matrix)[0][0]);
+				__m128 const Column1 = _mm_loadu_ps(&(*Matrix)[1][0]);
+				__m128 const Column2 = _mm_loadu_ps(&(*Matrix)[2][0]);
+				__m128 const Column3 = _mm_loadu_ps(&(*Matrix)[3][0]);
+				for(std::size_t i = Begin; i < End; ++i)
+				{
+					vec3 const & p = Positions[i];
+					__m128 const Result = _mm_add_ps(
+						_mm_add_ps(_mm_mul_ps(Column0, _mm_set1_ps(p.x)), _mm_mul_ps(Column1, _mm_set1_ps(p.y))),
+						_mm_add_ps(_mm_mul_ps(Column2, _mm_set1_ps(p.z)), Column3));
+					_mm_storeu_ps(&Clip[i][0], Result);
+				}
+#			else
+				for(std::size_t i = Begin; i < End; ++i)
+					Clip[i] = (*Matrix)[0] * Positions[i].x + (*Matrix)[1] * Positions[i].y + (*Matrix)[2] * Positions[i].z + (*Matrix)[3];
+#			endif
+		}
+	};
+
+	// Sets up triangles and appends the visible ones to the bins of the tiles they overlap, one set of bins per job
+	struct compute_occlusion_setup
+	{
+		vec4 const * Clip;
+		uint const * Indices;
+		occlusion_setup * Setups;
+		std::vector<uint> * Bins;
+		std::size_t Tiles;
+		std::size_t TilesX;
+		int Width;
+		int Height;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t Begin, std::size_t End, std::size_t Job) const
+		{
+			std::vector<uint> * JobBins = Bins + Job * Tiles;
+			for(std::size_t i = Begin; i < End; ++i)
+			{
+				vec4 const * Vertices[3] = {Clip + Indices[i * 3 + 0], Clip + Indices[i * 3 + 1], Clip + Indices[i * 3 + 2]};
+				occlusion_setup & Setup = Setups[i];
+				if(!occlusion_setup_triangle(Vertices, Width, Height, Setup))
+					continue;
+
+				int const TileX0 = Setup.MinX / occlusion_tile_width;
+				int const TileX1 = Setup.MaxX / occlusion_tile_width;
+				int const TileY0 = Setup.MinY / occlusion_tile_height;
+				int const TileY1 = Setup.MaxY / occlusion_tile_height;
+				for(int y = TileY0; y <= TileY1; ++y)
+				for(int x = TileX0; x <= TileX1; ++x)
+					JobBins[static_cast<std::size_t>(y) * TilesX + static_cast<std::size_t>(x)].push_back(static_cast<uint>(i));
+			}
+		}
+	};
+
+	// Rasterizes the triangles binned in each tile, then updates the hierarchical depth of the tile
+	struct compute_occlusion_tiles
+	{
+		occlusion_buffer * Buffer;
+		std::size_t Jobs;
+		std::size_t Tiles;
+		std::size_t TilesX;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			int const Width = static_cast<int>(Buffer->Width);
+			int const Height = static_cast<int>(Buffer->Height);
+			float * const Depth = &Buffer->Depth[0];
+
+			for(std::size_t Tile = Begin; Tile < End; ++Tile)
+			{
+				int const TileX0 = static_cast<int>(Tile % TilesX) * occlusion_tile_width;
+				int const TileY0 = static_cast<int>(Tile / TilesX) * occlusion_tile_height;
+				int const TileX1 = std::min(TileX0 + occlusion_tile_width, Width);
+				int const TileY1 = std::min(TileY0 + occlusion_tile_height, Height);
+
+				bool Empty = true;
+				for(std::size_t Job = 0; Job < Jobs; ++Job)
+				{
+					std::vector<uint> const & Bin = Buffer->Bins[Job * Tiles + Tile];
+					for(std::size_t i = 0; i < Bin.size(); ++i)
+					{
+						occlusion_setup const & Setup = Buffer->Setups[Bin[i]];
+						int const X0 = std::max(Setup.MinX, TileX0) & ~7;
+						int const X1 = std::min((Setup.MaxX + 8) & ~7, TileX1);
+						int const Y0 = std::max(Setup.MinY, TileY0);
+						int const Y1 = std::min(Setup.MaxY + 1, TileY1);
+						for(int y = Y0; y < Y1; ++y)
+							occlusion_rasterize_row(Setup, Depth + static_cast<std::size_t>(y) * Buffer->Width, X0, X1, y);
+					}
+					Empty = Empty && Bin.empty();
+				}
+				if(Empty)
+					continue;
+
+				std::size_t const BlocksX = Buffer->Width / occlusion_block_size;
+				for(int by = TileY0; by < TileY1; by += occlusion_block_size)
+				for(int bx = TileX0; bx < TileX1; bx += occlusion_block_size)
+				{
+					float Farthest = Depth[static_cast<std::size_t>(by) * Buffer->Width + static_cast<std::size_t>(bx)];
+					for(int y = by; y < by + occlusion_block_size; ++y)
+					for(int x = bx; x < bx + occlusion_block_size; ++x)
+						Farthest = min(Farthest, Depth[static_cast<std::size_t>(y) * Buffer->Width + static_cast<std::size_t>(x)]);
+					Buffer->HiZ[static_cast<std::size_t>(by / occlusion_block_size) * BlocksX + static_cast<std::size_t>(bx / occlusion_block_size)] = Farthest;
+				}
+			}
+		}
+	};
+
+	GLM_FUNC_QUALIFIER bool occlusion_visible(occlusion_buffer const & Buffer, mat4 const & Matrix, vec3 const & Min, vec3 const & Max)
+	{
+		// Corners as sums of the columns scaled by the bounds
+		vec4 const X[2] = {Matrix[0] * Min.x, Matrix[0] * Max.x};
+		vec4 const Y[2] = {Matrix[1] * Min.y, Matrix[1] * Max.y};
+		vec4 const Z[2] = {Matrix[2] * Min.z + Matrix[3], Matrix[2] * Max.z + Matrix[3]};
+
+		float const Width = static_cast<float>(Buffer.Width);
+		float const Height = static_cast<float>(Buffer.Height);
+		vec2 Lower(std::numeric_limits<float>::max());
+		vec2 Upper(-std::numeric_limits<float>::max());
+		float Nearest = 0.0f;
+		for(int i = 0; i < 8; ++i)
+		{
+			vec4 const Corner = X[i & 1] + Y[(i >> 1) & 1] + Z[i >> 2];
+			if(!(Corner.w >= occlusion_near_w))
+				return true;
+			float const InvW = 1.0f / Corner.w;
+			vec2 const Window((Corner.x * InvW * 0.5f + 0.5f) * Width, (Corner.y * InvW * 0.5f + 0.5f) * Height);
+			Lower = min(Lower, Window);
+			Upper = max(Upper, Window);
+			Nearest = max(Nearest, InvW);
+		}
+
+		// Pixels overlapped by the bounds of the projected box
+		int const X0 = occlusion_clamp(std::floor(static_cast<double>(Lower.x)), 0, static_cast<int>(Buffer.Width));
+		int const X1 = occlusion_clamp(std::ceil(static_cast<double>(Upper.x)) - 1.0, -1, static_cast<int>(Buffer.Width) - 1);
+		int const Y0 = occlusion_clamp(std::floor(static_cast<double>(Lower.y)), 0, static_cast<int>(Buffer.Height));
+		int const Y1 = occlusion_clamp(std::ceil(static_cast<double>(Upper.y)) - 1.0, -1, static_cast<int>(Buffer.Height) - 1);
+		if(X0 > X1 || Y0 > Y1)
+			return false;
+
+		std::size_t const BlocksX = Buffer.Width / occlusion_block_size;
+		for(int by = Y0 / occlusion_block_size; by <= Y1 / occlusion_block_size; ++by)
+		for(int bx = X0 / occlusion_block_size; bx <= X1 / occlusion_block_size; ++bx)
+		{
+			if(Buffer.HiZ[static_cast<std::size_t>(by) * BlocksX + static_cast<std::size_t>(bx)] > Nearest)
+				continue;
+
+			int const BlockX0 = std::max(X0, bx * occlusion_block_size);
+			int const BlockX1 = std::min(X1, bx * occlusion_block_size + occlusion_block_size - 1);
+			int const BlockY0 = std::max(Y0, by * occlusion_block_size);
+			int const BlockY1 = std::min(Y1, by * occlusion_block_size + occlusion_block_size - 1);
+			for(int y = BlockY0; y <= BlockY1; ++y)
+				if(occlusion_row_visible(&Buffer.Depth[static_cast<std::size_t>(y) * Buffer.Width], BlockX0, BlockX1, Nearest))
+					return true;
+		}
+		return false;
+	}
+
+	struct compute_occlusion_queries
+	{
+		occlusion_buffer const * Buffer;
+		mat4 const * Matrix;
+		vec3 const * Mins;
+		vec3 const * Maxs;
+		bool * Visible;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			for(std::size_t i = Begin; i < End; ++i)
+				Visible[i] = occlusion_visible(*Buffer, *Matrix, Mins[i], Maxs[i]);
+		}
+	};
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER occlusion_buffer::occlusion_buffer(std::size_t Width, std::size_t Height) :
+		Width((Width + 7) & ~static_cast<std::size_t>(7)),
+		Height((Height + 7) & ~static_cast<std::size_t>(7))
+	{
+		clearOcclusion(*this);
+	}
+
+	GLM_FUNC_QUALIFIER void clearOcclusion(occlusion_buffer & Buffer)
+	{
+		Buffer.Depth.assign(Buffer.Width * Buffer.Height, 0.0f);
+		Buffer.HiZ.assign(Buffer.Width * Buffer.Height / (detail::occlusion_block_size * detail::occlusion_block_size), 0.0f);
+	}
+
+	GLM_FUNC_QUALIFIER void rasterizeOccluders
+	(
+		occlusion_buffer & Buffer,
+		mat4 const & ModelViewProjection,
+		vec3 const * Positions,
+		std::size_t VertexCount,
+		uint const * Indices,
+		std::size_t TriangleCount
+	)
+	{
+		if(VertexCount == 0 || TriangleCount == 0 || Buffer.Depth.empty())
+			return;
+
+		Buffer.Clip.resize(VertexCount);
+		detail::compute_occlusion_transform Transform = {&ModelViewProjection, Positions, &Buffer.Clip[0]};
+		detail::parallel_for(VertexCount, 16384, Transform);
+
+		std::size_t const TilesX = detail::occlusion_tiles_x(Buffer);
+		std::size_t const Tiles = TilesX * detail::occlusion_tiles_y(Buffer);
+		std::size_t const Grain = 4096;
+		std::size_t const Jobs = detail::parallel_jobs(TriangleCount, Grain);
+		if(Buffer.Bins.size() < Jobs * Tiles)
+			Buffer.Bins.resize(Jobs * Tiles);
+		for(std::size_t i = 0; i < Jobs * Tiles; ++i)
+			Buffer.Bins[i].clear();
+		Buffer.Setups.resize(TriangleCount);
+
+		detail::compute_occlusion_setup Setup = {&Buffer.Clip[0], Indices, &Buffer.Setups[0], &Buffer.Bins[0], Tiles, TilesX,
+			static_cast<int>(Buffer.Width), static_cast<int>(Buffer.Height)};
+		detail::parallel_for(TriangleCount, Grain, Setup);
+
+		detail::compute_occlusion_tiles Rasterize = {&Buffer, Jobs, Tiles, TilesX};
+		detail::parallel_for(Tiles, 1, Rasterize);
+	}
+
+	GLM_FUNC_QUALIFIER bool isVisible(occlusion_buffer const & Buffer, mat4 const & ModelViewProjection, vec3 const & Min, vec3 const & Max)
+	{
+		return detail::occlusion_visible(Buffer, ModelViewProjection, Min, Max);
+	}
+
+	GLM_FUNC_QUALIFIER void isVisible
+	(
+		occlusion_buffer const & Buffer,
+		mat4 const & ModelViewProjection,
+		vec3 const * Mins,
+		vec3 const * Maxs,
+		std::size_t Count,
+		bool * Visible
+	)
+	{
+		detail::compute_occlusion_queries Queries = {&Buffer, &ModelViewProjection, Mins, Maxs, Visible};
+		detail::parallel_for(Count, 4096, Queries);
+	}
+}//namespace glm
@@ -0,0 +1,134 @@
+/// @ref gtx_particles
+/// @file glm/gtx/particles.hpp
+///
+/// @see core (dependence)
+/// @see gtx_allocator (dependence)
+///
+/// @defgroup gtx_particles GLM_GTX_particles
+/// @ingroup gtx
+///
+/// @brief Particle emitters stored as structures of aligned arrays, updated with SIMD passes on several threads.
+///
+/// Each emitter keeps positions, velocities, colors, ages and lifetimes of its particles in separate arrays of
+/// floats aligned on 32 bytes and padded to multiples of 8, so that every pass loads whole AVX registers.
+/// A frame emits particles at the rate of each emitter with SSE2 xorshift generators, integrates gravity and drag
+/// and collides with planes in one AVX or SSE2 pass, then removes expired particles by moving the last particle
+/// in their place. Emitters are updated in parallel. Vertices are written as positions and packUnorm4x8 colors.
+///
+/// <glm/gtx/particles.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "allocator.hpp"
+#include <cstddef>
+#include <vector>
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_particles extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_particles
+	/// @{
+
+	/// Array of one attribute of the particles of an emitter.
+	/// @see gtx_particles
+	typedef std::vector<float, aligned_allocator<float, 32> > particle_array;
+
+	/// Particles of an emitter, the first Count elements of each array, and the parameters of new particles.
+	/// @see gtx_particles
+	struct particle_emitter
+	{
+		/// Arrays hold Capacity particles rounded up to a multiple of 8. Seed initializes the random generators.
+		GLM_FUNC_DECL explicit particle_emitter(std::size_t Capacity = 0, uint Seed = 1);
+
+		/// New particles are at Origin plus up to Extent in each axis, move at Velocity plus up to VelocitySpread,
+		/// live Lifetime plus or minus LifetimeSpread seconds and have the color Color.
+		vec3 Origin;
+		vec3 Extent;
+		vec3 Velocity;
+		vec3 VelocitySpread;
+		vec4 Color;
+		float Lifetime;
+		float LifetimeSpread;
+
+		/// Particles emitted per second by updateParticles, and the fraction of particle left from previous frames
+		float Rate;
+		float Accumulator;
+
+		std::size_t Capacity;
+		std::size_t Count;
+
+		particle_array PositionX, PositionY, PositionZ;
+		particle_array VelocityX, VelocityY, VelocityZ;
+		particle_array ColorR, ColorG, ColorB, ColorA;
+		particle_array Age;
+		particle_array Life;
+
+		/// States of the four xorshift generators of emitParticles
+		uint Random[4];
+	};
+
+	/// Emitters and the forces and colliders acting on all of them.
+	/// @see gtx_particles
+	struct particle_system
+	{
+		/// Gravity of (0, -9.81, 0), no drag, no plane and a restitution of 0.5.
+		GLM_FUNC_DECL particle_system();
+
+		std::vector<particle_emitter> Emitters;
+
+		/// Acceleration of all particles
+		vec3 Gravity;
+
+		/// Fraction of velocity lost per second
+		float Drag;
+
+		/// Particles stay on the side of each plane where dot(vec3(Plane), Position) + Plane.w >= 0
+		std::vector<vec4> Planes;
+
+		/// Fraction of the normal velocity kept by particles bouncing on a plane
+		float Restitution;
+	};
+
+	/// Vertex of a particle: position, and color packed by packUnorm4x8 with an alpha fading out with age.
+	/// @see gtx_particles
+	struct particle_vertex
+	{
+		vec3 Position;
+		uint Color;
+	};
+
+	/// Appends up to Count new particles, as many as Capacity allows, return the number of particles added.
+	/// @see gtx_particles
+	GLM_FUNC_DECL std::size_t emitParticles(particle_emitter & Emitter, std::size_t Count);
+
+	/// Ages the particles of Emitter by DeltaTime, applies the gravity and drag of System, moves them and bounces them on its planes.
+	/// @see gtx_particles
+	GLM_FUNC_DECL void integrateParticles(particle_system const & System, particle_emitter & Emitter, float DeltaTime);
+
+	/// Removes the particles whose age reached their lifetime, replacing each by the last particle.
+	/// Return the number of particles removed.
+	/// @see gtx_particles
+	GLM_FUNC_DECL std::size_t killParticles(particle_emitter & Emitter);
+
+	/// Emits, integrates and kills the particles of all emitters, emitters in parallel.
+	/// @see gtx_particles
+	GLM_FUNC_DECL void updateParticles(particle_system & System, float DeltaTime);
+
+	/// Number of particles of all emitters.
+	/// @see gtx_particles
+	GLM_FUNC_DECL std::size_t particleCount(particle_system const & System);
+
+	/// Writes the particles of all emitters, emitter after emitter, return the number of vertices written.
+	/// Vertices must have room for particleCount(System) elements.
+	/// @see gtx_particles
+	GLM_FUNC_DECL std::size_t writeParticleVertices(particle_system const & System, particle_vertex * Vertices);
+
+	/// @}
+}//namespace glm
+
+#include "particles.inl"
@@ -0,0 +1,425 @@
+/// @ref gtx_particles
+/// @file glm/gtx/particles.inl
+
+#include "../detail/_parallel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace glm{
+namespace detail
+{
+	GLM_FUNC_QUALIFIER std::size_t particle_padding(std::size_t Count)
+	{
+		return (Count + 7) & ~static_cast<std::size_t>(7);
+	}
+
+	GLM_FUNC_QUALIFIER uint particle_seed(uint x)
+	{
+		x ^= x >> 16;
+		x *= 0x7feb352du;
+		x ^= x >> 15;
+		x *= 0x846ca68bu;
+		x ^= x >> 16;
+		return x != 0 ? x : 1;
+	}
+
+	// Xorshift step, and a float of [-1, 1) made of the 23 high bits of the state
+	GLM_FUNC_QUALIFIER float particle_random(uint & State)
+	{
+		State ^= State << 13;
+		State ^= State >> 17;
+		State ^= State << 5;
+		uint const Bits = (State >> 9) | 0x3f800000u;
+		float One;
+		std::memcpy(&One, &Bits, sizeof(One));
+		return One * 2.0f - 3.0f;
+	}
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		GLM_FUNC_QUALIFIER __m128 particle_random(__m128i & State)
+		{
+			State = _mm_xor_si128(State, _mm_slli_epi32(State, 13));
+			State = _mm_xor_si128(State, _mm_srli_epi32(State, 17));
+			State = _mm_xor_si128(State, _mm_slli_epi32(State, 5));
+			__m128 const One = _mm_castsi128_ps(_mm_or_si128(_mm_srli_epi32(State, 9), _mm_set1_epi32(0x3f800000)));
+			return _mm_sub_ps(_mm_mul_ps(One, _mm_set1_ps(2.0f)), _mm_set1_ps(3.0f));
+		}
+
+		// Stores the lanes of Value below Count
+		GLM_FUNC_QUALIFIER void particle_store(float * Destination, __m128 Value, std::size_t Count)
+		{
+			if(Count >= 4)
+			{
+				_mm_storeu_ps(Destination, Value);
+				return;
+			}
+			float Lanes[4];
+			_mm_storeu_ps(Lanes, Value);
+			for(std::size_t i = 0; i < Count; ++i)
+				Destination[i] = Lanes[i];
+		}
+#	endif
+
+	GLM_FUNC_QUALIFIER void particle_move(particle_emitter & Emitter, std::size_t From, std::size_t To)
+	{
+		Emitter.PositionX[To] = Emitter.PositionX[From];
+		Emitter.PositionY[To] = Emitter.PositionY[From];
+		Emitter.PositionZ[To] = Emitter.PositionZ[From];
+		Emitter.VelocityX[To] = Emitter.VelocityX[From];
+		Emitter.VelocityY[To] = Emitter.VelocityY[From];
+		Emitter.VelocityZ[To] = Emitter.VelocityZ[From];
+		Emitter.ColorR[To] = Emitter.ColorR[From];
+		Emitter.ColorG[To] = Emitter.ColorG[From];
+		Emitter.ColorB[To] = Emitter.ColorB[From];
+		Emitter.ColorA[To] = Emitter.ColorA[From];
+		Emitter.Age[To] = Emitter.Age[From];
+		Emitter.Life[To] = Emitter.Life[From];
+	}
+
+	// Emits by rate, integrates and kills the particles of each emitter
+	struct compute_particle_update
+	{
+		particle_system * System;
+		float DeltaTime;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t Index, std::size_t) const
+		{
+			particle_emitter & Emitter = System->Emitters[Index];
+			Emitter.Accumulator += Emitter.Rate * DeltaTime;
+			float const Count = std::floor(Emitter.Accumulator);
+			Emitter.Accumulator -= Count;
+			emitParticles(Emitter, static_cast<std::size_t>(Count));
+			integrateParticles(*System, Emitter, DeltaTime);
+			killParticles(Emitter);
+		}
+	};
+
+	// Writes the vertices of each emitter at its offset
+	struct compute_particle_vertices
+	{
+		particle_system const * System;
+		std::size_t const * Offsets;
+		particle_vertex * Vertices;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t Index, std::size_t) const
+		{
+			particle_emitter const & Emitter = System->Emitters[Index];
+			particle_vertex * Destination = Vertices + Offsets[Index];
+			std::size_t i = 0;
+
+#			if GLM_ARCH & GLM_ARCH_SSE2_BIT
+				__m128 const Zero = _mm_setzero_ps();
+				__m128 const One = _mm_set1_ps(1.0f);
+				__m128 const Scale = _mm_set1_ps(255.0f);
+				__m128 const Half = _mm_set1_ps(0.5f);
+				for(; i + 4 <= Emitter.Count; i += 4)
+				{
+					__m128 const Age = _mm_load_ps(&Emitter.Age[i]);
+					__m128 const Life = _mm_load_ps(&Emitter.Life[i]);
+					__m128 const Fade = _mm_and_ps(_mm_cmplt_ps(Age, Life), _mm_sub_ps(One, _mm_div_ps(Age, Life)));
+					__m128 const Channels[4] = {
+						_mm_load_ps(&Emitter.ColorR[i]),
+						_mm_load_ps(&Emitter.ColorG[i]),
+						_mm_load_ps(&Emitter.ColorB[i]),
+						_mm_mul_ps(_mm_load_ps(&Emitter.ColorA[i]), Fade)};
+
+					// round(clamp(c, 0, 1) * 255) of packUnorm4x8, the lowest byte holding red. Adding 0.5 before
+					// truncating would round up the float just below 0.5, so the exact fraction is compared instead.
+					__m128i Color = _mm_setzero_si128();
+					for(int c = 0; c < 4; ++c)
+					{
+						__m128 const Scaled = _mm_mul_ps(_mm_max_ps(_mm_min_ps(Channels[c], One), Zero), Scale);
+						__m128i const Integer = _mm_cvttps_epi32(Scaled);
+						__m128 const Fraction = _mm_sub_ps(Scaled, _mm_cvtepi32_ps(Integer));
+						__m128i const Byte = _mm_sub_epi32(Integer, _mm_castps_si128(_mm_cmpge_ps(Fraction, Half)));
+						Color = _mm_or_si128(Color, _mm_slli_epi32(Byte, c * 8));
+					}
+
+					__m128 x = _mm_load_ps(&Emitter.PositionX[i]);
+					__m128 y = _mm_load_ps(&Emitter.PositionY[i]);
+					__m128 z = _mm_load_ps(&Emitter.PositionZ[i]);
+					__m128 w = _mm_castsi128_ps(Color);
+					_MM_TRANSPOSE4_PS(x, y, z, w);
+					_mm_storeu_ps(&Destination[i + 0].Position.x, x);
+					_mm_storeu_ps(&Destination[i + 1].Position.x, y);
+					_mm_storeu_ps(&Destination[i + 2].Position.x, z);
+					_mm_storeu_ps(&Destination[i + 3].Position.x, w);
+				}
+#			endif
+
+			for(; i < Emitter.Count; ++i)
+			{
+				float const Fade = Emitter.Age[i] < Emitter.Life[i] ? 1.0f - Emitter.Age[i] / Emitter.Life[i] : 0.0f;
+				Destination[i].Position = vec3(Emitter.PositionX[i], Emitter.PositionY[i], Emitter.PositionZ[i]);
+				Destination[i].Color = packUnorm4x8(vec4(Emitter.ColorR[i], Emitter.ColorG[i], Emitter.ColorB[i], Emitter.ColorA[i] * Fade));
+			}
+		}
+	};
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER particle_emitter::particle_emitter(std::size_t Capacity, uint Seed) :
+		Origin(0.0f),
+		Extent(0.0f),
+		Velocity(0.0f),
+		VelocitySpread(0.0f),
+		Color(1.0f),
+		Lifetime(1.0f),
+		LifetimeSpread(0.0f),
+		Rate(0.0f),
+		Accumulator(0.0f),
+		Capacity(Capacity),
+		Count(0),
+		PositionX(detail::particle_padding(Capacity), 0.0f),
+		PositionY(detail::particle_padding(Capacity), 0.0f),
+		PositionZ(detail::particle_padding(Capacity), 0.0f),
+		VelocityX(detail::particle_padding(Capacity), 0.0f),
+		VelocityY(detail::particle_padding(Capacity), 0.0f),
+		VelocityZ(detail::particle_padding(Capacity), 0.0f),
+		ColorR(detail::particle_padding(Capacity), 0.0f),
+		ColorG(detail::particle_padding(Capacity), 0.0f),
+		ColorB(detail::particle_padding(Capacity), 0.0f),
+		ColorA(detail::particle_padding(Capacity), 0.0f),
+		Age(detail::particle_padding(Capacity), 0.0f),
+		Life(detail::particle_padding(Capacity), 0.0f)
+	{
+		for(uint i = 0; i < 4; ++i)
+			Random[i] = detail::particle_seed(Seed * 4u + i);
+	}
+
+	GLM_FUNC_QUALIFIER particle_system::particle_system() :
+		Gravity(0.0f, -9.81f, 0.0f),
+		Drag(0.0f),
+		Restitution(0.5f)
+	{}
+
+	GLM_FUNC_QUALIFIER std::size_t emitParticles(particle_emitter & Emitter, std::size_t Count)
+	{
+		Count = std::min(Count, Emitter.Capacity - Emitter.Count);
+		std::size_t const Begin = Emitter.Count;
+		std::size_t const End = Begin + Count;
+
+		std::fill(Emitter.ColorR.begin() + Begin, Emitter.ColorR.begin() + End, Emitter.Color.r);
+		std::fill(Emitter.ColorG.begin() + Begin, Emitter.ColorG.begin() + End, Emitter.Color.g);
+		std::fill(Emitter.ColorB.begin() + Begin, Emitter.ColorB.begin() + End, Emitter.Color.b);
+		std::fill(Emitter.ColorA.begin() + Begin, Emitter.ColorA.begin() + End, Emitter.Color.a);
+		std::fill(Emitter.Age.begin() + Begin, Emitter.Age.begin() + End, 0.0f);
+
+		// Each block of 4 particles draws from the 4 generators, the same numbers with or without SSE2
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			__m128i State = _mm_loadu_si128(reinterpret_cast<__m128i const *>(Emitter.Random));
+			for(std::size_t i = Begin; i < End; i += 4)
+			{
+				std::size_t const Lanes = End - i;
+				detail::particle_store(&Emitter.PositionX[i], _mm_add_ps(_mm_set1_ps(Emitter.Origin.x), _mm_mul_ps(detail::particle_random(State), _mm_set1_ps(Emitter.Extent.x))), Lanes);
+				detail::particle_store(&Emitter.PositionY[i], _mm_add_ps(_mm_set1_ps(Emitter.Origin.y), _mm_mul_ps(detail::particle_random(State), _mm_set1_ps(Emitter.Extent.y))), Lanes);
+				detail::particle_store(&Emitter.PositionZ[i], _mm_add_ps(_mm_set1_ps(Emitter.Origin.z), _mm_mul_ps(detail::particle_random(State), _mm_set1_ps(Emitter.Extent.z))), Lanes);
+				detail::particle_store(&Emitter.VelocityX[i], _mm_add_ps(_mm_set1_ps(Emitter.Velocity.x), _mm_mul_ps(detail::particle_random(State), _mm_set1_ps(Emitter.VelocitySpread.x))), Lanes);
+				detail::particle_store(&Emitter.VelocityY[i], _mm_add_ps(_mm_set1_ps(Emitter.Velocity.y), _mm_mul_ps(detail::particle_random(State), _mm_set1_ps(Emitter.VelocitySpread.y))), Lanes);
+				detail::particle_store(&Emitter.VelocityZ[i], _mm_add_ps(_mm_set1_ps(Emitter.Velocity.z), _mm_mul_ps(detail::particle_random(State), _mm_set1_ps(Emitter.VelocitySpread.z))), Lanes);
+				detail::particle_store(&Emitter.Life[i], _mm_add_ps(_mm_set1_ps(Emitter.Lifetime), _mm_mul_ps(detail::particle_random(State), _mm_set1_ps(Emitter.LifetimeSpread))), Lanes);
+			}
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(Emitter.Random), State);
+#		else
+			for(std::size_t i = Begin; i < End; i += 4)
+			for(std::size_t Lane = 0; Lane < 4; ++Lane)
+			{
+				uint & State = Emitter.Random[Lane];
+				float const Values[7] = {
+					Emitter.Origin.x + detail::particle_random(State) * Emitter.Extent.x,
+					Emitter.Origin.y + detail::particle_random(State) * Emitter.Extent.y,
+					Emitter.Origin.z + detail::particle_random(State) * Emitter.Extent.z,
+					Emitter.Velocity.x + detail::particle_random(State) * Emitter.VelocitySpread.x,
+					Emitter.Velocity.y + detail::particle_random(State) * Emitter.VelocitySpread.y,
+					Emitter.Velocity.z + detail::particle_random(State) * Emitter.VelocitySpread.z,
+					Emitter.Lifetime + detail::particle_random(State) * Emitter.LifetimeSpread};
+				if(i + Lane >= End)
+					continue;
+				Emitter.PositionX[i + Lane] = Values[0];
+				Emitter.PositionY[i + Lane] = Values[1];
+				Emitter.PositionZ[i + Lane] = Values[2];
+				Emitter.VelocityX[i + Lane] = Values[3];
+				Emitter.VelocityY[i + Lane] = Values[4];
+				Emitter.VelocityZ[i + Lane] = Values[5];
+				Emitter.Life[i + Lane] = Values[6];
+			}
+#		endif
+
+		Emitter.Count = End;
+		return Count;
+	}
+
+	GLM_FUNC_QUALIFIER void integrateParticles(particle_system const & System, particle_emitter & Emitter, float DeltaTime)
+	{
+		if(Emitter.Count == 0)
+			return;
+
+		float const Damping = max(1.0f - System.Drag * DeltaTime, 0.0f);
+		vec3 const Impulse = System.Gravity * DeltaTime;
+		float const Bounce = 1.0f + System.Restitution;
+		std::size_t i = 0;
+
+		// Lanes past Count are padding, updated with the others
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			__m256 const Zero = _mm256_setzero_ps();
+			for(; i < Emitter.Count; i += 8)
+			{
+				__m256 vx = _mm256_mul_ps(_mm256_add_ps(_mm256_load_ps(&Emitter.VelocityX[i]), _mm256_set1_ps(Impulse.x)), _mm256_set1_ps(Damping));
+				__m256 vy = _mm256_mul_ps(_mm256_add_ps(_mm256_load_ps(&Emitter.VelocityY[i]), _mm256_set1_ps(Impulse.y)), _mm256_set1_ps(Damping));
+				__m256 vz = _mm256_mul_ps(_mm256_add_ps(_mm256_load_ps(&Emitter.VelocityZ[i]), _mm256_set1_ps(Impulse.z)), _mm256_set1_ps(Damping));
+				__m256 px = _mm256_add_ps(_mm256_load_ps(&Emitter.PositionX[i]), _mm256_mul_ps(vx, _mm256_set1_ps(DeltaTime)));
+				__m256 py = _mm256_add_ps(_mm256_load_ps(&Emitter.PositionY[i]), _mm256_mul_ps(vy, _mm256_set1_ps(DeltaTime)));
+				__m256 pz = _mm256_add_ps(_mm256_load_ps(&Emitter.PositionZ[i]), _mm256_mul_ps(vz, _mm256_set1_ps(DeltaTime)));
+
+				for(std::size_t p = 0; p < System.Planes.size(); ++p)
+				{
+					vec4 const & Plane = System.Planes[p];
+					__m256 const nx = _mm256_set1_ps(Plane.x), ny = _mm256_set1_ps(Plane.y), nz = _mm256_set1_ps(Plane.z);
+					__m256 const Distance = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(nx, px), _mm256_mul_ps(ny, py)), _mm256_mul_ps(nz, pz)), _mm256_set1_ps(Plane.w));
+					__m256 const Below = _mm256_cmp_ps(Distance, Zero, _CMP_LT_OQ);
+					__m256 const Depth = _mm256_and_ps(Below, Distance);
+					px = _mm256_sub_ps(px, _mm256_mul_ps(nx, Depth));
+					py = _mm256_sub_ps(py, _mm256_mul_ps(ny, Depth));
+					pz = _mm256_sub_ps(pz, _mm256_mul_ps(nz, Depth));
+
+					__m256 const Normal = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(nx, vx), _mm256_mul_ps(ny, vy)), _mm256_mul_ps(nz, vz));
+					__m256 const Reflect = _mm256_and_ps(_mm256_and_ps(Below, _mm256_cmp_ps(Normal, Zero, _CMP_LT_OQ)), _mm256_mul_ps(Normal, _mm256_set1_ps(Bounce)));
+					vx = _mm256_sub_ps(vx, _mm256_mul_ps(nx, Reflect));
+					vy = _mm256_sub_ps(vy, _mm256_mul_ps(ny, Reflect));
+					vz = _mm256_sub_ps(vz, _mm256_mul_ps(nz, Reflect));
+				}
+
+				_mm256_store_ps(&Emitter.PositionX[i], px);
+				_mm256_store_ps(&Emitter.PositionY[i], py);
+				_mm256_store_ps(&Emitter.PositionZ[i], pz);
+				_mm256_store_ps(&Emitter.VelocityX[i], vx);
+				_mm256_store_ps(&Emitter.VelocityY[i], vy);
+				_mm256_store_ps(&Emitter.VelocityZ[i], vz);
+				_mm256_store_ps(&Emitter.Age[i], _mm256_add_ps(_mm256_load_ps(&Emitter.Age[i]), _mm256_set1_ps(DeltaTime)));
+			}
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			__m128 const Zero = _mm_setzero_ps();
+			for(; i < Emitter.Count; i += 4)
+			{
+				__m128 vx = _mm_mul_ps(_mm_add_ps(_mm_load_ps(&Emitter.VelocityX[i]), _mm_set1_ps(Impulse.x)), _mm_set1_ps(Damping));
+				__m128 vy = _mm_mul_ps(_mm_add_ps(_mm_load_ps(&Emitter.VelocityY[i]), _mm_set1_ps(Impulse.y)), _mm_set1_ps(Damping));
+				__m128 vz = _mm_mul_ps(_mm_add_ps(_mm_load_ps(&Emitter.VelocityZ[i]), _mm_set1_ps(Impulse.z)), _mm_set1_ps(Damping));
+				__m128 px = _mm_add_ps(_mm_load_ps(&Emitter.PositionX[i]), _mm_mul_ps(vx, _mm_set1_ps(DeltaTime)));
+				__m128 py = _mm_add_ps(_mm_load_ps(&Emitter.PositionY[i]), _mm_mul_ps(vy, _mm_set1_ps(DeltaTime)));
+				__m128 pz = _mm_add_ps(_mm_load_ps(&Emitter.PositionZ[i]), _mm_mul_ps(vz, _mm_set1_ps(DeltaTime)));
+
+				for(std::size_t p = 0; p < System.Planes.size(); ++p)
+				{
+					vec4 const & Plane = System.Planes[p];
+					__m128 const nx = _mm_set1_ps(Plane.x), ny = _mm_set1_ps(Plane.y), nz = _mm_set1_ps(Plane.z);
+					__m128 const Distance = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, px), _mm_mul_ps(ny, py)), _mm_mul_ps(nz, pz)), _mm_set1_ps(Plane.w));
+					__m128 const Below = _mm_cmplt_ps(Distance, Zero);
+					__m128 const Depth = _mm_and_ps(Below, Distance);
+					px = _mm_sub_ps(px, _mm_mul_ps(nx, Depth));
+					py = _mm_sub_ps(py, _mm_mul_ps(ny, Depth));
+					pz = _mm_sub_ps(pz, _mm_mul_ps(nz, Depth));
+
+					__m128 const Normal = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, vx), _mm_mul_ps(ny, vy)), _mm_mul_ps(nz, vz));
+					__m128 const Reflect = _mm_and_ps(_mm_and_ps(Below, _mm_cmplt_ps(Normal, Zero)), _mm_mul_ps(Normal, _mm_set1_ps(Bounce)));
+					vx = _mm_sub_ps(vx, _mm_mul_ps(nx, Reflect));
+					vy = _mm_sub_ps(vy, _mm_mul_ps(ny, Reflect));
+					vz = _mm_sub_ps(vz, _mm_mul_ps(nz, Reflect));
+				}
+
+				_mm_store_ps(&Emitter.PositionX[i], px);
+				_mm_store_ps(&Emitter.PositionY[i], py);
+				_mm_store_ps(&Emitter.PositionZ[i], pz);
+				_mm_store_ps(&Emitter.VelocityX[i], vx);
+				_mm_store_ps(&Emitter.VelocityY[i], vy);
+				_mm_store_ps(&Emitter.VelocityZ[i], vz);
+				_mm_store_ps(&Emitter.Age[i], _mm_add_ps(_mm_load_ps(&Emitter.Age[i]), _mm_set1_ps(DeltaTime)));
+			}
+#		else
+			for(; i < Emitter.Count; ++i)
+			{
+				vec3 v = (vec3(Emitter.VelocityX[i], Emitter.VelocityY[i], Emitter.VelocityZ[i]) + Impulse) * Damping;
+				vec3 p = vec3(Emitter.PositionX[i], Emitter.PositionY[i], Emitter.PositionZ[i]) + v * DeltaTime;
+
+				for(std::size_t j = 0; j < System.Planes.size(); ++j)
+				{
+					vec3 const n(System.Planes[j]);
+					float const Distance = dot(n, p) + System.Planes[j].w;
+					if(Distance >= 0.0f)
+						continue;
+					p -= n * Distance;
+					float const Normal = dot(n, v);
+					if(Normal < 0.0f)
+						v -= n * (Normal * Bounce);
+				}
+
+				Emitter.PositionX[i] = p.x;
+				Emitter.PositionY[i] = p.y;
+				Emitter.PositionZ[i] = p.z;
+				Emitter.VelocityX[i] = v.x;
+				Emitter.VelocityY[i] = v.y;
+				Emitter.VelocityZ[i] = v.z;
+				Emitter.Age[i] += DeltaTime;
+			}
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t killParticles(particle_emitter & Emitter)
+	{
+		std::size_t const Count = Emitter.Count;
+
+		// Blocks without expired particles are skipped, the others are compacted one particle at a time
+		for(std::size_t Block = 0; Block < Emitter.Count; Block += 8)
+		{
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+				int Mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_load_ps(&Emitter.Age[Block]), _mm256_load_ps(&Emitter.Life[Block]), _CMP_GE_OQ));
+#			elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+				int Mask =
+					_mm_movemask_ps(_mm_cmpge_ps(_mm_load_ps(&Emitter.Age[Block]), _mm_load_ps(&Emitter.Life[Block]))) |
+					_mm_movemask_ps(_mm_cmpge_ps(_mm_load_ps(&Emitter.Age[Block + 4]), _mm_load_ps(&Emitter.Life[Block + 4]))) << 4;
+#			else
+				int Mask = 0;
+				for(std::size_t Lane = 0; Lane < 8; ++Lane)
+					Mask |= Emitter.Age[Block + Lane] >= Emitter.Life[Block + Lane] ? 1 << Lane : 0;
+#			endif
+			if(Emitter.Count - Block < 8)
+				Mask &= (1 << (Emitter.Count - Block)) - 1;
+			if(Mask == 0)
+				continue;
+
+			for(std::size_t i = Block; i < Block + 8 && i < Emitter.Count;)
+			{
+				if(Emitter.Age[i] >= Emitter.Life[i])
+					detail::particle_move(Emitter, --Emitter.Count, i);
+				else
+					++i;
+			}
+		}
+
+		return Count - Emitter.Count;
+	}
+
+	GLM_FUNC_QUALIFIER void updateParticles(particle_system & System, float DeltaTime)
+	{
+		detail::compute_particle_update Func = {&System, DeltaTime};
+		detail::parallel_dynamic(System.Emitters.size(), Func);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t particleCount(particle_system const & System)
+	{
+		std::size_t Count = 0;
+		for(std::size_t i = 0; i < System.Emitters.size(); ++i)
+			Count += System.Emitters[i].Count;
+		return Count;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t writeParticleVertices(particle_system const & System, particle_vertex * Vertices)
+	{
+		std::vector<std::size_t> Offsets(System.Emitters.size() + 1, 0);
+		for(std::size_t i = 0; i < System.Emitters.size(); ++i)
+			Offsets[i + 1] = Offsets[i] + System.Emitters[i].Count;
+
+		detail::compute_particle_vertices Func = {&System, &Offsets[0], Vertices};
+		detail::parallel_dynamic(System.Emitters.size(), Func);
+		return Offsets.back();
+	}
+}//namespace glm
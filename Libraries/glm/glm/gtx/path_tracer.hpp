@@ -0,0 +1,130 @@
+/// @ref gtx_path_tracer
+/// @file glm/gtx/path_tracer.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_path_tracer GLM_GTX_path_tracer
+/// @ingroup gtx
+///
+/// @brief Multithreaded CPU path tracer of diffuse and emissive triangles, to render reference images without a GPU.
+///
+/// Triangles are indexed by a bounding volume hierarchy built with binned surface area heuristic. Images are
+/// divided into tiles of 16x16 pixels that threads take one after the other, and each 2x2 pixels quad traces its
+/// paths as a packet of 4 rays, with SSE2 box and triangle tests. Paths sample the cosine weighted hemisphere of
+/// diffuse surfaces, sample emissive triangles at each bounce with shadow ray packets, and end by Russian roulette.
+/// Random numbers are a hash of the seed, the pixel, the sample and the bounce, so images don't depend on the
+/// number of threads or on the order of the tiles.
+///
+/// <glm/gtx/path_tracer.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+#include <vector>
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_path_tracer extension included")
+#endif
+
+namespace glm{
+namespace detail
+{
+	// Node of the hierarchy, a leaf when Count isn't 0
+	struct path_node
+	{
+		vec3 Min;
+		// First triangle of a leaf, first of the two children of an inner node
+		uint Index;
+		vec3 Max;
+		uint Count;
+		// Split axis of an inner node
+		uint Axis;
+	};
+}//namespace detail
+
+	/// @addtogroup gtx_path_tracer
+	/// @{
+
+	/// Triangles with diffuse and emissive materials, and the hierarchy built by buildPathScene.
+	/// @see gtx_path_tracer
+	struct path_scene
+	{
+		/// Input meshes
+		std::vector<vec3> Positions;
+		std::vector<uvec3> Triangles;
+		std::vector<uint> TriangleMaterials;
+
+		/// Materials: diffuse reflectance and emitted radiance
+		std::vector<vec3> Albedos;
+		std::vector<vec3> Emissions;
+
+		/// Radiance of rays leaving the scene
+		vec3 Background;
+
+		/// Hierarchy, and triangles in the order of its leaves: first vertex, edges, unit normal and material
+		std::vector<detail::path_node> Nodes;
+		std::vector<vec3> Vertices;
+		std::vector<vec3> Edges1;
+		std::vector<vec3> Edges2;
+		std::vector<vec3> Normals;
+		std::vector<uint> Materials;
+
+		/// Emissive triangles and the cumulative distribution of their power
+		std::vector<uint> Lights;
+		std::vector<float> LightCdf;
+
+		/// Offset of secondary ray origins
+		float Epsilon;
+	};
+
+	/// Settings of renderPaths.
+	/// @see gtx_path_tracer
+	struct path_settings
+	{
+		uint Width;
+		uint Height;
+		uint Samples;
+		/// Paths end after MaxBounces diffuse reflections
+		uint MaxBounces;
+		uint Seed;
+	};
+
+	/// Appends a material and returns its index.
+	/// @see gtx_path_tracer
+	GLM_FUNC_DECL uint addMaterial(path_scene & Scene, vec3 const & Albedo, vec3 const & Emission);
+
+	/// Appends the TriangleCount triangles of Indices of Positions with the material Material.
+	/// @see gtx_path_tracer
+	GLM_FUNC_DECL void addMesh(
+		path_scene & Scene,
+		vec3 const * Positions,
+		std::size_t VertexCount,
+		uint const * Indices,
+		std::size_t TriangleCount,
+		uint Material);
+
+	/// Builds the hierarchy and the light distribution, after the last addMesh call.
+	/// @see gtx_path_tracer
+	GLM_FUNC_DECL void buildPathScene(path_scene & Scene);
+
+	/// Closest intersection along a ray: Distance, and Triangle, an index of the triangles of buildPathScene.
+	/// Return false if the ray leaves the scene.
+	/// @see gtx_path_tracer
+	GLM_FUNC_DECL bool intersectPathScene(path_scene const & Scene, vec3 const & Origin, vec3 const & Direction, float & Distance, uint & Triangle);
+
+	/// Renders the scene seen through a camera of view matrix View and projection perspective(Fovy, Width / Height, ...).
+	/// Pixels receives Width * Height linear RGB radiances with an alpha of 1, from the top row to the bottom row, the layout
+	/// of a 2D RGBA32F texture level, which can be copied into a gli::texture2D as is. Return the number of rays traced.
+	/// @see gtx_path_tracer
+	GLM_FUNC_DECL std::size_t renderPaths(path_scene const & Scene, mat4 const & View, float Fovy, path_settings const & Settings, vec4 * Pixels);
+
+	/// Root mean square of the differences of the RGB channels of two images of Count pixels.
+	/// @see gtx_path_tracer
+	GLM_FUNC_DECL float imageError(vec4 const * a, vec4 const * b, std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "path_tracer.inl"
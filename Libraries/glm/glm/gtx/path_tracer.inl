@@ -0,0 +1,679 @@
+/// @ref gtx_path_tracer
+/// @file glm/gtx/path_tracer.inl
+
+#include "../gtc/constants.hpp"
+#include "../detail/_parallel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	static std::size_t const path_leaf_size = 4;
+	static std::size_t const path_bins = 16;
+	static uint const path_tile_size = 16;
+	static uint const path_balanced_depth = 48;
+	static int const path_stack_size = 128;
+	static uint const path_miss = ~static_cast<uint>(0);
+
+	GLM_FUNC_QUALIFIER uint path_hash(uint x)
+	{
+		x ^= x >> 16;
+		x *= 0x7feb352du;
+		x ^= x >> 15;
+		x *= 0x846ca68bu;
+		x ^= x >> 16;
+		return x;
+	}
+
+	// Permuted congruential generator seeded by a hash of the sample coordinates
+	struct path_random
+	{
+		uint State;
+
+		GLM_FUNC_QUALIFIER float next()
+		{
+			State = State * 747796405u + 2891336453u;
+			uint Word = ((State >> ((State >> 28u) + 4u)) ^ State) * 277803737u;
+			Word = (Word >> 22u) ^ Word;
+			return static_cast<float>(Word >> 8) * (1.0f / 16777216.0f);
+		}
+	};
+
+	GLM_FUNC_QUALIFIER int path_lowest_bit(int Mask)
+	{
+		int Bit = 0;
+		while(!(Mask & (1 << Bit)))
+			++Bit;
+		return Bit;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t path_bit_count(int Mask)
+	{
+		std::size_t Count = 0;
+		for(; Mask; Mask &= Mask - 1)
+			++Count;
+		return Count;
+	}
+
+	GLM_FUNC_QUALIFIER float path_area(vec3 const & Min, vec3 const & Max)
+	{
+		vec3 const d = Max - Min;
+		return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+	}
+
+	struct path_build_item
+	{
+		uint Node;
+		uint Begin;
+		uint End;
+		uint Depth;
+	};
+
+	struct path_centroid_less
+	{
+		vec3 const * Centroids;
+		length_t Axis;
+
+		GLM_FUNC_QUALIFIER bool operator()(uint a, uint b) const
+		{
+			return Centroids[a][Axis] < Centroids[b][Axis];
+		}
+	};
+
+	struct path_in_bin
+	{
+		vec3 const * Centroids;
+		length_t Axis;
+		float Min;
+		float Scale;
+		std::size_t Split;
+
+		GLM_FUNC_QUALIFIER std::size_t bin(uint i) const
+		{
+			return std::min(static_cast<std::size_t>(max((Centroids[i][Axis] - Min) * Scale, 0.0f)), path_bins - 1);
+		}
+
+		GLM_FUNC_QUALIFIER bool operator()(uint i) const
+		{
+			return bin(i) < Split;
+		}
+	};
+
+	// Binned surface area heuristic, with median splits below path_balanced_depth to bound the depth of the hierarchy
+	GLM_FUNC_QUALIFIER void path_build(path_scene & Scene, std::vector<uint> & Order)
+	{
+		std::size_t const Count = Scene.Triangles.size();
+		std::vector<vec3> Mins(Count), Maxs(Count), Centroids(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			uvec3 const & t = Scene.Triangles[i];
+			vec3 const & a = Scene.Positions[t.x];
+			vec3 const & b = Scene.Positions[t.y];
+			vec3 const & c = Scene.Positions[t.z];
+			Mins[i] = min(a, min(b, c));
+			Maxs[i] = max(a, max(b, c));
+			Centroids[i] = (a + b + c) * (1.0f / 3.0f);
+			Order[i] = static_cast<uint>(i);
+		}
+
+		Scene.Nodes.clear();
+		if(Count == 0)
+			return;
+		Scene.Nodes.reserve(Count * 2);
+		Scene.Nodes.push_back(path_node());
+
+		std::vector<path_build_item> Items;
+		path_build_item const Root = {0, 0, static_cast<uint>(Count), 0};
+		Items.push_back(Root);
+		while(!Items.empty())
+		{
+			path_build_item const Item = Items.back();
+			Items.pop_back();
+
+			vec3 Min(std::numeric_limits<float>::max()), Max(-std::numeric_limits<float>::max());
+			vec3 CentroidMin = Min, CentroidMax = Max;
+			for(uint i = Item.Begin; i < Item.End; ++i)
+			{
+				Min = min(Min, Mins[Order[i]]);
+				Max = max(Max, Maxs[Order[i]]);
+				CentroidMin = min(CentroidMin, Centroids[Order[i]]);
+				CentroidMax = max(CentroidMax, Centroids[Order[i]]);
+			}
+
+			path_node & Node = Scene.Nodes[Item.Node];
+			Node.Min = Min;
+			Node.Max = Max;
+			Node.Index = Item.Begin;
+			Node.Count = Item.End - Item.Begin;
+			Node.Axis = 0;
+
+			vec3 const Extent = CentroidMax - CentroidMin;
+			length_t const Axis = Extent.x > Extent.y ? (Extent.x > Extent.z ? 0 : 2) : (Extent.y > Extent.z ? 1 : 2);
+			if(Node.Count <= path_leaf_size || !(Extent[Axis] > 0.0f))
+				continue;
+
+			uint Middle = Item.Begin + Node.Count / 2;
+			path_in_bin InBin = {&Centroids[0], Axis, CentroidMin[Axis], static_cast<float>(path_bins) / Extent[Axis], 0};
+			if(Item.Depth < path_balanced_depth)
+			{
+				std::size_t BinCounts[path_bins] = {0};
+				vec3 BinMins[path_bins], BinMaxs[path_bins];
+				for(std::size_t b = 0; b < path_bins; ++b)
+				{
+					BinMins[b] = vec3(std::numeric_limits<float>::max());
+					BinMaxs[b] = vec3(-std::numeric_limits<float>::max());
+				}
+				for(uint i = Item.Begin; i < Item.End; ++i)
+				{
+					std::size_t const b = InBin.bin(Order[i]);
+					++BinCounts[b];
+					BinMins[b] = min(BinMins[b], Mins[Order[i]]);
+					BinMaxs[b] = max(BinMaxs[b], Maxs[Order[i]]);
+				}
+
+				// Areas and counts of the bins right of each split
+				float RightCosts[path_bins];
+				vec3 RightMin(std::numeric_limits<float>::max()), RightMax(-std::numeric_limits<float>::max());
+				std::size_t RightCount = 0;
+				for(std::size_t b = path_bins - 1; b > 0; --b)
+				{
+					RightMin = min(RightMin, BinMins[b]);
+					RightMax = max(RightMax, BinMaxs[b]);
+					RightCount += BinCounts[b];
+					RightCosts[b] = RightCount > 0 ? path_area(RightMin, RightMax) * static_cast<float>(RightCount) : 0.0f;
+				}
+
+				float BestCost = path_area(Min, Max) * static_cast<float>(Node.Count);
+				vec3 LeftMin(std::numeric_limits<float>::max()), LeftMax(-std::numeric_limits<float>::max());
+				std::size_t LeftCount = 0;
+				for(std::size_t b = 1; b < path_bins; ++b)
+				{
+					LeftMin = min(LeftMin, BinMins[b - 1]);
+					LeftMax = max(LeftMax, BinMaxs[b - 1]);
+					LeftCount += BinCounts[b - 1];
+					if(LeftCount == 0 || LeftCount == Node.Count)
+						continue;
+					float const Cost = path_area(LeftMin, LeftMax) * static_cast<float>(LeftCount) + RightCosts[b];
+					if(Cost < BestCost)
+					{
+						BestCost = Cost;
+						InBin.Split = b;
+					}
+				}
+
+				// A leaf is cheaper, unless it is too large
+				if(InBin.Split == 0 && Node.Count <= path_leaf_size * 4)
+					continue;
+				if(InBin.Split > 0)
+					Middle = static_cast<uint>(std::partition(Order.begin() + Item.Begin, Order.begin() + Item.End, InBin) - Order.begin());
+			}
+			if(InBin.Split == 0)
+			{
+				path_centroid_less const Less = {&Centroids[0], Axis};
+				std::nth_element(Order.begin() + Item.Begin, Order.begin() + Middle, Order.begin() + Item.End, Less);
+			}
+
+			uint const Children = static_cast<uint>(Scene.Nodes.size());
+			Node.Index = Children;
+			Node.Count = 0;
+			Node.Axis = static_cast<uint>(Axis);
+			Scene.Nodes.push_back(path_node());
+			Scene.Nodes.push_back(path_node());
+
+			path_build_item const Left = {Children, Item.Begin, Middle, Item.Depth + 1};
+			path_build_item const Right = {Children + 1, Middle, Item.End, Item.Depth + 1};
+			Items.push_back(Left);
+			Items.push_back(Right);
+		}
+	}
+
+	// Four rays as a structure of arrays, lanes in the bits of Active
+	struct path_packet
+	{
+		vec4 Origin[3];
+		vec4 Direction[3];
+		vec4 Inverse[3];
+		vec4 Distance;
+		uint Triangle[4];
+		int Active;
+	};
+
+	GLM_FUNC_QUALIFIER void path_set_ray(path_packet & Packet, int Lane, vec3 const & Origin, vec3 const & Direction, float Distance)
+	{
+		for(length_t i = 0; i < 3; ++i)
+		{
+			float const d = abs(Direction[i]) > 1e-20f ? Direction[i] : (Direction[i] < 0.0f ? -1e-20f : 1e-20f);
+			Packet.Origin[i][Lane] = Origin[i];
+			Packet.Direction[i][Lane] = Direction[i];
+			Packet.Inverse[i][Lane] = 1.0f / d;
+		}
+		Packet.Distance[Lane] = Distance;
+		Packet.Triangle[Lane] = path_miss;
+		Packet.Active |= 1 << Lane;
+	}
+
+	// Lanes of Mask whose ray enters the box before its Distance
+	GLM_FUNC_QUALIFIER int path_box(path_node const & Node, path_packet const & Packet, int Mask)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			__m128 Near = _mm_setzero_ps();
+			__m128 Far = _mm_loadu_ps(&Packet.Distance[0]);
+			for(length_t i = 0; i < 3; ++i)
+			{
+				__m128 const Origin = _mm_loadu_ps(&Packet.Origin[i][0]);
+				__m128 const Inverse = _mm_loadu_ps(&Packet.Inverse[i][0]);
+				__m128 const a = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(Node.Min[i]), Origin), Inverse);
+				__m128 const b = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(Node.Max[i]), Origin), Inverse);
+				Near = _mm_max_ps(Near, _mm_min_ps(a, b));
+				Far = _mm_min_ps(Far, _mm_max_ps(a, b));
+			}
+			return _mm_movemask_ps(_mm_cmple_ps(Near, Far)) & Mask;
+#		else
+			int Result = 0;
+			for(int Lane = 0; Lane < 4; ++Lane)
+			{
+				if(!(Mask & (1 << Lane)))
+					continue;
+				float Near = 0.0f;
+				float Far = Packet.Distance[Lane];
+				for(length_t i = 0; i < 3; ++i)
+				{
+					float const a = (Node.Min[i] - Packet.Origin[i][Lane]) * Packet.Inverse[i][Lane];
+					float const b = (Node.Max[i] - Packet.Origin[i][Lane]) * Packet.Inverse[i][Lane];
+					Near = max(Near, min(a, b));
+					Far = min(Far, max(a, b));
+				}
+				Result |= Near <= Far ? 1 << Lane : 0;
+			}
+			return Result;
+#		endif
+	}
+
+	// Moller-Trumbore intersection of the rays of Mask with a triangle, both faces, return the lanes which hit it first
+	GLM_FUNC_QUALIFIER int path_triangle(path_scene const & Scene, uint Triangle, path_packet & Packet, int Mask)
+	{
+		vec3 const & v = Scene.Vertices[Triangle];
+		vec3 const & e1 = Scene.Edges1[Triangle];
+		vec3 const & e2 = Scene.Edges2[Triangle];
+		int Hits = 0;
+
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			__m128 const Dx = _mm_loadu_ps(&Packet.Direction[0][0]);
+			__m128 const Dy = _mm_loadu_ps(&Packet.Direction[1][0]);
+			__m128 const Dz = _mm_loadu_ps(&Packet.Direction[2][0]);
+			__m128 const E1x = _mm_set1_ps(e1.x), E1y = _mm_set1_ps(e1.y), E1z = _mm_set1_ps(e1.z);
+			__m128 const E2x = _mm_set1_ps(e2.x), E2y = _mm_set1_ps(e2.y), E2z = _mm_set1_ps(e2.z);
+
+			__m128 const Px = _mm_sub_ps(_mm_mul_ps(Dy, E2z), _mm_mul_ps(Dz, E2y));
+			__m128 const Py = _mm_sub_ps(_mm_mul_ps(Dz, E2x), _mm_mul_ps(Dx, E2z));
+			__m128 const Pz = _mm_sub_ps(_mm_mul_ps(Dx, E2y), _mm_mul_ps(Dy, E2x));
+			__m128 const Determinant = _mm_add_ps(_mm_add_ps(_mm_mul_ps(E1x, Px), _mm_mul_ps(E1y, Py)), _mm_mul_ps(E1z, Pz));
+			__m128 const InvDeterminant = _mm_div_ps(_mm_set1_ps(1.0f), Determinant);
+
+			__m128 const Sx = _mm_sub_ps(_mm_loadu_ps(&Packet.Origin[0][0]), _mm_set1_ps(v.x));
+			__m128 const Sy = _mm_sub_ps(_mm_loadu_ps(&Packet.Origin[1][0]), _mm_set1_ps(v.y));
+			__m128 const Sz = _mm_sub_ps(_mm_loadu_ps(&Packet.Origin[2][0]), _mm_set1_ps(v.z));
+			__m128 const u = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(Sx, Px), _mm_mul_ps(Sy, Py)), _mm_mul_ps(Sz, Pz)), InvDeterminant);
+
+			__m128 const Qx = _mm_sub_ps(_mm_mul_ps(Sy, E1z), _mm_mul_ps(Sz, E1y));
+			__m128 const Qy = _mm_sub_ps(_mm_mul_ps(Sz, E1x), _mm_mul_ps(Sx, E1z));
+			__m128 const Qz = _mm_sub_ps(_mm_mul_ps(Sx, E1y), _mm_mul_ps(Sy, E1x));
+			__m128 const w = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(Dx, Qx), _mm_mul_ps(Dy, Qy)), _mm_mul_ps(Dz, Qz)), InvDeterminant);
+			__m128 const t = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(E2x, Qx), _mm_mul_ps(E2y, Qy)), _mm_mul_ps(E2z, Qz)), InvDeterminant);
+
+			__m128 const Zero = _mm_setzero_ps();
+			__m128 const Distance = _mm_loadu_ps(&Packet.Distance[0]);
+			__m128 const Hit = _mm_and_ps(_mm_and_ps(
+				_mm_and_ps(_mm_cmpge_ps(u, Zero), _mm_cmpge_ps(w, Zero)),
+				_mm_cmple_ps(_mm_add_ps(u, w), _mm_set1_ps(1.0f))),
+				_mm_and_ps(_mm_cmpgt_ps(t, Zero), _mm_cmplt_ps(t, Distance)));
+			Hits = _mm_movemask_ps(Hit) & Mask;
+			if(Hits == 0)
+				return 0;
+			_mm_storeu_ps(&Packet.Distance[0], _mm_or_ps(_mm_and_ps(Hit, t), _mm_andnot_ps(Hit, Distance)));
+			for(int Lane = 0; Lane < 4; ++Lane)
+				if(Hits & (1 << Lane))
+					Packet.Triangle[Lane] = Triangle;
+#		else
+			for(int Lane = 0; Lane < 4; ++Lane)
+			{
+				if(!(Mask & (1 << Lane)))
+					continue;
+				vec3 const d(Packet.Direction[0][Lane], Packet.Direction[1][Lane], Packet.Direction[2][Lane]);
+				vec3 const p = cross(d, e2);
+				float const InvDeterminant = 1.0f / dot(e1, p);
+				vec3 const s = vec3(Packet.Origin[0][Lane], Packet.Origin[1][Lane], Packet.Origin[2][Lane]) - v;
+				float const u = dot(s, p) * InvDeterminant;
+				vec3 const q = cross(s, e1);
+				float const w = dot(d, q) * InvDeterminant;
+				float const t = dot(e2, q) * InvDeterminant;
+				if(u >= 0.0f && w >= 0.0f && u + w <= 1.0f && t > 0.0f && t < Packet.Distance[Lane])
+				{
+					Packet.Distance[Lane] = t;
+					Packet.Triangle[Lane] = Triangle;
+					Hits |= 1 << Lane;
+				}
+			}
+#		endif
+
+		return Hits;
+	}
+
+	// Traverses the hierarchy nearest child first, in the order of the first active ray. With AnyHit, lanes stop
+	// at their first intersection and are removed from Active.
+	GLM_FUNC_QUALIFIER void path_traverse(path_scene const & Scene, path_packet & Packet, bool AnyHit)
+	{
+		if(Scene.Nodes.empty() || Packet.Active == 0)
+			return;
+
+		int const First = path_lowest_bit(Packet.Active);
+		uint Stack[path_stack_size];
+		int Top = 0;
+		Stack[Top++] = 0;
+		while(Top > 0 && Packet.Active)
+		{
+			path_node const & Node = Scene.Nodes[Stack[--Top]];
+			int const Mask = path_box(Node, Packet, Packet.Active);
+			if(Mask == 0)
+				continue;
+
+			if(Node.Count > 0)
+			{
+				for(uint i = Node.Index; i < Node.Index + Node.Count; ++i)
+				{
+					int const Hits = path_triangle(Scene, i, Packet, Mask & Packet.Active);
+					if(AnyHit)
+						Packet.Active &= ~Hits;
+				}
+				continue;
+			}
+
+			bool const Backward = Packet.Direction[Node.Axis][First] < 0.0f;
+			Stack[Top++] = Node.Index + (Backward ? 0 : 1);
+			Stack[Top++] = Node.Index + (Backward ? 1 : 0);
+		}
+	}
+
+	// Frame around a unit normal
+	GLM_FUNC_QUALIFIER void path_basis(vec3 const & n, vec3 & Tangent, vec3 & Bitangent)
+	{
+		float const Sign = n.z >= 0.0f ? 1.0f : -1.0f;
+		float const a = -1.0f / (Sign + n.z);
+		float const b = n.x * n.y * a;
+		Tangent = vec3(1.0f + Sign * n.x * n.x * a, Sign * b, -Sign * n.x);
+		Bitangent = vec3(b, Sign + n.y * n.y * a, -n.y);
+	}
+
+	// Traces the paths of the active lanes of Packet and adds their radiance
+	GLM_FUNC_QUALIFIER std::size_t path_trace(path_scene const & Scene, path_settings const & Settings, path_packet & Packet, path_random Random[4], vec3 Radiance[4])
+	{
+		std::size_t Rays = 0;
+		vec3 Throughput[4] = {vec3(1.0f), vec3(1.0f), vec3(1.0f), vec3(1.0f)};
+		for(uint Bounce = 0; Packet.Active; ++Bounce)
+		{
+			path_traverse(Scene, Packet, false);
+			Rays += path_bit_count(Packet.Active);
+
+			path_packet Shadow;
+			Shadow.Active = 0;
+			vec3 Direct[4];
+			int Next = 0;
+			for(int Lane = 0; Lane < 4; ++Lane)
+			{
+				if(!(Packet.Active & (1 << Lane)))
+					continue;
+
+				uint const Triangle = Packet.Triangle[Lane];
+				if(Triangle == path_miss)
+				{
+					Radiance[Lane] += Throughput[Lane] * Scene.Background;
+					continue;
+				}
+
+				vec3 const Direction(Packet.Direction[0][Lane], Packet.Direction[1][Lane], Packet.Direction[2][Lane]);
+				vec3 const Normal = dot(Scene.Normals[Triangle], Direction) > 0.0f ? -Scene.Normals[Triangle] : Scene.Normals[Triangle];
+				vec3 const Position = vec3(Packet.Origin[0][Lane], Packet.Origin[1][Lane], Packet.Origin[2][Lane]) + Direction * Packet.Distance[Lane];
+				vec3 const Origin = Position + Normal * Scene.Epsilon;
+				uint const Material = Scene.Materials[Triangle];
+
+				// Emission is sampled at the previous surface, except for camera rays
+				if(Bounce == 0)
+					Radiance[Lane] += Throughput[Lane] * Scene.Emissions[Material];
+				if(Bounce >= Settings.MaxBounces)
+					continue;
+
+				vec3 const & Albedo = Scene.Albedos[Material];
+				if(!Scene.Lights.empty())
+				{
+					float const Choice = Random[Lane].next();
+					std::size_t const Index = std::min(static_cast<std::size_t>(std::upper_bound(Scene.LightCdf.begin(), Scene.LightCdf.end(), Choice) - Scene.LightCdf.begin()), Scene.Lights.size() - 1);
+					uint const Light = Scene.Lights[Index];
+					float const r = std::sqrt(Random[Lane].next());
+					float const s = Random[Lane].next();
+					vec3 const Point = Scene.Vertices[Light] + Scene.Edges1[Light] * (r * (1.0f - s)) + Scene.Edges2[Light] * (r * s);
+
+					vec3 const ToLight = Point - Origin;
+					float const Distance2 = dot(ToLight, ToLight);
+					float const Distance = std::sqrt(Distance2);
+					vec3 const Incident = ToLight / Distance;
+					float const CosSurface = dot(Normal, Incident);
+					float const CosLight = abs(dot(Scene.Normals[Light], Incident));
+					if(CosSurface > 0.0f && CosLight > 0.0f && Distance2 > 0.0f)
+					{
+						// Density over the area of the light of the sampled point
+						float const Probability = (Scene.LightCdf[Index] - (Index > 0 ? Scene.LightCdf[Index - 1] : 0.0f)) / (length(cross(Scene.Edges1[Light], Scene.Edges2[Light])) * 0.5f);
+						Direct[Lane] = Throughput[Lane] * Albedo * one_over_pi<float>() * Scene.Emissions[Scene.Materials[Light]] * (CosSurface * CosLight / (Distance2 * Probability));
+						path_set_ray(Shadow, Lane, Origin, Incident, Distance * (1.0f - 1e-4f));
+					}
+				}
+
+				// Cosine weighted reflection, then Russian roulette on the throughput
+				Throughput[Lane] *= Albedo;
+				if(Bounce >= 3)
+				{
+					float const Survival = min(max(Throughput[Lane].x, max(Throughput[Lane].y, Throughput[Lane].z)), 0.95f);
+					if(Random[Lane].next() >= Survival)
+						continue;
+					Throughput[Lane] /= Survival;
+				}
+
+				float const u = Random[Lane].next();
+				float const Angle = two_pi<float>() * Random[Lane].next();
+				float const Radius = std::sqrt(u);
+				vec3 Tangent, Bitangent;
+				path_basis(Normal, Tangent, Bitangent);
+				vec3 const Reflected = Tangent * (Radius * std::cos(Angle)) + Bitangent * (Radius * std::sin(Angle)) + Normal * std::sqrt(max(1.0f - u, 0.0f));
+				Next |= 1 << Lane;
+				path_set_ray(Packet, Lane, Origin, Reflected, std::numeric_limits<float>::max());
+			}
+
+			if(Shadow.Active)
+			{
+				int const Shadows = Shadow.Active;
+				Rays += path_bit_count(Shadows);
+				path_traverse(Scene, Shadow, true);
+				for(int Lane = 0; Lane < 4; ++Lane)
+					if(Shadow.Active & (1 << Lane))
+						Radiance[Lane] += Direct[Lane];
+			}
+			Packet.Active = Next;
+		}
+		return Rays;
+	}
+
+	// Renders the tiles taken by each job, 2x2 pixels quads at a time
+	struct compute_path_tiles
+	{
+		path_scene const * Scene;
+		path_settings const * Settings;
+		mat3 Rotation;
+		vec3 Eye;
+		vec2 Extent;
+		uint TilesX;
+		vec4 * Pixels;
+		std::size_t * Rays;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t Tile, std::size_t Job) const
+		{
+			uint const Width = Settings->Width;
+			uint const Height = Settings->Height;
+			uint const X0 = static_cast<uint>(Tile % TilesX) * path_tile_size;
+			uint const Y0 = static_cast<uint>(Tile / TilesX) * path_tile_size;
+			uint const X1 = std::min(X0 + path_tile_size, Width);
+			uint const Y1 = std::min(Y0 + path_tile_size, Height);
+
+			for(uint y = Y0; y < Y1; y += 2)
+			for(uint x = X0; x < X1; x += 2)
+			{
+				vec3 Radiance[4] = {vec3(0.0f), vec3(0.0f), vec3(0.0f), vec3(0.0f)};
+				for(uint Sample = 0; Sample < Settings->Samples; ++Sample)
+				{
+					path_packet Packet;
+					Packet.Active = 0;
+					path_random Random[4];
+					for(int Lane = 0; Lane < 4; ++Lane)
+					{
+						uint const px = x + static_cast<uint>(Lane & 1);
+						uint const py = y + static_cast<uint>(Lane >> 1);
+						Random[Lane].State = path_hash(Settings->Seed ^ path_hash((py * Width + px) ^ path_hash(Sample)));
+						float const Jitter0 = Random[Lane].next();
+						float const Jitter1 = Random[Lane].next();
+						if(px >= X1 || py >= Y1)
+							continue;
+
+						vec3 const Direction(
+							(2.0f * (static_cast<float>(px) + Jitter0) / static_cast<float>(Width) - 1.0f) * Extent.x,
+							(1.0f - 2.0f * (static_cast<float>(py) + Jitter1) / static_cast<float>(Height)) * Extent.y,
+							-1.0f);
+						path_set_ray(Packet, Lane, Eye, normalize(Rotation * Direction), std::numeric_limits<float>::max());
+					}
+					Rays[Job] += path_trace(*Scene, *Settings, Packet, Random, Radiance);
+				}
+
+				float const Scale = 1.0f / static_cast<float>(Settings->Samples);
+				for(int Lane = 0; Lane < 4; ++Lane)
+				{
+					uint const px = x + static_cast<uint>(Lane & 1);
+					uint const py = y + static_cast<uint>(Lane >> 1);
+					if(px < X1 && py < Y1)
+						Pixels[static_cast<std::size_t>(py) * Width + px] = vec4(Radiance[Lane] * Scale, 1.0f);
+				}
+			}
+		}
+	};
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER uint addMaterial(path_scene & Scene, vec3 const & Albedo, vec3 const & Emission)
+	{
+		Scene.Albedos.push_back(Albedo);
+		Scene.Emissions.push_back(Emission);
+		return static_cast<uint>(Scene.Albedos.size() - 1);
+	}
+
+	GLM_FUNC_QUALIFIER void addMesh
+	(
+		path_scene & Scene,
+		vec3 const * Positions,
+		std::size_t VertexCount,
+		uint const * Indices,
+		std::size_t TriangleCount,
+		uint Material
+	)
+	{
+		uint const First = static_cast<uint>(Scene.Positions.size());
+		Scene.Positions.insert(Scene.Positions.end(), Positions, Positions + VertexCount);
+		for(std::size_t i = 0; i < TriangleCount; ++i)
+		{
+			Scene.Triangles.push_back(uvec3(Indices[i * 3 + 0], Indices[i * 3 + 1], Indices[i * 3 + 2]) + First);
+			Scene.TriangleMaterials.push_back(Material);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void buildPathScene(path_scene & Scene)
+	{
+		std::size_t const Count = Scene.Triangles.size();
+		std::vector<uint> Order(Count);
+		detail::path_build(Scene, Order);
+
+		Scene.Vertices.resize(Count);
+		Scene.Edges1.resize(Count);
+		Scene.Edges2.resize(Count);
+		Scene.Normals.resize(Count);
+		Scene.Materials.resize(Count);
+		Scene.Lights.clear();
+		Scene.LightCdf.clear();
+
+		float Power = 0.0f;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			uvec3 const & t = Scene.Triangles[Order[i]];
+			vec3 const & a = Scene.Positions[t.x];
+			Scene.Vertices[i] = a;
+			Scene.Edges1[i] = Scene.Positions[t.y] - a;
+			Scene.Edges2[i] = Scene.Positions[t.z] - a;
+			Scene.Materials[i] = Scene.TriangleMaterials[Order[i]];
+
+			vec3 const Cross = cross(Scene.Edges1[i], Scene.Edges2[i]);
+			float const Area = length(Cross) * 0.5f;
+			Scene.Normals[i] = Area > 0.0f ? Cross / (Area * 2.0f) : vec3(0, 0, 1);
+
+			vec3 const & Emission = Scene.Emissions[Scene.Materials[i]];
+			float const Weight = Area * (Emission.x + Emission.y + Emission.z);
+			if(Weight > 0.0f)
+			{
+				Power += Weight;
+				Scene.Lights.push_back(static_cast<uint>(i));
+				Scene.LightCdf.push_back(Power);
+			}
+		}
+		for(std::size_t i = 0; i < Scene.LightCdf.size(); ++i)
+			Scene.LightCdf[i] /= Power;
+
+		Scene.Epsilon = Scene.Nodes.empty() ? 1e-4f : 1e-4f * max(1e-3f, max(Scene.Nodes[0].Max.x - Scene.Nodes[0].Min.x, max(Scene.Nodes[0].Max.y - Scene.Nodes[0].Min.y, Scene.Nodes[0].Max.z - Scene.Nodes[0].Min.z)));
+	}
+
+	GLM_FUNC_QUALIFIER bool intersectPathScene(path_scene const & Scene, vec3 const & Origin, vec3 const & Direction, float & Distance, uint & Triangle)
+	{
+		detail::path_packet Packet;
+		Packet.Active = 0;
+		for(int Lane = 0; Lane < 4; ++Lane)
+			detail::path_set_ray(Packet, Lane, Origin, Direction, std::numeric_limits<float>::max());
+		Packet.Active = 1;
+		detail::path_traverse(Scene, Packet, false);
+		Distance = Packet.Distance[0];
+		Triangle = Packet.Triangle[0];
+		return Triangle != detail::path_miss;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t renderPaths(path_scene const & Scene, mat4 const & View, float Fovy, path_settings const & Settings, vec4 * Pixels)
+	{
+		mat4 const Camera = inverse(View);
+		float const TanY = std::tan(Fovy * 0.5f);
+		uint const TilesX = (Settings.Width + detail::path_tile_size - 1) / detail::path_tile_size;
+		uint const TilesY = (Settings.Height + detail::path_tile_size - 1) / detail::path_tile_size;
+		std::size_t const Tiles = static_cast<std::size_t>(TilesX) * TilesY;
+
+		std::vector<std::size_t> Rays(detail::parallel_jobs(Tiles, 1), 0);
+		detail::compute_path_tiles Render = {&Scene, &Settings, mat3(Camera), vec3(Camera[3]),
+			vec2(TanY * static_cast<float>(Settings.Width) / static_cast<float>(Settings.Height), TanY), TilesX, Pixels, &Rays[0]};
+		detail::parallel_dynamic(Tiles, Render);
+
+		std::size_t Total = 0;
+		for(std::size_t i = 0; i < Rays.size(); ++i)
+			Total += Rays[i];
+		return Total;
+	}
+
+	GLM_FUNC_QUALIFIER float imageError(vec4 const * a, vec4 const * b, std::size_t Count)
+	{
+		double Sum = 0.0;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			vec3 const d = vec3(a[i]) - vec3(b[i]);
+			Sum += static_cast<double>(dot(d, d));
+		}
+		return Count > 0 ? static_cast<float>(std::sqrt(Sum / static_cast<double>(Count * 3))) : 0.0f;
+	}
+}//namespace glm
@@ -0,0 +1,106 @@
+/// @ref gtx_shadow_cascades
+/// @file glm/gtx/shadow_cascades.hpp
+///
+/// @see core (dependence)
+/// @see gtc_matrix_transform (dependence)
+///
+/// @defgroup gtx_shadow_cascades GLM_GTX_shadow_cascades
+/// @ingroup gtx
+///
+/// @brief Split distances, light space fitting and caster culling of cascaded shadow maps.
+///
+/// The depth range of the camera is split with the practical scheme, a blend of logarithmic and uniform splits.
+/// The corners of all split planes are transformed to light space at once, as a scaled direction per corner plus
+/// an origin, and each cascade is fitted with lookAt and ortho to the box of its 8 corners, or to the bounding
+/// sphere of its slice of the frustum. Bounding sphere fits don't change size when the camera rotates and are
+/// snapped to whole shadow map texels, so that shadow edges don't shimmer when the camera moves.
+/// Casters are bounding boxes stored as a structure of arrays, tested against all cascades in the same SIMD pass.
+///
+/// <glm/gtx/shadow_cascades.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/matrix_transform.hpp"
+#include <cstddef>
+#include <vector>
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_shadow_cascades extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_shadow_cascades
+	/// @{
+
+	/// Settings and results of the cascades of a directional light.
+	/// @see gtx_shadow_cascades
+	struct shadow_cascades
+	{
+		/// Count cascades, from 1 to 32, of Resolution x Resolution texels.
+		GLM_FUNC_DECL shadow_cascades(std::size_t Count, uint Resolution, float Lambda = 0.75f, bool Stable = true);
+
+		std::size_t Count;
+		uint Resolution;
+
+		/// Weight of the logarithmic splits, 0 for uniform splits and 1 for logarithmic splits
+		float Lambda;
+
+		/// Fit cascades to bounding spheres snapped to texels rather than to the boxes of their corners
+		bool Stable;
+
+		/// Distance from the cascades toward the light within which casters are kept
+		float CasterDistance;
+
+		/// View depths of the Count + 1 split planes
+		std::vector<float> Splits;
+
+		/// View matrix of the light shared by all cascades, and per cascade light space boxes and matrices
+		mat4 LightView;
+		std::vector<vec3> Mins;
+		std::vector<vec3> Maxs;
+		std::vector<mat4> Projections;
+		std::vector<mat4> ViewProjections;
+
+		/// Light space corners of the split planes
+		std::vector<vec4> Corners;
+	};
+
+	/// Shadow caster bounding boxes as a structure of arrays.
+	/// @see gtx_shadow_cascades
+	struct shadow_casters
+	{
+		std::vector<float> MinX, MinY, MinZ;
+		std::vector<float> MaxX, MaxY, MaxZ;
+	};
+
+	/// Count + 1 split depths from Near to Far, Lambda * logarithmic + (1 - Lambda) * uniform splits.
+	/// @see gtx_shadow_cascades
+	GLM_FUNC_DECL void cascadeSplits(float Near, float Far, float Lambda, std::size_t Count, float * Splits);
+
+	/// Computes the splits and the light matrices of a camera of view matrix CameraView and projection
+	/// perspective(Fovy, Aspect, Near, Far), for a light shining toward LightDirection.
+	/// @see gtx_shadow_cascades
+	GLM_FUNC_DECL void fitCascades(
+		shadow_cascades & Cascades,
+		mat4 const & CameraView,
+		float Fovy,
+		float Aspect,
+		float Near,
+		float Far,
+		vec3 const & LightDirection);
+
+	/// Appends a world space bounding box and returns its index.
+	/// @see gtx_shadow_cascades
+	GLM_FUNC_DECL std::size_t addCaster(shadow_casters & Casters, vec3 const & Min, vec3 const & Max);
+
+	/// Bit i of Masks[j] is set when caster j may cast a shadow in cascade i.
+	/// @see gtx_shadow_cascades
+	GLM_FUNC_DECL void cullCasters(shadow_cascades const & Cascades, shadow_casters const & Casters, uint * Masks);
+
+	/// @}
+}//namespace glm
+
+#include "shadow_cascades.inl"
@@ -0,0 +1,305 @@
+/// @ref gtx_shadow_cascades
+/// @file glm/gtx/shadow_cascades.inl
+
+#include "../detail/_parallel.hpp"
+#include <cmath>
+
+namespace glm{
+namespace detail
+{
+	// Corners of the split planes at depths Splits: Directions[k] * Splits[p] + Origin
+	GLM_FUNC_QUALIFIER void cascade_corners(vec4 const Directions[4], vec4 const & Origin, float const * Splits, std::size_t Planes, vec4 * Corners)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			__m128 const D0 = _mm_loadu_ps(&Directions[0][0]);
+			__m128 const D1 = _mm_loadu_ps(&Directions[1][0]);
+			__m128 const D2 = _mm_loadu_ps(&Directions[2][0]);
+			__m128 const D3 = _mm_loadu_ps(&Directions[3][0]);
+			__m128 const O = _mm_loadu_ps(&Origin[0]);
+			for(std::size_t p = 0; p < Planes; ++p)
+			{
+				__m128 const Depth = _mm_set1_ps(Splits[p]);
+				_mm_storeu_ps(&Corners[p * 4 + 0][0], _mm_add_ps(_mm_mul_ps(D0, Depth), O));
+				_mm_storeu_ps(&Corners[p * 4 + 1][0], _mm_add_ps(_mm_mul_ps(D1, Depth), O));
+				_mm_storeu_ps(&Corners[p * 4 + 2][0], _mm_add_ps(_mm_mul_ps(D2, Depth), O));
+				_mm_storeu_ps(&Corners[p * 4 + 3][0], _mm_add_ps(_mm_mul_ps(D3, Depth), O));
+			}
+#		else
+			for(std::size_t p = 0; p < Planes; ++p)
+			for(std::size_t k = 0; k < 4; ++k)
+				Corners[p * 4 + k] = Directions[k] * Splits[p] + Origin;
+#		endif
+	}
+
+	// Box of 8 consecutive corners
+	GLM_FUNC_QUALIFIER void cascade_box(vec4 const * Corners, vec3 & Min, vec3 & Max)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			__m128 Lower = _mm_loadu_ps(&Corners[0][0]);
+			__m128 Upper = Lower;
+			for(std::size_t k = 1; k < 8; ++k)
+			{
+				__m128 const Corner = _mm_loadu_ps(&Corners[k][0]);
+				Lower = _mm_min_ps(Lower, Corner);
+				Upper = _mm_max_ps(Upper, Corner);
+			}
+			vec4 Result[2];
+			_mm_storeu_ps(&Result[0][0], Lower);
+			_mm_storeu_ps(&Result[1][0], Upper);
+			Min = vec3(Result[0]);
+			Max = vec3(Result[1]);
+#		else
+			Min = Max = vec3(Corners[0]);
+			for(std::size_t k = 1; k < 8; ++k)
+			{
+				Min = min(Min, vec3(Corners[k]));
+				Max = max(Max, vec3(Corners[k]));
+			}
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER uint cascade_caster_mask(shadow_cascades const & Cascades, shadow_casters const & Casters, std::size_t i)
+	{
+		mat4 const & m = Cascades.LightView;
+		vec3 const Center = vec3(Casters.MinX[i] + Casters.MaxX[i], Casters.MinY[i] + Casters.MaxY[i], Casters.MinZ[i] + Casters.MaxZ[i]) * 0.5f;
+		vec3 const Extent = vec3(Casters.MaxX[i] - Casters.MinX[i], Casters.MaxY[i] - Casters.MinY[i], Casters.MaxZ[i] - Casters.MinZ[i]) * 0.5f;
+		vec3 const LightCenter = vec3(m[0]) * Center.x + vec3(m[1]) * Center.y + vec3(m[2]) * Center.z + vec3(m[3]);
+		vec3 const LightExtent = abs(vec3(m[0])) * Extent.x + abs(vec3(m[1])) * Extent.y + abs(vec3(m[2])) * Extent.z;
+		vec3 const Lower = LightCenter - LightExtent;
+		vec3 const Upper = LightCenter + LightExtent;
+
+		uint Mask = 0;
+		for(std::size_t c = 0; c < Cascades.Count; ++c)
+		{
+			vec3 const & Min = Cascades.Mins[c];
+			vec3 const & Max = Cascades.Maxs[c];
+			if(Upper.x >= Min.x && Lower.x <= Max.x && Upper.y >= Min.y && Lower.y <= Max.y && Upper.z >= Min.z && Lower.z <= Max.z + Cascades.CasterDistance)
+				Mask |= 1u << c;
+		}
+		return Mask;
+	}
+
+	// Light space boxes of the casters against every cascade, 8 casters at once with AVX or 4 with SSE2
+	struct compute_cascade_casters
+	{
+		shadow_cascades const * Cascades;
+		shadow_casters const * Casters;
+		uint * Masks;
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t Begin, std::size_t End, std::size_t) const
+		{
+			std::size_t i = Begin;
+			shadow_casters const & b = *Casters;
+
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+				mat4 const & m = Cascades->LightView;
+				__m256 const Half = _mm256_set1_ps(0.5f);
+				__m256 const AbsMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+				for(; i + 8 <= End; i += 8)
+				{
+					__m256 const MinX = _mm256_loadu_ps(&b.MinX[i]), MaxX = _mm256_loadu_ps(&b.MaxX[i]);
+					__m256 const MinY = _mm256_loadu_ps(&b.MinY[i]), MaxY = _mm256_loadu_ps(&b.MaxY[i]);
+					__m256 const MinZ = _mm256_loadu_ps(&b.MinZ[i]), MaxZ = _mm256_loadu_ps(&b.MaxZ[i]);
+					__m256 const cx = _mm256_mul_ps(_mm256_add_ps(MinX, MaxX), Half);
+					__m256 const cy = _mm256_mul_ps(_mm256_add_ps(MinY, MaxY), Half);
+					__m256 const cz = _mm256_mul_ps(_mm256_add_ps(MinZ, MaxZ), Half);
+					__m256 const ex = _mm256_mul_ps(_mm256_sub_ps(MaxX, MinX), Half);
+					__m256 const ey = _mm256_mul_ps(_mm256_sub_ps(MaxY, MinY), Half);
+					__m256 const ez = _mm256_mul_ps(_mm256_sub_ps(MaxZ, MinZ), Half);
+
+					__m256 Lower[3], Upper[3];
+					for(length_t r = 0; r < 3; ++r)
+					{
+						__m256 const Center = _mm256_add_ps(_mm256_add_ps(
+							_mm256_mul_ps(_mm256_set1_ps(m[0][r]), cx),
+							_mm256_mul_ps(_mm256_set1_ps(m[1][r]), cy)), _mm256_add_ps(
+							_mm256_mul_ps(_mm256_set1_ps(m[2][r]), cz), _mm256_set1_ps(m[3][r])));
+						__m256 const Extent = _mm256_add_ps(_mm256_add_ps(
+							_mm256_mul_ps(_mm256_and_ps(_mm256_set1_ps(m[0][r]), AbsMask), ex),
+							_mm256_mul_ps(_mm256_and_ps(_mm256_set1_ps(m[1][r]), AbsMask), ey)),
+							_mm256_mul_ps(_mm256_and_ps(_mm256_set1_ps(m[2][r]), AbsMask), ez));
+						Lower[r] = _mm256_sub_ps(Center, Extent);
+						Upper[r] = _mm256_add_ps(Center, Extent);
+					}
+
+					__m256 Bits = _mm256_setzero_ps();
+					for(std::size_t c = 0; c < Cascades->Count; ++c)
+					{
+						vec3 const & Min = Cascades->Mins[c];
+						vec3 const & Max = Cascades->Maxs[c];
+						__m256 const Overlap = _mm256_and_ps(_mm256_and_ps(_mm256_and_ps(
+							_mm256_cmp_ps(Upper[0], _mm256_set1_ps(Min.x), _CMP_GE_OQ),
+							_mm256_cmp_ps(Lower[0], _mm256_set1_ps(Max.x), _CMP_LE_OQ)), _mm256_and_ps(
+							_mm256_cmp_ps(Upper[1], _mm256_set1_ps(Min.y), _CMP_GE_OQ),
+							_mm256_cmp_ps(Lower[1], _mm256_set1_ps(Max.y), _CMP_LE_OQ))), _mm256_and_ps(
+							_mm256_cmp_ps(Upper[2], _mm256_set1_ps(Min.z), _CMP_GE_OQ),
+							_mm256_cmp_ps(Lower[2], _mm256_set1_ps(Max.z + Cascades->CasterDistance), _CMP_LE_OQ)));
+						Bits = _mm256_or_ps(Bits, _mm256_and_ps(Overlap, _mm256_castsi256_ps(_mm256_set1_epi32(static_cast<int>(1u << c)))));
+					}
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(Masks + i), _mm256_castps_si256(Bits));
+				}
+#			elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+				mat4 const & m = Cascades->LightView;
+				__m128 const Half = _mm_set1_ps(0.5f);
+				__m128 const AbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+				for(; i + 4 <= End; i += 4)
+				{
+					__m128 const MinX = _mm_loadu_ps(&b.MinX[i]), MaxX = _mm_loadu_ps(&b.MaxX[i]);
+					__m128 const MinY = _mm_loadu_ps(&b.MinY[i]), MaxY = _mm_loadu_ps(&b.MaxY[i]);
+					__m128 const MinZ = _mm_loadu_ps(&b.MinZ[i]), MaxZ = _mm_loadu_ps(&b.MaxZ[i]);
+					__m128 const cx = _mm_mul_ps(_mm_add_ps(MinX, MaxX), Half);
+					__m128 const cy = _mm_mul_ps(_mm_add_ps(MinY, MaxY), Half);
+					__m128 const cz = _mm_mul_ps(_mm_add_ps(MinZ, MaxZ), Half);
+					__m128 const ex = _mm_mul_ps(_mm_sub_ps(MaxX, MinX), Half);
+					__m128 const ey = _mm_mul_ps(_mm_sub_ps(MaxY, MinY), Half);
+					__m128 const ez = _mm_mul_ps(_mm_sub_ps(MaxZ, MinZ), Half);
+
+					__m128 Lower[3], Upper[3];
+					for(length_t r = 0; r < 3; ++r)
+					{
+						__m128 const Center = _mm_add_ps(_mm_add_ps(
+							_mm_mul_ps(_mm_set1_ps(m[0][r]), cx),
+							_mm_mul_ps(_mm_set1_ps(m[1][r]), cy)), _mm_add_ps(
+							_mm_mul_ps(_mm_set1_ps(m[2][r]), cz), _mm_set1_ps(m[3][r])));
+						__m128 const Extent = _mm_add_ps(_mm_add_ps(
+							_mm_mul_ps(_mm_and_ps(_mm_set1_ps(m[0][r]), AbsMask), ex),
+							_mm_mul_ps(_mm_and_ps(_mm_set1_ps(m[1][r]), AbsMask), ey)),
+							_mm_mul_ps(_mm_and_ps(_mm_set1_ps(m[2][r]), AbsMask), ez));
+						Lower[r] = _mm_sub_ps(Center, Extent);
+						Upper[r] = _mm_add_ps(Center, Extent);
+					}
+
+					__m128i Bits = _mm_setzero_si128();
+					for(std::size_t c = 0; c < Cascades->Count; ++c)
+					{
+						vec3 const & Min = Cascades->Mins[c];
+						vec3 const & Max = Cascades->Maxs[c];
+						__m128 const Overlap = _mm_and_ps(_mm_and_ps(_mm_and_ps(
+							_mm_cmpge_ps(Upper[0], _mm_set1_ps(Min.x)),
+							_mm_cmple_ps(Lower[0], _mm_set1_ps(Max.x))), _mm_and_ps(
+							_mm_cmpge_ps(Upper[1], _mm_set1_ps(Min.y)),
+							_mm_cmple_ps(Lower[1], _mm_set1_ps(Max.y)))), _mm_and_ps(
+							_mm_cmpge_ps(Upper[2], _mm_set1_ps(Min.z)),
+							_mm_cmple_ps(Lower[2], _mm_set1_ps(Max.z + Cascades->CasterDistance))));
+						Bits = _mm_or_si128(Bits, _mm_and_si128(_mm_castps_si128(Overlap), _mm_set1_epi32(static_cast<int>(1u << c))));
+					}
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(Masks + i), Bits);
+				}
+#			endif
+			for(; i < End; ++i)
+				Masks[i] = cascade_caster_mask(*Cascades, b, i);
+		}
+	};
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER shadow_cascades::shadow_cascades(std::size_t Count, uint Resolution, float Lambda, bool Stable) :
+		Count(Count),
+		Resolution(Resolution),
+		Lambda(Lambda),
+		Stable(Stable),
+		CasterDistance(0.0f),
+		Splits(Count + 1, 0.0f),
+		LightView(1.0f),
+		Mins(Count),
+		Maxs(Count),
+		Projections(Count, mat4(1.0f)),
+		ViewProjections(Count, mat4(1.0f))
+	{
+		assert(Count > 0 && Count <= 32 && Resolution > 2);
+	}
+
+	GLM_FUNC_QUALIFIER void cascadeSplits(float Near, float Far, float Lambda, std::size_t Count, float * Splits)
+	{
+		double const Ratio = static_cast<double>(Far) / static_cast<double>(Near);
+		for(std::size_t i = 1; i < Count; ++i)
+		{
+			double const t = static_cast<double>(i) / static_cast<double>(Count);
+			double const Logarithmic = static_cast<double>(Near) * std::pow(Ratio, t);
+			double const Uniform = static_cast<double>(Near) + static_cast<double>(Far - Near) * t;
+			Splits[i] = static_cast<float>(static_cast<double>(Lambda) * Logarithmic + (1.0 - static_cast<double>(Lambda)) * Uniform);
+		}
+		Splits[0] = Near;
+		Splits[Count] = Far;
+	}
+
+	GLM_FUNC_QUALIFIER void fitCascades
+	(
+		shadow_cascades & Cascades,
+		mat4 const & CameraView,
+		float Fovy,
+		float Aspect,
+		float Near,
+		float Far,
+		vec3 const & LightDirection
+	)
+	{
+		std::size_t const Count = Cascades.Count;
+		cascadeSplits(Near, Far, Cascades.Lambda, Count, &Cascades.Splits[0]);
+
+		vec3 const Direction = normalize(LightDirection);
+		vec3 const Up = abs(Direction.y) > 0.99f ? vec3(1, 0, 0) : vec3(0, 1, 0);
+		Cascades.LightView = lookAt(vec3(0), Direction, Up);
+
+		// From the view space of the camera to the view space of the light
+		mat4 const Camera = Cascades.LightView * inverse(CameraView);
+		float const TanY = std::tan(Fovy * 0.5f);
+		float const TanX = TanY * Aspect;
+		vec4 const Directions[4] =
+		{
+			Camera[0] * -TanX + Camera[1] * -TanY - Camera[2],
+			Camera[0] *  TanX + Camera[1] * -TanY - Camera[2],
+			Camera[0] * -TanX + Camera[1] *  TanY - Camera[2],
+			Camera[0] *  TanX + Camera[1] *  TanY - Camera[2]
+		};
+
+		Cascades.Corners.resize((Count + 1) * 4);
+		detail::cascade_corners(Directions, Camera[3], &Cascades.Splits[0], Count + 1, &Cascades.Corners[0]);
+
+		float const Tan2 = TanX * TanX + TanY * TanY;
+		float const Texels = static_cast<float>(Cascades.Resolution);
+		for(std::size_t c = 0; c < Count; ++c)
+		{
+			vec3 Min, Max;
+			if(Cascades.Stable)
+			{
+				// Bounding sphere of the slice, centered on the view axis where the near and far corners are equidistant
+				float const n = Cascades.Splits[c];
+				float const f = Cascades.Splits[c + 1];
+				float const Depth = min((f + n) * (1.0f + Tan2) * 0.5f, f);
+				float const Radius = std::sqrt((f - Depth) * (f - Depth) + f * f * Tan2);
+				vec3 const Center(Camera[3] - Camera[2] * Depth);
+
+				// The sphere stays within the square when its center is snapped to a texel of the shadow map
+				float const Texel = 2.0f * Radius / (Texels - 2.0f);
+				float const HalfSize = Texel * Texels * 0.5f;
+				vec2 const Snapped = floor(vec2(Center) / Texel) * Texel;
+				Min = vec3(Snapped - HalfSize, Center.z - Radius);
+				Max = vec3(Snapped + HalfSize, Center.z + Radius);
+			}
+			else
+				detail::cascade_box(&Cascades.Corners[c * 4], Min, Max);
+
+			Cascades.Mins[c] = Min;
+			Cascades.Maxs[c] = Max;
+			Cascades.Projections[c] = ortho(Min.x, Max.x, Min.y, Max.y, -(Max.z + Cascades.CasterDistance), -Min.z);
+			Cascades.ViewProjections[c] = Cascades.Projections[c] * Cascades.LightView;
+		}
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t addCaster(shadow_casters & Casters, vec3 const & Min, vec3 const & Max)
+	{
+		Casters.MinX.push_back(Min.x);
+		Casters.MinY.push_back(Min.y);
+		Casters.MinZ.push_back(Min.z);
+		Casters.MaxX.push_back(Max.x);
+		Casters.MaxY.push_back(Max.y);
+		Casters.MaxZ.push_back(Max.z);
+		return Casters.MinX.size() - 1;
+	}
+
+	GLM_FUNC_QUALIFIER void cullCasters(shadow_cascades const & Cascades, shadow_casters const & Casters, uint * Masks)
+	{
+		detail::compute_cascade_casters Cull = {&Cascades, &Casters, Masks};
+		detail::parallel_for(Casters.MinX.size(), 8192, Cull);
+	}
+}//namespace glm
@@ -0,0 +1,48 @@
+/// @ref gtx_sincos
+/// @file glm/gtx/sincos.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_sincos GLM_GTX_sincos
+/// @ingroup gtx
+///
+/// @brief Sine and cosine of several angles with a single evaluation.
+///
+/// Single precision values are evaluated four at a time with SIMD instructions when available.
+///
+/// <glm/gtx/sincos.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_sincos extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_sincos
+	/// @{
+
+	/// Computes the sine and the cosine of an angle expressed in radians.
+	/// @see gtx_sincos
+	template <typename genType>
+	GLM_FUNC_DECL void sincos(genType const & angle, genType & s, genType & c);
+
+	/// Computes the sine and the cosine of each component of a vector of angles in one evaluation.
+	/// @see gtx_sincos
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL void sincos(vecType<T, P> const & angles, vecType<T, P> & s, vecType<T, P> & c);
+
+	/// Computes the sine and the cosine of Count angles, four at a time.
+	/// @see gtx_sincos
+	template <typename T>
+	GLM_FUNC_DECL void sincos(T const * angles, T * s, T * c, std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "sincos.inl"
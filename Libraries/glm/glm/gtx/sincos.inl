@@ -0,0 +1,57 @@
+/// @ref gtx_sincos
+/// @file glm/gtx/sincos.inl
+
+namespace glm
+{
+	template <typename genType>
+	GLM_FUNC_QUALIFIER void sincos(genType const & angle, genType & s, genType & c)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<genType>::is_iec559, "'sincos' only accept floating-point inputs");
+
+		s = glm::sin(angle);
+		c = glm::cos(angle);
+	}
+
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER void sincos(vecType<T, P> const & angles, vecType<T, P> & s, vecType<T, P> & c)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'sincos' only accept floating-point inputs");
+
+		T a[4] = {T(0), T(0), T(0), T(0)};
+		for(length_t i = 0; i < angles.length(); ++i)
+			a[i] = angles[i];
+
+		T sin0[4], cos0[4];
+		detail::compute_sincos4<T>::call(a, sin0, cos0);
+
+		for(length_t i = 0; i < angles.length(); ++i)
+		{
+			s[i] = sin0[i];
+			c[i] = cos0[i];
+		}
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void sincos(T const * angles, T * s, T * c, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'sincos' only accept floating-point inputs");
+
+		std::size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+			detail::compute_sincos4<T>::call(angles + i, s + i, c + i);
+
+		if(i < Count)
+		{
+			T a[4] = {T(0), T(0), T(0), T(0)};
+			T sin0[4], cos0[4];
+			for(std::size_t j = i; j < Count; ++j)
+				a[j - i] = angles[j];
+			detail::compute_sincos4<T>::call(a, sin0, cos0);
+			for(std::size_t j = i; j < Count; ++j)
+			{
+				s[j] = sin0[j - i];
+				c[j] = cos0[j - i];
+			}
+		}
+	}
+}//namespace glm
@@ -41,6 +41,39 @@ namespace glm
 	template <template <typename, precision> class matType, typename T, precision P>
 	GLM_FUNC_DECL std::string to_string(matType<T, P> const & x);
 
+	/// Write a GLM vector, matrix or quaternion typed variable in [First, Last), with the layout of to_string and without allocation.
+	/// Floating point values use the shortest decimals reading back as the same values, formatted as std::to_chars.
+	/// Return a pointer past the last written character, without null terminator, or a null pointer if [First, Last) is too small.
+	/// @see gtx_string_cast extension.
+	template <template <typename, precision> class matType, typename T, precision P>
+	GLM_FUNC_DECL char * to_chars(char * First, char * Last, matType<T, P> const & x);
+
+	/// Write a scalar in [First, Last), see to_chars of vectors.
+	/// @see gtx_string_cast extension.
+	template <typename genType>
+	GLM_FUNC_DECL char * to_chars(char * First, char * Last, genType x);
+
+	/// Read a GLM vector, matrix or quaternion typed variable from [First, Last), written by to_string, to_chars or as numbers separated by white spaces or commas.
+	/// A type name followed by parentheses, such as "vec3(" or "mat2x3((", is optional and not checked against the type of x. Leading white spaces are skipped.
+	/// Matrices are read column after column, quaternions as x, y, z and w, and dual quaternions as the real then the dual quaternion.
+	/// Return a pointer past the last read character, or a null pointer without change to x if the text is not valid.
+	/// @see gtx_string_cast extension.
+	template <template <typename, precision> class matType, typename T, precision P>
+	GLM_FUNC_DECL char const * from_chars(char const * First, char const * Last, matType<T, P> & x);
+
+	/// Read a scalar at the beginning of [First, Last), as std::from_chars with an optional '+' sign, inf, infinity and nan for floating point values
+	/// and true, false, 0 or 1 for booleans. Floating point values are correctly rounded.
+	/// @see gtx_string_cast extension.
+	template <typename genType>
+	GLM_FUNC_DECL char const * from_chars(char const * First, char const * Last, genType & x);
+
+	/// Read up to Capacity vectors of Components numbers separated by white spaces or commas, the component i of the vector n in Arrays[i][n].
+	/// Reading stops at the end of [First, Last) or at the first text that is not a number.
+	/// Return the number of vectors with all their components read.
+	/// @see gtx_string_cast extension.
+	template <typename T>
+	GLM_FUNC_DECL std::size_t from_chars(char const * First, char const * Last, T * const * Arrays, length_t Components, std::size_t Capacity);
+
 	/// @}
 }//namespace glm
 
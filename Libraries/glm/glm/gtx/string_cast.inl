@@ -1,6 +1,8 @@
 /// @ref gtx_string_cast
 /// @file glm/gtx/string_cast.inl
 
+#include "../detail/_to_chars.hpp"
+#include "../detail/_from_chars.hpp"
 #include <cstdarg>
 #include <cstdio>
 
@@ -447,6 +449,420 @@ namespace detail
 		}
 	};
 
+	// Writes a type name such as "i8vec3(" or "dmat4x2(("
+	template <typename T>
+	GLM_FUNC_QUALIFIER char * to_chars_name(char * First, char * Last, char const * Name, length_t Columns, length_t Rows)
+	{
+		First = chars_write_text(First, Last, prefix<T>::value());
+		First = chars_write_text(First, Last, Name);
+		if(Columns > 0)
+			First = chars_write_integer(First, Last, false, static_cast<uint64>(Columns));
+		if(Rows > 0)
+		{
+			First = chars_write_text(First, Last, "x");
+			First = chars_write_integer(First, Last, false, static_cast<uint64>(Rows));
+			First = chars_write_text(First, Last, "(");
+		}
+		return chars_write_text(First, Last, "(");
+	}
+
+	// Writes the Length components of x separated by commas
+	template <typename T, typename vecType>
+	GLM_FUNC_QUALIFIER char * to_chars_components(char * First, char * Last, vecType const & x, length_t Length)
+	{
+		for(length_t i = 0; i < Length; ++i)
+		{
+			if(i > 0)
+				First = chars_write_text(First, Last, ", ");
+			First = compute_to_chars_scalar<T>::call(First, Last, x[i]);
+		}
+		return First;
+	}
+
+	template <typename T, typename vecType>
+	GLM_FUNC_QUALIFIER char * to_chars_vector(char * First, char * Last, vecType const & x)
+	{
+		First = to_chars_name<T>(First, Last, "vec", x.length(), 0);
+		First = to_chars_components<T>(First, Last, x, x.length());
+		return chars_write_text(First, Last, ")");
+	}
+
+	template <typename T, typename matType>
+	GLM_FUNC_QUALIFIER char * to_chars_matrix(char * First, char * Last, matType const & x)
+	{
+		First = to_chars_name<T>(First, Last, "mat", x.length(), x[0].length());
+		for(length_t i = 0; i < x.length(); ++i)
+		{
+			if(i > 0)
+				First = chars_write_text(First, Last, "), (");
+			First = to_chars_components<T>(First, Last, x[i], x[i].length());
+		}
+		return chars_write_text(First, Last, "))");
+	}
+
+	template <template <typename, precision> class matType, typename T, precision P>
+	struct compute_to_chars
+	{};
+
+	template <typename T, precision P>
+	struct compute_to_chars<tvec1, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char * call(char * First, char * Last, tvec1<T, P> const & x)
+		{
+			return to_chars_vector<T>(First, Last, x);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_to_chars<tvec2, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char * call(char * First, char * Last, tvec2<T, P> const & x)
+		{
+			return to_chars_vector<T>(First, Last, x);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_to_chars<tvec3, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char * call(char * First, char * Last, tvec3<T, P> const & x)
+		{
+			return to_chars_vector<T>(First, Last, x);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_to_chars<tvec4, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char * call(char * First, char * Last, tvec4<T, P> const & x)
+		{
+			return to_chars_vector<T>(First, Last, x);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_to_chars<tmat2x2, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char * call(char * First, char * Last, tmat2x2<T, P> const & x)
+		{
+			return to_chars_matrix<T>(First, Last, x);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_to_chars<tmat2x3, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char * call(char * First, char * Last, tmat2x3<T, P> const & x)
+		{
+			return to_chars_matrix<T>(First, Last, x);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_to_chars<tmat2x4, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char * call(char * First, char * Last, tmat2x4<T, P> const & x)
+		{
+			return to_chars_matrix<T>(First, Last, x);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_to_chars<tmat3x2, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char * call(char * First, char * Last, tmat3x2<T, P> const & x)
+		{
+			return to_chars_matrix<T>(First, Last, x);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_to_chars<tmat3x3, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char * call(char * First, char * Last, tmat3x3<T, P> const & x)
+		{
+			return to_chars_matrix<T>(First, Last, x);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_to_chars<tmat3x4, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char * call(char * First, char * Last, tmat3x4<T, P> const & x)
+		{
+			return to_chars_matrix<T>(First, Last, x);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_to_chars<tmat4x2, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char * call(char * First, char * Last, tmat4x2<T, P> const & x)
+		{
+			return to_chars_matrix<T>(First, Last, x);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_to_chars<tmat4x3, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char * call(char * First, char * Last, tmat4x3<T, P> const & x)
+		{
+			return to_chars_matrix<T>(First, Last, x);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_to_chars<tmat4x4, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char * call(char * First, char * Last, tmat4x4<T, P> const & x)
+		{
+			return to_chars_matrix<T>(First, Last, x);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_to_chars<tquat, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char * call(char * First, char * Last, tquat<T, P> const & x)
+		{
+			First = to_chars_name<T>(First, Last, "quat", 0, 0);
+			First = to_chars_components<T>(First, Last, x, 4);
+			return chars_write_text(First, Last, ")");
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_to_chars<tdualquat, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char * call(char * First, char * Last, tdualquat<T, P> const & x)
+		{
+			First = to_chars_name<T>(First, Last, "dualquat(", 0, 0);
+			First = to_chars_components<T>(First, Last, x.real, 4);
+			First = chars_write_text(First, Last, "), (");
+			First = to_chars_components<T>(First, Last, x.dual, 4);
+			return chars_write_text(First, Last, "))");
+		}
+	};
+
+	// Reads Count numbers of a vector, matrix or quaternion, with an optional type name, parentheses, white spaces and commas around them
+	template <typename T>
+	GLM_FUNC_QUALIFIER char const * from_chars_components(char const * First, char const * Last, T * Values, length_t Count)
+	{
+		First = chars_skip_spaces(First, Last);
+
+		char const * Name = First;
+		if(Name != Last && chars_is_letter(*Name))
+		{
+			for(++Name; Name != Last && (chars_is_letter(*Name) || chars_is_digit(*Name) || *Name == '_'); ++Name){}
+			if(Name != Last && *Name == '(')
+				First = Name;
+		}
+
+		int Depth = 0;
+		for(length_t i = 0; i < Count; ++i)
+		{
+			for(; First != Last; ++First)
+			{
+				if(*First == '(')
+					++Depth;
+				else if(*First == ')' && Depth > 0)
+					--Depth;
+				else if(!chars_is_separator(*First))
+					break;
+			}
+			First = compute_from_chars_scalar<T>::call(First, Last, Values[i]);
+			if(!First)
+				return 0;
+		}
+
+		for(; Depth > 0; --Depth)
+		{
+			First = chars_skip_spaces(First, Last);
+			if(First == Last || *First != ')')
+				return 0;
+			++First;
+		}
+		return First;
+	}
+
+	template <typename T, typename vecType>
+	GLM_FUNC_QUALIFIER char const * from_chars_vector(char const * First, char const * Last, vecType & x)
+	{
+		T Values[4];
+		First = from_chars_components(First, Last, Values, x.length());
+		if(First)
+		{
+			for(length_t i = 0; i < x.length(); ++i)
+				x[i] = Values[i];
+		}
+		return First;
+	}
+
+	template <typename T, typename matType>
+	GLM_FUNC_QUALIFIER char const * from_chars_matrix(char const * First, char const * Last, matType & x)
+	{
+		T Values[16];
+		length_t const Rows = x[0].length();
+		First = from_chars_components(First, Last, Values, x.length() * Rows);
+		if(First)
+		{
+			for(length_t i = 0; i < x.length(); ++i)
+			for(length_t j = 0; j < Rows; ++j)
+				x[i][j] = Values[i * Rows + j];
+		}
+		return First;
+	}
+
+	template <template <typename, precision> class matType, typename T, precision P>
+	struct compute_from_chars
+	{};
+
+	template <typename T, precision P>
+	struct compute_from_chars<tvec1, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char const * call(char const * First, char const * Last, tvec1<T, P> & x)
+		{
+			return from_chars_vector<T>(First, Last, x);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_from_chars<tvec2, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char const * call(char const * First, char const * Last, tvec2<T, P> & x)
+		{
+			return from_chars_vector<T>(First, Last, x);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_from_chars<tvec3, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char const * call(char const * First, char const * Last, tvec3<T, P> & x)
+		{
+			return from_chars_vector<T>(First, Last, x);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_from_chars<tvec4, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char const * call(char const * First, char const * Last, tvec4<T, P> & x)
+		{
+			return from_chars_vector<T>(First, Last, x);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_from_chars<tmat2x2, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char const * call(char const * First, char const * Last, tmat2x2<T, P> & x)
+		{
+			return from_chars_matrix<T>(First, Last, x);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_from_chars<tmat2x3, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char const * call(char const * First, char const * Last, tmat2x3<T, P> & x)
+		{
+			return from_chars_matrix<T>(First, Last, x);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_from_chars<tmat2x4, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char const * call(char const * First, char const * Last, tmat2x4<T, P> & x)
+		{
+			return from_chars_matrix<T>(First, Last, x);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_from_chars<tmat3x2, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char const * call(char const * First, char const * Last, tmat3x2<T, P> & x)
+		{
+			return from_chars_matrix<T>(First, Last, x);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_from_chars<tmat3x3, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char const * call(char const * First, char const * Last, tmat3x3<T, P> & x)
+		{
+			return from_chars_matrix<T>(First, Last, x);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_from_chars<tmat3x4, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char const * call(char const * First, char const * Last, tmat3x4<T, P> & x)
+		{
+			return from_chars_matrix<T>(First, Last, x);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_from_chars<tmat4x2, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char const * call(char const * First, char const * Last, tmat4x2<T, P> & x)
+		{
+			return from_chars_matrix<T>(First, Last, x);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_from_chars<tmat4x3, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char const * call(char const * First, char const * Last, tmat4x3<T, P> & x)
+		{
+			return from_chars_matrix<T>(First, Last, x);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_from_chars<tmat4x4, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char const * call(char const * First, char const * Last, tmat4x4<T, P> & x)
+		{
+			return from_chars_matrix<T>(First, Last, x);
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_from_chars<tquat, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char const * call(char const * First, char const * Last, tquat<T, P> & x)
+		{
+			T Values[4];
+			First = from_chars_components(First, Last, Values, 4);
+			if(First)
+				x = tquat<T, P>(Values[3], Values[0], Values[1], Values[2]);
+			return First;
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_from_chars<tdualquat, T, P>
+	{
+		GLM_FUNC_QUALIFIER static char const * call(char const * First, char const * Last, tdualquat<T, P> & x)
+		{
+			T Values[8];
+			First = from_chars_components(First, Last, Values, 8);
+			if(First)
+			{
+				x.real = tquat<T, P>(Values[3], Values[0], Values[1], Values[2]);
+				x.dual = tquat<T, P>(Values[7], Values[4], Values[5], Values[6]);
+			}
+			return First;
+		}
+	};
 }//namespace detail
 
 template <template <typename, precision> class matType, typename T, precision P>
@@ -455,4 +871,43 @@ GLM_FUNC_QUALIFIER std::string to_string(matType<T, P> const & x)
 	return detail::compute_to_string<matType, T, P>::call(x);
 }
 
+template <template <typename, precision> class matType, typename T, precision P>
+GLM_FUNC_QUALIFIER char * to_chars(char * First, char * Last, matType<T, P> const & x)
+{
+	return detail::compute_to_chars<matType, T, P>::call(First, Last, x);
+}
+
+template <typename genType>
+GLM_FUNC_QUALIFIER char * to_chars(char * First, char * Last, genType x)
+{
+	return detail::compute_to_chars_scalar<genType>::call(First, Last, x);
+}
+
+template <template <typename, precision> class matType, typename T, precision P>
+GLM_FUNC_QUALIFIER char const * from_chars(char const * First, char const * Last, matType<T, P> & x)
+{
+	return detail::compute_from_chars<matType, T, P>::call(First, Last, x);
+}
+
+template <typename genType>
+GLM_FUNC_QUALIFIER char const * from_chars(char const * First, char const * Last, genType & x)
+{
+	return detail::compute_from_chars_scalar<genType>::call(First, Last, x);
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER std::size_t from_chars(char const * First, char const * Last, T * const * Arrays, length_t Components, std::size_t Capacity)
+{
+	for(std::size_t Count = 0; Count < Capacity; ++Count)
+	{
+		for(length_t i = 0; i < Components; ++i)
+		{
+			First = detail::compute_from_chars_scalar<T>::call(detail::chars_skip_separators(First, Last), Last, Arrays[i][Count]);
+			if(!First)
+				return Count;
+		}
+	}
+	return Capacity;
+}
+
 }//namespace glm
@@ -0,0 +1,110 @@
+/// @ref gtx_ulp_sweep
+/// @file glm/gtx/ulp_sweep.hpp
+///
+/// @see core (dependence)
+/// @see gtc_ulp (dependence)
+///
+/// @defgroup gtx_ulp_sweep GLM_GTX_ulp_sweep
+/// @ingroup gtx
+///
+/// @brief Accuracy in ULP of single precision functions against a double precision reference.
+///
+/// Every float of a range, or a stratified sample of them, is evaluated by the kernel and the reference
+/// in parallel. Errors are measured in ULP of the correctly rounded result: a correctly rounded function has
+/// errors up to 0.5 ULP. Unary functions can be swept over all the floats in a few minutes of processor time.
+///
+/// <glm/gtx/ulp_sweep.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/ulp.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_ulp_sweep extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_ulp_sweep
+	/// @{
+
+	/// Input of a sweep with its result and the reference result.
+	/// @see gtx_ulp_sweep
+	struct ulp_sample
+	{
+		float Input;
+		float Result;
+		double Expected;
+
+		/// Infinite when the result is NaN, or infinite, and the expected result is not
+		double Error;
+	};
+
+	/// Accuracy of a function over a sweep.
+	/// @see gtx_ulp_sweep
+	struct ulp_report
+	{
+		/// Number of largest errors kept in Worst
+		static std::size_t const WorstCount = 8;
+
+		uint64 Count;
+
+		/// Number of NaN and infinite results where the reference is finite, or the opposite
+		uint64 Mismatches;
+
+		double MaxError;
+
+		/// Mean of the finite errors
+		double MeanError;
+
+		/// Samples of the largest errors sorted by decreasing error, the first min(Count, WorstCount) are valid
+		ulp_sample Worst[WorstCount];
+	};
+
+	/// Number of floats in [Min, Max], NaN excluded, counting -0 and +0 separately.
+	/// @see gtx_ulp_sweep
+	GLM_FUNC_DECL uint64 float_count(float Min, float Max);
+
+	/// Error in ULP of Result relative to the exact result Expected.
+	/// Infinities are taken as the float after the largest finite float.
+	/// @see gtx_ulp_sweep
+	GLM_FUNC_DECL double ulp_error(float Result, double Expected);
+
+	/// Evaluates Kernel and Reference over every float of [Min, Max] when SampleCount is zero or at least
+	/// float_count(Min, Max), otherwise over one float of each of SampleCount intervals of equal float counts.
+	/// Kernel(float const * Inputs, float * Results, std::size_t Count) evaluates inputs in blocks of a multiple
+	/// of four, Reference(double) returns the exact result. Both are called concurrently from several threads.
+	/// @see gtx_ulp_sweep
+	template <typename kernel, typename reference>
+	GLM_FUNC_DECL ulp_report ulp_sweep(float Min, float Max, uint64 SampleCount, kernel const & Kernel, reference const & Reference);
+
+	/// Evaluates a scalar Kernel against a scalar Reference, see ulp_sweep.
+	/// @see gtx_ulp_sweep
+	GLM_FUNC_DECL ulp_report ulp_sweep(float Min, float Max, uint64 SampleCount, float (*Kernel)(float), double (*Reference)(double));
+
+	/// Adapts a function of four component vectors, such as the SIMD implementations of aligned types, to the kernels of ulp_sweep.
+	/// @see gtx_ulp_sweep
+	template <precision P>
+	struct ulp_vec4_kernel
+	{
+		tvec4<float, P> (*Function)(tvec4<float, P> const &);
+
+		GLM_FUNC_DECL void operator()(float const * Inputs, float * Results, std::size_t Count) const;
+	};
+
+	/// Adapts a function of scalars to the kernels of ulp_sweep.
+	/// @see gtx_ulp_sweep
+	struct ulp_scalar_kernel
+	{
+		float (*Function)(float);
+
+		GLM_FUNC_DECL void operator()(float const * Inputs, float * Results, std::size_t Count) const;
+	};
+
+	/// @}
+}//namespace glm
+
+#include "ulp_sweep.inl"
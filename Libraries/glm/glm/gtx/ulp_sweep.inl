@@ -0,0 +1,243 @@
+/// @ref gtx_ulp_sweep
+/// @file glm/gtx/ulp_sweep.inl
+
+#include "../detail/_parallel.hpp"
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace glm{
+namespace detail
+{
+	// Keys ordering floats as their values, -0 before +0 and NaN excluded
+	GLM_FUNC_QUALIFIER uint32 ulp_float_key(float x)
+	{
+		uint32 Bits = 0;
+		std::memcpy(&Bits, &x, sizeof(Bits));
+		return (Bits & 0x80000000u) ? ~Bits : (Bits | 0x80000000u);
+	}
+
+	GLM_FUNC_QUALIFIER float ulp_key_float(uint32 Key)
+	{
+		uint32 const Bits = (Key & 0x80000000u) ? (Key & 0x7FFFFFFFu) : ~Key;
+		float x = 0.0f;
+		std::memcpy(&x, &Bits, sizeof(x));
+		return x;
+	}
+
+	GLM_FUNC_QUALIFIER uint32 ulp_sample_hash(uint32 x)
+	{
+		x ^= x >> 16;
+		x *= 0x7feb352du;
+		x ^= x >> 15;
+		x *= 0x846ca68bu;
+		x ^= x >> 16;
+		return x;
+	}
+
+	// Doubles from this magnitude round to an infinite float
+	GLM_FUNC_QUALIFIER double ulp_float_overflow()
+	{
+		return std::ldexp(1.0, 128) - std::ldexp(1.0, 103);
+	}
+
+	GLM_FUNC_QUALIFIER void ulp_report_init(ulp_report & Report)
+	{
+		Report.Count = 0;
+		Report.Mismatches = 0;
+		Report.MaxError = 0.0;
+		Report.MeanError = 0.0;
+		for(std::size_t i = 0; i < ulp_report::WorstCount; ++i)
+		{
+			ulp_sample const Sample = {0.0f, 0.0f, 0.0, 0.0};
+			Report.Worst[i] = Sample;
+		}
+	}
+
+	// Inserts Sample in the largest errors of Report before Sample is counted
+	GLM_FUNC_QUALIFIER void ulp_report_worst(ulp_report & Report, ulp_sample const & Sample)
+	{
+		std::size_t Kept = Report.Count < ulp_report::WorstCount ? static_cast<std::size_t>(Report.Count) : ulp_report::WorstCount;
+		if(Kept == ulp_report::WorstCount)
+		{
+			if(!(Sample.Error > Report.Worst[Kept - 1].Error))
+				return;
+			--Kept;
+		}
+		for(; Kept > 0 && Report.Worst[Kept - 1].Error < Sample.Error; --Kept)
+			Report.Worst[Kept] = Report.Worst[Kept - 1];
+		Report.Worst[Kept] = Sample;
+	}
+
+	// Counts a sample in Report, MeanError holding the sum of the finite errors until the report is complete
+	GLM_FUNC_QUALIFIER void ulp_report_add(ulp_report & Report, ulp_sample const & Sample)
+	{
+		ulp_report_worst(Report, Sample);
+		++Report.Count;
+
+		if(Sample.Error < std::numeric_limits<double>::infinity())
+			Report.MeanError += Sample.Error;
+		else
+			++Report.Mismatches;
+		if(Sample.Error > Report.MaxError)
+			Report.MaxError = Sample.Error;
+	}
+
+	// Number of samples evaluated by each call to the kernel
+	static std::size_t const ulp_sweep_block = 4096;
+
+	template <typename kernel, typename reference>
+	struct compute_ulp_sweep
+	{
+		uint32 KeyMin;
+		uint64 Span;
+		uint64 SampleCount;
+		kernel const * Kernel;
+		reference const * Reference;
+		ulp_report * Reports;
+
+		// Key offset of the sample i, at random in its interval
+		GLM_FUNC_QUALIFIER uint64 offset(uint64 i) const
+		{
+			if(SampleCount == Span)
+				return i;
+			uint64 const Begin = Span * i / SampleCount;
+			uint64 const End = Span * (i + 1) / SampleCount;
+			return Begin + ulp_sample_hash(static_cast<uint32>(i)) % (End - Begin);
+		}
+
+		GLM_FUNC_QUALIFIER void operator()(std::size_t Begin, std::size_t End, std::size_t Job) const
+		{
+			std::vector<float> Inputs(ulp_sweep_block);
+			std::vector<float> Results(ulp_sweep_block);
+			ulp_report & Report = Reports[Job];
+
+			for(std::size_t Block = Begin; Block < End; ++Block)
+			{
+				uint64 const First = static_cast<uint64>(Block) * ulp_sweep_block;
+				std::size_t const Count = static_cast<std::size_t>(SampleCount - First < ulp_sweep_block ? SampleCount - First : ulp_sweep_block);
+				for(std::size_t i = 0; i < Count; ++i)
+					Inputs[i] = ulp_key_float(static_cast<uint32>(KeyMin + offset(First + i)));
+
+				// The last group of four repeats the last input
+				std::size_t const Padded = (Count + 3) & ~static_cast<std::size_t>(3);
+				for(std::size_t i = Count; i < Padded; ++i)
+					Inputs[i] = Inputs[Count - 1];
+
+				(*Kernel)(&Inputs[0], &Results[0], Padded);
+
+				for(std::size_t i = 0; i < Count; ++i)
+				{
+					double const Expected = (*Reference)(static_cast<double>(Inputs[i]));
+					ulp_sample const Sample = {Inputs[i], Results[i], Expected, ulp_error(Results[i], Expected)};
+					ulp_report_add(Report, Sample);
+				}
+			}
+		}
+	};
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER uint64 float_count(float Min, float Max)
+	{
+		assert(Min == Min && Max == Max);
+
+		uint32 const KeyMin = detail::ulp_float_key(Min);
+		uint32 const KeyMax = detail::ulp_float_key(Max);
+		return KeyMin <= KeyMax ? static_cast<uint64>(KeyMax - KeyMin) + 1 : 0;
+	}
+
+	GLM_FUNC_QUALIFIER double ulp_error(float Result, double Expected)
+	{
+		double const Infinity = std::numeric_limits<double>::infinity();
+		double const Overflow = detail::ulp_float_overflow();
+
+		bool const ResultNaN = Result != Result;
+		bool const ExpectedNaN = Expected != Expected;
+		bool const ResultFinite = !ResultNaN && std::abs(Result) <= std::numeric_limits<float>::max();
+		bool const ExpectedFinite = !ExpectedNaN && std::abs(Expected) < Overflow;
+		if(!ResultFinite || !ExpectedFinite)
+		{
+			if(ResultFinite != ExpectedFinite || ResultNaN != ExpectedNaN)
+				return Infinity;
+			return ResultNaN || (Result > 0.0f) == (Expected > 0.0) ? 0.0 : Infinity;
+		}
+
+		// Spacing of the floats around Expected, the spacing of denormals below the smallest normal
+		int Exponent = 0;
+		std::frexp(Expected, &Exponent);
+		int const FloatExponent = Expected != 0.0 && Exponent - 1 > -126 ? Exponent - 1 : -126;
+		double const Ulp = std::ldexp(1.0, FloatExponent - 23);
+		return std::abs(static_cast<double>(Result) - Expected) / Ulp;
+	}
+
+	template <typename kernel, typename reference>
+	GLM_FUNC_QUALIFIER ulp_report ulp_sweep(float Min, float Max, uint64 SampleCount, kernel const & Kernel, reference const & Reference)
+	{
+		ulp_report Report;
+		detail::ulp_report_init(Report);
+
+		uint64 const Span = float_count(Min, Max);
+		if(Span == 0)
+			return Report;
+		if(SampleCount == 0 || SampleCount > Span)
+			SampleCount = Span;
+
+		std::size_t const BlockCount = static_cast<std::size_t>((SampleCount + detail::ulp_sweep_block - 1) / detail::ulp_sweep_block);
+		std::size_t const Grain = 16;
+		std::vector<ulp_report> Reports(detail::parallel_jobs(BlockCount, Grain));
+		for(std::size_t i = 0; i < Reports.size(); ++i)
+			detail::ulp_report_init(Reports[i]);
+
+		detail::compute_ulp_sweep<kernel, reference> Sweep = {
+			detail::ulp_float_key(Min), Span, SampleCount, &Kernel, &Reference, &Reports[0]};
+		detail::parallel_for(BlockCount, Grain, Sweep);
+
+		// The sums of the finite errors are merged as the mean errors of the jobs
+		double Sum = 0.0;
+		for(std::size_t i = 0; i < Reports.size(); ++i)
+		{
+			ulp_report const & Job = Reports[i];
+			Sum += Job.MeanError;
+			Report.Mismatches += Job.Mismatches;
+			if(Job.MaxError > Report.MaxError)
+				Report.MaxError = Job.MaxError;
+
+			std::size_t const Kept = Job.Count < ulp_report::WorstCount ? static_cast<std::size_t>(Job.Count) : ulp_report::WorstCount;
+			for(std::size_t j = 0; j < Kept; ++j)
+			{
+				detail::ulp_report_worst(Report, Job.Worst[j]);
+				++Report.Count;
+			}
+			Report.Count += Job.Count - Kept;
+		}
+		Report.MeanError = Report.Count > Report.Mismatches ? Sum / static_cast<double>(Report.Count - Report.Mismatches) : 0.0;
+
+		return Report;
+	}
+
+	GLM_FUNC_QUALIFIER ulp_report ulp_sweep(float Min, float Max, uint64 SampleCount, float (*Kernel)(float), double (*Reference)(double))
+	{
+		ulp_scalar_kernel const Adapter = {Kernel};
+		return ulp_sweep(Min, Max, SampleCount, Adapter, Reference);
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER void ulp_vec4_kernel<P>::operator()(float const * Inputs, float * Results, std::size_t Count) const
+	{
+		for(std::size_t i = 0; i < Count; i += 4)
+		{
+			tvec4<float, P> const Result = Function(tvec4<float, P>(Inputs[i], Inputs[i + 1], Inputs[i + 2], Inputs[i + 3]));
+			Results[i + 0] = Result.x;
+			Results[i + 1] = Result.y;
+			Results[i + 2] = Result.z;
+			Results[i + 3] = Result.w;
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void ulp_scalar_kernel::operator()(float const * Inputs, float * Results, std::size_t Count) const
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Results[i] = Function(Inputs[i]);
+	}
+}//namespace glm
@@ -12,9 +12,104 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec1_sqrt_lowp(glm_vec4 x)
 	return _mm_mul_ss(_mm_rsqrt_ss(x), x);
 }
 
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_inversesqrt_lowp(glm_vec4 x)
+{
+	return _mm_rsqrt_ps(x);
+}
+
+// Reciprocal square root estimate refined by one Newton-Raphson step, the estimate is kept for zero and infinite inputs
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_inversesqrt_mediump(glm_vec4 x)
+{
+	glm_vec4 const isr0 = _mm_rsqrt_ps(x);
+	glm_vec4 const mul0 = _mm_mul_ps(_mm_mul_ps(x, _mm_set1_ps(0.5f)), _mm_mul_ps(isr0, isr0));
+	glm_vec4 const nwt0 = _mm_mul_ps(isr0, _mm_sub_ps(_mm_set1_ps(1.5f), mul0));
+	glm_vec4 const nan0 = _mm_cmpunord_ps(nwt0, nwt0);
+	return _mm_or_ps(_mm_and_ps(nan0, isr0), _mm_andnot_ps(nan0, nwt0));
+}
+
+// x * inversesqrt(x) with zero and infinite inputs returned as is
 GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sqrt_lowp(glm_vec4 x)
 {
-	return _mm_mul_ps(_mm_rsqrt_ps(x), x);
+	glm_vec4 const abs0 = _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+	glm_vec4 const msk0 = _mm_or_ps(_mm_cmpeq_ps(x, _mm_setzero_ps()), _mm_cmpeq_ps(abs0, _mm_castsi128_ps(_mm_set1_epi32(0x7F800000))));
+	glm_vec4 const mul0 = _mm_mul_ps(_mm_rsqrt_ps(x), x);
+	return _mm_or_ps(_mm_and_ps(msk0, x), _mm_andnot_ps(msk0, mul0));
+}
+
+// 2^x = 2^n * 2^f with n the nearest integer of x and f in [-0.5, 0.5], 2^f - 1 being approximated by the polynomial p0 f + p1 f^2 + ...
+// Results below 2^-126.5 are flushed to zero, results above 2^127.5 overflow to infinity, NaN are returned as is.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp2_reduce(glm_vec4 x, glm_vec4* f)
+{
+	glm_vec4 const clp0 = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-127.0f)), _mm_set1_ps(128.0f));
+	glm_ivec4 const int0 = _mm_cvtps_epi32(clp0);
+	*f = _mm_sub_ps(clp0, _mm_cvtepi32_ps(int0));
+	return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(int0, _mm_set1_epi32(127)), 23));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp2_finish(glm_vec4 x, glm_vec4 scl, glm_vec4 pol)
+{
+	glm_vec4 const nan0 = _mm_cmpunord_ps(x, x);
+	glm_vec4 const mul0 = _mm_mul_ps(scl, _mm_add_ps(_mm_set1_ps(1.0f), pol));
+	return _mm_or_ps(_mm_and_ps(nan0, x), _mm_andnot_ps(nan0, mul0));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp2_lowp(glm_vec4 x)
+{
+	glm_vec4 f;
+	glm_vec4 const scl0 = glm_vec4_exp2_reduce(x, &f);
+	glm_vec4 pol0 = _mm_add_ps(_mm_mul_ps(f, _mm_set1_ps(4.1698749375e-2f)), _mm_set1_ps(2.4203051192e-1f));
+	pol0 = _mm_add_ps(_mm_mul_ps(f, pol0), _mm_set1_ps(6.9576683104e-1f));
+	return glm_vec4_exp2_finish(x, scl0, _mm_mul_ps(f, pol0));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp2_mediump(glm_vec4 x)
+{
+	glm_vec4 f;
+	glm_vec4 const scl0 = glm_vec4_exp2_reduce(x, &f);
+	glm_vec4 pol0 = _mm_add_ps(_mm_mul_ps(f, _mm_set1_ps(1.1125507682e-3f)), _mm_set1_ps(9.6662825247e-3f));
+	pol0 = _mm_add_ps(_mm_mul_ps(f, pol0), _mm_set1_ps(5.5574004733e-2f));
+	pol0 = _mm_add_ps(_mm_mul_ps(f, pol0), _mm_set1_ps(2.4022350651e-1f));
+	pol0 = _mm_add_ps(_mm_mul_ps(f, pol0), _mm_set1_ps(6.9314283061e-1f));
+	return glm_vec4_exp2_finish(x, scl0, _mm_mul_ps(f, pol0));
+}
+
+// x = 2^e * m with m in [sqrt(2) / 2, sqrt(2)], log2(m) = log2((1 + s) / (1 - s)) with s = (m - 1) / (m + 1) in [-0.172, 0.172]
+// Denormals are scaled by 2^23 first. Returns the mask of the inputs that are not positive and finite.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log2_reduce(glm_vec4 x, glm_vec4* e, glm_vec4* s)
+{
+	glm_vec4 const den0 = _mm_cmplt_ps(x, _mm_set1_ps(1.17549435e-38f));
+	glm_vec4 const nrm0 = _mm_or_ps(_mm_and_ps(den0, _mm_mul_ps(x, _mm_set1_ps(8388608.0f))), _mm_andnot_ps(den0, x));
+	glm_ivec4 const bit0 = _mm_castps_si128(nrm0);
+
+	glm_vec4 const exp0 = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bit0, 23), _mm_set1_epi32(127)));
+	glm_vec4 const man0 = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bit0, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F800000)));
+
+	glm_vec4 const big0 = _mm_cmpgt_ps(man0, _mm_set1_ps(1.41421356f));
+	glm_vec4 const man1 = _mm_or_ps(_mm_and_ps(big0, _mm_mul_ps(man0, _mm_set1_ps(0.5f))), _mm_andnot_ps(big0, man0));
+	*e = _mm_add_ps(_mm_add_ps(exp0, _mm_and_ps(big0, _mm_set1_ps(1.0f))), _mm_and_ps(den0, _mm_set1_ps(-23.0f)));
+	*s = _mm_div_ps(_mm_sub_ps(man1, _mm_set1_ps(1.0f)), _mm_add_ps(man1, _mm_set1_ps(1.0f)));
+
+	glm_vec4 const inf0 = _mm_castsi128_ps(_mm_set1_epi32(0x7F800000));
+	return _mm_or_ps(_mm_cmple_ps(x, _mm_setzero_ps()), _mm_cmpnlt_ps(x, inf0));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log2_lowp(glm_vec4 x, glm_vec4* special)
+{
+	glm_vec4 e, s;
+	*special = glm_vec4_log2_reduce(x, &e, &s);
+	glm_vec4 const z = _mm_mul_ps(s, s);
+	glm_vec4 const pol0 = _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(9.8351112666e-1f)), _mm_set1_ps(2.8852616980f));
+	return _mm_add_ps(e, _mm_mul_ps(s, pol0));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log2_mediump(glm_vec4 x, glm_vec4* special)
+{
+	glm_vec4 e, s;
+	*special = glm_vec4_log2_reduce(x, &e, &s);
+	glm_vec4 const z = _mm_mul_ps(s, s);
+	glm_vec4 pol0 = _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(5.9736094438e-1f)), _mm_set1_ps(9.6155215300e-1f));
+	pol0 = _mm_add_ps(_mm_mul_ps(z, pol0), _mm_set1_ps(2.8853904656f));
+	return _mm_add_ps(e, _mm_mul_ps(s, pol0));
 }
 
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
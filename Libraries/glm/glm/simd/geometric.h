@@ -4,6 +4,7 @@
 #pragma once
 
 #include "common.h"
+#include "exponential.h"
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
@@ -77,7 +78,15 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cross(glm_vec4 v1, glm_vec4 v2)
 GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_normalize(glm_vec4 v)
 {
 	glm_vec4 const dot0 = glm_vec4_dot(v, v);
-	glm_vec4 const isr0 = _mm_rsqrt_ps(dot0);
+	glm_vec4 const sqt0 = _mm_sqrt_ps(dot0);
+	glm_vec4 const div0 = _mm_div_ps(v, sqt0);
+	return div0;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_normalize_lowp(glm_vec4 v)
+{
+	glm_vec4 const dot0 = glm_vec4_dot(v, v);
+	glm_vec4 const isr0 = glm_vec4_inversesqrt_lowp(dot0);
 	glm_vec4 const mul0 = _mm_mul_ps(v, isr0);
 	return mul0;
 }
@@ -0,0 +1,396 @@
+/// @ref simd
+/// @file glm/simd/noise.h
+
+#pragma once
+
+#include "common.h"
+#include <limits>
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_mod289(glm_vec4 x)
+{
+	glm_vec4 const c289 = _mm_set1_ps(289.0f);
+	return glm_vec4_sub(x, glm_vec4_mul(glm_vec4_floor(glm_vec4_div(x, c289)), c289));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_permute(glm_vec4 x)
+{
+	return glm_vec4_mod289(glm_vec4_mul(glm_vec4_add(glm_vec4_mul(x, _mm_set1_ps(34.0f)), _mm_set1_ps(1.0f)), x));
+}
+
+// Gradient of a corner of the simplex from its permuted index p, following gtc/noise.inl:
+// 7x7 points over a square mapped onto an octahedron, and the scale normalizing it.
+GLM_FUNC_QUALIFIER void glm_vec4_simplex3_gradient(glm_vec4 p, glm_vec4 g[3], glm_vec4 & norm)
+{
+	float const n_ = 0.142857142857f; // 1.0/7.0
+	glm_vec4 const nsx = _mm_set1_ps(n_ * 2.0f);
+	glm_vec4 const nsy = _mm_set1_ps(n_ * 0.5f - 1.0f);
+	glm_vec4 const nsz = _mm_set1_ps(n_);
+	glm_vec4 const one = _mm_set1_ps(1.0f);
+	glm_vec4 const two = _mm_set1_ps(2.0f);
+
+	glm_vec4 const j = glm_vec4_sub(p, glm_vec4_mul(_mm_set1_ps(49.0f), glm_vec4_floor(glm_vec4_mul(glm_vec4_mul(p, nsz), nsz))));
+	glm_vec4 const x_ = glm_vec4_floor(glm_vec4_mul(j, nsz));
+	glm_vec4 const y_ = glm_vec4_floor(glm_vec4_sub(j, glm_vec4_mul(_mm_set1_ps(7.0f), x_)));
+
+	glm_vec4 const gx = glm_vec4_add(glm_vec4_mul(x_, nsx), nsy);
+	glm_vec4 const gy = glm_vec4_add(glm_vec4_mul(y_, nsx), nsy);
+	glm_vec4 const h = glm_vec4_sub(glm_vec4_sub(one, glm_vec4_abs(gx)), glm_vec4_abs(gy));
+
+	glm_vec4 const sh = _mm_and_ps(_mm_cmple_ps(h, _mm_setzero_ps()), _mm_set1_ps(-1.0f));
+	g[0] = glm_vec4_add(gx, glm_vec4_mul(glm_vec4_add(glm_vec4_mul(glm_vec4_floor(gx), two), one), sh));
+	g[1] = glm_vec4_add(gy, glm_vec4_mul(glm_vec4_add(glm_vec4_mul(glm_vec4_floor(gy), two), one), sh));
+	g[2] = h;
+
+	glm_vec4 const len2 = glm_vec4_add(glm_vec4_add(glm_vec4_mul(g[0], g[0]), glm_vec4_mul(g[1], g[1])), glm_vec4_mul(h, h));
+	norm = glm_vec4_sub(_mm_set1_ps(1.79284291400159f), glm_vec4_mul(_mm_set1_ps(0.85373472095314f), len2));
+}
+
+// Contribution of one corner of the simplex to the noise of four positions, following gtc/noise.inl:
+// p is the permuted corner index and (x, y, z) the offset from the corner.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_simplex3_corner(glm_vec4 p, glm_vec4 x, glm_vec4 y, glm_vec4 z)
+{
+	glm_vec4 g[3], norm;
+	glm_vec4_simplex3_gradient(p, g, norm);
+	glm_vec4 const dot0 = glm_vec4_add(glm_vec4_add(glm_vec4_mul(g[0], x), glm_vec4_mul(g[1], y)), glm_vec4_mul(g[2], z));
+
+	glm_vec4 const d2 = glm_vec4_add(glm_vec4_add(glm_vec4_mul(x, x), glm_vec4_mul(y, y)), glm_vec4_mul(z, z));
+	glm_vec4 const m = _mm_max_ps(glm_vec4_sub(_mm_set1_ps(0.6f), d2), _mm_setzero_ps());
+	glm_vec4 const m2 = glm_vec4_mul(m, m);
+	return glm_vec4_mul(glm_vec4_mul(m2, m2), glm_vec4_mul(norm, dot0));
+}
+
+// Adds the contribution of one corner of the simplex to the gradients (r[0], r[1], r[2]) and values r[3]
+// of the noise of four positions: m^4 * g - 8 * m^3 * dot(g, x) * x and m^4 * dot(g, x).
+GLM_FUNC_QUALIFIER void glm_vec4_simplex3_corner_derivative(glm_vec4 p, glm_vec4 x, glm_vec4 y, glm_vec4 z, glm_vec4 r[4])
+{
+	glm_vec4 g[3], norm;
+	glm_vec4_simplex3_gradient(p, g, norm);
+	g[0] = glm_vec4_mul(g[0], norm);
+	g[1] = glm_vec4_mul(g[1], norm);
+	g[2] = glm_vec4_mul(g[2], norm);
+	glm_vec4 const dot0 = glm_vec4_add(glm_vec4_add(glm_vec4_mul(g[0], x), glm_vec4_mul(g[1], y)), glm_vec4_mul(g[2], z));
+
+	glm_vec4 const d2 = glm_vec4_add(glm_vec4_add(glm_vec4_mul(x, x), glm_vec4_mul(y, y)), glm_vec4_mul(z, z));
+	glm_vec4 const m = _mm_max_ps(glm_vec4_sub(_mm_set1_ps(0.6f), d2), _mm_setzero_ps());
+	glm_vec4 const m2 = glm_vec4_mul(m, m);
+	glm_vec4 const m4 = glm_vec4_mul(m2, m2);
+	glm_vec4 const t = glm_vec4_mul(_mm_set1_ps(-8.0f), glm_vec4_mul(glm_vec4_mul(m2, m), dot0));
+
+	r[0] = glm_vec4_add(r[0], glm_vec4_add(glm_vec4_mul(m4, g[0]), glm_vec4_mul(t, x)));
+	r[1] = glm_vec4_add(r[1], glm_vec4_add(glm_vec4_mul(m4, g[1]), glm_vec4_mul(t, y)));
+	r[2] = glm_vec4_add(r[2], glm_vec4_add(glm_vec4_mul(m4, g[2]), glm_vec4_mul(t, z)));
+	r[3] = glm_vec4_add(r[3], glm_vec4_mul(m4, dot0));
+}
+
+// Offsets (cx, cy, cz) of four positions from the four corners of the simplices containing them,
+// and the permuted indices p of the corners.
+GLM_FUNC_QUALIFIER void glm_vec4_simplex3_corners(glm_vec4 x, glm_vec4 y, glm_vec4 z, glm_vec4 cx[4], glm_vec4 cy[4], glm_vec4 cz[4], glm_vec4 p[4])
+{
+	glm_vec4 const one = _mm_set1_ps(1.0f);
+	glm_vec4 const c6 = _mm_set1_ps(static_cast<float>(1.0 / 6.0));
+	glm_vec4 const c3 = _mm_set1_ps(static_cast<float>(1.0 / 3.0));
+
+	// First corner
+	glm_vec4 const s = glm_vec4_add(glm_vec4_add(glm_vec4_mul(x, c3), glm_vec4_mul(y, c3)), glm_vec4_mul(z, c3));
+	glm_vec4 ix = glm_vec4_floor(glm_vec4_add(x, s));
+	glm_vec4 iy = glm_vec4_floor(glm_vec4_add(y, s));
+	glm_vec4 iz = glm_vec4_floor(glm_vec4_add(z, s));
+	glm_vec4 const t = glm_vec4_add(glm_vec4_add(glm_vec4_mul(ix, c6), glm_vec4_mul(iy, c6)), glm_vec4_mul(iz, c6));
+	glm_vec4 const x0 = glm_vec4_add(glm_vec4_sub(x, ix), t);
+	glm_vec4 const y0 = glm_vec4_add(glm_vec4_sub(y, iy), t);
+	glm_vec4 const z0 = glm_vec4_add(glm_vec4_sub(z, iz), t);
+
+	// Other corners
+	glm_vec4 const gx = _mm_and_ps(_mm_cmpge_ps(x0, y0), one);
+	glm_vec4 const gy = _mm_and_ps(_mm_cmpge_ps(y0, z0), one);
+	glm_vec4 const gz = _mm_and_ps(_mm_cmpge_ps(z0, x0), one);
+	glm_vec4 const lx = glm_vec4_sub(one, gx);
+	glm_vec4 const ly = glm_vec4_sub(one, gy);
+	glm_vec4 const lz = glm_vec4_sub(one, gz);
+	glm_vec4 const i1x = _mm_min_ps(gx, lz);
+	glm_vec4 const i1y = _mm_min_ps(gy, lx);
+	glm_vec4 const i1z = _mm_min_ps(gz, ly);
+	glm_vec4 const i2x = _mm_max_ps(gx, lz);
+	glm_vec4 const i2y = _mm_max_ps(gy, lx);
+	glm_vec4 const i2z = _mm_max_ps(gz, ly);
+
+	glm_vec4 const half = _mm_set1_ps(0.5f);
+	cx[0] = x0;
+	cy[0] = y0;
+	cz[0] = z0;
+	cx[1] = glm_vec4_add(glm_vec4_sub(x0, i1x), c6);
+	cy[1] = glm_vec4_add(glm_vec4_sub(y0, i1y), c6);
+	cz[1] = glm_vec4_add(glm_vec4_sub(z0, i1z), c6);
+	cx[2] = glm_vec4_add(glm_vec4_sub(x0, i2x), c3);
+	cy[2] = glm_vec4_add(glm_vec4_sub(y0, i2y), c3);
+	cz[2] = glm_vec4_add(glm_vec4_sub(z0, i2z), c3);
+	cx[3] = glm_vec4_sub(x0, half);
+	cy[3] = glm_vec4_sub(y0, half);
+	cz[3] = glm_vec4_sub(z0, half);
+
+	// Permutations
+	ix = glm_vec4_mod289(ix);
+	iy = glm_vec4_mod289(iy);
+	iz = glm_vec4_mod289(iz);
+	p[0] = glm_vec4_permute(glm_vec4_add(glm_vec4_permute(glm_vec4_add(glm_vec4_permute(iz), iy)), ix));
+	p[1] = glm_vec4_permute(glm_vec4_add(glm_vec4_add(glm_vec4_permute(glm_vec4_add(glm_vec4_add(glm_vec4_permute(glm_vec4_add(iz, i1z)), iy), i1y)), ix), i1x));
+	p[2] = glm_vec4_permute(glm_vec4_add(glm_vec4_add(glm_vec4_permute(glm_vec4_add(glm_vec4_add(glm_vec4_permute(glm_vec4_add(iz, i2z)), iy), i2y)), ix), i2x));
+	p[3] = glm_vec4_permute(glm_vec4_add(glm_vec4_add(glm_vec4_permute(glm_vec4_add(glm_vec4_add(glm_vec4_permute(glm_vec4_add(iz, one)), iy), one)), ix), one));
+}
+
+// 3D simplex noise of four positions stored as a structure of arrays.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_simplex3(glm_vec4 x, glm_vec4 y, glm_vec4 z)
+{
+	glm_vec4 cx[4], cy[4], cz[4], p[4];
+	glm_vec4_simplex3_corners(x, y, z, cx, cy, cz, p);
+
+	glm_vec4 const n0 = glm_vec4_simplex3_corner(p[0], cx[0], cy[0], cz[0]);
+	glm_vec4 const n1 = glm_vec4_simplex3_corner(p[1], cx[1], cy[1], cz[1]);
+	glm_vec4 const n2 = glm_vec4_simplex3_corner(p[2], cx[2], cy[2], cz[2]);
+	glm_vec4 const n3 = glm_vec4_simplex3_corner(p[3], cx[3], cy[3], cz[3]);
+
+	return glm_vec4_mul(_mm_set1_ps(42.0f), glm_vec4_add(glm_vec4_add(n0, n1), glm_vec4_add(n2, n3)));
+}
+
+// 3D simplex noise of four positions with its gradients: (r[0], r[1], r[2]) are the gradients and r[3] the values.
+GLM_FUNC_QUALIFIER void glm_vec4_simplex3_derivative(glm_vec4 x, glm_vec4 y, glm_vec4 z, glm_vec4 r[4])
+{
+	glm_vec4 cx[4], cy[4], cz[4], p[4];
+	glm_vec4_simplex3_corners(x, y, z, cx, cy, cz, p);
+
+	r[0] = r[1] = r[2] = r[3] = _mm_setzero_ps();
+	for(int i = 0; i < 4; ++i)
+		glm_vec4_simplex3_corner_derivative(p[i], cx[i], cy[i], cz[i], r);
+
+	glm_vec4 const c42 = _mm_set1_ps(42.0f);
+	for(int i = 0; i < 4; ++i)
+		r[i] = glm_vec4_mul(c42, r[i]);
+}
+
+// Normalized gradient of a corner of a cube of classic perlin noise from its permuted index h, following gtc/noise.inl
+GLM_FUNC_QUALIFIER void glm_vec4_perlin3_gradient(glm_vec4 h, glm_vec4 g[3])
+{
+	glm_vec4 const zero = _mm_setzero_ps();
+	glm_vec4 const one = _mm_set1_ps(1.0f);
+	glm_vec4 const half = _mm_set1_ps(0.5f);
+	glm_vec4 const c7 = _mm_set1_ps(static_cast<float>(1.0 / 7.0));
+
+	glm_vec4 gx = glm_vec4_mul(h, c7);
+	glm_vec4 gy = glm_vec4_sub(glm_vec4_fract(glm_vec4_mul(glm_vec4_floor(gx), c7)), half);
+	gx = glm_vec4_fract(gx);
+	glm_vec4 const gz = glm_vec4_sub(glm_vec4_sub(half, glm_vec4_abs(gx)), glm_vec4_abs(gy));
+	glm_vec4 const sz = _mm_and_ps(_mm_cmple_ps(gz, zero), one);
+	gx = glm_vec4_sub(gx, glm_vec4_mul(sz, glm_vec4_sub(_mm_and_ps(_mm_cmpge_ps(gx, zero), one), half)));
+	gy = glm_vec4_sub(gy, glm_vec4_mul(sz, glm_vec4_sub(_mm_and_ps(_mm_cmpge_ps(gy, zero), one), half)));
+
+	glm_vec4 const len2 = glm_vec4_add(glm_vec4_add(glm_vec4_mul(gx, gx), glm_vec4_mul(gy, gy)), glm_vec4_mul(gz, gz));
+	glm_vec4 const norm = glm_vec4_sub(_mm_set1_ps(1.79284291400159f), glm_vec4_mul(_mm_set1_ps(0.85373472095314f), len2));
+	g[0] = glm_vec4_mul(gx, norm);
+	g[1] = glm_vec4_mul(gy, norm);
+	g[2] = glm_vec4_mul(gz, norm);
+}
+
+// Fractional positions t and, for each corner c of the cube at (c & 1, (c >> 1) & 1, c >> 2), its gradient g[c]
+// and its noise value n[c] for four positions, following gtc/noise.inl
+GLM_FUNC_QUALIFIER void glm_vec4_perlin3_cube(glm_vec4 x, glm_vec4 y, glm_vec4 z, glm_vec4 t[3], glm_vec4 g[8][3], glm_vec4 n[8])
+{
+	glm_vec4 const one = _mm_set1_ps(1.0f);
+	glm_vec4 const Position[3] = {x, y, z};
+
+	glm_vec4 i[3][2], f[3][2];
+	for(int Axis = 0; Axis < 3; ++Axis)
+	{
+		glm_vec4 const Floor = glm_vec4_floor(Position[Axis]);
+		t[Axis] = glm_vec4_sub(Position[Axis], Floor);
+		i[Axis][0] = glm_vec4_mod289(Floor);
+		i[Axis][1] = glm_vec4_mod289(glm_vec4_add(Floor, one));
+		f[Axis][0] = t[Axis];
+		f[Axis][1] = glm_vec4_sub(t[Axis], one);
+	}
+
+	for(int c = 0; c < 8; ++c)
+	{
+		int const a = c & 1, b = (c >> 1) & 1, d = c >> 2;
+		glm_vec4 const h = glm_vec4_permute(glm_vec4_add(glm_vec4_permute(glm_vec4_add(glm_vec4_permute(i[0][a]), i[1][b])), i[2][d]));
+		glm_vec4_perlin3_gradient(h, g[c]);
+		n[c] = glm_vec4_add(glm_vec4_add(glm_vec4_mul(g[c][0], f[0][a]), glm_vec4_mul(g[c][1], f[1][b])), glm_vec4_mul(g[c][2], f[2][d]));
+	}
+}
+
+// fade(t) = t^3 * (t * (6t - 15) + 10)
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_perlin3_fade(glm_vec4 t)
+{
+	glm_vec4 const t2 = glm_vec4_mul(t, t);
+	return glm_vec4_mul(glm_vec4_mul(t2, t), glm_vec4_add(glm_vec4_mul(t, glm_vec4_sub(glm_vec4_mul(t, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f))), _mm_set1_ps(10.0f)));
+}
+
+// Trilinear interpolation of the corner values v by the faded fractional positions u
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_perlin3_mix(glm_vec4 const v[8], glm_vec4 const u[3])
+{
+	glm_vec4 const v00 = glm_vec4_mix(v[0], v[4], u[2]);
+	glm_vec4 const v10 = glm_vec4_mix(v[1], v[5], u[2]);
+	glm_vec4 const v01 = glm_vec4_mix(v[2], v[6], u[2]);
+	glm_vec4 const v11 = glm_vec4_mix(v[3], v[7], u[2]);
+	return glm_vec4_mix(glm_vec4_mix(v00, v01, u[1]), glm_vec4_mix(v10, v11, u[1]), u[0]);
+}
+
+// 3D classic perlin noise of four positions stored as a structure of arrays.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_perlin3(glm_vec4 x, glm_vec4 y, glm_vec4 z)
+{
+	glm_vec4 t[3], g[8][3], n[8];
+	glm_vec4_perlin3_cube(x, y, z, t, g, n);
+
+	glm_vec4 const u[3] = {glm_vec4_perlin3_fade(t[0]), glm_vec4_perlin3_fade(t[1]), glm_vec4_perlin3_fade(t[2])};
+	return glm_vec4_mul(_mm_set1_ps(2.2f), glm_vec4_perlin3_mix(n, u));
+}
+
+// 3D classic perlin noise of four positions with its gradients: (r[0], r[1], r[2]) are the gradients and r[3] the values.
+GLM_FUNC_QUALIFIER void glm_vec4_perlin3_derivative(glm_vec4 x, glm_vec4 y, glm_vec4 z, glm_vec4 r[4])
+{
+	glm_vec4 const one = _mm_set1_ps(1.0f);
+
+	glm_vec4 t[3], g[8][3], n[8];
+	glm_vec4_perlin3_cube(x, y, z, t, g, n);
+
+	// Derivative of the fade function 30 * t^2 * (t * (t - 2) + 1)
+	glm_vec4 u[3], du[3];
+	for(int Axis = 0; Axis < 3; ++Axis)
+	{
+		u[Axis] = glm_vec4_perlin3_fade(t[Axis]);
+		du[Axis] = glm_vec4_mul(glm_vec4_mul(_mm_set1_ps(30.0f), glm_vec4_mul(t[Axis], t[Axis])), glm_vec4_add(glm_vec4_mul(t[Axis], glm_vec4_sub(t[Axis], _mm_set1_ps(2.0f))), one));
+	}
+
+	// Trilinear interpolation of the values and of the corner gradients
+	glm_vec4 Mixed[4];
+	for(int k = 0; k < 4; ++k)
+	{
+		glm_vec4 v[8];
+		for(int c = 0; c < 8; ++c)
+			v[c] = k < 3 ? g[c][k] : n[c];
+		Mixed[k] = glm_vec4_perlin3_mix(v, u);
+	}
+
+	// Slopes of the interpolation of the values along each axis
+	glm_vec4 const k1 = glm_vec4_sub(n[1], n[0]);
+	glm_vec4 const k2 = glm_vec4_sub(n[2], n[0]);
+	glm_vec4 const k3 = glm_vec4_sub(n[4], n[0]);
+	glm_vec4 const k4 = glm_vec4_add(glm_vec4_sub(glm_vec4_sub(n[0], n[1]), n[2]), n[3]);
+	glm_vec4 const k5 = glm_vec4_add(glm_vec4_sub(glm_vec4_sub(n[0], n[2]), n[4]), n[6]);
+	glm_vec4 const k6 = glm_vec4_add(glm_vec4_sub(glm_vec4_sub(n[0], n[1]), n[4]), n[5]);
+	glm_vec4 const k7 = glm_vec4_sub(glm_vec4_add(glm_vec4_sub(glm_vec4_add(glm_vec4_sub(glm_vec4_add(glm_vec4_sub(n[1], n[0]), n[2]), n[3]), n[4]), n[5]), n[7]), n[6]);
+
+	glm_vec4 const sx = glm_vec4_add(glm_vec4_add(k1, glm_vec4_mul(k4, u[1])), glm_vec4_mul(glm_vec4_add(k6, glm_vec4_mul(k7, u[1])), u[2]));
+	glm_vec4 const sy = glm_vec4_add(glm_vec4_add(k2, glm_vec4_mul(k5, u[2])), glm_vec4_mul(glm_vec4_add(k4, glm_vec4_mul(k7, u[2])), u[0]));
+	glm_vec4 const sz = glm_vec4_add(glm_vec4_add(k3, glm_vec4_mul(k6, u[0])), glm_vec4_mul(glm_vec4_add(k5, glm_vec4_mul(k7, u[0])), u[1]));
+
+	glm_vec4 const c22 = _mm_set1_ps(2.2f);
+	r[0] = glm_vec4_mul(c22, glm_vec4_add(Mixed[0], glm_vec4_mul(du[0], sx)));
+	r[1] = glm_vec4_mul(c22, glm_vec4_add(Mixed[1], glm_vec4_mul(du[1], sy)));
+	r[2] = glm_vec4_mul(c22, glm_vec4_add(Mixed[2], glm_vec4_mul(du[2], sz)));
+	r[3] = glm_vec4_mul(c22, Mixed[3]);
+}
+
+// Distance of cellular noise: squared euclidean (0), manhattan (1) or chebyshev (2), following gtc/noise.inl
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cellular3_metric(glm_vec4 const Offset[3], int Distance)
+{
+	glm_vec4 Result = _mm_setzero_ps();
+	for(int i = 0; i < 3; ++i)
+	{
+		glm_vec4 const Abs = glm_vec4_abs(Offset[i]);
+		Result = Distance == 0 ? glm_vec4_add(Result, glm_vec4_mul(Abs, Abs)) : Distance == 1 ? glm_vec4_add(Result, Abs) : _mm_max_ps(Result, Abs);
+	}
+	return Result;
+}
+
+// Updates the distances to the closest (F1) and second closest (F2) feature points of four positions with the
+// feature point of the cell at Offset from their cells. Fraction are the positions within their cells and Base
+// the coordinates of their cells modulo 289. The cell is skipped when it is farther than F2 for all positions.
+GLM_FUNC_QUALIFIER void glm_vec4_cellular3_cell(glm_vec4 const Base[3], glm_vec4 const Fraction[3], int const Offset[3], int Distance, glm_vec4 & F1, glm_vec4 & F2)
+{
+	glm_vec4 const zero = _mm_setzero_ps();
+	glm_vec4 const one = _mm_set1_ps(1.0f);
+
+	glm_vec4 Gap[3];
+	for(int i = 0; i < 3; ++i)
+	{
+		glm_vec4 const o = _mm_set1_ps(static_cast<float>(Offset[i]));
+		Gap[i] = Offset[i] > 0 ? glm_vec4_sub(o, Fraction[i]) : Offset[i] < 0 ? glm_vec4_sub(glm_vec4_sub(Fraction[i], o), one) : zero;
+	}
+	if(_mm_movemask_ps(_mm_cmplt_ps(glm_vec4_cellular3_metric(Gap, Distance), F2)) == 0)
+		return;
+
+	glm_vec4 Cell[3];
+	for(int i = 0; i < 3; ++i)
+		Cell[i] = glm_vec4_mod289(glm_vec4_add(Base[i], _mm_set1_ps(static_cast<float>(Offset[i]))));
+	glm_vec4 const Hash = glm_vec4_permute(glm_vec4_add(glm_vec4_permute(glm_vec4_add(glm_vec4_permute(Cell[0]), Cell[1])), Cell[2]));
+
+	glm_vec4 const half = _mm_set1_ps(0.5f);
+	glm_vec4 const inv289 = _mm_set1_ps(static_cast<float>(1.0 / 289.0));
+	glm_vec4 d[3];
+	for(int i = 0; i < 3; ++i)
+	{
+		glm_vec4 const Feature = glm_vec4_mul(glm_vec4_add(glm_vec4_permute(glm_vec4_add(Hash, Cell[i])), half), inv289);
+		d[i] = glm_vec4_sub(glm_vec4_add(_mm_set1_ps(static_cast<float>(Offset[i])), Feature), Fraction[i]);
+	}
+
+	glm_vec4 const Metric = glm_vec4_cellular3_metric(d, Distance);
+	F2 = _mm_min_ps(F2, _mm_max_ps(F1, Metric));
+	F1 = _mm_min_ps(F1, Metric);
+}
+
+// 3D cellular noise of four positions, with the ring search of gtc/noise.inl: the rings of cells around the
+// cells of the positions are visited while one of the positions may have a closer feature point in them.
+// Lanes with a non finite position are searched at the origin so that they don't hold the others, and return NaN.
+GLM_FUNC_QUALIFIER void glm_vec4_cellular3(glm_vec4 x, glm_vec4 y, glm_vec4 z, int Distance, glm_vec4 & F1, glm_vec4 & F2)
+{
+	glm_vec4 const Largest = _mm_set1_ps(std::numeric_limits<float>::max());
+	glm_vec4 const Finite = _mm_and_ps(_mm_and_ps(
+		_mm_cmple_ps(glm_vec4_abs(x), Largest),
+		_mm_cmple_ps(glm_vec4_abs(y), Largest)),
+		_mm_cmple_ps(glm_vec4_abs(z), Largest));
+
+	glm_vec4 const Position[3] = {_mm_and_ps(Finite, x), _mm_and_ps(Finite, y), _mm_and_ps(Finite, z)};
+	glm_vec4 Fraction[3], Base[3];
+	for(int i = 0; i < 3; ++i)
+	{
+		glm_vec4 const Cell = glm_vec4_floor(Position[i]);
+		Fraction[i] = glm_vec4_sub(Position[i], Cell);
+		Base[i] = glm_vec4_mod289(Cell);
+	}
+
+	F1 = F2 = _mm_set1_ps(std::numeric_limits<float>::max());
+	for(int Ring = 1; ; ++Ring)
+	{
+		float const RingGap = static_cast<float>(Ring - 1);
+		if(Ring > 1 && _mm_movemask_ps(_mm_cmpgt_ps(F2, _mm_set1_ps(Distance == 0 ? RingGap * RingGap : RingGap))) == 0)
+			break;
+
+		// The first ring is visited from the center to the corners so that F2 shrinks early
+		int const Side = Ring * 2 + 1;
+		for(int Pass = 0; Pass <= (Ring == 1 ? 3 : 0); ++Pass)
+		for(int c = 0; c < Side * Side * Side; ++c)
+		{
+			int const Offset[3] = {c % Side - Ring, c / Side % Side - Ring, c / (Side * Side) - Ring};
+			int const Abs[3] = {Offset[0] < 0 ? -Offset[0] : Offset[0], Offset[1] < 0 ? -Offset[1] : Offset[1], Offset[2] < 0 ? -Offset[2] : Offset[2]};
+			if(Ring > 1 && Abs[0] != Ring && Abs[1] != Ring && Abs[2] != Ring)
+				continue;
+			if(Ring == 1 && (Abs[0] + Abs[1] + Abs[2]) != Pass)
+				continue;
+			glm_vec4_cellular3_cell(Base, Fraction, Offset, Distance, F1, F2);
+		}
+	}
+
+	if(Distance == 0)
+	{
+		F1 = _mm_sqrt_ps(F1);
+		F2 = _mm_sqrt_ps(F2);
+	}
+
+	glm_vec4 const NaN = _mm_set1_ps(std::numeric_limits<float>::quiet_NaN());
+	F1 = _mm_or_ps(_mm_and_ps(Finite, F1), _mm_andnot_ps(Finite, NaN));
+	F2 = _mm_or_ps(_mm_and_ps(Finite, F2), _mm_andnot_ps(Finite, NaN));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
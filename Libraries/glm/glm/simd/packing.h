@@ -3,6 +3,151 @@
 
 #pragma once
 
+#include "common.h"
+#include <limits>
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_select(glm_vec4 Mask, glm_vec4 a, glm_vec4 b)
+{
+	return _mm_or_ps(_mm_and_ps(Mask, a), _mm_andnot_ps(Mask, b));
+}
+
+// Smallest three encoding of four quaternions following gtc/packing.inl: the index of the largest component
+// of each normalized quaternion in Index, the three other components quantized to Max + 1 levels in c.
+GLM_FUNC_QUALIFIER void glm_vec4_quat_smallest_three(glm_vec4 x, glm_vec4 y, glm_vec4 z, glm_vec4 w, float Max, glm_uvec4 & Index, glm_uvec4 c[3])
+{
+	glm_vec4 const zero = _mm_setzero_ps();
+	glm_vec4 const one = _mm_set1_ps(1.0f);
+	glm_vec4 const half = _mm_set1_ps(0.5f);
+
+	// Null quaternions, and those with a NaN or infinite component, are packed as the identity
+	glm_vec4 const Length = _mm_sqrt_ps(glm_vec4_add(glm_vec4_add(glm_vec4_add(glm_vec4_mul(x, x), glm_vec4_mul(y, y)), glm_vec4_mul(z, z)), glm_vec4_mul(w, w)));
+	glm_vec4 const Valid = _mm_and_ps(_mm_cmpgt_ps(Length, zero), _mm_cmple_ps(Length, _mm_set1_ps(std::numeric_limits<float>::max())));
+	glm_vec4 const v[4] = {
+		glm_vec4_select(Valid, glm_vec4_div(x, Length), zero),
+		glm_vec4_select(Valid, glm_vec4_div(y, Length), zero),
+		glm_vec4_select(Valid, glm_vec4_div(z, Length), zero),
+		glm_vec4_select(Valid, glm_vec4_div(w, Length), one)};
+
+	// First component of largest magnitude
+	glm_vec4 Largest = v[0];
+	glm_vec4 Magnitude = glm_vec4_abs(v[0]);
+	glm_vec4 Position = zero;
+	for(int i = 1; i < 4; ++i)
+	{
+		glm_vec4 const Abs = glm_vec4_abs(v[i]);
+		glm_vec4 const Greater = _mm_cmpgt_ps(Abs, Magnitude);
+		Magnitude = glm_vec4_select(Greater, Abs, Magnitude);
+		Largest = glm_vec4_select(Greater, v[i], Largest);
+		Position = glm_vec4_select(Greater, _mm_set1_ps(static_cast<float>(i)), Position);
+	}
+
+	// The three other components in increasing order
+	glm_vec4 const Before1 = _mm_cmplt_ps(Position, one);
+	glm_vec4 const Before2 = _mm_cmplt_ps(Position, _mm_set1_ps(2.0f));
+	glm_vec4 const Before3 = _mm_cmplt_ps(Position, _mm_set1_ps(3.0f));
+	glm_vec4 const Smallest[3] = {
+		glm_vec4_select(Before1, v[1], v[0]),
+		glm_vec4_select(Before2, v[2], v[1]),
+		glm_vec4_select(Before3, v[3], v[2])};
+
+	glm_vec4 const Scale = glm_vec4_select(_mm_cmplt_ps(Largest, zero), _mm_set1_ps(-0.707106781186547524f), _mm_set1_ps(0.707106781186547524f));
+	for(int i = 0; i < 3; ++i)
+	{
+		glm_vec4 const t = glm_vec4_clamp(glm_vec4_add(glm_vec4_mul(Smallest[i], Scale), half), zero, one);
+		c[i] = _mm_cvttps_epi32(glm_vec4_add(glm_vec4_mul(t, _mm_set1_ps(Max)), half));
+	}
+	Index = _mm_cvttps_epi32(Position);
+}
+
+// Four quaternions (q[0], q[1], q[2], q[3]) = (x, y, z, w) decoded from their smallest three encodings
+GLM_FUNC_QUALIFIER void glm_vec4_quat_from_smallest_three(glm_uvec4 Index, glm_uvec4 const c[3], float Max, glm_vec4 q[4])
+{
+	glm_vec4 const Scale = _mm_set1_ps(1.41421356237309505f / Max);
+	glm_vec4 const Half = _mm_set1_ps(Max * 0.5f);
+	glm_vec4 const Smallest[3] = {
+		glm_vec4_mul(glm_vec4_sub(_mm_cvtepi32_ps(c[0]), Half), Scale),
+		glm_vec4_mul(glm_vec4_sub(_mm_cvtepi32_ps(c[1]), Half), Scale),
+		glm_vec4_mul(glm_vec4_sub(_mm_cvtepi32_ps(c[2]), Half), Scale)};
+
+	glm_vec4 Square = glm_vec4_sub(_mm_set1_ps(1.0f), glm_vec4_mul(Smallest[0], Smallest[0]));
+	Square = glm_vec4_sub(Square, glm_vec4_mul(Smallest[1], Smallest[1]));
+	Square = glm_vec4_sub(Square, glm_vec4_mul(Smallest[2], Smallest[2]));
+	glm_vec4 const Largest = _mm_sqrt_ps(_mm_max_ps(Square, _mm_setzero_ps()));
+
+	glm_vec4 const Position = _mm_cvtepi32_ps(Index);
+	glm_vec4 const Before1 = _mm_cmplt_ps(Position, _mm_set1_ps(1.0f));
+	glm_vec4 const Before2 = _mm_cmplt_ps(Position, _mm_set1_ps(2.0f));
+	q[0] = glm_vec4_select(_mm_cmpeq_ps(Position, _mm_setzero_ps()), Largest, Smallest[0]);
+	q[1] = glm_vec4_select(_mm_cmpeq_ps(Position, _mm_set1_ps(1.0f)), Largest, glm_vec4_select(Before1, Smallest[0], Smallest[1]));
+	q[2] = glm_vec4_select(_mm_cmpeq_ps(Position, _mm_set1_ps(2.0f)), Largest, glm_vec4_select(Before2, Smallest[1], Smallest[2]));
+	q[3] = glm_vec4_select(_mm_cmpeq_ps(Position, _mm_set1_ps(3.0f)), Largest, Smallest[2]);
+}
+
+// Four unit vectors decoded from octahedral coordinates in [-1, 1]^2, following gtc/packing.inl
+GLM_FUNC_QUALIFIER void glm_vec4_octahedral_decode(glm_vec4 x, glm_vec4 y, glm_vec4 n[3])
+{
+	glm_vec4 const zero = _mm_setzero_ps();
+	glm_vec4 const one = _mm_set1_ps(1.0f);
+	glm_vec4 const minusOne = _mm_set1_ps(-1.0f);
+
+	glm_vec4 const z = glm_vec4_sub(glm_vec4_sub(one, glm_vec4_abs(x)), glm_vec4_abs(y));
+	glm_vec4 const Fold = _mm_cmplt_ps(z, zero);
+	glm_vec4 const fx = glm_vec4_mul(glm_vec4_sub(one, glm_vec4_abs(y)), glm_vec4_select(_mm_cmpge_ps(x, zero), one, minusOne));
+	glm_vec4 const fy = glm_vec4_mul(glm_vec4_sub(one, glm_vec4_abs(x)), glm_vec4_select(_mm_cmpge_ps(y, zero), one, minusOne));
+	glm_vec4 const ux = glm_vec4_select(Fold, fx, x);
+	glm_vec4 const uy = glm_vec4_select(Fold, fy, y);
+
+	glm_vec4 const Length = _mm_sqrt_ps(glm_vec4_add(glm_vec4_add(glm_vec4_mul(ux, ux), glm_vec4_mul(uy, uy)), glm_vec4_mul(z, z)));
+	n[0] = glm_vec4_div(ux, Length);
+	n[1] = glm_vec4_div(uy, Length);
+	n[2] = glm_vec4_div(z, Length);
+}
+
+// Octahedral encoding of four directions following gtc/packing.inl: the grid coordinates in [-Max, Max],
+// among the four around the projection of each direction, which decoded direction is the closest.
+GLM_FUNC_QUALIFIER void glm_vec4_octahedral(glm_vec4 x, glm_vec4 y, glm_vec4 z, float Max, glm_ivec4 & ox, glm_ivec4 & oy)
+{
+	glm_vec4 const zero = _mm_setzero_ps();
+	glm_vec4 const one = _mm_set1_ps(1.0f);
+	glm_vec4 const minusOne = _mm_set1_ps(-1.0f);
+
+	// Null vectors, and those with a NaN or infinite component, are packed as (0, 0, 1)
+	glm_vec4 const Sum = glm_vec4_add(glm_vec4_add(glm_vec4_abs(x), glm_vec4_abs(y)), glm_vec4_abs(z));
+	glm_vec4 const Valid = _mm_and_ps(_mm_cmpgt_ps(Sum, zero), _mm_cmple_ps(Sum, _mm_set1_ps(std::numeric_limits<float>::max())));
+	glm_vec4 const ux = glm_vec4_select(Valid, x, zero);
+	glm_vec4 const uy = glm_vec4_select(Valid, y, zero);
+	glm_vec4 const uz = glm_vec4_select(Valid, z, one);
+	glm_vec4 const px = glm_vec4_div(x, Sum);
+	glm_vec4 const py = glm_vec4_div(y, Sum);
+	glm_vec4 const Fold = _mm_cmplt_ps(z, zero);
+	glm_vec4 const fx = glm_vec4_mul(glm_vec4_sub(one, glm_vec4_abs(py)), glm_vec4_select(_mm_cmpge_ps(px, zero), one, minusOne));
+	glm_vec4 const fy = glm_vec4_mul(glm_vec4_sub(one, glm_vec4_abs(px)), glm_vec4_select(_mm_cmpge_ps(py, zero), one, minusOne));
+	glm_vec4 const sx = glm_vec4_select(Valid, glm_vec4_select(Fold, fx, px), zero);
+	glm_vec4 const sy = glm_vec4_select(Valid, glm_vec4_select(Fold, fy, py), zero);
+
+	glm_vec4 const MaxValue = _mm_set1_ps(Max);
+	glm_vec4 const InvMax = _mm_set1_ps(1.0f / Max);
+	glm_vec4 const x0 = glm_vec4_floor(glm_vec4_mul(sx, MaxValue));
+	glm_vec4 const y0 = glm_vec4_floor(glm_vec4_mul(sy, MaxValue));
+	glm_vec4 Best = _mm_set1_ps(-std::numeric_limits<float>::max());
+	glm_vec4 bx = zero;
+	glm_vec4 by = zero;
+	for(int i = 0; i < 4; ++i)
+	{
+		glm_vec4 const cx = _mm_min_ps(glm_vec4_add(x0, _mm_set1_ps(static_cast<float>(i & 1))), MaxValue);
+		glm_vec4 const cy = _mm_min_ps(glm_vec4_add(y0, _mm_set1_ps(static_cast<float>(i >> 1))), MaxValue);
+		glm_vec4 n[3];
+		glm_vec4_octahedral_decode(glm_vec4_mul(cx, InvMax), glm_vec4_mul(cy, InvMax), n);
+		glm_vec4 const Dot = glm_vec4_add(glm_vec4_add(glm_vec4_mul(n[0], ux), glm_vec4_mul(n[1], uy)), glm_vec4_mul(n[2], uz));
+		glm_vec4 const Closer = _mm_cmpgt_ps(Dot, Best);
+		Best = glm_vec4_select(Closer, Dot, Best);
+		bx = glm_vec4_select(Closer, cx, bx);
+		by = glm_vec4_select(Closer, cy, by);
+	}
+	ox = _mm_cvttps_epi32(bx);
+	oy = _mm_cvttps_epi32(by);
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -3,7 +3,97 @@
 
 #pragma once
 
+#include "platform.h"
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
-#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+// Largest magnitude for which the range reduction of glm_vec4_sincos keeps full single precision.
+#define GLM_VEC4_SINCOS_MAX_ARG 8192.0f
+
+// Sine and cosine of the four components of x from a single Cody-Waite range reduction (Cephes polynomials).
+// Maximum error is 2 ULP for |x| <= GLM_VEC4_SINCOS_MAX_ARG.
+GLM_FUNC_QUALIFIER void glm_vec4_sincos(glm_vec4 x, glm_vec4* s, glm_vec4* c)
+{
+	glm_vec4 const sgn0 = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000)));
+
+	glm_vec4 sign_sin = _mm_and_ps(x, sgn0);
+	glm_vec4 const abs0 = _mm_andnot_ps(sgn0, x);
+
+	// Octant of the argument: j = (int(|x| * 4 / pi) + 1) & ~1
+	glm_ivec4 j = _mm_cvttps_epi32(_mm_mul_ps(abs0, _mm_set1_ps(1.27323954473516f)));
+	j = _mm_add_epi32(j, _mm_set1_epi32(1));
+	j = _mm_and_si128(j, _mm_set1_epi32(~1));
+	glm_vec4 const y = _mm_cvtepi32_ps(j);
+
+	glm_vec4 const swap_sin = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, _mm_set1_epi32(4)), 29));
+	glm_vec4 const poly_mask = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(j, _mm_set1_epi32(2)), _mm_setzero_si128()));
+	glm_vec4 const sign_cos = _mm_castsi128_ps(_mm_slli_epi32(_mm_andnot_si128(_mm_sub_epi32(j, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29));
+	sign_sin = _mm_xor_ps(sign_sin, swap_sin);
+
+	// Extended precision modular arithmetic: r = |x| - y * pi / 4
+	glm_vec4 r = _mm_add_ps(abs0, _mm_mul_ps(y, _mm_set1_ps(-0.78515625f)));
+	r = _mm_add_ps(r, _mm_mul_ps(y, _mm_set1_ps(-2.4187564849853515625e-4f)));
+	r = _mm_add_ps(r, _mm_mul_ps(y, _mm_set1_ps(-3.77489497744594108e-8f)));
+	glm_vec4 const z = _mm_mul_ps(r, r);
+
+	// Cosine polynomial on [-pi/4, pi/4]
+	glm_vec4 pc = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(2.443315711809948e-5f), z), _mm_set1_ps(-1.388731625493765e-3f));
+	pc = _mm_add_ps(_mm_mul_ps(pc, z), _mm_set1_ps(4.166664568298827e-2f));
+	pc = _mm_mul_ps(_mm_mul_ps(pc, z), z);
+	pc = _mm_add_ps(_mm_sub_ps(pc, _mm_mul_ps(z, _mm_set1_ps(0.5f))), _mm_set1_ps(1.0f));
+
+	// Sine polynomial on [-pi/4, pi/4]
+	glm_vec4 ps = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(-1.9515295891e-4f), z), _mm_set1_ps(8.3321608736e-3f));
+	ps = _mm_add_ps(_mm_mul_ps(ps, z), _mm_set1_ps(-1.6666654611e-1f));
+	ps = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(ps, z), r), r);
 
+	// Odd octants swap the sine and cosine polynomials
+	glm_vec4 const sin0 = _mm_or_ps(_mm_and_ps(poly_mask, ps), _mm_andnot_ps(poly_mask, pc));
+	glm_vec4 const cos0 = _mm_or_ps(_mm_and_ps(poly_mask, pc), _mm_andnot_ps(poly_mask, ps));
+
+	*s = _mm_xor_ps(sin0, sign_sin);
+	*c = _mm_xor_ps(cos0, sign_cos);
+}
+
+// x = n * pi / 2 + r with r in [-pi / 4, pi / 4] for the sine and cosine polynomials of the lowp and mediump tiers,
+// returns the mask of the arguments out of [-GLM_VEC4_SINCOS_MAX_ARG, GLM_VEC4_SINCOS_MAX_ARG] and NaN.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sincos_reduce(glm_vec4 x, glm_ivec4* n, glm_vec4* r)
+{
+	*n = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(0.636619772f)));
+	glm_vec4 const q = _mm_cvtepi32_ps(*n);
+
+	glm_vec4 red0 = _mm_sub_ps(x, _mm_mul_ps(q, _mm_set1_ps(1.5703125f)));
+	red0 = _mm_sub_ps(red0, _mm_mul_ps(q, _mm_set1_ps(4.837512969970703125e-4f)));
+	*r = _mm_sub_ps(red0, _mm_mul_ps(q, _mm_set1_ps(7.54978995489188216e-8f)));
+
+	glm_vec4 const abs0 = _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+	return _mm_cmpnle_ps(abs0, _mm_set1_ps(GLM_VEC4_SINCOS_MAX_ARG));
+}
+
+// sin(n * pi / 2 + r) from the sine and cosine of r
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sincos_select(glm_ivec4 n, glm_vec4 s, glm_vec4 c)
+{
+	glm_vec4 const swp0 = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(n, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+	glm_vec4 const sgn0 = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(n, _mm_set1_epi32(2)), 30));
+	return _mm_xor_ps(_mm_or_ps(_mm_and_ps(swp0, c), _mm_andnot_ps(swp0, s)), sgn0);
+}
+
+GLM_FUNC_QUALIFIER void glm_vec4_sincos_poly_lowp(glm_vec4 r, glm_vec4* s, glm_vec4* c)
+{
+	glm_vec4 const z = _mm_mul_ps(r, r);
+	*s = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, z), _mm_set1_ps(-1.6160110139e-1f)));
+	glm_vec4 const pol0 = _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(4.0608046754e-2f)), _mm_set1_ps(-4.9986968659e-1f));
+	*c = _mm_add_ps(_mm_set1_ps(1.0f), _mm_mul_ps(z, pol0));
+}
+
+GLM_FUNC_QUALIFIER void glm_vec4_sincos_poly_mediump(glm_vec4 r, glm_vec4* s, glm_vec4* c)
+{
+	glm_vec4 const z = _mm_mul_ps(r, r);
+	glm_vec4 const pol0 = _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(8.1817131403e-3f)), _mm_set1_ps(-1.6664799339e-1f));
+	*s = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, z), pol0));
+	glm_vec4 pol1 = _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(-1.3642348325e-3f)), _mm_set1_ps(4.1660503436e-2f));
+	pol1 = _mm_add_ps(_mm_mul_ps(z, pol1), _mm_set1_ps(-4.9999979761e-1f));
+	*c = _mm_add_ps(_mm_set1_ps(1.0f), _mm_mul_ps(z, pol1));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,374 @@
+#include <glm/common.hpp>
+#include <glm/exponential.hpp>
+#include <glm/geometric.hpp>
+#include <glm/trigonometric.hpp>
+#include <glm/matrix.hpp>
+#include <glm/mat4x4.hpp>
+#include <vector>
+#include <limits>
+#include <cmath>
+#include <ctime>
+#include <cstdio>
+
+namespace
+{
+	struct op_sqrt
+	{
+		static char const * name() {return "sqrt";}
+		static double ref(double x) {return std::sqrt(x);}
+		template <glm::precision P>
+		glm::tvec4<float, P> operator()(glm::tvec4<float, P> const & v) const {return glm::sqrt(v);}
+	};
+
+	struct op_inversesqrt
+	{
+		static char const * name() {return "inversesqrt";}
+		static double ref(double x) {return 1.0 / std::sqrt(x);}
+		template <glm::precision P>
+		glm::tvec4<float, P> operator()(glm::tvec4<float, P> const & v) const {return glm::inversesqrt(v);}
+	};
+
+	struct op_exp
+	{
+		static char const * name() {return "exp";}
+		static double ref(double x) {return std::exp(x);}
+		template <glm::precision P>
+		glm::tvec4<float, P> operator()(glm::tvec4<float, P> const & v) const {return glm::exp(v);}
+	};
+
+	struct op_exp2
+	{
+		static char const * name() {return "exp2";}
+		static double ref(double x) {return std::pow(2.0, x);}
+		template <glm::precision P>
+		glm::tvec4<float, P> operator()(glm::tvec4<float, P> const & v) const {return glm::exp2(v);}
+	};
+
+	struct op_log
+	{
+		static char const * name() {return "log";}
+		static double ref(double x) {return std::log(x);}
+		template <glm::precision P>
+		glm::tvec4<float, P> operator()(glm::tvec4<float, P> const & v) const {return glm::log(v);}
+	};
+
+	struct op_log2
+	{
+		static char const * name() {return "log2";}
+		static double ref(double x) {return std::log(x) / std::log(2.0);}
+		template <glm::precision P>
+		glm::tvec4<float, P> operator()(glm::tvec4<float, P> const & v) const {return glm::log2(v);}
+	};
+
+	struct op_sin
+	{
+		static char const * name() {return "sin";}
+		static double ref(double x) {return std::sin(x);}
+		template <glm::precision P>
+		glm::tvec4<float, P> operator()(glm::tvec4<float, P> const & v) const {return glm::sin(v);}
+	};
+
+	struct op_cos
+	{
+		static char const * name() {return "cos";}
+		static double ref(double x) {return std::cos(x);}
+		template <glm::precision P>
+		glm::tvec4<float, P> operator()(glm::tvec4<float, P> const & v) const {return glm::cos(v);}
+	};
+
+	// Reciprocal through the vector division
+	struct op_divide
+	{
+		static char const * name() {return "divide";}
+		static double ref(double x) {return 1.0 / x;}
+		template <glm::precision P>
+		glm::tvec4<float, P> operator()(glm::tvec4<float, P> const & v) const {return glm::tvec4<float, P>(1.0f) / v;}
+	};
+
+	// Length of the vectors (x, x / 2, x / 3, x / 4) of each component x
+	struct op_length
+	{
+		static char const * name() {return "length";}
+		static double ref(double x) {return x * std::sqrt(1.0 + 1.0 / 4.0 + 1.0 / 9.0 + 1.0 / 16.0);}
+		template <glm::precision P>
+		glm::tvec4<float, P> operator()(glm::tvec4<float, P> const & v) const
+		{
+			glm::tvec4<float, P> const Scale(1.0f, 0.5f, 1.0f / 3.0f, 0.25f);
+			return glm::tvec4<float, P>(
+				glm::length(Scale * v.x),
+				glm::length(Scale * v.y),
+				glm::length(Scale * v.z),
+				glm::length(Scale * v.w));
+		}
+	};
+
+	// First component of the normalized vectors (x, x / 2, x / 3, x / 4) of each component x
+	struct op_normalize
+	{
+		static char const * name() {return "normalize";}
+		static double ref(double) {return 1.0 / std::sqrt(1.0 + 1.0 / 4.0 + 1.0 / 9.0 + 1.0 / 16.0);}
+		template <glm::precision P>
+		glm::tvec4<float, P> operator()(glm::tvec4<float, P> const & v) const
+		{
+			glm::tvec4<float, P> const Scale(1.0f, 0.5f, 1.0f / 3.0f, 0.25f);
+			return glm::tvec4<float, P>(
+				glm::normalize(Scale * v.x).x,
+				glm::normalize(Scale * v.y).x,
+				glm::normalize(Scale * v.z).x,
+				glm::normalize(Scale * v.w).x);
+		}
+	};
+
+	// First diagonal element of the inverse of the scaling matrices with a translation of each component x
+	struct op_inverse
+	{
+		static char const * name() {return "inverse";}
+		static double ref(double x) {return 1.0 / x;}
+		template <glm::precision P>
+		static float call(float x)
+		{
+			glm::tmat4x4<float, P> m(x);
+			m[3] = glm::tvec4<float, P>(1.0f, 2.0f, 3.0f, 1.0f);
+			return glm::inverse(m)[0].x;
+		}
+		template <glm::precision P>
+		glm::tvec4<float, P> operator()(glm::tvec4<float, P> const & v) const
+		{
+			return glm::tvec4<float, P>(call<P>(v.x), call<P>(v.y), call<P>(v.z), call<P>(v.w));
+		}
+	};
+
+	// Inputs of the sweeps, geometric or uniform
+	struct domain
+	{
+		double Min;
+		double Max;
+		bool Geometric;
+		bool Relative;
+	};
+
+	std::size_t const SampleCount = 1 << 16;
+
+	std::vector<float> samples(domain const & Domain)
+	{
+		std::vector<float> Samples(SampleCount);
+		for(std::size_t i = 0; i < SampleCount; ++i)
+		{
+			double const t = static_cast<double>(i) / static_cast<double>(SampleCount - 1);
+			Samples[i] = static_cast<float>(Domain.Geometric
+				? Domain.Min * std::pow(Domain.Max / Domain.Min, t)
+				: Domain.Min + (Domain.Max - Domain.Min) * t);
+		}
+		return Samples;
+	}
+
+	// Maximum relative error, or absolute error below one and relative error above, over the sweep
+	template <glm::precision P, typename op>
+	double max_error(domain const & Domain)
+	{
+		std::vector<float> const Samples = samples(Domain);
+
+		double Error = 0.0;
+		for(std::size_t i = 0; i < SampleCount; i += 4)
+		{
+			glm::tvec4<float, P> const Result = op()(glm::tvec4<float, P>(Samples[i], Samples[i + 1], Samples[i + 2], Samples[i + 3]));
+			for(glm::length_t j = 0; j < 4; ++j)
+			{
+				double const Expected = op::ref(static_cast<double>(Samples[i + j]));
+				double const Delta = std::abs(static_cast<double>(Result[j]) - Expected);
+				double const Current = Delta / (Domain.Relative ? std::abs(Expected) : glm::max(std::abs(Expected), 1.0));
+				if(!(Current <= Error))
+					Error = Current;
+			}
+		}
+		return Error;
+	}
+
+	// Nanoseconds per vector, best of a few runs
+	template <glm::precision P, typename op>
+	double measure_time(domain const & Domain)
+	{
+		std::vector<float> const Samples = samples(Domain);
+		std::vector<glm::tvec4<float, P> > Inputs(SampleCount / 4);
+		for(std::size_t i = 0; i < Inputs.size(); ++i)
+			Inputs[i] = glm::tvec4<float, P>(Samples[i * 4], Samples[i * 4 + 1], Samples[i * 4 + 2], Samples[i * 4 + 3]);
+
+		// Offset of the outputs so that stores don't alias the loads of the next inputs
+		std::size_t const Offset = 5;
+		std::vector<glm::tvec4<float, P> > Outputs(Inputs.size() + Offset);
+
+		std::size_t const Repeat = 4;
+		double Best = 0.0;
+		for(std::size_t Run = 0; Run < 5; ++Run)
+		{
+			std::clock_t const TimeStart = std::clock();
+			for(std::size_t k = 0; k < Repeat; ++k)
+			for(std::size_t i = 0; i < Inputs.size(); ++i)
+				Outputs[i + Offset] = op()(Inputs[i]);
+			std::clock_t const TimeEnd = std::clock();
+
+			double const Time = static_cast<double>(TimeEnd - TimeStart) / static_cast<double>(CLOCKS_PER_SEC) * 1e9 / static_cast<double>(Repeat * Inputs.size());
+			Best = Run == 0 ? Time : glm::min(Best, Time);
+		}
+
+		// Keeps the loop alive
+		if(Outputs[Offset].x == 1.0f)
+			std::printf(" ");
+
+		return Best;
+	}
+
+	// Error bounds documented by precision_tier, for highp, mediump and lowp
+	struct bounds
+	{
+		double Tier[3];
+	};
+
+	template <glm::precision Highp, glm::precision Mediump, glm::precision Lowp, typename op>
+	int test_op(char const * Layout, domain const & Domain, bounds const & Bounds)
+	{
+		int Error = 0;
+
+		double const Errors[3] = {max_error<Highp, op>(Domain), max_error<Mediump, op>(Domain), max_error<Lowp, op>(Domain)};
+		double const Times[3] = {measure_time<Highp, op>(Domain), measure_time<Mediump, op>(Domain), measure_time<Lowp, op>(Domain)};
+
+		std::printf("| %-6s | %-11s | %-3s |", Layout, op::name(), Domain.Relative ? "rel" : "abs");
+		for(std::size_t i = 0; i < 3; ++i)
+		{
+			std::printf(" %8.1e %6.2f ns |", Errors[i], Times[i]);
+			Error += Errors[i] <= Bounds.Tier[i] ? 0 : 1;
+		}
+		std::printf("\n");
+
+		return Error;
+	}
+
+	template <glm::precision Highp, glm::precision Mediump, glm::precision Lowp>
+	int test_layout(char const * Layout)
+	{
+		int Error = 0;
+
+		domain const Positive = {1e-6, 1e6, true, true};
+		domain const Exp = {-80.0, 80.0, false, true};
+		domain const Exp2 = {-120.0, 120.0, false, true};
+		domain const Log = {1e-30, 1e30, true, false};
+		domain const Angle = {-100.0, 100.0, false, false};
+		domain const Scale = {1e-3, 1e3, true, true};
+
+		bounds const Sqrt = {{2e-7, 2e-7, 5e-4}};
+		bounds const Reciprocal = {{2e-7, 5e-7, 5e-4}};
+		// Without C++11 exp2 is computed with exp
+		bounds const ExpBounds = {{5e-6, 1e-5, 1e-3}};
+		bounds const LogBounds = {{2e-7, 5e-7, 5e-5}};
+		bounds const Trig = {{1e-7, 5e-6, 1e-3}};
+		bounds const Geometric = {{5e-7, 5e-7, 5e-4}};
+
+		Error += test_op<Highp, Mediump, Lowp, op_sqrt>(Layout, Positive, Sqrt);
+		Error += test_op<Highp, Mediump, Lowp, op_inversesqrt>(Layout, Positive, Reciprocal);
+		Error += test_op<Highp, Mediump, Lowp, op_exp>(Layout, Exp, ExpBounds);
+		Error += test_op<Highp, Mediump, Lowp, op_exp2>(Layout, Exp2, ExpBounds);
+		Error += test_op<Highp, Mediump, Lowp, op_log>(Layout, Log, LogBounds);
+		Error += test_op<Highp, Mediump, Lowp, op_log2>(Layout, Log, LogBounds);
+		Error += test_op<Highp, Mediump, Lowp, op_sin>(Layout, Angle, Trig);
+		Error += test_op<Highp, Mediump, Lowp, op_cos>(Layout, Angle, Trig);
+		Error += test_op<Highp, Mediump, Lowp, op_divide>(Layout, Scale, Reciprocal);
+		Error += test_op<Highp, Mediump, Lowp, op_length>(Layout, Scale, Geometric);
+		Error += test_op<Highp, Mediump, Lowp, op_normalize>(Layout, Scale, Geometric);
+		Error += test_op<Highp, Mediump, Lowp, op_inverse>(Layout, Scale, Reciprocal);
+
+		return Error;
+	}
+}//namespace
+
+// Special values keep their meaning at every tier
+int test_special_values()
+{
+	int Error = 0;
+
+	float const Inf = std::numeric_limits<float>::infinity();
+
+	Error += glm::sqrt(glm::lowp_vec2(0.0f, Inf)) == glm::lowp_vec2(0.0f, Inf) ? 0 : 1;
+	Error += glm::sqrt(glm::mediump_vec2(0.0f, Inf)) == glm::mediump_vec2(0.0f, Inf) ? 0 : 1;
+	Error += glm::inversesqrt(glm::lowp_vec2(0.0f, Inf)) == glm::lowp_vec2(Inf, 0.0f) ? 0 : 1;
+	Error += glm::inversesqrt(glm::mediump_vec2(0.0f, Inf)) == glm::mediump_vec2(Inf, 0.0f) ? 0 : 1;
+	Error += glm::exp(glm::lowp_vec3(0.0f, -Inf, Inf)) == glm::lowp_vec3(1.0f, 0.0f, Inf) ? 0 : 1;
+	Error += glm::exp2(glm::mediump_vec3(0.0f, -200.0f, 200.0f)) == glm::mediump_vec3(1.0f, 0.0f, Inf) ? 0 : 1;
+	Error += glm::log2(glm::lowp_vec3(1.0f, 0.0f, Inf)) == glm::lowp_vec3(0.0f, -Inf, Inf) ? 0 : 1;
+	Error += glm::log(glm::mediump_vec2(1.0f, 0.0f)) == glm::mediump_vec2(0.0f, -Inf) ? 0 : 1;
+	Error += glm::sin(glm::lowp_vec1(0.0f)) == glm::lowp_vec1(0.0f) ? 0 : 1;
+	Error += glm::cos(glm::mediump_vec1(0.0f)) == glm::mediump_vec1(1.0f) ? 0 : 1;
+
+	// Denormals
+	Error += std::abs(glm::log2(glm::mediump_vec1(1e-40f)).x - static_cast<float>(std::log(1e-40) / std::log(2.0))) < 1e-4f ? 0 : 1;
+
+	// Double precision is always computed at highp accuracy
+	Error += glm::sin(glm::tvec1<double, glm::lowp>(1.0)).x == std::sin(1.0) ? 0 : 1;
+
+#	if GLM_HAS_ALIGNED_TYPE
+		typedef glm::tvec4<float, glm::aligned_lowp> aligned_lowp_vec4;
+		typedef glm::tvec4<float, glm::aligned_mediump> aligned_mediump_vec4;
+
+		aligned_lowp_vec4 const LowpSqrt = glm::sqrt(aligned_lowp_vec4(0.0f, Inf, 4.0f, 4.0f));
+		Error += LowpSqrt.x == 0.0f && LowpSqrt.y == Inf ? 0 : 1;
+		aligned_mediump_vec4 const MediumpSqrt = glm::sqrt(aligned_mediump_vec4(0.0f, Inf, 4.0f, 4.0f));
+		Error += MediumpSqrt.x == 0.0f && MediumpSqrt.y == Inf ? 0 : 1;
+		aligned_mediump_vec4 const Inversesqrt = glm::inversesqrt(aligned_mediump_vec4(0.0f, Inf, 4.0f, 4.0f));
+		Error += Inversesqrt.x == Inf && Inversesqrt.y == 0.0f ? 0 : 1;
+		aligned_mediump_vec4 const Divide = aligned_mediump_vec4(1.0f) / aligned_mediump_vec4(0.0f, Inf, 4.0f, 4.0f);
+		Error += Divide.x == Inf && Divide.y == 0.0f ? 0 : 1;
+#	endif//GLM_HAS_ALIGNED_TYPE
+
+	return Error;
+}
+
+// The SIMD inverse may write to its input
+int test_inverse_in_place()
+{
+	int Error = 0;
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT && GLM_HAS_UNRESTRICTED_UNIONS
+		glm::mat4 const m(
+			2.0f, 0.5f, 0.0f, 0.0f,
+			0.0f, 3.0f, 1.0f, 0.0f,
+			1.0f, 0.0f, 4.0f, 0.0f,
+			1.0f, 2.0f, 3.0f, 1.0f);
+		glm::mat4 const Expected = glm::inverse(m);
+
+		glm_vec4 Data[4] = {
+			_mm_loadu_ps(&m[0].x), _mm_loadu_ps(&m[1].x), _mm_loadu_ps(&m[2].x), _mm_loadu_ps(&m[3].x)};
+		glm_mat4_inverse(Data, Data);
+		for(glm::length_t i = 0; i < 4; ++i)
+		{
+			glm::vec4 Column;
+			_mm_storeu_ps(&Column.x, Data[i]);
+			Error += glm::length(Column - Expected[i]) < 1e-5f ? 0 : 1;
+		}
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT && GLM_HAS_UNRESTRICTED_UNIONS
+
+	return Error;
+}
+
+// Maximum error and time per vector of four components of each function, for each precision qualifier
+int test_tiers()
+{
+	int Error = 0;
+
+	std::printf("| layout | function    |     | highp               | mediump             | lowp                |\n");
+	Error += test_layout<glm::packed_highp, glm::packed_mediump, glm::packed_lowp>("packed");
+#	if GLM_HAS_ALIGNED_TYPE
+		Error += test_layout<glm::aligned_highp, glm::aligned_mediump, glm::aligned_lowp>("align");
+#	endif//GLM_HAS_ALIGNED_TYPE
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_special_values();
+	Error += test_inverse_in_place();
+	Error += test_tiers();
+
+	return Error;
+}
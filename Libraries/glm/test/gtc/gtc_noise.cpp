@@ -1,6 +1,11 @@
 #include <glm/gtc/noise.hpp>
+#include <glm/gtc/epsilon.hpp>
 #include <gli/gli.hpp>
 #include <gli/gtx/loader.hpp>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <limits>
 
 std::size_t const Size = 64;
 
@@ -172,11 +177,264 @@ int test_perlin_pedioric()
 	return 0;
 }
 
+int test_simplex_batch()
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> Positions;
+	for(int i = 0; i < 1001; ++i)
+		Positions.push_back(glm::vec3(glm::sin(i * 0.1f), i * 0.037f - 10.0f, glm::cos(i * 0.23f) * 300.0f));
+
+	std::vector<float> Values(Positions.size());
+	glm::simplex(&Positions[0], &Values[0], Positions.size());
+
+	for(std::size_t i = 0; i < Positions.size(); ++i)
+		Error += glm::abs(Values[i] - glm::simplex(Positions[i])) < 1e-4f ? 0 : 1;
+
+	return Error;
+}
+
+int test_perlin_batch()
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> Positions;
+	for(int i = 0; i < 1001; ++i)
+		Positions.push_back(glm::vec3(glm::sin(i * 0.1f), i * 0.037f - 10.0f, glm::cos(i * 0.23f) * 300.0f));
+
+	std::vector<float> Values(Positions.size());
+	glm::perlin(&Positions[0], &Values[0], Positions.size());
+
+	for(std::size_t i = 0; i < Positions.size(); ++i)
+		Error += glm::abs(Values[i] - glm::perlin(Positions[i])) < 1e-4f ? 0 : 1;
+
+	return Error;
+}
+
+namespace
+{
+	// Positions away from the lattice planes, where the choice of simplex makes the noise only piecewise smooth
+	glm::dvec3 samplePosition(int i)
+	{
+		return glm::dvec3(std::sin(i * 0.37) * 13.0 + 0.013, i * 0.0113 - 7.0031, std::cos(i * 0.71) * 5.0 + 0.021);
+	}
+
+	template <typename genType>
+	glm::dvec3 centralDifference(genType Noise, glm::dvec3 const & Position, double Step)
+	{
+		glm::dvec3 Gradient;
+		for(glm::length_t Axis = 0; Axis < 3; ++Axis)
+		{
+			glm::dvec3 Offset(0);
+			Offset[Axis] = Step;
+			Gradient[Axis] = (Noise(Position + Offset) - Noise(Position - Offset)) / (2.0 * Step);
+		}
+		return Gradient;
+	}
+
+	double simplex3(glm::dvec3 const & Position)
+	{
+		return glm::simplex(Position);
+	}
+
+	double perlin3(glm::dvec3 const & Position)
+	{
+		return glm::perlin(Position);
+	}
+}//namespace
+
+namespace
+{
+	// Distances to the two closest feature points of the 7^L cells around the position
+	template <typename vecType>
+	glm::vec2 cellularReference(vecType const & Position, glm::cellular_distance Distance)
+	{
+		vecType const Cell = glm::floor(Position);
+		vecType const Base = glm::detail::mod289(Cell);
+
+		int Count = 1;
+		for(glm::length_t i = 0; i < vecType::length(); ++i)
+			Count *= 7;
+
+		std::vector<float> Distances;
+		for(int c = 0; c < Count; ++c)
+		{
+			vecType Offset;
+			int Code = c;
+			for(glm::length_t i = 0; i < vecType::length(); ++i, Code /= 7)
+				Offset[i] = static_cast<float>(Code % 7 - 3);
+			vecType const Feature = glm::detail::cellular_feature(glm::detail::mod289(Base + Offset));
+			Distances.push_back(glm::detail::cellular_metric(Cell + Offset + Feature - Position, Distance));
+		}
+		std::sort(Distances.begin(), Distances.end());
+
+		glm::vec2 const Result(Distances[0], Distances[1]);
+		return Distance == glm::euclidean_distance ? glm::sqrt(Result) : Result;
+	}
+}//namespace
+
+int test_cellular()
+{
+	int Error = 0;
+
+	for(int Metric = 0; Metric < 3; ++Metric)
+	{
+		glm::cellular_distance const Distance = static_cast<glm::cellular_distance>(Metric);
+		for(int i = 0; i < 500; ++i)
+		{
+			glm::vec4 const Position(std::sin(i * 0.3f) * 40.0f, std::cos(i * 0.17f) * 30.0f, i * 0.05f, std::sin(i * 0.9f) * 3.0f);
+
+			glm::vec2 const F2D = glm::cellular(glm::vec2(Position), Distance);
+			glm::vec2 const F3D = glm::cellular(glm::vec3(Position), Distance);
+			Error += F2D.x <= F2D.y && F3D.x <= F3D.y ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(F2D, cellularReference(glm::vec2(Position), Distance), 1e-5f)) ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(F3D, cellularReference(glm::vec3(Position), Distance), 1e-5f)) ? 0 : 1;
+			if(i % 10 == 0)
+				Error += glm::all(glm::epsilonEqual(glm::cellular(Position, Distance), cellularReference(Position, Distance), 1e-5f)) ? 0 : 1;
+		}
+
+		std::vector<glm::vec3> Positions;
+		for(int i = 0; i < 1001; ++i)
+			Positions.push_back(glm::vec3(std::sin(i * 0.1f), i * 0.037f - 10.0f, std::cos(i * 0.23f) * 300.0f));
+		std::vector<glm::vec2> Results(Positions.size());
+		glm::cellular(&Positions[0], &Results[0], Positions.size(), Distance);
+		for(std::size_t i = 0; i < Positions.size(); ++i)
+			Error += glm::all(glm::epsilonEqual(Results[i], glm::cellular(Positions[i], Distance), 1e-5f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int test_cellular_non_finite()
+{
+	int Error = 0;
+
+	float const NaN = std::numeric_limits<float>::quiet_NaN();
+	float const Inf = std::numeric_limits<float>::infinity();
+	for(int Metric = 0; Metric < 3; ++Metric)
+	{
+		glm::cellular_distance const Distance = static_cast<glm::cellular_distance>(Metric);
+		Error += glm::all(glm::isnan(glm::cellular(glm::vec2(NaN, 0.0f), Distance))) ? 0 : 1;
+		Error += glm::all(glm::isnan(glm::cellular(glm::vec3(NaN, 0.0f, 0.0f), Distance))) ? 0 : 1;
+		Error += glm::all(glm::isnan(glm::cellular(glm::vec3(0.0f, Inf, 0.0f), Distance))) ? 0 : 1;
+		Error += glm::all(glm::isnan(glm::cellular(glm::vec4(0.0f, 1.0f, 2.0f, -Inf), Distance))) ? 0 : 1;
+		Error += glm::all(glm::isnan(glm::cellular(glm::dvec3(0.0, 1.0, std::numeric_limits<double>::quiet_NaN()), Distance))) ? 0 : 1;
+
+		// A non finite lane doesn't affect the other lanes of its group
+		glm::vec3 const Positions[6] = {
+			glm::vec3(0.5f, 1.5f, 2.5f), glm::vec3(NaN, 0.0f, 0.0f), glm::vec3(3.25f, -1.0f, 7.0f),
+			glm::vec3(0.0f, 0.0f, Inf), glm::vec3(-Inf, NaN, Inf), glm::vec3(10.0f, 20.0f, 30.0f)};
+		glm::vec2 Results[6];
+		glm::cellular(Positions, Results, 6, Distance);
+		for(std::size_t i = 0; i < 6; ++i)
+		{
+			bool const Finite = i == 0 || i == 2 || i == 5;
+			Error += Finite == !glm::any(glm::isnan(Results[i])) ? 0 : 1;
+			if(Finite)
+				Error += glm::all(glm::epsilonEqual(Results[i], glm::cellular(Positions[i], Distance), 1e-5f)) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+int test_simplex_derivative()
+{
+	int Error = 0;
+
+	for(int i = 0; i < 1000; ++i)
+	{
+		glm::dvec3 const Position = samplePosition(i);
+		glm::dvec4 const Derivative = glm::simplexDerivative(Position);
+		Error += glm::abs(Derivative.w - glm::simplex(Position)) < 1e-12 ? 0 : 1;
+		Error += glm::all(glm::lessThan(glm::abs(glm::dvec3(Derivative) - centralDifference(simplex3, Position, 1e-6)), glm::dvec3(1e-5))) ? 0 : 1;
+	}
+
+	std::vector<glm::vec3> Positions;
+	for(int i = 0; i < 1001; ++i)
+		Positions.push_back(glm::vec3(samplePosition(i)));
+	std::vector<glm::vec4> Results(Positions.size());
+	glm::simplexDerivative(&Positions[0], &Results[0], Positions.size());
+	for(std::size_t i = 0; i < Positions.size(); ++i)
+		Error += glm::all(glm::lessThan(glm::abs(Results[i] - glm::simplexDerivative(Positions[i])), glm::vec4(1e-4f))) ? 0 : 1;
+
+	return Error;
+}
+
+int test_perlin_derivative()
+{
+	int Error = 0;
+
+	for(int i = 0; i < 1000; ++i)
+	{
+		glm::dvec3 const Position = samplePosition(i);
+		glm::dvec4 const Derivative = glm::perlinDerivative(Position);
+		Error += glm::abs(Derivative.w - glm::perlin(Position)) < 1e-12 ? 0 : 1;
+		Error += glm::all(glm::lessThan(glm::abs(glm::dvec3(Derivative) - centralDifference(perlin3, Position, 1e-6)), glm::dvec3(1e-5))) ? 0 : 1;
+	}
+
+	std::vector<glm::vec3> Positions;
+	for(int i = 0; i < 1001; ++i)
+		Positions.push_back(glm::vec3(samplePosition(i)));
+	std::vector<glm::vec4> Results(Positions.size());
+	glm::perlinDerivative(&Positions[0], &Results[0], Positions.size());
+	for(std::size_t i = 0; i < Positions.size(); ++i)
+		Error += glm::all(glm::lessThan(glm::abs(Results[i] - glm::perlinDerivative(Positions[i])), glm::vec4(1e-4f))) ? 0 : 1;
+
+	return Error;
+}
+
+int test_curl()
+{
+	int Error = 0;
+
+	// Divergence free. The 0.6 radius of the simplex kernels makes the noise slightly discontinuous across
+	// some simplex faces, the differences straddling such a jump are skipped.
+	double const Step = 1e-6;
+	int Smooth = 0;
+	for(int i = 0; i < 1000; ++i)
+	{
+		glm::dvec3 const Position = samplePosition(i);
+		double Divergence = 0.0;
+		bool Continuous = true;
+		for(glm::length_t Axis = 0; Axis < 3; ++Axis)
+		{
+			glm::dvec3 Offset(0);
+			Offset[Axis] = Step;
+			glm::dvec3 const Difference = glm::curlNoise(Position + Offset) - glm::curlNoise(Position - Offset);
+			Continuous = Continuous && glm::all(glm::lessThan(glm::abs(Difference), glm::dvec3(1e-3)));
+			Divergence += Difference[Axis] / (2.0 * Step);
+		}
+		if(!Continuous)
+			continue;
+		Error += glm::abs(Divergence) < 1e-4 ? 0 : 1;
+		++Smooth;
+	}
+	Error += Smooth > 990 ? 0 : 1;
+
+	std::vector<glm::vec3> Positions;
+	for(int i = 0; i < 1001; ++i)
+		Positions.push_back(glm::vec3(samplePosition(i)));
+	std::vector<glm::vec3> Results(Positions.size());
+	glm::curlNoise(&Positions[0], &Results[0], Positions.size());
+	for(std::size_t i = 0; i < Positions.size(); ++i)
+		Error += glm::all(glm::lessThan(glm::abs(Results[i] - glm::curlNoise(Positions[i])), glm::vec3(1e-4f))) ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
 
 	Error += test_simplex();
+	Error += test_simplex_batch();
+	Error += test_perlin_batch();
+	Error += test_cellular();
+	Error += test_cellular_non_finite();
+	Error += test_simplex_derivative();
+	Error += test_perlin_derivative();
+	Error += test_curl();
 	Error += test_perlin();
 	Error += test_perlin_pedioric();
 
@@ -1,7 +1,11 @@
 #include <glm/gtc/packing.hpp>
 #include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/random.hpp>
+#include <cmath>
 #include <cstdio>
+#include <ctime>
 #include <vector>
+#include <limits>
 
 void print_bits(float const & s)
 {
@@ -642,6 +646,224 @@ int test_packUnorm2x3_1x2()
 	return Error;
 }
 
+// Angle in degrees between the rotations of a normalized quaternion and an unpacked one, in double precision
+static double rotationAngle(glm::quat const & q, glm::quat const & u)
+{
+	glm::dvec4 const a(q.x, q.y, q.z, q.w);
+	glm::dvec4 b(u.x, u.y, u.z, u.w);
+	b = glm::normalize(glm::dot(a, b) < 0.0 ? -b : b);
+	return glm::degrees(4.0 * std::asin(glm::min(glm::length(a - b) * 0.5, 1.0)));
+}
+
+static double directionAngle(glm::vec3 const & v, glm::vec3 const & u)
+{
+	glm::dvec3 const a = glm::normalize(glm::dvec3(v));
+	glm::dvec3 const b = glm::normalize(glm::dvec3(u));
+	return glm::degrees(2.0 * std::asin(glm::min(glm::length(a - b) * 0.5, 1.0)));
+}
+
+static glm::quat randomQuat()
+{
+	glm::vec4 const r = glm::gaussRand(glm::vec4(0.0f), glm::vec4(1.0f));
+	return glm::normalize(glm::quat(r.w, r.x, r.y, r.z));
+}
+
+// Unpacked components within Component of q or -q, and rotations within Angle degrees
+static int checkQuat(glm::quat const & q, glm::quat const & u, float Component, double Angle)
+{
+	glm::quat const v = glm::dot(q, u) < 0.0f ? -u : u;
+	int Error = 0;
+	for(glm::length_t i = 0; i < 4; ++i)
+		Error += glm::abs(v[i] - q[i]) <= Component ? 0 : 1;
+	Error += rotationAngle(q, u) <= Angle ? 0 : 1;
+	return Error;
+}
+
+int test_packQuatSmallestThree()
+{
+	int Error = 0;
+
+	// Axes and ties between the largest components are exact or within the quantization
+	glm::quat const Exact[] = {
+		glm::quat(1, 0, 0, 0), glm::quat(-1, 0, 0, 0), glm::quat(0, 1, 0, 0), glm::quat(0, 0, -1, 0), glm::quat(0, 0, 0, 1),
+		glm::quat(0.5f, -0.5f, 0.5f, -0.5f), glm::normalize(glm::quat(1, 1, 0, 0)), glm::normalize(glm::quat(0, 0, -1, 1))};
+	for(std::size_t i = 0; i < sizeof(Exact) / sizeof(Exact[0]); ++i)
+	{
+		Error += checkQuat(Exact[i], glm::unpackQuatSmallestThree32(glm::packQuatSmallestThree32(Exact[i])), 0.0021f, 0.27);
+		Error += checkQuat(Exact[i], glm::unpackQuatSmallestThree48(glm::packQuatSmallestThree48(Exact[i])), 0.000065f, 0.0085);
+		Error += checkQuat(Exact[i], glm::unpackQuatSmallestThree64(glm::packQuatSmallestThree64(Exact[i])), 0.000003f, 0.0003);
+	}
+	Error += glm::unpackQuatSmallestThree32(glm::packQuatSmallestThree32(glm::quat(-1, 0, 0, 0))) == glm::quat(1, 0, 0, 0) ? 0 : 1;
+
+	// Quaternions are normalized, null ones being packed as the identity
+	Error += glm::packQuatSmallestThree32(glm::quat(2, 4, -6, 8)) == glm::packQuatSmallestThree32(glm::normalize(glm::quat(2, 4, -6, 8))) ? 0 : 1;
+	Error += glm::unpackQuatSmallestThree64(glm::packQuatSmallestThree64(glm::quat(0, 0, 0, 0))) == glm::quat(1, 0, 0, 0) ? 0 : 1;
+
+	// So are quaternions with a NaN or infinite component
+	float const NaN = std::numeric_limits<float>::quiet_NaN();
+	float const Inf = std::numeric_limits<float>::infinity();
+	Error += glm::packQuatSmallestThree32(glm::quat(NaN, 0, 0, 0)) == glm::packQuatSmallestThree32(glm::quat(1, 0, 0, 0)) ? 0 : 1;
+	Error += glm::packQuatSmallestThree48(glm::quat(0, Inf, 0, 0)) == glm::packQuatSmallestThree48(glm::quat(1, 0, 0, 0)) ? 0 : 1;
+	Error += glm::packQuatSmallestThree64(glm::quat(1, 0, -Inf, NaN)) == glm::packQuatSmallestThree64(glm::quat(1, 0, 0, 0)) ? 0 : 1;
+
+	// Bounds documented in gtc/packing.hpp
+	for(int i = 0; i < 100000; ++i)
+	{
+		glm::quat const q = randomQuat();
+		Error += checkQuat(q, glm::unpackQuatSmallestThree32(glm::packQuatSmallestThree32(q)), 0.0021f, 0.27);
+		Error += checkQuat(q, glm::unpackQuatSmallestThree48(glm::packQuatSmallestThree48(q)), 0.000065f, 0.0085);
+		Error += checkQuat(q, glm::unpackQuatSmallestThree64(glm::packQuatSmallestThree64(q)), 0.000003f, 0.0003);
+	}
+
+	return Error;
+}
+
+int test_packOctahedral()
+{
+	int Error = 0;
+
+	// Axes are exact, null vectors are packed as +z
+	glm::vec3 const Axes[] = {glm::vec3(1, 0, 0), glm::vec3(-1, 0, 0), glm::vec3(0, 1, 0), glm::vec3(0, -1, 0), glm::vec3(0, 0, 1), glm::vec3(0, 0, -1)};
+	for(std::size_t i = 0; i < sizeof(Axes) / sizeof(Axes[0]); ++i)
+	{
+		Error += glm::unpackOctahedral2x8(glm::packOctahedral2x8(Axes[i])) == Axes[i] ? 0 : 1;
+		Error += glm::unpackOctahedral2x12(glm::packOctahedral2x12(Axes[i])) == Axes[i] ? 0 : 1;
+		Error += glm::unpackOctahedral2x16(glm::packOctahedral2x16(Axes[i])) == Axes[i] ? 0 : 1;
+	}
+	Error += glm::unpackOctahedral2x16(glm::packOctahedral2x16(glm::vec3(0))) == glm::vec3(0, 0, 1) ? 0 : 1;
+	float const NaN = std::numeric_limits<float>::quiet_NaN();
+	float const Inf = std::numeric_limits<float>::infinity();
+	Error += glm::unpackOctahedral2x8(glm::packOctahedral2x8(glm::vec3(NaN, 0, 0))) == glm::vec3(0, 0, 1) ? 0 : 1;
+	Error += glm::unpackOctahedral2x12(glm::packOctahedral2x12(glm::vec3(Inf, 0, 0))) == glm::vec3(0, 0, 1) ? 0 : 1;
+	Error += glm::unpackOctahedral2x16(glm::packOctahedral2x16(glm::vec3(1, -Inf, NaN))) == glm::vec3(0, 0, 1) ? 0 : 1;
+	Error += glm::packOctahedral2x12(glm::vec3(3, -4, 12)) == glm::packOctahedral2x12(glm::vec3(3, -4, 12) / 13.0f) ? 0 : 1;
+	Error += glm::packOctahedral2x12(glm::vec3(1)) < (1u << 24) ? 0 : 1;
+
+	// Bounds documented in gtc/packing.hpp
+	double Sum[3] = {0.0, 0.0, 0.0};
+	int const Count = 100000;
+	for(int i = 0; i < Count; ++i)
+	{
+		glm::vec3 const v = glm::sphericalRand(1.0f);
+		double const Angle[3] = {
+			directionAngle(v, glm::unpackOctahedral2x8(glm::packOctahedral2x8(v))),
+			directionAngle(v, glm::unpackOctahedral2x12(glm::packOctahedral2x12(v))),
+			directionAngle(v, glm::unpackOctahedral2x16(glm::packOctahedral2x16(v)))};
+		Error += Angle[0] <= 0.65 ? 0 : 1;
+		Error += Angle[1] <= 0.053 ? 0 : 1;
+		Error += Angle[2] <= 0.008 ? 0 : 1;
+		for(int k = 0; k < 3; ++k)
+			Sum[k] += Angle[k];
+	}
+	Error += Sum[0] / Count < 0.33 && Sum[1] / Count < 0.021 && Sum[2] / Count < 0.0027 ? 0 : 1;
+
+	return Error;
+}
+
+// Batches match the scalar functions bit for bit, including the tails of less than four elements
+int test_packBatch()
+{
+	int Error = 0;
+
+	std::size_t const Count = 1003;
+	std::vector<glm::quat> Quats(Count);
+	std::vector<glm::vec3> Directions(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Quats[i] = randomQuat() * (i % 7 == 0 ? 3.0f : 1.0f);
+		Directions[i] = glm::sphericalRand(i % 5 == 0 ? 0.5f : 1.0f);
+	}
+	Quats[5] = glm::quat(0, 0, 0, 0);
+	Quats[9] = glm::quat(std::numeric_limits<float>::quiet_NaN(), 0, 0, 1);
+	Quats[10] = glm::quat(0, std::numeric_limits<float>::infinity(), 0, 0);
+	Directions[6] = glm::vec3(0);
+	Directions[9] = glm::vec3(0, std::numeric_limits<float>::quiet_NaN(), 1);
+	Directions[10] = glm::vec3(-std::numeric_limits<float>::infinity(), 0, 0);
+
+	std::vector<glm::uint32> Packed32(Count);
+	std::vector<glm::u16vec3> Packed48(Count);
+	std::vector<glm::uint64> Packed64(Count);
+	std::vector<glm::quat> Unpacked32(Count), Unpacked48(Count), Unpacked64(Count);
+	glm::packQuatSmallestThree32(&Quats[0], &Packed32[0], Count);
+	glm::packQuatSmallestThree48(&Quats[0], &Packed48[0], Count);
+	glm::packQuatSmallestThree64(&Quats[0], &Packed64[0], Count);
+	glm::unpackQuatSmallestThree32(&Packed32[0], &Unpacked32[0], Count);
+	glm::unpackQuatSmallestThree48(&Packed48[0], &Unpacked48[0], Count);
+	glm::unpackQuatSmallestThree64(&Packed64[0], &Unpacked64[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += Packed32[i] == glm::packQuatSmallestThree32(Quats[i]) ? 0 : 1;
+		Error += Packed48[i] == glm::packQuatSmallestThree48(Quats[i]) ? 0 : 1;
+		Error += Packed64[i] == glm::packQuatSmallestThree64(Quats[i]) ? 0 : 1;
+		Error += Unpacked32[i] == glm::unpackQuatSmallestThree32(Packed32[i]) ? 0 : 1;
+		Error += Unpacked48[i] == glm::unpackQuatSmallestThree48(Packed48[i]) ? 0 : 1;
+		Error += Unpacked64[i] == glm::unpackQuatSmallestThree64(Packed64[i]) ? 0 : 1;
+	}
+
+	std::vector<glm::uint16> Packed8(Count);
+	std::vector<glm::uint32> Packed12(Count), Packed16(Count);
+	std::vector<glm::vec3> Unpacked8(Count), Unpacked12(Count), Unpacked16(Count);
+	glm::packOctahedral2x8(&Directions[0], &Packed8[0], Count);
+	glm::packOctahedral2x12(&Directions[0], &Packed12[0], Count);
+	glm::packOctahedral2x16(&Directions[0], &Packed16[0], Count);
+	glm::unpackOctahedral2x8(&Packed8[0], &Unpacked8[0], Count);
+	glm::unpackOctahedral2x12(&Packed12[0], &Unpacked12[0], Count);
+	glm::unpackOctahedral2x16(&Packed16[0], &Unpacked16[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += Packed8[i] == glm::packOctahedral2x8(Directions[i]) ? 0 : 1;
+		Error += Packed12[i] == glm::packOctahedral2x12(Directions[i]) ? 0 : 1;
+		Error += Packed16[i] == glm::packOctahedral2x16(Directions[i]) ? 0 : 1;
+		Error += Unpacked8[i] == glm::unpackOctahedral2x8(Packed8[i]) ? 0 : 1;
+		Error += Unpacked12[i] == glm::unpackOctahedral2x12(Packed12[i]) ? 0 : 1;
+		Error += Unpacked16[i] == glm::unpackOctahedral2x16(Packed16[i]) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int perf_packBatch()
+{
+	std::size_t const Count = 1 << 20;
+	std::vector<glm::quat> Quats(Count);
+	std::vector<glm::vec3> Directions(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Quats[i] = randomQuat();
+		Directions[i] = glm::sphericalRand(1.0f);
+	}
+	std::vector<glm::uint32> Packed(Count);
+
+	// std::clock measures the processor time
+	double const Seconds = 1.0 / static_cast<double>(CLOCKS_PER_SEC);
+	double const Millions = static_cast<double>(Count) / 1000000.0;
+	glm::uint32 Checksum = 0;
+
+	std::clock_t const Timestamp0 = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Packed[i] = glm::packQuatSmallestThree32(Quats[i]);
+	std::clock_t const Timestamp1 = std::clock();
+	glm::packQuatSmallestThree32(&Quats[0], &Packed[0], Count);
+	std::clock_t const Timestamp2 = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Checksum += glm::packOctahedral2x16(Directions[i]);
+	std::clock_t const Timestamp3 = std::clock();
+	glm::packOctahedral2x16(&Directions[0], &Packed[0], Count);
+	std::clock_t const Timestamp4 = std::clock();
+	glm::unpackOctahedral2x16(&Packed[0], &Directions[0], Count);
+	std::clock_t const Timestamp5 = std::clock();
+
+	std::printf("packQuatSmallestThree32: %.1f M/s, batch %.1f M/s\n",
+		Millions / (static_cast<double>(Timestamp1 - Timestamp0 + 1) * Seconds),
+		Millions / (static_cast<double>(Timestamp2 - Timestamp1 + 1) * Seconds));
+	std::printf("packOctahedral2x16: %.1f M/s, batch %.1f M/s, unpack batch %.1f M/s (%u)\n",
+		Millions / (static_cast<double>(Timestamp3 - Timestamp2 + 1) * Seconds),
+		Millions / (static_cast<double>(Timestamp4 - Timestamp3 + 1) * Seconds),
+		Millions / (static_cast<double>(Timestamp5 - Timestamp4 + 1) * Seconds), Checksum);
+
+	return 0;
+}
+
 int main()
 {
 	int Error = 0;
@@ -681,5 +903,10 @@ int main()
 	Error += test_Half1x16();
 	Error += test_Half4x16();
 
+	Error += test_packQuatSmallestThree();
+	Error += test_packOctahedral();
+	Error += test_packBatch();
+	Error += perf_packBatch();
+
 	return Error;
 }
@@ -0,0 +1,326 @@
+#include <glm/glm.hpp>
+
+#if GLM_HAS_ALIGNED_TYPE && GLM_HAS_ALIGNOF && GLM_HAS_CXX11_STL && !((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_COMPILER < GLM_COMPILER_VC14))
+#include <glm/gtx/allocator.hpp>
+#include <glm/gtx/sincos.hpp>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <ctime>
+#include <cstdio>
+#include <list>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	bool is_aligned(void const * Pointer, std::size_t Alignment)
+	{
+		return reinterpret_cast<std::uintptr_t>(Pointer) % Alignment == 0;
+	}
+
+	double seconds()
+	{
+		return static_cast<double>(std::clock()) / static_cast<double>(CLOCKS_PER_SEC);
+	}
+
+	double rate(std::size_t Count, double Time)
+	{
+		return static_cast<double>(Count) * 1e-3 / (Time > 0.0 ? Time : 1e-9);
+	}
+
+	// Sizes of the temporary arrays of a frame, between 16 and 4111 elements
+	std::size_t frame_size(glm::uint32 & State)
+	{
+		State = State * 1664525u + 1013904223u;
+		return 16 + (State >> 20);
+	}
+}//namespace
+
+int test_aligned_malloc()
+{
+	int Error = 0;
+
+	std::size_t const Alignments[] = {1, 8, 16, 32, 64, 4096};
+	for(std::size_t i = 0; i < sizeof(Alignments) / sizeof(Alignments[0]); ++i)
+	for(std::size_t Size = 0; Size < 100; Size += 33)
+	{
+		void * Pointer = glm::alignedMalloc(Size, Alignments[i]);
+		Error += Pointer && is_aligned(Pointer, Alignments[i]) ? 0 : 1;
+		std::memset(Pointer, 0xff, Size);
+		glm::alignedFree(Pointer);
+	}
+
+	glm::alignedFree(NULL);
+	Error += glm::alignedMalloc(static_cast<std::size_t>(-1), 16) == NULL ? 0 : 1;
+
+	return Error;
+}
+
+int test_aligned_allocator()
+{
+	int Error = 0;
+
+	Error += glm::aligned_allocator<glm::aligned_vec4>::alignment == 16 ? 0 : 1;
+	Error += glm::aligned_allocator<float, 32>::alignment == 32 ? 0 : 1;
+	Error += glm::aligned_allocator<glm::dvec4, 8>::alignment >= alignof(glm::dvec4) ? 0 : 1;
+
+	std::vector<glm::aligned_vec4, glm::aligned_allocator<glm::aligned_vec4> > Vectors;
+	for(int i = 0; i < 1000; ++i)
+	{
+		Vectors.push_back(glm::aligned_vec4(static_cast<float>(i)));
+		Error += is_aligned(Vectors.data(), 16) ? 0 : 1;
+	}
+	Error += Vectors[999].w == 999.0f ? 0 : 1;
+
+	// Arrays for 32 bytes loads, used by the batch functions
+	std::size_t const Count = 1003;
+	std::vector<float, glm::aligned_allocator<float, 32> > Angles(Count), Sines(Count), Cosines(Count);
+	Error += is_aligned(Angles.data(), 32) && is_aligned(Sines.data(), 32) && is_aligned(Cosines.data(), 32) ? 0 : 1;
+	for(std::size_t i = 0; i < Count; ++i)
+		Angles[i] = static_cast<float>(i) * 0.01f;
+	glm::sincos(Angles.data(), Sines.data(), Cosines.data(), Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += std::abs(Sines[i] - std::sin(Angles[i])) < 1e-5f && std::abs(Cosines[i] - std::cos(Angles[i])) < 1e-5f ? 0 : 1;
+
+	// Rebound to the nodes of a list
+	std::list<glm::mat4, glm::aligned_allocator<glm::mat4, 64> > Matrices(10, glm::mat4(2.0f));
+	Error += Matrices.back()[3][3] == 2.0f ? 0 : 1;
+
+	glm::aligned_allocator<float, 32> const a;
+	glm::aligned_allocator<glm::vec4, 32> const b(a);
+	Error += a == b && !(a != b) ? 0 : 1;
+
+	return Error;
+}
+
+int test_frame_arena()
+{
+	int Error = 0;
+
+	glm::frame_arena Arena(1024);
+	Error += Arena.chunks() == 0 && Arena.capacity() == 0 && Arena.used() == 0 ? 0 : 1;
+
+	// Allocations are aligned and don't overlap
+	std::vector<std::pair<unsigned char *, std::size_t> > Blocks;
+	for(std::size_t i = 0; i < 64; ++i)
+	{
+		std::size_t const Size = 1 + (i * 37) % 300;
+		std::size_t const Alignment = std::size_t(1) << (i % 8);
+		unsigned char * Block = static_cast<unsigned char *>(Arena.allocate(Size, Alignment));
+		Error += is_aligned(Block, Alignment) ? 0 : 1;
+		std::memset(Block, static_cast<int>(i), Size);
+		Blocks.push_back(std::make_pair(Block, Size));
+	}
+	for(std::size_t i = 0; i < Blocks.size(); ++i)
+	for(std::size_t j = 0; j < Blocks[i].second; ++j)
+		Error += Blocks[i].first[j] == i ? 0 : 1;
+
+	Error += Arena.chunks() > 1 ? 0 : 1;
+	Error += Arena.used() <= Arena.capacity() ? 0 : 1;
+
+	// A block larger than a chunk
+	void * Large = Arena.allocate(5000, 256);
+	Error += is_aligned(Large, 256) ? 0 : 1;
+
+	// Rewinding returns the same memory
+	glm::arena_mark const Mark = Arena.mark();
+	void * First = Arena.allocate(100, 16);
+	Arena.allocate(2000, 16);
+	Arena.rewind(Mark);
+	Error += Arena.allocate(100, 16) == First ? 0 : 1;
+
+	// Reset merges the chunks, so that the same frame doesn't allocate again
+	std::size_t const Used = Arena.used();
+	std::size_t const Capacity = Arena.capacity();
+	Arena.reset();
+	Error += Arena.chunks() == 1 && Arena.capacity() == Capacity && Arena.used() == 0 ? 0 : 1;
+	Arena.allocate(Used, 16);
+	Error += Arena.chunks() == 1 ? 0 : 1;
+
+	Error += Arena.allocate(0, 1) != NULL ? 0 : 1;
+
+	return Error;
+}
+
+int test_arena_allocator()
+{
+	int Error = 0;
+
+	glm::frame_arena Arena;
+	for(int Frame = 0; Frame < 4; ++Frame)
+	{
+		glm::arena_allocator<glm::vec4, 32> const Allocator(Arena);
+		std::vector<glm::vec4, glm::arena_allocator<glm::vec4, 32> > Vectors(Allocator);
+		for(int i = 0; i < 5000; ++i)
+		{
+			Vectors.push_back(glm::vec4(static_cast<float>(i)));
+			Error += is_aligned(Vectors.data(), 32) ? 0 : 1;
+		}
+		Error += Vectors[4999].x == 4999.0f ? 0 : 1;
+
+		std::vector<float, glm::arena_allocator<float> > Copy(Vectors.size(), 0.0f, glm::arena_allocator<float>(Arena));
+		Error += Copy.get_allocator().arena().used() == Arena.used() ? 0 : 1;
+
+		Vectors.clear();
+		Vectors.shrink_to_fit();
+		Copy.clear();
+		Copy.shrink_to_fit();
+		Arena.reset();
+	}
+
+	// The growth of the first frame was merged
+	Error += Arena.chunks() == 1 ? 0 : 1;
+
+	glm::frame_arena Other;
+	glm::arena_allocator<float> const a(Arena);
+	glm::arena_allocator<int> const b(a);
+	glm::arena_allocator<float> const c(Other);
+	Error += a == b && a != c ? 0 : 1;
+
+	return Error;
+}
+
+int test_scratch()
+{
+	int Error = 0;
+
+	glm::frame_arena & Arena = glm::scratchArena();
+	Error += &Arena == &glm::scratchArena() ? 0 : 1;
+
+	std::size_t const Used = Arena.used();
+	{
+		glm::scratch_scope Scope;
+		Error += &Scope.arena() == &Arena ? 0 : 1;
+
+		std::vector<glm::vec3, glm::arena_allocator<glm::vec3> > Positions(100, glm::vec3(1), glm::arena_allocator<glm::vec3>(Scope.arena()));
+		std::size_t const Outer = Arena.used();
+		{
+			glm::scratch_scope Inner;
+			Inner.arena().allocate(1000, 16);
+			Error += Arena.used() > Outer ? 0 : 1;
+		}
+		Error += Arena.used() == Outer ? 0 : 1;
+		Error += Positions[99] == glm::vec3(1) ? 0 : 1;
+	}
+	Error += Arena.used() == Used ? 0 : 1;
+
+	// Each thread has its own arena
+	glm::frame_arena * Arenas[2] = {NULL, NULL};
+	std::thread Thread([&Arenas](){ Arenas[0] = &glm::scratchArena(); });
+	Thread.join();
+	Arenas[1] = &glm::scratchArena();
+	Error += Arenas[0] != Arenas[1] ? 0 : 1;
+
+	return Error;
+}
+
+// Temporary arrays of a frame: a few dozen vectors of varying sizes, freed at the end of the frame
+template <typename allocator_type, typename make_allocator, typename end_frame>
+double perf_frames(char const * Name, std::size_t Frames, std::size_t Arrays, make_allocator Make, end_frame End)
+{
+	glm::uint32 State = 7u;
+	float Sum = 0.0f;
+
+	double const Start = seconds();
+	for(std::size_t Frame = 0; Frame < Frames; ++Frame)
+	{
+		{
+			std::vector<std::vector<glm::vec4, allocator_type> > Temporaries;
+			Temporaries.reserve(Arrays);
+			for(std::size_t i = 0; i < Arrays; ++i)
+			{
+				Temporaries.push_back(std::vector<glm::vec4, allocator_type>(Make()));
+				Temporaries.back().reserve(frame_size(State));
+				Temporaries.back().push_back(glm::vec4(static_cast<float>(i)));
+				Sum += Temporaries.back().back().x;
+			}
+		}
+		End();
+	}
+	double const Time = seconds() - Start;
+
+	std::printf("%s: %.0f allocations/ms\n", Name, rate(Frames * Arrays, Time));
+	return Sum;
+}
+
+int perf_allocation()
+{
+	int Error = 0;
+
+	std::size_t const Frames = 2000;
+	std::size_t const Arrays = 64;
+
+	float Sum = 0.0f;
+	Sum += perf_frames<std::allocator<glm::vec4> >("std::allocator", Frames, Arrays,
+		[](){ return std::allocator<glm::vec4>(); }, [](){});
+	Sum += perf_frames<glm::aligned_allocator<glm::vec4, 32> >("aligned_allocator<vec4, 32>", Frames, Arrays,
+		[](){ return glm::aligned_allocator<glm::vec4, 32>(); }, [](){});
+
+	glm::frame_arena Arena;
+	Sum += perf_frames<glm::arena_allocator<glm::vec4, 32> >("arena_allocator<vec4, 32>", Frames, Arrays,
+		[&Arena](){ return glm::arena_allocator<glm::vec4, 32>(Arena); }, [&Arena](){ Arena.reset(); });
+
+	glm::arena_mark const Mark = glm::scratchArena().mark();
+	Sum += perf_frames<glm::arena_allocator<glm::vec4, 32> >("scratch arena_allocator<vec4, 32>", Frames, Arrays,
+		[](){ return glm::arena_allocator<glm::vec4, 32>(glm::scratchArena()); }, [&Mark](){ glm::scratchArena().rewind(Mark); });
+
+	Error += Sum > 0.0f ? 0 : 1;
+
+	return Error;
+}
+
+// Memory held by a frame arena under frames of varying sizes: chunks added per frame and reserved bytes per used byte
+int perf_fragmentation()
+{
+	int Error = 0;
+
+	glm::uint32 State = 11u;
+	glm::frame_arena Arena(4096);
+
+	std::size_t Grown = 0;
+	std::size_t MaxUsed = 0;
+	for(std::size_t Frame = 0; Frame < 1000; ++Frame)
+	{
+		std::size_t const Chunks = Arena.chunks();
+		std::size_t const Arrays = 16 + frame_size(State) % 48;
+		for(std::size_t i = 0; i < Arrays; ++i)
+			Arena.allocate(frame_size(State) * sizeof(glm::vec4), 32);
+		MaxUsed = glm::max(MaxUsed, Arena.used());
+		Grown += Arena.chunks() > Chunks && Frame >= 10 ? 1 : 0;
+		Arena.reset();
+	}
+
+	std::printf("frame_arena: %.3f reserved bytes per peak used byte, %d chunks, growth in %d of the last 990 frames\n",
+		static_cast<double>(Arena.capacity()) / static_cast<double>(MaxUsed), static_cast<int>(Arena.chunks()), static_cast<int>(Grown));
+
+	// Reset merges chunks, so the arena ends in one chunk no larger than twice the peak frame
+	Error += Arena.chunks() == 1 ? 0 : 1;
+	Error += Arena.capacity() >= MaxUsed && Arena.capacity() <= MaxUsed * 2 ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_aligned_malloc();
+	Error += test_aligned_allocator();
+	Error += test_frame_arena();
+	Error += test_arena_allocator();
+	Error += test_scratch();
+	Error += perf_allocation();
+	Error += perf_fragmentation();
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,216 @@
+#include <glm/gtx/animation_clip.hpp>
+#include <glm/gtc/constants.hpp>
+#include <vector>
+#include <ctime>
+#include <cstdio>
+
+namespace
+{
+	// Smooth motions of different speeds, every fifth track being constant
+	template <typename T>
+	void makeClip(std::size_t TrackCount, std::size_t FrameCount, T SampleRate, std::vector<glm::tquat<T, glm::defaultp> > & Rotations, std::vector<glm::tvec3<T, glm::defaultp> > & Translations)
+	{
+		Rotations.resize(TrackCount * FrameCount);
+		Translations.resize(TrackCount * FrameCount);
+		for(std::size_t f = 0; f < FrameCount; ++f)
+		for(std::size_t t = 0; t < TrackCount; ++t)
+		{
+			T const Track = static_cast<T>(t);
+			T const Time = t % 5 == 0 ? static_cast<T>(0) : static_cast<T>(f) / SampleRate;
+			glm::tvec3<T, glm::defaultp> const Axis = glm::normalize(glm::tvec3<T, glm::defaultp>(glm::cos(Track), glm::sin(Track * static_cast<T>(1.7)), static_cast<T>(0.5)));
+			T const Angle = glm::sin(Time * (static_cast<T>(0.5) + static_cast<T>(t % 8) * static_cast<T>(0.1)) + Track);
+			Rotations[f * TrackCount + t] =
+				glm::angleAxis(Angle, Axis) *
+				glm::angleAxis(Time * static_cast<T>(0.3), glm::tvec3<T, glm::defaultp>(0, 0, 1));
+			Translations[f * TrackCount + t] = glm::tvec3<T, glm::defaultp>(
+				glm::sin(Time * static_cast<T>(1.5)) * static_cast<T>(0.2) + Track,
+				glm::cos(Time * static_cast<T>(0.7) + Track) * static_cast<T>(0.1),
+				Time * static_cast<T>(0.2));
+		}
+	}
+
+	// Rotation angle between two unit quaternions
+	template <typename T>
+	T angle(glm::tquat<T, glm::defaultp> const & a, glm::tquat<T, glm::defaultp> const & b)
+	{
+		glm::tvec4<T, glm::defaultp> const u(a.x, a.y, a.z, a.w);
+		glm::tvec4<T, glm::defaultp> const v(b.x, b.y, b.z, b.w);
+		T const Chord = glm::min(glm::length(u - v), glm::length(u + v));
+		return static_cast<T>(4) * glm::asin(glm::min(Chord * static_cast<T>(0.5), static_cast<T>(1)));
+	}
+
+	// Largest errors at the frames of the clip, in radians and distance units
+	template <typename T>
+	void frameErrors(glm::tcompressed_clip<T> const & Clip, std::vector<glm::tquat<T, glm::defaultp> > const & Rotations, std::vector<glm::tvec3<T, glm::defaultp> > const & Translations, T & RotationError, T & PositionError)
+	{
+		std::vector<glm::tquat<T, glm::defaultp> > SampledRotations(Clip.TrackCount);
+		std::vector<glm::tvec3<T, glm::defaultp> > SampledTranslations(Clip.TrackCount);
+		RotationError = static_cast<T>(0);
+		PositionError = static_cast<T>(0);
+		for(std::size_t f = 0; f < Clip.FrameCount; ++f)
+		{
+			glm::sampleClip(Clip, static_cast<T>(f) / Clip.SampleRate, &SampledRotations[0], &SampledTranslations[0]);
+			for(std::size_t t = 0; t < Clip.TrackCount; ++t)
+			{
+				RotationError = glm::max(RotationError, angle(SampledRotations[t], glm::normalize(Rotations[f * Clip.TrackCount + t])));
+				PositionError = glm::max(PositionError, glm::distance(SampledTranslations[t], Translations[f * Clip.TrackCount + t]));
+			}
+		}
+	}
+}//namespace
+
+namespace tolerance
+{
+	// Errors at the frames are within the tolerances, up to the quantization, for tolerances from loose to tight
+	int test()
+	{
+		int Error = 0;
+
+		std::vector<glm::quat> Rotations;
+		std::vector<glm::vec3> Translations;
+		std::size_t const TrackCount = 23;
+		std::size_t const FrameCount = 150;
+		makeClip(TrackCount, FrameCount, 30.0f, Rotations, Translations);
+
+		float const Tolerances[] = {0.01f, 0.001f, 0.0001f};
+		std::size_t PreviousSize = 0;
+		for(std::size_t i = 0; i < sizeof(Tolerances) / sizeof(Tolerances[0]); ++i)
+		{
+			glm::compressed_clip Clip;
+			glm::compressClip(&Rotations[0], &Translations[0], TrackCount, FrameCount, 30.0f, Tolerances[i], Tolerances[i], Clip);
+
+			float RotationError = 0.0f;
+			float PositionError = 0.0f;
+			frameErrors(Clip, Rotations, Translations, RotationError, PositionError);
+			Error += RotationError <= Tolerances[i] + 0.0002f ? 0 : 1;
+			Error += PositionError <= Tolerances[i] + 0.0002f ? 0 : 1;
+
+			// Tighter tolerances keep more keys
+			Error += Clip.Data.size() > PreviousSize ? 0 : 1;
+			PreviousSize = Clip.Data.size();
+		}
+
+		return Error;
+	}
+}//namespace tolerance
+
+namespace sampling
+{
+	int test()
+	{
+		int Error = 0;
+
+		std::vector<glm::quat> Rotations;
+		std::vector<glm::vec3> Translations;
+		std::size_t const TrackCount = 6;
+		std::size_t const FrameCount = 18;
+		makeClip(TrackCount, FrameCount, 10.0f, Rotations, Translations);
+
+		glm::compressed_clip Clip;
+		glm::compressClip(&Rotations[0], &Translations[0], TrackCount, FrameCount, 10.0f, 0.001f, 0.001f, Clip);
+		Error += Clip.Blocks.size() == 2 * 2 ? 0 : 1;
+
+		// Blocks start on a cache line and are made of whole cache lines
+		Error += reinterpret_cast<std::size_t>(&Clip.Data[0]) % 64 == 0 ? 0 : 1;
+		Error += Clip.Data.size() % 64 == 0 ? 0 : 1;
+		for(std::size_t i = 0; i < Clip.Blocks.size(); ++i)
+			Error += Clip.Blocks[i] % 64 == 0 ? 0 : 1;
+
+		// Times are clamped to the duration of the clip
+		std::vector<glm::quat> SampledRotations(TrackCount);
+		std::vector<glm::vec3> SampledTranslations(TrackCount);
+		std::vector<glm::quat> ClampedRotations(TrackCount);
+		std::vector<glm::vec3> ClampedTranslations(TrackCount);
+		glm::sampleClip(Clip, 100.0f, &SampledRotations[0], &SampledTranslations[0]);
+		glm::sampleClip(Clip, 1.7f, &ClampedRotations[0], &ClampedTranslations[0]);
+		for(std::size_t t = 0; t < TrackCount; ++t)
+		{
+			Error += SampledRotations[t] == ClampedRotations[t] ? 0 : 1;
+			Error += glm::distance(SampledTranslations[t], Translations[17 * TrackCount + t]) < 0.001f ? 0 : 1;
+		}
+
+		// Between two frames, samples are close to the interpolation of the frames
+		glm::sampleClip(Clip, 0.35f, &SampledRotations[0], &SampledTranslations[0]);
+		for(std::size_t t = 0; t < TrackCount; ++t)
+		{
+			glm::vec3 const Expected = glm::mix(Translations[3 * TrackCount + t], Translations[4 * TrackCount + t], 0.5f);
+			Error += glm::distance(SampledTranslations[t], Expected) < 0.01f ? 0 : 1;
+			Error += glm::abs(glm::length(SampledRotations[t]) - 1.0f) < 0.0001f ? 0 : 1;
+		}
+
+		// A single frame
+		glm::compressClip(&Rotations[0], &Translations[0], TrackCount, 1, 10.0f, 0.001f, 0.001f, Clip);
+		glm::sampleClip(Clip, 0.5f, &SampledRotations[0], &SampledTranslations[0]);
+		for(std::size_t t = 0; t < TrackCount; ++t)
+		{
+			Error += angle(SampledRotations[t], glm::normalize(Rotations[t])) < 0.0001f ? 0 : 1;
+			Error += glm::distance(SampledTranslations[t], Translations[t]) < 0.0001f ? 0 : 1;
+		}
+
+		// Double precision clips use the generic path
+		std::vector<glm::dquat> DoubleRotations;
+		std::vector<glm::dvec3> DoubleTranslations;
+		makeClip(TrackCount, FrameCount, 10.0, DoubleRotations, DoubleTranslations);
+		glm::tcompressed_clip<double> DoubleClip;
+		glm::compressClip(&DoubleRotations[0], &DoubleTranslations[0], TrackCount, FrameCount, 10.0, 0.001, 0.001, DoubleClip);
+		double RotationError = 0.0;
+		double PositionError = 0.0;
+		frameErrors(DoubleClip, DoubleRotations, DoubleTranslations, RotationError, PositionError);
+		Error += RotationError <= 0.0011 && PositionError <= 0.0011 ? 0 : 1;
+
+		return Error;
+	}
+}//namespace sampling
+
+namespace perf
+{
+	int test()
+	{
+		// 1 minute of 128 tracks at 30 frames per second, 1 mm and 0.001 radian tolerances
+		std::vector<glm::quat> Rotations;
+		std::vector<glm::vec3> Translations;
+		std::size_t const TrackCount = 128;
+		std::size_t const FrameCount = 1800;
+		makeClip(TrackCount, FrameCount, 30.0f, Rotations, Translations);
+
+		glm::compressed_clip Clip;
+		std::clock_t const Timestamp0 = std::clock();
+		glm::compressClip(&Rotations[0], &Translations[0], TrackCount, FrameCount, 30.0f, 0.001f, 0.001f, Clip);
+		std::clock_t const Timestamp1 = std::clock();
+
+		std::vector<glm::quat> SampledRotations(TrackCount);
+		std::vector<glm::vec3> SampledTranslations(TrackCount);
+		int const SampleCount = 20000;
+		float const Duration = static_cast<float>(FrameCount - 1) / 30.0f;
+		for(int i = 0; i < SampleCount; ++i)
+			glm::sampleClip(Clip, Duration * static_cast<float>((i * 7919) % SampleCount) / static_cast<float>(SampleCount), &SampledRotations[0], &SampledTranslations[0]);
+		std::clock_t const Timestamp2 = std::clock();
+
+		float RotationError = 0.0f;
+		float PositionError = 0.0f;
+		frameErrors(Clip, Rotations, Translations, RotationError, PositionError);
+
+		// std::clock measures the processor time of all threads
+		double const Seconds = 1.0 / static_cast<double>(CLOCKS_PER_SEC);
+		double const RawSize = static_cast<double>(TrackCount * FrameCount * (sizeof(glm::quat) + sizeof(glm::vec3)));
+		double const Size = static_cast<double>(Clip.Data.size() + Clip.Blocks.size() * sizeof(std::size_t));
+		std::printf("compressClip: ratio %.1f:1, max error %.5f rad %.5f, %.1f ms of CPU time\n",
+			RawSize / Size, static_cast<double>(RotationError), static_cast<double>(PositionError),
+			static_cast<double>(Timestamp1 - Timestamp0) * Seconds * 1000.0);
+		std::printf("sampleClip: %.1f tracks/us\n",
+			static_cast<double>(TrackCount) * static_cast<double>(SampleCount) / 1000000.0 / (static_cast<double>(Timestamp2 - Timestamp1 + 1) * Seconds));
+
+		return RotationError <= 0.0012f && PositionError <= 0.0012f ? 0 : 1;
+	}
+}//namespace perf
+
+int main()
+{
+	int Error = 0;
+
+	Error += tolerance::test();
+	Error += sampling::test();
+	Error += perf::test();
+
+	return Error;
+}
@@ -0,0 +1,448 @@
+#include <glm/gtx/binary_archive.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <ctime>
+#include <cstdio>
+#if GLM_HAS_CXX11_STL
+#	include <chrono>
+#endif
+#if GLM_PLATFORM & GLM_PLATFORM_LINUX
+#	include <fcntl.h>
+#	include <unistd.h>
+#endif
+
+namespace
+{
+	// Wall clock time when available, cold loads waiting for the disk
+	double seconds()
+	{
+#		if GLM_HAS_CXX11_STL
+			return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#		else
+			return static_cast<double>(std::clock()) / static_cast<double>(CLOCKS_PER_SEC);
+#		endif
+	}
+
+	// Removes a file from the page cache so that the next load reads the disk, where supported
+	bool evict(char const * Path)
+	{
+#		if GLM_PLATFORM & GLM_PLATFORM_LINUX
+			int const File = open(Path, O_RDONLY);
+			if(File < 0)
+				return false;
+			bool const Evicted = fdatasync(File) == 0 && posix_fadvise(File, 0, 0, POSIX_FADV_DONTNEED) == 0;
+			close(File);
+			return Evicted;
+#		else
+			static_cast<void>(Path);
+			return false;
+#		endif
+	}
+
+	bool write_file(char const * Path, void const * Data, std::size_t Size)
+	{
+		std::FILE * const File = std::fopen(Path, "wb");
+		if(!File)
+			return false;
+		bool const Written = std::fwrite(Data, 1, Size, File) == Size;
+		return std::fclose(File) == 0 && Written;
+	}
+
+	// Grid of Size x Size quads with positions, normals and texture coordinates
+	void grid(int Size, glm::mesh_soa & Mesh)
+	{
+		for(int y = 0; y <= Size; ++y)
+		for(int x = 0; x <= Size; ++x)
+		{
+			glm::vec2 const Position(static_cast<float>(x) / static_cast<float>(Size), static_cast<float>(y) / static_cast<float>(Size));
+			Mesh.Positions.push_back(glm::vec3(Position, 0.0f));
+			Mesh.Normals.push_back(glm::vec3(0, 0, 1));
+			Mesh.TexCoords.push_back(Position);
+		}
+		for(int y = 0; y < Size; ++y)
+		for(int x = 0; x < Size; ++x)
+		{
+			glm::uint const i = static_cast<glm::uint>(y * (Size + 1) + x);
+			glm::uint const Stride = static_cast<glm::uint>(Size + 1);
+			glm::uint const Quad[6] = {i, i + 1, i + Stride + 1, i, i + Stride + 1, i + Stride};
+			Mesh.Indices.insert(Mesh.Indices.end(), Quad, Quad + 6);
+		}
+	}
+
+	std::string grid_obj(glm::mesh_soa const & Mesh)
+	{
+		std::string Text;
+		char Line[256];
+		for(std::size_t i = 0; i < Mesh.Positions.size(); ++i)
+		{
+			std::sprintf(Line, "v %.9g %.9g %.9g\nvt %.9g %.9g\nvn %.9g %.9g %.9g\n",
+				Mesh.Positions[i].x, Mesh.Positions[i].y, Mesh.Positions[i].z, Mesh.TexCoords[i].x, Mesh.TexCoords[i].y,
+				Mesh.Normals[i].x, Mesh.Normals[i].y, Mesh.Normals[i].z);
+			Text += Line;
+		}
+		for(std::size_t i = 0; i < Mesh.Indices.size(); i += 3)
+		{
+			glm::uint const a = Mesh.Indices[i] + 1, b = Mesh.Indices[i + 1] + 1, c = Mesh.Indices[i + 2] + 1;
+			std::sprintf(Line, "f %u/%u/%u %u/%u/%u %u/%u/%u\n", a, a, a, b, b, b, c, c, c);
+			Text += Line;
+		}
+		return Text;
+	}
+
+	template <typename T>
+	bool equal(glm::tarchive_span<T> const & Span, std::vector<T> const & Data)
+	{
+		return Span.Count == Data.size() && (Data.empty() || std::memcmp(Span.Data, &Data[0], Data.size() * sizeof(T)) == 0);
+	}
+
+	template <typename T>
+	void swap_bytes(T & Value)
+	{
+		unsigned char * const Bytes = reinterpret_cast<unsigned char *>(&Value);
+		for(std::size_t i = 0; i < sizeof(T) / 2; ++i)
+			std::swap(Bytes[i], Bytes[sizeof(T) - 1 - i]);
+	}
+}//namespace
+
+int test_lz4()
+{
+	int Error = 0;
+
+	std::vector<unsigned char> Data;
+	for(int i = 0; i < 100000; ++i)
+		Data.push_back(static_cast<unsigned char>(i % 251 < 128 ? i % 7 : (i * 2654435761u) >> 24));
+
+	// Compressible data, long literal runs and long overlapping matches
+	for(std::size_t Size = 0; Size <= Data.size(); Size = Size * 3 + 1)
+	{
+		std::vector<unsigned char> Block;
+		glm::detail::lz4_compress(Data.empty() ? 0 : &Data[0], Size, Block);
+		std::vector<unsigned char> Output(Size + 1, 0);
+		Error += glm::detail::lz4_decompress(&Block[0], &Block[0] + Block.size(), &Output[0], Size) ? 0 : 1;
+		Error += std::memcmp(&Output[0], &Data[0], Size) == 0 ? 0 : 1;
+
+		// Truncated blocks and wrong sizes are rejected
+		if(Size > 0)
+		{
+			Error += !glm::detail::lz4_decompress(&Block[0], &Block[0] + Block.size() - 1, &Output[0], Size) ? 0 : 1;
+			Error += !glm::detail::lz4_decompress(&Block[0], &Block[0] + Block.size(), &Output[0], Size - 1) ? 0 : 1;
+		}
+	}
+
+	std::vector<unsigned char> Zeros(1 << 20, 0);
+	std::vector<unsigned char> Block;
+	glm::detail::lz4_compress(&Zeros[0], Zeros.size(), Block);
+	Error += Block.size() < Zeros.size() / 200 ? 0 : 1;
+
+	return Error;
+}
+
+int test_round_trip()
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> Positions;
+	std::vector<glm::vec4> Colors;
+	std::vector<glm::mat4> Transforms;
+	std::vector<glm::quat> Rotations;
+	std::vector<glm::uint> Indices;
+	std::vector<glm::uint8> Flags;
+	for(int i = 0; i < 1000; ++i)
+	{
+		float const f = static_cast<float>(i);
+		Positions.push_back(glm::vec3(f, f * 0.5f, -f));
+		Colors.push_back(glm::vec4(f / 1000.0f, 0.25f, 0.5f, 1.0f));
+		Transforms.push_back(glm::translate(glm::mat4(1.0f), glm::vec3(f, 1, 2)));
+		Rotations.push_back(glm::angleAxis(f * 0.01f, glm::vec3(0, 0, 1)));
+		Indices.push_back(static_cast<glm::uint>(i % 97));
+		Flags.push_back(static_cast<glm::uint8>(i & 3));
+	}
+
+	char const * const Path = "gtx_binary_archive_test.bin";
+	for(int Compressed = 0; Compressed < 2; ++Compressed)
+	{
+		glm::archive_compression const Compression = Compressed ? glm::archive_lz4 : glm::archive_raw;
+		glm::archive_writer Writer;
+		glm::addSection(Writer, "positions", &Positions[0], Positions.size(), Compression);
+		glm::addSection(Writer, "colors", &Colors[0], Colors.size(), Compression);
+		glm::addSection(Writer, "transforms", &Transforms[0], Transforms.size(), Compression);
+		glm::addSection(Writer, "rotations", &Rotations[0], Rotations.size(), Compression);
+		glm::addSection(Writer, "indices", &Indices[0], Indices.size(), Compression);
+		glm::addSection(Writer, "flags", &Flags[0], Flags.size(), Compression);
+		glm::addSection(Writer, "empty", static_cast<float const *>(0), 0, Compression);
+		Error += glm::writeArchive(Writer, Path) ? 0 : 1;
+
+		// Files and memory images are identical
+		std::vector<glm::uint8> Bytes;
+		glm::writeArchive(Writer, Bytes);
+		std::vector<glm::uint8> Read(Bytes.size() + 1);
+		std::FILE * const File = std::fopen(Path, "rb");
+		Error += File && std::fread(&Read[0], 1, Read.size(), File) == Bytes.size() ? 0 : 1;
+		if(File)
+			std::fclose(File);
+		Error += std::memcmp(&Read[0], &Bytes[0], Bytes.size()) == 0 ? 0 : 1;
+
+		glm::binary_archive const Archive(Path);
+		Error += Archive.valid() ? 0 : 1;
+		Error += Archive.sections().size() == 7 ? 0 : 1;
+		Error += equal(Archive.span<glm::vec3>("positions"), Positions) ? 0 : 1;
+		Error += equal(Archive.span<glm::vec4>("colors"), Colors) ? 0 : 1;
+		Error += equal(Archive.span<glm::mat4>("transforms"), Transforms) ? 0 : 1;
+		Error += equal(Archive.span<glm::quat>("rotations"), Rotations) ? 0 : 1;
+		Error += equal(Archive.span<glm::uint>("indices"), Indices) ? 0 : 1;
+		Error += equal(Archive.span<glm::uint8>("flags"), Flags) ? 0 : 1;
+		Error += Archive.span<float>("empty").Count == 0 ? 0 : 1;
+
+		// Indices of a few values are compressible, floats of a linear ramp barely are
+		Error += !Compressed || Archive.sections()[4].Compression == glm::archive_lz4 ? 0 : 1;
+
+		// Sections are aligned for SIMD loads
+		glm::tarchive_span<glm::vec4> const Span = Archive.span<glm::vec4>("colors");
+		Error += reinterpret_cast<std::size_t>(Span.Data) % 16 == 0 ? 0 : 1;
+
+		// Missing sections and other element types
+		Error += Archive.span<glm::vec3>("normals").Data == 0 ? 0 : 1;
+		Error += Archive.span<glm::vec4>("positions").Count == 0 ? 0 : 1;
+		Error += Archive.span<float>("positions").Count == 0 ? 0 : 1;
+	}
+	std::remove(Path);
+
+	return Error;
+}
+
+// Archive written on a machine of the other byte order
+int test_byte_order()
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> Positions;
+	std::vector<glm::uint16> Indices;
+	for(int i = 0; i < 300; ++i)
+	{
+		Positions.push_back(glm::vec3(static_cast<float>(i), 1.5f, -2.0f));
+		Indices.push_back(static_cast<glm::uint16>(i * 3 % 5));
+	}
+
+	for(int Compressed = 0; Compressed < 2; ++Compressed)
+	{
+		glm::archive_compression const Compression = Compressed ? glm::archive_lz4 : glm::archive_raw;
+
+		// The payloads of the writer are already swapped
+		std::vector<glm::vec3> SwappedPositions(Positions);
+		std::vector<glm::uint16> SwappedIndices(Indices);
+		for(std::size_t i = 0; i < SwappedPositions.size(); ++i)
+		{
+			swap_bytes(SwappedPositions[i].x);
+			swap_bytes(SwappedPositions[i].y);
+			swap_bytes(SwappedPositions[i].z);
+			swap_bytes(SwappedIndices[i]);
+		}
+		glm::archive_writer Writer;
+		glm::addSection(Writer, "positions", &SwappedPositions[0], SwappedPositions.size(), Compression);
+		glm::addSection(Writer, "indices", &SwappedIndices[0], SwappedIndices.size(), Compression);
+
+		std::vector<glm::uint8> Bytes;
+		glm::writeArchive(Writer, Bytes);
+
+		glm::detail::archive_header Header;
+		std::memcpy(&Header, &Bytes[0], sizeof(Header));
+		std::size_t const TableOffset = static_cast<std::size_t>(Header.TableOffset);
+		for(std::size_t i = 0; i < Header.SectionCount; ++i)
+		{
+			glm::archive_section Section;
+			std::memcpy(&Section, &Bytes[TableOffset + i * sizeof(Section)], sizeof(Section));
+			swap_bytes(Section.Type);
+			swap_bytes(Section.Compression);
+			swap_bytes(Section.ElementSize);
+			swap_bytes(Section.ComponentSize);
+			swap_bytes(Section.Count);
+			swap_bytes(Section.Offset);
+			swap_bytes(Section.Size);
+			std::memcpy(&Bytes[TableOffset + i * sizeof(Section)], &Section, sizeof(Section));
+		}
+		swap_bytes(Header.Version);
+		swap_bytes(Header.ByteOrder);
+		swap_bytes(Header.Abi);
+		swap_bytes(Header.SectionCount);
+		swap_bytes(Header.TableOffset);
+		swap_bytes(Header.FileSize);
+		std::memcpy(&Bytes[0], &Header, sizeof(Header));
+
+		char const * const Path = "gtx_binary_archive_swapped.bin";
+		Error += write_file(Path, &Bytes[0], Bytes.size()) ? 0 : 1;
+		{
+			glm::binary_archive const Archive(Path);
+			Error += Archive.valid() ? 0 : 1;
+			Error += equal(Archive.span<glm::vec3>("positions"), Positions) ? 0 : 1;
+			Error += equal(Archive.span<glm::uint16>("indices"), Indices) ? 0 : 1;
+		}
+		std::remove(Path);
+	}
+
+	return Error;
+}
+
+int test_invalid()
+{
+	int Error = 0;
+
+	std::vector<float> Values(4096, 1.0f);
+	glm::archive_writer Writer;
+	glm::addSection(Writer, "values", &Values[0], Values.size(), glm::archive_lz4);
+	std::vector<glm::uint8> Bytes;
+	glm::writeArchive(Writer, Bytes);
+	Error += Writer.Sections[0].Compression == glm::archive_lz4 ? 0 : 1;
+
+	char const * const Path = "gtx_binary_archive_invalid.bin";
+
+	// Truncated file
+	Error += write_file(Path, &Bytes[0], Bytes.size() - 1) ? 0 : 1;
+	Error += !glm::binary_archive(Path).valid() ? 0 : 1;
+
+	// Corrupted compressed section
+	std::vector<glm::uint8> Corrupted(Bytes);
+	Corrupted[64] = 0xFF;
+	Corrupted[65] = 0xFF;
+	Error += write_file(Path, &Corrupted[0], Corrupted.size()) ? 0 : 1;
+	Error += !glm::binary_archive(Path).valid() ? 0 : 1;
+
+	// Compressed section count beyond the expansion of LZ4, rejected without allocating terabytes
+	Corrupted = Bytes;
+	{
+		glm::detail::archive_header Header;
+		std::memcpy(&Header, &Corrupted[0], sizeof(Header));
+		glm::archive_section Section;
+		std::size_t const TableOffset = static_cast<std::size_t>(Header.TableOffset);
+		std::memcpy(&Section, &Corrupted[TableOffset], sizeof(Section));
+		Section.Count = static_cast<glm::uint64>(1) << 40;
+		std::memcpy(&Corrupted[TableOffset], &Section, sizeof(Section));
+	}
+	Error += write_file(Path, &Corrupted[0], Corrupted.size()) ? 0 : 1;
+	Error += !glm::binary_archive(Path).valid() ? 0 : 1;
+
+	// Newer version
+	Corrupted = Bytes;
+	Corrupted[8] = 2;
+	Error += write_file(Path, &Corrupted[0], Corrupted.size()) ? 0 : 1;
+	Error += !glm::binary_archive(Path).valid() ? 0 : 1;
+
+	// Other file
+	Error += write_file(Path, "ply\nformat ascii 1.0\n", 21) ? 0 : 1;
+	Error += !glm::binary_archive(Path).valid() ? 0 : 1;
+	std::remove(Path);
+
+	Error += !glm::binary_archive("gtx_binary_archive_missing.bin").valid() ? 0 : 1;
+
+	return Error;
+}
+
+int test_convert()
+{
+	int Error = 0;
+
+	glm::mesh_soa Grid;
+	grid(16, Grid);
+	std::string const Text = grid_obj(Grid);
+
+	// Vertices are renumbered in order of first use by the import
+	glm::mesh_soa Mesh;
+	Error += glm::parseOBJ(Text.data(), Text.data() + Text.size(), Mesh) ? 0 : 1;
+	Error += Mesh.Positions.size() == Grid.Positions.size() ? 0 : 1;
+
+	char const * const ObjPath = "gtx_binary_archive_test.obj";
+	char const * const ArchivePath = "gtx_binary_archive_mesh.bin";
+	Error += write_file(ObjPath, Text.data(), Text.size()) ? 0 : 1;
+	Error += glm::convertMesh(ObjPath, ArchivePath, glm::archive_lz4) ? 0 : 1;
+	{
+		glm::binary_archive const Archive(ArchivePath);
+		Error += Archive.valid() ? 0 : 1;
+		Error += equal(Archive.span<glm::vec3>("positions"), Mesh.Positions) ? 0 : 1;
+		Error += equal(Archive.span<glm::vec3>("normals"), Mesh.Normals) ? 0 : 1;
+		Error += equal(Archive.span<glm::vec2>("texcoords"), Mesh.TexCoords) ? 0 : 1;
+		Error += equal(Archive.span<glm::uint>("indices"), Mesh.Indices) ? 0 : 1;
+	}
+	Error += !glm::convertMesh("gtx_binary_archive_missing.obj", ArchivePath, glm::archive_raw) ? 0 : 1;
+
+	std::remove(ObjPath);
+	std::remove(ArchivePath);
+
+	return Error;
+}
+
+// Load times of a mesh of a million vertices from its OBJ text and from archives, the first archive load
+// after removing the file from the page cache where supported. Loads read every position to fault the pages in.
+int perf_load()
+{
+	int Error = 0;
+
+	glm::mesh_soa Mesh;
+	grid(1000, Mesh);
+	std::string const Text = grid_obj(Mesh);
+
+	char const * const ObjPath = "gtx_binary_archive_perf.obj";
+	char const * const RawPath = "gtx_binary_archive_perf.bin";
+	char const * const CompressedPath = "gtx_binary_archive_perf_lz4.bin";
+	Error += write_file(ObjPath, Text.data(), Text.size()) ? 0 : 1;
+
+	glm::archive_writer Raw;
+	glm::addMesh(Raw, Mesh, glm::archive_raw);
+	Error += glm::writeArchive(Raw, RawPath) ? 0 : 1;
+	glm::archive_writer Compressed;
+	glm::addMesh(Compressed, Mesh, glm::archive_lz4);
+	Error += glm::writeArchive(Compressed, CompressedPath) ? 0 : 1;
+
+	double const TimeObj = seconds();
+	glm::mesh_soa Imported;
+	Error += glm::importOBJ(ObjPath, Imported) ? 0 : 1;
+	double const TimeObjEnd = seconds();
+	Error += Imported.Positions.size() == Mesh.Positions.size() ? 0 : 1;
+
+	char const * const Paths[] = {RawPath, CompressedPath};
+	char const * const Names[] = {"raw", "lz4"};
+	for(int i = 0; i < 2; ++i)
+	{
+		bool const Evicted = evict(Paths[i]);
+		double Times[2] = {0.0, 0.0};
+		for(int Run = 0; Run < 2; ++Run)
+		{
+			double const TimeStart = seconds();
+			glm::binary_archive const Archive(Paths[i]);
+			glm::tarchive_span<glm::vec3> const Positions = Archive.span<glm::vec3>("positions");
+			glm::vec3 Sum(0.0f);
+			for(std::size_t j = 0; j < Positions.Count; ++j)
+				Sum += Positions.Data[j];
+			Times[Run] = seconds() - TimeStart;
+			Error += Archive.valid() && Positions.Count == Mesh.Positions.size() && Sum.x > 0.0f ? 0 : 1;
+		}
+
+		std::FILE * const File = std::fopen(Paths[i], "rb");
+		std::fseek(File, 0, SEEK_END);
+		long const Size = std::ftell(File);
+		std::fclose(File);
+		std::printf("binary_archive %s: %.1f MB, %s load %.2f ms, warm load %.2f ms\n", Names[i], static_cast<double>(Size) / 1e6,
+			Evicted ? "cold" : "first", Times[0] * 1e3, Times[1] * 1e3);
+	}
+	std::printf("importOBJ: %.1f MB, %.2f ms\n", static_cast<double>(Text.size()) / 1e6, (TimeObjEnd - TimeObj) * 1e3);
+
+	std::remove(ObjPath);
+	std::remove(RawPath);
+	std::remove(CompressedPath);
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_lz4();
+	Error += test_round_trip();
+	Error += test_byte_order();
+	Error += test_invalid();
+	Error += test_convert();
+	Error += perf_load();
+
+	return Error;
+}
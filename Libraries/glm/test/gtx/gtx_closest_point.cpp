@@ -1,8 +1,38 @@
 #include <glm/gtx/closest_point.hpp>
+#include <glm/gtc/epsilon.hpp>
+
+namespace triangle
+{
+	int test()
+	{
+		int Error = 0;
+
+		glm::vec3 const a(0, 0, 0);
+		glm::vec3 const b(2, 0, 0);
+		glm::vec3 const c(0, 2, 0);
+
+		// Face, vertex and edge regions
+		Error += glm::all(glm::epsilonEqual(glm::closestPointOnTriangle(glm::vec3(0.5f, 0.5f, 3.0f), a, b, c), glm::vec3(0.5f, 0.5f, 0.0f), 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(glm::closestPointOnTriangle(glm::vec3(-1, -1, 1), a, b, c), a, 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(glm::closestPointOnTriangle(glm::vec3(3, -1, 0), a, b, c), b, 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(glm::closestPointOnTriangle(glm::vec3(-1, 3, 0), a, b, c), c, 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(glm::closestPointOnTriangle(glm::vec3(1, -1, -1), a, b, c), glm::vec3(1, 0, 0), 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(glm::closestPointOnTriangle(glm::vec3(-1, 1, 1), a, b, c), glm::vec3(0, 1, 0), 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(glm::closestPointOnTriangle(glm::vec3(2, 2, 0), a, b, c), glm::vec3(1, 1, 0), 0.0001f)) ? 0 : 1;
+
+		// Degenerate triangles behave as segments
+		glm::dvec3 const Closest = glm::closestPointOnTriangle(glm::dvec3(1, 1, 0), glm::dvec3(0), glm::dvec3(1, 0, 0), glm::dvec3(2, 0, 0));
+		Error += glm::all(glm::epsilonEqual(Closest, glm::dvec3(1, 0, 0), 0.0001)) ? 0 : 1;
+
+		return Error;
+	}
+}//namespace triangle
 
 int main()
 {
 	int Error(0);
 
+	Error += triangle::test();
+
 	return Error;
 }
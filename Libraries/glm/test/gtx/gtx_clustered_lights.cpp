@@ -0,0 +1,350 @@
+#include <glm/gtx/clustered_lights.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/constants.hpp>
+#include <algorithm>
+#include <vector>
+#include <cmath>
+#include <ctime>
+#include <cstdio>
+
+namespace
+{
+	// Deterministic pseudo random numbers in [-1, 1]
+	float random_unit(glm::uint32 & State)
+	{
+		State = State * 1664525u + 1013904223u;
+		return static_cast<float>(static_cast<double>(State) / 2147483647.5 - 1.0);
+	}
+
+	glm::vec3 random_direction(glm::uint32 & State)
+	{
+		for(;;)
+		{
+			glm::vec3 const v(random_unit(State), random_unit(State), random_unit(State));
+			float const l = glm::length(v);
+			if(l > 0.1f && l <= 1.0f)
+				return v / l;
+		}
+	}
+
+	float const Fovy = glm::radians(60.0f);
+	float const Aspect = 16.0f / 9.0f;
+
+	// Lights scattered in front of the camera of View, every fourth one a spot light
+	std::vector<glm::cluster_light> make_lights(glm::mat4 const & View, std::size_t Count, glm::uint32 State)
+	{
+		glm::mat4 const World = glm::inverse(View);
+		std::vector<glm::cluster_light> Lights;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::vec3 const Position(World * glm::vec4(random_unit(State) * 60.0f, random_unit(State) * 30.0f, -50.0f + random_unit(State) * 52.0f, 1.0f));
+			float const Range = 0.5f + (random_unit(State) + 1.0f) * 3.0f;
+			if(i % 4 == 3)
+				Lights.push_back(glm::spotLight(Position, random_direction(State), Range * 2.0f, (random_unit(State) + 1.2f) * 0.5f));
+			else
+				Lights.push_back(glm::pointLight(Position, Range));
+		}
+		return Lights;
+	}
+
+	// View space position in double precision
+	void to_view(glm::mat4 const & View, glm::vec3 const & p, double Result[3])
+	{
+		for(glm::length_t r = 0; r < 3; ++r)
+			Result[r] = static_cast<double>(View[0][r]) * p.x + static_cast<double>(View[1][r]) * p.y + static_cast<double>(View[2][r]) * p.z + static_cast<double>(View[3][r]);
+	}
+
+	double sphere_box_distance(double const Center[3], glm::vec3 const & Min, glm::vec3 const & Max)
+	{
+		double Distance2 = 0.0;
+		for(glm::length_t i = 0; i < 3; ++i)
+		{
+			double const d = glm::max(glm::max(static_cast<double>(Min[i]) - Center[i], Center[i] - static_cast<double>(Max[i])), 0.0);
+			Distance2 += d * d;
+		}
+		return std::sqrt(Distance2);
+	}
+
+	bool listed(std::vector<glm::uvec2> const & Clusters, std::vector<glm::uint> const & Indices, std::size_t Cluster, glm::uint Light)
+	{
+		glm::uint const * First = &Indices[0] + Clusters[Cluster].x;
+		glm::uint const * Last = First + Clusters[Cluster].y;
+		return std::find(First, Last, Light) != Last;
+	}
+
+	double seconds()
+	{
+		return static_cast<double>(std::clock()) / static_cast<double>(CLOCKS_PER_SEC);
+	}
+
+	double rate(std::size_t Count, double Time)
+	{
+		return static_cast<double>(Count) * 1e-3 / (Time > 0.0 ? Time : 1e-9);
+	}
+}//namespace
+
+int test_grid()
+{
+	int Error = 0;
+
+	glm::cluster_grid const Grid(16, 9, 24, Fovy, Aspect, 0.1f, 1000.0f);
+	Error += glm::clusterCount(Grid) == 16 * 9 * 24 ? 0 : 1;
+	Error += Grid.Depths.size() == 25 && Grid.Depths[0] == 0.1f && Grid.Depths[24] == 1000.0f ? 0 : 1;
+
+	// Every slice is deeper than the previous by the same ratio
+	float const Ratio = std::pow(10000.0f, 1.0f / 24.0f);
+	for(std::size_t z = 0; z < 24; ++z)
+		Error += glm::abs(Grid.Depths[z + 1] / Grid.Depths[z] - Ratio) < 1e-4f ? 0 : 1;
+
+	// Clusters of points projected with the same perspective, away from the cluster boundaries
+	glm::mat4 const Projection = glm::perspective(Fovy, Aspect, 0.1f, 1000.0f);
+	glm::vec2 const ScaleBias = glm::clusterDepthScaleBias(Grid);
+	glm::uint32 State = 5u;
+	std::size_t Checked = 0;
+	for(std::size_t i = 0; i < 10000; ++i)
+	{
+		float const Depth = 0.1f * std::pow(10000.0f, (random_unit(State) + 1.0f) * 0.5f);
+		glm::vec3 const Position(random_unit(State) * Depth * 1.2f, random_unit(State) * Depth * 0.7f, -Depth);
+		glm::vec4 const Clip = Projection * glm::vec4(Position, 1.0f);
+		glm::vec3 const Cell(
+			(Clip.x / Clip.w * 0.5f + 0.5f) * 16.0f,
+			(Clip.y / Clip.w * 0.5f + 0.5f) * 9.0f,
+			std::log(Depth) * ScaleBias.x + ScaleBias.y);
+		glm::vec3 const Fraction = glm::fract(Cell);
+		if(glm::any(glm::lessThan(Fraction, glm::vec3(1e-3f))) || glm::any(glm::greaterThan(Fraction, glm::vec3(1.0f - 1e-3f))))
+			continue;
+
+		std::size_t const Index = glm::clusterIndex(Grid, Position);
+		bool const Inside = Cell.x >= 0.0f && Cell.x < 16.0f && Cell.y >= 0.0f && Cell.y < 9.0f;
+		if(Inside)
+		{
+			glm::uvec3 const c(Cell);
+			Error += Index == (c.z * 9 + c.y) * 16 + c.x ? 0 : 1;
+
+			glm::vec3 Min, Max;
+			glm::clusterBounds(Grid, c.x, c.y, c.z, Min, Max);
+			Error += glm::all(glm::lessThanEqual(Min, Position)) && glm::all(glm::lessThanEqual(Position, Max)) ? 0 : 1;
+			++Checked;
+		}
+		else
+			Error += Index == glm::clusterCount(Grid) ? 0 : 1;
+	}
+	Error += Checked > 1000 ? 0 : 1;
+
+	Error += glm::clusterIndex(Grid, glm::vec3(0.0f, 0.0f,-0.05f)) == glm::clusterCount(Grid) ? 0 : 1;
+	Error += glm::clusterIndex(Grid, glm::vec3(0.0f, 0.0f,-2000.0f)) == glm::clusterCount(Grid) ? 0 : 1;
+	Error += glm::clusterIndex(Grid, glm::vec3(0.0f, 0.0f, 1.0f)) == glm::clusterCount(Grid) ? 0 : 1;
+
+	return Error;
+}
+
+// Point lights are listed in the clusters whose box they intersect, up to rounding
+int test_point_lights()
+{
+	int Error = 0;
+
+	glm::cluster_grid Grid(16, 9, 24, Fovy, Aspect, 0.1f, 100.0f);
+	glm::mat4 const View = glm::lookAt(glm::vec3(3, 2, 10), glm::vec3(-5, 0,-20), glm::vec3(0, 1, 0));
+	std::vector<glm::cluster_light> const Lights = make_lights(View, 500, 9u);
+
+	std::size_t const Count = glm::clusterCount(Grid);
+	std::vector<glm::uvec2> Clusters(Count);
+	std::vector<glm::uint> Indices(1 << 20);
+	std::size_t const Total = glm::assignLights(Grid, View, &Lights[0], Lights.size(), &Clusters[0], &Indices[0], Indices.size());
+
+	// Compact lists in order of cluster
+	std::size_t Offset = 0;
+	for(std::size_t c = 0; c < Count; ++c)
+	{
+		Error += Clusters[c].x == Offset ? 0 : 1;
+		Offset += Clusters[c].y;
+	}
+	Error += Offset == Total && Total > 0 ? 0 : 1;
+
+	for(std::size_t i = 0; i < Lights.size(); ++i)
+	{
+		if(Lights[i].Angle < glm::pi<float>())
+			continue;
+
+		double Center[3];
+		to_view(View, Lights[i].Position, Center);
+		double const Range = static_cast<double>(Lights[i].Range);
+		for(glm::uint z = 0; z < Grid.CountZ; ++z)
+		for(glm::uint y = 0; y < Grid.CountY; ++y)
+		for(glm::uint x = 0; x < Grid.CountX; ++x)
+		{
+			glm::vec3 Min, Max;
+			glm::clusterBounds(Grid, x, y, z, Min, Max);
+			double const Distance = sphere_box_distance(Center, Min, Max);
+			bool const Listed = listed(Clusters, Indices, (z * Grid.CountY + y) * Grid.CountX + x, static_cast<glm::uint>(i));
+			if(Distance < Range * 0.999)
+				Error += Listed ? 0 : 1;
+			else if(Distance > Range * 1.001)
+				Error += !Listed ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+// Spot lights are listed in the clusters of the points of their cone, and in fewer clusters than their range sphere
+int test_spot_lights()
+{
+	int Error = 0;
+
+	glm::cluster_grid Grid(16, 9, 24, Fovy, Aspect, 0.1f, 100.0f);
+	glm::mat4 const View = glm::lookAt(glm::vec3(0, 1, 0), glm::vec3(0, 0,-30), glm::vec3(0, 1, 0));
+	std::vector<glm::cluster_light> Lights = make_lights(View, 400, 13u);
+
+	std::size_t const Count = glm::clusterCount(Grid);
+	std::vector<glm::uvec2> Clusters(Count);
+	std::vector<glm::uint> Indices(1 << 20);
+	glm::assignLights(Grid, View, &Lights[0], Lights.size(), &Clusters[0], &Indices[0], Indices.size());
+
+	glm::uint32 State = 17u;
+	std::size_t Checked = 0;
+	for(std::size_t i = 3; i < Lights.size(); i += 4)
+	{
+		glm::cluster_light const & Light = Lights[i];
+		for(int s = 0; s < 200; ++s)
+		{
+			// Points within the cone, slightly shrunk
+			glm::vec3 Direction = random_direction(State);
+			if(glm::dot(Direction, Light.Direction) < std::cos(Light.Angle * 0.99f))
+				continue;
+			glm::vec3 const Point = Light.Position + Direction * Light.Range * 0.99f * (random_unit(State) + 1.0f) * 0.5f;
+			glm::vec3 const ViewPoint(View * glm::vec4(Point, 1.0f));
+			std::size_t const Cluster = glm::clusterIndex(Grid, ViewPoint);
+			if(Cluster == Count)
+				continue;
+
+			// The cluster of the point, or a neighbour when the point is close to a boundary
+			glm::uint const x = static_cast<glm::uint>(Cluster % Grid.CountX);
+			glm::uint const y = static_cast<glm::uint>(Cluster / Grid.CountX % Grid.CountY);
+			glm::uint const z = static_cast<glm::uint>(Cluster / (Grid.CountX * Grid.CountY));
+			glm::vec3 Min, Max;
+			glm::clusterBounds(Grid, x, y, z, Min, Max);
+			if(glm::any(glm::lessThan(glm::min(ViewPoint - Min, Max - ViewPoint), glm::vec3(1e-3f))))
+				continue;
+
+			Error += listed(Clusters, Indices, Cluster, static_cast<glm::uint>(i)) ? 0 : 1;
+			++Checked;
+		}
+	}
+	Error += Checked > 1000 ? 0 : 1;
+
+	// The same lights as point lights
+	std::size_t SpotTotal = 0, PointTotal = 0;
+	for(std::size_t c = 0; c < Count; ++c)
+		for(glm::uint k = 0; k < Clusters[c].y; ++k)
+			SpotTotal += Indices[Clusters[c].x + k] % 4 == 3 ? 1 : 0;
+	for(std::size_t i = 3; i < Lights.size(); i += 4)
+		Lights[i] = glm::pointLight(Lights[i].Position, Lights[i].Range);
+	glm::assignLights(Grid, View, &Lights[0], Lights.size(), &Clusters[0], &Indices[0], Indices.size());
+	for(std::size_t c = 0; c < Count; ++c)
+		for(glm::uint k = 0; k < Clusters[c].y; ++k)
+			PointTotal += Indices[Clusters[c].x + k] % 4 == 3 ? 1 : 0;
+	Error += SpotTotal > 0 && SpotTotal * 4 < PointTotal * 3 ? 0 : 1;
+
+	return Error;
+}
+
+int test_capacity()
+{
+	int Error = 0;
+
+	glm::cluster_grid Grid(8, 8, 16, Fovy, Aspect, 0.5f, 200.0f);
+	glm::mat4 const View(1.0f);
+	std::vector<glm::cluster_light> const Lights = make_lights(View, 300, 21u);
+
+	std::size_t const Count = glm::clusterCount(Grid);
+	std::vector<glm::uvec2> Clusters(Count), Truncated(Count);
+	std::vector<glm::uint> Indices(1 << 18), Partial(1 << 18, 0xdeadbeef);
+	std::size_t const Total = glm::assignLights(Grid, View, &Lights[0], Lights.size(), &Clusters[0], &Indices[0], Indices.size());
+
+	std::size_t const Capacity = Total / 3;
+	Error += glm::assignLights(Grid, View, &Lights[0], Lights.size(), &Truncated[0], &Partial[0], Capacity) == Total ? 0 : 1;
+
+	for(std::size_t c = 0; c < Count; ++c)
+	{
+		std::size_t const Offset = Clusters[c].x;
+		std::size_t const Expected = Offset >= Capacity ? 0 : glm::min<std::size_t>(Clusters[c].y, Capacity - Offset);
+		Error += Truncated[c].x == Clusters[c].x && Truncated[c].y == Expected ? 0 : 1;
+	}
+	for(std::size_t i = 0; i < Capacity; ++i)
+		Error += Partial[i] == Indices[i] ? 0 : 1;
+	Error += Partial[Capacity] == 0xdeadbeef ? 0 : 1;
+
+	// No lights
+	Error += glm::assignLights(Grid, View, &Lights[0], 0, &Clusters[0], &Indices[0], Indices.size()) == 0 ? 0 : 1;
+	for(std::size_t c = 0; c < Count; ++c)
+		Error += Clusters[c] == glm::uvec2(0) ? 0 : 1;
+
+	return Error;
+}
+
+int perf_clustered_lights()
+{
+	int Error = 0;
+
+	glm::cluster_grid Grid(16, 9, 24, Fovy, Aspect, 0.1f, 100.0f);
+	glm::mat4 const View = glm::lookAt(glm::vec3(0, 1, 0), glm::vec3(0, 0,-30), glm::vec3(0, 1, 0));
+	std::vector<glm::cluster_light> Lights = make_lights(View, 1024, 29u);
+	std::size_t const Count = glm::clusterCount(Grid);
+	std::size_t const Tests = Lights.size() * Count;
+
+	std::vector<glm::vec3> Mins(Count), Maxs(Count);
+	for(glm::uint z = 0; z < Grid.CountZ; ++z)
+	for(glm::uint y = 0; y < Grid.CountY; ++y)
+	for(glm::uint x = 0; x < Grid.CountX; ++x)
+		glm::clusterBounds(Grid, x, y, z, Mins[(z * Grid.CountY + y) * Grid.CountX + x], Maxs[(z * Grid.CountY + y) * Grid.CountX + x]);
+
+	std::vector<glm::uvec2> Clusters(Count);
+	std::vector<glm::uint> Indices(1 << 20);
+
+	// Every light against every cluster
+	double const StartNaive = seconds();
+	std::size_t NaiveTotal = 0;
+	std::vector<glm::vec3> Centers(Lights.size());
+	for(std::size_t i = 0; i < Lights.size(); ++i)
+		Centers[i] = glm::vec3(View * glm::vec4(Lights[i].Position, 1.0f));
+	for(std::size_t c = 0; c < Count; ++c)
+	{
+		Clusters[c] = glm::uvec2(static_cast<glm::uint>(NaiveTotal), 0);
+		for(std::size_t i = 0; i < Lights.size(); ++i)
+		{
+			glm::vec3 const d = glm::max(glm::max(Mins[c] - Centers[i], Centers[i] - Maxs[c]), glm::vec3(0.0f));
+			if(glm::dot(d, d) <= Lights[i].Range * Lights[i].Range && NaiveTotal < Indices.size())
+				Indices[NaiveTotal++] = static_cast<glm::uint>(i);
+		}
+		Clusters[c].y = static_cast<glm::uint>(NaiveTotal) - Clusters[c].x;
+	}
+	double const TimeNaive = seconds() - StartNaive;
+
+	int const Frames = 20;
+	std::size_t Total = 0;
+	double const StartAssign = seconds();
+	for(int f = 0; f < Frames; ++f)
+		Total = glm::assignLights(Grid, View, &Lights[0], Lights.size(), &Clusters[0], &Indices[0], Indices.size());
+	double const TimeAssign = (seconds() - StartAssign) / static_cast<double>(Frames);
+
+	std::printf("Naive light assignment: %.0f lights x clusters/ms, %d indices\n", rate(Tests, TimeNaive), static_cast<int>(NaiveTotal));
+	std::printf("assignLights: %.0f lights x clusters/ms, %d indices\n", rate(Tests, TimeAssign), static_cast<int>(Total));
+
+	Error += Total > 0 && Total <= NaiveTotal ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_grid();
+	Error += test_point_lights();
+	Error += test_spot_lights();
+	Error += test_capacity();
+	Error += perf_clustered_lights();
+
+	return Error;
+}
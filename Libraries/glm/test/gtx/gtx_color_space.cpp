@@ -1,19 +1,223 @@
 #include <glm/gtx/color_space.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <vector>
+#include <ctime>
+#include <cstdio>
 
 int test_saturation()
 {
 	int Error(0);
-	
+
 	glm::vec4 Color = glm::saturation(1.0f, glm::vec4(1.0, 0.5, 0.0, 1.0));
 
 	return Error;
 }
 
+namespace
+{
+	// Black, greys, primaries, secondaries, ties between channels and a grid of colors
+	template <typename vecType>
+	std::vector<vecType> rgbColors()
+	{
+		typedef typename vecType::value_type T;
+		std::vector<vecType> Colors;
+		for(int r = 0; r <= 8; ++r)
+		for(int g = 0; g <= 8; ++g)
+		for(int b = 0; b <= 8; ++b)
+			Colors.push_back(vecType(static_cast<T>(r), static_cast<T>(g), static_cast<T>(b)) / static_cast<T>(8));
+		for(int i = 0; i < 1001; ++i)
+		{
+			T const x = static_cast<T>(i);
+			Colors.push_back(vecType(
+				glm::fract(x * static_cast<T>(0.618034)),
+				glm::fract(x * static_cast<T>(0.414214) + static_cast<T>(0.3)),
+				glm::fract(x * static_cast<T>(0.732051) + static_cast<T>(0.7))));
+		}
+		return Colors;
+	}
+
+	// Same storage as the 8-bit batch conversions
+	glm::uint8 encode(float Value, float Scale)
+	{
+		float const Code = Value * (255.0f / Scale);
+		return static_cast<glm::uint8>(Code > 0.0f ? (Code < 255.0f ? Code + 0.5f : 255.0f) : 0.0f);
+	}
+}//namespace
+
+int test_hsvColor()
+{
+	int Error(0);
+
+	glm::vec3 const Red = glm::hsvColor(glm::vec3(1.0f, 0.0f, 0.0f));
+	Error += glm::all(glm::equal(Red, glm::vec3(0.0f, 1.0f, 1.0f))) ? 0 : 1;
+
+	glm::vec3 const Cyan = glm::hsvColor(glm::vec3(0.0f, 1.0f, 1.0f));
+	Error += glm::all(glm::equal(Cyan, glm::vec3(180.0f, 1.0f, 1.0f))) ? 0 : 1;
+
+	glm::vec3 const Magenta = glm::rgbColor(glm::vec3(300.0f, 1.0f, 1.0f));
+	Error += glm::all(glm::equal(Magenta, glm::vec3(1.0f, 0.0f, 1.0f))) ? 0 : 1;
+
+	// Greys have no hue
+	glm::vec3 const Grey = glm::hsvColor(glm::vec3(0.5f));
+	Error += glm::all(glm::equal(Grey, glm::vec3(0.0f, 0.0f, 0.5f))) ? 0 : 1;
+
+	return Error;
+}
+
+// Batch conversions give the same results as the scalar ones
+int test_batch()
+{
+	int Error(0);
+
+	std::vector<glm::vec3> const RGB = rgbColors<glm::vec3>();
+	std::size_t const Count = RGB.size();
+
+	std::vector<glm::vec3> HSV(Count);
+	glm::hsvColor(&RGB[0], &HSV[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(HSV[i], glm::hsvColor(RGB[i]))) ? 0 : 1;
+
+	std::vector<glm::vec3> Back(Count);
+	glm::rgbColor(&HSV[0], &Back[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += glm::all(glm::equal(Back[i], glm::rgbColor(HSV[i]))) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(Back[i], RGB[i], 0.00001f)) ? 0 : 1;
+	}
+
+	// Hues out of [0, 360) use the sector 0 formula
+	std::vector<glm::vec3> Wrapped(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Wrapped[i] = glm::vec3(HSV[i].x * 1.5f - 180.0f, HSV[i].y, HSV[i].z);
+	glm::rgbColor(&Wrapped[0], &Back[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Back[i], glm::rgbColor(Wrapped[i]))) ? 0 : 1;
+
+	// Planar buffers, converted in place
+	std::vector<float> r(Count), g(Count), b(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		r[i] = RGB[i].r;
+		g[i] = RGB[i].g;
+		b[i] = RGB[i].b;
+	}
+	glm::hsvColor(&r[0], &g[0], &b[0], &r[0], &g[0], &b[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(glm::vec3(r[i], g[i], b[i]), HSV[i])) ? 0 : 1;
+	glm::rgbColor(&r[0], &g[0], &b[0], &r[0], &g[0], &b[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(glm::vec3(r[i], g[i], b[i]), glm::rgbColor(HSV[i]))) ? 0 : 1;
+
+	// Double precision and partial groups of four
+	std::vector<glm::dvec3> const DoubleRGB = rgbColors<glm::dvec3>();
+	std::vector<glm::dvec3> DoubleHSV(DoubleRGB.size());
+	glm::hsvColor(&DoubleRGB[0], &DoubleHSV[0], 7);
+	for(std::size_t i = 0; i < 7; ++i)
+		Error += glm::all(glm::equal(DoubleHSV[i], glm::hsvColor(DoubleRGB[i]))) ? 0 : 1;
+
+	return Error;
+}
+
+// 8-bit buffers are decoded, converted and encoded again, hues in 255/360 units
+int test_batch_uint8()
+{
+	int Error(0);
+
+	std::vector<glm::u8vec3> RGB;
+	for(int r = 0; r < 256; r += 5)
+	for(int g = 0; g < 256; g += 3)
+	for(int b = 0; b < 256; b += 7)
+		RGB.push_back(glm::u8vec3(r, g, b));
+	std::size_t const Count = RGB.size();
+
+	std::vector<glm::u8vec3> HSV(Count);
+	glm::hsvColor(&RGB[0], &HSV[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec3 const Expected = glm::hsvColor(glm::vec3(RGB[i]) * (1.0f / 255.0f));
+		glm::ivec3 const Code(encode(Expected.x, 360.0f), encode(Expected.y, 1.0f), encode(Expected.z, 1.0f));
+		Error += glm::all(glm::lessThanEqual(glm::abs(glm::ivec3(HSV[i]) - Code), glm::ivec3(1))) ? 0 : 1;
+	}
+
+	std::vector<glm::u8vec3> Back(Count);
+	glm::rgbColor(&HSV[0], &Back[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec3 const Expected = glm::rgbColor(glm::vec3(HSV[i]) * glm::vec3(360.0f / 255.0f, 1.0f / 255.0f, 1.0f / 255.0f));
+		glm::ivec3 const Code(encode(Expected.x, 1.0f), encode(Expected.y, 1.0f), encode(Expected.z, 1.0f));
+		Error += glm::all(glm::lessThanEqual(glm::abs(glm::ivec3(Back[i]) - Code), glm::ivec3(1))) ? 0 : 1;
+	}
+
+	// Planar 8-bit buffers
+	std::vector<glm::uint8> r(Count), g(Count), b(Count), h(Count), s(Count), v(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		r[i] = RGB[i].r;
+		g[i] = RGB[i].g;
+		b[i] = RGB[i].b;
+	}
+	glm::hsvColor(&r[0], &g[0], &b[0], &h[0], &s[0], &v[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::u8vec3(h[i], s[i], v[i]) == HSV[i] ? 0 : 1;
+
+	return Error;
+}
+
+int perf_batch()
+{
+	int Error(0);
+
+	// A 1080p frame
+	std::size_t const Count = 1920 * 1080;
+	std::vector<glm::vec3> RGB(Count);
+	std::vector<glm::u8vec3> RGB8(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		RGB8[i] = glm::u8vec3(i % 256, (i / 7) % 256, (i / 1920) % 256);
+		RGB[i] = glm::vec3(RGB8[i]) * (1.0f / 255.0f);
+	}
+	std::vector<glm::vec3> HSV(Count);
+	std::vector<glm::u8vec3> HSV8(Count);
+
+	std::clock_t const Timestamp0 = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		HSV[i] = glm::hsvColor(RGB[i]);
+	std::clock_t const Timestamp1 = std::clock();
+	glm::hsvColor(&RGB[0], &HSV[0], Count);
+	std::clock_t const Timestamp2 = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		RGB[i] = glm::rgbColor(HSV[i]);
+	std::clock_t const Timestamp3 = std::clock();
+	glm::rgbColor(&HSV[0], &RGB[0], Count);
+	std::clock_t const Timestamp4 = std::clock();
+	glm::hsvColor(&RGB8[0], &HSV8[0], Count);
+	std::clock_t const Timestamp5 = std::clock();
+	glm::rgbColor(&HSV8[0], &RGB8[0], Count);
+	std::clock_t const Timestamp6 = std::clock();
+
+	// std::clock measures the processor time of all threads
+	double const Pixels = static_cast<double>(Count) / 1000000.0 * static_cast<double>(CLOCKS_PER_SEC);
+	std::printf("hsvColor: scalar %.1f MPixels/s, batch %.1f MPixels/s, uint8 batch %.1f MPixels/s\n",
+		Pixels / static_cast<double>(Timestamp1 - Timestamp0 + 1),
+		Pixels / static_cast<double>(Timestamp2 - Timestamp1 + 1),
+		Pixels / static_cast<double>(Timestamp5 - Timestamp4 + 1));
+	std::printf("rgbColor: scalar %.1f MPixels/s, batch %.1f MPixels/s, uint8 batch %.1f MPixels/s\n",
+		Pixels / static_cast<double>(Timestamp3 - Timestamp2 + 1),
+		Pixels / static_cast<double>(Timestamp4 - Timestamp3 + 1),
+		Pixels / static_cast<double>(Timestamp6 - Timestamp5 + 1));
+
+	return Error;
+}
+
 int main()
 {
 	int Error(0);
 
 	Error += test_saturation();
+	Error += test_hsvColor();
+	Error += test_batch();
+	Error += test_batch_uint8();
+	Error += perf_batch();
 
 	return Error;
 }
@@ -1,8 +1,184 @@
 #include <glm/gtx/color_space_YCoCg.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <vector>
+#include <ctime>
+#include <cstdio>
+
+namespace
+{
+	std::vector<glm::vec3> rgbColors()
+	{
+		std::vector<glm::vec3> Colors;
+		for(int i = 0; i < 1001; ++i)
+		{
+			float const x = static_cast<float>(i);
+			Colors.push_back(glm::vec3(
+				glm::fract(x * 0.618034f),
+				glm::fract(x * 0.414214f + 0.3f),
+				glm::fract(x * 0.732051f + 0.7f)));
+		}
+		return Colors;
+	}
+
+	// Same storage as the 8-bit batch conversions
+	glm::uint8 encode(float Value, float Offset)
+	{
+		float const Code = (Value + Offset) * 255.0f;
+		return static_cast<glm::uint8>(Code > 0.0f ? (Code < 255.0f ? Code + 0.5f : 255.0f) : 0.0f);
+	}
+}//namespace
+
+int test_YCoCg()
+{
+	int Error(0);
+
+	glm::vec3 const White = glm::rgb2YCoCg(glm::vec3(1.0f));
+	Error += glm::all(glm::equal(White, glm::vec3(1.0f, 0.0f, 0.0f))) ? 0 : 1;
+
+	glm::vec3 const Color(0.2f, 0.5f, 0.9f);
+	Error += glm::all(glm::epsilonEqual(glm::YCoCg2rgb(glm::rgb2YCoCg(Color)), Color, 0.00001f)) ? 0 : 1;
+
+	return Error;
+}
+
+// Batch conversions give the same results as the scalar ones
+int test_batch()
+{
+	int Error(0);
+
+	std::vector<glm::vec3> const RGB = rgbColors();
+	std::size_t const Count = RGB.size();
+
+	std::vector<glm::vec3> YCoCg(Count);
+	glm::rgb2YCoCg(&RGB[0], &YCoCg[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(YCoCg[i], glm::rgb2YCoCg(RGB[i]))) ? 0 : 1;
+
+	std::vector<glm::vec3> Back(YCoCg);
+	glm::YCoCg2rgb(&Back[0], &Back[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Back[i], glm::YCoCg2rgb(YCoCg[i]))) ? 0 : 1;
+
+	// Planar buffers
+	std::vector<float> r(Count), g(Count), b(Count), Y(Count), Co(Count), Cg(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		r[i] = RGB[i].r;
+		g[i] = RGB[i].g;
+		b[i] = RGB[i].b;
+	}
+	glm::rgb2YCoCg(&r[0], &g[0], &b[0], &Y[0], &Co[0], &Cg[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(glm::vec3(Y[i], Co[i], Cg[i]), YCoCg[i])) ? 0 : 1;
+	glm::YCoCg2rgb(&Y[0], &Co[0], &Cg[0], &r[0], &g[0], &b[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(glm::vec3(r[i], g[i], b[i]), Back[i])) ? 0 : 1;
+
+	// Double precision
+	std::vector<glm::dvec3> DoubleRGB(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		DoubleRGB[i] = glm::dvec3(RGB[i]);
+	std::vector<glm::dvec3> DoubleYCoCg(Count);
+	glm::rgb2YCoCg(&DoubleRGB[0], &DoubleYCoCg[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(DoubleYCoCg[i], glm::rgb2YCoCg(DoubleRGB[i]))) ? 0 : 1;
+
+	return Error;
+}
+
+// 8-bit chrominances are offset by 128
+int test_batch_uint8()
+{
+	int Error(0);
+
+	std::vector<glm::u8vec3> RGB;
+	for(int r = 0; r < 256; r += 5)
+	for(int g = 0; g < 256; g += 3)
+	for(int b = 0; b < 256; b += 7)
+		RGB.push_back(glm::u8vec3(r, g, b));
+	std::size_t const Count = RGB.size();
+
+	std::vector<glm::u8vec3> YCoCg(Count);
+	glm::rgb2YCoCg(&RGB[0], &YCoCg[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec3 const Expected = glm::rgb2YCoCg(glm::vec3(RGB[i]) * (1.0f / 255.0f));
+		glm::ivec3 const Code(encode(Expected.x, 0.0f), encode(Expected.y, 0.5f), encode(Expected.z, 0.5f));
+		Error += glm::all(glm::lessThanEqual(glm::abs(glm::ivec3(YCoCg[i]) - Code), glm::ivec3(1))) ? 0 : 1;
+	}
+
+	// Round trips within the 8-bit quantization
+	std::vector<glm::u8vec3> Back(Count);
+	glm::YCoCg2rgb(&YCoCg[0], &Back[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::lessThanEqual(glm::abs(glm::ivec3(Back[i]) - glm::ivec3(RGB[i])), glm::ivec3(2))) ? 0 : 1;
+
+	std::vector<glm::uint8> r(Count), g(Count), b(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		r[i] = RGB[i].r;
+		g[i] = RGB[i].g;
+		b[i] = RGB[i].b;
+	}
+	glm::rgb2YCoCg(&r[0], &g[0], &b[0], &r[0], &g[0], &b[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::u8vec3(r[i], g[i], b[i]) == YCoCg[i] ? 0 : 1;
+
+	return Error;
+}
+
+int perf_batch()
+{
+	int Error(0);
+
+	// A 1080p frame
+	std::size_t const Count = 1920 * 1080;
+	std::vector<glm::vec3> RGB(Count);
+	std::vector<glm::u8vec3> RGB8(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		RGB8[i] = glm::u8vec3(i % 256, (i / 7) % 256, (i / 1920) % 256);
+		RGB[i] = glm::vec3(RGB8[i]) * (1.0f / 255.0f);
+	}
+	std::vector<glm::vec3> YCoCg(Count);
+	std::vector<glm::u8vec3> YCoCg8(Count);
+
+	std::clock_t const Timestamp0 = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		YCoCg[i] = glm::rgb2YCoCg(RGB[i]);
+	std::clock_t const Timestamp1 = std::clock();
+	glm::rgb2YCoCg(&RGB[0], &YCoCg[0], Count);
+	std::clock_t const Timestamp2 = std::clock();
+	glm::YCoCg2rgb(&YCoCg[0], &RGB[0], Count);
+	std::clock_t const Timestamp3 = std::clock();
+	glm::rgb2YCoCg(&RGB8[0], &YCoCg8[0], Count);
+	std::clock_t const Timestamp4 = std::clock();
+	glm::YCoCg2rgb(&YCoCg8[0], &RGB8[0], Count);
+	std::clock_t const Timestamp5 = std::clock();
+
+	// std::clock measures the processor time of all threads
+	double const Pixels = static_cast<double>(Count) / 1000000.0 * static_cast<double>(CLOCKS_PER_SEC);
+	std::printf("rgb2YCoCg: scalar %.1f MPixels/s, batch %.1f MPixels/s, uint8 batch %.1f MPixels/s\n",
+		Pixels / static_cast<double>(Timestamp1 - Timestamp0 + 1),
+		Pixels / static_cast<double>(Timestamp2 - Timestamp1 + 1),
+		Pixels / static_cast<double>(Timestamp4 - Timestamp3 + 1));
+	std::printf("YCoCg2rgb: batch %.1f MPixels/s, uint8 batch %.1f MPixels/s\n",
+		Pixels / static_cast<double>(Timestamp3 - Timestamp2 + 1),
+		Pixels / static_cast<double>(Timestamp5 - Timestamp4 + 1));
+
+	Error += glm::all(glm::epsilonEqual(RGB[1234], glm::vec3(RGB8[1234]) * (1.0f / 255.0f), 0.01f)) ? 0 : 1;
+
+	return Error;
+}
 
 int main()
 {
 	int Error(0);
 
+	Error += test_YCoCg();
+	Error += test_batch();
+	Error += test_batch_uint8();
+	Error += perf_batch();
+
 	return Error;
 }
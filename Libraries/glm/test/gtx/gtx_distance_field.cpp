@@ -0,0 +1,217 @@
+#include <glm/gtx/distance_field.hpp>
+#include <glm/gtx/isosurface.hpp>
+#include <glm/gtc/constants.hpp>
+#include <limits>
+#include <vector>
+#include <ctime>
+#include <cstdio>
+
+namespace
+{
+	// Axis aligned box of half extent Extent centered at the origin, front facing from the outside
+	void boxMesh(glm::vec3 const & Extent, std::vector<glm::vec3> & Positions, std::vector<glm::uint> & Indices)
+	{
+		Positions.clear();
+		for(int c = 0; c < 8; ++c)
+			Positions.push_back(Extent * glm::vec3(c & 1 ? 1 : -1, c & 2 ? 1 : -1, c & 4 ? 1 : -1));
+
+		glm::uint const Quads[6][4] = {{0, 4, 6, 2}, {1, 3, 7, 5}, {0, 1, 5, 4}, {2, 6, 7, 3}, {0, 2, 3, 1}, {4, 5, 7, 6}};
+		Indices.clear();
+		for(int q = 0; q < 6; ++q)
+		{
+			glm::uint const Triangles[6] = {Quads[q][0], Quads[q][1], Quads[q][2], Quads[q][0], Quads[q][2], Quads[q][3]};
+			Indices.insert(Indices.end(), Triangles, Triangles + 6);
+		}
+	}
+
+	// UV sphere of radius Radius centered at the origin, front facing from the outside
+	void sphereMesh(float Radius, int Rings, int Sectors, std::vector<glm::vec3> & Positions, std::vector<glm::uint> & Indices)
+	{
+		Positions.clear();
+		Indices.clear();
+		Positions.push_back(glm::vec3(0, 0, -Radius));
+		for(int r = 1; r < Rings; ++r)
+		for(int s = 0; s < Sectors; ++s)
+		{
+			float const Theta = glm::pi<float>() * static_cast<float>(r) / static_cast<float>(Rings);
+			float const Phi = glm::two_pi<float>() * static_cast<float>(s) / static_cast<float>(Sectors);
+			Positions.push_back(Radius * glm::vec3(glm::sin(Theta) * glm::cos(Phi), glm::sin(Theta) * glm::sin(Phi), -glm::cos(Theta)));
+		}
+		Positions.push_back(glm::vec3(0, 0, Radius));
+
+		glm::uint const Last = static_cast<glm::uint>(Positions.size() - 1);
+		for(int s = 0; s < Sectors; ++s)
+		{
+			glm::uint const s0 = static_cast<glm::uint>(s);
+			glm::uint const s1 = static_cast<glm::uint>((s + 1) % Sectors);
+			glm::uint const Bottom[3] = {0, 1 + s1, 1 + s0};
+			Indices.insert(Indices.end(), Bottom, Bottom + 3);
+			for(int r = 1; r + 1 < Rings; ++r)
+			{
+				glm::uint const Row0 = 1 + static_cast<glm::uint>((r - 1) * Sectors);
+				glm::uint const Row1 = Row0 + static_cast<glm::uint>(Sectors);
+				glm::uint const Quad[6] = {Row0 + s0, Row0 + s1, Row1 + s1, Row0 + s0, Row1 + s1, Row1 + s0};
+				Indices.insert(Indices.end(), Quad, Quad + 6);
+			}
+			glm::uint const Row = 1 + static_cast<glm::uint>((Rings - 2) * Sectors);
+			glm::uint const Top[3] = {Row + s0, Row + s1, Last};
+			Indices.insert(Indices.end(), Top, Top + 3);
+		}
+	}
+
+	float bruteForce(std::vector<glm::vec3> const & Positions, std::vector<glm::uint> const & Indices, glm::vec3 const & Point)
+	{
+		float Distance = std::numeric_limits<float>::max();
+		for(std::size_t t = 0; t < Indices.size(); t += 3)
+		{
+			glm::vec3 const Closest = glm::closestPointOnTriangle(Point, Positions[Indices[t]], Positions[Indices[t + 1]], Positions[Indices[t + 2]]);
+			Distance = glm::min(Distance, glm::distance(Point, Closest));
+		}
+		return Distance;
+	}
+}//namespace
+
+namespace box
+{
+	// Compared with the analytic signed distance of the box, the grid not being aligned with the faces
+	int test()
+	{
+		int Error = 0;
+
+		glm::vec3 const Extent(0.8f, 0.55f, 0.3f);
+		std::vector<glm::vec3> Positions;
+		std::vector<glm::uint> Indices;
+		boxMesh(Extent, Positions, Indices);
+
+		glm::ivec3 const Size(33, 29, 25);
+		glm::vec3 const Origin(-1.21f, -1.03f, -0.97f);
+		float const Spacing = 0.077f;
+		std::vector<float> Distances(static_cast<std::size_t>(Size.x * Size.y * Size.z));
+		glm::distanceField(&Positions[0], &Indices[0], Indices.size() / 3, Origin, Spacing, Size, 2, &Distances[0]);
+
+		for(int z = 0; z < Size.z; ++z)
+		for(int y = 0; y < Size.y; ++y)
+		for(int x = 0; x < Size.x; ++x)
+		{
+			glm::vec3 const Point = Origin + glm::vec3(x, y, z) * Spacing;
+			glm::vec3 const q = glm::abs(Point) - Extent;
+			float const Expected = glm::length(glm::max(q, 0.0f)) + glm::min(glm::max(q.x, glm::max(q.y, q.z)), 0.0f);
+			Error += glm::abs(Distances[static_cast<std::size_t>((z * Size.y + y) * Size.x + x)] - Expected) < 0.0001f ? 0 : 1;
+		}
+
+		return Error;
+	}
+}//namespace box
+
+namespace sphere
+{
+	// Compared with the exact distance to the triangles, and the sign with the analytic sphere.
+	// Beyond the band, the propagated closest triangle may be a neighbor of the actual closest triangle,
+	// giving an upper bound of the distance.
+	int test()
+	{
+		int Error = 0;
+
+		float const Radius = 0.7f;
+		std::vector<glm::vec3> Positions;
+		std::vector<glm::uint> Indices;
+		sphereMesh(Radius, 12, 16, Positions, Indices);
+
+		int const Size = 24;
+		float const Spacing = 2.0f / static_cast<float>(Size - 1);
+		glm::vec3 const Origin(-1.0f);
+		std::vector<float> Distances(static_cast<std::size_t>(Size * Size * Size));
+		glm::distanceField(&Positions[0], &Indices[0], Indices.size() / 3, Origin, Spacing, glm::ivec3(Size), 1, &Distances[0]);
+
+		for(int z = 0; z < Size; ++z)
+		for(int y = 0; y < Size; ++y)
+		for(int x = 0; x < Size; ++x)
+		{
+			glm::vec3 const Point = Origin + glm::vec3(x, y, z) * Spacing;
+			float const Distance = Distances[static_cast<std::size_t>((z * Size + y) * Size + x)];
+			float const Expected = bruteForce(Positions, Indices, Point);
+			if(Expected < Spacing)
+				Error += glm::abs(glm::abs(Distance) - Expected) < 0.0001f ? 0 : 1;
+			else
+				Error += glm::abs(Distance) - Expected > -0.0001f && glm::abs(Distance) - Expected < Spacing * 0.15f ? 0 : 1;
+
+			// The tessellation is at most 0.05 inside the sphere
+			float const Analytic = glm::length(Point) - Radius;
+			if(glm::abs(Analytic) > 0.05f)
+				Error += (Distance < 0.0f) == (Analytic < 0.0f) ? 0 : 1;
+		}
+
+		return Error;
+	}
+}//namespace sphere
+
+namespace roundtrip
+{
+	// The zero isosurface of the field of a sphere is close to the sphere
+	int test()
+	{
+		int Error = 0;
+
+		float const Radius = 0.6f;
+		std::vector<glm::vec3> Positions;
+		std::vector<glm::uint> Indices;
+		sphereMesh(Radius, 48, 64, Positions, Indices);
+
+		int const Size = 32;
+		float const Spacing = 2.0f / static_cast<float>(Size - 1);
+		glm::vec3 const Origin(-1.0f);
+		std::vector<float> Distances(static_cast<std::size_t>(Size * Size * Size));
+		glm::distanceField(&Positions[0], &Indices[0], Indices.size() / 3, Origin, Spacing, glm::ivec3(Size), 2, &Distances[0]);
+
+		std::vector<glm::vec3> Surface;
+		std::vector<glm::uint> SurfaceIndices;
+		glm::isosurface(&Distances[0], glm::ivec3(Size), 0.0f, Origin, Spacing, glm::marching_cubes, Surface, SurfaceIndices);
+		Error += !SurfaceIndices.empty() ? 0 : 1;
+		for(std::size_t i = 0; i < Surface.size(); ++i)
+			Error += glm::abs(glm::length(Surface[i]) - Radius) < 0.01f ? 0 : 1;
+
+		// Without triangles, everything is infinitely far
+		glm::distanceField(&Positions[0], &Indices[0], 0, Origin, Spacing, glm::ivec3(4), 2, &Distances[0]);
+		for(std::size_t i = 0; i < 64; ++i)
+			Error += Distances[i] == std::numeric_limits<float>::max() ? 0 : 1;
+
+		return Error;
+	}
+}//namespace roundtrip
+
+namespace perf
+{
+	int test()
+	{
+		// 128^3 grid around a 32K triangles sphere, 256^3 and 512^3 grids take 8 and 64 times longer
+		std::vector<glm::vec3> Positions;
+		std::vector<glm::uint> Indices;
+		sphereMesh(0.8f, 128, 128, Positions, Indices);
+
+		int const Size = 128;
+		float const Spacing = 2.0f / static_cast<float>(Size - 1);
+		std::vector<float> Distances(static_cast<std::size_t>(Size * Size * Size));
+
+		std::clock_t const Timestamp0 = std::clock();
+		glm::distanceField(&Positions[0], &Indices[0], Indices.size() / 3, glm::vec3(-1.0f), Spacing, glm::ivec3(Size), 3, &Distances[0]);
+		std::clock_t const Timestamp1 = std::clock();
+
+		// std::clock measures the processor time of all threads
+		double const Seconds = 1.0 / static_cast<double>(CLOCKS_PER_SEC);
+		std::printf("distanceField: %.1f M samples/s of CPU time\n", static_cast<double>(Distances.size()) / 1000000.0 / (static_cast<double>(Timestamp1 - Timestamp0 + 1) * Seconds));
+
+		return 0;
+	}
+}//namespace perf
+
+int main()
+{
+	int Error = 0;
+
+	Error += box::test();
+	Error += sphere::test();
+	Error += roundtrip::test();
+	Error += perf::test();
+
+	return Error;
+}
@@ -4,6 +4,8 @@
 #include <glm/gtc/epsilon.hpp>
 #include <glm/gtx/string_cast.hpp>
 #include <glm/gtx/euler_angles.hpp>
+#include <vector>
+#include <ctime>
 #include <cstdio>
 
 namespace test_eulerAngleX
@@ -309,6 +311,122 @@ namespace test_eulerAngleYXZ
 	}
 }//namespace eulerAngleYXZ
 
+namespace test_closedForm
+{
+	bool equal(glm::mat4 const & a, glm::mat4 const & b)
+	{
+		for(glm::length_t i = 0; i < 4; ++i)
+			if(!glm::all(glm::epsilonEqual(a[i], b[i], 0.00001f)))
+				return false;
+		return true;
+	}
+
+	// Closed-form constructors must match the products of the single axis rotations
+	int test()
+	{
+		int Error = 0;
+
+		float const Angles[] = {-2.9f, -1.2f, 0.0f, 0.4f, 1.5707963f, 2.2f, 7.1f};
+		std::size_t const Count = sizeof(Angles) / sizeof(Angles[0]);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		for(std::size_t j = 0; j < Count; ++j)
+		{
+			float const a = Angles[i];
+			float const b = Angles[j];
+			float const c = Angles[(i + j) % Count];
+
+			Error += equal(glm::eulerAngleXY(a, b), glm::eulerAngleX(a) * glm::eulerAngleY(b)) ? 0 : 1;
+			Error += equal(glm::eulerAngleYX(a, b), glm::eulerAngleY(a) * glm::eulerAngleX(b)) ? 0 : 1;
+			Error += equal(glm::eulerAngleXZ(a, b), glm::eulerAngleX(a) * glm::eulerAngleZ(b)) ? 0 : 1;
+			Error += equal(glm::eulerAngleZX(a, b), glm::eulerAngleZ(a) * glm::eulerAngleX(b)) ? 0 : 1;
+			Error += equal(glm::eulerAngleYZ(a, b), glm::eulerAngleY(a) * glm::eulerAngleZ(b)) ? 0 : 1;
+			Error += equal(glm::eulerAngleZY(a, b), glm::eulerAngleZ(a) * glm::eulerAngleY(b)) ? 0 : 1;
+			Error += equal(glm::eulerAngleYXZ(a, b, c), glm::eulerAngleY(a) * glm::eulerAngleX(b) * glm::eulerAngleZ(c)) ? 0 : 1;
+			Error += equal(glm::yawPitchRoll(a, b, c), glm::eulerAngleYXZ(a, b, c)) ? 0 : 1;
+			Error += equal(glm::eulerAngleXYZ(a, b, c), glm::eulerAngleX(a) * glm::eulerAngleY(b) * glm::eulerAngleZ(c)) ? 0 : 1;
+			Error += equal(glm::orientate4(glm::vec3(a, b, c)), glm::yawPitchRoll(c, a, b)) ? 0 : 1;
+		}
+
+		return Error;
+	}
+}//namespace test_closedForm
+
+namespace test_batch
+{
+	int test()
+	{
+		int Error = 0;
+
+		std::size_t const Count = 7;
+		std::vector<glm::vec2> Angles2(Count);
+		std::vector<glm::vec3> Angles3(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Angles2[i] = glm::vec2(0.3f * static_cast<float>(i) - 1.0f, 1.7f - 0.5f * static_cast<float>(i));
+			Angles3[i] = glm::vec3(Angles2[i], 0.2f * static_cast<float>(i));
+		}
+
+		std::vector<glm::mat4> Result(Count);
+		std::vector<glm::mat3> Result3(Count);
+
+		glm::eulerAngleXZ(&Angles2[0], &Result[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Result[i] == glm::eulerAngleXZ(Angles2[i].x, Angles2[i].y) ? 0 : 1;
+
+		glm::eulerAngleZY(&Angles2[0], &Result[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Result[i] == glm::eulerAngleZY(Angles2[i].x, Angles2[i].y) ? 0 : 1;
+
+		glm::eulerAngleXYZ(&Angles3[0], &Result[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Result[i] == glm::eulerAngleXYZ(Angles3[i].x, Angles3[i].y, Angles3[i].z) ? 0 : 1;
+
+		glm::yawPitchRoll(&Angles3[0], &Result[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Result[i] == glm::yawPitchRoll(Angles3[i].x, Angles3[i].y, Angles3[i].z) ? 0 : 1;
+
+		glm::orientate3(&Angles3[0], &Result3[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Result3[i] == glm::orientate3(Angles3[i]) ? 0 : 1;
+
+		return Error;
+	}
+}//namespace test_batch
+
+namespace perf
+{
+	int test()
+	{
+		std::size_t const Count = 1 << 18;
+		std::vector<glm::vec3> Angles(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Angles[i] = glm::vec3(static_cast<float>(i) * 0.001f, static_cast<float>(i) * 0.002f, static_cast<float>(i) * 0.003f);
+
+		std::vector<glm::mat4> Result(Count);
+
+		std::clock_t const Timestamp0 = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			Result[i] = glm::eulerAngleX(Angles[i].x) * glm::eulerAngleZ(Angles[i].y);
+		std::clock_t const Timestamp1 = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			Result[i] = glm::eulerAngleXZ(Angles[i].x, Angles[i].y);
+		std::clock_t const Timestamp2 = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			Result[i] = glm::yawPitchRoll(Angles[i].x, Angles[i].y, Angles[i].z);
+		std::clock_t const Timestamp3 = std::clock();
+		glm::yawPitchRoll(&Angles[0], &Result[0], Count);
+		std::clock_t const Timestamp4 = std::clock();
+
+		std::printf("eulerAngleX * eulerAngleZ: %d clocks\n", static_cast<int>(Timestamp1 - Timestamp0));
+		std::printf("eulerAngleXZ: %d clocks\n", static_cast<int>(Timestamp2 - Timestamp1));
+		std::printf("yawPitchRoll: %d clocks\n", static_cast<int>(Timestamp3 - Timestamp2));
+		std::printf("yawPitchRoll batch: %d clocks\n", static_cast<int>(Timestamp4 - Timestamp3));
+
+		return 0;
+	}
+}//namespace perf
+
 int main()
 { 
 	int Error = 0;
@@ -323,6 +441,9 @@ int main()
 	Error += test_eulerAngleYZ::test();
 	Error += test_eulerAngleZY::test();
 	Error += test_eulerAngleYXZ::test();
+	Error += test_closedForm::test();
+	Error += test_batch::test();
+	Error += perf::test();
 
 	return Error; 
 }
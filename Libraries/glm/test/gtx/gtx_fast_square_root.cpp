@@ -2,6 +2,8 @@
 #include <glm/gtc/type_precision.hpp>
 #include <glm/gtc/epsilon.hpp>
 #include <glm/vector_relational.hpp>
+#include <limits>
+#include <cmath>
 
 int test_fastInverseSqrt()
 {
@@ -17,6 +19,25 @@ int test_fastInverseSqrt()
 	return 0;
 }
 
+// lowp vectors use a reciprocal square root estimate, within 5e-4 relative error
+int test_fastInverseSqrt_lowp()
+{
+	int Error(0);
+
+	float const Inf = std::numeric_limits<float>::infinity();
+	for(float x = 1e-6f; x < 1e6f; x *= 1.01f)
+	{
+		glm::lowp_vec3 const Result = glm::fastInverseSqrt(glm::lowp_vec3(x, x * 2.0f, x * 3.0f));
+		Error += glm::abs(Result.x * std::sqrt(x) - 1.0f) < 5e-4f ? 0 : 1;
+		Error += glm::abs(Result.z * std::sqrt(x * 3.0f) - 1.0f) < 5e-4f ? 0 : 1;
+	}
+
+	Error += glm::fastInverseSqrt(glm::lowp_vec2(0.0f, Inf)) == glm::lowp_vec2(Inf, 0.0f) ? 0 : 1;
+	Error += glm::inversesqrt(glm::lowp_vec2(4.0f, 0.0f)).y == Inf ? 0 : 1;
+
+	return Error;
+}
+
 int test_fastDistance()
 {
 	int Error(0);
@@ -39,6 +60,7 @@ int main()
 	int Error(0);
 
 	Error += test_fastInverseSqrt();
+	Error += test_fastInverseSqrt_lowp();
 	Error += test_fastDistance();
 
 	return Error;
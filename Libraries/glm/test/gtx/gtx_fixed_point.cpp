@@ -0,0 +1,436 @@
+#include <glm/glm.hpp>
+
+#if GLM_HAS_UNRESTRICTED_UNIONS && GLM_HAS_DEFAULTED_FUNCTIONS && GLM_HAS_EXPLICIT_CONVERSION_OPERATORS
+#include <glm/gtx/fixed_point.hpp>
+#include <glm/gtc/constants.hpp>
+#include <vector>
+#include <cmath>
+#include <ctime>
+#include <cstdio>
+
+namespace
+{
+	typedef glm::fixed<16, 16> fx;
+
+	// Deterministic pseudo random raw values
+	glm::uint32 next(glm::uint32 & State)
+	{
+		State = State * 1664525u + 1013904223u;
+		return State;
+	}
+
+	fx random_fixed(glm::uint32 & State, int Bits)
+	{
+		return fx::raw(static_cast<glm::int32>(next(State)) >> (32 - Bits));
+	}
+
+	glm::fxvec3 random_vector(glm::uint32 & State, int Bits)
+	{
+		fx const x = random_fixed(State, Bits);
+		fx const y = random_fixed(State, Bits);
+		fx const z = random_fixed(State, Bits);
+		return glm::fxvec3(x, y, z);
+	}
+
+	double seconds()
+	{
+		return static_cast<double>(std::clock()) / static_cast<double>(CLOCKS_PER_SEC);
+	}
+
+	double rate(std::size_t Count, double Time)
+	{
+		return static_cast<double>(Count) * 1e-6 / (Time > 0.0 ? Time : 1e-9);
+	}
+}//namespace
+
+int test_conversion()
+{
+	int Error = 0;
+
+	Error += fx(1.5f).Raw == 0x18000 ? 0 : 1;
+	Error += fx(-1.5).Raw == -0x18000 ? 0 : 1;
+	Error += fx(3).Raw == 0x30000 ? 0 : 1;
+	Error += fx(1.0f / 131072.0f).Raw == 1 ? 0 : 1;
+	Error += fx(-1.0f / 131072.0f).Raw == 0 ? 0 : 1;
+	Error += fx(1e10f) == std::numeric_limits<fx>::max() ? 0 : 1;
+	Error += fx(-1e10) == std::numeric_limits<fx>::lowest() ? 0 : 1;
+	Error += fx(std::numeric_limits<float>::quiet_NaN()).Raw == 0 ? 0 : 1;
+
+	Error += static_cast<float>(fx(0.25f)) == 0.25f ? 0 : 1;
+	Error += static_cast<double>(fx::raw(1)) == 1.0 / 65536.0 ? 0 : 1;
+	Error += static_cast<int>(fx(2.75f)) == 2 ? 0 : 1;
+	Error += static_cast<int>(fx(-2.75f)) == -3 ? 0 : 1;
+
+	glm::fixed<8, 24> const Precise(glm::pi<double>());
+	Error += std::abs(static_cast<double>(Precise) - glm::pi<double>()) <= 1.0 / (1 << 25) ? 0 : 1;
+
+	return Error;
+}
+
+int test_arithmetic()
+{
+	int Error = 0;
+
+	Error += fx(1.5f) + fx(2.25f) == fx(3.75f) ? 0 : 1;
+	Error += fx(1.5f) - fx(2.25f) == fx(-0.75f) ? 0 : 1;
+	Error += fx(1.5f) * fx(-2.5f) == fx(-3.75f) ? 0 : 1;
+	Error += fx(3) / fx(4) == fx(0.75f) ? 0 : 1;
+	Error += fx(-1) / fx(3) == fx::raw(-21845) ? 0 : 1;
+	Error += -fx(2) == fx(-2) ? 0 : 1;
+
+	// Products round half up
+	Error += fx::raw(1) * fx(0.5f) == fx::raw(1) ? 0 : 1;
+	Error += fx::raw(-1) * fx(0.5f) == fx::raw(0) ? 0 : 1;
+	Error += fx::raw(3) * fx(0.25f) == fx::raw(1) ? 0 : 1;
+
+	// Additions wrap
+	Error += std::numeric_limits<fx>::max() + fx::raw(1) == std::numeric_limits<fx>::lowest() ? 0 : 1;
+	Error += -std::numeric_limits<fx>::lowest() == std::numeric_limits<fx>::lowest() ? 0 : 1;
+
+	fx Value(1);
+	Value += fx(2);
+	Value *= fx(1.5f);
+	Value -= fx(0.5f);
+	Value /= fx(2);
+	++Value;
+	Error += Value == fx(3) ? 0 : 1;
+	Error += Value-- == fx(3) && Value == fx(2) ? 0 : 1;
+
+	Error += fx(1) < fx(2) && fx(-1) <= fx(-1) && fx(3) > fx(2) && fx(2) >= fx(2) && fx(1) != fx(2) ? 0 : 1;
+
+	return Error;
+}
+
+int test_vector()
+{
+	int Error = 0;
+
+	glm::fxvec3 const a(1, 2, 3);
+	glm::fxvec3 const b(0.5f, -1.0f, 2.0f);
+
+	Error += a + b == glm::fxvec3(1.5f, 1.0f, 5.0f) ? 0 : 1;
+	Error += a - b == glm::fxvec3(0.5f, 3.0f, 1.0f) ? 0 : 1;
+	Error += a * b == glm::fxvec3(0.5f, -2.0f, 6.0f) ? 0 : 1;
+	Error += a * fx(2) == glm::fxvec3(2, 4, 6) ? 0 : 1;
+	Error += -a == glm::fxvec3(-1, -2, -3) ? 0 : 1;
+	Error += glm::vec3(b) == glm::vec3(0.5f, -1.0f, 2.0f) ? 0 : 1;
+	Error += glm::fxvec3(glm::vec3(0.5f, -1.0f, 2.0f)) == b ? 0 : 1;
+
+	Error += glm::dot(a, b) == fx(4.5f) ? 0 : 1;
+	Error += glm::cross(a, b) == glm::fxvec3(7.0f, -0.5f, -2.0f) ? 0 : 1;
+	Error += glm::dot(glm::fxvec4(1, 2, 3, 4), glm::fxvec4(fx(1))) == fx(10) ? 0 : 1;
+
+	Error += glm::normalize(glm::fxvec3(0, 0, 0)) == glm::fxvec3(0, 0, 0) ? 0 : 1;
+	Error += glm::normalize(glm::fxvec3(3, 0, 4)) == glm::fxvec3(0.6f, 0.0f, 0.8f) ? 0 : 1;
+	Error += glm::normalize(glm::fxvec2(0, -100)) == glm::fxvec2(0, -1) ? 0 : 1;
+	Error += glm::normalize(glm::fxvec3(fx::raw(1), fx::raw(0), fx::raw(0))) == glm::fxvec3(1, 0, 0) ? 0 : 1;
+
+	return Error;
+}
+
+int test_matrix()
+{
+	int Error = 0;
+
+	glm::fxmat3 const Identity;
+	glm::fxvec3 const v(1.5f, -2.0f, 0.25f);
+	Error += Identity * v == v ? 0 : 1;
+
+	glm::fxmat3 const m(
+		fx(0), fx(1), fx(0),
+		fx(-1), fx(0), fx(0),
+		fx(0), fx(0), fx(2));
+	Error += m * v == glm::fxvec3(2.0f, 1.5f, 0.5f) ? 0 : 1;
+	Error += (m * m) * v == m * (m * v) ? 0 : 1;
+	Error += (m * v) * m == glm::fxvec3(1.5f, -2.0f, 1.0f) ? 0 : 1;
+
+	glm::fxmat4 const t(fx(1));
+	Error += t * glm::fxvec4(1, 2, 3, 1) == glm::fxvec4(1, 2, 3, 1) ? 0 : 1;
+
+	return Error;
+}
+
+// Every operation is within a few units in the last place of the exact result
+int test_accuracy()
+{
+	int Error = 0;
+
+	glm::uint32 State = 1;
+	double MaxNormalize = 0.0;
+	double MaxDot = 0.0;
+	for(int i = 0; i < 100000; ++i)
+	{
+		glm::fxvec3 const a = random_vector(State, 26);
+		glm::fxvec3 const b = random_vector(State, 20);
+		glm::dvec3 const da(a);
+		glm::dvec3 const db(b);
+
+		MaxDot = glm::max(MaxDot, std::abs(static_cast<double>(glm::dot(a, b)) - glm::dot(da, db)));
+		if(da != glm::dvec3(0))
+			MaxNormalize = glm::max(MaxNormalize, glm::length(glm::dvec3(glm::normalize(a)) - glm::normalize(da)));
+	}
+	Error += MaxDot <= 0.5 / 65536.0 ? 0 : 1;
+	Error += MaxNormalize <= 1.5 / 65536.0 ? 0 : 1;
+
+	double MaxSin = 0.0;
+	double MaxCos = 0.0;
+	for(int i = -200000; i <= 200000; ++i)
+	{
+		fx const Angle = fx::raw(i * 41);
+		double const Radians = static_cast<double>(Angle);
+		MaxSin = glm::max(MaxSin, std::abs(static_cast<double>(glm::sin(Angle)) - std::sin(Radians)));
+		MaxCos = glm::max(MaxCos, std::abs(static_cast<double>(glm::cos(Angle)) - std::cos(Radians)));
+	}
+	Error += MaxSin <= 1.0 / 65536.0 ? 0 : 1;
+	Error += MaxCos <= 1.0 / 65536.0 ? 0 : 1;
+
+	Error += glm::sin(fx(0)) == fx(0) ? 0 : 1;
+	Error += glm::cos(fx(0)) == fx(1) ? 0 : 1;
+	Error += glm::sin(glm::fxvec2(0, glm::half_pi<double>())) == glm::fxvec2(0, 1) ? 0 : 1;
+
+	return Error;
+}
+
+// Batch functions give the bits of the functions on single values, for any count
+int test_batch()
+{
+	int Error = 0;
+
+	glm::uint32 State = 7;
+	std::size_t const Count = 1027;
+	std::vector<glm::fxvec3> a(Count);
+	std::vector<glm::fxvec3> b(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		a[i] = random_vector(State, i < 64 ? 32 : 24);
+		b[i] = random_vector(State, i < 64 ? 32 : 20);
+	}
+	a[5] = glm::fxvec3(0, 0, 0);
+	a[6] = glm::fxvec3(std::numeric_limits<fx>::lowest());
+	b[6] = glm::fxvec3(std::numeric_limits<fx>::lowest());
+
+	for(std::size_t n = Count - 3; n <= Count; ++n)
+	{
+		std::vector<glm::fxvec3> Vectors(n);
+		std::vector<fx> Scalars(n);
+
+		glm::add(&a[0], &b[0], &Vectors[0], n);
+		for(std::size_t i = 0; i < n; ++i)
+			Error += Vectors[i] == a[i] + b[i] ? 0 : 1;
+
+		glm::mul(&a[0], &b[0], &Vectors[0], n);
+		for(std::size_t i = 0; i < n; ++i)
+			Error += Vectors[i] == a[i] * b[i] ? 0 : 1;
+
+		glm::dot(&a[0], &b[0], &Scalars[0], n);
+		for(std::size_t i = 0; i < n; ++i)
+			Error += Scalars[i] == glm::dot(a[i], b[i]) ? 0 : 1;
+
+		glm::cross(&a[0], &b[0], &Vectors[0], n);
+		for(std::size_t i = 0; i < n; ++i)
+			Error += Vectors[i] == glm::cross(a[i], b[i]) ? 0 : 1;
+
+		glm::normalize(&a[0], &Vectors[0], n);
+		for(std::size_t i = 0; i < n; ++i)
+			Error += Vectors[i] == glm::normalize(a[i]) ? 0 : 1;
+
+		std::vector<fx> Angles(n);
+		for(std::size_t i = 0; i < n; ++i)
+			Angles[i] = a[i].x;
+		glm::sin(&Angles[0], &Scalars[0], n);
+		for(std::size_t i = 0; i < n; ++i)
+			Error += Scalars[i] == glm::sin(Angles[i]) ? 0 : 1;
+		glm::cos(&Angles[0], &Scalars[0], n);
+		for(std::size_t i = 0; i < n; ++i)
+			Error += Scalars[i] == glm::cos(Angles[i]) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// A small lockstep simulation whose state hash is the same on every compiler, build option and processor
+int test_determinism()
+{
+	int Error = 0;
+
+	std::size_t const Count = 256;
+	std::vector<glm::fxvec3> Positions(Count);
+	std::vector<glm::fxvec3> Velocities(Count);
+	glm::uint32 State = 12345;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Positions[i] = random_vector(State, 24);
+		Velocities[i] = random_vector(State, 18);
+	}
+
+	glm::fxvec3 const Axis = glm::normalize(glm::fxvec3(1, 2, 3));
+	fx const Step(1.0 / 60.0);
+	std::vector<glm::fxvec3> Directions(Count);
+	std::vector<glm::fxvec3> Turns(Count);
+	for(int Frame = 0; Frame < 120; ++Frame)
+	{
+		fx const Angle = fx(Frame) * Step;
+		glm::fxmat3 const Rotation(
+			glm::cos(Angle), glm::sin(Angle), fx(0),
+			-glm::sin(Angle), glm::cos(Angle), fx(0),
+			fx(0), fx(0), fx(1));
+
+		glm::normalize(&Velocities[0], &Directions[0], Count);
+		std::vector<glm::fxvec3> Axes(Count, Axis);
+		glm::cross(&Directions[0], &Axes[0], &Turns[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Velocities[i] = Rotation * Velocities[i] + Turns[i] * Step;
+			Positions[i] += Velocities[i] * Step;
+		}
+	}
+
+	glm::uint32 Hash = 2166136261u;
+	for(std::size_t i = 0; i < Count; ++i)
+	for(glm::length_t j = 0; j < 3; ++j)
+	{
+		Hash = (Hash ^ static_cast<glm::uint32>(Positions[i][j].Raw)) * 16777619u;
+		Hash = (Hash ^ static_cast<glm::uint32>(Velocities[i][j].Raw)) * 16777619u;
+	}
+
+	Error += Hash == 0xcd954450u ? 0 : 1;
+	if(Error)
+		std::printf("GTX_fixed_point simulation hash: 0x%08x\n", Hash);
+
+	return Error;
+}
+
+int perf_batch()
+{
+	int Error = 0;
+
+	std::size_t const Count = 1 << 14;
+	std::size_t const Repeat = 256;
+
+	glm::uint32 State = 3;
+	std::vector<glm::fxvec3> a(Count);
+	std::vector<glm::fxvec3> b(Count);
+	std::vector<glm::vec3> fa(Count);
+	std::vector<glm::vec3> fb(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		a[i] = random_vector(State, 22);
+		b[i] = random_vector(State, 18);
+		fa[i] = glm::vec3(a[i]);
+		fb[i] = glm::vec3(b[i]);
+	}
+	std::vector<glm::fxvec3> Vectors(Count);
+	std::vector<fx> Scalars(Count);
+	std::vector<glm::vec3> FloatVectors(Count);
+	std::vector<float> Floats(Count);
+
+	double Start = seconds();
+	for(std::size_t r = 0; r < Repeat; ++r)
+		glm::mul(&a[0], &b[0], &Vectors[0], Count);
+	double const BatchMul = seconds() - Start;
+
+	Start = seconds();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Count; ++i)
+		Vectors[i] = a[i] * b[i];
+	double const ScalarMul = seconds() - Start;
+
+	Start = seconds();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Count; ++i)
+		FloatVectors[i] = fa[i] * fb[i];
+	double const FloatMul = seconds() - Start;
+
+	Start = seconds();
+	for(std::size_t r = 0; r < Repeat; ++r)
+		glm::dot(&a[0], &b[0], &Scalars[0], Count);
+	double const BatchDot = seconds() - Start;
+
+	Start = seconds();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Count; ++i)
+		Scalars[i] = glm::dot(a[i], b[i]);
+	double const ScalarDot = seconds() - Start;
+
+	Start = seconds();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Count; ++i)
+		Floats[i] = glm::dot(fa[i], fb[i]);
+	double const FloatDot = seconds() - Start;
+
+	Start = seconds();
+	for(std::size_t r = 0; r < Repeat; ++r)
+		glm::cross(&a[0], &b[0], &Vectors[0], Count);
+	double const BatchCross = seconds() - Start;
+
+	Start = seconds();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Count; ++i)
+		Vectors[i] = glm::cross(a[i], b[i]);
+	double const ScalarCross = seconds() - Start;
+
+	Start = seconds();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Count; ++i)
+		FloatVectors[i] = glm::cross(fa[i], fb[i]);
+	double const FloatCross = seconds() - Start;
+
+	Start = seconds();
+	for(std::size_t r = 0; r < Repeat; ++r)
+		glm::normalize(&a[0], &Vectors[0], Count);
+	double const BatchNormalize = seconds() - Start;
+
+	Start = seconds();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Count; ++i)
+		FloatVectors[i] = glm::normalize(fa[i]);
+	double const FloatNormalize = seconds() - Start;
+
+	Start = seconds();
+	for(std::size_t r = 0; r < Repeat; ++r)
+		glm::sin(&Scalars[0], &Scalars[0], Count);
+	double const BatchSin = seconds() - Start;
+
+	Start = seconds();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Count; ++i)
+		Floats[i] = std::sin(Floats[i]);
+	double const FloatSin = seconds() - Start;
+
+	std::size_t const Total = Count * Repeat;
+	std::printf("GTX_fixed_point M/s     batch   scalar    float\n");
+	std::printf("GTX_fixed_point mul    %6.0f   %6.0f   %6.0f\n", rate(Total, BatchMul), rate(Total, ScalarMul), rate(Total, FloatMul));
+	std::printf("GTX_fixed_point dot    %6.0f   %6.0f   %6.0f\n", rate(Total, BatchDot), rate(Total, ScalarDot), rate(Total, FloatDot));
+	std::printf("GTX_fixed_point cross  %6.0f   %6.0f   %6.0f\n", rate(Total, BatchCross), rate(Total, ScalarCross), rate(Total, FloatCross));
+	std::printf("GTX_fixed_point norm   %6.0f        -   %6.0f\n", rate(Total, BatchNormalize), rate(Total, FloatNormalize));
+	std::printf("GTX_fixed_point sin    %6.0f        -   %6.0f\n", rate(Total, BatchSin), rate(Total, FloatSin));
+
+	Error += Vectors[0] == glm::normalize(a[0]) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_conversion();
+	Error += test_arithmetic();
+	Error += test_vector();
+	Error += test_matrix();
+	Error += test_accuracy();
+	Error += test_batch();
+	Error += test_determinism();
+	Error += perf_batch();
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,398 @@
+#include <glm/gtx/half_float.hpp>
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <limits>
+#include <vector>
+#include <cmath>
+#include <cstring>
+#include <ctime>
+#include <cstdio>
+
+namespace
+{
+	glm::uint32 float_bits(float Value)
+	{
+		glm::uint32 Bits = 0;
+		std::memcpy(&Bits, &Value, sizeof(Bits));
+		return Bits;
+	}
+
+	float bits_float(glm::uint32 Bits)
+	{
+		float Value = 0.0f;
+		std::memcpy(&Value, &Bits, sizeof(Value));
+		return Value;
+	}
+
+	bool is_nan(float Value)
+	{
+		return Value != Value;
+	}
+
+	glm::half half_bits(glm::uint16 Bits)
+	{
+		glm::half Half;
+		Half.Bits = Bits;
+		return Half;
+	}
+
+	double seconds()
+	{
+		return static_cast<double>(std::clock()) / static_cast<double>(CLOCKS_PER_SEC);
+	}
+}//namespace
+
+// Every half converts to the float of detail::toFloat32, with both the scalar and the batch conversion
+int test_unpack_exhaustive()
+{
+	int Error = 0;
+
+	std::vector<glm::half> Halves(65536);
+	for(glm::uint32 i = 0; i < 65536; ++i)
+		Halves[i] = half_bits(static_cast<glm::uint16>(i));
+
+	std::vector<float> Floats(Halves.size());
+	glm::unpackHalf(&Halves[0], &Floats[0], Halves.size());
+
+	for(glm::uint32 i = 0; i < 65536; ++i)
+	{
+		float const Expected = glm::detail::toFloat32(static_cast<glm::detail::hdata>(i));
+		float const Scalar = Halves[i];
+		if(is_nan(Expected))
+		{
+			Error += is_nan(Scalar) ? 0 : 1;
+			Error += is_nan(Floats[i]) ? 0 : 1;
+		}
+		else
+		{
+			Error += float_bits(Scalar) == float_bits(Expected) ? 0 : 1;
+			Error += float_bits(Floats[i]) == float_bits(Expected) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+// Floats sampled across every exponent convert to the half of detail::toFloat16 but for ties, NaNs stay NaNs
+int test_pack_sampled()
+{
+	int Error = 0;
+
+	std::vector<float> Floats;
+	for(glm::uint64 Bits = 0; Bits <= 0xffffffffull; Bits += 997)
+		Floats.push_back(bits_float(static_cast<glm::uint32>(Bits)));
+
+	std::vector<glm::half> Halves(Floats.size());
+	glm::packHalf(&Floats[0], &Halves[0], Floats.size());
+
+	for(std::size_t i = 0; i < Floats.size(); ++i)
+	{
+		glm::half const Scalar(Floats[i]);
+		if(is_nan(Floats[i]))
+		{
+			Error += (Scalar.Bits & 0x7fff) > 0x7c00 ? 0 : 1;
+			Error += (Halves[i].Bits & 0x7fff) > 0x7c00 ? 0 : 1;
+			continue;
+		}
+
+		// detail::toFloat16 rounds ties away from zero, to the odd neighbour of the even half
+		glm::uint16 const Expected = static_cast<glm::uint16>(glm::detail::toFloat16(Floats[i]));
+		bool const Tie = float_bits(static_cast<float>(half_bits(Expected))) != float_bits(Floats[i]) && (Expected & 1) == 1;
+		Error += Scalar.Bits == Expected || (Tie && Scalar.Bits == Expected - 1) ? 0 : 1;
+		Error += Halves[i].Bits == Scalar.Bits ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int test_rounding()
+{
+	int Error = 0;
+
+	// Ties round to the even mantissa: 1 + 2^-11 is halfway between 1 and 1 + 2^-10
+	Error += glm::half(1.0f + 1.0f / 2048.0f).Bits == 0x3c00 ? 0 : 1;
+	Error += glm::half(1.0f + 3.0f / 2048.0f).Bits == 0x3c02 ? 0 : 1;
+	Error += glm::half(1.0f + 1.0f / 2048.0f + 1.0f / 65536.0f).Bits == 0x3c01 ? 0 : 1;
+
+	// 65504 is the largest half, 65520 the first float rounding to infinity
+	Error += glm::half(65504.0f).Bits == 0x7bff ? 0 : 1;
+	Error += glm::half(65519.0f).Bits == 0x7bff ? 0 : 1;
+	Error += glm::half(65520.0f).Bits == 0x7c00 ? 0 : 1;
+	Error += glm::half(-65520.0f).Bits == 0xfc00 ? 0 : 1;
+	Error += glm::half(std::numeric_limits<float>::infinity()).Bits == 0x7c00 ? 0 : 1;
+
+	// Subnormals down to 2^-24, and half of it rounding to zero
+	Error += glm::half(std::ldexp(1.0f, -24)).Bits == 0x0001 ? 0 : 1;
+	Error += glm::half(std::ldexp(1.0f, -25)).Bits == 0x0000 ? 0 : 1;
+	Error += glm::half(std::ldexp(3.0f, -26)).Bits == 0x0001 ? 0 : 1;
+	Error += glm::half(std::ldexp(1.0f, -14)).Bits == 0x0400 ? 0 : 1;
+	Error += glm::half(-0.0f).Bits == 0x8000 ? 0 : 1;
+
+	Error += static_cast<float>(glm::half(0.5f)) == 0.5f ? 0 : 1;
+	Error += static_cast<float>(glm::half(-2.0f)) == -2.0f ? 0 : 1;
+
+	return Error;
+}
+
+int test_vector()
+{
+	int Error = 0;
+
+	{
+		Error += sizeof(glm::half) == 2 ? 0 : 1;
+		Error += sizeof(glm::hvec2) == 4 ? 0 : 1;
+		Error += sizeof(glm::hvec3) == 6 ? 0 : 1;
+		Error += sizeof(glm::hvec4) == 8 ? 0 : 1;
+		Error += sizeof(glm::hmat4) == 32 ? 0 : 1;
+	}
+
+	{
+		glm::hvec2 const A(glm::vec2(1.5f, -2.0f));
+		glm::vec2 const B(A);
+		Error += B == glm::vec2(1.5f, -2.0f) ? 0 : 1;
+		Error += A.length() == 2 ? 0 : 1;
+		Error += static_cast<float>(A[1]) == -2.0f ? 0 : 1;
+	}
+
+	{
+		glm::hvec3 A(glm::vec3(0.25f, 1024.0f, -8.0f));
+		glm::vec3 const B(A);
+		Error += B == glm::vec3(0.25f, 1024.0f, -8.0f) ? 0 : 1;
+		A[2] = 3.0f;
+		Error += static_cast<float>(A.z) == 3.0f ? 0 : 1;
+	}
+
+	{
+		glm::vec4 const Value(glm::pi<float>(), 0.1f, -100.0f, 1e-3f);
+		glm::hvec4 const A(Value);
+		glm::vec4 const B(A);
+		Error += glm::all(glm::epsilonEqual(B, Value, glm::abs(Value) * 1e-3f)) ? 0 : 1;
+
+		glm::hvec4 const C(glm::half(1.0f), 2.0f, 3.0f, 4.0f);
+		Error += glm::vec4(C) == glm::vec4(1, 2, 3, 4) ? 0 : 1;
+		Error += glm::hvec4(glm::half(2.0f)) == glm::hvec4(glm::vec4(2.0f)) ? 0 : 1;
+		Error += A != C ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int test_arithmetic()
+{
+	int Error = 0;
+
+	glm::hvec4 const A(glm::vec4(1, 2, 3, 4));
+	glm::hvec4 const B(glm::vec4(4, 3, 2, 1));
+
+	Error += A + B == glm::vec4(5) ? 0 : 1;
+	Error += A - B == glm::vec4(-3, -1, 1, 3) ? 0 : 1;
+	Error += A * B == glm::vec4(4, 6, 6, 4) ? 0 : 1;
+	Error += A / B == glm::vec4(0.25f, 2.0f / 3.0f, 1.5f, 4.0f) ? 0 : 1;
+	Error += A * 2.0f == glm::vec4(2, 4, 6, 8) ? 0 : 1;
+	Error += 1.0f - A == glm::vec4(0, -1, -2, -3) ? 0 : 1;
+	Error += -A == glm::vec4(-1, -2, -3, -4) ? 0 : 1;
+
+	glm::hvec3 const C(glm::vec3(1, 2, 3));
+	Error += C + C == glm::vec3(2, 4, 6) ? 0 : 1;
+	Error += C / 2.0f == glm::vec3(0.5f, 1.0f, 1.5f) ? 0 : 1;
+
+	glm::hvec2 const D(glm::vec2(1, 2));
+	Error += D * D == glm::vec2(1, 4) ? 0 : 1;
+
+	glm::half const H(3.0f);
+	Error += H * 2.0f == 6.0f ? 0 : 1;
+
+	return Error;
+}
+
+int test_matrix()
+{
+	int Error = 0;
+
+	{
+		glm::hmat4 const Identity;
+		Error += glm::mat4(Identity) == glm::mat4(1.0f) ? 0 : 1;
+	}
+
+	{
+		glm::mat4 const Transform = glm::translate(glm::mat4(1.0f), glm::vec3(1, 2, 3)) * glm::scale(glm::mat4(1.0f), glm::vec3(2.0f));
+		glm::hmat4 const Half(Transform);
+		Error += glm::mat4(Half) == Transform ? 0 : 1;
+
+		glm::vec4 const Point(1, 1, 1, 1);
+		Error += Half * Point == Transform * Point ? 0 : 1;
+		Error += Half * glm::hvec4(Point) == Transform * Point ? 0 : 1;
+		Error += glm::vec4(Half[3]) == glm::vec4(1, 2, 3, 1) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// Counts that are not multiples of the SIMD width convert their tail too
+int test_arrays()
+{
+	int Error = 0;
+
+	for(std::size_t Count = 0; Count < 20; ++Count)
+	{
+		std::vector<glm::vec4> Source(Count + 1);
+		for(std::size_t i = 0; i < Source.size(); ++i)
+			Source[i] = glm::vec4(static_cast<float>(i), 0.5f, -static_cast<float>(i), 2.0f);
+
+		std::vector<glm::hvec4> Halves(Count + 1, glm::hvec4(glm::half(7.0f)));
+		glm::packHalf(&Source[0], &Halves[0], Count);
+		Error += glm::vec4(Halves[Count]) == glm::vec4(7.0f) ? 0 : 1;
+
+		std::vector<glm::vec4> Result(Count + 1, glm::vec4(9.0f));
+		glm::unpackHalf(&Halves[0], &Result[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Result[i] == Source[i] ? 0 : 1;
+		Error += Result[Count] == glm::vec4(9.0f) ? 0 : 1;
+	}
+
+	{
+		std::vector<glm::vec3> Source(13);
+		for(std::size_t i = 0; i < Source.size(); ++i)
+			Source[i] = glm::vec3(static_cast<float>(i) * 0.25f);
+		std::vector<glm::hvec3> Halves(Source.size());
+		glm::packHalf(&Source[0], &Halves[0], Source.size());
+		std::vector<glm::vec3> Result(Source.size());
+		glm::unpackHalf(&Halves[0], &Result[0], Source.size());
+		for(std::size_t i = 0; i < Source.size(); ++i)
+			Error += Result[i] == Source[i] ? 0 : 1;
+	}
+
+	{
+		std::vector<glm::vec2> Source(5, glm::vec2(-1.0f, 0.125f));
+		std::vector<glm::hvec2> Halves(Source.size());
+		glm::packHalf(&Source[0], &Halves[0], Source.size());
+		std::vector<glm::vec2> Result(Source.size());
+		glm::unpackHalf(&Halves[0], &Result[0], Source.size());
+		for(std::size_t i = 0; i < Source.size(); ++i)
+			Error += Result[i] == Source[i] ? 0 : 1;
+	}
+
+	{
+		std::vector<glm::mat4> Source(3);
+		for(std::size_t i = 0; i < Source.size(); ++i)
+			Source[i] = glm::translate(glm::mat4(1.0f), glm::vec3(static_cast<float>(i)));
+		std::vector<glm::hmat4> Halves(Source.size());
+		glm::packHalf(&Source[0], &Halves[0], Source.size());
+		std::vector<glm::mat4> Result(Source.size());
+		glm::unpackHalf(&Halves[0], &Result[0], Source.size());
+		for(std::size_t i = 0; i < Source.size(); ++i)
+			Error += Result[i] == Source[i] ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int perf_footprint()
+{
+	int Error = 0;
+
+	std::size_t const Count = 1 << 20;
+	std::size_t const Float = Count * sizeof(glm::vec4);
+	std::size_t const Half = Count * sizeof(glm::hvec4);
+	std::printf("GTX_half_float footprint of %d vec4: %d KB, hvec4: %d KB\n",
+		static_cast<int>(Count), static_cast<int>(Float >> 10), static_cast<int>(Half >> 10));
+	Error += Half * 2 == Float ? 0 : 1;
+
+	return Error;
+}
+
+int perf_conversion()
+{
+	int Error = 0;
+
+	std::size_t const Count = 1 << 22;
+	std::size_t const Repeat = 8;
+
+	std::vector<float> Floats(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Floats[i] = static_cast<float>(i % 4096) * 0.125f - 256.0f;
+	std::vector<glm::half> Halves(Count);
+
+	double const PackStart = seconds();
+	for(std::size_t r = 0; r < Repeat; ++r)
+		glm::packHalf(&Floats[0], &Halves[0], Count);
+	double const PackTime = seconds() - PackStart;
+
+	double const UnpackStart = seconds();
+	for(std::size_t r = 0; r < Repeat; ++r)
+		glm::unpackHalf(&Halves[0], &Floats[0], Count);
+	double const UnpackTime = seconds() - UnpackStart;
+
+	double const ScalarStart = seconds();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Count; ++i)
+		Halves[i].Bits = static_cast<glm::uint16>(glm::detail::toFloat16(Floats[i]));
+	double const ScalarTime = seconds() - ScalarStart;
+
+	double const Values = static_cast<double>(Count * Repeat) * 1e-6;
+	std::printf("GTX_half_float packHalf: %.0f M/s, unpackHalf: %.0f M/s, detail::toFloat16: %.0f M/s\n",
+		Values / (PackTime > 0.0 ? PackTime : 1e-9),
+		Values / (UnpackTime > 0.0 ? UnpackTime : 1e-9),
+		Values / (ScalarTime > 0.0 ? ScalarTime : 1e-9));
+
+	for(std::size_t i = 0; i < Count; i += 4099)
+		Error += static_cast<float>(Halves[i]) == static_cast<float>(i % 4096) * 0.125f - 256.0f ? 0 : 1;
+
+	return Error;
+}
+
+// Summing attribute arrays larger than the caches, bound by memory bandwidth
+int perf_bandwidth()
+{
+	int Error = 0;
+
+	std::size_t const Count = 1 << 22;
+	std::size_t const Repeat = 4;
+
+	std::vector<glm::vec4> Floats(Count, glm::vec4(1.0f, 0.5f, 0.25f, 2.0f));
+	std::vector<glm::hvec4> Halves(Count);
+	glm::packHalf(&Floats[0], &Halves[0], Count);
+
+	double const FloatStart = seconds();
+	glm::vec4 FloatSum(0.0f);
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Count; ++i)
+		FloatSum += Floats[i];
+	double const FloatTime = seconds() - FloatStart;
+
+	double const HalfStart = seconds();
+	glm::vec4 HalfSum(0.0f);
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Count; ++i)
+		HalfSum += glm::vec4(Halves[i]);
+	double const HalfTime = seconds() - HalfStart;
+
+	double const Bytes = static_cast<double>(Count * Repeat) * 1e-9;
+	std::printf("GTX_half_float sum of vec4: %.2f GB/s, hvec4: %.2f GB/s (%.2f ms, %.2f ms)\n",
+		Bytes * sizeof(glm::vec4) / (FloatTime > 0.0 ? FloatTime : 1e-9),
+		Bytes * sizeof(glm::hvec4) / (HalfTime > 0.0 ? HalfTime : 1e-9),
+		FloatTime * 1000.0, HalfTime * 1000.0);
+
+	Error += FloatSum == HalfSum ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_unpack_exhaustive();
+	Error += test_pack_sampled();
+	Error += test_rounding();
+	Error += test_vector();
+	Error += test_arithmetic();
+	Error += test_matrix();
+	Error += test_arrays();
+	Error += perf_footprint();
+	Error += perf_conversion();
+	Error += perf_bandwidth();
+
+	return Error;
+}
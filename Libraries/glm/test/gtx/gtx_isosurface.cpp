@@ -0,0 +1,201 @@
+#include <glm/gtx/isosurface.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <algorithm>
+#include <vector>
+#include <ctime>
+#include <cstdio>
+
+namespace
+{
+	// Signed distance to a sphere of radius Radius centered in a grid of Size^3 vertices with a unit spacing
+	void sphereField(int Size, float Radius, std::vector<float> & Values)
+	{
+		float const Center = static_cast<float>(Size - 1) * 0.5f;
+		Values.resize(static_cast<std::size_t>(Size * Size * Size));
+		for(int z = 0; z < Size; ++z)
+		for(int y = 0; y < Size; ++y)
+		for(int x = 0; x < Size; ++x)
+			Values[static_cast<std::size_t>((z * Size + y) * Size + x)] = glm::length(glm::vec3(x, y, z) - Center) - Radius;
+	}
+
+	// Counts the edges not shared by exactly two triangles, with opposite directions
+	int openEdges(std::vector<glm::uint> const & Indices)
+	{
+		std::vector<glm::uint64> Edges;
+		for(std::size_t t = 0; t < Indices.size(); t += 3)
+		for(std::size_t k = 0; k < 3; ++k)
+			Edges.push_back((static_cast<glm::uint64>(Indices[t + k]) << 32) | Indices[t + (k + 1) % 3]);
+		std::sort(Edges.begin(), Edges.end());
+
+		int Error = 0;
+		for(std::size_t i = 0; i < Edges.size(); ++i)
+		{
+			bool const Duplicated = (i > 0 && Edges[i] == Edges[i - 1]) || (i + 1 < Edges.size() && Edges[i] == Edges[i + 1]);
+			glm::uint64 const Opposite = (Edges[i] << 32) | (Edges[i] >> 32);
+			bool const Paired = std::binary_search(Edges.begin(), Edges.end(), Opposite);
+			Error += !Duplicated && Paired ? 0 : 1;
+		}
+		return Error;
+	}
+
+	int sphere(glm::isosurface_mode Mode, float Tolerance)
+	{
+		int Error = 0;
+
+		int const Size = 24;
+		float const Radius = 8.3f;
+		std::vector<float> Values;
+		sphereField(Size, Radius, Values);
+
+		std::vector<glm::vec3> Positions;
+		std::vector<glm::uint> Indices;
+		glm::vec3 const Origin(-static_cast<float>(Size - 1) * 0.5f);
+		glm::isosurface(&Values[0], glm::ivec3(Size), 0.0f, Origin, 1.0f, Mode, Positions, Indices);
+
+		Error += !Positions.empty() && !Indices.empty() ? 0 : 1;
+
+		for(std::size_t i = 0; i < Positions.size(); ++i)
+			Error += glm::abs(glm::length(Positions[i]) - Radius) < Tolerance ? 0 : 1;
+
+		// Closed surface of genus 0, front facing from the outside
+		Error += openEdges(Indices);
+		std::size_t const Edges = Indices.size() / 2;
+		Error += Positions.size() + Indices.size() / 3 == Edges + 2 ? 0 : 1;
+		for(std::size_t t = 0; t < Indices.size(); t += 3)
+		{
+			glm::vec3 const & p0 = Positions[Indices[t + 0]];
+			glm::vec3 const & p1 = Positions[Indices[t + 1]];
+			glm::vec3 const & p2 = Positions[Indices[t + 2]];
+			Error += glm::dot(glm::cross(p1 - p0, p2 - p0), p0 + p1 + p2) > 0.0f ? 0 : 1;
+		}
+
+		return Error;
+	}
+}//namespace
+
+namespace marching
+{
+	int test()
+	{
+		return sphere(glm::marching_cubes, 0.05f);
+	}
+}//namespace marching
+
+namespace nets
+{
+	int test()
+	{
+		return sphere(glm::surface_nets, 0.3f);
+	}
+}//namespace nets
+
+namespace ambiguous
+{
+	// Random fields hit the ambiguous faces of marching cubes, which must still produce a closed surface
+	int test()
+	{
+		int Error = 0;
+
+		int const Size = 16;
+		std::vector<float> Values(Size * Size * Size, 1.0f);
+		unsigned int Seed = 1;
+		for(int z = 1; z < Size - 1; ++z)
+		for(int y = 1; y < Size - 1; ++y)
+		for(int x = 1; x < Size - 1; ++x)
+		{
+			Seed = Seed * 1664525u + 1013904223u;
+			Values[(z * Size + y) * Size + x] = static_cast<float>(Seed >> 8) / static_cast<float>(1 << 24) - 0.5f;
+		}
+
+		std::vector<glm::vec3> Positions;
+		std::vector<glm::uint> Indices;
+		glm::isosurface(&Values[0], glm::ivec3(Size), 0.0f, glm::vec3(0), 1.0f, glm::marching_cubes, Positions, Indices);
+		Error += openEdges(Indices);
+
+		glm::isosurface(&Values[0], glm::ivec3(Size), 0.0f, glm::vec3(0), 1.0f, glm::surface_nets, Positions, Indices);
+		Error += Indices.size() % 6 == 0 ? 0 : 1;
+
+		return Error;
+	}
+}//namespace ambiguous
+
+namespace sampling
+{
+	int test()
+	{
+		int Error = 0;
+
+		glm::ivec3 const Size(13, 7, 5);
+		glm::vec3 const Origin(-1.5f, 2.0f, 0.25f);
+		float const Spacing = 0.37f;
+
+		std::vector<float> Simplex(Size.x * Size.y * Size.z), Perlin(Simplex.size());
+		std::vector<glm::vec2> Cellular(Simplex.size());
+		glm::simplexGrid(Origin, Spacing, Size, &Simplex[0]);
+		glm::perlinGrid(Origin, Spacing, Size, &Perlin[0]);
+		glm::cellularGrid(Origin, Spacing, Size, &Cellular[0]);
+
+		for(int z = 0; z < Size.z; ++z)
+		for(int y = 0; y < Size.y; ++y)
+		for(int x = 0; x < Size.x; ++x)
+		{
+			glm::vec3 const Position = Origin + glm::vec3(x, y, z) * Spacing;
+			std::size_t const i = static_cast<std::size_t>((z * Size.y + y) * Size.x + x);
+			Error += glm::epsilonEqual(Simplex[i], glm::simplex(Position), 0.0001f) ? 0 : 1;
+			Error += glm::epsilonEqual(Perlin[i], glm::perlin(Position), 0.0001f) ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(Cellular[i], glm::cellular(Position), 0.0001f)) ? 0 : 1;
+		}
+
+		return Error;
+	}
+}//namespace sampling
+
+namespace perf
+{
+	int test()
+	{
+		// 128^3 noise terrain, 512^3 fields take 64 times longer
+		int const Size = 128;
+		std::vector<float> Values(static_cast<std::size_t>(Size * Size * Size));
+
+		std::clock_t const Timestamp0 = std::clock();
+		glm::simplexGrid(glm::vec3(0), 1.0f / 32.0f, glm::ivec3(Size), &Values[0]);
+		std::clock_t const Timestamp1 = std::clock();
+
+		std::vector<glm::vec2> Cellular(Values.size());
+		glm::cellularGrid(glm::vec3(0), 1.0f / 8.0f, glm::ivec3(Size), &Cellular[0]);
+		std::clock_t const TimestampCellular = std::clock();
+
+		std::vector<glm::vec3> Positions;
+		std::vector<glm::uint> Indices;
+		glm::isosurface(&Values[0], glm::ivec3(Size), 0.0f, glm::vec3(0), 1.0f, glm::marching_cubes, Positions, Indices);
+		std::clock_t const Timestamp2 = std::clock();
+		std::size_t const MarchingTriangles = Indices.size() / 3;
+
+		glm::isosurface(&Values[0], glm::ivec3(Size), 0.0f, glm::vec3(0), 1.0f, glm::surface_nets, Positions, Indices);
+		std::clock_t const Timestamp3 = std::clock();
+		std::size_t const NetsTriangles = Indices.size() / 3;
+
+		// std::clock measures the processor time of all threads
+		double const Seconds = 1.0 / static_cast<double>(CLOCKS_PER_SEC);
+		std::printf("simplexGrid: %.1f M samples/s of CPU time\n", static_cast<double>(Values.size()) / 1000000.0 / (static_cast<double>(Timestamp1 - Timestamp0 + 1) * Seconds));
+		std::printf("cellularGrid: %.1f M samples/s of CPU time\n", static_cast<double>(Cellular.size()) / 1000000.0 / (static_cast<double>(TimestampCellular - Timestamp1 + 1) * Seconds));
+		std::printf("isosurface marching cubes: %.1f M triangles/s of CPU time\n", static_cast<double>(MarchingTriangles) / 1000000.0 / (static_cast<double>(Timestamp2 - TimestampCellular + 1) * Seconds));
+		std::printf("isosurface surface nets: %.1f M triangles/s of CPU time\n", static_cast<double>(NetsTriangles) / 1000000.0 / (static_cast<double>(Timestamp3 - Timestamp2 + 1) * Seconds));
+
+		return 0;
+	}
+}//namespace perf
+
+int main()
+{
+	int Error = 0;
+
+	Error += marching::test();
+	Error += nets::test();
+	Error += ambiguous::test();
+	Error += sampling::test();
+	Error += perf::test();
+
+	return Error;
+}
@@ -0,0 +1,268 @@
+#include <glm/gtx/large_world.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/constants.hpp>
+#include <vector>
+#include <cmath>
+#include <ctime>
+#include <cstdio>
+
+namespace
+{
+	// Deterministic pseudo random numbers in [-1, 1]
+	double random_unit(glm::uint32 & State)
+	{
+		State = State * 1664525u + 1013904223u;
+		return static_cast<double>(State) / 2147483647.5 - 1.0;
+	}
+
+	glm::dvec3 random_direction(glm::uint32 & State)
+	{
+		for(;;)
+		{
+			glm::dvec3 const v(random_unit(State), random_unit(State), random_unit(State));
+			double const l = glm::length(v);
+			if(l > 0.1 && l <= 1.0)
+				return v / l;
+		}
+	}
+
+	double const PlanetRadius = 6.4e6;
+
+	// Objects scattered within Spread meters around a point on the surface of a planet, with the camera near that point
+	void make_scene(glm::large_world & World, glm::dvec3 & Eye, glm::mat4 & View, std::size_t Count, double Spread)
+	{
+		glm::uint32 State = 42u;
+		glm::dvec3 const Surface = random_direction(State) * PlanetRadius;
+		Eye = Surface + glm::dvec3(random_unit(State), random_unit(State), random_unit(State)) * 10.0;
+		View = glm::mat4(glm::mat3(glm::lookAt(glm::vec3(0), glm::vec3(random_direction(State)), glm::vec3(0, 0, 1))));
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::dvec3 const Origin = Surface + glm::dvec3(random_unit(State), random_unit(State), random_unit(State)) * Spread;
+			glm::quat const Rotation = glm::angleAxis(static_cast<float>(random_unit(State)) * glm::pi<float>(), glm::vec3(random_direction(State)));
+			glm::mat4 Local(glm::mat3_cast(Rotation) * (1.5f + static_cast<float>(random_unit(State))));
+			Local[3] = glm::vec4(glm::vec3(random_direction(State)) * 5.0f, 1.0f);
+			glm::addObject(World, Origin, Local);
+		}
+	}
+
+	// View * translate(Origin - Eye) * Local evaluated in double, element by element
+	void reference(glm::mat4 const & View, glm::dvec3 const & Origin, glm::dvec3 const & Eye, glm::mat4 const & Local, double Result[4][4])
+	{
+		double const Translation[3] = {Origin.x - Eye.x, Origin.y - Eye.y, Origin.z - Eye.z};
+		for(glm::length_t c = 0; c < 4; ++c)
+		{
+			double Column[4];
+			for(glm::length_t r = 0; r < 3; ++r)
+				Column[r] = static_cast<double>(Local[c][r]) + Translation[r] * static_cast<double>(Local[c].w);
+			Column[3] = static_cast<double>(Local[c].w);
+
+			for(glm::length_t r = 0; r < 4; ++r)
+			{
+				Result[c][r] = 0.0;
+				for(glm::length_t k = 0; k < 4; ++k)
+					Result[c][r] += static_cast<double>(View[k][r]) * Column[k];
+			}
+		}
+	}
+
+	double seconds()
+	{
+		return static_cast<double>(std::clock()) / static_cast<double>(CLOCKS_PER_SEC);
+	}
+
+	double rate(std::size_t Count, double Time)
+	{
+		return static_cast<double>(Count) * 1e-3 / (Time > 0.0 ? Time : 1e-9);
+	}
+}//namespace
+
+int test_split()
+{
+	int Error = 0;
+
+	double const Values[] = {0.0, 1.0, -0.1, 1e7 + 0.123, -6371000.0123456789, 1.5e11 + 1.0 / 3.0, 1e15};
+	for(std::size_t i = 0; i < sizeof(Values) / sizeof(Values[0]); ++i)
+	{
+		float High = 0.0f;
+		float Low = 0.0f;
+		glm::splitDouble(Values[i], High, Low);
+		Error += High == static_cast<float>(Values[i]) ? 0 : 1;
+		Error += std::abs(static_cast<double>(High) + static_cast<double>(Low) - Values[i]) <= std::abs(Values[i]) * std::ldexp(1.0, -47) ? 0 : 1;
+	}
+
+	glm::large_world World;
+	glm::dvec3 const Origin(6371000.123456, -1e7 - 0.987654, 0.5);
+	Error += glm::addObject(World, glm::dvec3(0), glm::mat4(1)) == 0 ? 0 : 1;
+	Error += glm::addObject(World, Origin, glm::mat4(2)) == 1 ? 0 : 1;
+	Error += World.Locals.size() == 2 && World.Locals[1] == glm::mat4(2) ? 0 : 1;
+	Error += glm::all(glm::lessThanEqual(glm::abs(glm::getOrigin(World, 1) - Origin), glm::dvec3(1e-8))) ? 0 : 1;
+
+	glm::setOrigin(World, 0, -Origin);
+	Error += glm::all(glm::lessThanEqual(glm::abs(glm::getOrigin(World, 0) + Origin), glm::dvec3(1e-8))) ? 0 : 1;
+
+	return Error;
+}
+
+int test_relative_origins()
+{
+	int Error = 0;
+
+	glm::large_world World;
+	glm::dvec3 Eye;
+	glm::mat4 View;
+	make_scene(World, Eye, View, 1003, 1000.0);
+
+	std::vector<glm::vec3> Results(World.Locals.size());
+	glm::relativeOrigins(World, Eye, &Results[0]);
+
+	double MaxNaive = 0.0;
+	for(std::size_t i = 0; i < Results.size(); ++i)
+	{
+		glm::dvec3 const Origin = glm::getOrigin(World, i);
+		glm::dvec3 const Exact = Origin - Eye;
+		double const Bound = glm::length(Exact) * std::ldexp(1.0, -22) + (glm::length(Origin) + glm::length(Eye)) * std::ldexp(1.0, -46);
+		Error += glm::length(glm::dvec3(Results[i]) - Exact) <= Bound ? 0 : 1;
+
+		glm::vec3 const Naive = glm::vec3(Origin) - glm::vec3(Eye);
+		MaxNaive = glm::max(MaxNaive, glm::length(glm::dvec3(Naive) - Exact));
+	}
+
+	// Float positions are off by up to a meter at this distance from the center of the planet
+	Error += MaxNaive > 0.1 ? 0 : 1;
+
+	// The camera itself, far from any object
+	glm::large_world Far;
+	glm::addObject(Far, Eye, glm::mat4(1));
+	glm::addObject(Far, -Eye, glm::mat4(1));
+	glm::vec3 FarResults[2];
+	glm::relativeOrigins(Far, Eye, FarResults);
+	Error += glm::all(glm::lessThanEqual(glm::abs(FarResults[0]), glm::vec3(1e-8f))) ? 0 : 1;
+	Error += glm::all(glm::lessThanEqual(glm::abs(glm::dvec3(FarResults[1]) + 2.0 * Eye), glm::abs(2.0 * Eye) * 1e-7)) ? 0 : 1;
+
+	return Error;
+}
+
+int test_camera_relative()
+{
+	int Error = 0;
+
+	// More objects than a job, and a count that is not a multiple of four
+	glm::large_world World;
+	glm::dvec3 Eye;
+	glm::mat4 View;
+	make_scene(World, Eye, View, 20001, 2000.0);
+
+	std::vector<glm::mat4> Results(World.Locals.size());
+	glm::cameraRelative(World, Eye, View, &Results[0]);
+
+	double MaxError = 0.0;
+	double MaxNaive = 0.0;
+	for(std::size_t i = 0; i < Results.size(); ++i)
+	{
+		glm::dvec3 const Origin = glm::getOrigin(World, i);
+		double Exact[4][4];
+		reference(View, Origin, Eye, World.Locals[i], Exact);
+		glm::mat4 Translation(1.0f);
+		Translation[3] = glm::vec4(glm::vec3(Origin) - glm::vec3(Eye), 1.0f);
+		glm::mat4 const Naive = View * Translation * World.Locals[i];
+
+		// Rounding errors of float products scale with the distance to the camera
+		double const Scale = 8.0 + glm::length(Origin - Eye);
+		for(glm::length_t c = 0; c < 4; ++c)
+		for(glm::length_t r = 0; r < 4; ++r)
+		{
+			double const Difference = std::abs(static_cast<double>(Results[i][c][r]) - Exact[c][r]);
+			Error += Difference <= Scale * std::ldexp(1.0, -21) ? 0 : 1;
+			MaxError = glm::max(MaxError, Difference);
+			MaxNaive = glm::max(MaxNaive, std::abs(static_cast<double>(Naive[c][r]) - Exact[c][r]));
+		}
+	}
+
+	std::printf("cameraRelative max error %g m, float world positions %g m\n", MaxError, MaxNaive);
+	Error += MaxError < 1e-3 ? 0 : 1;
+	Error += MaxNaive > 0.1 ? 0 : 1;
+
+	// Empty world
+	glm::large_world Empty;
+	glm::cameraRelative(Empty, Eye, View, NULL);
+	glm::relativeOrigins(Empty, Eye, NULL);
+
+	return Error;
+}
+
+int perf_camera_relative()
+{
+	int Error = 0;
+
+	std::size_t const Count = 1 << 17;
+	glm::large_world World;
+	glm::dvec3 Eye;
+	glm::mat4 View;
+	make_scene(World, Eye, View, Count, 5000.0);
+
+	std::vector<glm::dvec3> Origins(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Origins[i] = glm::getOrigin(World, i);
+
+	std::vector<glm::mat4> Results(Count);
+	float Sum = 0.0f;
+
+	double const StartDouble = seconds();
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::dmat4 Translation(1.0);
+		Translation[3] = glm::dvec4(Origins[i] - Eye, 1.0);
+		Results[i] = glm::mat4(glm::dmat4(View) * Translation * glm::dmat4(World.Locals[i]));
+	}
+	double const TimeDouble = seconds() - StartDouble;
+	Sum += Results[Count - 1][3][0];
+
+	std::vector<glm::vec3> FloatOrigins(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		FloatOrigins[i] = glm::vec3(Origins[i]);
+	glm::vec3 const FloatEye(Eye);
+
+	double const StartFloat = seconds();
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::mat4 Translation(1.0f);
+		Translation[3] = glm::vec4(FloatOrigins[i] - FloatEye, 1.0f);
+		Results[i] = View * Translation * World.Locals[i];
+	}
+	double const TimeFloat = seconds() - StartFloat;
+	Sum += Results[Count - 1][3][0];
+
+	double const StartBatch = seconds();
+	glm::cameraRelative(World, Eye, View, &Results[0]);
+	double const TimeBatch = seconds() - StartBatch;
+	Sum += Results[Count - 1][3][0];
+
+	std::vector<glm::vec3> Relatives(Count);
+	double const StartOrigins = seconds();
+	glm::relativeOrigins(World, Eye, &Relatives[0]);
+	double const TimeOrigins = seconds() - StartOrigins;
+	Sum += Relatives[Count - 1].x;
+
+	std::printf("dmat4 transforms: %.0f objects/ms\n", rate(Count, TimeDouble));
+	std::printf("mat4 transforms of float world positions: %.0f objects/ms\n", rate(Count, TimeFloat));
+	std::printf("cameraRelative: %.0f objects/ms\n", rate(Count, TimeBatch));
+	std::printf("relativeOrigins: %.0f objects/ms\n", rate(Count, TimeOrigins));
+
+	Error += glm::isnan(Sum) ? 1 : 0;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_split();
+	Error += test_relative_origins();
+	Error += test_camera_relative();
+	Error += perf_camera_relative();
+
+	return Error;
+}
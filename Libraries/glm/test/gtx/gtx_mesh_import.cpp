@@ -0,0 +1,287 @@
+#include <glm/gtx/mesh_import.hpp>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <ctime>
+#include <cstdio>
+
+namespace
+{
+	bool parse_obj(std::string const & Text, glm::mesh_soa & Mesh)
+	{
+		return glm::parseOBJ(Text.data(), Text.data() + Text.size(), Mesh);
+	}
+
+	bool parse_ply(std::string const & Text, glm::mesh_soa & Mesh)
+	{
+		return glm::parsePLY(Text.data(), Text.data() + Text.size(), Mesh);
+	}
+
+	// Appends the bytes of Value, reversed when BigEndian is true on a little endian host or the opposite
+	template <typename T>
+	void append(std::string & Text, T Value, bool BigEndian)
+	{
+		char Bytes[sizeof(T)];
+		std::memcpy(Bytes, &Value, sizeof(T));
+		glm::uint16 const One = 1;
+		bool const HostBigEndian = *reinterpret_cast<unsigned char const *>(&One) == 0;
+		for(std::size_t i = 0; i < sizeof(T); ++i)
+			Text += Bytes[BigEndian != HostBigEndian ? sizeof(T) - 1 - i : i];
+	}
+
+	// Square of two triangles with the vertex properties x, y, z, u, v and an extra ignored property
+	std::string binary_square(bool BigEndian)
+	{
+		std::string Text = std::string("ply\nformat ") + (BigEndian ? "binary_big_endian" : "binary_little_endian") + " 1.0\n"
+			"comment generated\n"
+			"element vertex 4\n"
+			"property float x\nproperty float y\nproperty float z\nproperty uchar quality\nproperty double u\nproperty double v\n"
+			"element face 1\n"
+			"property list uchar int vertex_indices\n"
+			"element edge 1\n"
+			"property list uchar ushort vertices\n"
+			"end_header\n";
+		float const Corners[4][2] = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+		for(int i = 0; i < 4; ++i)
+		{
+			append(Text, Corners[i][0], BigEndian);
+			append(Text, Corners[i][1], BigEndian);
+			append(Text, 2.0f, BigEndian);
+			append(Text, static_cast<glm::uint8>(255), BigEndian);
+			append(Text, static_cast<double>(Corners[i][0]), BigEndian);
+			append(Text, static_cast<double>(Corners[i][1]), BigEndian);
+		}
+		append(Text, static_cast<glm::uint8>(4), BigEndian);
+		for(glm::int32 i = 0; i < 4; ++i)
+			append(Text, i, BigEndian);
+		append(Text, static_cast<glm::uint8>(2), BigEndian);
+		append(Text, static_cast<glm::uint16>(0), BigEndian);
+		append(Text, static_cast<glm::uint16>(2), BigEndian);
+		return Text;
+	}
+
+	// Grid of Size x Size quads, with one position, texture coordinate and normal per grid point
+	std::string grid_obj(int Size)
+	{
+		std::string Text("# grid\n");
+		char Line[256];
+		for(int y = 0; y <= Size; ++y)
+		for(int x = 0; x <= Size; ++x)
+		{
+			std::sprintf(Line, "v %.6f %.6f 0\nvt %.6f %.6f\nvn 0 0 1\n",
+				static_cast<double>(x) / Size, static_cast<double>(y) / Size, static_cast<double>(x) / Size, static_cast<double>(y) / Size);
+			Text += Line;
+		}
+		for(int y = 0; y < Size; ++y)
+		for(int x = 0; x < Size; ++x)
+		{
+			int const i = y * (Size + 1) + x + 1;
+			int const j = i + Size + 1;
+			std::sprintf(Line, "f %d/%d/%d %d/%d/%d %d/%d/%d %d/%d/%d\n", i, i, i, i + 1, i + 1, i + 1, j + 1, j + 1, j + 1, j, j, j);
+			Text += Line;
+		}
+		return Text;
+	}
+}//namespace
+
+int test_obj()
+{
+	int Error = 0;
+
+	// Quad triangulated as a fan, comments, CRLF line ends and unknown lines
+	{
+		glm::mesh_soa Mesh;
+		Error += parse_obj("# square\r\nv 0 0 0\r\nv 1 0 0\r\nv 1 1 0\r\nv 0 1 0\r\ng square\r\nusemtl none\r\nf 1 2 3 4\r\n", Mesh) ? 0 : 1;
+		Error += Mesh.Positions.size() == 4 ? 0 : 1;
+		Error += Mesh.Normals.empty() && Mesh.TexCoords.empty() ? 0 : 1;
+		glm::uint const Indices[] = {0, 1, 2, 0, 2, 3};
+		Error += Mesh.Indices == std::vector<glm::uint>(Indices, Indices + 6) ? 0 : 1;
+		Error += Mesh.Positions[2] == glm::vec3(1, 1, 0) ? 0 : 1;
+	}
+
+	// Negative indices and corners p//n, the shared corners being welded
+	{
+		glm::mesh_soa Mesh;
+		Error += parse_obj("v 0 0 0\nv 1 0 0\nv 1 1 0\nvn 0 0 1\nf -3//-1 -2//-1 -1//-1\nv 0 1 0\nf 1//1 3//1 4//1\n", Mesh) ? 0 : 1;
+		Error += Mesh.Positions.size() == 4 ? 0 : 1;
+		Error += Mesh.Normals.size() == 4 && Mesh.Normals[3] == glm::vec3(0, 0, 1) ? 0 : 1;
+		glm::uint const Indices[] = {0, 1, 2, 0, 2, 3};
+		Error += Mesh.Indices == std::vector<glm::uint>(Indices, Indices + 6) ? 0 : 1;
+	}
+
+	// A position used with two texture coordinates becomes two vertices, a corner without texture coordinate gets zeros
+	{
+		glm::mesh_soa Mesh;
+		Error += parse_obj("v 0 0 0\nv 1 0 0\nv 0 1 0\nvt 0.5 0.5\nvt 1 1\nf 1/1 2/1 3/1\nf 1/2 3/2 2\n", Mesh) ? 0 : 1;
+		Error += Mesh.Positions.size() == 6 ? 0 : 1;
+		Error += Mesh.TexCoords.size() == 6 && Mesh.TexCoords[3] == glm::vec2(1) && Mesh.TexCoords[5] == glm::vec2(0) ? 0 : 1;
+	}
+
+	// Point cloud
+	{
+		glm::mesh_soa Mesh;
+		Error += parse_obj("v 1 2 3\nv 4 5 6", Mesh) ? 0 : 1;
+		Error += Mesh.Positions.size() == 2 && Mesh.Positions[1] == glm::vec3(4, 5, 6) && Mesh.Indices.empty() ? 0 : 1;
+	}
+
+	// Missing elements
+	{
+		glm::mesh_soa Mesh;
+		Error += !parse_obj("v 0 0 0\nv 1 0 0\nf 1 2 3\n", Mesh) ? 0 : 1;
+		Error += !parse_obj("v 0 0 0\nv 1 0 0\nv 1 1 0\nf -4 1 2\n", Mesh) ? 0 : 1;
+		Error += !parse_obj("v 0 0 0\nv 1 0 0\nv 1 1 0\nf 1/1 2/1 3/1\n", Mesh) ? 0 : 1;
+		Error += !parse_obj("v 0 0 0\nv 1 0 0\nv 1 1 0\nf 1 2 x\n", Mesh) ? 0 : 1;
+		Error += !parse_obj("v 0 0 0\nv 1 0 0\nv 1 1 0\nf 0 1 2\n", Mesh) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// Large enough to be split in chunks parsed by several threads
+int test_obj_chunks()
+{
+	int Error = 0;
+
+	int const Size = 200;
+	std::string Text = grid_obj(Size);
+
+	// Relative indices across chunks
+	Text += "f -1/-1/-1 -2/-2/-2 -3/-3/-3\n";
+
+	glm::mesh_soa Mesh;
+	Error += parse_obj(Text, Mesh) ? 0 : 1;
+	Error += Mesh.Positions.size() == static_cast<std::size_t>((Size + 1) * (Size + 1)) ? 0 : 1;
+	Error += Mesh.Normals.size() == Mesh.Positions.size() && Mesh.TexCoords.size() == Mesh.Positions.size() ? 0 : 1;
+	Error += Mesh.Indices.size() == static_cast<std::size_t>(Size * Size * 6 + 3) ? 0 : 1;
+
+	// Vertices are in order of first use, each one at its texture coordinate
+	Error += Mesh.Indices[0] == 0 && Mesh.Indices[1] == 1 && Mesh.Indices[2] == 2 ? 0 : 1;
+	for(std::size_t i = 0; i < Mesh.Positions.size(); ++i)
+		Error += glm::vec2(Mesh.Positions[i]) == Mesh.TexCoords[i] ? 0 : 1;
+
+	Error += Mesh.Positions[Mesh.Indices[Mesh.Indices.size() - 3]] == glm::vec3(1, 1, 0) ? 0 : 1;
+
+	return Error;
+}
+
+int test_ply()
+{
+	int Error = 0;
+
+	// Ascii with normals, a quad, a triangle and an ignored element
+	{
+		glm::mesh_soa Mesh;
+		std::string const Text =
+			"ply\r\nformat ascii 1.0\r\n"
+			"element vertex 4\r\nproperty float x\r\nproperty float y\r\nproperty float z\r\nproperty float nx\r\nproperty float ny\r\nproperty float nz\r\n"
+			"element face 2\r\nproperty list uchar uint vertex_indices\r\nproperty uchar red\r\n"
+			"element material 1\r\nproperty float shininess\r\n"
+			"end_header\r\n"
+			"0 0 0 0 0 1\r\n1 0 0 0 0 1\r\n1 1 0 0 0 1\r\n0 1 0 0 0 1\r\n"
+			"4 0 1 2 3 255\r\n3 3 2 0 0\r\n"
+			"0.5\r\n";
+		Error += parse_ply(Text, Mesh) ? 0 : 1;
+		Error += Mesh.Positions.size() == 4 && Mesh.Positions[2] == glm::vec3(1, 1, 0) ? 0 : 1;
+		Error += Mesh.Normals.size() == 4 && Mesh.Normals[3] == glm::vec3(0, 0, 1) ? 0 : 1;
+		Error += Mesh.TexCoords.empty() ? 0 : 1;
+		glm::uint const Indices[] = {0, 1, 2, 0, 2, 3, 3, 2, 0};
+		Error += Mesh.Indices == std::vector<glm::uint>(Indices, Indices + 9) ? 0 : 1;
+	}
+
+	// Binary in both byte orders
+	for(int BigEndian = 0; BigEndian < 2; ++BigEndian)
+	{
+		glm::mesh_soa Mesh;
+		Error += parse_ply(binary_square(BigEndian != 0), Mesh) ? 0 : 1;
+		Error += Mesh.Positions.size() == 4 && Mesh.Positions[1] == glm::vec3(1, 0, 2) && Mesh.Positions[2] == glm::vec3(1, 1, 2) ? 0 : 1;
+		Error += Mesh.TexCoords.size() == 4 && Mesh.TexCoords[3] == glm::vec2(0, 1) ? 0 : 1;
+		Error += Mesh.Normals.empty() ? 0 : 1;
+		glm::uint const Indices[] = {0, 1, 2, 0, 2, 3};
+		Error += Mesh.Indices == std::vector<glm::uint>(Indices, Indices + 6) ? 0 : 1;
+	}
+
+	// Invalid files
+	{
+		glm::mesh_soa Mesh;
+		std::string const Square = binary_square(false);
+		Error += !parse_ply(Square.substr(0, Square.size() - 1), Mesh) ? 0 : 1;
+		Error += !parse_ply("ply\nformat ascii 1.0\nelement vertex 1\nproperty float x\n", Mesh) ? 0 : 1;
+		Error += !parse_ply("obj\nformat ascii 1.0\nend_header\n", Mesh) ? 0 : 1;
+		Error += !parse_ply("ply\nformat ascii 1.0\nelement vertex 1\nproperty float x\nend_header\n", Mesh) ? 0 : 1;
+		Error += !parse_ply("ply\nformat ascii 1.0\nelement vertex 1\nproperty float x\nelement face 1\nproperty list uchar int vertex_indices\nend_header\n0\n3 0 1 0\n", Mesh) ? 0 : 1;
+		Error += parse_ply("ply\nformat ascii 1.0\nelement vertex 1\nproperty float x\nend_header\n7\n", Mesh) && Mesh.Positions[0] == glm::vec3(7, 0, 0) ? 0 : 1;
+
+		// Counts larger than the data are rejected before allocating
+		Error += !parse_ply("ply\nformat ascii 1.0\nelement vertex 3000000000\nproperty float x\nend_header\n7\n", Mesh) ? 0 : 1;
+		Error += !parse_ply("ply\nformat binary_little_endian 1.0\nelement vertex 3000000000\nproperty float x\nend_header\n0123", Mesh) ? 0 : 1;
+		Error += !parse_ply("ply\nformat binary_little_endian 1.0\nelement vertex 1\nproperty float x\nelement face 3000000000\nproperty list uchar int vertex_indices\nend_header\n0123", Mesh) ? 0 : 1;
+		Error += parse_ply("ply\nformat ascii 1.0\nelement vertex 2\nproperty float x\nend_header\n7\n8", Mesh) && Mesh.Positions.size() == 2 ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int test_import()
+{
+	int Error = 0;
+
+	char const * const ObjPath = "gtx_mesh_import_test.obj";
+	char const * const PlyPath = "gtx_mesh_import_test.ply";
+
+	std::string const Obj = grid_obj(8);
+	std::string const Ply = binary_square(false);
+	std::FILE * File = std::fopen(ObjPath, "wb");
+	std::fwrite(Obj.data(), 1, Obj.size(), File);
+	std::fclose(File);
+	File = std::fopen(PlyPath, "wb");
+	std::fwrite(Ply.data(), 1, Ply.size(), File);
+	std::fclose(File);
+
+	glm::mesh_soa Mesh;
+	Error += glm::importOBJ(ObjPath, Mesh) ? 0 : 1;
+	Error += Mesh.Positions.size() == 81 && Mesh.Indices.size() == 8 * 8 * 6 ? 0 : 1;
+	Error += glm::importPLY(PlyPath, Mesh) ? 0 : 1;
+	Error += Mesh.Positions.size() == 4 && Mesh.Indices.size() == 6 ? 0 : 1;
+	Error += !glm::importOBJ("gtx_mesh_import_missing.obj", Mesh) ? 0 : 1;
+
+	std::remove(ObjPath);
+	std::remove(PlyPath);
+
+	return Error;
+}
+
+// Throughput on an OBJ grid of a few tens of megabytes, and the time to import a gigabyte at this rate
+int perf_obj()
+{
+	int Error = 0;
+
+	int const Size = 400;
+	std::string const Text = grid_obj(Size);
+
+	glm::mesh_soa Mesh;
+	std::clock_t const TimeStart = std::clock();
+	Error += parse_obj(Text, Mesh) ? 0 : 1;
+	std::clock_t const TimeEnd = std::clock();
+
+	// std::clock measures the processor time of all threads
+	double const Seconds = static_cast<double>(TimeEnd - TimeStart + 1) / static_cast<double>(CLOCKS_PER_SEC);
+	double const Megabytes = static_cast<double>(Text.size()) / 1e6;
+	std::printf("parseOBJ: %.1f MB, %.1f MB/s of processor time, %.1f s of processor time per GB\n", Megabytes, Megabytes / Seconds, Seconds * 1e3 / Megabytes);
+
+	Error += Mesh.Positions.size() == static_cast<std::size_t>((Size + 1) * (Size + 1)) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_obj();
+	Error += test_obj_chunks();
+	Error += test_ply();
+	Error += test_import();
+	Error += perf_obj();
+
+	return Error;
+}
@@ -0,0 +1,216 @@
+#include <glm/gtx/mesh_normal.hpp>
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <vector>
+#include <ctime>
+#include <cstdio>
+
+namespace
+{
+	// Grid of (Size + 1)^2 vertices on the z = 0 plane, with UVs equal to xy, optionally mirrored
+	void grid(int Size, bool MirrorU, std::vector<glm::vec3> & Positions, std::vector<glm::vec2> & TexCoords, std::vector<glm::uint> & Indices)
+	{
+		for(int y = 0; y <= Size; ++y)
+		for(int x = 0; x <= Size; ++x)
+		{
+			glm::vec2 const Position(static_cast<float>(x) / static_cast<float>(Size), static_cast<float>(y) / static_cast<float>(Size));
+			Positions.push_back(glm::vec3(Position, 0.0f));
+			TexCoords.push_back(glm::vec2(MirrorU ? -Position.x : Position.x, Position.y));
+		}
+
+		for(int y = 0; y < Size; ++y)
+		for(int x = 0; x < Size; ++x)
+		{
+			glm::uint const i = static_cast<glm::uint>(y * (Size + 1) + x);
+			glm::uint const Stride = static_cast<glm::uint>(Size + 1);
+			glm::uint const Quad[6] = {i, i + 1, i + Stride + 1, i, i + Stride + 1, i + Stride};
+			Indices.insert(Indices.end(), Quad, Quad + 6);
+		}
+	}
+
+	// UV sphere whose first and last columns are distinct vertices along the UV seam
+	void sphere(int Slices, int Stacks, std::vector<glm::vec3> & Positions, std::vector<glm::uint> & Indices)
+	{
+		for(int j = 0; j <= Stacks; ++j)
+		for(int i = 0; i <= Slices; ++i)
+		{
+			float const Theta = glm::pi<float>() * static_cast<float>(j) / static_cast<float>(Stacks);
+			float const Phi = glm::two_pi<float>() * static_cast<float>(i % Slices) / static_cast<float>(Slices);
+			float const Radius = j == 0 || j == Stacks ? 0.0f : glm::sin(Theta);
+			Positions.push_back(glm::vec3(Radius * glm::cos(Phi), Radius * glm::sin(Phi), j == Stacks ? -1.0f : glm::cos(Theta)));
+		}
+
+		for(int j = 0; j < Stacks; ++j)
+		for(int i = 0; i < Slices; ++i)
+		{
+			glm::uint const a = static_cast<glm::uint>(j * (Slices + 1) + i);
+			glm::uint const b = a + static_cast<glm::uint>(Slices + 1);
+			glm::uint const Quad[6] = {a, b, a + 1, a + 1, b, b + 1};
+			Indices.insert(Indices.end(), Quad, Quad + 6);
+		}
+	}
+}//namespace
+
+namespace plane
+{
+	int test()
+	{
+		int Error = 0;
+
+		std::vector<glm::vec3> Positions;
+		std::vector<glm::vec2> TexCoords;
+		std::vector<glm::uint> Indices;
+		grid(8, false, Positions, TexCoords, Indices);
+
+		std::vector<glm::vec3> Normals(Positions.size());
+		glm::vertexNormals(&Positions[0], Positions.size(), &Indices[0], Indices.size() / 3, static_cast<glm::uint const *>(0), glm::angle_weight, &Normals[0]);
+		for(std::size_t i = 0; i < Normals.size(); ++i)
+			Error += glm::all(glm::epsilonEqual(Normals[i], glm::vec3(0, 0, 1), 0.0001f)) ? 0 : 1;
+
+		std::vector<glm::vec4> Tangents(Positions.size());
+		glm::vertexTangents(&Positions[0], &Normals[0], &TexCoords[0], Positions.size(), &Indices[0], Indices.size() / 3, &Tangents[0]);
+		for(std::size_t i = 0; i < Tangents.size(); ++i)
+			Error += glm::all(glm::epsilonEqual(Tangents[i], glm::vec4(1, 0, 0, 1), 0.0001f)) ? 0 : 1;
+
+		return Error;
+	}
+}//namespace plane
+
+namespace mirror
+{
+	int test()
+	{
+		int Error = 0;
+
+		std::vector<glm::vec3> Positions;
+		std::vector<glm::vec2> TexCoords;
+		std::vector<glm::uint> Indices;
+		grid(4, true, Positions, TexCoords, Indices);
+
+		std::vector<glm::vec3> Normals(Positions.size(), glm::vec3(0, 0, 1));
+		std::vector<glm::vec4> Tangents(Positions.size());
+		glm::vertexTangents(&Positions[0], &Normals[0], &TexCoords[0], Positions.size(), &Indices[0], Indices.size() / 3, &Tangents[0]);
+
+		for(std::size_t i = 0; i < Tangents.size(); ++i)
+		{
+			Error += glm::all(glm::epsilonEqual(Tangents[i], glm::vec4(-1, 0, 0, -1), 0.0001f)) ? 0 : 1;
+
+			// The reconstructed bitangent must follow the V direction
+			glm::vec3 const Bitangent = Tangents[i].w * glm::cross(Normals[i], glm::vec3(Tangents[i]));
+			Error += glm::all(glm::epsilonEqual(Bitangent, glm::vec3(0, 1, 0), 0.0001f)) ? 0 : 1;
+		}
+
+		return Error;
+	}
+}//namespace mirror
+
+namespace seam
+{
+	int test()
+	{
+		int Error = 0;
+
+		std::vector<glm::vec3> Positions;
+		std::vector<glm::uint> Indices;
+		sphere(32, 16, Positions, Indices);
+
+		std::vector<glm::uint> Remap(Positions.size());
+		glm::weldPositions(&Positions[0], Positions.size(), &Remap[0]);
+
+		std::vector<glm::vec3> Normals(Positions.size());
+		glm::vertexNormals(&Positions[0], Positions.size(), &Indices[0], Indices.size() / 3, &Remap[0], glm::angle_weight, &Normals[0]);
+
+		// Welded normals of a sphere point away from the center, including along the seam and at the poles
+		for(std::size_t i = 0; i < Normals.size(); ++i)
+		{
+			Error += glm::all(glm::epsilonEqual(Normals[i], Positions[i], 0.02f)) ? 0 : 1;
+			Error += Normals[i] == Normals[Remap[i]] ? 0 : 1;
+		}
+
+		// Without welding, the seam vertices only see half of their neighborhood
+		std::vector<glm::vec3> Split(Positions.size());
+		glm::vertexNormals(&Positions[0], Positions.size(), &Indices[0], Indices.size() / 3, static_cast<glm::uint const *>(0), glm::area_weight, &Split[0]);
+		Error += glm::all(glm::epsilonEqual(Split[33 * 8], Positions[33 * 8], 0.02f)) ? 1 : 0;
+
+		return Error;
+	}
+}//namespace seam
+
+namespace reference
+{
+	// Serial scatter implementation the partitioned gather must match
+	int test()
+	{
+		int Error = 0;
+
+		std::vector<glm::vec3> Positions;
+		std::vector<glm::uint> Indices;
+		sphere(100, 60, Positions, Indices);
+		for(std::size_t i = 0; i < Positions.size(); ++i)
+			Positions[i] *= 1.0f + 0.2f * glm::sin(static_cast<float>(i) * 0.37f);
+
+		std::vector<glm::vec3> Expected(Positions.size(), glm::vec3(0));
+		for(std::size_t t = 0; t < Indices.size(); t += 3)
+		{
+			glm::vec3 const n = glm::cross(Positions[Indices[t + 1]] - Positions[Indices[t]], Positions[Indices[t + 2]] - Positions[Indices[t]]);
+			for(std::size_t k = 0; k < 3; ++k)
+				Expected[Indices[t + k]] += n;
+		}
+
+		std::vector<glm::vec3> Normals(Positions.size());
+		glm::vertexNormals(&Positions[0], Positions.size(), &Indices[0], Indices.size() / 3, static_cast<glm::uint const *>(0), glm::area_weight, &Normals[0]);
+
+		for(std::size_t i = 0; i < Normals.size(); ++i)
+		{
+			if(Expected[i] == glm::vec3(0))
+				continue;
+			Error += glm::all(glm::epsilonEqual(Normals[i], glm::normalize(Expected[i]), 0.0001f)) ? 0 : 1;
+		}
+
+		return Error;
+	}
+}//namespace reference
+
+namespace perf
+{
+	int test()
+	{
+		std::vector<glm::vec3> Positions;
+		std::vector<glm::vec2> TexCoords;
+		std::vector<glm::uint> Indices;
+		grid(1024, false, Positions, TexCoords, Indices);
+		std::size_t const TriangleCount = Indices.size() / 3;
+
+		std::vector<glm::vec3> Normals(Positions.size());
+		std::vector<glm::vec4> Tangents(Positions.size());
+
+		std::clock_t const Timestamp0 = std::clock();
+		glm::vertexNormals(&Positions[0], Positions.size(), &Indices[0], TriangleCount, static_cast<glm::uint const *>(0), glm::area_weight, &Normals[0]);
+		std::clock_t const Timestamp1 = std::clock();
+		glm::vertexNormals(&Positions[0], Positions.size(), &Indices[0], TriangleCount, static_cast<glm::uint const *>(0), glm::angle_weight, &Normals[0]);
+		std::clock_t const Timestamp2 = std::clock();
+		glm::vertexTangents(&Positions[0], &Normals[0], &TexCoords[0], Positions.size(), &Indices[0], TriangleCount, &Tangents[0]);
+		std::clock_t const Timestamp3 = std::clock();
+
+		// std::clock measures the processor time of all threads
+		double const Mega = static_cast<double>(TriangleCount) * static_cast<double>(CLOCKS_PER_SEC) / 1000000.0;
+		std::printf("vertexNormals area: %.1f M triangles/s of CPU time\n", Mega / static_cast<double>(Timestamp1 - Timestamp0 + 1));
+		std::printf("vertexNormals angle: %.1f M triangles/s of CPU time\n", Mega / static_cast<double>(Timestamp2 - Timestamp1 + 1));
+		std::printf("vertexTangents: %.1f M triangles/s of CPU time\n", Mega / static_cast<double>(Timestamp3 - Timestamp2 + 1));
+
+		return 0;
+	}
+}//namespace perf
+
+int main()
+{
+	int Error = 0;
+
+	Error += plane::test();
+	Error += mirror::test();
+	Error += seam::test();
+	Error += reference::test();
+	Error += perf::test();
+
+	return Error;
+}
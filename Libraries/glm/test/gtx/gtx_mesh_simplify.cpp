@@ -0,0 +1,238 @@
+#include <glm/gtx/mesh_simplify.hpp>
+#include <glm/gtc/constants.hpp>
+#include <algorithm>
+#include <vector>
+#include <ctime>
+#include <cstdio>
+
+namespace
+{
+	// Grid of (Size + 1)^2 vertices covering the unit square of the z = 0 plane
+	void grid(int Size, std::vector<glm::vec3> & Positions, std::vector<glm::uint> & Indices)
+	{
+		for(int y = 0; y <= Size; ++y)
+		for(int x = 0; x <= Size; ++x)
+			Positions.push_back(glm::vec3(static_cast<float>(x) / static_cast<float>(Size), static_cast<float>(y) / static_cast<float>(Size), 0.0f));
+
+		for(int y = 0; y < Size; ++y)
+		for(int x = 0; x < Size; ++x)
+		{
+			glm::uint const i = static_cast<glm::uint>(y * (Size + 1) + x);
+			glm::uint const Stride = static_cast<glm::uint>(Size + 1);
+			glm::uint const Quad[6] = {i, i + 1, i + Stride + 1, i, i + Stride + 1, i + Stride};
+			Indices.insert(Indices.end(), Quad, Quad + 6);
+		}
+	}
+
+	// Closed unit sphere: the seam columns and the poles share their vertices
+	void sphere(int Slices, int Stacks, std::vector<glm::vec3> & Positions, std::vector<glm::uint> & Indices)
+	{
+		Positions.push_back(glm::vec3(0, 0, 1));
+		for(int j = 1; j < Stacks; ++j)
+		for(int i = 0; i < Slices; ++i)
+		{
+			float const Theta = glm::pi<float>() * static_cast<float>(j) / static_cast<float>(Stacks);
+			float const Phi = glm::two_pi<float>() * static_cast<float>(i) / static_cast<float>(Slices);
+			Positions.push_back(glm::vec3(glm::sin(Theta) * glm::cos(Phi), glm::sin(Theta) * glm::sin(Phi), glm::cos(Theta)));
+		}
+		Positions.push_back(glm::vec3(0, 0, -1));
+
+		glm::uint const Last = static_cast<glm::uint>(Positions.size() - 1);
+		for(int i = 0; i < Slices; ++i)
+		{
+			glm::uint const i0 = static_cast<glm::uint>(1 + i);
+			glm::uint const i1 = static_cast<glm::uint>(1 + (i + 1) % Slices);
+			glm::uint const Top[3] = {0, i0, i1};
+			glm::uint const Bottom[3] = {Last, i1 + Last - 1 - static_cast<glm::uint>(Slices), i0 + Last - 1 - static_cast<glm::uint>(Slices)};
+			Indices.insert(Indices.end(), Top, Top + 3);
+			Indices.insert(Indices.end(), Bottom, Bottom + 3);
+		}
+
+		for(int j = 1; j < Stacks - 1; ++j)
+		for(int i = 0; i < Slices; ++i)
+		{
+			glm::uint const a = static_cast<glm::uint>(1 + (j - 1) * Slices + i);
+			glm::uint const b = static_cast<glm::uint>(1 + (j - 1) * Slices + (i + 1) % Slices);
+			glm::uint const c = a + static_cast<glm::uint>(Slices);
+			glm::uint const d = b + static_cast<glm::uint>(Slices);
+			glm::uint const Quad[6] = {a, c, b, b, c, d};
+			Indices.insert(Indices.end(), Quad, Quad + 6);
+		}
+	}
+
+	float area(std::vector<glm::vec3> const & Positions, std::vector<glm::uint> const & Indices, std::size_t TriangleCount)
+	{
+		float Area = 0.0f;
+		for(std::size_t t = 0; t < TriangleCount; ++t)
+			Area += glm::length(glm::cross(Positions[Indices[t * 3 + 1]] - Positions[Indices[t * 3]], Positions[Indices[t * 3 + 2]] - Positions[Indices[t * 3]])) * 0.5f;
+		return Area;
+	}
+
+	// Counts the vertices away from the unit sphere and the triangles facing inward
+	int checkSphere(std::vector<glm::vec3> const & Positions, std::vector<glm::uint> const & Indices, std::size_t TriangleCount, float Tolerance)
+	{
+		int Error = 0;
+		for(std::size_t t = 0; t < TriangleCount; ++t)
+		{
+			glm::vec3 const & p0 = Positions[Indices[t * 3 + 0]];
+			glm::vec3 const & p1 = Positions[Indices[t * 3 + 1]];
+			glm::vec3 const & p2 = Positions[Indices[t * 3 + 2]];
+			Error += glm::abs(glm::length(p0) - 1.0f) < Tolerance ? 0 : 1;
+			Error += glm::dot(glm::cross(p1 - p0, p2 - p0), p0 + p1 + p2) > 0.0f ? 0 : 1;
+		}
+		return Error;
+	}
+}//namespace
+
+namespace plane
+{
+	int test()
+	{
+		int Error = 0;
+
+		std::vector<glm::vec3> Positions;
+		std::vector<glm::uint> Indices;
+		grid(32, Positions, Indices);
+
+		std::size_t const Count = glm::simplify(&Positions[0], static_cast<glm::vec4 *>(0), 0.0f, Positions.size(), &Indices[0], Indices.size() / 3, 2, 0.001f);
+
+		// A flat square collapses to its two triangles, the boundary being preserved
+		Error += Count <= 4 ? 0 : 1;
+		Error += glm::abs(area(Positions, Indices, Count) - 1.0f) < 0.0001f ? 0 : 1;
+		for(std::size_t i = 0; i < Count * 3; ++i)
+		{
+			glm::vec3 const & p = Positions[Indices[i]];
+			Error += glm::min(glm::min(p.x, 1.0f - p.x), glm::min(p.y, 1.0f - p.y)) < 0.0001f ? 0 : 1;
+			Error += p.z == 0.0f ? 0 : 1;
+		}
+
+		return Error;
+	}
+}//namespace plane
+
+namespace curved
+{
+	int test()
+	{
+		int Error = 0;
+
+		std::vector<glm::vec3> Positions;
+		std::vector<glm::uint> Indices;
+		sphere(64, 32, Positions, Indices);
+		std::size_t const TriangleCount = Indices.size() / 3;
+
+		// Without error bound, the target triangle count is reached
+		std::vector<glm::vec3> Simplified(Positions);
+		std::vector<glm::uint> Triangles(Indices);
+		std::size_t const Count = glm::simplify(&Simplified[0], static_cast<glm::vec4 *>(0), 0.0f, Simplified.size(), &Triangles[0], TriangleCount, TriangleCount / 10, 1.0f);
+		Error += Count <= TriangleCount / 10 && Count > 0 ? 0 : 1;
+		Error += checkSphere(Simplified, Triangles, Count, 0.05f);
+
+		// A tight error bound stops the simplification early
+		std::size_t const Bounded = glm::simplify(&Positions[0], static_cast<glm::vec4 *>(0), 0.0f, Positions.size(), &Indices[0], TriangleCount, 0, 0.001f);
+		Error += Bounded > Count && Bounded < TriangleCount ? 0 : 1;
+		Error += checkSphere(Positions, Indices, Bounded, 0.002f);
+
+		return Error;
+	}
+}//namespace curved
+
+namespace attribute
+{
+	int test()
+	{
+		int Error = 0;
+
+		std::vector<glm::vec3> Positions;
+		std::vector<glm::uint> Indices;
+		grid(32, Positions, Indices);
+
+		// Attribute discontinuity across x = 0.5, as for two materials
+		std::vector<glm::vec4> Attributes(Positions.size());
+		for(std::size_t i = 0; i < Positions.size(); ++i)
+			Attributes[i] = glm::vec4(Positions[i].x < 0.5f ? 0.0f : 1.0f);
+
+		std::size_t const Count = glm::simplify(&Positions[0], &Attributes[0], 1.0f, Positions.size(), &Indices[0], Indices.size() / 3, 2, 0.001f);
+
+		// Collapses mixing both attributes are too expensive, the flat halves are still simplified
+		Error += Count < Indices.size() / 3 / 4 ? 0 : 1;
+		for(std::size_t i = 0; i < Count * 3; ++i)
+		{
+			glm::vec4 const & a = Attributes[Indices[i]];
+			Error += a == glm::vec4(0) || a == glm::vec4(1) ? 0 : 1;
+		}
+
+		return Error;
+	}
+}//namespace attribute
+
+namespace cluster
+{
+	int test()
+	{
+		int Error = 0;
+
+		std::vector<glm::vec3> Positions;
+		std::vector<glm::uint> Indices;
+		sphere(256, 128, Positions, Indices);
+		std::size_t const TriangleCount = Indices.size() / 3;
+
+		std::vector<glm::vec3> PositionsA(Positions), PositionsB(Positions);
+		std::vector<glm::uint> IndicesA(Indices), IndicesB(Indices);
+		std::size_t const CountA = glm::simplifyClusters(&PositionsA[0], static_cast<glm::vec4 *>(0), 0.0f, Positions.size(), &IndicesA[0], TriangleCount, TriangleCount / 10, 1.0f);
+		std::size_t const CountB = glm::simplifyClusters(&PositionsB[0], static_cast<glm::vec4 *>(0), 0.0f, Positions.size(), &IndicesB[0], TriangleCount, TriangleCount / 10, 1.0f);
+
+		Error += CountA < TriangleCount / 5 ? 0 : 1;
+		Error += checkSphere(PositionsA, IndicesA, CountA, 0.01f);
+
+		// Deterministic result
+		Error += CountA == CountB ? 0 : 1;
+		Error += std::equal(IndicesA.begin(), IndicesA.begin() + CountA * 3, IndicesB.begin()) ? 0 : 1;
+		Error += PositionsA == PositionsB ? 0 : 1;
+
+		return Error;
+	}
+}//namespace cluster
+
+namespace perf
+{
+	int test()
+	{
+		// Wavy terrain of 512K triangles, without the high valence poles of a UV sphere
+		std::vector<glm::vec3> Positions;
+		std::vector<glm::uint> Indices;
+		grid(512, Positions, Indices);
+		for(std::size_t i = 0; i < Positions.size(); ++i)
+			Positions[i].z = 0.05f * glm::sin(Positions[i].x * 20.0f) * glm::cos(Positions[i].y * 15.0f);
+		std::size_t const TriangleCount = Indices.size() / 3;
+
+		std::vector<glm::vec3> Simplified(Positions);
+		std::vector<glm::uint> Triangles(Indices);
+
+		std::clock_t const Timestamp0 = std::clock();
+		glm::simplify(&Simplified[0], static_cast<glm::vec4 *>(0), 0.0f, Simplified.size(), &Triangles[0], TriangleCount, TriangleCount / 100, 1.0f);
+		std::clock_t const Timestamp1 = std::clock();
+		glm::simplifyClusters(&Positions[0], static_cast<glm::vec4 *>(0), 0.0f, Positions.size(), &Indices[0], TriangleCount, TriangleCount / 100, 1.0f);
+		std::clock_t const Timestamp2 = std::clock();
+
+		// std::clock measures the processor time of all threads
+		double const Mega = static_cast<double>(TriangleCount) * static_cast<double>(CLOCKS_PER_SEC) / 1000000.0;
+		std::printf("simplify: %.2f M triangles/s of CPU time\n", Mega / static_cast<double>(Timestamp1 - Timestamp0 + 1));
+		std::printf("simplifyClusters: %.2f M triangles/s of CPU time\n", Mega / static_cast<double>(Timestamp2 - Timestamp1 + 1));
+
+		return 0;
+	}
+}//namespace perf
+
+int main()
+{
+	int Error = 0;
+
+	Error += plane::test();
+	Error += curved::test();
+	Error += attribute::test();
+	Error += cluster::test();
+	Error += perf::test();
+
+	return Error;
+}
@@ -0,0 +1,370 @@
+#include <glm/gtx/occlusion_culling.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/constants.hpp>
+#include <vector>
+#include <cmath>
+#include <ctime>
+#include <cstdio>
+
+namespace
+{
+	// Deterministic pseudo random numbers in [-1, 1]
+	float random_unit(glm::uint32 & State)
+	{
+		State = State * 1664525u + 1013904223u;
+		return static_cast<float>(static_cast<double>(State) / 2147483647.5 - 1.0);
+	}
+
+	// Camera at the origin looking toward -z
+	glm::mat4 projection(std::size_t Width, std::size_t Height)
+	{
+		return glm::perspective(glm::radians(60.0f), static_cast<float>(Width) / static_cast<float>(Height), 0.1f, 1000.0f);
+	}
+
+	// Two triangles of the square of half size Size centered on Center, facing the z axis
+	void add_quad(std::vector<glm::vec3> & Positions, std::vector<glm::uint> & Indices, glm::vec3 const & Center, float Size)
+	{
+		glm::uint const First = static_cast<glm::uint>(Positions.size());
+		Positions.push_back(Center + glm::vec3(-Size,-Size, 0));
+		Positions.push_back(Center + glm::vec3( Size,-Size, 0));
+		Positions.push_back(Center + glm::vec3( Size, Size, 0));
+		Positions.push_back(Center + glm::vec3(-Size, Size, 0));
+		glm::uint const Quad[6] = {0, 1, 2, 0, 2, 3};
+		for(int i = 0; i < 6; ++i)
+			Indices.push_back(First + Quad[i]);
+	}
+
+	void rasterize(glm::occlusion_buffer & Buffer, glm::mat4 const & Matrix, std::vector<glm::vec3> const & Positions, std::vector<glm::uint> const & Indices)
+	{
+		glm::rasterizeOccluders(Buffer, Matrix, &Positions[0], Positions.size(), &Indices[0], Indices.size() / 3);
+	}
+
+	double seconds()
+	{
+		return static_cast<double>(std::clock()) / static_cast<double>(CLOCKS_PER_SEC);
+	}
+
+	double rate(std::size_t Count, double Time)
+	{
+		return static_cast<double>(Count) * 1e-3 / (Time > 0.0 ? Time : 1e-9);
+	}
+}//namespace
+
+int test_clear()
+{
+	int Error = 0;
+
+	glm::occlusion_buffer Buffer(100, 50);
+	Error += Buffer.Width == 104 && Buffer.Height == 56 ? 0 : 1;
+	Error += Buffer.Depth.size() == 104 * 56 && Buffer.HiZ.size() == 13 * 7 ? 0 : 1;
+
+	glm::mat4 const Projection = projection(Buffer.Width, Buffer.Height);
+	Error += glm::isVisible(Buffer, Projection, glm::vec3(-1,-1,-101), glm::vec3(1, 1,-99)) ? 0 : 1;
+
+	std::vector<glm::vec3> Positions;
+	std::vector<glm::uint> Indices;
+	add_quad(Positions, Indices, glm::vec3(0, 0,-10), 100.0f);
+	rasterize(Buffer, Projection, Positions, Indices);
+	Error += !glm::isVisible(Buffer, Projection, glm::vec3(-1,-1,-101), glm::vec3(1, 1,-99)) ? 0 : 1;
+
+	glm::clearOcclusion(Buffer);
+	Error += glm::isVisible(Buffer, Projection, glm::vec3(-1,-1,-101), glm::vec3(1, 1,-99)) ? 0 : 1;
+	for(std::size_t i = 0; i < Buffer.Depth.size(); ++i)
+		Error += Buffer.Depth[i] == 0.0f ? 0 : 1;
+
+	return Error;
+}
+
+int test_quad()
+{
+	int Error = 0;
+
+	glm::occlusion_buffer Buffer(256, 128);
+	glm::mat4 const Projection = projection(Buffer.Width, Buffer.Height);
+
+	std::vector<glm::vec3> Positions;
+	std::vector<glm::uint> Indices;
+	add_quad(Positions, Indices, glm::vec3(0, 0,-10), 2.0f);
+	rasterize(Buffer, Projection, Positions, Indices);
+
+	// Every covered pixel is at 1/w = 1/10, the quad covers about a third of the height
+	std::size_t Covered = 0;
+	for(std::size_t i = 0; i < Buffer.Depth.size(); ++i)
+	{
+		if(Buffer.Depth[i] == 0.0f)
+			continue;
+		++Covered;
+		Error += glm::abs(Buffer.Depth[i] - 0.1f) < 1e-6f ? 0 : 1;
+	}
+	float const Side = 2.0f / glm::tan(glm::radians(30.0f)) * 0.2f * 0.5f * static_cast<float>(Buffer.Height);
+	Error += glm::abs(static_cast<float>(Covered) - Side * Side) < Side * 4.0f ? 0 : 1;
+
+	// Hierarchical depth of the blocks entirely covered
+	Error += Buffer.HiZ[(Buffer.Height / 16) * (Buffer.Width / 8) + Buffer.Width / 16] == Buffer.Depth[(Buffer.Height / 2) * Buffer.Width + Buffer.Width / 2] ? 0 : 1;
+
+	// Behind the quad
+	Error += !glm::isVisible(Buffer, Projection, glm::vec3(-1.0f,-1.0f,-21.0f), glm::vec3(1.0f, 1.0f,-19.0f)) ? 0 : 1;
+	// In front of the quad
+	Error += glm::isVisible(Buffer, Projection, glm::vec3(-0.1f,-0.1f,-6.0f), glm::vec3(0.1f, 0.1f,-5.0f)) ? 0 : 1;
+	// Crossing the quad
+	Error += glm::isVisible(Buffer, Projection, glm::vec3(-0.5f,-0.5f,-11.0f), glm::vec3(0.5f, 0.5f,-9.0f)) ? 0 : 1;
+	// Behind the quad, but larger on screen
+	Error += glm::isVisible(Buffer, Projection, glm::vec3(-5.0f,-1.0f,-21.0f), glm::vec3(5.0f, 1.0f,-19.0f)) ? 0 : 1;
+	// Beside the quad
+	Error += glm::isVisible(Buffer, Projection, glm::vec3(5.0f,-1.0f,-21.0f), glm::vec3(6.0f, 1.0f,-19.0f)) ? 0 : 1;
+	// Outside the viewport
+	Error += !glm::isVisible(Buffer, Projection, glm::vec3(50.0f,-1.0f,-21.0f), glm::vec3(51.0f, 1.0f,-19.0f)) ? 0 : 1;
+
+	// Both windings are occluders
+	glm::occlusion_buffer Reversed(256, 128);
+	std::swap(Indices[1], Indices[2]);
+	std::swap(Indices[4], Indices[5]);
+	rasterize(Reversed, Projection, Positions, Indices);
+	Error += Reversed.Depth == Buffer.Depth ? 0 : 1;
+
+	return Error;
+}
+
+// Pixel centers against random triangles evaluated in double, ignoring pixels too close to an edge
+int test_triangles()
+{
+	int Error = 0;
+
+	glm::occlusion_buffer Buffer(200, 120);
+	glm::mat4 const Projection = projection(Buffer.Width, Buffer.Height);
+	double const Width = static_cast<double>(Buffer.Width);
+	double const Height = static_cast<double>(Buffer.Height);
+
+	glm::uint32 State = 7u;
+	std::size_t const Count = 1000;
+	std::vector<glm::vec3> Positions;
+	std::vector<glm::uint> Indices;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec3 const Center(random_unit(State) * 12.0f, random_unit(State) * 7.0f, -11.0f + random_unit(State) * 9.0f);
+		for(int j = 0; j < 3; ++j)
+		{
+			Indices.push_back(static_cast<glm::uint>(Positions.size()));
+			Positions.push_back(Center + glm::vec3(random_unit(State), random_unit(State), random_unit(State)));
+		}
+	}
+	rasterize(Buffer, Projection, Positions, Indices);
+
+	std::vector<double> Reference(Buffer.Depth.size(), 0.0);
+	std::vector<bool> Ambiguous(Buffer.Depth.size(), false);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		double x[3], y[3], z[3];
+		for(int j = 0; j < 3; ++j)
+		{
+			glm::vec3 const & p = Positions[i * 3 + j];
+			double Clip[4];
+			for(glm::length_t r = 0; r < 4; ++r)
+				Clip[r] = static_cast<double>(Projection[0][r]) * p.x + static_cast<double>(Projection[1][r]) * p.y + static_cast<double>(Projection[2][r]) * p.z + static_cast<double>(Projection[3][r]);
+			x[j] = (Clip[0] / Clip[3] * 0.5 + 0.5) * Width;
+			y[j] = (Clip[1] / Clip[3] * 0.5 + 0.5) * Height;
+			z[j] = 1.0 / Clip[3];
+		}
+		double const Area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+		if(glm::abs(Area) < 1e-3)
+			continue;
+		double const Nearest = glm::max(z[0], glm::max(z[1], z[2]));
+
+		for(std::size_t py = 0; py < Buffer.Height; ++py)
+		for(std::size_t px = 0; px < Buffer.Width; ++px)
+		{
+			double const cx = static_cast<double>(px) + 0.5;
+			double const cy = static_cast<double>(py) + 0.5;
+			double Barycentric[3];
+			bool Inside = true, Near = false;
+			for(int j = 0; j < 3; ++j)
+			{
+				int const a = (j + 1) % 3, b = (j + 2) % 3;
+				double const Edge = ((x[b] - x[a]) * (cy - y[a]) - (y[b] - y[a]) * (cx - x[a])) / Area;
+				double const Distance = Edge * glm::abs(Area) / glm::sqrt((x[b] - x[a]) * (x[b] - x[a]) + (y[b] - y[a]) * (y[b] - y[a]));
+				Barycentric[j] = Edge;
+				Inside = Inside && Edge >= 0.0;
+				Near = Near || glm::abs(Distance) < 1e-2;
+			}
+			std::size_t const Pixel = py * Buffer.Width + px;
+			if(Near)
+				Ambiguous[Pixel] = true;
+			else if(Inside)
+				Reference[Pixel] = glm::max(Reference[Pixel], glm::min(Barycentric[0] * z[0] + Barycentric[1] * z[1] + Barycentric[2] * z[2], Nearest));
+		}
+	}
+
+	std::size_t Checked = 0;
+	for(std::size_t i = 0; i < Buffer.Depth.size(); ++i)
+	{
+		if(Ambiguous[i])
+			continue;
+		++Checked;
+		Error += glm::abs(static_cast<double>(Buffer.Depth[i]) - Reference[i]) <= 1e-5 * Reference[i] ? 0 : 1;
+	}
+	Error += Checked > Buffer.Depth.size() / 4 ? 0 : 1;
+
+	// Hierarchical depth is the smallest depth of each block
+	std::size_t const BlocksX = Buffer.Width / 8;
+	for(std::size_t by = 0; by < Buffer.Height / 8; ++by)
+	for(std::size_t bx = 0; bx < BlocksX; ++bx)
+	{
+		float Farthest = 1e30f;
+		for(std::size_t y = by * 8; y < by * 8 + 8; ++y)
+		for(std::size_t x = bx * 8; x < bx * 8 + 8; ++x)
+			Farthest = glm::min(Farthest, Buffer.Depth[y * Buffer.Width + x]);
+		Error += Buffer.HiZ[by * BlocksX + bx] == Farthest ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int test_near_plane()
+{
+	int Error = 0;
+
+	glm::occlusion_buffer Buffer(128, 64);
+	glm::mat4 const Projection = projection(Buffer.Width, Buffer.Height);
+
+	// A triangle crossing the plane of the camera is not an occluder
+	std::vector<glm::vec3> Positions;
+	std::vector<glm::uint> Indices;
+	Positions.push_back(glm::vec3(-10, -1,-10));
+	Positions.push_back(glm::vec3( 10, -1,-10));
+	Positions.push_back(glm::vec3(  0, -1, 10));
+	Indices.push_back(0);
+	Indices.push_back(1);
+	Indices.push_back(2);
+	rasterize(Buffer, Projection, Positions, Indices);
+	for(std::size_t i = 0; i < Buffer.Depth.size(); ++i)
+		Error += Buffer.Depth[i] == 0.0f ? 0 : 1;
+
+	// A box around the camera is visible behind any occluder
+	Positions.clear();
+	Indices.clear();
+	add_quad(Positions, Indices, glm::vec3(0, 0,-1), 100.0f);
+	rasterize(Buffer, Projection, Positions, Indices);
+	Error += glm::isVisible(Buffer, Projection, glm::vec3(-1,-1,-5), glm::vec3(1, 1, 5)) ? 0 : 1;
+	Error += !glm::isVisible(Buffer, Projection, glm::vec3(-1,-1,-5), glm::vec3(1, 1,-2)) ? 0 : 1;
+
+	return Error;
+}
+
+int test_batch()
+{
+	int Error = 0;
+
+	glm::occlusion_buffer Buffer(320, 160);
+	glm::mat4 const Projection = projection(Buffer.Width, Buffer.Height);
+	glm::mat4 const View = glm::lookAt(glm::vec3(1, 2, 3), glm::vec3(0, 0,-20), glm::vec3(0, 1, 0));
+	glm::mat4 const Matrix = Projection * View;
+
+	glm::uint32 State = 11u;
+	std::vector<glm::vec3> Positions;
+	std::vector<glm::uint> Indices;
+	for(int i = 0; i < 40; ++i)
+		add_quad(Positions, Indices, glm::vec3(random_unit(State) * 10.0f, random_unit(State) * 5.0f,-15.0f + random_unit(State) * 5.0f), 1.0f + random_unit(State) * 0.5f);
+	rasterize(Buffer, Matrix, Positions, Indices);
+
+	std::size_t const Count = 20000;
+	std::vector<glm::vec3> Mins(Count), Maxs(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Mins[i] = glm::vec3(random_unit(State) * 15.0f, random_unit(State) * 8.0f,-25.0f + random_unit(State) * 15.0f);
+		Maxs[i] = Mins[i] + (glm::vec3(random_unit(State), random_unit(State), random_unit(State)) + 1.0f) * 0.5f;
+	}
+
+	bool * Visible = new bool[Count];
+	glm::isVisible(Buffer, Matrix, &Mins[0], &Maxs[0], Count, Visible);
+
+	std::size_t Occluded = 0;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += Visible[i] == glm::isVisible(Buffer, Matrix, Mins[i], Maxs[i]) ? 0 : 1;
+		Occluded += Visible[i] ? 0 : 1;
+	}
+	Error += Occluded > 0 && Occluded < Count ? 0 : 1;
+	delete[] Visible;
+
+	return Error;
+}
+
+int perf_occlusion()
+{
+	int Error = 0;
+
+	glm::occlusion_buffer Buffer(512, 256);
+	glm::mat4 const Matrix = projection(Buffer.Width, Buffer.Height) * glm::lookAt(glm::vec3(0, 2, 0), glm::vec3(0, 0,-50), glm::vec3(0, 1, 0));
+
+	// A city of boxes, 12 triangles each
+	glm::uint const Box[36] = {0,1,3, 0,3,2, 4,6,7, 4,7,5, 0,4,5, 0,5,1, 2,3,7, 2,7,6, 0,2,6, 0,6,4, 1,5,7, 1,7,3};
+	glm::uint32 State = 3u;
+	std::vector<glm::vec3> Positions;
+	std::vector<glm::uint> Indices;
+	std::size_t const Buildings = 4096;
+	for(std::size_t i = 0; i < Buildings; ++i)
+	{
+		glm::vec3 const Min(random_unit(State) * 100.0f, 0.0f,-105.0f + random_unit(State) * 100.0f);
+		glm::vec3 const Max = Min + glm::vec3(2.0f, 3.0f + random_unit(State) * 2.0f, 2.0f);
+		glm::uint const First = static_cast<glm::uint>(Positions.size());
+		for(int j = 0; j < 8; ++j)
+			Positions.push_back(glm::vec3(j & 1 ? Max.x : Min.x, j & 2 ? Max.y : Min.y, j & 4 ? Max.z : Min.z));
+		for(int j = 0; j < 36; ++j)
+			Indices.push_back(First + Box[j]);
+	}
+	std::size_t const Triangles = Indices.size() / 3;
+
+	int const Frames = 10;
+	double const StartRasterize = seconds();
+	for(int i = 0; i < Frames; ++i)
+	{
+		glm::clearOcclusion(Buffer);
+		rasterize(Buffer, Matrix, Positions, Indices);
+	}
+	double const TimeRasterize = seconds() - StartRasterize;
+
+	std::size_t const Count = 1 << 16;
+	std::vector<glm::vec3> Mins(Count), Maxs(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Mins[i] = glm::vec3(random_unit(State) * 100.0f, (random_unit(State) + 1.0f) * 4.0f,-105.0f + random_unit(State) * 100.0f);
+		Maxs[i] = Mins[i] + glm::vec3(0.5f);
+	}
+	bool * Visible = new bool[Count];
+
+	double const StartSingle = seconds();
+	for(std::size_t i = 0; i < Count; ++i)
+		Visible[i] = glm::isVisible(Buffer, Matrix, Mins[i], Maxs[i]);
+	double const TimeSingle = seconds() - StartSingle;
+
+	double const StartBatch = seconds();
+	glm::isVisible(Buffer, Matrix, &Mins[0], &Maxs[0], Count, Visible);
+	double const TimeBatch = seconds() - StartBatch;
+
+	std::size_t Occluded = 0;
+	for(std::size_t i = 0; i < Count; ++i)
+		Occluded += Visible[i] ? 0 : 1;
+	delete[] Visible;
+
+	std::printf("rasterizeOccluders: %.0f triangles/ms\n", rate(Triangles * Frames, TimeRasterize));
+	std::printf("isVisible: %.0f queries/ms\n", rate(Count, TimeSingle));
+	std::printf("isVisible batch: %.0f queries/ms, %.0f%% occluded\n", rate(Count, TimeBatch), 100.0 * static_cast<double>(Occluded) / static_cast<double>(Count));
+
+	Error += Occluded > 0 ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_clear();
+	Error += test_quad();
+	Error += test_triangles();
+	Error += test_near_plane();
+	Error += test_batch();
+	Error += perf_occlusion();
+
+	return Error;
+}
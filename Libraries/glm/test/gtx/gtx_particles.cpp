@@ -0,0 +1,424 @@
+#include <glm/glm.hpp>
+
+#if GLM_HAS_ALIGNED_TYPE && GLM_HAS_ALIGNOF && GLM_HAS_CXX11_STL && !((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_COMPILER < GLM_COMPILER_VC14))
+#include <glm/gtx/particles.hpp>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <ctime>
+#include <cstdio>
+#include <cmath>
+
+namespace
+{
+	// Deterministic pseudo random numbers in [-1, 1]
+	float random_unit(glm::uint32 & State)
+	{
+		State = State * 1664525u + 1013904223u;
+		return static_cast<float>(static_cast<double>(State) / 2147483647.5 - 1.0);
+	}
+
+	double seconds()
+	{
+		return static_cast<double>(std::clock()) / static_cast<double>(CLOCKS_PER_SEC);
+	}
+
+	bool is_aligned(void const * Pointer, std::size_t Alignment)
+	{
+		return reinterpret_cast<std::uintptr_t>(Pointer) % Alignment == 0;
+	}
+
+	// Same generator as emitParticles
+	float xorshift(glm::uint & State)
+	{
+		State ^= State << 13;
+		State ^= State >> 17;
+		State ^= State << 5;
+		glm::uint const Bits = (State >> 9) | 0x3f800000u;
+		float One;
+		std::memcpy(&One, &Bits, sizeof(One));
+		return One * 2.0f - 3.0f;
+	}
+
+	// Array of structures particle, updated by the loop we want to replace
+	struct particle
+	{
+		glm::vec3 Position;
+		glm::vec3 Velocity;
+		glm::vec4 Color;
+		float Age;
+		float Life;
+	};
+
+	void integrate(glm::particle_system const & System, particle & Particle, float DeltaTime)
+	{
+		Particle.Velocity = (Particle.Velocity + System.Gravity * DeltaTime) * glm::max(1.0f - System.Drag * DeltaTime, 0.0f);
+		Particle.Position += Particle.Velocity * DeltaTime;
+		for(std::size_t p = 0; p < System.Planes.size(); ++p)
+		{
+			glm::vec3 const Normal(System.Planes[p]);
+			float const Distance = glm::dot(Normal, Particle.Position) + System.Planes[p].w;
+			if(Distance < 0.0f)
+			{
+				Particle.Position -= Normal * Distance;
+				float const Speed = glm::dot(Normal, Particle.Velocity);
+				if(Speed < 0.0f)
+					Particle.Velocity -= Normal * (Speed * (1.0f + System.Restitution));
+			}
+		}
+		Particle.Age += DeltaTime;
+	}
+
+	particle get(glm::particle_emitter const & Emitter, std::size_t i)
+	{
+		particle Particle;
+		Particle.Position = glm::vec3(Emitter.PositionX[i], Emitter.PositionY[i], Emitter.PositionZ[i]);
+		Particle.Velocity = glm::vec3(Emitter.VelocityX[i], Emitter.VelocityY[i], Emitter.VelocityZ[i]);
+		Particle.Color = glm::vec4(Emitter.ColorR[i], Emitter.ColorG[i], Emitter.ColorB[i], Emitter.ColorA[i]);
+		Particle.Age = Emitter.Age[i];
+		Particle.Life = Emitter.Life[i];
+		return Particle;
+	}
+
+	glm::particle_emitter fountain(std::size_t Capacity, glm::uint Seed)
+	{
+		glm::particle_emitter Emitter(Capacity, Seed);
+		Emitter.Origin = glm::vec3(1.0f, 2.0f, 3.0f);
+		Emitter.Extent = glm::vec3(0.5f, 0.25f, 1.0f);
+		Emitter.Velocity = glm::vec3(0.0f, 5.0f, 1.0f);
+		Emitter.VelocitySpread = glm::vec3(2.0f, 1.0f, 2.0f);
+		Emitter.Color = glm::vec4(1.0f, 0.5f, 0.25f, 0.75f);
+		Emitter.Lifetime = 2.0f;
+		Emitter.LifetimeSpread = 1.0f;
+		return Emitter;
+	}
+}//namespace
+
+int test_emit()
+{
+	int Error = 0;
+
+	glm::particle_emitter Emitter = fountain(13, 9);
+	Error += Emitter.PositionX.size() == 16 && Emitter.Life.size() == 16 ? 0 : 1;
+	Error += is_aligned(Emitter.PositionX.data(), 32) && is_aligned(Emitter.VelocityZ.data(), 32) && is_aligned(Emitter.Life.data(), 32) ? 0 : 1;
+
+	glm::uint States[4];
+	std::memcpy(States, Emitter.Random, sizeof(States));
+
+	Error += glm::emitParticles(Emitter, 6) == 6 ? 0 : 1;
+	Error += glm::emitParticles(Emitter, 5) == 5 ? 0 : 1;
+	Error += glm::emitParticles(Emitter, 5) == 2 ? 0 : 1;
+	Error += glm::emitParticles(Emitter, 5) == 0 ? 0 : 1;
+	Error += Emitter.Count == 13 ? 0 : 1;
+
+	// Each call draws blocks of 4 particles from the 4 generators
+	std::size_t const Calls[3][2] = {{0, 6}, {6, 11}, {11, 13}};
+	for(std::size_t c = 0; c < 3; ++c)
+	for(std::size_t Block = Calls[c][0]; Block < Calls[c][1]; Block += 4)
+	for(std::size_t Lane = 0; Lane < 4; ++Lane)
+	{
+		float Values[7];
+		for(std::size_t v = 0; v < 7; ++v)
+			Values[v] = xorshift(States[Lane]);
+		std::size_t const i = Block + Lane;
+		if(i >= Calls[c][1])
+			continue;
+
+		particle const Particle = get(Emitter, i);
+		Error += Particle.Position == Emitter.Origin + glm::vec3(Values[0], Values[1], Values[2]) * Emitter.Extent ? 0 : 1;
+		Error += Particle.Velocity == Emitter.Velocity + glm::vec3(Values[3], Values[4], Values[5]) * Emitter.VelocitySpread ? 0 : 1;
+		Error += Particle.Life == Emitter.Lifetime + Values[6] * Emitter.LifetimeSpread ? 0 : 1;
+		Error += Particle.Color == Emitter.Color && Particle.Age == 0.0f ? 0 : 1;
+		Error += glm::all(glm::lessThanEqual(glm::abs(Particle.Position - Emitter.Origin), Emitter.Extent)) ? 0 : 1;
+	}
+	Error += std::memcmp(States, Emitter.Random, sizeof(States)) == 0 ? 0 : 1;
+
+	// Same seed, same particles
+	glm::particle_emitter Other = fountain(13, 9);
+	glm::emitParticles(Other, 13);
+	Error += Other.PositionX[12] != Emitter.PositionX[12] && Other.PositionX[3] == Emitter.PositionX[3] ? 0 : 1;
+
+	glm::particle_emitter Empty;
+	Error += glm::emitParticles(Empty, 10) == 0 && glm::killParticles(Empty) == 0 ? 0 : 1;
+
+	return Error;
+}
+
+int test_integrate()
+{
+	int Error = 0;
+
+	glm::particle_system System;
+	System.Drag = 0.1f;
+	System.Restitution = 0.25f;
+	System.Planes.push_back(glm::vec4(0, 1, 0, 0));
+	System.Planes.push_back(glm::vec4(glm::normalize(glm::vec3(-1, 0, -1)), 4.0f));
+
+	glm::particle_emitter Emitter = fountain(1000, 3);
+	Emitter.Lifetime = 100.0f;
+	glm::emitParticles(Emitter, 997);
+
+	std::vector<particle> Particles(Emitter.Count);
+	for(std::size_t i = 0; i < Particles.size(); ++i)
+		Particles[i] = get(Emitter, i);
+
+	for(int Step = 0; Step < 200; ++Step)
+	{
+		glm::integrateParticles(System, Emitter, 1.0f / 60.0f);
+		for(std::size_t i = 0; i < Particles.size(); ++i)
+			integrate(System, Particles[i], 1.0f / 60.0f);
+	}
+
+	int Bounced = 0;
+	for(std::size_t i = 0; i < Particles.size(); ++i)
+	{
+		particle const Particle = get(Emitter, i);
+		Error += glm::all(glm::lessThan(glm::abs(Particle.Position - Particles[i].Position), glm::vec3(1e-3f))) ? 0 : 1;
+		Error += glm::all(glm::lessThan(glm::abs(Particle.Velocity - Particles[i].Velocity), glm::vec3(1e-3f))) ? 0 : 1;
+		Error += glm::abs(Particle.Age - Particles[i].Age) < 1e-4f ? 0 : 1;
+		Error += Particle.Position.y >= 0.0f ? 0 : 1;
+		Error += glm::dot(glm::vec3(System.Planes[1]), Particle.Position) + System.Planes[1].w >= -1e-5f ? 0 : 1;
+		Bounced += Particle.Position.y < 0.5f ? 1 : 0;
+	}
+	Error += Bounced > 100 ? 0 : 1;
+
+	return Error;
+}
+
+int test_kill()
+{
+	int Error = 0;
+
+	glm::particle_emitter Emitter(100);
+	Emitter.Lifetime = 1.0f;
+	glm::emitParticles(Emitter, 100);
+
+	// Unique lifetimes identify particles, those multiple of 3 or 7 die
+	glm::uint32 State = 11;
+	std::vector<int> Alive(100, 0);
+	for(std::size_t i = 0; i < 100; ++i)
+	{
+		Emitter.Life[i] = static_cast<float>(i);
+		Emitter.Age[i] = i % 3 == 0 || i % 7 == 0 ? static_cast<float>(i) + glm::abs(random_unit(State)) : static_cast<float>(i) * 0.5f;
+		Emitter.PositionX[i] = static_cast<float>(i) * 2.0f;
+	}
+	Emitter.Age[1] = 1.0f;
+
+	std::size_t Expected = 0;
+	for(std::size_t i = 0; i < 100; ++i)
+		Expected += i % 3 == 0 || i % 7 == 0 || i == 1 ? 0 : 1;
+
+	Error += glm::killParticles(Emitter) == 100 - Expected ? 0 : 1;
+	Error += Emitter.Count == Expected ? 0 : 1;
+	for(std::size_t i = 0; i < Emitter.Count; ++i)
+	{
+		std::size_t const Id = static_cast<std::size_t>(Emitter.Life[i]);
+		Error += Emitter.Age[i] < Emitter.Life[i] && Emitter.PositionX[i] == static_cast<float>(Id) * 2.0f ? 0 : 1;
+		Alive[Id] += 1;
+	}
+	for(std::size_t i = 0; i < 100; ++i)
+		Error += Alive[i] == (i % 3 == 0 || i % 7 == 0 || i == 1 ? 0 : 1) ? 0 : 1;
+	Error += glm::killParticles(Emitter) == 0 ? 0 : 1;
+
+	return Error;
+}
+
+int test_update()
+{
+	int Error = 0;
+
+	glm::particle_system Systems[2];
+	for(int s = 0; s < 2; ++s)
+	{
+		Systems[s].Planes.push_back(glm::vec4(0, 1, 0, 0));
+		for(glm::uint e = 0; e < 7; ++e)
+		{
+			glm::particle_emitter Emitter = fountain(400 + e * 50, e + 1);
+			Emitter.Rate = 100.0f + static_cast<float>(e) * 25.0f;
+			Emitter.Lifetime = 1.0f;
+			Emitter.LifetimeSpread = 0.5f;
+			Systems[s].Emitters.push_back(Emitter);
+		}
+	}
+
+	for(int Frame = 0; Frame < 20; ++Frame)
+	{
+		glm::updateParticles(Systems[0], 0.02f);
+		glm::updateParticles(Systems[1], 0.02f);
+	}
+
+	// 0.4 seconds into the effect, no particle expired yet
+	for(glm::uint e = 0; e < 7; ++e)
+	{
+		glm::particle_emitter const & Emitter = Systems[0].Emitters[e];
+		std::size_t const Emitted = static_cast<std::size_t>(Emitter.Rate * 0.4f + 0.5f);
+		Error += Emitter.Count + 1 >= Emitted && Emitter.Count <= Emitted ? 0 : 1;
+		Error += std::memcmp(Emitter.PositionX.data(), Systems[1].Emitters[e].PositionX.data(), Emitter.Count * sizeof(float)) == 0 ? 0 : 1;
+	}
+
+	// Then the capacity limits emission, and particles expire
+	for(int Frame = 0; Frame < 200; ++Frame)
+		glm::updateParticles(Systems[0], 0.02f);
+	for(glm::uint e = 0; e < 7; ++e)
+	{
+		glm::particle_emitter const & Emitter = Systems[0].Emitters[e];
+		Error += Emitter.Count <= Emitter.Capacity && Emitter.Count > Emitter.Capacity / 4 ? 0 : 1;
+		for(std::size_t i = 0; i < Emitter.Count; ++i)
+			Error += Emitter.Age[i] < Emitter.Life[i] && Emitter.PositionY[i] >= 0.0f ? 0 : 1;
+	}
+	Error += glm::particleCount(Systems[0]) > 0 ? 0 : 1;
+
+	return Error;
+}
+
+int test_vertices()
+{
+	int Error = 0;
+
+	glm::particle_system System;
+	glm::uint32 State = 1;
+	for(glm::uint e = 0; e < 5; ++e)
+	{
+		System.Emitters.push_back(fountain(37 * e + 3, e));
+		glm::particle_emitter & Emitter = System.Emitters.back();
+		glm::emitParticles(Emitter, 30 * e + 1);
+		for(std::size_t i = 0; i < Emitter.Count; ++i)
+		{
+			Emitter.ColorR[i] = random_unit(State) * 1.2f;
+			Emitter.ColorG[i] = random_unit(State) * 0.5f + 0.5f;
+			Emitter.ColorB[i] = random_unit(State) * 0.6f + 0.4f;
+			Emitter.ColorA[i] = 1.0f;
+			Emitter.Age[i] = glm::abs(random_unit(State)) * 3.0f;
+		}
+	}
+
+	// 0x1.0101p-9, the float just below 0.5 / 255, packs to 0 while adding 0.5 before truncating gives 1
+	glm::particle_emitter & First = System.Emitters[1];
+	for(std::size_t i = 0; i < 8 && i < First.Count; ++i)
+		First.ColorG[i] = std::ldexp(static_cast<float>(0x10101), -25);
+
+	std::size_t const Count = glm::particleCount(System);
+	std::vector<glm::particle_vertex> Vertices(Count + 1);
+	Vertices[Count].Color = 0x12345678u;
+	Error += sizeof(glm::particle_vertex) == 16 ? 0 : 1;
+	Error += glm::writeParticleVertices(System, &Vertices[0]) == Count ? 0 : 1;
+	Error += Vertices[Count].Color == 0x12345678u ? 0 : 1;
+
+	std::size_t v = 0;
+	for(std::size_t e = 0; e < System.Emitters.size(); ++e)
+	{
+		glm::particle_emitter const & Emitter = System.Emitters[e];
+		for(std::size_t i = 0; i < Emitter.Count; ++i, ++v)
+		{
+			particle const Particle = get(Emitter, i);
+			float const Fade = Particle.Age < Particle.Life ? 1.0f - Particle.Age / Particle.Life : 0.0f;
+			glm::uint const Color = glm::packUnorm4x8(glm::vec4(glm::vec3(Particle.Color), Particle.Color.a * Fade));
+			Error += Vertices[v].Position == Particle.Position ? 0 : 1;
+			Error += Vertices[v].Color == Color ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+int perf_particles()
+{
+	int Error = 0;
+
+	std::size_t const EmitterCount = 16;
+	std::size_t const Capacity = 65536;
+	float const DeltaTime = 1.0f / 60.0f;
+	int const Frames = 20;
+
+	glm::particle_system System;
+	System.Drag = 0.05f;
+	System.Planes.push_back(glm::vec4(0, 1, 0, 0));
+	System.Planes.push_back(glm::vec4(-1, 0, 0, 20));
+	for(std::size_t e = 0; e < EmitterCount; ++e)
+	{
+		glm::particle_emitter Emitter = fountain(Capacity, static_cast<glm::uint>(e + 1));
+		Emitter.Origin.x = static_cast<float>(e);
+		Emitter.Rate = static_cast<float>(Capacity) / Emitter.Lifetime;
+		glm::emitParticles(Emitter, Capacity);
+		System.Emitters.push_back(Emitter);
+	}
+
+	std::vector<particle> Particles;
+	for(std::size_t e = 0; e < EmitterCount; ++e)
+	for(std::size_t i = 0; i < Capacity; ++i)
+		Particles.push_back(get(System.Emitters[e], i));
+	std::vector<glm::particle_vertex> Vertices(EmitterCount * Capacity);
+
+	// Array of structures: integrate, collide, swap remove and pack one particle at a time
+	glm::uint32 State = 1;
+	double const StartAoS = seconds();
+	for(int Frame = 0; Frame < Frames; ++Frame)
+	{
+		for(std::size_t i = 0; i < Particles.size();)
+		{
+			integrate(System, Particles[i], DeltaTime);
+			if(Particles[i].Age >= Particles[i].Life)
+			{
+				Particles[i] = Particles.back();
+				Particles.pop_back();
+			}
+			else
+				++i;
+		}
+		while(Particles.size() < EmitterCount * Capacity)
+		{
+			particle Particle;
+			Particle.Position = glm::vec3(random_unit(State), random_unit(State), random_unit(State));
+			Particle.Velocity = glm::vec3(random_unit(State), random_unit(State) + 5.0f, random_unit(State));
+			Particle.Color = glm::vec4(1.0f);
+			Particle.Age = 0.0f;
+			Particle.Life = 2.0f + random_unit(State);
+			Particles.push_back(Particle);
+		}
+		for(std::size_t i = 0; i < Particles.size(); ++i)
+		{
+			Vertices[i].Position = Particles[i].Position;
+			Vertices[i].Color = glm::packUnorm4x8(glm::vec4(glm::vec3(Particles[i].Color), Particles[i].Color.a * (1.0f - Particles[i].Age / Particles[i].Life)));
+		}
+	}
+	double const TimeAoS = seconds() - StartAoS;
+
+	std::size_t Written = 0;
+	double const StartSoA = seconds();
+	for(int Frame = 0; Frame < Frames; ++Frame)
+	{
+		glm::updateParticles(System, DeltaTime);
+		Written += glm::writeParticleVertices(System, &Vertices[0]);
+	}
+	double const TimeSoA = seconds() - StartSoA;
+
+	double const Scale = 1e3 / static_cast<double>(Frames);
+	std::printf("Update and vertices of %d particles, array of structures: %.2f ms/frame\n", static_cast<int>(EmitterCount * Capacity), TimeAoS * Scale);
+	std::printf("Update and vertices of %d particles, structure of arrays: %.2f ms/frame\n", static_cast<int>(Written / Frames), TimeSoA * Scale);
+	Error += Written > EmitterCount * Capacity * Frames / 2 ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_emit();
+	Error += test_integrate();
+	Error += test_kill();
+	Error += test_update();
+	Error += test_vertices();
+	Error += perf_particles();
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
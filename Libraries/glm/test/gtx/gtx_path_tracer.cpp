@@ -0,0 +1,339 @@
+#include <glm/gtx/path_tracer.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/constants.hpp>
+#include <gli/gli.hpp>
+#include <vector>
+#include <limits>
+#include <cstring>
+#include <ctime>
+#include <cstdio>
+
+namespace
+{
+	// Deterministic pseudo random numbers in [-1, 1]
+	float random_unit(glm::uint32 & State)
+	{
+		State = State * 1664525u + 1013904223u;
+		return static_cast<float>(static_cast<double>(State) / 2147483647.5 - 1.0);
+	}
+
+	double seconds()
+	{
+		return static_cast<double>(std::clock()) / static_cast<double>(CLOCKS_PER_SEC);
+	}
+
+	void add_quad(glm::path_scene & Scene, glm::vec3 const & a, glm::vec3 const & b, glm::vec3 const & c, glm::vec3 const & d, glm::uint Material)
+	{
+		glm::vec3 const Positions[4] = {a, b, c, d};
+		glm::uint const Indices[6] = {0, 1, 2, 0, 2, 3};
+		glm::addMesh(Scene, Positions, 4, Indices, 2, Material);
+	}
+
+	// Box of [-1, 1] x [0, 2] x [-1, 1] open toward +z, with a light in the middle of its ceiling
+	void cornell_box(glm::path_scene & Scene)
+	{
+		Scene.Background = glm::vec3(0.0f);
+		glm::uint const White = glm::addMaterial(Scene, glm::vec3(0.75f), glm::vec3(0.0f));
+		glm::uint const Red = glm::addMaterial(Scene, glm::vec3(0.75f, 0.2f, 0.2f), glm::vec3(0.0f));
+		glm::uint const Green = glm::addMaterial(Scene, glm::vec3(0.2f, 0.75f, 0.2f), glm::vec3(0.0f));
+		glm::uint const Light = glm::addMaterial(Scene, glm::vec3(0.0f), glm::vec3(12.0f));
+
+		add_quad(Scene, glm::vec3(-1, 0, -1), glm::vec3( 1, 0, -1), glm::vec3( 1, 0, 1), glm::vec3(-1, 0, 1), White);
+		add_quad(Scene, glm::vec3(-1, 2, -1), glm::vec3( 1, 2, -1), glm::vec3( 1, 2, -0.25f), glm::vec3(-1, 2, -0.25f), White);
+		add_quad(Scene, glm::vec3(-1, 2, 0.25f), glm::vec3( 1, 2, 0.25f), glm::vec3( 1, 2, 1), glm::vec3(-1, 2, 1), White);
+		add_quad(Scene, glm::vec3(-1, 2, -0.25f), glm::vec3(-0.25f, 2, -0.25f), glm::vec3(-0.25f, 2, 0.25f), glm::vec3(-1, 2, 0.25f), White);
+		add_quad(Scene, glm::vec3(0.25f, 2, -0.25f), glm::vec3(1, 2, -0.25f), glm::vec3(1, 2, 0.25f), glm::vec3(0.25f, 2, 0.25f), White);
+		add_quad(Scene, glm::vec3(-1, 0, -1), glm::vec3( 1, 0, -1), glm::vec3( 1, 2, -1), glm::vec3(-1, 2, -1), White);
+		add_quad(Scene, glm::vec3(-1, 0, -1), glm::vec3(-1, 2, -1), glm::vec3(-1, 2, 1), glm::vec3(-1, 0, 1), Red);
+		add_quad(Scene, glm::vec3( 1, 0, -1), glm::vec3( 1, 2, -1), glm::vec3( 1, 2, 1), glm::vec3( 1, 0, 1), Green);
+		add_quad(Scene, glm::vec3(-0.25f, 2, -0.25f), glm::vec3(0.25f, 2, -0.25f), glm::vec3(0.25f, 2, 0.25f), glm::vec3(-0.25f, 2, 0.25f), Light);
+
+		// Two boxes of 12 triangles
+		for(int i = 0; i < 2; ++i)
+		{
+			glm::vec3 const Min = i == 0 ? glm::vec3(-0.7f, 0.0f, -0.6f) : glm::vec3(0.1f, 0.0f, -0.2f);
+			glm::vec3 const Max = Min + (i == 0 ? glm::vec3(0.6f, 1.2f, 0.6f) : glm::vec3(0.5f, 0.6f, 0.5f));
+			glm::vec3 Corners[8];
+			for(int c = 0; c < 8; ++c)
+				Corners[c] = glm::vec3(c & 1 ? Max.x : Min.x, c & 2 ? Max.y : Min.y, c & 4 ? Max.z : Min.z);
+			glm::uint const Indices[36] = {
+				0, 1, 3, 0, 3, 2, 4, 5, 7, 4, 7, 6, 0, 1, 5, 0, 5, 4,
+				2, 3, 7, 2, 7, 6, 0, 2, 6, 0, 6, 4, 1, 3, 7, 1, 7, 5};
+			glm::addMesh(Scene, Corners, 8, Indices, 12, White);
+		}
+		glm::buildPathScene(Scene);
+	}
+
+	glm::mat4 cornell_view()
+	{
+		return glm::lookAt(glm::vec3(0.0f, 1.0f, 3.4f), glm::vec3(0.0f, 1.0f, 0.0f), glm::vec3(0, 1, 0));
+	}
+
+	glm::path_settings settings(glm::uint Size, glm::uint Samples, glm::uint Seed)
+	{
+		glm::path_settings const Settings = {Size, Size, Samples, 8, Seed};
+		return Settings;
+	}
+
+	glm::vec3 average(std::vector<glm::vec4> const & Pixels)
+	{
+		glm::dvec3 Sum(0.0);
+		for(std::size_t i = 0; i < Pixels.size(); ++i)
+			Sum += glm::dvec3(glm::vec3(Pixels[i]));
+		return glm::vec3(Sum / static_cast<double>(Pixels.size()));
+	}
+}//namespace
+
+int test_intersection()
+{
+	int Error = 0;
+
+	glm::uint32 State = 5;
+	std::vector<glm::vec3> Positions;
+	std::vector<glm::uint> Indices;
+	for(glm::uint i = 0; i < 3000; ++i)
+	{
+		glm::vec3 const Center(random_unit(State) * 10.0f, random_unit(State) * 10.0f, random_unit(State) * 10.0f);
+		for(int v = 0; v < 3; ++v)
+		{
+			Positions.push_back(Center + glm::vec3(random_unit(State), random_unit(State), random_unit(State)) * 0.6f);
+			Indices.push_back(static_cast<glm::uint>(Indices.size()));
+		}
+	}
+
+	glm::path_scene Scene;
+	glm::uint const Material = glm::addMaterial(Scene, glm::vec3(0.5f), glm::vec3(0.0f));
+	glm::addMesh(Scene, &Positions[0], Positions.size(), &Indices[0], Indices.size() / 3, Material);
+	glm::buildPathScene(Scene);
+	Error += Scene.Vertices.size() == 3000 && Scene.Lights.empty() ? 0 : 1;
+
+	// Leaves partition the triangles, and nodes bound their triangles
+	std::vector<int> Covered(Scene.Vertices.size(), 0);
+	for(std::size_t n = 0; n < Scene.Nodes.size(); ++n)
+	{
+		glm::detail::path_node const & Node = Scene.Nodes[n];
+		for(glm::uint i = Node.Index; i < Node.Index + Node.Count; ++i)
+		{
+			++Covered[i];
+			glm::vec3 const Points[3] = {Scene.Vertices[i], Scene.Vertices[i] + Scene.Edges1[i], Scene.Vertices[i] + Scene.Edges2[i]};
+			for(int v = 0; v < 3; ++v)
+				Error += glm::all(glm::greaterThanEqual(Points[v], Node.Min - 1e-5f)) && glm::all(glm::lessThanEqual(Points[v], Node.Max + 1e-5f)) ? 0 : 1;
+		}
+	}
+	for(std::size_t i = 0; i < Covered.size(); ++i)
+		Error += Covered[i] == 1 ? 0 : 1;
+
+	// Closest hits against all triangles
+	int Hits = 0;
+	for(int r = 0; r < 2000; ++r)
+	{
+		glm::vec3 const Origin(random_unit(State) * 12.0f, random_unit(State) * 12.0f, random_unit(State) * 12.0f);
+		glm::vec3 const Direction = glm::normalize(glm::vec3(random_unit(State), random_unit(State), random_unit(State)));
+
+		float Nearest = std::numeric_limits<float>::max();
+		glm::uint NearestTriangle = ~0u;
+		for(glm::uint i = 0; i < Scene.Vertices.size(); ++i)
+		{
+			glm::vec3 const p = glm::cross(Direction, Scene.Edges2[i]);
+			float const Determinant = glm::dot(Scene.Edges1[i], p);
+			glm::vec3 const s = Origin - Scene.Vertices[i];
+			float const u = glm::dot(s, p) / Determinant;
+			glm::vec3 const q = glm::cross(s, Scene.Edges1[i]);
+			float const v = glm::dot(Direction, q) / Determinant;
+			float const t = glm::dot(Scene.Edges2[i], q) / Determinant;
+			if(u >= 0.0f && v >= 0.0f && u + v <= 1.0f && t > 0.0f && t < Nearest)
+			{
+				Nearest = t;
+				NearestTriangle = i;
+			}
+		}
+
+		float Distance = 0.0f;
+		glm::uint Triangle = 0;
+		bool const Hit = glm::intersectPathScene(Scene, Origin, Direction, Distance, Triangle);
+		Error += Hit == (NearestTriangle != ~0u) ? 0 : 1;
+		if(Hit && NearestTriangle != ~0u)
+		{
+			++Hits;
+			Error += glm::abs(Distance - Nearest) <= 1e-4f * Nearest ? 0 : 1;
+		}
+	}
+	Error += Hits > 200 ? 0 : 1;
+
+	return Error;
+}
+
+int test_sky()
+{
+	int Error = 0;
+
+	// A diffuse floor under a uniform sky reflects exactly Albedo * Background
+	glm::path_scene Scene;
+	Scene.Background = glm::vec3(1.0f, 0.5f, 0.25f);
+	glm::uint const Material = glm::addMaterial(Scene, glm::vec3(0.5f, 0.25f, 1.0f), glm::vec3(0.0f));
+	add_quad(Scene, glm::vec3(-1000, 0, -1000), glm::vec3(1000, 0, -1000), glm::vec3(1000, 0, 1000), glm::vec3(-1000, 0, 1000), Material);
+	glm::buildPathScene(Scene);
+
+	glm::mat4 const View = glm::lookAt(glm::vec3(0, 10, 0), glm::vec3(0, 0, 0), glm::vec3(0, 0, -1));
+	glm::path_settings const Settings = settings(16, 4, 1);
+	std::vector<glm::vec4> Pixels(16 * 16);
+	std::size_t const Rays = glm::renderPaths(Scene, View, glm::radians(60.0f), Settings, &Pixels[0]);
+	Error += Rays == 16 * 16 * 4 * 2 ? 0 : 1;
+	for(std::size_t i = 0; i < Pixels.size(); ++i)
+		Error += glm::all(glm::equal(Pixels[i], glm::vec4(0.5f, 0.125f, 0.25f, 1.0f))) ? 0 : 1;
+
+	// An empty scene is the background
+	glm::path_scene Empty;
+	Empty.Background = glm::vec3(0.25f);
+	glm::buildPathScene(Empty);
+	Error += glm::renderPaths(Empty, View, glm::radians(60.0f), Settings, &Pixels[0]) == 16 * 16 * 4 ? 0 : 1;
+	for(std::size_t i = 0; i < Pixels.size(); ++i)
+		Error += glm::all(glm::equal(Pixels[i], glm::vec4(0.25f, 0.25f, 0.25f, 1.0f))) ? 0 : 1;
+
+	return Error;
+}
+
+int test_furnace()
+{
+	int Error = 0;
+
+	// Inside a closed box emitting 1 with an albedo of 0.5, radiance is 1 / (1 - 0.5) everywhere
+	glm::path_scene Scene;
+	Scene.Background = glm::vec3(0.0f);
+	glm::uint const Material = glm::addMaterial(Scene, glm::vec3(0.5f), glm::vec3(1.0f));
+	glm::vec3 Corners[8];
+	for(int c = 0; c < 8; ++c)
+		Corners[c] = glm::vec3(c & 1 ? 1.0f : -1.0f, c & 2 ? 1.0f : -1.0f, c & 4 ? 1.0f : -1.0f);
+	glm::uint const Indices[36] = {
+		0, 1, 3, 0, 3, 2, 4, 5, 7, 4, 7, 6, 0, 1, 5, 0, 5, 4,
+		2, 3, 7, 2, 7, 6, 0, 2, 6, 0, 6, 4, 1, 3, 7, 1, 7, 5};
+	glm::addMesh(Scene, Corners, 8, Indices, 12, Material);
+	glm::buildPathScene(Scene);
+	Error += Scene.Lights.size() == 12 && Scene.LightCdf.back() == 1.0f ? 0 : 1;
+
+	glm::path_settings Settings = settings(32, 16, 7);
+	Settings.MaxBounces = 64;
+	std::vector<glm::vec4> Pixels(32 * 32);
+	glm::renderPaths(Scene, glm::lookAt(glm::vec3(0.2f, 0.1f, 0.3f), glm::vec3(1, 0.5f, -1), glm::vec3(0, 1, 0)), glm::radians(90.0f), Settings, &Pixels[0]);
+	glm::vec3 const Average = average(Pixels);
+	Error += glm::all(glm::lessThan(glm::abs(Average - glm::vec3(2.0f)), glm::vec3(0.04f))) ? 0 : 1;
+
+	// Without reflections only the emission remains
+	Settings.MaxBounces = 0;
+	glm::renderPaths(Scene, glm::lookAt(glm::vec3(0.2f, 0.1f, 0.3f), glm::vec3(1, 0.5f, -1), glm::vec3(0, 1, 0)), glm::radians(90.0f), Settings, &Pixels[0]);
+	for(std::size_t i = 0; i < Pixels.size(); ++i)
+		Error += glm::all(glm::equal(Pixels[i], glm::vec4(1.0f))) ? 0 : 1;
+
+	return Error;
+}
+
+int test_determinism()
+{
+	int Error = 0;
+
+	glm::path_scene Scene;
+	cornell_box(Scene);
+
+	std::size_t const Count = 40 * 40;
+	std::vector<glm::vec4> a(Count), b(Count), c(Count);
+	glm::path_settings const Settings = settings(40, 4, 3);
+	std::size_t const RaysA = glm::renderPaths(Scene, cornell_view(), glm::radians(45.0f), Settings, &a[0]);
+	std::size_t const RaysB = glm::renderPaths(Scene, cornell_view(), glm::radians(45.0f), Settings, &b[0]);
+	Error += RaysA == RaysB && RaysA > Count * 4 ? 0 : 1;
+	Error += std::memcmp(&a[0], &b[0], Count * sizeof(glm::vec4)) == 0 ? 0 : 1;
+
+	glm::renderPaths(Scene, cornell_view(), glm::radians(45.0f), settings(40, 4, 4), &c[0]);
+	Error += std::memcmp(&a[0], &c[0], Count * sizeof(glm::vec4)) != 0 ? 0 : 1;
+	Error += glm::imageError(&a[0], &b[0], Count) == 0.0f && glm::imageError(&a[0], &c[0], Count) > 0.0f ? 0 : 1;
+
+	// Radiance is finite and positive, and the light is visible at the top of the image
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::greaterThanEqual(glm::vec3(a[i]), glm::vec3(0.0f))) && glm::all(glm::lessThan(glm::vec3(a[i]), glm::vec3(1e4f))) && a[i].w == 1.0f ? 0 : 1;
+	Error += a[5 * 40 + 20].x == 12.0f && a[35 * 40 + 20].x < 12.0f ? 0 : 1;
+
+	return Error;
+}
+
+int test_texture()
+{
+	int Error = 0;
+
+	glm::path_scene Scene;
+	cornell_box(Scene);
+
+	glm::uint const Size = 40;
+	std::vector<glm::vec4> Pixels(Size * Size);
+	glm::renderPaths(Scene, cornell_view(), glm::radians(45.0f), settings(Size, 4, 3), &Pixels[0]);
+
+	// The rendered image is the level of a 2D RGBA32F texture
+	gli::texture2D Texture(1);
+	Texture[0] = gli::image2D(glm::uvec2(Size), gli::RGBA32F);
+	Error += Texture[0].capacity() == Pixels.size() * sizeof(glm::vec4) ? 0 : 1;
+	std::memcpy(Texture[0].data(), &Pixels[0], Pixels.size() * sizeof(glm::vec4));
+
+	std::vector<glm::vec4> Texels(Pixels.size());
+	std::memcpy(&Texels[0], Texture[0].data(), Texels.size() * sizeof(glm::vec4));
+	Error += glm::all(glm::equal(Texture[0].dimensions(), glm::uvec2(Size))) ? 0 : 1;
+	Error += glm::imageError(&Texels[0], &Pixels[0], Texels.size()) == 0.0f ? 0 : 1;
+
+	// First texel row is the top of the image, where the light is
+	Error += Texels[5 * Size + 20].x == 12.0f && Texels[35 * Size + 20].x < 12.0f ? 0 : 1;
+
+	return Error;
+}
+
+int test_convergence()
+{
+	int Error = 0;
+
+	glm::path_scene Scene;
+	cornell_box(Scene);
+
+	std::size_t const Count = 32 * 32;
+	std::vector<glm::vec4> Reference(Count), Low(Count), High(Count);
+	glm::renderPaths(Scene, cornell_view(), glm::radians(45.0f), settings(32, 256, 11), &Reference[0]);
+	glm::renderPaths(Scene, cornell_view(), glm::radians(45.0f), settings(32, 16, 12), &Low[0]);
+	glm::renderPaths(Scene, cornell_view(), glm::radians(45.0f), settings(32, 64, 13), &High[0]);
+
+	// Noise decreases with the square root of the number of samples
+	float const ErrorLow = glm::imageError(&Low[0], &Reference[0], Count);
+	float const ErrorHigh = glm::imageError(&High[0], &Reference[0], Count);
+	Error += ErrorHigh < ErrorLow * 0.75f ? 0 : 1;
+
+	return Error;
+}
+
+int perf_path_tracer()
+{
+	int Error = 0;
+
+	glm::path_scene Scene;
+	cornell_box(Scene);
+
+	glm::uint const Size = 128;
+	std::vector<glm::vec4> Pixels(Size * Size);
+	double const Start = seconds();
+	std::size_t const Rays = glm::renderPaths(Scene, cornell_view(), glm::radians(45.0f), settings(Size, 16, 1), &Pixels[0]);
+	double const Time = seconds() - Start;
+
+	std::printf("Path tracing of a %dx%d Cornell box at 16 samples per pixel: %.2f Mrays/s of processor time, %d rays\n",
+		static_cast<int>(Size), static_cast<int>(Size), static_cast<double>(Rays) / (Time > 0.0 ? Time : 1e-6) * 1e-6, static_cast<int>(Rays));
+	Error += Rays > Size * Size * 16 ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_intersection();
+	Error += test_sky();
+	Error += test_furnace();
+	Error += test_determinism();
+	Error += test_texture();
+	Error += test_convergence();
+	Error += perf_path_tracer();
+
+	return Error;
+}
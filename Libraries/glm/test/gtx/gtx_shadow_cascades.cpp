@@ -0,0 +1,317 @@
+#include <glm/gtx/shadow_cascades.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/gtx/component_wise.hpp>
+#include <vector>
+#include <cmath>
+#include <ctime>
+#include <cstdio>
+
+namespace
+{
+	// Deterministic pseudo random numbers in [-1, 1]
+	float random_unit(glm::uint32 & State)
+	{
+		State = State * 1664525u + 1013904223u;
+		return static_cast<float>(static_cast<double>(State) / 2147483647.5 - 1.0);
+	}
+
+	float const Fovy = glm::radians(60.0f);
+	float const Aspect = 16.0f / 9.0f;
+	float const Near = 0.1f;
+	float const Far = 200.0f;
+	glm::vec3 const Light(0.3f,-0.8f, 0.2f);
+
+	glm::mat4 camera(glm::vec3 const & Eye, float Yaw, float Pitch)
+	{
+		glm::vec3 const Forward(std::cos(Pitch) * std::sin(Yaw), std::sin(Pitch),-std::cos(Pitch) * std::cos(Yaw));
+		return glm::lookAt(Eye, Eye + Forward, glm::vec3(0, 1, 0));
+	}
+
+	// World space corner of the frustum at depth Depth, in double precision
+	glm::dvec3 corner(glm::mat4 const & View, float Depth, float x, float y)
+	{
+		glm::mat4 const World = glm::inverse(View);
+		double const TanY = std::tan(static_cast<double>(Fovy) * 0.5);
+		double const p[3] = {x * Depth * TanY * Aspect, y * Depth * TanY,-static_cast<double>(Depth)};
+		double r[3];
+		for(glm::length_t i = 0; i < 3; ++i)
+			r[i] = static_cast<double>(World[0][i]) * p[0] + static_cast<double>(World[1][i]) * p[1] + static_cast<double>(World[2][i]) * p[2] + static_cast<double>(World[3][i]);
+		return glm::dvec3(r[0], r[1], r[2]);
+	}
+
+	glm::dvec3 transform(glm::mat4 const & m, glm::dvec3 const & p)
+	{
+		double r[3];
+		for(glm::length_t i = 0; i < 3; ++i)
+			r[i] = static_cast<double>(m[0][i]) * p.x + static_cast<double>(m[1][i]) * p.y + static_cast<double>(m[2][i]) * p.z + static_cast<double>(m[3][i]);
+		return glm::dvec3(r[0], r[1], r[2]);
+	}
+
+	double seconds()
+	{
+		return static_cast<double>(std::clock()) / static_cast<double>(CLOCKS_PER_SEC);
+	}
+}//namespace
+
+int test_splits()
+{
+	int Error = 0;
+
+	float Splits[5];
+	glm::cascadeSplits(1.0f, 1000.0f, 0.0f, 4, Splits);
+	Error += Splits[0] == 1.0f && glm::abs(Splits[1] - 250.75f) < 1e-3f && glm::abs(Splits[2] - 500.5f) < 1e-3f && Splits[4] == 1000.0f ? 0 : 1;
+
+	glm::cascadeSplits(1.0f, 1000.0f, 1.0f, 3, Splits);
+	Error += Splits[0] == 1.0f && glm::abs(Splits[1] - 10.0f) < 1e-4f && glm::abs(Splits[2] - 100.0f) < 1e-3f && Splits[3] == 1000.0f ? 0 : 1;
+
+	glm::cascadeSplits(0.1f, 500.0f, 0.5f, 4, Splits);
+	for(std::size_t i = 0; i < 4; ++i)
+		Error += Splits[i] < Splits[i + 1] ? 0 : 1;
+	float Uniform[5], Logarithmic[5];
+	glm::cascadeSplits(0.1f, 500.0f, 0.0f, 4, Uniform);
+	glm::cascadeSplits(0.1f, 500.0f, 1.0f, 4, Logarithmic);
+	for(std::size_t i = 1; i < 4; ++i)
+		Error += glm::abs(Splits[i] - (Uniform[i] + Logarithmic[i]) * 0.5f) < 1e-3f ? 0 : 1;
+
+	return Error;
+}
+
+// Every corner of the slice of each cascade is within its light space box
+int test_fit()
+{
+	int Error = 0;
+
+	glm::uint32 State = 3u;
+	for(int Stable = 0; Stable < 2; ++Stable)
+	for(int Camera = 0; Camera < 20; ++Camera)
+	{
+		glm::shadow_cascades Cascades(4, 2048, 0.75f, Stable != 0);
+		Cascades.CasterDistance = 50.0f;
+		glm::mat4 const View = camera(glm::vec3(random_unit(State), random_unit(State), random_unit(State)) * 100.0f, random_unit(State) * 3.0f, random_unit(State) * 1.2f);
+		glm::fitCascades(Cascades, View, Fovy, Aspect, Near, Far, Light);
+
+		for(std::size_t c = 0; c < Cascades.Count; ++c)
+		{
+			glm::dvec3 Lower(1e30), Upper(-1e30);
+			for(int k = 0; k < 8; ++k)
+			{
+				glm::dvec3 const p = transform(Cascades.LightView, corner(View, Cascades.Splits[c + (k >> 2)], k & 1 ? 1.0f : -1.0f, k & 2 ? 1.0f : -1.0f));
+				Lower = glm::min(Lower, p);
+				Upper = glm::max(Upper, p);
+			}
+			double const Tolerance = 1e-4 * glm::compMax(Upper - Lower);
+			Error += glm::all(glm::lessThanEqual(glm::dvec3(Cascades.Mins[c]), Lower + Tolerance)) ? 0 : 1;
+			Error += glm::all(glm::lessThanEqual(Upper - Tolerance, glm::dvec3(Cascades.Maxs[c]))) ? 0 : 1;
+
+			// Boxes are tight without stabilization, and the squares of bounding spheres are not much larger
+			glm::dvec3 const Size = glm::dvec3(Cascades.Maxs[c] - Cascades.Mins[c]);
+			if(Stable)
+				Error += glm::abs(Size.x - Size.y) < Size.x * 1e-6 && Size.x < glm::length(Upper - Lower) * 1.01 ? 0 : 1;
+			else
+				Error += glm::all(glm::lessThan(glm::abs(glm::dvec3(Cascades.Mins[c]) - Lower), glm::dvec3(Tolerance))) ? 0 : 1;
+
+			// Light space boxes map to the clip volume, casters included up to CasterDistance
+			glm::vec4 const Lowest = Cascades.Projections[c] * glm::vec4(Cascades.Mins[c], 1.0f);
+			glm::vec4 const Highest = Cascades.Projections[c] * glm::vec4(glm::vec2(Cascades.Maxs[c]), Cascades.Maxs[c].z + Cascades.CasterDistance, 1.0f);
+			Error += glm::all(glm::epsilonEqual(glm::vec2(Lowest), glm::vec2(-1.0f), 1e-4f)) && glm::abs(Lowest.z - 1.0f) < 1e-4f ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(glm::vec2(Highest), glm::vec2(1.0f), 1e-4f)) && Highest.z < Lowest.z ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+// Small camera moves keep the size of stable cascades and move them by whole texels
+int test_stability()
+{
+	int Error = 0;
+
+	glm::shadow_cascades Reference(4, 1024);
+	glm::mat4 const View = camera(glm::vec3(10, 2, 30), 0.3f, -0.1f);
+	glm::fitCascades(Reference, View, Fovy, Aspect, Near, Far, Light);
+
+	glm::vec4 const Point(3.0f, 0.5f,-12.0f, 1.0f);
+	for(int Frame = 1; Frame < 100; ++Frame)
+	{
+		glm::shadow_cascades Cascades(4, 1024);
+		float const Move = static_cast<float>(Frame) * 0.0137f;
+		glm::fitCascades(Cascades, camera(glm::vec3(10.0f + Move, 2.0f + Move * 0.3f, 30.0f - Move), 0.3f + Move * 0.05f, -0.1f + Move * 0.01f), Fovy, Aspect, Near, Far, Light);
+
+		for(std::size_t c = 0; c < Cascades.Count; ++c)
+		{
+			glm::mat4 const & m = Cascades.ViewProjections[c];
+			glm::mat4 const & r = Reference.ViewProjections[c];
+			Error += glm::abs(m[0][0] / r[0][0] - 1.0f) < 1e-6f && glm::abs(m[1][1] / r[1][1] - 1.0f) < 1e-6f ? 0 : 1;
+
+			// Offset of the shadow map in texels
+			glm::vec2 const Texels = (glm::vec2(m * Point) - glm::vec2(r * Point)) * 0.5f * static_cast<float>(Cascades.Resolution);
+			Error += glm::all(glm::lessThan(glm::abs(Texels - glm::round(Texels)), glm::vec2(0.01f))) ? 0 : 1;
+		}
+	}
+
+	// Without stabilization, rotations change the size of the cascades
+	glm::shadow_cascades Tight(4, 1024, 0.75f, false), Rotated(4, 1024, 0.75f, false);
+	glm::fitCascades(Tight, View, Fovy, Aspect, Near, Far, Light);
+	glm::fitCascades(Rotated, camera(glm::vec3(10, 2, 30), 0.31f, -0.1f), Fovy, Aspect, Near, Far, Light);
+	Error += Tight.Projections[0][0][0] != Rotated.Projections[0][0][0] ? 0 : 1;
+
+	return Error;
+}
+
+int test_casters()
+{
+	int Error = 0;
+
+	glm::shadow_cascades Cascades(5, 2048, 0.6f, true);
+	Cascades.CasterDistance = 30.0f;
+	glm::mat4 const View = camera(glm::vec3(0, 5, 0), 0.7f, -0.2f);
+	glm::fitCascades(Cascades, View, Fovy, Aspect, Near, Far, Light);
+
+	glm::uint32 State = 19u;
+	glm::shadow_casters Casters;
+	std::size_t const Count = 5003;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec3 const Center(random_unit(State) * 250.0f, random_unit(State) * 40.0f, random_unit(State) * 250.0f);
+		glm::vec3 const Extent = (glm::vec3(random_unit(State), random_unit(State), random_unit(State)) + 1.1f) * 3.0f;
+		Error += glm::addCaster(Casters, Center - Extent, Center + Extent) == i ? 0 : 1;
+	}
+
+	std::vector<glm::uint> Masks(Count, 0xdeadbeef);
+	glm::cullCasters(Cascades, Casters, &Masks[0]);
+
+	// Light space boxes of the casters in double precision, away from the boundaries of the cascades
+	std::size_t Selected = 0, Checked = 0;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::dvec3 Lower(1e30), Upper(-1e30);
+		for(int k = 0; k < 8; ++k)
+		{
+			glm::dvec3 const p(k & 1 ? Casters.MaxX[i] : Casters.MinX[i], k & 2 ? Casters.MaxY[i] : Casters.MinY[i], k & 4 ? Casters.MaxZ[i] : Casters.MinZ[i]);
+			glm::dvec3 const q = transform(Cascades.LightView, p);
+			Lower = glm::min(Lower, q);
+			Upper = glm::max(Upper, q);
+		}
+
+		Error += Masks[i] >> Cascades.Count == 0 ? 0 : 1;
+		for(std::size_t c = 0; c < Cascades.Count; ++c)
+		{
+			glm::dvec3 const Min(Cascades.Mins[c]);
+			glm::dvec3 const Max(glm::vec2(Cascades.Maxs[c]), Cascades.Maxs[c].z + Cascades.CasterDistance);
+			glm::dvec3 const Gaps = glm::min(glm::abs(Upper - Min), glm::abs(Max - Lower));
+			if(glm::compMin(Gaps) < 1e-2)
+				continue;
+			bool const Overlap = glm::all(glm::greaterThanEqual(Upper, Min)) && glm::all(glm::lessThanEqual(Lower, Max));
+			Error += ((Masks[i] >> c) & 1u) == (Overlap ? 1u : 0u) ? 0 : 1;
+			Selected += Overlap ? 1 : 0;
+			++Checked;
+		}
+	}
+	Error += Selected > 0 && Selected < Checked ? 0 : 1;
+
+	return Error;
+}
+
+int perf_shadow_cascades()
+{
+	int Error = 0;
+
+	std::size_t const CascadeCount = 4;
+	glm::uint32 State = 31u;
+	glm::shadow_casters Casters;
+	std::size_t const Count = 1 << 14;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec3 const Center(random_unit(State) * 250.0f, random_unit(State) * 20.0f, random_unit(State) * 250.0f);
+		glm::vec3 const Extent = (glm::vec3(random_unit(State), random_unit(State), random_unit(State)) + 1.1f) * 2.0f;
+		glm::addCaster(Casters, Center - Extent, Center + Extent);
+	}
+	std::vector<glm::uint> Masks(Count);
+
+	int const Frames = 200;
+	glm::uint Sum = 0;
+
+	// Eight corners of each cascade from the inverse of its projection, eight corners of each caster per cascade
+	glm::mat4 const LightView = glm::lookAt(glm::vec3(0), glm::normalize(Light), glm::vec3(0, 1, 0));
+	double const StartNaive = seconds();
+	for(int Frame = 0; Frame < Frames; ++Frame)
+	{
+		glm::mat4 const View = camera(glm::vec3(static_cast<float>(Frame) * 0.1f, 5.0f, 0.0f), 0.7f, -0.2f);
+		float Splits[CascadeCount + 1];
+		glm::cascadeSplits(Near, Far, 0.75f, CascadeCount, Splits);
+		glm::mat4 ViewProjections[CascadeCount];
+		for(std::size_t c = 0; c < CascadeCount; ++c)
+		{
+			glm::mat4 const Inverse = glm::inverse(glm::perspective(Fovy, Aspect, Splits[c], Splits[c + 1]) * View);
+			glm::vec3 Min(1e30f), Max(-1e30f);
+			for(int k = 0; k < 8; ++k)
+			{
+				glm::vec4 const p = Inverse * glm::vec4(k & 1 ? 1.0f : -1.0f, k & 2 ? 1.0f : -1.0f, k & 4 ? 1.0f : -1.0f, 1.0f);
+				glm::vec3 const q(LightView * (p / p.w));
+				Min = glm::min(Min, q);
+				Max = glm::max(Max, q);
+			}
+			ViewProjections[c] = glm::ortho(Min.x, Max.x, Min.y, Max.y, -Max.z, -Min.z) * LightView;
+		}
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::uint Mask = 0;
+			for(std::size_t c = 0; c < CascadeCount; ++c)
+			{
+				glm::vec3 Min(1e30f), Max(-1e30f);
+				for(int k = 0; k < 8; ++k)
+				{
+					glm::vec3 const p(ViewProjections[c] * glm::vec4(k & 1 ? Casters.MaxX[i] : Casters.MinX[i], k & 2 ? Casters.MaxY[i] : Casters.MinY[i], k & 4 ? Casters.MaxZ[i] : Casters.MinZ[i], 1.0f));
+					Min = glm::min(Min, p);
+					Max = glm::max(Max, p);
+				}
+				if(glm::all(glm::lessThanEqual(Min, glm::vec3(1))) && glm::all(glm::greaterThanEqual(Max, glm::vec3(-1))))
+					Mask |= 1u << c;
+			}
+			Masks[i] = Mask;
+		}
+		Sum += Masks[Count - 1];
+	}
+	double const TimeNaive = seconds() - StartNaive;
+
+	glm::shadow_cascades Cascades(CascadeCount, 2048);
+	double const StartFit = seconds();
+	for(int Frame = 0; Frame < Frames; ++Frame)
+	{
+		glm::mat4 const View = camera(glm::vec3(static_cast<float>(Frame) * 0.1f, 5.0f, 0.0f), 0.7f, -0.2f);
+		glm::fitCascades(Cascades, View, Fovy, Aspect, Near, Far, Light);
+		Sum += static_cast<glm::uint>(Cascades.Maxs[0].x);
+	}
+	double const TimeFit = seconds() - StartFit;
+
+	double const StartCull = seconds();
+	for(int Frame = 0; Frame < Frames; ++Frame)
+	{
+		glm::cullCasters(Cascades, Casters, &Masks[0]);
+		Sum += Masks[Count - 1];
+	}
+	double const TimeCull = seconds() - StartCull;
+
+	double const Scale = 1e6 / static_cast<double>(Frames);
+	std::printf("Naive eight corner fit and culling of %d casters: %.1f us/frame\n", static_cast<int>(Count), TimeNaive * Scale);
+	std::printf("fitCascades: %.2f us/frame, cullCasters: %.1f us/frame\n", TimeFit * Scale, TimeCull * Scale);
+
+	Error += Sum != 0 ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_splits();
+	Error += test_fit();
+	Error += test_stability();
+	Error += test_casters();
+	Error += perf_shadow_cascades();
+
+	return Error;
+}
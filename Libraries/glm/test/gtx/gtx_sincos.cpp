@@ -0,0 +1,127 @@
+#include <glm/gtx/sincos.hpp>
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/ulp.hpp>
+#include <vector>
+#include <ctime>
+#include <cstdio>
+
+namespace scalar
+{
+	int test()
+	{
+		int Error = 0;
+
+		float s, c;
+		glm::sincos(glm::pi<float>() * 0.5f, s, c);
+		Error += glm::epsilonEqual(s, 1.0f, 0.00001f) ? 0 : 1;
+		Error += glm::epsilonEqual(c, 0.0f, 0.00001f) ? 0 : 1;
+
+		double sd, cd;
+		glm::sincos(glm::pi<double>(), sd, cd);
+		Error += glm::epsilonEqual(sd, 0.0, 0.0000001) ? 0 : 1;
+		Error += glm::epsilonEqual(cd, -1.0, 0.0000001) ? 0 : 1;
+
+		return Error;
+	}
+}//namespace scalar
+
+namespace vector
+{
+	int test()
+	{
+		int Error = 0;
+
+		glm::vec3 const Angles(0.1f, -2.5f, 4.0f);
+		glm::vec3 s, c;
+		glm::sincos(Angles, s, c);
+		Error += glm::all(glm::epsilonEqual(s, glm::sin(Angles), 0.000001f)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(c, glm::cos(Angles), 0.000001f)) ? 0 : 1;
+
+		glm::dvec4 const AnglesD(0.1, -2.5, 4.0, 100.0);
+		glm::dvec4 sd, cd;
+		glm::sincos(AnglesD, sd, cd);
+		Error += glm::all(glm::epsilonEqual(sd, glm::sin(AnglesD), 0.0000001)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(cd, glm::cos(AnglesD), 0.0000001)) ? 0 : 1;
+
+		return Error;
+	}
+}//namespace vector
+
+namespace accuracy
+{
+	// Compare against the C library over [-8192, 8192] and out of the SIMD range reduction domain
+	int test()
+	{
+		int Error = 0;
+
+		std::size_t const Count = 100003;
+		std::vector<float> Angles(Count), s(Count), c(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Angles[i] = -8192.0f + 16384.0f * static_cast<float>(i) / static_cast<float>(Count - 1);
+		Angles[17] = 1e6f;
+		Angles[18] = -3e7f;
+
+		glm::sincos(&Angles[0], &s[0], &c[0], Count);
+
+		glm::uint MaxUlp = 0;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float const RefS = static_cast<float>(std::sin(static_cast<double>(Angles[i])));
+			float const RefC = static_cast<float>(std::cos(static_cast<double>(Angles[i])));
+
+			// Absolute error for values close to zero, ULP distance otherwise
+			if(glm::abs(RefS) > 0.01f)
+				MaxUlp = glm::max(MaxUlp, glm::float_distance(s[i], RefS));
+			else
+				Error += glm::abs(s[i] - RefS) < 0.000001f ? 0 : 1;
+			if(glm::abs(RefC) > 0.01f)
+				MaxUlp = glm::max(MaxUlp, glm::float_distance(c[i], RefC));
+			else
+				Error += glm::abs(c[i] - RefC) < 0.000001f ? 0 : 1;
+		}
+
+		std::printf("sincos max error: %u ULP\n", MaxUlp);
+		Error += MaxUlp <= 4u ? 0 : 1;
+
+		return Error;
+	}
+}//namespace accuracy
+
+namespace perf
+{
+	int test()
+	{
+		std::size_t const Count = 1 << 20;
+		std::vector<float> Angles(Count), s(Count), c(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Angles[i] = static_cast<float>(i) * 0.001f;
+
+		std::clock_t const Timestamp0 = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			s[i] = glm::sin(Angles[i]);
+			c[i] = glm::cos(Angles[i]);
+		}
+		std::clock_t const Timestamp1 = std::clock();
+		glm::sincos(&Angles[0], &s[0], &c[0], Count);
+		std::clock_t const Timestamp2 = std::clock();
+
+		std::printf("sin + cos: %d clocks\n", static_cast<int>(Timestamp1 - Timestamp0));
+		std::printf("sincos batch: %d clocks\n", static_cast<int>(Timestamp2 - Timestamp1));
+
+		return s[Count / 2] + c[Count / 2] > 2.0f ? 1 : 0;
+	}
+}//namespace perf
+
+int main()
+{
+	int Error = 0;
+
+	Error += scalar::test();
+	Error += vector::test();
+	Error += accuracy::test();
+	Error += perf::test();
+
+	return Error;
+}
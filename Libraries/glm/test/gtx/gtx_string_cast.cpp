@@ -1,6 +1,14 @@
 #include <glm/glm.hpp>
 #include <glm/gtx/string_cast.hpp>
+#include <glm/gtx/io.hpp>
 #include <limits>
+#include <vector>
+#include <sstream>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <cstdio>
+#include <cmath>
 
 int test_string_cast_vector()
 {
@@ -116,11 +124,336 @@ int test_string_cast_matrix()
 	return Error;
 }
 
+namespace
+{
+	template <typename genType>
+	std::string chars(genType const & x)
+	{
+		char Buffer[1024];
+		char * End = glm::to_chars(Buffer, Buffer + sizeof(Buffer), x);
+		return End ? std::string(Buffer, End) : std::string("null");
+	}
+}//namespace
+
+int test_to_chars()
+{
+	int Error = 0;
+
+	Error += chars(glm::vec3(1.0f, 2.5f, -0.1f)) == "vec3(1, 2.5, -0.1)" ? 0 : 1;
+	Error += chars(glm::dvec2(0.1, 1e300)) == "dvec2(0.1, 1e+300)" ? 0 : 1;
+	Error += chars(glm::ivec2(-2147483647 - 1, 7)) == "ivec2(-2147483648, 7)" ? 0 : 1;
+	Error += chars(glm::u8vec4(0, 1, 128, 255)) == "u8vec4(0, 1, 128, 255)" ? 0 : 1;
+	Error += chars(glm::bvec2(false, true)) == "bvec2(false, true)" ? 0 : 1;
+	Error += chars(glm::mat2x3(1, 2, 3, 4, 5, 6)) == "mat2x3((1, 2, 3), (4, 5, 6))" ? 0 : 1;
+	Error += chars(glm::quat(1, 0, 0, 0)) == "quat(0, 0, 0, 1)" ? 0 : 1;
+	Error += chars(glm::dualquat(glm::quat(1, 0, 0, 0), glm::vec3(2, 0, 0))) == "dualquat((0, 0, 0, 1), (1, 0, 0, -0))" ? 0 : 1;
+
+	// Shortest of fixed and scientific notations
+	Error += chars(1e7f) == "1e+07" ? 0 : 1;
+	Error += chars(1234567.0f) == "1234567" ? 0 : 1;
+	Error += chars(1e8f) == "1e+08" ? 0 : 1;
+	Error += chars(1.5e-5f) == "1.5e-05" ? 0 : 1;
+	Error += chars(0.001f) == "0.001" ? 0 : 1;
+	Error += chars(123456.7f) == "123456.7" ? 0 : 1;
+	Error += chars(3.4028235e38f) == "3.4028235e+38" ? 0 : 1;
+	Error += chars(1e-45f) == "1e-45" ? 0 : 1;
+	Error += chars(5e-324) == "5e-324" ? 0 : 1;
+	Error += chars(0.3) == "0.3" ? 0 : 1;
+	Error += chars(16777216.0f) == "16777216" ? 0 : 1;
+
+	// Powers of two, whose shortest decimal may be above the 16 digits rounding
+	Error += chars(std::ldexp(1.0, -1017)) == "7.120236347223045e-307" ? 0 : 1;
+	Error += chars(std::ldexp(1.0, -1007)) == "7.291122019556398e-304" ? 0 : 1;
+	Error += chars(std::ldexp(1.0, -957)) == "8.209073602596753e-289" ? 0 : 1;
+	Error += chars(std::ldexp(1.0, -921)) == "5.641232424577593e-278" ? 0 : 1;
+	Error += chars(std::ldexp(1.0, -808)) == "5.858190679279809e-244" ? 0 : 1;
+	Error += chars(std::ldexp(1.0, -705)) == "5.940911144672375e-213" ? 0 : 1;
+
+	// Special values
+	Error += chars(glm::vec4(0.0f, -0.0f, std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity())) == "vec4(0, -0, inf, -inf)" ? 0 : 1;
+	Error += chars(std::numeric_limits<double>::quiet_NaN()) == "nan" ? 0 : 1;
+
+	// Buffers too small
+	char Buffer[32];
+	Error += glm::to_chars(Buffer, Buffer + 17, glm::vec3(1.0f, 2.5f, -0.1f)) == 0 ? 0 : 1;
+	Error += glm::to_chars(Buffer, Buffer + 18, glm::vec3(1.0f, 2.5f, -0.1f)) == Buffer + 18 ? 0 : 1;
+	Error += glm::to_chars(Buffer, Buffer + 3, 1.25f) == 0 ? 0 : 1;
+
+	return Error;
+}
+
+// Floats read back to the same values
+int test_to_chars_round_trip()
+{
+	int Error = 0;
+
+	char Buffer[64];
+	for(glm::uint32 i = 0; i < 1000000; ++i)
+	{
+		glm::uint32 const Bits = i * 4294u + (i >> 3);
+		float Value = 0.0f;
+		std::memcpy(&Value, &Bits, sizeof(Value));
+		if(glm::isnan(Value) || glm::isinf(Value))
+			continue;
+
+		char * End = glm::to_chars(Buffer, Buffer + sizeof(Buffer) - 1, Value);
+		*End = 0;
+		Error += static_cast<float>(std::strtod(Buffer, 0)) == Value ? 0 : 1;
+
+		double const Double = static_cast<double>(Value) * 1.0000001;
+		End = glm::to_chars(Buffer, Buffer + sizeof(Buffer) - 1, Double);
+		*End = 0;
+		Error += std::strtod(Buffer, 0) == Double ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int perf_to_chars()
+{
+	int Error = 0;
+
+	std::size_t const Count = 100000;
+	std::vector<glm::mat4> Matrices(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	for(glm::length_t j = 0; j < 16; ++j)
+		Matrices[i][j / 4][j % 4] = static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX) * 200.0f - 100.0f;
+
+	std::size_t Size = 0;
+	std::clock_t const Timestamp0 = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Size += glm::to_string(Matrices[i]).size();
+	std::clock_t const Timestamp1 = std::clock();
+	{
+		std::ostringstream Stream;
+		for(std::size_t i = 0; i < Count; ++i)
+			Stream << Matrices[i];
+		Size += Stream.str().size();
+	}
+	std::clock_t const Timestamp2 = std::clock();
+	std::vector<char> Buffer(Count * 512);
+	char * End = &Buffer[0];
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		End = glm::to_chars(End, &Buffer[0] + Buffer.size(), Matrices[i]);
+		*End++ = '\n';
+	}
+	std::clock_t const Timestamp3 = std::clock();
+
+	Error += Size > 0 ? 0 : 1;
+
+	double const Scale = 1e9 / static_cast<double>(CLOCKS_PER_SEC) / static_cast<double>(Count);
+	std::printf("mat4 text: to_string %.0f ns, operator<< %.0f ns, to_chars %.0f ns, %.1f bytes per matrix\n",
+		static_cast<double>(Timestamp1 - Timestamp0) * Scale,
+		static_cast<double>(Timestamp2 - Timestamp1) * Scale,
+		static_cast<double>(Timestamp3 - Timestamp2) * Scale,
+		static_cast<double>(End - &Buffer[0]) / static_cast<double>(Count));
+
+	return Error;
+}
+
+namespace
+{
+	template <typename genType>
+	bool parse(char const * Text, genType & x)
+	{
+		char const * Last = Text + std::strlen(Text);
+		return glm::from_chars(Text, Last, x) == Last;
+	}
+}//namespace
+
+int test_from_chars()
+{
+	int Error = 0;
+
+	glm::vec3 v3(0.0f);
+	Error += parse("vec3(1, 2.5, -0.1)", v3) && v3 == glm::vec3(1.0f, 2.5f, -0.1f) ? 0 : 1;
+	Error += parse(glm::to_string(glm::vec3(3.0f, -1.5f, 1e-3f)).c_str(), v3) && v3 == glm::vec3(3.0f, -1.5f, 1e-3f) ? 0 : 1;
+	Error += parse("  7 8\t9", v3) && v3 == glm::vec3(7.0f, 8.0f, 9.0f) ? 0 : 1;
+	Error += parse("(4,5,6)", v3) && v3 == glm::vec3(4.0f, 5.0f, 6.0f) ? 0 : 1;
+
+	glm::dvec2 d2(0.0);
+	Error += parse("dvec2(0.1, 1e+300)", d2) && d2 == glm::dvec2(0.1, 1e300) ? 0 : 1;
+
+	glm::ivec2 i2(0);
+	Error += parse("ivec2(-2147483648, 7)", i2) && i2 == glm::ivec2(-2147483647 - 1, 7) ? 0 : 1;
+
+	glm::bvec2 b2(false);
+	Error += parse("bvec2(true, false)", b2) && b2 == glm::bvec2(true, false) ? 0 : 1;
+
+	glm::mat2x3 m23(0.0f);
+	Error += parse("mat2x3((1, 2, 3), (4, 5, 6))", m23) && m23 == glm::mat2x3(1, 2, 3, 4, 5, 6) ? 0 : 1;
+
+	glm::quat q(0.0f, 0.0f, 0.0f, 0.0f);
+	Error += parse("quat(0, 0, 0, 1)", q) && q == glm::quat(1.0f, 0.0f, 0.0f, 0.0f) ? 0 : 1;
+
+	glm::dualquat dq;
+	Error += parse("dualquat((0, 0, 0, 1), (1, 0, 0, -0))", dq) && dq.real == glm::quat(1, 0, 0, 0) && dq.dual == glm::quat(0, 1, 0, 0) ? 0 : 1;
+
+	// Special values
+	glm::vec4 v4(0.0f);
+	Error += parse("vec4(-0, inf, -Infinity, nan)", v4) && v4.x == 0.0f && 1.0f / v4.x < 0.0f && glm::isinf(v4.y) && v4.z < 0.0f && glm::isinf(v4.z) && glm::isnan(v4.w) ? 0 : 1;
+
+	// Streams of several vectors
+	char const * Text = "1 2 3\n4 5 6\n";
+	char const * Last = Text + std::strlen(Text);
+	Text = glm::from_chars(Text, Last, v3);
+	Error += v3 == glm::vec3(1, 2, 3) ? 0 : 1;
+	Text = glm::from_chars(Text, Last, v3);
+	Error += v3 == glm::vec3(4, 5, 6) ? 0 : 1;
+	Error += glm::from_chars(Text, Last, v3) == 0 ? 0 : 1;
+
+	// Invalid texts leave the value unchanged
+	glm::vec3 const Before = v3;
+	Error += glm::from_chars(Text, Text, v3) == 0 ? 0 : 1;
+	Error += !parse("vec3(1, 2)", v3) && !parse("vec3(1, 2, 3", v3) && !parse("vec3(1, x, 3)", v3) && v3 == Before ? 0 : 1;
+	glm::u8vec2 u8(0);
+	Error += !parse("256 1", u8) && !parse("-1 1", u8) && u8 == glm::u8vec2(0) ? 0 : 1;
+
+	// Correct rounding of halfway cases and of long decimals
+	float f = 0.0f;
+	Error += parse("16777217", f) && f == 16777216.0f ? 0 : 1;
+	Error += parse("16777219", f) && f == 16777220.0f ? 0 : 1;
+#	if GLM_HAS_CXX11_STL
+		Error += parse("1.00000005960464477539062500000001", f) && f == 1.00000012f ? 0 : 1;
+#	endif
+	Error += parse("7.00649232162408e-46", f) && f == 0.0f ? 0 : 1;
+	Error += parse("7.0064923216240854e-46", f) && f == 1e-45f ? 0 : 1;
+	Error += parse("3.40282356e38", f) && f == 3.4028235e38f ? 0 : 1;
+	Error += parse("3.4028236e38", f) && glm::isinf(f) ? 0 : 1;
+	double d = 0.0;
+	Error += parse("2.2250738585072011e-308", d) && d == 2.2250738585072011e-308 ? 0 : 1;
+	Error += parse("9007199254740993", d) && d == 9007199254740992.0 ? 0 : 1;
+
+	return Error;
+}
+
+// Texts of to_chars, printf and random digits read back as strtof and strtod
+int test_from_chars_round_trip()
+{
+	int Error = 0;
+
+	char Buffer[64];
+	for(glm::uint32 i = 0; i < 1000000; ++i)
+	{
+		glm::uint32 const Bits = i * 4294u + (i >> 3);
+		float Value = 0.0f;
+		std::memcpy(&Value, &Bits, sizeof(Value));
+		if(glm::isnan(Value))
+			continue;
+
+		char const * End = glm::to_chars(Buffer, Buffer + sizeof(Buffer), Value);
+		float Read = 0.0f;
+		Error += glm::from_chars(Buffer, End, Read) == End && std::memcmp(&Read, &Value, sizeof(Read)) == 0 ? 0 : 1;
+
+		int const Length = std::sprintf(Buffer, "%.8e", static_cast<double>(Value) * 1.0000001);
+		double ReadDouble = 0.0;
+		Error += glm::from_chars(Buffer, Buffer + Length, ReadDouble) == Buffer + Length && ReadDouble == std::strtod(Buffer, 0) ? 0 : 1;
+	}
+
+	for(int i = 0; i < 1000000; ++i)
+	{
+		int Length = 0;
+		int const Digits = 1 + std::rand() % 24;
+		for(int j = 0; j < Digits; ++j)
+			Buffer[Length++] = static_cast<char>('0' + std::rand() % 10);
+		Length += std::sprintf(Buffer + Length, "e%d", std::rand() % 120 - 80);
+
+		float Read = 0.0f;
+		glm::from_chars(Buffer, Buffer + Length, Read);
+		Error += Read == static_cast<float>(std::strtod(Buffer, 0)) || Digits > 9 ? 0 : 1;
+		double ReadDouble = 0.0;
+		glm::from_chars(Buffer, Buffer + Length, ReadDouble);
+		Error += ReadDouble == std::strtod(Buffer, 0) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int test_from_chars_soa()
+{
+	int Error = 0;
+
+	char const * Text = "v 1 2 3";
+	// Arrays hold the largest capacity read below
+	float x[8] = {0.0f};
+	float y[8] = {0.0f};
+	float * const Arrays[] = {x, y};
+	Error += glm::from_chars(Text, Text + std::strlen(Text), Arrays, 2, 3) == 0 ? 0 : 1;
+
+	Text = "1 2\n3, 4\n  5 6\n7";
+	Error += glm::from_chars(Text, Text + std::strlen(Text), Arrays, 2, 3) == 3 ? 0 : 1;
+	Error += x[0] == 1.0f && y[0] == 2.0f && x[1] == 3.0f && y[1] == 4.0f && x[2] == 5.0f && y[2] == 6.0f ? 0 : 1;
+	Error += glm::from_chars(Text, Text + std::strlen(Text), Arrays, 2, 8) == 3 ? 0 : 1;
+
+	return Error;
+}
+
+// Throughput of std::istringstream, strtof and from_chars reading lines of three floats
+int perf_from_chars()
+{
+	int Error = 0;
+
+	std::size_t const Count = 1000000;
+	std::vector<char> Buffer(Count * 3 * 16);
+	char * End = &Buffer[0];
+	for(std::size_t i = 0; i < Count * 3; ++i)
+	{
+		float const Value = static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX) * 200.0f - 100.0f;
+		End = glm::to_chars(End, &Buffer[0] + Buffer.size(), Value);
+		*End++ = i % 3 == 2 ? '\n' : ' ';
+	}
+	std::string const Text(&Buffer[0], End);
+	double const MegaBytes = static_cast<double>(Text.size()) / 1e6;
+
+	std::vector<float> x(Count), y(Count), z(Count);
+	float * const Arrays[] = {&x[0], &y[0], &z[0]};
+
+	std::clock_t const Timestamp0 = std::clock();
+	{
+		std::istringstream Stream(Text);
+		for(std::size_t i = 0; i < Count; ++i)
+			Stream >> x[i] >> y[i] >> z[i];
+	}
+	std::clock_t const Timestamp1 = std::clock();
+	{
+		char const * Cursor = Text.c_str();
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			char * Next = 0;
+			x[i] = static_cast<float>(std::strtod(Cursor, &Next));
+			y[i] = static_cast<float>(std::strtod(Next, &Next));
+			z[i] = static_cast<float>(std::strtod(Next, &Next));
+			Cursor = Next;
+		}
+	}
+	std::clock_t const Timestamp2 = std::clock();
+	std::size_t const Read = glm::from_chars(Text.c_str(), Text.c_str() + Text.size(), Arrays, 3, Count);
+	std::clock_t const Timestamp3 = std::clock();
+
+	Error += Read == Count ? 0 : 1;
+
+	double const Scale = static_cast<double>(CLOCKS_PER_SEC);
+	std::printf("%.1f MB of vec3 text: istringstream %.0f MB/s, strtod %.0f MB/s, from_chars %.0f MB/s\n", MegaBytes,
+		MegaBytes * Scale / static_cast<double>(Timestamp1 - Timestamp0 + 1),
+		MegaBytes * Scale / static_cast<double>(Timestamp2 - Timestamp1 + 1),
+		MegaBytes * Scale / static_cast<double>(Timestamp3 - Timestamp2 + 1));
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
 	Error += test_string_cast_vector();
 	Error += test_string_cast_matrix();
+	Error += test_to_chars();
+	Error += test_to_chars_round_trip();
+	Error += perf_to_chars();
+	Error += test_from_chars();
+	Error += test_from_chars_round_trip();
+	Error += test_from_chars_soa();
+	Error += perf_from_chars();
 
 	return Error;
 }
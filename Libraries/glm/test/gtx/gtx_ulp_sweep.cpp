@@ -0,0 +1,222 @@
+#include <glm/gtx/ulp_sweep.hpp>
+#include <glm/gtc/ulp.hpp>
+#include <limits>
+#include <cmath>
+#include <ctime>
+#include <cstdio>
+
+namespace
+{
+	float sqrt_float(float x)
+	{
+		return std::sqrt(x);
+	}
+
+	double sqrt_double(double x)
+	{
+		return std::sqrt(x);
+	}
+
+	// Off by 2^-22 relative, from 2 to 4 ULP
+	float scaled_float(float x)
+	{
+		return x * (1.0f + 1.0f / 4194304.0f);
+	}
+
+	double identity_double(double x)
+	{
+		return x;
+	}
+
+#	if GLM_HAS_ALIGNED_TYPE
+	double exp_double(double x)
+	{
+		return std::exp(x);
+	}
+
+	double exp2_double(double x)
+	{
+		return std::pow(2.0, x);
+	}
+
+	double log2_double(double x)
+	{
+		return std::log(x) / std::log(2.0);
+	}
+#	endif//GLM_HAS_ALIGNED_TYPE
+
+	double sin_double(double x)
+	{
+		return std::sin(x);
+	}
+
+	void print(char const * Name, glm::ulp_report const & Report)
+	{
+		std::printf("%-24s max %10.2f ULP, mean %6.3f ULP, %llu samples, %llu mismatches, worst input %.9g\n",
+			Name, Report.MaxError, Report.MeanError,
+			static_cast<unsigned long long>(Report.Count), static_cast<unsigned long long>(Report.Mismatches),
+			Report.Count > 0 ? Report.Worst[0].Input : 0.0f);
+	}
+}//namespace
+
+int test_float_count()
+{
+	int Error = 0;
+
+	Error += glm::float_count(1.0f, 2.0f) == (1u << 23) + 1 ? 0 : 1;
+	Error += glm::float_count(-0.0f, 0.0f) == 2 ? 0 : 1;
+	Error += glm::float_count(2.0f, 1.0f) == 0 ? 0 : 1;
+
+	// Every float but the NaNs
+	float const Inf = std::numeric_limits<float>::infinity();
+	Error += glm::float_count(-Inf, Inf) == (static_cast<glm::uint64>(1) << 32) - (static_cast<glm::uint64>(1) << 24) + 2 ? 0 : 1;
+
+	return Error;
+}
+
+int test_ulp_error()
+{
+	int Error = 0;
+
+	float const Inf = std::numeric_limits<float>::infinity();
+	float const NaN = std::numeric_limits<float>::quiet_NaN();
+	double const DoubleInf = std::numeric_limits<double>::infinity();
+
+	Error += glm::ulp_error(1.0f, 1.0) == 0.0 ? 0 : 1;
+	Error += glm::ulp_error(glm::next_float(1.0f), 1.0) == 1.0 ? 0 : 1;
+	Error += glm::ulp_error(1.0f, 1.0 + std::ldexp(1.0, -24)) == 0.5 ? 0 : 1;
+	Error += glm::ulp_error(glm::prev_float(1.0f), 1.0) == 0.5 ? 0 : 1;
+
+	// Denormals are spaced by 2^-149
+	Error += glm::ulp_error(0.0f, std::ldexp(1.0, -148)) == 2.0 ? 0 : 1;
+
+	// Special values
+	Error += glm::ulp_error(Inf, 1e39) == 0.0 ? 0 : 1;
+	Error += glm::ulp_error(Inf, 1.0) == DoubleInf ? 0 : 1;
+	Error += glm::ulp_error(-Inf, DoubleInf) == DoubleInf ? 0 : 1;
+	Error += glm::ulp_error(NaN, static_cast<double>(NaN)) == 0.0 ? 0 : 1;
+	Error += glm::ulp_error(0.0f, static_cast<double>(NaN)) == DoubleInf ? 0 : 1;
+
+	return Error;
+}
+
+// Every float of [1, 4)
+int test_exhaustive()
+{
+	int Error = 0;
+
+	glm::ulp_report const Report = glm::ulp_sweep(1.0f, glm::prev_float(4.0f), 0, sqrt_float, sqrt_double);
+	print("sqrt", Report);
+
+	Error += Report.Count == (1u << 24) ? 0 : 1;
+	Error += Report.Mismatches == 0 ? 0 : 1;
+	Error += Report.MaxError <= 0.5 ? 0 : 1;
+
+	return Error;
+}
+
+int test_stratified()
+{
+	int Error = 0;
+
+	float const Max = std::numeric_limits<float>::max();
+	glm::ulp_report const Report = glm::ulp_sweep(-Max, Max, 1 << 16, scaled_float, identity_double);
+	print("scaled", Report);
+
+	Error += Report.Count == (1u << 16) ? 0 : 1;
+
+	// Overflows of the largest floats
+	Error += Report.Mismatches > 0 ? 0 : 1;
+	Error += Report.MaxError == std::numeric_limits<double>::infinity() ? 0 : 1;
+	Error += Report.MeanError >= 2.0 && Report.MeanError <= 4.0 ? 0 : 1;
+
+	for(std::size_t i = 1; i < glm::ulp_report::WorstCount; ++i)
+		Error += Report.Worst[i - 1].Error >= Report.Worst[i].Error ? 0 : 1;
+	Error += Report.Worst[0].Error == Report.MaxError ? 0 : 1;
+	Error += Report.Worst[0].Result == std::numeric_limits<float>::infinity() || Report.Worst[0].Result == -std::numeric_limits<float>::infinity() ? 0 : 1;
+
+	// Inputs are distinct
+	glm::ulp_report const Small = glm::ulp_sweep(1.0f, 2.0f, 3, scaled_float, identity_double);
+	Error += Small.Count == 3 ? 0 : 1;
+	Error += Small.Worst[0].Input != Small.Worst[1].Input && Small.Worst[1].Input != Small.Worst[2].Input ? 0 : 1;
+
+	return Error;
+}
+
+// Errors of the approximations of aligned_mediump and aligned_lowp, relative error bounds of precision_tier converted to ULP
+int test_precision_tiers()
+{
+	int Error = 0;
+
+#	if GLM_HAS_ALIGNED_TYPE
+		glm::uint64 const SampleCount = 1 << 18;
+		double const Ulp = 16777216.0;
+
+		glm::ulp_vec4_kernel<glm::aligned_highp> const Exp2Highp = {glm::exp2<float, glm::aligned_highp, glm::tvec4>};
+		glm::ulp_vec4_kernel<glm::aligned_mediump> const Exp2Mediump = {glm::exp2<float, glm::aligned_mediump, glm::tvec4>};
+		glm::ulp_vec4_kernel<glm::aligned_lowp> const Exp2Lowp = {glm::exp2<float, glm::aligned_lowp, glm::tvec4>};
+		glm::ulp_vec4_kernel<glm::aligned_mediump> const ExpMediump = {glm::exp<float, glm::aligned_mediump, glm::tvec4>};
+		glm::ulp_vec4_kernel<glm::aligned_mediump> const Log2Mediump = {glm::log2<float, glm::aligned_mediump, glm::tvec4>};
+		glm::ulp_vec4_kernel<glm::aligned_mediump> const SqrtMediump = {glm::sqrt<float, glm::aligned_mediump, glm::tvec4>};
+
+		glm::ulp_report const Exp2HighpReport = glm::ulp_sweep(-120.0f, 120.0f, SampleCount, Exp2Highp, exp2_double);
+		glm::ulp_report const Exp2MediumpReport = glm::ulp_sweep(-120.0f, 120.0f, SampleCount, Exp2Mediump, exp2_double);
+		glm::ulp_report const Exp2LowpReport = glm::ulp_sweep(-120.0f, 120.0f, SampleCount, Exp2Lowp, exp2_double);
+		glm::ulp_report const ExpMediumpReport = glm::ulp_sweep(-80.0f, 80.0f, SampleCount, ExpMediump, exp_double);
+		glm::ulp_report const Log2MediumpReport = glm::ulp_sweep(1.0f, 2.0f, SampleCount, Log2Mediump, log2_double);
+		glm::ulp_report const SqrtMediumpReport = glm::ulp_sweep(0.0f, std::numeric_limits<float>::max(), SampleCount, SqrtMediump, sqrt_double);
+
+		print("exp2 aligned_highp", Exp2HighpReport);
+		print("exp2 aligned_mediump", Exp2MediumpReport);
+		print("exp2 aligned_lowp", Exp2LowpReport);
+		print("exp aligned_mediump", ExpMediumpReport);
+		print("log2 aligned_mediump", Log2MediumpReport);
+		print("sqrt aligned_mediump", SqrtMediumpReport);
+
+		Error += Exp2HighpReport.MaxError <= 1.0 ? 0 : 1;
+		Error += Exp2MediumpReport.MaxError <= 1e-5 * Ulp ? 0 : 1;
+		Error += Exp2LowpReport.MaxError <= 1e-3 * Ulp ? 0 : 1;
+		Error += ExpMediumpReport.MaxError <= 1e-5 * Ulp ? 0 : 1;
+		Error += Log2MediumpReport.MaxError <= 5e-7 * Ulp ? 0 : 1;
+		Error += SqrtMediumpReport.MaxError <= 0.5 ? 0 : 1;
+		Error += Exp2MediumpReport.Mismatches + Exp2LowpReport.Mismatches + ExpMediumpReport.Mismatches + Log2MediumpReport.Mismatches == 0 ? 0 : 1;
+#	endif//GLM_HAS_ALIGNED_TYPE
+
+	return Error;
+}
+
+// Throughput of a sweep of the C library sine, and the time of a sweep of every float at this rate
+int perf_sweep()
+{
+	int Error = 0;
+
+	glm::uint64 const SampleCount = 1 << 22;
+
+	std::clock_t const TimeStart = std::clock();
+	glm::ulp_report const Report = glm::ulp_sweep(-1e4f, 1e4f, SampleCount, static_cast<float(*)(float)>(std::sin), sin_double);
+	std::clock_t const TimeEnd = std::clock();
+	print("sin", Report);
+
+	// std::clock measures the processor time of all threads
+	double const Seconds = static_cast<double>(TimeEnd - TimeStart + 1) / static_cast<double>(CLOCKS_PER_SEC);
+	std::printf("%.1f MSamples/s per thread, %.0f s of processor time for every float\n",
+		static_cast<double>(SampleCount) / Seconds / 1e6, 4294967296.0 / static_cast<double>(SampleCount) * Seconds);
+
+	Error += Report.MaxError <= 1.0 ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_float_count();
+	Error += test_ulp_error();
+	Error += test_exhaustive();
+	Error += test_stratified();
+	Error += test_precision_tiers();
+	Error += perf_sweep();
+
+	return Error;
+}